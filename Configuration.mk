@@ -25,6 +25,14 @@ MANDIR ?= $(PREFIX)/man/man1
 LIBM ?= -lm
 LIBDL ?=
 
+# The events device (ENABLE_EVENTS, part of the full profile) and
+# ENABLE_THREADS (see below) use POSIX threads. LIBPTHREAD is added
+# to LIBTHREADS when either is enabled; set it empty if your system
+# provides them in libc.
+
+LIBPTHREAD ?= -lpthread
+LIBTHREADS ?=
+
 # -------------------------------------------------------------
 
 # If using the Python toolchain, remove the -DBIT64 from the
@@ -43,11 +51,49 @@ OPTIONS ?=
 
 # OPTIONS += -march=native
 
+# This counts the calls and jumps to each address, so that
+# `retro --count-calls filename` can write a profile for
+# retro-relink. It slows the VM down, so only use it to build
+# a runtime for profiling.
+
+# OPTIONS += -DCOUNT_CALLS
+
+# Flags used by the `pgo` and `lto` release targets. The PGO
+# target builds the amalgamated runtime with PGO_GENERATE, runs
+# PGO_TRAINING as the workload, and rebuilds with PGO_USE. The
+# defaults are for GCC; with clang, merge the raw profile with
+# llvm-profdata and point PGO_USE at the result.
+
+RELEASE_CFLAGS ?= -O2
+LTO_FLAGS ?= -flto
+PGO_GENERATE ?= -fprofile-generate
+PGO_USE ?= -fprofile-use -fprofile-correction
+PGO_TRAINING ?= \
+	benchmarks/times.retro \
+	benchmarks/push-drop.retro \
+	benchmarks/choose.retro \
+	tests/test-core.forth
+
+# Used by the `aot` target. retro-aot translates the code in
+# AOT_IMAGE that can be reached from the words in AOT_WORDS (or
+# from every word, if none are given) to C, which is built with
+# the runtime as AOT_BINARY.
+
+AOT_IMAGE ?= bin/rre.image
+AOT_WORDS ?=
+AOT_BINARY ?= bin/retro-native
+
 # Select a feature profile with `make PROFILE=...`. `full` preserves
 # the historical default; callers may still append feature flags through
 # ENABLED or replace the embedded interfaces through DEVICES.
+#
+# Adding -DENABLE_THREADS to ENABLED runs each started core on
+# its own OS thread rather than interleaving them on one. This
+# implies ENABLE_MULTICORE. Add -DCORES=n to change the number
+# of cores (the default is 8).
 
 OPTIONS += -DMAKEFILE_CONFIG
+OPTIONS += -DRETRO_DATADIR='"$(DATADIR)"'
 
 PROFILE ?= full
 ENABLED ?=
@@ -65,7 +111,8 @@ PROFILE_FULL = \
 	-DENABLE_UNSIGNED \
 	-DENABLE_MALLOC \
 	-DENABLE_BLOCKS \
-	-DENABLE_IOCTL
+	-DENABLE_IOCTL \
+	-DENABLE_EVENTS
 
 PROFILE_PORTABLE = \
 	-DENABLE_FLOATS \
@@ -79,7 +126,18 @@ PROFILE_PORTABLE = \
 PROFILE_MINIMAL = \
 	-DENABLE_SCRIPTING
 
+# The stack comments and descriptions of the words take up more
+# than half of the image. With `make METADATA=external`, they are not
+# kept in the image. `d:describe` then reads them, as needed, from
+# doc/words.tsv (or the copy installed in DATADIR).
+
+METADATA ?= embedded
+
+METADATA_EMBEDDED =
+METADATA_EXTERNAL = interface/external-metadata.retro
+
 DEVICES ?=
+DEVICES += $(METADATA_INTERFACE)
 DEVICES += interface/ll.retro
 DEVICES += interface/dedup.retro
 DEVICES += interface/stack-comments.retro
@@ -93,6 +151,7 @@ DEVICES += interface/clock.retro
 DEVICES += interface/scripting.retro
 DEVICES += interface/sockets.retro
 DEVICES += interface/multicore.retro
+DEVICES += interface/events.retro
 DEVICES += interface/ffi.retro
 DEVICES += interface/unsigned.retro
 DEVICES += interface/future.retro
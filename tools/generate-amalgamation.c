@@ -127,6 +127,7 @@ void emit_file(const char *path, int depth) {
 void emit_prelude(void) {
   puts("/* Build with: cc -O2 retro-unix.c -lm -o retro */");
   puts("");
+  puts("#ifndef MAKEFILE_CONFIG");
   puts("#define ENABLE_FLOATS");
   puts("#define ENABLE_FILES");
   puts("#define ENABLE_UNIX");
@@ -140,6 +141,7 @@ void emit_prelude(void) {
   puts("#undef ENABLE_UNIX");
   puts("#undef ENABLE_RNG");
   puts("#endif");
+  puts("#endif");
   puts("");
 }
 
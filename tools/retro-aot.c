@@ -0,0 +1,448 @@
+/* RETRO ------------------------------------------------------
+  A personal, minimalistic forth
+  Copyright (c) 2016 - 2020 Charles Childers
+
+  This is retro-aot, a tool to translate the code in an image
+  to C. The output takes the place of vm/nga-c/image_data.c
+  when building the runtime with -DAOT (see the `aot` target),
+  giving a binary with the image and its code built in.
+
+  The code is found by following the calls, jumps, and the
+  addresses pushed by `li` from the entry words, or from each
+  word that is not data if none are named. Each word found
+  becomes a C function, with a label for each of its bundles.
+
+  The compiled code runs each bundle with the same instruction
+  handlers as `execute` (or the fast paths for them in
+  vm/nga-c/aot.h), so device I/O still goes through the handler
+  tables, and errors are caught in the same way. What it saves
+  is the fetching and decoding of each bundle, and the dispatch
+  for each instruction. Jumps and calls to a known
+  address go straight to its label. Returns, and jumps and calls
+  to computed addresses, go back through a table of the compiled
+  addresses; anything not in it is run by the interpreter.
+
+  Each bundle checks that the cells it was compiled from have not
+  changed before it runs, and leaves it to the interpreter if
+  they have. This keeps hooks, and code that is recompiled or
+  patched while running, working as before.
+  ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "generated/retro_layout.h"
+
+#ifndef BIT64
+#define CELL int32_t
+#else
+#define CELL int64_t
+#endif
+
+#ifndef IMAGE_SIZE
+#define IMAGE_SIZE   524288       /* Amount of RAM, in cells */
+#endif
+
+#include "../vm/nga-c/image_format.h"
+
+#define NGA_LI 1
+#define NGA_JU 7
+#define NGA_CA 8
+#define NGA_CC 9
+#define NGA_RE 10
+
+/* The instructions with a fast path in vm/nga-c/aot.h use it. */
+
+char *handlers[] = {
+  "i_no", "AOT_LI", "AOT_DU", "AOT_DR", "AOT_SW", "AOT_PU", "AOT_PO",
+  "AOT_JU", "AOT_CA", "i_cc", "i_re", "i_eq", "i_ne", "i_lt",
+  "i_gt", "i_fe", "i_st", "i_ad", "i_su", "i_mu", "i_di",
+  "i_an", "i_or", "i_xo", "i_sh", "i_zr", "i_ha", "i_ie",
+  "i_iq", "i_ii"
+};
+
+CELL memory[IMAGE_SIZE + 1];
+CELL Heap, imageSize;
+
+char boundary[IMAGE_SIZE + 1];  /* Set at each header and xt            */
+char fields[IMAGE_SIZE + 1];    /* Set for each cell in a header        */
+char data[IMAGE_SIZE + 1];      /* Set for the xt of each data word     */
+char compiled[IMAGE_SIZE + 1];  /* Set for each bundle to compile       */
+CELL named[IMAGE_SIZE + 1];     /* The header for each xt               */
+
+CELL *pending;
+CELL queued, slots;
+
+
+CELL load_image(char *imageFile) {
+  FILE *fp;
+  CELL cells = 0;
+  long fileLen;
+  unsigned char *bytes;
+  if ((fp = fopen(imageFile, "rb")) == NULL) {
+    fprintf(stderr, "Unable to find the image: %s\n", imageFile);
+    exit(1);
+  }
+  fseek(fp, 0, SEEK_END);
+  fileLen = ftell(fp);
+  rewind(fp);
+  bytes = malloc(fileLen + 1);
+  if (bytes == NULL || fread(bytes, 1, fileLen, fp) != (size_t)fileLen) {
+    fprintf(stderr, "Unable to read the image: %s\n", imageFile);
+    exit(1);
+  }
+  fclose(fp);
+  if (packed_image(bytes, fileLen)) {
+    cells = unpack_image(bytes, fileLen, memory, IMAGE_SIZE);
+    if (cells < 0) {
+      fprintf(stderr, "Unable to unpack the image: %s\n", imageFile);
+      exit(1);
+    }
+  } else {
+    cells = fileLen / sizeof(CELL);
+    if (cells > IMAGE_SIZE) cells = IMAGE_SIZE;
+    memcpy(memory, bytes, cells * sizeof(CELL));
+  }
+  free(bytes);
+  return cells;
+}
+
+
+/* Bundles hold four opcodes, the lowest first. Each `li` takes
+   its value from the cell after the bundle (or after the value
+   of the prior `li`). */
+
+int is_bundle(CELL cell) {
+  int i;
+  for (i = 0; i < 4; i++, cell >>= 8)
+    if ((cell & 0xFF) > 29 || (cell & 0xFF) < 0)
+      return 0;
+  return 1;
+}
+
+int opcode(CELL cell, int slot) {
+  return (cell >> (slot * 8)) & 0xFF;
+}
+
+int literals(CELL cell) {
+  int slot, count = 0;
+  for (slot = 0; slot < 4; slot++)
+    if (opcode(cell, slot) == NGA_LI)
+      count++;
+  return count;
+}
+
+int is_control(int op) {
+  return op == NGA_JU || op == NGA_CA || op == NGA_CC;
+}
+
+int ends_flow(CELL cell) {
+  int slot;
+  for (slot = 0; slot < 4; slot++)
+    if (opcode(cell, slot) == NGA_JU || opcode(cell, slot) == NGA_RE)
+      return 1;
+  return 0;
+}
+
+CELL string_end(CELL at) {
+  while (at < Heap && memory[at] != 0)
+    at++;
+  return at;
+}
+
+
+/* Find the headers. The variables at the start of the image,
+   the headers, and the text input buffer are not code. */
+
+CELL find_word(char *name) {
+  CELL dt, at;
+  size_t i;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    at = dt + RETRO_DICT_OFFSET_NAME;
+    for (i = 0; name[i] != 0 && memory[at] == (unsigned char)name[i]; i++, at++);
+    if (name[i] == 0 && memory[at] == 0)
+      return dt;
+  }
+  return 0;
+}
+
+void scan_headers() {
+  CELL dt, at, end, xt, class_data = 0;
+  if ((dt = find_word("class:data")) != 0)
+    class_data = memory[dt + RETRO_DICT_OFFSET_XT];
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    end = string_end(dt + RETRO_DICT_OFFSET_NAME);
+    for (at = dt; at <= end; at++)
+      fields[at] = 1;
+    boundary[dt] = 1;
+  }
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    xt = memory[dt + RETRO_DICT_OFFSET_XT];
+    if (xt <= 0 || xt >= Heap)
+      continue;
+    boundary[xt] = 1;
+    if (named[xt] == 0)
+      named[xt] = dt;
+    if (memory[dt + RETRO_DICT_OFFSET_CLASS] == class_data)
+      data[xt] = 1;
+  }
+  boundary[memory[RETRO_IMAGE_TIB]] = 1;
+  boundary[memory[RETRO_IMAGE_TIB_END]] = 1;
+}
+
+int code_cell(CELL at) {
+  if (at < 0 || at >= Heap || fields[at] || data[at])
+    return 0;
+  if (at >= 1 && at <= RETRO_IMAGE_DICTREHASH)
+    return 0;
+  if (at >= memory[RETRO_IMAGE_TIB] && at < memory[RETRO_IMAGE_TIB_END])
+    return 0;
+  return is_bundle(memory[at]);
+}
+
+
+/* Follow the code from each entry. Addresses pushed by a `li` are
+   followed as well, as they may be quotes or words that will be
+   called. Compiling a cell that is never run as code does no harm,
+   as it is only run if execution reaches it. */
+
+void queue(CELL at) {
+  if (!code_cell(at) || compiled[at])
+    return;
+  if (queued == slots) {
+    slots = slots ? slots * 2 : 1024;
+    if ((pending = realloc(pending, slots * sizeof(CELL))) == NULL) {
+      fprintf(stderr, "Out of memory\n");
+      exit(1);
+    }
+  }
+  pending[queued++] = at;
+}
+
+void follow(CELL at) {
+  int slot, n;
+  while (code_cell(at) && !compiled[at]) {
+    if (at + literals(memory[at]) >= Heap)
+      return;
+    compiled[at] = 1;
+    for (n = 0, slot = 0; slot < 4; slot++) {
+      if (opcode(memory[at], slot) != NGA_LI)
+        continue;
+      n++;
+      queue(memory[at + n]);
+    }
+    if (ends_flow(memory[at]))
+      return;
+    at += n + 1;
+  }
+}
+
+void find_code(int argc, char **argv) {
+  CELL dt, xt;
+  int i;
+  queue(0);
+  queue(memory[RETRO_IMAGE_INTERPRET]);
+  queue(memory[RETRO_IMAGE_NOTFOUND]);
+  for (i = 0; i < argc; i++) {
+    if ((dt = find_word(argv[i])) == 0) {
+      fprintf(stderr, "Unable to find the word: %s\n", argv[i]);
+      exit(1);
+    }
+    queue(memory[dt + RETRO_DICT_OFFSET_XT]);
+  }
+  if (argc == 0) {
+    for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+      xt = memory[dt + RETRO_DICT_OFFSET_XT];
+      if (xt > 0 && xt < Heap)
+        queue(xt);
+    }
+  }
+  while (queued > 0)
+    follow(pending[--queued]);
+}
+
+
+/* Output */
+
+void put_cell(CELL value) {
+#ifdef BIT64
+  if (value == INT64_MIN) {
+    printf("(-%lldLL - 1)", (long long)INT64_MAX);
+    return;
+  }
+#endif
+  printf("%lldLL", (long long)value);
+}
+
+void put_name(CELL dt) {
+  CELL at;
+  int star = 0;
+  for (at = dt + RETRO_DICT_OFFSET_NAME; memory[at] != 0; at++) {
+    if (star && memory[at] == '/')
+      putchar(' ');
+    if (memory[at] >= 32 && memory[at] < 256)
+      putchar((int)memory[at]);
+    star = memory[at] == '*';
+  }
+}
+
+void put_image() {
+  unsigned char *bytes = malloc(packed_image_bound(imageSize));
+  size_t count, i;
+  if (bytes == NULL) {
+    fprintf(stderr, "Unable to pack the image\n");
+    exit(1);
+  }
+  count = pack_image(memory, imageSize, bytes);
+  printf("CELL ngaImageCells = %lld;\n", (long long)imageSize);
+  printf("size_t ngaImagePackedBytes = %lld;\n", (long long)count);
+  printf("const unsigned char ngaImagePacked[] = {");
+  for (i = 0; i < count; i++) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", bytes[i], i + 1 < count ? "," : " };\n\n");
+  }
+  free(bytes);
+  printf("V load_embedded_image(NgaState *vm) {\n");
+  printf("  if (ngaImageCells > MEMORY_SIZE) {\n");
+  printf("    vm_printf(vm, \"\\nERROR (nga/load_embedded_image): Image is larger than alloted space!\\n\");\n");
+  printf("    halt_vm(vm, 1);\n");
+  printf("    return;\n");
+  printf("  }\n");
+  printf("  if (unpack_image(ngaImagePacked, ngaImagePackedBytes, vm->memory, MEMORY_SIZE) < 0) {\n");
+  printf("    vm_printf(vm, \"\\nERROR (nga/load_embedded_image): Unable to unpack the image!\\n\");\n");
+  printf("    halt_vm(vm, 1);\n");
+  printf("    return;\n");
+  printf("  }\n");
+  printf("  mark_dirty(vm, 0, ngaImageCells);\n");
+  printf("}\n\n");
+}
+
+/* Each bundle is a label. It returns 0 if the cells have changed,
+   so that the interpreter runs them, 1 if `execute` needs to take
+   over after it, or 2 to carry on at an address outside of the
+   word. */
+
+void put_next(CELL at, CELL start, CELL end) {
+  if (at >= start && at < end && compiled[at])
+    printf("  if (ACTIVE.ip == %lld) goto L%lld;\n", (long long)at, (long long)at);
+}
+
+void put_bundle(CELL at, CELL start, CELL end) {
+  CELL cell = memory[at];
+  int slot, n = literals(cell);
+  printf(" L%lld:\n  if (vm->memory[%lld] != ", (long long)at, (long long)at);
+  put_cell(cell);
+  for (slot = 1; slot <= n; slot++) {
+    printf(" || vm->memory[%lld] != ", (long long)(at + slot));
+    put_cell(memory[at + slot]);
+  }
+  printf(") return 0;\n ");
+  for (slot = 0; slot < 4; slot++)
+    if (opcode(cell, slot) != 0)
+      printf(" %s(vm);", handlers[opcode(cell, slot)]);
+  printf("\n  if (!aot_next(vm, ");
+  put_cell(cell);
+  printf(", core)) return 1;\n");
+  for (n = 0, slot = 0; slot < 4; slot++) {
+    if (opcode(cell, slot) != NGA_LI)
+      continue;
+    n++;
+    if (slot < 3 && is_control(opcode(cell, slot + 1)))
+      put_next(memory[at + n], start, end);
+  }
+  if (!ends_flow(cell))
+    put_next(at + n + 1, start, end);
+  printf("  return 2;\n");
+}
+
+CELL word_end(CELL start) {
+  CELL end = start + 1;
+  while (end < Heap && !boundary[end])
+    end++;
+  return end;
+}
+
+int put_words() {
+  CELL start, end, at;
+  int words = 0;
+  for (start = 0; start < Heap; start = end) {
+    end = word_end(start);
+    for (at = start; at < end && !compiled[at]; at++);
+    if (at == end)
+      continue;
+    words++;
+    if (named[start] != 0) {
+      printf("/* ");
+      put_name(named[start]);
+      printf(" */\n");
+    }
+    printf("static int w%lld(NgaState *vm, CELL core) {\n", (long long)start);
+    printf("  switch (ACTIVE.ip) {\n");
+    for (at = start; at < end; at++)
+      if (compiled[at])
+        printf("    case %lld: goto L%lld;\n", (long long)at, (long long)at);
+    printf("  }\n  return 0;\n");
+    for (at = start; at < end; at++)
+      if (compiled[at])
+        put_bundle(at, start, end);
+    printf("}\n\n");
+  }
+  return words;
+}
+
+void put_table() {
+  CELL start, end, at;
+  printf("static int (*const aot_words[%lld])(NgaState *, CELL) = {\n", (long long)Heap);
+  for (start = 0; start < Heap; start = end) {
+    end = word_end(start);
+    for (at = start; at < end; at++)
+      if (compiled[at])
+        printf("  [%lld] = w%lld,\n", (long long)at, (long long)start);
+  }
+  printf("};\n\n");
+  printf("int aot_run(NgaState *vm, CELL core) {\n");
+  printf("  int ran = 0, status;\n");
+  printf("  while (ACTIVE.ip >= 0 && ACTIVE.ip < %lld && aot_words[ACTIVE.ip] != NULL) {\n", (long long)Heap);
+  printf("    status = aot_words[ACTIVE.ip](vm, core);\n");
+  printf("    if (status != 2)\n");
+  printf("      return ran || status;\n");
+  printf("    ran = 1;\n");
+  printf("  }\n");
+  printf("  return ran;\n");
+  printf("}\n");
+}
+
+
+int main(int argc, char **argv) {
+  CELL at, bundles = 0;
+  int words;
+  if (argc < 2) {
+    fprintf(stderr, "Usage: retro-aot image [word ...]\n");
+    exit(1);
+  }
+  imageSize = load_image(argv[1]);
+  Heap = memory[RETRO_IMAGE_HEAP];
+  if (Heap <= memory[RETRO_IMAGE_TIB_END] || Heap > imageSize ||
+      memory[RETRO_IMAGE_TIB] <= RETRO_IMAGE_DICTREHASH) {
+    fprintf(stderr, "This does not look like a RETRO image: %s\n", argv[1]);
+    exit(1);
+  }
+  scan_headers();
+  find_code(argc - 2, argv + 2);
+
+  printf("/* Generated by retro-aot from %s. Build with -DAOT, in place\n", argv[1]);
+  printf("   of vm/nga-c/image_data.c. */\n\n");
+  printf("#include \"aot.h\"\n\n");
+  printf("#ifndef AOT\n#error \"this must be built with -DAOT\"\n#endif\n\n");
+  put_image();
+  words = put_words();
+  put_table();
+
+  for (at = 0; at < Heap; at++)
+    bundles += compiled[at];
+  fprintf(stderr, "Compiled %lld bundles in %d words\n", (long long)bundles, words);
+  return 0;
+}
@@ -5,6 +5,10 @@
   This loads an image file and generates a C formatted output
   suitable for being linked into the virtual machine. It's
   used to create the `image.c` that gets linked into `retro`.
+
+  With `-p`, the image is emitted in packed form (see
+  vm/nga-c/image_format.h) as `ngaImagePacked`, rather than
+  as an array of cells.
   ---------------------------------------------------------- */
 
 #include <stdio.h>
@@ -23,20 +27,39 @@
 #define CELL_MAX LLONG_MAX - 1
 #endif
 
-CELL memory[512*1024];
+#include "../vm/nga-c/image_format.h"
+
+#define MAX_CELLS (512*1024)
+
+CELL memory[MAX_CELLS];
 
 CELL ngaLoadImage(char *imageFile) {
   FILE *fp;
   CELL imageSize;
   long fileLen;
+  unsigned char *data;
   if ((fp = fopen(imageFile, "rb")) != NULL) {
-    /* Determine length (in cells) */
     fseek(fp, 0, SEEK_END);
-    fileLen = ftell(fp) / sizeof(CELL);
+    fileLen = ftell(fp);
     rewind(fp);
-    /* Read the file into memory */
-    imageSize = fread(&memory, sizeof(CELL), fileLen, fp);
+    data = malloc(fileLen + 1);
+    if (data == NULL || fread(data, 1, fileLen, fp) != (size_t)fileLen) {
+      printf("Unable to read the ngaImage!\n");
+      exit(1);
+    }
     fclose(fp);
+    if (packed_image(data, fileLen)) {
+      imageSize = unpack_image(data, fileLen, memory, MAX_CELLS);
+      if (imageSize < 0) {
+        printf("Unable to unpack the ngaImage!\n");
+        exit(1);
+      }
+    } else {
+      imageSize = fileLen / sizeof(CELL);
+      if (imageSize > MAX_CELLS) imageSize = MAX_CELLS;
+      memcpy(memory, data, imageSize * sizeof(CELL));
+    }
+    free(data);
   }
   else {
     printf("Unable to find the ngaImage!\n");
@@ -46,6 +69,7 @@ CELL ngaLoadImage(char *imageFile) {
 }
 
 void output_header(int size) {
+  printf("#include <stddef.h>\n");
   printf("#include <stdint.h>\n");
   printf("#ifndef CELL\n");
   printf("#ifndef BIT64\n");
@@ -59,20 +83,51 @@ void output_header(int size) {
   printf("#endif\n");
   printf("#endif\n");
   printf("CELL ngaImageCells = %lld;\n", (long long)size);
-  printf("CELL ngaImage[] = { ");
+}
+
+void output_packed(int size) {
+  unsigned char *data = malloc(packed_image_bound(size));
+  size_t bytes, i;
+  if (data == NULL) {
+    printf("Unable to pack the ngaImage!\n");
+    exit(1);
+  }
+  bytes = pack_image(memory, size, data);
+  output_header(size);
+  printf("size_t ngaImagePackedBytes = %lld;\n", (long long)bytes);
+  printf("const unsigned char ngaImagePacked[] = {");
+  for (i = 0; i < bytes; i++) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", data[i], i + 1 < bytes ? "," : " };\n");
+  }
+  free(data);
 }
 
 int main(int argc, char **argv) {
   int32_t size = 0;
   int32_t i;
   int32_t n;
+  int packed = 0;
+
+  if (argc > 1 && strcmp(argv[1], "-p") == 0) {
+    packed = 1;
+    argc--;
+    argv++;
+  }
 
   if (argc == 2)
       size = ngaLoadImage(argv[1]);
   else
       size = ngaLoadImage("ngaImage");
 
+  if (packed) {
+    output_packed(size);
+    exit(0);
+  }
+
   output_header(size);
+  printf("CELL ngaImage[] = { ");
 
   i = 0;
   n = 0;
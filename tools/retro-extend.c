@@ -8,6 +8,10 @@
 
   In addition to the above, this tracks some statistics on
   stack usage.
+
+  The image can be raw cells or packed (see the notes in
+  vm/nga-c/image_format.h). It is saved in the same form it
+  was loaded in, or packed if `-p` is given.
   ---------------------------------------------------------- */
 
 #include <stdio.h>
@@ -52,6 +56,8 @@
 #define STACK_DEPTH  256          /* Depth of data stack */
 #endif
 
+#include "../vm/nga-c/image_format.h"
+
 
 /* Begin the actual code */
 
@@ -70,6 +76,7 @@ void ngaProcessPackedOpcodes(CELL opcode);
 int ngaValidatePackedOpcodes(CELL opcode);
 
 CELL max_sp, max_rsp;
+int packed;
 
 
 CELL Dictionary, Heap, Compiler;
@@ -133,12 +140,42 @@ int include_file(char *fname) {
   return tokens;
 }
 
+int save_image(char *imageFile) {
+  FILE *fp;
+  unsigned char *data;
+  CELL cells = memory[RETRO_IMAGE_HEAP] + 1;
+  size_t bytes;
+  if ((fp = fopen(imageFile, "wb")) == NULL)
+    return 0;
+  if (packed) {
+    data = malloc(packed_image_bound(cells));
+    if (data == NULL) {
+      fclose(fp);
+      return 0;
+    }
+    bytes = pack_image(memory, cells, data);
+    fwrite(data, 1, bytes, fp);
+    free(data);
+  } else {
+    fwrite(&memory, sizeof(CELL), cells, fp);
+  }
+  return fclose(fp) == 0;
+}
+
 int main(int argc, char **argv) {
   int tokens, i;
-  FILE *fp;
   ngaPrepare();
   max_sp = 0;
   max_rsp = 0;
+  if (argc > 1 && strcmp(argv[1], "-p") == 0) {
+    packed = 1;
+    argc--;
+    argv++;
+  }
+  if (argc < 2) {
+    printf("Usage: retro-extend [-p] image [filenames]\n");
+    exit(1);
+  }
   ngaLoadImage(argv[1]);
   update_rx();
   printf("Initial Image Size: %lld\n", (long long)Heap);
@@ -149,12 +186,10 @@ int main(int argc, char **argv) {
   update_rx();
   printf("New Image Size: %lld\n", (long long)Heap);
   printf("MAX SP: %lld, RP: %lld\n", (long long)max_sp, (long long)max_rsp);
-  if ((fp = fopen(argv[1], "wb")) == NULL) {
+  if (!save_image(argv[1])) {
     printf("Unable to save the ngaImage!\n");
     exit(2);
   }
-  fwrite(&memory, sizeof(CELL), memory[RETRO_IMAGE_HEAP] + 1, fp);
-  fclose(fp);
   if (sp != 0) {
     printf("Stack not empty!\n");
     dump_stack();
@@ -283,11 +318,16 @@ void execute(CELL cell) {
 
 /* The `evaluate` function moves a token into the Retro
    token buffer, then calls the Retro `interpret` word
-   to process it. */
+   to process it. A token that does not fit would overwrite
+   the code following the buffer, so this stops instead. */
 
 void evaluate(char *s) {
   if (strlen(s) == 0)
     return;
+  if ((CELL)strlen(s) >= memory[RETRO_IMAGE_TIB_END] - TIB) {
+    printf("\nERROR: Token is too long!\n%.40s...\n", s);
+    exit(1);
+  }
   string_inject(s, TIB);
   stack_push(TIB);
   execute(interpret);
@@ -344,14 +384,30 @@ CELL ngaLoadImage(char *imageFile) {
   FILE *fp;
   CELL imageSize = 0;
   long fileLen;
+  unsigned char *data;
   if ((fp = fopen(imageFile, "rb")) != NULL) {
-    /* Determine length (in cells) */
     fseek(fp, 0, SEEK_END);
-    fileLen = ftell(fp) / sizeof(CELL);
+    fileLen = ftell(fp);
     rewind(fp);
-    /* Read the file into memory */
-    imageSize = fread(&memory, sizeof(CELL), fileLen, fp);
+    data = malloc(fileLen + 1);
+    if (data == NULL || fread(data, 1, fileLen, fp) != (size_t)fileLen) {
+      printf("Unable to read the ngaImage!\n");
+      exit(1);
+    }
     fclose(fp);
+    if (packed_image(data, fileLen)) {
+      packed = 1;
+      imageSize = unpack_image(data, fileLen, memory, IMAGE_SIZE);
+      if (imageSize < 0) {
+        printf("Unable to unpack the ngaImage!\n");
+        exit(1);
+      }
+    } else {
+      imageSize = fileLen / sizeof(CELL);
+      if (imageSize > IMAGE_SIZE) imageSize = IMAGE_SIZE;
+      memcpy(memory, data, imageSize * sizeof(CELL));
+    }
+    free(data);
   }
   else {
     printf("Unable to find the ngaImage!\n");
@@ -0,0 +1,438 @@
+/* RETRO ------------------------------------------------------
+  A personal, minimalistic forth
+  Copyright (c) 2016 - 2020 Charles Childers
+
+  This is retro-minimize, a tool to remove the words that a
+  program does not use from an image.
+
+  Starting from the kernel (which holds the startup word, the
+  interpreter, and the hooks) and any entry words named on the
+  command line, it follows every address that the code and
+  data refer to. The heap is split into chunks: dictionary
+  headers, the code or data at each execution token, and the
+  code or data at each address pushed by a `li`. A chunk that
+  does not end in a `re` or `ju` also keeps the one after it,
+  as execution may fall through to it.
+
+  Chunks that can not be reached are cleared, and their headers
+  are unlinked from the dictionary. Nothing is moved: any cell
+  may hold an address, and the image does not record which do,
+  so relocating the rest could not be done safely. Cleared
+  cells take a couple of bytes each in a packed image.
+
+  Words that are only found by name at run time (e.g., by the
+  interpreter or with `d:lookup`) must be given as entry words.
+  A name ending in `*` keeps all of the words that start with
+  the rest of it, so `sigil:*` keeps the sigils.
+
+  The image can be raw cells or packed (see the notes in
+  vm/nga-c/image_format.h). It is saved in the same form it
+  was loaded in, or packed if `-p` is given.
+  ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "generated/retro_layout.h"
+
+#ifndef BIT64
+#define CELL int32_t
+#else
+#define CELL int64_t
+#endif
+
+#ifndef IMAGE_SIZE
+#define IMAGE_SIZE   524288       /* Amount of RAM, in cells */
+#endif
+
+#include "../vm/nga-c/image_format.h"
+
+#define NGA_LI 1
+#define NGA_JU 7
+#define NGA_RE 10
+
+CELL memory[IMAGE_SIZE + 1];
+int packed;
+
+CELL Base, Heap;              /* The heap is memory[Base] to memory[Heap] */
+
+char boundary[IMAGE_SIZE + 1];  /* Set at the start of each chunk       */
+char header[IMAGE_SIZE + 1];    /* Set at the start of each heap header */
+char live[IMAGE_SIZE + 1];      /* Set for each cell to keep            */
+char fields[IMAGE_SIZE + 1];    /* Set for each cell in a header        */
+char data[IMAGE_SIZE + 1];      /* Set at each xt of a class:data word  */
+
+CELL chunk[IMAGE_SIZE + 1];     /* The start of the chunk for each cell */
+CELL *pending;
+CELL waiting;
+
+
+CELL load_image(char *imageFile) {
+  FILE *fp;
+  CELL imageSize = 0;
+  long fileLen;
+  unsigned char *data;
+  if ((fp = fopen(imageFile, "rb")) == NULL) {
+    printf("Unable to find the image: %s\n", imageFile);
+    exit(1);
+  }
+  fseek(fp, 0, SEEK_END);
+  fileLen = ftell(fp);
+  rewind(fp);
+  data = malloc(fileLen + 1);
+  if (data == NULL || fread(data, 1, fileLen, fp) != (size_t)fileLen) {
+    printf("Unable to read the image: %s\n", imageFile);
+    exit(1);
+  }
+  fclose(fp);
+  if (packed_image(data, fileLen)) {
+    packed = 1;
+    imageSize = unpack_image(data, fileLen, memory, IMAGE_SIZE);
+    if (imageSize < 0) {
+      printf("Unable to unpack the image: %s\n", imageFile);
+      exit(1);
+    }
+  } else {
+    imageSize = fileLen / sizeof(CELL);
+    if (imageSize > IMAGE_SIZE) imageSize = IMAGE_SIZE;
+    memcpy(memory, data, imageSize * sizeof(CELL));
+  }
+  free(data);
+  return imageSize;
+}
+
+int save_image(char *imageFile) {
+  FILE *fp;
+  unsigned char *data;
+  CELL cells = memory[RETRO_IMAGE_HEAP] + 1;
+  size_t bytes;
+  if ((fp = fopen(imageFile, "wb")) == NULL)
+    return 0;
+  if (packed) {
+    data = malloc(packed_image_bound(cells));
+    if (data == NULL) {
+      fclose(fp);
+      return 0;
+    }
+    bytes = pack_image(memory, cells, data);
+    fwrite(data, 1, bytes, fp);
+    free(data);
+  } else {
+    fwrite(&memory, sizeof(CELL), cells, fp);
+  }
+  return fclose(fp) == 0;
+}
+
+
+/* Bundles hold four opcodes, the lowest first. Each `li` takes
+   its value from the cell after the bundle (or after the value
+   of the prior `li`). */
+
+int is_bundle(CELL cell) {
+  int i;
+  for (i = 0; i < 4; i++, cell >>= 8)
+    if ((cell & 0xFF) > 29 || (cell & 0xFF) < 0)
+      return 0;
+  return 1;
+}
+
+int literals(CELL cell) {
+  int i, n = 0;
+  for (i = 0; i < 4; i++, cell >>= 8)
+    if ((cell & 0xFF) == NGA_LI)
+      n++;
+  return n;
+}
+
+int last_opcode(CELL cell) {
+  int i, last = 0;
+  for (i = 0; i < 4; i++, cell >>= 8)
+    if ((cell & 0xFF) != 0)
+      last = cell & 0xFF;
+  return last;
+}
+
+int in_heap(CELL a) {
+  return a >= Base && a < Heap;
+}
+
+CELL string_end(CELL at) {
+  while (at < Heap && memory[at] != 0)
+    at++;
+  return at;
+}
+
+
+/* Chunks start at each header, after the name in each header,
+   at each execution token, at each address that is pushed by a
+   `li`, and after each `re` or `ju`. The heap is decoded from
+   the start to find the last two; runs of cells that are not
+   instructions are taken to be strings, and skipped. */
+
+void find_chunks(CELL class_data) {
+  CELL dt, xt, at, end, n, op;
+  boundary[Base] = 1;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    if (!in_heap(dt))
+      continue;
+    header[dt] = boundary[dt] = 1;
+    end = string_end(dt + RETRO_DICT_OFFSET_NAME) + 1;
+    if (end < Heap) boundary[end] = 1;
+    for (at = dt; at < end; at++)
+      fields[at] = 1;
+  }
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    xt = memory[dt + RETRO_DICT_OFFSET_XT];
+    if (in_heap(dt) && in_heap(xt) && !fields[xt]) {
+      boundary[xt] = 1;
+      data[xt] = memory[dt + RETRO_DICT_OFFSET_CLASS] == class_data;
+    }
+  }
+  for (at = Base; at < Heap; at++) {
+    if (header[at]) {
+      at = string_end(at + RETRO_DICT_OFFSET_NAME);
+      continue;
+    }
+    if (!is_bundle(memory[at])) {
+      at = string_end(at);
+      continue;
+    }
+    op = last_opcode(memory[at]);
+    for (n = literals(memory[at]); n > 0 && at + 1 < Heap; n--) {
+      at++;
+      if (in_heap(memory[at]) && !fields[memory[at]])
+        boundary[memory[at]] = 1;
+    }
+    if ((op == NGA_RE || op == NGA_JU) && at + 1 < Heap && !fields[at + 1])
+      boundary[at + 1] = 1;
+  }
+  for (at = Base; at < Heap; at++)
+    chunk[at] = boundary[at] ? at : chunk[at - 1];
+}
+
+
+/* Keeping a chunk queues it, so that the addresses in it are
+   followed in turn. */
+
+void keep(CELL a) {
+  CELL c;
+  if (!in_heap(a) || live[chunk[a]])
+    return;
+  c = chunk[a];
+  for (a = c; a < Heap && (a == c || !boundary[a]); a++)
+    live[a] = 1;
+  pending[waiting++] = c;
+}
+
+void keep_string(CELL a) {
+  if (!in_heap(a))
+    return;
+  while (a < Heap && memory[a] != 0)
+    live[a++] = 1;
+  if (a < Heap) live[a] = 1;
+}
+
+/* The metadata is kept without the chunks that hold it, as the
+   strings are often compiled amongst other words. */
+
+void keep_metadata(CELL dt) {
+  keep(memory[dt + RETRO_DICT_OFFSET_CLASS]);
+  keep_string(memory[dt + RETRO_DICT_OFFSET_SOURCE]);
+  keep_string(memory[dt + RETRO_DICT_OFFSET_STACK]);
+  keep_string(memory[dt + RETRO_DICT_OFFSET_ASTACK]);
+  keep_string(memory[dt + RETRO_DICT_OFFSET_FSTACK]);
+  keep_string(memory[dt + RETRO_DICT_OFFSET_DESCR]);
+}
+
+int falls_through(CELL end) {
+  CELL c = chunk[end - 1];
+  int n;
+  if (memory[end - 1] != 0 && is_bundle(memory[end - 1]) &&
+      literals(memory[end - 1]) == 0 &&
+      (last_opcode(memory[end - 1]) == NGA_RE || last_opcode(memory[end - 1]) == NGA_JU))
+    return 0;
+  for (n = 1; n <= 3 && end - 1 - n >= c; n++) {
+    if (is_bundle(memory[end - 1 - n]) && literals(memory[end - 1 - n]) == n &&
+        last_opcode(memory[end - 1 - n]) == NGA_JU)
+      return 0;
+  }
+  return 1;
+}
+
+void follow(CELL c) {
+  CELL a, end, n;
+  if (header[c]) {
+    keep(memory[c + RETRO_DICT_OFFSET_XT]);
+    keep_metadata(c);
+    return;
+  }
+  for (end = c + 1; end < Heap && !boundary[end]; end++);
+  for (a = c; a < end; a++) {
+    if (data[c] || !is_bundle(memory[a])) {
+      keep(memory[a]);
+      continue;
+    }
+    for (n = literals(memory[a]); n > 0 && a + 1 < end; n--)
+      keep(memory[++a]);
+  }
+  if (end < Heap && !header[end] && falls_through(end))
+    keep(end);
+}
+
+void trace() {
+  while (waiting > 0)
+    follow(pending[--waiting]);
+}
+
+
+/* Entry words are found by name. A name ending in `*` that is
+   not itself a word keeps each word that starts with the rest
+   of it. */
+
+int name_matches(CELL dt, char *name, size_t length, int prefix) {
+  CELL at = dt + RETRO_DICT_OFFSET_NAME;
+  size_t i;
+  for (i = 0; i < length; i++, at++)
+    if (memory[at] != (unsigned char)name[i])
+      return 0;
+  return prefix || memory[at] == 0;
+}
+
+CELL find_word(char *name) {
+  CELL dt;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt])
+    if (name_matches(dt, name, strlen(name), 0))
+      return dt;
+  printf("Unable to find the word: %s\n", name);
+  exit(1);
+}
+
+int keep_words(char *name, size_t length, int prefix) {
+  CELL dt;
+  int found = 0;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    if (name_matches(dt, name, length, prefix)) {
+      keep(dt);
+      keep(memory[dt + RETRO_DICT_OFFSET_XT]);
+      found = 1;
+    }
+  }
+  return found;
+}
+
+int keep_word(char *name) {
+  size_t length = strlen(name);
+  if (keep_words(name, length, 0))
+    return 1;
+  return length > 0 && name[length - 1] == '*' && keep_words(name, length - 1, 1);
+}
+
+
+/* The headers of the words that are kept are kept as well, so
+   they can still be found by name. */
+
+int keep_headers() {
+  CELL dt;
+  int added = 0;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    if (in_heap(dt) && !live[dt] && in_heap(memory[dt + RETRO_DICT_OFFSET_XT]) &&
+        live[memory[dt + RETRO_DICT_OFFSET_XT]]) {
+      keep(dt);
+      added = 1;
+    }
+  }
+  return added;
+}
+
+
+/* Unlink the headers that were not kept, and clear the cells
+   that were not. */
+
+void sweep(CELL *words, CELL *kept) {
+  CELL dt, *link = &memory[RETRO_IMAGE_DICTIONARY];
+  CELL a, top = Base;
+  for (dt = *link; dt != 0; dt = memory[dt]) {
+    (*words)++;
+    if (!in_heap(dt) || live[dt]) {
+      *link = dt;
+      link = &memory[dt];
+      (*kept)++;
+    }
+  }
+  *link = 0;
+  for (a = Base; a < Heap; a++) {
+    if (live[a])
+      top = a + 1;
+    else
+      memory[a] = 0;
+  }
+  memory[RETRO_IMAGE_HEAP] = top;
+}
+
+
+int main(int argc, char **argv) {
+  CELL a, dt, words = 0, kept = 0, cells = 0;
+  int i;
+  if (argc > 1 && strcmp(argv[1], "-p") == 0) {
+    packed = 1;
+    argc--;
+    argv++;
+  }
+  if (argc < 3) {
+    printf("Usage: retro-minimize [-p] input output [word ...]\n");
+    exit(1);
+  }
+  load_image(argv[1]);
+  Base = memory[RETRO_IMAGE_TIB_END];
+  Heap = memory[RETRO_IMAGE_HEAP];
+  if (Base <= 0 || Base > Heap || Heap > IMAGE_SIZE) {
+    printf("This does not look like a RETRO image: %s\n", argv[1]);
+    exit(1);
+  }
+  if ((pending = malloc(sizeof(CELL) * (Heap - Base + 1))) == NULL) {
+    printf("Out of memory\n");
+    exit(1);
+  }
+
+  find_chunks(memory[find_word("class:data") + RETRO_DICT_OFFSET_XT]);
+
+  /* Everything below the end of the TIB is the kernel. It is
+     always kept, so the addresses in it are where to start,
+     other than the pointers to the dictionary and heap, and the
+     fields of the headers in it. */
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    if (dt >= Base)
+      continue;
+    for (a = dt; a <= string_end(dt + RETRO_DICT_OFFSET_NAME); a++)
+      fields[a] = 1;
+    keep(memory[dt + RETRO_DICT_OFFSET_XT]);
+    keep_metadata(dt);
+  }
+  for (a = 0; a < Base; a++)
+    if (!fields[a] && a != RETRO_IMAGE_DICTIONARY && a != RETRO_IMAGE_HEAP)
+      keep(memory[a]);
+  for (i = 3; i < argc; i++) {
+    if (!keep_word(argv[i])) {
+      printf("Unable to find the word: %s\n", argv[i]);
+      exit(1);
+    }
+  }
+  do {
+    trace();
+  } while (keep_headers());
+
+  for (a = Base; a < Heap; a++)
+    cells += live[a];
+  sweep(&words, &kept);
+  printf("Words: %lld of %lld kept\n", (long long)kept, (long long)words);
+  printf("Heap: %lld of %lld cells kept, now ending at %lld\n",
+         (long long)cells, (long long)(Heap - Base),
+         (long long)memory[RETRO_IMAGE_HEAP]);
+  if (!save_image(argv[2])) {
+    printf("Unable to save the image: %s\n", argv[2]);
+    exit(2);
+  }
+  return 0;
+}
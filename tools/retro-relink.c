@@ -0,0 +1,388 @@
+/* RETRO ------------------------------------------------------
+  A personal, minimalistic forth
+  Copyright (c) 2016 - 2020 Charles Childers
+
+  This is retro-relink, a tool to lay out the words a program
+  uses most often next to each other in an image.
+
+  It reads a profile, with a line for each word: the number of
+  times it was called, then the name. `retro` writes one with
+  `--count-calls` when built with COUNT_CALLS. A line with only
+  a name counts as one call, so a simple trace of the words
+  called can be used instead.
+
+  The words are copied to the end of the heap, the most called
+  first. Each call or jump to one (a `li` followed by `ju`, `ca`,
+  or `cc`), and the execution token in its headers, are changed
+  to point to the copy. The calls and jumps within the copy are
+  moved with it.
+
+  The originals are left in place. Any cell may hold an address,
+  and the image does not record which do, so a word is only
+  moved if every reference to it is one of the above. Other uses
+  of the addresses within a word (e.g., the quotes and strings
+  in it) still find the original. A word is also not moved if it
+  is data, or if it does not end in a `re` or `ju`, as the code
+  may then continue into the next word.
+
+  The image can be raw cells or packed (see the notes in
+  vm/nga-c/image_format.h). It is saved in the same form it
+  was loaded in, or packed if `-p` is given.
+  ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "generated/retro_layout.h"
+
+#ifndef BIT64
+#define CELL int32_t
+#else
+#define CELL int64_t
+#endif
+
+#ifndef IMAGE_SIZE
+#define IMAGE_SIZE   524288       /* Amount of RAM, in cells */
+#endif
+
+#include "../vm/nga-c/image_format.h"
+
+#define NGA_LI 1
+#define NGA_JU 7
+#define NGA_CA 8
+#define NGA_CC 9
+#define NGA_RE 10
+
+CELL memory[IMAGE_SIZE + 1];
+int packed;
+
+CELL Heap;
+
+char boundary[IMAGE_SIZE + 1];  /* Set at each header and xt            */
+char fields[IMAGE_SIZE + 1];    /* Set for each cell in a header        */
+char xt_field[IMAGE_SIZE + 1];  /* Set for the xt field of each header  */
+char target[IMAGE_SIZE + 1];    /* Set for each call or jump target     */
+CELL moved[IMAGE_SIZE + 1];     /* The new address of each word moved   */
+
+struct Word {
+  CELL xt, end;
+  long long calls;
+} *words;
+int count, slots;
+
+
+CELL load_image(char *imageFile) {
+  FILE *fp;
+  CELL imageSize = 0;
+  long fileLen;
+  unsigned char *data;
+  if ((fp = fopen(imageFile, "rb")) == NULL) {
+    printf("Unable to find the image: %s\n", imageFile);
+    exit(1);
+  }
+  fseek(fp, 0, SEEK_END);
+  fileLen = ftell(fp);
+  rewind(fp);
+  data = malloc(fileLen + 1);
+  if (data == NULL || fread(data, 1, fileLen, fp) != (size_t)fileLen) {
+    printf("Unable to read the image: %s\n", imageFile);
+    exit(1);
+  }
+  fclose(fp);
+  if (packed_image(data, fileLen)) {
+    packed = 1;
+    imageSize = unpack_image(data, fileLen, memory, IMAGE_SIZE);
+    if (imageSize < 0) {
+      printf("Unable to unpack the image: %s\n", imageFile);
+      exit(1);
+    }
+  } else {
+    imageSize = fileLen / sizeof(CELL);
+    if (imageSize > IMAGE_SIZE) imageSize = IMAGE_SIZE;
+    memcpy(memory, data, imageSize * sizeof(CELL));
+  }
+  free(data);
+  return imageSize;
+}
+
+int save_image(char *imageFile) {
+  FILE *fp;
+  unsigned char *data;
+  CELL cells = memory[RETRO_IMAGE_HEAP] + 1;
+  size_t bytes;
+  if ((fp = fopen(imageFile, "wb")) == NULL)
+    return 0;
+  if (packed) {
+    data = malloc(packed_image_bound(cells));
+    if (data == NULL) {
+      fclose(fp);
+      return 0;
+    }
+    bytes = pack_image(memory, cells, data);
+    fwrite(data, 1, bytes, fp);
+    free(data);
+  } else {
+    fwrite(&memory, sizeof(CELL), cells, fp);
+  }
+  return fclose(fp) == 0;
+}
+
+
+/* Bundles hold four opcodes, the lowest first. Each `li` takes
+   its value from the cell after the bundle (or after the value
+   of the prior `li`). */
+
+int is_bundle(CELL cell) {
+  int i;
+  for (i = 0; i < 4; i++, cell >>= 8)
+    if ((cell & 0xFF) > 29 || (cell & 0xFF) < 0)
+      return 0;
+  return 1;
+}
+
+int opcode(CELL cell, int slot) {
+  return (cell >> (slot * 8)) & 0xFF;
+}
+
+int last_opcode(CELL cell) {
+  int i, last = 0;
+  for (i = 0; i < 4; i++)
+    if (opcode(cell, i) != 0)
+      last = opcode(cell, i);
+  return last;
+}
+
+int is_control(int op) {
+  return op == NGA_JU || op == NGA_CA || op == NGA_CC;
+}
+
+CELL string_end(CELL at) {
+  while (at < Heap && memory[at] != 0)
+    at++;
+  return at;
+}
+
+
+/* Find the headers, and decode the code to find the values that
+   are used as call or jump targets. The variables at the start
+   of the image, and the text input buffer, are not code. */
+
+void scan() {
+  CELL dt, at, end, value;
+  int slot, literals;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    end = string_end(dt + RETRO_DICT_OFFSET_NAME);
+    for (at = dt; at <= end; at++)
+      fields[at] = 1;
+    xt_field[dt + RETRO_DICT_OFFSET_XT] = 1;
+    boundary[dt] = 1;
+  }
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt]) {
+    value = memory[dt + RETRO_DICT_OFFSET_XT];
+    if (value > 0 && value < Heap)
+      boundary[value] = 1;
+  }
+  boundary[memory[RETRO_IMAGE_TIB]] = 1;
+  boundary[memory[RETRO_IMAGE_TIB_END]] = 1;
+
+  for (at = 0; at < Heap; at++) {
+    if (fields[at] || (at >= RETRO_IMAGE_DICTIONARY && at <= RETRO_IMAGE_DICTREHASH))
+      continue;
+    if (at >= memory[RETRO_IMAGE_TIB] && at < memory[RETRO_IMAGE_TIB_END])
+      continue;
+    if (!is_bundle(memory[at]))
+      continue;
+    for (literals = 0, slot = 0; slot < 4; slot++) {
+      if (opcode(memory[at], slot) != NGA_LI)
+        continue;
+      literals++;
+      if (slot < 3 && is_control(opcode(memory[at], slot + 1)) && at + literals < Heap)
+        target[at + literals] = 1;
+    }
+    at += literals;
+  }
+}
+
+
+/* A word can be moved if it is code, ends in a `re` or `ju`, and
+   every cell that holds its address is a call or jump target, or
+   the xt field of a header. */
+
+CELL word_end(CELL xt) {
+  CELL end = xt + 1;
+  while (end < Heap && !boundary[end])
+    end++;
+  return end;
+}
+
+int terminates(CELL xt, CELL end) {
+  CELL last = memory[end - 1];
+  int n;
+  if (last != 0 && is_bundle(last) && (last_opcode(last) == NGA_RE ||
+      last_opcode(last) == NGA_JU)) {
+    for (n = 0; n < 4; n++)
+      if (opcode(last, n) == NGA_LI)
+        return 0;
+    return 1;
+  }
+  return end - 2 >= xt && target[end - 1] && is_bundle(memory[end - 2]) &&
+         last_opcode(memory[end - 2]) == NGA_JU;
+}
+
+int movable(CELL dt, CELL class_data) {
+  CELL xt = memory[dt + RETRO_DICT_OFFSET_XT];
+  CELL end, at;
+  if (memory[dt + RETRO_DICT_OFFSET_CLASS] == class_data ||
+      xt <= RETRO_IMAGE_DICTREHASH || xt >= Heap || fields[xt] || moved[xt])
+    return 0;
+  end = word_end(xt);
+  if (!terminates(xt, end))
+    return 0;
+  for (at = 0; at < Heap; at++)
+    if (memory[at] == xt && !target[at] && !xt_field[at])
+      return 0;
+  return 1;
+}
+
+
+/* The profile is read into a list of words to move. */
+
+int name_is(CELL dt, char *name) {
+  CELL at = dt + RETRO_DICT_OFFSET_NAME;
+  size_t i;
+  for (i = 0; name[i] != 0; i++, at++)
+    if (memory[at] != (unsigned char)name[i])
+      return 0;
+  return memory[at] == 0;
+}
+
+CELL find_word(char *name) {
+  CELL dt;
+  for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt])
+    if (name_is(dt, name))
+      return dt;
+  return 0;
+}
+
+void add_calls(CELL xt, long long calls) {
+  int i;
+  for (i = 0; i < count; i++) {
+    if (words[i].xt == xt) {
+      words[i].calls += calls;
+      return;
+    }
+  }
+  if (count == slots) {
+    slots = slots ? slots * 2 : 256;
+    if ((words = realloc(words, slots * sizeof(struct Word))) == NULL) {
+      printf("Out of memory\n");
+      exit(1);
+    }
+  }
+  words[count].xt = xt;
+  words[count].end = word_end(xt);
+  words[count].calls = calls;
+  count++;
+}
+
+void read_profile(char *filename, CELL class_data) {
+  FILE *fp;
+  char line[1024], name[1024];
+  long long calls;
+  CELL dt;
+  if ((fp = fopen(filename, "r")) == NULL) {
+    printf("Unable to read the profile: %s\n", filename);
+    exit(1);
+  }
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (sscanf(line, "%lld %1023s", &calls, name) != 2) {
+      if (sscanf(line, "%1023s", name) != 1)
+        continue;
+      calls = 1;
+    }
+    for (dt = memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = memory[dt])
+      if (name_is(dt, name) && movable(dt, class_data))
+        add_calls(memory[dt + RETRO_DICT_OFFSET_XT], calls);
+  }
+  fclose(fp);
+}
+
+int by_calls(const void *a, const void *b) {
+  const struct Word *x = a, *y = b;
+  if (x->calls != y->calls)
+    return x->calls < y->calls ? 1 : -1;
+  return x->xt < y->xt ? -1 : x->xt > y->xt;
+}
+
+
+/* Copy the words, then point the calls, jumps, and headers that
+   refer to them at the copies. */
+
+void relink() {
+  CELL at, from, to, size, top = Heap;
+  int i;
+  for (i = 0; i < count; i++) {
+    moved[words[i].xt] = top;
+    top += words[i].end - words[i].xt;
+  }
+  if (top >= IMAGE_SIZE) {
+    printf("The words do not fit in the image\n");
+    exit(1);
+  }
+  for (at = 0; at < Heap; at++)
+    if ((target[at] || xt_field[at]) && memory[at] > 0 && memory[at] < Heap &&
+        moved[memory[at]])
+      memory[at] = moved[memory[at]];
+  for (i = 0; i < count; i++) {
+    from = words[i].xt;
+    to = moved[from];
+    size = words[i].end - from;
+    memcpy(&memory[to], &memory[from], size * sizeof(CELL));
+    for (at = 0; at < size; at++)
+      if (target[from + at] && memory[to + at] >= from && memory[to + at] < from + size)
+        memory[to + at] += to - from;
+  }
+  memory[RETRO_IMAGE_HEAP] = top;
+}
+
+
+int main(int argc, char **argv) {
+  CELL dt, cells = 0;
+  int i;
+  if (argc > 1 && strcmp(argv[1], "-p") == 0) {
+    packed = 1;
+    argc--;
+    argv++;
+  }
+  if (argc < 4) {
+    printf("Usage: retro-relink [-p] input output profile\n");
+    exit(1);
+  }
+  load_image(argv[1]);
+  Heap = memory[RETRO_IMAGE_HEAP];
+  if (Heap <= memory[RETRO_IMAGE_TIB_END] || Heap > IMAGE_SIZE ||
+      memory[RETRO_IMAGE_TIB] <= RETRO_IMAGE_DICTREHASH) {
+    printf("This does not look like a RETRO image: %s\n", argv[1]);
+    exit(1);
+  }
+  scan();
+  if ((dt = find_word("class:data")) == 0) {
+    printf("Unable to find class:data in the image\n");
+    exit(1);
+  }
+  read_profile(argv[3], memory[dt + RETRO_DICT_OFFSET_XT]);
+  qsort(words, count, sizeof(struct Word), by_calls);
+  relink();
+
+  for (i = 0; i < count; i++)
+    cells += words[i].end - words[i].xt;
+  printf("Moved %d words (%lld cells) to %lld\n", count, (long long)cells,
+         (long long)Heap);
+  if (!save_image(argv[2])) {
+    printf("Unable to save the image: %s\n", argv[2]);
+    exit(2);
+  }
+  return 0;
+}
@@ -0,0 +1,243 @@
+/* RETRO ------------------------------------------------------
+  A personal, minimalistic forth
+  Copyright (c) 2017 - 2020 Charles Childers
+
+  This is retro-tokenize, a tool to compile a RETRO-flavored
+  Markdown source file into a tokenized one. For foo.retro,
+  this writes foo.retro.rtok, which `include` will use in
+  place of the source until the source is changed.
+
+  The format is described in vm/nga-c/token_format.h.
+
+  Code blocks start and end with ~~~ and test blocks start
+  with ```, though this does support setting them from the
+  command line. These must match those used by `retro` when
+  the file is included.
+  ---------------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define CELL int64_t
+
+#include "../vm/nga-c/image_format.h"
+#include "../vm/nga-c/token_format.h"
+
+char code_start[33], code_end[33], test_start[33];
+
+unsigned char *output;
+size_t used, slots;
+
+
+void emit(const void *data, size_t bytes) {
+  while (used + bytes > slots) {
+    slots = slots ? slots * 2 : 64 * 1024;
+    if ((output = realloc(output, slots)) == NULL) {
+      printf("Out of memory\n");
+      exit(1);
+    }
+  }
+  memcpy(output + used, data, bytes);
+  used += bytes;
+}
+
+void emit_number(uint64_t value) {
+  unsigned char buffer[10];
+  emit(buffer, packed_put(buffer, value));
+}
+
+void emit_text(const char *text, size_t length) {
+  emit_number(length);
+  emit(text, length);
+}
+
+void write_fence(FILE *fp, const char *fence) {
+  unsigned char buffer[10];
+  fwrite(buffer, 1, packed_put(buffer, strlen(fence)), fp);
+  fwrite(fence, 1, strlen(fence), fp);
+}
+
+
+/* `retro` decodes and re-encodes the UTF-8 in each line, and
+   stops a line at an invalid character. Only accept sources
+   where this leaves the text as it was. */
+
+int valid_utf8(const unsigned char *text, size_t length) {
+  size_t i = 0, n, k;
+  uint32_t c;
+  while (i < length) {
+    if (text[i] < 0x80) { i++; continue; }
+    if ((text[i] & 0xE0) == 0xC0)      { n = 2; c = text[i] & 0x1F; }
+    else if ((text[i] & 0xF0) == 0xE0) { n = 3; c = text[i] & 0x0F; }
+    else if ((text[i] & 0xF8) == 0xF0) { n = 4; c = text[i] & 0x07; }
+    else return 0;
+    if (i + n > length) return 0;
+    for (k = 1; k < n; k++) {
+      if ((text[i + k] & 0xC0) != 0x80) return 0;
+      c = (c << 6) | (text[i + k] & 0x3F);
+    }
+    if ((n == 2 && c < 0x80) || (n == 3 && c < 0x800) ||
+        (n == 4 && (c < 0x10000 || c >= 0x110000)))
+      return 0;
+    i += n;
+  }
+  return 1;
+}
+
+
+/* `retro` compares the first 31 characters of a token with
+   the fences. */
+
+int is_fence(const char *token, size_t length, const char *fence) {
+  if (length > 31) length = 31;
+  return strlen(fence) == length && memcmp(token, fence, length) == 0;
+}
+
+
+/* Lines end at a LF, CR, or NUL, and tokens are separated by
+   spaces or tabs, as in `include`. Only the lines with code to
+   run are kept. */
+
+size_t offsets[TOKENIZED_LINE / 2], lengths[TOKENIZED_LINE / 2];
+
+size_t split(const unsigned char *line, size_t length) {
+  size_t at = 0, tokens = 0;
+  while (1) {
+    while (at < length && (line[at] == ' ' || line[at] == '\t')) at++;
+    if (at == length) return tokens;
+    offsets[tokens] = at;
+    while (at < length && line[at] != ' ' && line[at] != '\t') at++;
+    lengths[tokens] = at - offsets[tokens];
+    tokens++;
+  }
+}
+
+int tokenize(char *fname) {
+  struct stat info;
+  unsigned char *source, *line, header[64];
+  char name[4096];
+  const char *token;
+  size_t at, end, length, tokens, first, i, prior, size;
+  uint64_t number = 0, blocks = 0;
+  int inBlock = 0;
+  FILE *fp;
+
+  if ((fp = fopen(fname, "rb")) == NULL || fstat(fileno(fp), &info) != 0) {
+    printf("Unable to load file: %s\n", fname);
+    return 0;
+  }
+  if ((source = malloc(info.st_size + 1)) == NULL ||
+      fread(source, 1, info.st_size, fp) != (size_t)info.st_size) {
+    printf("Unable to read file: %s\n", fname);
+    return 0;
+  }
+  fclose(fp);
+
+  used = 0;
+  for (at = 0; at < (size_t)info.st_size; at = end + 1) {
+    for (end = at; end < (size_t)info.st_size && source[end] != 10 &&
+                   source[end] != 13 && source[end] != 0; end++);
+    number++;
+    line = source + at;
+    length = end - at;
+    if (length >= TOKENIZED_LINE - 1 || !valid_utf8(line, length)) {
+      printf("%s:%llu: line is too long or is not valid UTF-8\n",
+             fname, (unsigned long long)number);
+      return 0;
+    }
+
+    /* Track the blocks as `include` does. The tokens to keep are
+       those after the last fence, if the line ends in a block. */
+    tokens = split(line, length);
+    for (first = i = 0; i < tokens; i++) {
+      token = (const char *)line + offsets[i];
+      if (is_fence(token, lengths[i], test_start) && blocks == 0) blocks++;
+      if (is_fence(token, lengths[i], code_start) ||
+          is_fence(token, lengths[i], code_end)) {
+        if (inBlock && i != first) {
+          printf("%s:%llu: a fence follows code on the same line\n",
+                 fname, (unsigned long long)number);
+          return 0;
+        }
+        if (!inBlock) blocks++;
+        inBlock = !inBlock;
+        first = i + 1;
+      } else if (!inBlock) {
+        first = i + 1;
+      }
+    }
+
+    if (first < tokens) {
+      emit_number(number);
+      emit_text((const char *)line, length);
+      emit_number(tokens - first);
+      for (prior = 0, i = first; i < tokens; i++) {
+        emit_number(offsets[i] - prior);
+        emit_number(lengths[i]);
+        prior = offsets[i] + lengths[i];
+      }
+    }
+  }
+  free(source);
+
+  memcpy(header, TOKENIZED_MAGIC, 4);
+  header[4] = TOKENIZED_VERSION;
+  size = 5;
+  size += packed_put(header + size, info.st_size);
+  size += packed_put(header + size, info.st_mtime);
+  size += packed_put(header + size, blocks);
+
+  snprintf(name, sizeof(name), "%s%s", fname, TOKENIZED_SUFFIX);
+  if ((fp = fopen(name, "wb")) == NULL) {
+    printf("Unable to write file: %s\n", name);
+    return 0;
+  }
+  fwrite(header, 1, size, fp);
+  write_fence(fp, code_start);
+  write_fence(fp, code_end);
+  write_fence(fp, test_start);
+  if (fwrite(output, 1, used, fp) != used) {
+    printf("Unable to write file: %s\n", name);
+    fclose(fp);
+    return 0;
+  }
+  fclose(fp);
+  return 1;
+}
+
+
+/* Just a readabilty aid for the command line processing */
+int arg_is(char *arg, char *value) {
+  return (strcmp(arg, value) == 0);
+}
+
+
+int main(int argc, char **argv) {
+  int i = 1, status = 0;
+  strcpy(code_start, "~~~");
+  strcpy(code_end,   "~~~");
+  strcpy(test_start, "```");
+  if (argc < 2) {
+    printf("err: no file specified\n");
+    return 1;
+  }
+  while (i < argc) {
+    if ((arg_is(argv[i], "--code-start") || arg_is(argv[i], "-cs")) && i + 1 < argc) {
+      i++;
+      strncpy(code_start, argv[i], 32);
+    } else if ((arg_is(argv[i], "--code-end") || arg_is(argv[i], "-ce")) && i + 1 < argc) {
+      i++;
+      strncpy(code_end, argv[i], 32);
+    } else if ((arg_is(argv[i], "--test-start") || arg_is(argv[i], "-ts")) && i + 1 < argc) {
+      i++;
+      strncpy(test_start, argv[i], 32);
+    } else if (!tokenize(argv[i])) {
+      status = 1;
+    }
+    i++;
+  }
+  return status;
+}
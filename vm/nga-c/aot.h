@@ -0,0 +1,84 @@
+/**************************************************************
+  Declarations for the C that retro-aot generates from an image.
+
+  Each bundle is run with the instruction handlers from nga_core.c.
+  The common ones have a fast path here, taken only when the checks
+  in `guard()` would pass, which then does the same as the handler.
+**************************************************************/
+
+#ifndef RETRO_AOT_H
+#define RETRO_AOT_H
+
+#include "retro.h"
+
+V i_li(NgaState *); V i_du(NgaState *); V i_dr(NgaState *);
+V i_sw(NgaState *); V i_pu(NgaState *); V i_po(NgaState *);
+V i_ju(NgaState *); V i_ca(NgaState *); V i_cc(NgaState *);
+V i_re(NgaState *); V i_eq(NgaState *); V i_ne(NgaState *);
+V i_lt(NgaState *); V i_gt(NgaState *); V i_fe(NgaState *);
+V i_st(NgaState *); V i_ad(NgaState *); V i_su(NgaState *);
+V i_mu(NgaState *); V i_di(NgaState *); V i_an(NgaState *);
+V i_or(NgaState *); V i_xo(NgaState *); V i_sh(NgaState *);
+V i_zr(NgaState *); V i_ha(NgaState *); V i_ie(NgaState *);
+V i_iq(NgaState *); V i_ii(NgaState *);
+
+/* True if `guard(vm, n, m, diff)` would pass, with either form of
+   `guard()`. */
+#define AOT_GUARD(c, n, m, diff) \
+  ((c)->sp >= (n) && (c)->sp + (m) - (n) <= DATA_DEPTH - 1 && \
+   (c)->rp + (diff) >= 0 && (c)->rp + (diff) <= ADDRESS_DEPTH - 1 && \
+   (c)->rp >= 0 && (c)->rp <= ADDRESS_DEPTH - 1)
+
+#define AOT_LI(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 0, 1, 0) && c->ip + 1 < MEMORY_SIZE) { \
+    c->sp++; c->ip++; c->data[c->sp] = (vm)->memory[c->ip]; \
+  } else i_li(vm); } while (0)
+
+#define AOT_DU(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 1, 2, 0)) { \
+    c->sp++; c->data[c->sp] = c->data[c->sp - 1]; \
+  } else i_du(vm); } while (0)
+
+#define AOT_DR(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 1, 0, 0)) { \
+    c->data[c->sp] = 0; c->sp--; \
+  } else i_dr(vm); } while (0)
+
+#define AOT_SW(vm) do { struct NgaCore *c = &ACTIVE; CELL a; \
+  if (AOT_GUARD(c, 2, 2, 0)) { \
+    a = c->data[c->sp]; c->data[c->sp] = c->data[c->sp - 1]; \
+    c->data[c->sp - 1] = a; \
+  } else i_sw(vm); } while (0)
+
+#define AOT_PU(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 1, 0, 1)) { \
+    c->rp++; c->address[c->rp] = c->data[c->sp]; \
+    c->data[c->sp] = 0; c->sp--; \
+  } else i_pu(vm); } while (0)
+
+#define AOT_PO(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 0, 1, -1)) { \
+    c->sp++; c->data[c->sp] = c->address[c->rp]; c->rp--; \
+  } else i_po(vm); } while (0)
+
+/* Calls and jumps count their targets with COUNT_CALLS, so they
+   always use the handlers then. */
+#ifndef COUNT_CALLS
+#define AOT_JU(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 1, 0, 0) && c->data[c->sp] >= 0 && \
+      c->data[c->sp] < MEMORY_SIZE) { \
+    c->ip = c->data[c->sp] - 1; c->data[c->sp] = 0; c->sp--; \
+  } else i_ju(vm); } while (0)
+
+#define AOT_CA(vm) do { struct NgaCore *c = &ACTIVE; \
+  if (AOT_GUARD(c, 1, 0, 1) && c->data[c->sp] >= 0 && \
+      c->data[c->sp] < MEMORY_SIZE) { \
+    c->rp++; c->address[c->rp] = c->ip; \
+    c->ip = c->data[c->sp] - 1; c->data[c->sp] = 0; c->sp--; \
+  } else i_ca(vm); } while (0)
+#else
+#define AOT_JU(vm) i_ju(vm)
+#define AOT_CA(vm) i_ca(vm)
+#endif
+
+#endif
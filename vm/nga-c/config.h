@@ -27,15 +27,48 @@
 #define ENABLE_SIGNALS
 /* #define ENABLE_FFI */
 #define ENABLE_IOCTL
+/* #define ENABLE_EVENTS */
 #endif
 #endif
 
+#if defined(ENABLE_THREADS) && !defined(ENABLE_MULTICORE)
+#define ENABLE_MULTICORE
+#endif
+
 #ifdef ENABLE_MULTICORE
+#ifndef CORES
 #define CORES 8
+#endif
+#ifndef TIME_SLICE
+#define TIME_SLICE 64             /* Bundles run before switching */
+#endif
+#ifndef MAILBOX_SIZE
+#define MAILBOX_SIZE 64           /* Capacity of a core's mailbox */
+#endif
+#ifndef MAX_CHANNEL_SIZE
+#define MAX_CHANNEL_SIZE (1 << 30) /* Largest channel capacity    */
+#endif
+#ifndef WORK_DEQUE_SIZE
+#define WORK_DEQUE_SIZE 256       /* Chunks queued per core       */
+#endif
 #else
+#undef CORES
 #define CORES 1
 #endif
 
+#if defined(ENABLE_MULTICORE) && !defined(_WIN32)
+#define ENABLE_POLLER             /* Park cores waiting on I/O    */
+#endif
+
+#ifdef ENABLE_EVENTS
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 256      /* Pending events (power of 2)  */
+#endif
+#ifndef EVENT_PAYLOAD_SIZE
+#define EVENT_PAYLOAD_SIZE 32     /* Largest payload, in cells    */
+#endif
+#endif
+
 #if defined(_WIN32) || defined(_WIN64)
 #define NEEDS_STRL
 #endif
@@ -55,6 +88,7 @@
 #define CELL_MAX LLONG_MAX - 1
 #endif
 
+/* Defaults; these can be changed when starting a VM */
 #ifndef IMAGE_SIZE
 #define IMAGE_SIZE   524288       /* Amount of RAM, in cells */
 #endif
@@ -67,6 +101,10 @@
 #define STACK_DEPTH  256          /* Depth of data stack */
 #endif
 
+#ifndef DIRTY_PAGE_SHIFT
+#define DIRTY_PAGE_SHIFT 10       /* Dirty pages are 2^n cells */
+#endif
+
 #ifdef BRANCH_PREDICTION
 /* The Compiler Magic Trick */
 #define unlikely(x) __builtin_expect((x),0)
@@ -16,9 +16,9 @@
 #define BLOCK_CELLS 1024
 #define BLOCK_BYTES (BLOCK_CELLS * (int)sizeof(int32_t))
 
-int blocks_validate(CELL block, CELL buffer) {
+int blocks_validate(NgaState *vm, CELL block, CELL buffer) {
   uintmax_t block_number;
-  if (buffer < 0 || buffer > IMAGE_SIZE - BLOCK_CELLS) {
+  if (buffer < 0 || buffer > MEMORY_SIZE - BLOCK_CELLS) {
     fprintf(stderr, "ERROR (nga/blocks): Invalid memory range\n");
     return 0;
   }
@@ -82,9 +82,9 @@ V read_block(NgaState *vm) {
   CELL buffer = stack_pop(vm);
   CELL block = stack_pop(vm);
   int32_t m[BLOCK_CELLS];
-  if (!blocks_validate(block, buffer)) return;
+  if (!blocks_validate(vm, block, buffer)) return;
 
-  int fp = open(vm->BlockFile, O_RDONLY);
+  int fp = open(vm->text->BlockFile, O_RDONLY);
   if (fp == -1) {
     perror("ERROR (nga/blocks): Unable to open block file");
     return;
@@ -93,6 +93,7 @@ V read_block(NgaState *vm) {
     for (int i = 0; i < BLOCK_CELLS; i++) {
       vm->memory[buffer + i] = (CELL)m[i];
     }
+    mark_dirty(vm, buffer, BLOCK_CELLS);
   }
   if (close(fp) == -1) {
     perror("ERROR (nga/blocks): Unable to close block file");
@@ -103,12 +104,12 @@ V write_block(NgaState *vm) {
   CELL buffer = stack_pop(vm);
   CELL block = stack_pop(vm);
   int32_t m[BLOCK_CELLS];
-  if (!blocks_validate(block, buffer)) return;
+  if (!blocks_validate(vm, block, buffer)) return;
 
   for (int i = 0; i < BLOCK_CELLS; i++) {
     m[i] = (int32_t)vm->memory[buffer + i];
   }
-  int fp = open(vm->BlockFile, O_WRONLY);
+  int fp = open(vm->text->BlockFile, O_WRONLY);
   if (fp == -1) {
     perror("ERROR (nga/blocks): Unable to open block file");
     return;
@@ -123,7 +124,7 @@ V write_block(NgaState *vm) {
 
 V set_block_file(NgaState *vm) {
   CELL buffer = stack_pop(vm);
-  strlcpy(vm->BlockFile, string_extract(vm, buffer), 1024);
+  strlcpy(vm->text->BlockFile, string_extract(vm, buffer), 1024);
 }
 
 V io_blocks(NgaState *vm) {
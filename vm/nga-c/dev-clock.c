@@ -14,58 +14,56 @@
 #include "retro.h"
 
 #ifdef ENABLE_CLOCK
-time_t current_time;
-
 V clock_time(NgaState *vm) {
   stack_push(vm, (CELL)time(NULL));
 }
 
 V clock_day(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_mday);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_mday);
 }
 
 V clock_month(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_mon + 1);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_mon + 1);
 }
 
 V clock_year(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_year + 1900);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_year + 1900);
 }
 
 V clock_hour(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_hour);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_hour);
 }
 
 V clock_minute(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_min);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_min);
 }
 
 V clock_second(NgaState *vm) {
-  stack_push(vm, (CELL)localtime(&current_time)->tm_sec);
+  stack_push(vm, (CELL)localtime(&vm->current_time)->tm_sec);
 }
 
 V clock_day_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_mday);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_mday);
 }
 
 V clock_month_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_mon + 1);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_mon + 1);
 }
 
 V clock_year_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_year + 1900);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_year + 1900);
 }
 
 V clock_hour_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_hour);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_hour);
 }
 
 V clock_minute_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_min);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_min);
 }
 
 V clock_second_utc(NgaState *vm) {
-  stack_push(vm, (CELL)gmtime(&current_time)->tm_sec);
+  stack_push(vm, (CELL)gmtime(&vm->current_time)->tm_sec);
 }
 
 Handler ClockActions[] = {
@@ -82,15 +80,15 @@ V query_clock(NgaState *vm) {
 }
 
 V invalid_clock_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/clock): Invalid clock action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/clock): Invalid clock action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
 V io_clock(NgaState *vm) {
   CELL action = stack_pop(vm);
   CELL actions = sizeof(ClockActions) / sizeof(ClockActions[0]);
-  current_time = time(NULL);
+  vm->current_time = time(NULL);
   if (action >= 0 && action < actions) {
     ClockActions[action](vm);
   } else {
@@ -27,23 +27,23 @@
 V execute(NgaState *vm, CELL cell);
 
 V handle_error(NgaState *vm, CELL error) {
-  CELL saved_ip = vm->cpu[vm->active].ip;
+  CELL saved_ip = ACTIVE.ip;
   if (vm->ErrorHandlers[error] != 0) {
-    printf("\nHandling %lld\n", (long long)error);
+    vm_printf(vm, "\nHandling %lld\n", (long long)error);
     execute(vm, vm->ErrorHandlers[error]);
   }
-  vm->cpu[vm->active].ip = saved_ip;
+  ACTIVE.ip = saved_ip;
 }
 
 V register_error_handler(NgaState *vm) {
   CELL ErrorID = stack_pop(vm);
   CELL ErrorHandler = stack_pop(vm);
   if (ErrorID < 0 || ErrorID >= (CELL)(sizeof(vm->ErrorHandlers) / sizeof(vm->ErrorHandlers[0]))) {
-    printf("\nERROR (nga/error): Invalid error handler id %lld\n", (long long)ErrorID);
+    vm_printf(vm, "\nERROR (nga/error): Invalid error handler id %lld\n", (long long)ErrorID);
     return;
   }
   vm->ErrorHandlers[ErrorID] = ErrorHandler;
-  printf("Assigned %lld to %lld\n", (long long)ErrorID, (long long)ErrorHandler);
+  vm_printf(vm, "Assigned %lld to %lld\n", (long long)ErrorID, (long long)ErrorHandler);
 }
 
 V io_error(NgaState *vm) {
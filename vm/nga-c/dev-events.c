@@ -0,0 +1,256 @@
+/**************************************************************
+                _              __            _   _
+       _ __ ___| |_ _ __ ___  / _| ___  _ __| |_| |__
+      | '__/ _ \ __| '__/ _ \| |_ / _ \| '__| __| '_ \
+      | | |  __/ |_| | | (_) |  _| (_) | |  | |_| | | |
+      |_|  \___|\__|_|  \___/|_|  \___/|_|   \__|_| |_|
+                                                for nga
+
+      (c) Charles Childers, Luke Parrish, Marc Simpsonn,
+          Jay Skeer, Kenneth Keating
+
+**************************************************************/
+
+#include "retro.h"
+
+#ifdef ENABLE_EVENTS
+
+/*---------------------------------------------------------------------
+  Inbound Events
+
+  This lets other threads in the host hand work to a running VM. An
+  event is a type and a payload of up to EVENT_PAYLOAD_SIZE cells.
+
+  Events are kept in a bounded ring with a sequence number per slot
+  (as with channels, this is Dmitry Vyukov's design). Any number of
+  host threads can post, claiming slots with a compare & swap, so
+  posting never takes a lock. There is a single consumer: the VM,
+  whose device calls are serialized.
+
+  Retro code can poll for events, wait for one with a timeout, or set
+  a handler. The handler is called by `execute()` between bundles
+  (on core 0) after an event is posted, and should take events with
+  `event:poll` until none remain. It is not reentered while running,
+  but can interrupt any word, much like an interrupt handler.
+
+  Waiting:
+
+  - A waiting VM sleeps on `event_wake`. Posters only take the lock to
+    signal it if something is waiting.
+  - With threads, the device lock is released while waiting, so other
+    cores keep running.
+  - Without threads, a core that waits while other cores are ready (or
+    parked) does not sleep. It retries the `ii` on its next turn, until
+    an event arrives or the time runs out.
+  ---------------------------------------------------------------------*/
+
+#define EVENT_MASK (EVENT_QUEUE_SIZE - 1)
+
+V initialize_events(NgaState *vm) {
+  size_t i;
+  for (i = 0; i < EVENT_QUEUE_SIZE; i++)
+    vm->events[i].sequence = i;
+  vm->event_head = vm->event_tail = 0;
+  vm->event_signal = vm->event_waiters = 0;
+  vm->event_handler = vm->event_handler_rp = 0;
+  pthread_mutex_init(&vm->event_lock, NULL);
+  pthread_cond_init(&vm->event_wake, NULL);
+}
+
+static long long event_clock(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+V events_error(NgaState *vm, const char *message) {
+  vm_printf(vm, "\nERROR (nga/events): %s\n", message);
+  ACTIVE.ip = MEMORY_SIZE;
+  ACTIVE.rp = 0;
+}
+
+/* Called from any thread. Returns 0 if the queue is full or the
+   payload is too large. */
+int post_event(NgaState *vm, CELL type, CELL length, const CELL *payload) {
+  struct NgaEvent *e;
+  size_t pos, seq;
+  intptr_t diff;
+  if (length < 0 || length > EVENT_PAYLOAD_SIZE) return 0;
+  pos = __atomic_load_n(&vm->event_tail, __ATOMIC_RELAXED);
+  for (;;) {
+    e = &vm->events[pos & EVENT_MASK];
+    seq = __atomic_load_n(&e->sequence, __ATOMIC_ACQUIRE);
+    diff = (intptr_t)seq - (intptr_t)pos;
+    if (diff == 0) {
+      if (__atomic_compare_exchange_n(&vm->event_tail, &pos, pos + 1, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    } else if (diff < 0) {
+      return 0;
+    } else {
+      pos = __atomic_load_n(&vm->event_tail, __ATOMIC_RELAXED);
+    }
+  }
+  e->type = type;
+  e->length = length;
+  if (length > 0)
+    memcpy(e->payload, payload, length * sizeof(CELL));
+  __atomic_store_n(&e->sequence, pos + 1, __ATOMIC_RELEASE);
+  __atomic_store_n(&vm->event_signal, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&vm->event_waiters, __ATOMIC_SEQ_CST)) {
+    pthread_mutex_lock(&vm->event_lock);
+    pthread_cond_broadcast(&vm->event_wake);
+    pthread_mutex_unlock(&vm->event_lock);
+  }
+  return 1;
+}
+
+static int event_ready(NgaState *vm) {
+  size_t head = __atomic_load_n(&vm->event_head, __ATOMIC_RELAXED);
+  struct NgaEvent *e = &vm->events[head & EVENT_MASK];
+  return __atomic_load_n(&e->sequence, __ATOMIC_ACQUIRE) == head + 1;
+}
+
+/* Copy the oldest event to an array at `buffer` and push its type
+   and TRUE, or push 0 and FALSE if there are none. */
+static V event_take(NgaState *vm, CELL buffer) {
+  size_t head = vm->event_head;
+  struct NgaEvent *e = &vm->events[head & EVENT_MASK];
+  CELL i;
+  if (!event_ready(vm)) {
+    stack_push(vm, 0);
+    stack_push(vm, 0);
+    return;
+  }
+  if (buffer < 0 || buffer + e->length >= MEMORY_SIZE) {
+    events_error(vm, "Invalid buffer");
+    return;
+  }
+  vm->memory[buffer] = e->length;
+  for (i = 0; i < e->length; i++)
+    vm->memory[buffer + 1 + i] = e->payload[i];
+  mark_dirty(vm, buffer, e->length + 1);
+  stack_push(vm, e->type);
+  stack_push(vm, -1);
+  __atomic_store_n(&e->sequence, head + EVENT_QUEUE_SIZE, __ATOMIC_RELEASE);
+  __atomic_store_n(&vm->event_head, head + 1, __ATOMIC_RELAXED);
+}
+
+/* Discard any queued events. */
+V drain_events(NgaState *vm) {
+  size_t head;
+  while (event_ready(vm)) {
+    head = vm->event_head;
+    __atomic_store_n(&vm->events[head & EVENT_MASK].sequence,
+                     head + EVENT_QUEUE_SIZE, __ATOMIC_RELEASE);
+    __atomic_store_n(&vm->event_head, head + 1, __ATOMIC_RELAXED);
+  }
+  __atomic_store_n(&vm->event_signal, 0, __ATOMIC_RELAXED);
+}
+
+static V block_for_event(NgaState *vm, long long deadline) {
+  struct timespec ts;
+  long long now, remaining;
+#ifdef ENABLE_THREADS
+  int held = device_lock_release(vm);
+#endif
+  __atomic_add_fetch(&vm->event_waiters, 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_lock(&vm->event_lock);
+  while (!event_ready(vm) && (now = event_clock()) < deadline) {
+    if (deadline == LLONG_MAX) {
+      pthread_cond_wait(&vm->event_wake, &vm->event_lock);
+    } else {
+      remaining = deadline - now;
+      clock_gettime(CLOCK_REALTIME, &ts);
+      ts.tv_sec += remaining / 1000;
+      ts.tv_nsec += (remaining % 1000) * 1000000;
+      if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+      }
+      pthread_cond_timedwait(&vm->event_wake, &vm->event_lock, &ts);
+    }
+  }
+  pthread_mutex_unlock(&vm->event_lock);
+  __atomic_sub_fetch(&vm->event_waiters, 1, __ATOMIC_SEQ_CST);
+#ifdef ENABLE_THREADS
+  device_lock_restore(vm, held);
+#endif
+}
+
+V event_wait(NgaState *vm) {
+  CELL ms = stack_pop(vm);
+  CELL buffer = stack_pop(vm);
+  long long now;
+  if (!event_ready(vm) && ms != 0) {
+    now = event_clock();
+    if (ACTIVE.event_deadline == 0)
+      ACTIVE.event_deadline = ms < 0 ? LLONG_MAX : now + ms;
+#if defined(ENABLE_MULTICORE) && !defined(ENABLE_THREADS)
+    if ((vm->queued > 1 || vm->parked) && vm->memory[ACTIVE.ip] == 29) {
+      if (now < ACTIVE.event_deadline) {
+        /* With only parked cores left, nap briefly between polls */
+        if (vm->queued <= 1)
+          block_for_event(vm, now + 10 < ACTIVE.event_deadline ? now + 10 : ACTIVE.event_deadline);
+        if (!event_ready(vm)) {
+          ACTIVE.sp = ACTIVE.io_sp;
+          ACTIVE.ip--;
+          vm->ticks = 0;
+          return;
+        }
+      }
+    } else
+#endif
+    block_for_event(vm, ACTIVE.event_deadline);
+  }
+  ACTIVE.event_deadline = 0;
+  event_take(vm, buffer);
+}
+
+V event_post(NgaState *vm) {
+  CELL buffer = stack_pop(vm);
+  CELL type = stack_pop(vm);
+  CELL length;
+  if (buffer < 0 || buffer >= MEMORY_SIZE) {
+    events_error(vm, "Invalid buffer");
+    return;
+  }
+  length = vm->memory[buffer];
+  if (length < 0 || buffer + length >= MEMORY_SIZE) {
+    events_error(vm, "Invalid buffer");
+    return;
+  }
+  stack_push(vm, post_event(vm, type, length, &vm->memory[buffer + 1]) ? -1 : 0);
+}
+
+/* Run the handler by making a call to it from the current bundle. */
+V dispatch_events(NgaState *vm) {
+  if (!__atomic_exchange_n(&vm->event_signal, 0, __ATOMIC_ACQ_REL))
+    return;
+  if (!event_ready(vm))
+    return;
+  ACTIVE.rp++;
+  TORS = ACTIVE.ip - 1;
+  ACTIVE.ip = vm->event_handler;
+  vm->event_handler_rp = ACTIVE.rp;
+}
+
+V io_events(NgaState *vm) {
+  switch (stack_pop(vm)) {
+    case 0: stack_push(vm, event_ready(vm) ? -1 : 0); break;
+    case 1: event_take(vm, stack_pop(vm)); break;
+    case 2: event_wait(vm); break;
+    case 3: event_post(vm); break;
+    case 4: vm->event_handler = stack_pop(vm);
+            vm->event_handler_rp = 0;
+            break;
+    case 5: stack_push(vm, EVENT_PAYLOAD_SIZE); break;
+    default: events_error(vm, "Invalid event action"); break;
+  }
+}
+
+V query_events(NgaState *vm) {
+  stack_push(vm, 0);
+  stack_push(vm, DEVICE_EVENTS);
+}
+#endif
@@ -17,30 +17,20 @@
 #ifdef ENABLE_FFI
 #include <dlfcn.h>
 
-typedef void (*External)(void *);
-
-#define MAX_FFI_LIBRARIES 32
-#define MAX_FFI_FUNCTIONS 32000
-
-V *handles[MAX_FFI_LIBRARIES];
-External funcs[MAX_FFI_FUNCTIONS];
-int nlibs, nffi;
-
 V initialize_ffi(NgaState *vm) {
-  (void)vm;
-  nlibs = 0;
-  nffi = 0;
+  vm->ffi_libraries = 0;
+  vm->ffi_mapped = 0;
 }
 
 V ffi_error(NgaState *vm, const char *message) {
-  printf("\nERROR (nga/ffi): %s\n", message);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/ffi): %s\n", message);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
 V open_library(NgaState *vm) {
   V *handle;
-  if (nlibs >= MAX_FFI_LIBRARIES) {
+  if (vm->ffi_libraries >= MAX_FFI_LIBRARIES) {
     ffi_error(vm, "Too many open libraries");
     return;
   }
@@ -49,39 +39,55 @@ V open_library(NgaState *vm) {
     stack_push(vm, -1);
     return;
   }
-  handles[nlibs] = handle;
-  stack_push(vm, nlibs);
-  nlibs++;
+  vm->ffi_handles[vm->ffi_libraries] = handle;
+  stack_push(vm, vm->ffi_libraries);
+  vm->ffi_libraries++;
+}
+
+/* The table of mapped functions grows as symbols are mapped. Returns
+   0 if there is not room for `count` functions. */
+int ffi_reserve(NgaState *vm, int count) {
+  void (**functions)(void *);
+  int slots = vm->ffi_slots ? vm->ffi_slots : 64;
+  if (count <= vm->ffi_slots) return 1;
+  if (count > MAX_FFI_FUNCTIONS) return 0;
+  while (slots < count) slots *= 2;
+  if (slots > MAX_FFI_FUNCTIONS) slots = MAX_FFI_FUNCTIONS;
+  functions = realloc(vm->ffi_functions, slots * sizeof(*functions));
+  if (functions == NULL) return 0;
+  vm->ffi_functions = functions;
+  vm->ffi_slots = slots;
+  return 1;
 }
 
 V map_symbol(NgaState *vm) {
   int h;
   h = stack_pop(vm);
-  if (h < 0 || h >= nlibs || handles[h] == NULL) {
+  if (h < 0 || h >= vm->ffi_libraries || vm->ffi_handles[h] == NULL) {
     ffi_error(vm, "Invalid library handle");
     return;
   }
-  if (nffi >= MAX_FFI_FUNCTIONS) {
+  if (!ffi_reserve(vm, vm->ffi_mapped + 1)) {
     ffi_error(vm, "Too many mapped symbols");
     return;
   }
   char *s = string_extract(vm, stack_pop(vm));
-  funcs[nffi] = dlsym(handles[h], s);
-  if (funcs[nffi] == NULL) {
+  vm->ffi_functions[vm->ffi_mapped] = dlsym(vm->ffi_handles[h], s);
+  if (vm->ffi_functions[vm->ffi_mapped] == NULL) {
     stack_push(vm, -1);
     return;
   }
-  stack_push(vm, nffi);
-  nffi++;
+  stack_push(vm, vm->ffi_mapped);
+  vm->ffi_mapped++;
 }
 
 V invoke(NgaState *vm) {
   CELL function = stack_pop(vm);
-  if (function < 0 || function >= nffi || funcs[function] == NULL) {
+  if (function < 0 || function >= vm->ffi_mapped || vm->ffi_functions[function] == NULL) {
     ffi_error(vm, "Invalid function handle");
     return;
   }
-  funcs[function](vm);
+  vm->ffi_functions[function](vm);
 }
 
 V io_ffi(NgaState *vm) {
@@ -34,25 +34,29 @@ int files_valid_slot(CELL slot) {
   return slot > 0 && slot < MAX_OPEN_FILES;
 }
 
-V files_error(const char *name, const char *message) {
-  printf("\nERROR (nga/%s): %s\n", name, message);
-  exit(1);
+V files_error(NgaState *vm, const char *name, const char *message) {
+  vm_printf(vm, "\nERROR (nga/%s): %s\n", name, message);
+  halt_vm(vm, 1);
 }
 
 FILE *files_get_open_handle(NgaState *vm, CELL slot, const char *name) {
   if (!files_valid_slot(slot) || vm->OpenFileHandles[slot] == 0) {
-    files_error(name, "Invalid file handle");
+    files_error(vm, name, "Invalid file handle");
+    return NULL;
   }
   return vm->OpenFileHandles[slot];
 }
 
-V files_validate_transfer(CELL size, CELL address, const char *name) {
-  if (size < 0 || size > 32768) {
-    files_error(name, "Invalid byte count");
+int files_validate_transfer(NgaState *vm, CELL size, CELL address, const char *name) {
+  if (size < 0 || size > FILE_BYTES) {
+    files_error(vm, name, "Invalid byte count");
+    return 0;
   }
-  if (address < 0 || address + size > IMAGE_SIZE) {
-    files_error(name, "Invalid memory range");
+  if (address < 0 || address + size > MEMORY_SIZE) {
+    files_error(vm, name, "Invalid memory range");
+    return 0;
   }
+  return 1;
 }
 
 
@@ -107,6 +111,7 @@ V file_open(NgaState *vm) {
 V file_read(NgaState *vm) {
   CELL slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_read");
+  if (file == NULL) return;
   stack_push(vm, feof(file) ? 0 : fgetc(file));
 }
 
@@ -120,6 +125,7 @@ V file_read(NgaState *vm) {
 V file_write(NgaState *vm) {
   CELL slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_write");
+  if (file == NULL) return;
   fputc(stack_pop(vm), file);
 }
 
@@ -131,6 +137,7 @@ V file_write(NgaState *vm) {
 V file_close(NgaState *vm) {
   CELL slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_close");
+  if (file == NULL) return;
   fclose(file);
   vm->OpenFileHandles[slot] = 0;
 }
@@ -145,6 +152,7 @@ V file_close(NgaState *vm) {
 V file_get_position(NgaState *vm) {
   CELL slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_get_position");
+  if (file == NULL) return;
   stack_push(vm, (CELL) ftell(file));
 }
 
@@ -160,6 +168,7 @@ V file_set_position(NgaState *vm) {
   slot = stack_pop(vm);
   pos  = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_set_position");
+  if (file == NULL) return;
   fseek(file, pos, SEEK_SET);
 }
 
@@ -175,6 +184,7 @@ V file_get_size(NgaState *vm) {
   struct stat buffer;
   slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_get_size");
+  if (file == NULL) return;
   fstat(fileno(file), &buffer);
   if (!S_ISDIR(buffer.st_mode)) {
     current = ftell(file);
@@ -211,22 +221,33 @@ V file_flush(NgaState *vm) {
   CELL slot;
   slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_flush");
+  if (file == NULL) return;
   fflush(file);
 }
 
-char file_bytes[32769];
+/* The buffer for byte transfers is allocated when first used */
+static char *files_buffer(NgaState *vm, const char *name) {
+  if (vm->file_bytes == NULL)
+    vm->file_bytes = malloc(FILE_BYTES + 1);
+  if (vm->file_bytes == NULL)
+    files_error(vm, name, "Unable to allocate the transfer buffer");
+  return vm->file_bytes;
+}
 
 V file_read_bytes(NgaState *vm) {
   CELL slot = stack_pop(vm);
   CELL size = stack_pop(vm);
   CELL dest = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_read_bytes");
-  files_validate_transfer(size, dest, "file_read_bytes");
-  CELL z = fread((char *)file_bytes, 1, size, file);
+  if (file == NULL) return;
+  if (!files_validate_transfer(vm, size, dest, "file_read_bytes")) return;
+  if (files_buffer(vm, "file_read_bytes") == NULL) return;
+  CELL z = fread(vm->file_bytes, 1, size, file);
   for (CELL i = 0; i < z; i++) {
-    CELL x = file_bytes[i];
+    CELL x = vm->file_bytes[i];
     vm->memory[dest + i] = x;
   }
+  mark_dirty(vm, dest, z);
   stack_push(vm, z);
 }
 
@@ -235,12 +256,14 @@ V file_write_bytes(NgaState *vm) {
   CELL size = stack_pop(vm);
   CELL src  = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_write_bytes");
-  files_validate_transfer(size, src, "file_write_bytes");
+  if (file == NULL) return;
+  if (!files_validate_transfer(vm, size, src, "file_write_bytes")) return;
+  if (files_buffer(vm, "file_write_bytes") == NULL) return;
   for (CELL i = 0; i < size; i++) {
     char x = vm->memory[src + i];
-    file_bytes[i] = x;
+    vm->file_bytes[i] = x;
   }
-  CELL z = fwrite(&file_bytes, 1, size, file);
+  CELL z = fwrite(vm->file_bytes, 1, size, file);
   stack_push(vm, z);
 }
 
@@ -248,6 +271,7 @@ V file_read_character(NgaState *vm) {
   CELL c;
   CELL slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_read");
+  if (file == NULL) return;
   c = fread_character(file);
   stack_push(vm, feof(file) ? 0 : c);
 }
@@ -259,26 +283,31 @@ V file_write_character(NgaState *vm) {
   utf32_to_utf8(stack_pop(vm), utf8_bytes, &num_bytes);
   slot = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, slot, "file_write");
+  if (file == NULL) return;
   r = fwrite(&utf8_bytes, num_bytes, 1, file);
 }
 
 V file_read_line(NgaState *vm) {
   CELL slot = stack_pop(vm);
   CELL targ = stack_pop(vm);
+  CELL start = targ;
   CELL c;
   FILE *file = files_get_open_handle(vm, slot, "file_read");
-  if (targ < 0 || targ >= IMAGE_SIZE) {
-    files_error("file_read", "Invalid memory range");
+  if (file == NULL) return;
+  if (targ < 0 || targ >= MEMORY_SIZE) {
+    files_error(vm, "file_read", "Invalid memory range");
+    return;
   }
   c = fread_character(file);
   vm->memory[targ] = c;
   targ++;
-  while (c != 10 && c != 13 && c != 0 && targ < IMAGE_SIZE) {
+  while (c != 10 && c != 13 && c != 0 && targ < MEMORY_SIZE) {
     c = fread_character(file);
     vm->memory[targ] = c;
     targ++;
   }
   vm->memory[targ - 1] = 0;
+  mark_dirty(vm, start, targ - start);
 }
 
 V file_write_line(NgaState *vm) {
@@ -304,7 +333,8 @@ V io_filesystem(NgaState *vm) {
   CELL action = stack_pop(vm);
   CELL actions = sizeof(FileActions) / sizeof(FileActions[0]);
   if (action < 0 || action >= actions) {
-    files_error("io_filesystem", "Invalid file action");
+    files_error(vm, "io_filesystem", "Invalid file action");
+    return;
   }
   FileActions[action](vm);
 }
@@ -19,17 +19,38 @@
 
 /* Floating Point ---------------------------------------------------- */
 
-void float_guard(NgaState *vm) {
-  if (vm->fsp < 0 || vm->fsp > 255) {
-    printf("\nERROR (nga/float_guard): Float Stack Limits Exceeded!\n");
-    printf("At %lld, fsp = %lld\n", (long long)vm->cpu[vm->active].ip, (long long)vm->fsp);
-    exit(1);
+/* The float stacks are allocated when first used */
+int allocate_floats(NgaState *vm) {
+  int i;
+  if (vm->floats != NULL) return 1;
+  vm->floats = calloc(CORES * 2 * FLOAT_DEPTH, sizeof(double));
+  if (vm->floats == NULL) return 0;
+  for (i = 0; i < CORES; i++) {
+    vm->cpu[i].Floats = vm->floats + i * 2 * FLOAT_DEPTH;
+    vm->cpu[i].AFloats = vm->cpu[i].Floats + FLOAT_DEPTH;
   }
-  if (vm->afsp < 0 || vm->afsp > 255) {
-    printf("\nERROR (nga/float_guard): Alternate Float Stack Limits Exceeded!\n");
-    printf("At %lld, afsp = %lld\n", (long long)vm->cpu[vm->active].ip, (long long)vm->afsp);
-    exit(1);
+  return 1;
+}
+
+int float_guard(NgaState *vm) {
+  if (vm->floats == NULL && !allocate_floats(vm)) {
+    vm_printf(vm, "\nERROR (nga/float_guard): Unable to allocate the float stacks\n");
+    halt_vm(vm, 1);
+    return 0;
+  }
+  if (ACTIVE.fsp < 0 || ACTIVE.fsp > FLOAT_DEPTH - 1) {
+    vm_printf(vm, "\nERROR (nga/float_guard): Float Stack Limits Exceeded!\n");
+    vm_printf(vm, "At %lld, fsp = %lld\n", (long long)ACTIVE.ip, (long long)ACTIVE.fsp);
+    ACTIVE.fsp = 0;
+    halt_vm(vm, 1);
+  }
+  if (ACTIVE.afsp < 0 || ACTIVE.afsp > FLOAT_DEPTH - 1) {
+    vm_printf(vm, "\nERROR (nga/float_guard): Alternate Float Stack Limits Exceeded!\n");
+    vm_printf(vm, "At %lld, afsp = %lld\n", (long long)ACTIVE.ip, (long long)ACTIVE.afsp);
+    ACTIVE.afsp = 0;
+    halt_vm(vm, 1);
   }
+  return 1;
 }
 
 /*---------------------------------------------------------------------
@@ -38,26 +59,27 @@ void float_guard(NgaState *vm) {
   ---------------------------------------------------------------------*/
 
 void float_push(NgaState *vm, double value) {
-  vm->fsp++;
-  float_guard(vm);
-  vm->Floats[vm->fsp] = value;
+  ACTIVE.fsp++;
+  if (float_guard(vm))
+    ACTIVE.Floats[ACTIVE.fsp] = value;
 }
 
 double float_pop(NgaState *vm) {
-  vm->fsp--;
-  float_guard(vm);
-  return vm->Floats[vm->fsp + 1];
+  ACTIVE.fsp--;
+  if (!float_guard(vm)) return 0;
+  return ACTIVE.Floats[ACTIVE.fsp + 1];
 }
 
 void float_to_alt(NgaState *vm) {
-  vm->afsp++;
-  float_guard(vm);
-  vm->AFloats[vm->afsp] = float_pop(vm);
+  ACTIVE.afsp++;
+  if (float_guard(vm))
+    ACTIVE.AFloats[ACTIVE.afsp] = float_pop(vm);
 }
 
 void float_from_alt(NgaState *vm) {
-  float_push(vm, vm->AFloats[vm->afsp]);
-  vm->afsp--;
+  if (!float_guard(vm)) return;
+  float_push(vm, ACTIVE.AFloats[ACTIVE.afsp]);
+  ACTIVE.afsp--;
   float_guard(vm);
 }
 
@@ -87,8 +109,8 @@ void float_from_string(NgaState *vm) {
   I pass it off to `snprintf()` to deal with.
   ---------------------------------------------------------------------*/
 void float_to_string(NgaState *vm) {
-  snprintf(vm->string_data, 8192, "%f", float_pop(vm));
-  string_inject(vm, vm->string_data, stack_pop(vm));
+  snprintf(vm->text->string_data, 8192, "%f", float_pop(vm));
+  string_inject(vm, vm->text->string_data, stack_pop(vm));
 }
 
 
@@ -177,11 +199,11 @@ void float_gt(NgaState *vm) {
 }
 
 void float_depth(NgaState *vm) {
-  stack_push(vm, vm->fsp);
+  stack_push(vm, ACTIVE.fsp);
 }
 
 void float_adepth(NgaState *vm) {
-  stack_push(vm, vm->afsp);
+  stack_push(vm, ACTIVE.afsp);
 }
 
 void float_dup(NgaState *vm) {
@@ -263,8 +285,8 @@ void query_floatingpoint(NgaState *vm) {
 }
 
 void invalid_float_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/floats): Invalid floating-point action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/floats): Invalid floating-point action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
@@ -54,24 +54,21 @@ void ioctl_set_line_buffered_mode(NgaState *vm) {
   }
 }
 
-struct termios savedTermState;
-int savedTermStateValid;
-
 void ioctl_save_current_state(NgaState *vm) {
-  if (tcgetattr(STDIN_FILENO, &savedTermState) == -1) {
-    savedTermStateValid = 0;
+  if (tcgetattr(STDIN_FILENO, &vm->saved_term_state) == -1) {
+    vm->saved_term_state_valid = 0;
     perror("ERROR (nga/ioctl): Unable to save terminal settings");
     return;
   }
-  savedTermStateValid = 1;
+  vm->saved_term_state_valid = 1;
 }
 
 void ioctl_restore_saved_state(NgaState *vm) {
-  if (!savedTermStateValid) {
+  if (!vm->saved_term_state_valid) {
     fprintf(stderr, "ERROR (nga/ioctl): No saved terminal settings\n");
     return;
   }
-  if (tcsetattr(STDIN_FILENO, TCSANOW, &savedTermState) == -1) {
+  if (tcsetattr(STDIN_FILENO, TCSANOW, &vm->saved_term_state) == -1) {
     perror("ERROR (nga/ioctl): Unable to restore terminal settings");
   }
 }
@@ -90,8 +87,8 @@ V query_ioctl(NgaState *vm) {
 }
 
 V invalid_ioctl_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/ioctl): Invalid ioctl action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/ioctl): Invalid ioctl action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
@@ -16,52 +16,730 @@
 
 /* Multi Core Support ------------------------------------------------ */
 #ifdef ENABLE_MULTICORE
+void pause_core(NgaState *vm, CELL x);
+
 void init_core(NgaState *vm, CELL x) {
   int y;
+#ifndef ENABLE_THREADS
+  pause_core(vm, x);
+#endif
   vm->cpu[x].sp = 0;
   vm->cpu[x].rp = 0;
   vm->cpu[x].ip = 0;
   vm->cpu[x].active = 0;
   vm->cpu[x].u = 0;
-  for (y = 0; y < STACK_DEPTH; y++) { vm->cpu[x].data[y] = 0; };
-  for (y = 0; y < ADDRESSES; y++) { vm->cpu[x].address[y] = 0; };
+  vm->cpu[x].waiting = 0;
+  for (y = 0; y < DATA_DEPTH; y++) { vm->cpu[x].data[y] = 0; };
+  for (y = 0; y < ADDRESS_DEPTH; y++) { vm->cpu[x].address[y] = 0; };
   for (y = 0; y < 24; y++) { vm->cpu[x].registers[y] = 0; };
 }
 
+void multicore_error(NgaState *vm, const char *message);
+
+#ifndef ENABLE_THREADS
+
+/*---------------------------------------------------------------------
+  Scheduling
+
+  Cores that are ready to run are kept in a run queue. The current
+  core runs for a time slice (`vm->slice` bundles), then the next core
+  in the queue gets a turn. A core leaves the queue when it is paused
+  or when the code it was started at returns, and a switch happens
+  right away in either case. A core can also give up the rest of its
+  slice by yielding.
+
+  With only one core in the queue, the switch at the end of a slice
+  just starts a new slice on the same core.
+
+  If the last core in the queue is paused, it keeps running until
+  another core becomes ready, as nothing else could resume it.
+  ---------------------------------------------------------------------*/
+
+V initialize_scheduler(NgaState *vm) {
+#ifdef ENABLE_POLLER
+  int i;
+  for (i = 0; i < CORES; i++) {
+    vm->cpu[i].wait_fd = -1;
+    vm->cpu[i].wake_at = 0;
+  }
+  vm->parked = 0;
+#endif
+  vm->run_queue[0] = vm->active;
+  vm->queued = 1;
+  vm->queue_at = 0;
+  vm->slice = TIME_SLICE;
+  vm->ticks = TIME_SLICE;
+}
+
+void enqueue_core(NgaState *vm, CELL x) {
+  if (vm->cpu[x].active) return;
+  vm->cpu[x].active = -1;
+  vm->run_queue[vm->queued++] = x;
+}
+
+void dequeue_core(NgaState *vm, CELL x) {
+  int i, at;
+  if (!vm->cpu[x].active) return;
+  vm->cpu[x].active = 0;
+  for (at = 0; at < vm->queued && vm->run_queue[at] != x; at++);
+  for (i = at; i < vm->queued - 1; i++)
+    vm->run_queue[i] = vm->run_queue[i + 1];
+  vm->queued--;
+  if (at <= vm->queue_at) vm->queue_at--;
+  if (x == vm->active) vm->ticks = 0;
+}
+
 void start_core(NgaState *vm, CELL x, CELL ip) {
   vm->cpu[x].ip = ip;
   vm->cpu[x].rp = 1;
-  vm->cpu[x].active = -1;
+  enqueue_core(vm, x);
 }
 
+void unpark_core(NgaState *vm, CELL x);
+
 void pause_core(NgaState *vm, CELL x) {
-  vm->cpu[x].active = 0;
+  vm->cpu[x].waiting = 0;
+  unpark_core(vm, x);
+  dequeue_core(vm, x);
 }
 
 void resume_core(NgaState *vm, CELL x) {
-  vm->cpu[x].active = -1;
+  if (vm->cpu[x].rp != 0) enqueue_core(vm, x);
+}
+
+void finish_core(NgaState *vm, CELL owner) {
+  dequeue_core(vm, vm->active);
+  if (vm->queued == 0) enqueue_core(vm, owner);
 }
 
+
+/*---------------------------------------------------------------------
+  Waiting on I/O
+
+  A device that is about to block on a descriptor calls
+  `park_for_io()` first. If the descriptor isn't ready and there are
+  other cores to run, the core is parked: its stack is rewound to
+  where it was before the `ii` instruction, its instruction pointer is
+  moved back to that instruction, and it leaves the run queue. When
+  the descriptor becomes ready, the core is queued again and the
+  device call is repeated. This is only done when `ii` is alone in
+  its cell (as it is in `io:invoke`), so nothing else is repeated.
+
+  `park_for_timer()` is similar, but the device call is not
+  repeated: the core continues after it once the time has passed.
+
+  Parked cores are polled each time the time slice ends. If no core
+  is ready to run, the VM blocks in `poll()` until one is.
+  ---------------------------------------------------------------------*/
+
+#ifdef ENABLE_POLLER
+long long monotonic_ms(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+void unpark_core(NgaState *vm, CELL x) {
+  if (vm->cpu[x].wait_fd < 0 && vm->cpu[x].wake_at == 0) return;
+  vm->cpu[x].wait_fd = -1;
+  vm->cpu[x].wake_at = 0;
+  vm->parked--;
+}
+
+void poll_parked(NgaState *vm, int block) {
+  struct pollfd fds[CORES];
+  int cores[CORES];
+  int i, n = 0, timeout = 0;
+  long long now, next = 0;
+  for (i = 0; i < CORES; i++) {
+    if (vm->cpu[i].wait_fd >= 0) {
+      fds[n].fd = vm->cpu[i].wait_fd;
+      fds[n].events = vm->cpu[i].wait_events;
+      fds[n].revents = 0;
+      cores[n++] = i;
+    }
+    if (vm->cpu[i].wake_at && (next == 0 || vm->cpu[i].wake_at < next))
+      next = vm->cpu[i].wake_at;
+  }
+  if (block) {
+    now = monotonic_ms();
+    timeout = next == 0 ? -1 : next > now ? (int)(next - now) : 0;
+  }
+  if (poll(fds, n, timeout) > 0) {
+    for (i = 0; i < n; i++) {
+      if (fds[i].revents) {
+        unpark_core(vm, cores[i]);
+        enqueue_core(vm, cores[i]);
+      }
+    }
+  }
+  now = monotonic_ms();
+  for (i = 0; i < CORES; i++) {
+    if (vm->cpu[i].wake_at && vm->cpu[i].wake_at <= now) {
+      unpark_core(vm, i);
+      enqueue_core(vm, i);
+    }
+  }
+}
+
+int park_for_io(NgaState *vm, int fd, int events) {
+  struct pollfd p;
+  if (vm->memory[ACTIVE.ip] != 29) return 0;
+  if (vm->queued <= 1 && vm->parked == 0) return 0;
+  p.fd = fd;
+  p.events = events;
+  if (poll(&p, 1, 0) != 0) return 0;
+  ACTIVE.sp = ACTIVE.io_sp;
+  ACTIVE.ip--;
+  ACTIVE.wait_fd = fd;
+  ACTIVE.wait_events = events;
+  vm->parked++;
+  dequeue_core(vm, vm->active);
+  return 1;
+}
+
+int park_for_timer(NgaState *vm, CELL ms) {
+  if (vm->queued <= 1 && vm->parked == 0) return 0;
+  ACTIVE.wake_at = monotonic_ms() + (ms > 0 ? ms : 0);
+  vm->parked++;
+  dequeue_core(vm, vm->active);
+  return 1;
+}
+#else
+void unpark_core(NgaState *vm, CELL x) { }
+#endif
+
 void switch_core(NgaState *vm) {
-  vm->active += 1;
-  if (vm->active >= CORES) { vm->active = 0; }
-  if (!vm->cpu[vm->active].active) { switch_core(vm); }
+  vm->ticks = vm->slice;
+#ifdef ENABLE_POLLER
+  if (vm->parked)
+    poll_parked(vm, vm->queued == 0);
+  while (vm->queued == 0 && vm->parked)
+    poll_parked(vm, 1);
+#endif
+  if (vm->queued == 0) return;
+  vm->queue_at = (vm->queue_at + 1) % vm->queued;
+  vm->active = vm->run_queue[vm->queue_at];
+}
+
+void yield_core(NgaState *vm) {
+  vm->ticks = 0;
+}
+#else
+
+/*---------------------------------------------------------------------
+  Threaded Cores
+
+  With ENABLE_THREADS, core 0 runs on the host thread and each core
+  started with `start_core()` gets a thread of its own. A core thread
+  runs until the code it was started at returns.
+
+  Memory model:
+
+  - The data stack, address stack, float stacks, registers, and the
+    unsigned flag are per core, and are only touched by the thread
+    running that core.
+  - `vm->memory` is shared. Loads and stores by `fetch` and `store`
+    are plain, unordered accesses. Two cores writing the same cell, or
+    one writing while another reads, is a race, and the result is
+    undefined. Cores must coordinate through the synchronization
+    points below.
+  - Starting, pausing, and resuming a core are synchronization
+    points: memory written before one of these is visible to the
+    affected core once it (re)starts.
+  - Sending a value on a channel is a synchronization point: memory
+    written before the send is visible to the core that receives it.
+  - Device calls are serialized by a VM-wide lock. The lock is dropped
+    while a device runs nested code (e.g., `include`), so a core that
+    is loading source does not block I/O on the others. Channel sends,
+    receives, and waits, and the atomics, are made without the lock
+    (see `multicore_lock_free`).
+  ---------------------------------------------------------------------*/
+
+_Thread_local int nga_thread_core;
+
+V initialize_threads(NgaState *vm) {
+  pthread_mutexattr_t attributes;
+  int i;
+  for (i = 0; i < CORES; i++) {
+    vm->threads[i].vm = vm;
+    vm->threads[i].core = i;
+    vm->threads[i].running = 0;
+    vm->device_lock_depth[i] = 0;
+  }
+  pthread_mutex_init(&vm->core_lock, NULL);
+  pthread_cond_init(&vm->core_wake, NULL);
+  pthread_mutexattr_init(&attributes);
+  pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&vm->device_lock, &attributes);
+  pthread_mutexattr_destroy(&attributes);
+}
+
+V device_lock(NgaState *vm) {
+  pthread_mutex_lock(&vm->device_lock);
+  vm->device_lock_depth[CURRENT_CORE]++;
+}
+
+V device_unlock(NgaState *vm) {
+  vm->device_lock_depth[CURRENT_CORE]--;
+  pthread_mutex_unlock(&vm->device_lock);
+}
+
+int device_lock_release(NgaState *vm) {
+  int held = vm->device_lock_depth[CURRENT_CORE];
+  while (vm->device_lock_depth[CURRENT_CORE] > 0)
+    device_unlock(vm);
+  return held;
+}
+
+V device_lock_restore(NgaState *vm, int held) {
+  while (held-- > 0)
+    device_lock(vm);
+}
+
+V park_core(NgaState *vm) {
+  pthread_mutex_lock(&vm->core_lock);
+  while (!__atomic_load_n(&ACTIVE.active, __ATOMIC_ACQUIRE))
+    pthread_cond_wait(&vm->core_wake, &vm->core_lock);
+  pthread_mutex_unlock(&vm->core_lock);
+}
+
+static void *core_thread(void *arg) {
+  struct NgaThread *t = arg;
+  NgaState *vm = t->vm;
+  nga_thread_core = t->core;
+  execute(vm, ACTIVE.ip);
+  pthread_mutex_lock(&vm->core_lock);
+  ACTIVE.active = 0;
+  t->running = 0;
+  pthread_mutex_unlock(&vm->core_lock);
+  return NULL;
+}
+
+void start_core(NgaState *vm, CELL x, CELL ip) {
+  struct NgaThread *t = &vm->threads[x];
+  pthread_attr_t attributes;
+  if (x == 0) {
+    multicore_error(vm, "Core 0 runs on the host thread");
+    return;
+  }
+  pthread_mutex_lock(&vm->core_lock);
+  if (t->running) {
+    pthread_mutex_unlock(&vm->core_lock);
+    multicore_error(vm, "Core is already running");
+    return;
+  }
+  vm->cpu[x].ip = ip;
+  vm->cpu[x].rp = 1;
+  vm->cpu[x].active = -1;
+  t->running = 1;
+  pthread_attr_init(&attributes);
+  pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+  if (pthread_create(&t->thread, &attributes, core_thread, t) != 0) {
+    t->running = 0;
+    vm->cpu[x].active = 0;
+    pthread_mutex_unlock(&vm->core_lock);
+    pthread_attr_destroy(&attributes);
+    multicore_error(vm, "Unable to create a thread for the core");
+    return;
+  }
+  pthread_attr_destroy(&attributes);
+  pthread_mutex_unlock(&vm->core_lock);
+}
+
+void pause_core(NgaState *vm, CELL x) {
+  pthread_mutex_lock(&vm->core_lock);
+  __atomic_store_n(&vm->cpu[x].active, 0, __ATOMIC_RELEASE);
+  pthread_mutex_unlock(&vm->core_lock);
+}
+
+void resume_core(NgaState *vm, CELL x) {
+  pthread_mutex_lock(&vm->core_lock);
+  __atomic_store_n(&vm->cpu[x].active, -1, __ATOMIC_RELEASE);
+  pthread_cond_broadcast(&vm->core_wake);
+  pthread_mutex_unlock(&vm->core_lock);
+}
+
+void yield_core(NgaState *vm) {
+  sched_yield();
+}
+
+/* With threads, a core waiting on I/O just blocks its own thread, */
+/* but it must not hold the device lock while doing so.             */
+
+#ifdef ENABLE_POLLER
+int park_for_io(NgaState *vm, int fd, int events) {
+  struct pollfd p;
+  int held;
+  p.fd = fd;
+  p.events = events;
+  if (poll(&p, 1, 0) != 0) return 0;
+  held = device_lock_release(vm);
+  poll(&p, 1, -1);
+  device_lock_restore(vm, held);
+  return 0;
+}
+
+int park_for_timer(NgaState *vm, CELL ms) {
+  struct timespec delay;
+  int held = device_lock_release(vm);
+  delay.tv_sec = ms / 1000;
+  delay.tv_nsec = (ms % 1000) * 1000000;
+  nanosleep(&delay, NULL);
+  device_lock_restore(vm, held);
+  return 1;
+}
+#endif
+#endif
+
+/*---------------------------------------------------------------------
+  Channels
+
+  A channel is a bounded queue of cells. The capacity is rounded up to
+  a power of two, and can be at most MAX_CHANNEL_SIZE. Each slot has a sequence number, which lets senders
+  and receivers on any core claim slots with a compare & swap rather
+  than a lock (this is Dmitry Vyukov's bounded MPMC queue). A channel
+  with one sender and one receiver never retries.
+
+  `try-send` and `try-receive` never block. The blocking forms are
+  built on these in Retro: when a channel is not ready, the core
+  waits. Without threads a waiting core leaves the run queue, and
+  is put back when any channel is sent to, received from, or
+  destroyed. With threads, the core's thread sleeps on `core_wake`.
+  Wakeups are not specific to a channel, so the Retro words retry
+  after waiting.
+
+  With threads, sends, receives, selects, and waits are made without
+  the VM-wide device lock, so cores really do use the rings at the
+  same time. Creating and destroying channels, and creating mailboxes,
+  still take the lock. A channel must not be destroyed while another
+  core may still be using it.
+
+  Each core has a mailbox, which is a channel created the first time
+  it is used.
+  ---------------------------------------------------------------------*/
+
+V initialize_channels(NgaState *vm) {
+  int i;
+  for (i = 0; i < MAX_CHANNELS; i++)
+    vm->channels[i].in_use = 0;
+  for (i = 0; i < CORES; i++) {
+    vm->mailboxes[i] = 0;
+    vm->work_top[i] = vm->work_bottom[i] = 0;
+  }
+  vm->channel_waiters = 0;
+}
+
+int multicore_valid_channel(NgaState *vm, CELL id) {
+  return id >= 0 && id < MAX_CHANNELS &&
+         __atomic_load_n(&vm->channels[id].in_use, __ATOMIC_ACQUIRE);
+}
+
+CELL channel_create(NgaState *vm, CELL capacity) {
+  struct NgaChannel *c;
+  size_t size = 1, i;
+  CELL id;
+  for (id = 0; id < MAX_CHANNELS && vm->channels[id].in_use; id++);
+  if (id == MAX_CHANNELS) {
+    multicore_error(vm, "No free channels");
+    return -1;
+  }
+  if (capacity > MAX_CHANNEL_SIZE) {
+    multicore_error(vm, "Channel capacity too large");
+    return -1;
+  }
+  while (size < (size_t)capacity) size <<= 1;
+  if (size > SIZE_MAX / sizeof(CELL) || size > SIZE_MAX / sizeof(size_t)) {
+    multicore_error(vm, "Unable to allocate channel");
+    return -1;
+  }
+  c = &vm->channels[id];
+  c->values = malloc(size * sizeof(CELL));
+  c->sequence = malloc(size * sizeof(size_t));
+  if (c->values == NULL || c->sequence == NULL) {
+    free(c->values);
+    free(c->sequence);
+    multicore_error(vm, "Unable to allocate channel");
+    return -1;
+  }
+  for (i = 0; i < size; i++) c->sequence[i] = i;
+  c->mask = size - 1;
+  c->head = c->tail = 0;
+  __atomic_store_n(&c->in_use, 1, __ATOMIC_RELEASE);
+  return id;
+}
+
+void channel_wake(NgaState *vm) {
+#ifdef ENABLE_THREADS
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&vm->channel_waiters, __ATOMIC_SEQ_CST)) {
+    pthread_mutex_lock(&vm->core_lock);
+    pthread_cond_broadcast(&vm->core_wake);
+    pthread_mutex_unlock(&vm->core_lock);
+  }
+#else
+  int i;
+  for (i = 0; i < CORES; i++) {
+    if (vm->cpu[i].waiting) {
+      vm->cpu[i].waiting = 0;
+      enqueue_core(vm, i);
+    }
+  }
+#endif
+}
+
+void channel_destroy(NgaState *vm, CELL id) {
+  struct NgaChannel *c = &vm->channels[id];
+  int i;
+#ifdef ENABLE_THREADS
+  pthread_mutex_lock(&vm->core_lock);
+#endif
+  __atomic_store_n(&c->in_use, 0, __ATOMIC_RELEASE);
+  free(c->values);
+  free(c->sequence);
+  for (i = 0; i < CORES; i++)
+    if (vm->mailboxes[i] == id + 1) vm->mailboxes[i] = 0;
+#ifdef ENABLE_THREADS
+  pthread_mutex_unlock(&vm->core_lock);
+#endif
+  channel_wake(vm);
+}
+
+int channel_try_send(NgaState *vm, CELL id, CELL value) {
+  struct NgaChannel *c = &vm->channels[id];
+  size_t at = __atomic_load_n(&c->tail, __ATOMIC_RELAXED);
+  ptrdiff_t diff;
+  for (;;) {
+    diff = (ptrdiff_t)(__atomic_load_n(&c->sequence[at & c->mask],
+                                       __ATOMIC_ACQUIRE) - at);
+    if (diff == 0) {
+      if (__atomic_compare_exchange_n(&c->tail, &at, at + 1, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    } else if (diff < 0) {
+      return 0;
+    } else {
+      at = __atomic_load_n(&c->tail, __ATOMIC_RELAXED);
+    }
+  }
+  c->values[at & c->mask] = value;
+  __atomic_store_n(&c->sequence[at & c->mask], at + 1, __ATOMIC_RELEASE);
+  channel_wake(vm);
+  return -1;
+}
+
+int channel_try_receive(NgaState *vm, CELL id, CELL *value) {
+  struct NgaChannel *c = &vm->channels[id];
+  size_t at = __atomic_load_n(&c->head, __ATOMIC_RELAXED);
+  ptrdiff_t diff;
+  for (;;) {
+    diff = (ptrdiff_t)(__atomic_load_n(&c->sequence[at & c->mask],
+                                       __ATOMIC_ACQUIRE) - (at + 1));
+    if (diff == 0) {
+      if (__atomic_compare_exchange_n(&c->head, &at, at + 1, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    } else if (diff < 0) {
+      return 0;
+    } else {
+      at = __atomic_load_n(&c->head, __ATOMIC_RELAXED);
+    }
+  }
+  *value = c->values[at & c->mask];
+  __atomic_store_n(&c->sequence[at & c->mask], at + c->mask + 1,
+                   __ATOMIC_RELEASE);
+  channel_wake(vm);
+  return -1;
+}
+
+/* A destroyed channel counts as ready, so that waiting cores retry */
+/* and report the error.                                            */
+
+int channel_ready(NgaState *vm, CELL id, int sending) {
+  struct NgaChannel *c = &vm->channels[id];
+  size_t at;
+  if (!__atomic_load_n(&c->in_use, __ATOMIC_ACQUIRE)) return -1;
+  if (sending) {
+    at = __atomic_load_n(&c->tail, __ATOMIC_RELAXED);
+    return __atomic_load_n(&c->sequence[at & c->mask], __ATOMIC_ACQUIRE) == at;
+  }
+  at = __atomic_load_n(&c->head, __ATOMIC_RELAXED);
+  return __atomic_load_n(&c->sequence[at & c->mask], __ATOMIC_ACQUIRE) == at + 1;
+}
+
+/* `channels` is a Retro array of channel ids. Returns the index of */
+/* the first one with a value waiting, or -1 if none are ready. The */
+/* caller checks the array with `multicore_valid_array` first.      */
+
+CELL channel_select(NgaState *vm, CELL channels) {
+  CELL i, id;
+  for (i = 0; i < vm->memory[channels]; i++) {
+    id = vm->memory[channels + 1 + i];
+    if (!multicore_valid_channel(vm, id) || channel_ready(vm, id, 0))
+      return i;
+  }
+  return -1;
+}
+
+int channel_check(NgaState *vm, CELL id, CELL channels, int sending) {
+  if (channels) return channel_select(vm, channels) >= 0;
+  return channel_ready(vm, id, sending);
+}
+
+void channel_wait(NgaState *vm, CELL id, CELL channels, int sending) {
+#ifdef ENABLE_THREADS
+  int held = device_lock_release(vm);
+  pthread_mutex_lock(&vm->core_lock);
+  __atomic_add_fetch(&vm->channel_waiters, 1, __ATOMIC_SEQ_CST);
+  while (!channel_check(vm, id, channels, sending))
+    pthread_cond_wait(&vm->core_wake, &vm->core_lock);
+  __atomic_sub_fetch(&vm->channel_waiters, 1, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&vm->core_lock);
+  device_lock_restore(vm, held);
+#else
+  if (channel_check(vm, id, channels, sending)) return;
+  dequeue_core(vm, vm->active);
+  ACTIVE.waiting = -1;
+#endif
+}
+
+CELL core_mailbox(NgaState *vm, CELL core) {
+  if (vm->mailboxes[core] == 0)
+    vm->mailboxes[core] = channel_create(vm, MAILBOX_SIZE) + 1;
+  return vm->mailboxes[core] - 1;
 }
 
 int multicore_valid_core(CELL core) {
   return core >= 0 && core < CORES;
 }
 
+int multicore_valid_address(NgaState *vm, CELL address) {
+  return address >= 0 && address < MEMORY_SIZE;
+}
+
+int multicore_valid_array(NgaState *vm, CELL array) {
+  return array > 0 && multicore_valid_address(vm, array) &&
+         vm->memory[array] >= 0 &&
+         vm->memory[array] < MEMORY_SIZE - array;
+}
+
 int multicore_valid_register(CELL reg) {
   return reg >= 0 && reg < 24;
 }
 
 void multicore_error(NgaState *vm, const char *message) {
-  printf("\nERROR (nga/multicore): %s\n", message);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/multicore): %s\n", message);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
+/*---------------------------------------------------------------------
+  Work Stealing
+
+  Each core has a deque of work items (for `a:map/par` and friends,
+  these are chunk numbers). A core takes items from the bottom of its
+  own deque. When that is empty, it steals from the top of another
+  core's deque. Device calls are serialized (by the VM-wide lock with
+  ENABLE_THREADS), so the deques need no locking of their own.
+  ---------------------------------------------------------------------*/
+
+void work_push(NgaState *vm, CELL core, CELL item) {
+  if (vm->work_top[core] == vm->work_bottom[core])
+    vm->work_top[core] = vm->work_bottom[core] = 0;
+  if (vm->work_bottom[core] - vm->work_top[core] == WORK_DEQUE_SIZE) {
+    multicore_error(vm, "Work deque is full");
+    return;
+  }
+  vm->work[core][vm->work_bottom[core]++ % WORK_DEQUE_SIZE] = item;
+}
+
+CELL work_take(NgaState *vm) {
+  CELL core = CURRENT_CORE, i, victim;
+  if (vm->work_bottom[core] > vm->work_top[core])
+    return vm->work[core][--vm->work_bottom[core] % WORK_DEQUE_SIZE];
+  for (i = 1; i < CORES; i++) {
+    victim = (core + i) % CORES;
+    if (vm->work_bottom[victim] > vm->work_top[victim])
+      return vm->work[victim][vm->work_top[victim]++ % WORK_DEQUE_SIZE];
+  }
+  return -1;
+}
+
+int core_running(NgaState *vm, CELL core) {
+#ifdef ENABLE_THREADS
+  int running;
+  if (core == 0) return -1;
+  pthread_mutex_lock(&vm->core_lock);
+  running = vm->threads[core].running;
+  pthread_mutex_unlock(&vm->core_lock);
+  return running ? -1 : 0;
+#else
+  return (vm->cpu[core].active || vm->cpu[core].rp != 0) ? -1 : 0;
+#endif
+}
+
+/*---------------------------------------------------------------------
+  Atomics
+
+  These operate on cells in `vm->memory`, using the GCC/Clang atomic
+  builtins (which follow the C11 memory model). The loads, stores, and
+  read-modify-write operations are sequentially consistent. The fences
+  let code using plain `fetch` and `store` order its accesses. With
+  threads, they run without the device lock, so cores updating
+  different cells don't wait on each other.
+  ---------------------------------------------------------------------*/
+
+void atomic_operation(NgaState *vm, CELL action) {
+  CELL a, v, old;
+  if (action >= 25) {
+    if (action == 25) __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (action == 26) __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (action == 27) __atomic_thread_fence(__ATOMIC_RELEASE);
+    return;
+  }
+  a = stack_pop(vm);
+  if (!multicore_valid_address(vm, a)) {
+    multicore_error(vm, "Invalid address");
+    return;
+  }
+  switch (action) {
+    case 19: stack_push(vm, __atomic_load_n(&vm->memory[a], __ATOMIC_SEQ_CST));
+             break;
+    case 20: __atomic_store_n(&vm->memory[a], stack_pop(vm), __ATOMIC_SEQ_CST);
+             break;
+    case 21: v = stack_pop(vm);
+             old = stack_pop(vm);
+             stack_push(vm, __atomic_compare_exchange_n(&vm->memory[a], &old, v, 0,
+                            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? -1 : 0);
+             break;
+    case 22: stack_push(vm, __atomic_fetch_add(&vm->memory[a], stack_pop(vm),
+                                               __ATOMIC_SEQ_CST));
+             break;
+    case 23: stack_push(vm, __atomic_fetch_or(&vm->memory[a], stack_pop(vm),
+                                              __ATOMIC_SEQ_CST));
+             break;
+    case 24: stack_push(vm, __atomic_exchange_n(&vm->memory[a], stack_pop(vm),
+                                                __ATOMIC_SEQ_CST));
+             break;
+  }
+  if (action != 19)
+    MARK_DIRTY(vm, a);
+}
+
+#ifdef ENABLE_THREADS
+/* Channel sends, receives, selects, and waits (11 - 16) and the    */
+/* atomics (19 - 27) only touch the channel rings and memory cells, */
+/* so `ii` runs them without taking the device lock.                */
+
+int multicore_lock_free(NgaState *vm, CELL device) {
+  CELL action;
+  if (vm->IO_deviceHandlers[device] != io_multicore || ACTIVE.sp < 1)
+    return 0;
+  action = TOS;
+  return (action >= 11 && action <= 16) || (action >= 19 && action <= 27);
+}
+#endif
+
 void io_multicore(NgaState *vm) {
   CELL x, y, z;
   x = stack_pop(vm);
@@ -79,7 +757,7 @@ void io_multicore(NgaState *vm) {
             if (multicore_valid_core(y)) pause_core(vm, y);
             else multicore_error(vm, "Invalid core index");
             break;
-    case 3: pause_core(vm, vm->active);
+    case 3: pause_core(vm, CURRENT_CORE);
             break;
     case 4: y = stack_pop(vm);
             if (multicore_valid_core(y)) resume_core(vm, y);
@@ -87,21 +765,89 @@ void io_multicore(NgaState *vm) {
             break;
     case 5: y = stack_pop(vm);
             if (multicore_valid_register(y))
-              stack_push(vm, vm->cpu[vm->active].registers[y]);
+              stack_push(vm, ACTIVE.registers[y]);
             else multicore_error(vm, "Invalid register index");
             break;
     case 6: y = stack_pop(vm);
             z = stack_pop(vm);
             if (multicore_valid_register(y))
-              vm->cpu[vm->active].registers[y] = z;
+              ACTIVE.registers[y] = z;
             else multicore_error(vm, "Invalid register index");
             break;
+    case 7: yield_core(vm);
+            break;
+    case 8: y = stack_pop(vm);
+            if (y > 0) vm->slice = y;
+            else multicore_error(vm, "Invalid time slice");
+            break;
+    case 9: y = stack_pop(vm);
+            if (y > 0) stack_push(vm, channel_create(vm, y));
+            else multicore_error(vm, "Invalid channel capacity");
+            break;
+    case 10: y = stack_pop(vm);
+             if (multicore_valid_channel(vm, y)) channel_destroy(vm, y);
+             else multicore_error(vm, "Invalid channel");
+             break;
+    case 11: y = stack_pop(vm);
+             z = stack_pop(vm);
+             if (multicore_valid_channel(vm, y))
+               stack_push(vm, channel_try_send(vm, y, z));
+             else multicore_error(vm, "Invalid channel");
+             break;
+    case 12: y = stack_pop(vm);
+             if (multicore_valid_channel(vm, y)) {
+               z = 0;
+               x = channel_try_receive(vm, y, &z);
+               stack_push(vm, z);
+               stack_push(vm, x);
+             } else multicore_error(vm, "Invalid channel");
+             break;
+    case 13: y = stack_pop(vm);
+             if (multicore_valid_channel(vm, y)) channel_wait(vm, y, 0, 0);
+             else multicore_error(vm, "Invalid channel");
+             break;
+    case 14: y = stack_pop(vm);
+             if (multicore_valid_channel(vm, y)) channel_wait(vm, y, 0, 1);
+             else multicore_error(vm, "Invalid channel");
+             break;
+    case 15: y = stack_pop(vm);
+             if (multicore_valid_array(vm, y))
+               stack_push(vm, channel_select(vm, y));
+             else multicore_error(vm, "Invalid channel array");
+             break;
+    case 16: y = stack_pop(vm);
+             if (multicore_valid_array(vm, y)) channel_wait(vm, 0, y, 0);
+             else multicore_error(vm, "Invalid channel array");
+             break;
+    case 17: y = stack_pop(vm);
+             if (multicore_valid_core(y)) stack_push(vm, core_mailbox(vm, y));
+             else multicore_error(vm, "Invalid core index");
+             break;
+    case 18: stack_push(vm, CURRENT_CORE);
+             break;
+    case 19: case 20: case 21: case 22: case 23: case 24:
+    case 25: case 26: case 27:
+             atomic_operation(vm, x);
+             break;
+    case 28: y = stack_pop(vm);
+             z = stack_pop(vm);
+             if (multicore_valid_core(y)) work_push(vm, y, z);
+             else multicore_error(vm, "Invalid core index");
+             break;
+    case 29: stack_push(vm, work_take(vm));
+             break;
+    case 30: y = stack_pop(vm);
+             if (multicore_valid_core(y)) stack_push(vm, core_running(vm, y));
+             else multicore_error(vm, "Invalid core index");
+             break;
+    case 31: stack_push(vm, CORES);
+             break;
     default: multicore_error(vm, "Invalid multicore action");
   }
 }
 
 void query_multicore(NgaState *vm) {
-  stack_push(vm, 0);
+  stack_push(vm, 4);
   stack_push(vm, DEVICE_MULTICORE);
 }
 #endif
@@ -24,30 +24,29 @@
   BSD Sockets
   ---------------------------------------------------------------------*/
 
-#define SOCKET_SLOTS 16
-
-int SocketID[SOCKET_SLOTS];
-int SocketUsed[SOCKET_SLOTS];
-struct sockaddr_in Sockets[SOCKET_SLOTS];
-
-struct addrinfo hints, *res;
-
 int socket_get_handle(NgaState *vm, CELL socket, int *handle) {
-  if (socket < 0 || socket >= SOCKET_SLOTS || !SocketUsed[socket]) {
-    printf("\nERROR (nga/sockets): Invalid socket handle %lld\n", (long long)socket);
-    ACTIVE.ip = IMAGE_SIZE;
+  if (socket < 0 || socket >= SOCKET_SLOTS || !vm->SocketUsed[socket]) {
+    vm_printf(vm, "\nERROR (nga/sockets): Invalid socket handle %lld\n", (long long)socket);
+    ACTIVE.ip = MEMORY_SIZE;
     ACTIVE.rp = 0;
     return 0;
   }
-  *handle = SocketID[socket];
+  *handle = vm->SocketID[socket];
   return 1;
 }
 
 V socket_getaddrinfo(NgaState *vm) {
+  struct addrinfo hints;
   char host[1025], port[6];
   strlcpy(port, string_extract(vm, stack_pop(vm)), 5);
   strlcpy(host, string_extract(vm, stack_pop(vm)), 1024);
-  getaddrinfo(host, port, &hints, &res);
+  memset(&hints, 0, sizeof hints);
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (vm->socket_address != NULL)
+    freeaddrinfo(vm->socket_address);
+  vm->socket_address = NULL;
+  getaddrinfo(host, port, &hints, &vm->socket_address);
 }
 
 V socket_get_host(NgaState *vm) {
@@ -56,7 +55,7 @@ V socket_get_host(NgaState *vm) {
 
   hp = gethostbyname(string_extract(vm, stack_pop(vm)));
   if (hp == NULL) {
-    vm->memory[stack_pop(vm)] = 0;
+    string_inject(vm, "", stack_pop(vm));
     return;
   }
 
@@ -68,9 +67,9 @@ V socket_create(NgaState *vm) {
   int i;
   int sock = socket(PF_INET, SOCK_STREAM, 0);
   for (i = 0; i < SOCKET_SLOTS; i++) {
-    if (!SocketUsed[i] && sock >= 0) {
-      SocketID[i] = sock;
-      SocketUsed[i] = 1;
+    if (!vm->SocketUsed[i] && sock >= 0) {
+      vm->SocketID[i] = sock;
+      vm->SocketUsed[i] = 1;
       stack_push(vm, (CELL)i);
       return;
     }
@@ -83,6 +82,7 @@ V socket_create(NgaState *vm) {
 V socket_bind(NgaState *vm) {
   int handle;
   CELL sock, port;
+  struct addrinfo hints, *res;
   memset(&hints, 0, sizeof hints);
   hints.ai_family = AF_UNSPEC;
   hints.ai_socktype = SOCK_STREAM;
@@ -92,9 +92,14 @@ V socket_bind(NgaState *vm) {
   port = stack_pop(vm);
   if (!socket_get_handle(vm, sock, &handle)) return;
 
-  getaddrinfo(NULL, string_extract(vm, port), &hints, &res);
+  if (getaddrinfo(NULL, string_extract(vm, port), &hints, &res) != 0) {
+    stack_push(vm, -1);
+    stack_push(vm, EINVAL);
+    return;
+  }
   stack_push(vm, (CELL) bind(handle, res->ai_addr, res->ai_addrlen));
   stack_push(vm, errno);
+  freeaddrinfo(res);
 }
 
 V socket_listen(NgaState *vm) {
@@ -113,12 +118,13 @@ V socket_accept(NgaState *vm) {
   struct sockaddr_storage their_addr;
   socklen_t addr_size = sizeof their_addr;
   if (!socket_get_handle(vm, sock, &handle)) return;
+  if (park_for_io(vm, handle, POLLIN)) return;
   int new_fd = accept(handle, (struct sockaddr *)&their_addr, &addr_size);
 
   for (i = 0; i < SOCKET_SLOTS; i++) {
-    if (!SocketUsed[i] && new_fd >= 0) {
-      SocketID[i] = new_fd;
-      SocketUsed[i] = 1;
+    if (!vm->SocketUsed[i] && new_fd >= 0) {
+      vm->SocketID[i] = new_fd;
+      vm->SocketUsed[i] = 1;
       stack_push(vm, (CELL)i);
       stack_push(vm, errno);
       return;
@@ -136,7 +142,13 @@ V socket_connect(NgaState *vm) {
   int handle;
   CELL sock = stack_pop(vm);
   if (!socket_get_handle(vm, sock, &handle)) return;
-  stack_push(vm, (CELL)connect(handle, res->ai_addr, res->ai_addrlen));
+  if (vm->socket_address == NULL) {
+    stack_push(vm, -1);
+    stack_push(vm, EDESTADDRREQ);
+    return;
+  }
+  stack_push(vm, (CELL)connect(handle, vm->socket_address->ai_addr,
+                               vm->socket_address->ai_addrlen));
   stack_push(vm, errno);
 }
 
@@ -145,6 +157,7 @@ V socket_send(NgaState *vm) {
   CELL sock = stack_pop(vm);
   char *buf = string_extract(vm, stack_pop(vm));
   if (!socket_get_handle(vm, sock, &handle)) return;
+  if (park_for_io(vm, handle, POLLOUT)) return;
   stack_push(vm, send(handle, buf, strlen(buf), 0));
   stack_push(vm, errno);
 }
@@ -157,11 +170,12 @@ V socket_recv(NgaState *vm) {
   CELL dest = stack_pop(vm);
   if (!socket_get_handle(vm, sock, &handle)) return;
   if (limit < 0 || limit >= (CELL)sizeof(buf)) {
-    printf("\nERROR (nga/sockets): Invalid receive length %lld\n", (long long)limit);
-    ACTIVE.ip = IMAGE_SIZE;
+    vm_printf(vm, "\nERROR (nga/sockets): Invalid receive length %lld\n", (long long)limit);
+    ACTIVE.ip = MEMORY_SIZE;
     ACTIVE.rp = 0;
     return;
   }
+  if (park_for_io(vm, handle, POLLIN)) return;
   int len = recv(handle, buf, (size_t)limit, 0);
   if (len > 0)  buf[len] = '\0';
   if (len > 0)  string_inject(vm, buf, dest);
@@ -174,7 +188,7 @@ V socket_close(NgaState *vm) {
   CELL sock = stack_pop(vm);
   if (!socket_get_handle(vm, sock, &handle)) return;
   close(handle);
-  SocketUsed[sock] = 0;
+  vm->SocketUsed[sock] = 0;
 }
 
 Handler SocketActions[] = {
@@ -185,8 +199,8 @@ Handler SocketActions[] = {
 };
 
 V invalid_socket_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/sockets): Invalid socket action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/sockets): Invalid socket action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
@@ -66,6 +66,7 @@ V unix_open_pipe(NgaState *vm) {
 V unix_close_pipe(NgaState *vm) {
   CELL slot = stack_pop(vm);
   FILE *pipe = files_get_open_handle(vm, slot, "unix_close_pipe");
+  if (pipe == NULL) return;
   pclose(pipe);
   vm->OpenFileHandles[slot] = 0;
 }
@@ -99,14 +100,14 @@ V unix_run_external(NgaState *vm) {
   }
 
   if ((pid = fork()) < 0) {
-    printf("*** ERROR: forking child process failed\n");
-    exit(1);
+    vm_printf(vm, "*** ERROR: forking child process failed\n");
+    return;
   }
   else if (pid == 0) {
     int e = execvp(*args, args);
     if (e < 0) {
-      printf("*** ERROR: exec failed with %d\n", e);
-      exit(1);
+      fprintf(stderr, "*** ERROR: exec failed with %d\n", e);
+      _exit(1);
     }
   } else {
   while (wait(&status) != pid)
@@ -162,7 +163,7 @@ V unix_exec3(NgaState *vm) {
   stack_push(vm, errno);
 }
 
-V unix_exit(NgaState *vm) { exit(stack_pop(vm)); }
+V unix_exit(NgaState *vm) { halt_vm(vm, stack_pop(vm)); }
 V unix_getpid(NgaState *vm) { stack_push(vm, getpid()); }
 V unix_wait(NgaState *vm) { int a; stack_push(vm, wait(&a)); }
 
@@ -177,6 +178,7 @@ V unix_write(NgaState *vm) {
   CELL b = stack_pop(vm);
   CELL a = stack_pop(vm);
   FILE *file = files_get_open_handle(vm, c, "unix_write");
+  if (file == NULL) return;
   ignore = write(fileno(file), string_extract(vm, a), b);
 }
 
@@ -194,7 +196,11 @@ V unix_putenv(NgaState *vm) {
   putenv(string_extract(vm, stack_pop(vm)));
 }
 
-V unix_sleep(NgaState *vm) { sleep(stack_pop(vm)); }
+V unix_sleep(NgaState *vm) {
+  CELL seconds = stack_pop(vm);
+  if (!park_for_timer(vm, seconds * 1000))
+    sleep(seconds);
+}
 
 Handler UnixActions[] = {
   unix_system,    unix_fork,   unix_exec0,     unix_exec1,
@@ -210,8 +216,8 @@ V query_unix(NgaState *vm) {
 }
 
 V invalid_unix_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/unix): Invalid Unix action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/unix): Invalid Unix action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
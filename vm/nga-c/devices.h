@@ -20,3 +20,4 @@
 #define DEVICE_MULTICORE   8000
 #define DEVICE_FFI         8100
 #define DEVICE_UNSIGNED    8101
+#define DEVICE_EVENTS      8200
@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include <stdint.h>
 #ifndef CELL
 #ifndef BIT64
@@ -10,3685 +11,6842 @@
 #define CELL_MAX LLONG_MAX - 1
 #endif
 #endif
-CELL ngaImageCells = 73607;
-CELL ngaImage[] = { 1793,14158,73386,73606,202608,441,413,1770,2048,6226,14186,0,10,1,10,2,10,3,10,
-                       4,10,5,10,6,10,7,10,8,10,11,10,12,10,13,10,14,10,15,10,
-                       16,10,17,10,18,10,19,10,20,10,167969812,656148,21,10,22,10,23,10,24,10,
-                       25,68223234,1,2575,85000450,1,656912,165,182,268505089,67,66,285281281,0,67,2063,10,101384453,0,9,
-                       10,68485378,255,18350338,8,255,1045,18350338,16,255,1045,352393217,24,255,10,268289,-24,68229121,-16,68229121,
-                       -8,2577,2049,60,25,459011,101,524546,101,302256641,1,10,16974595,0,50529798,10,25,524547,120,50529798,
-                       10,17108738,1,251790353,101777669,1,17565186,111,524545,115,68,167838467,-1,134287105,3,63,659457,3,459023,132,
-                       2049,60,25,2049,132,1793,139,2049,139,117506307,0,132,0,524545,28,137,168820993,0,151,1642241,
-                       151,134283523,13,137,1793,132,524545,2049,132,1793,132,16846593,151,165,182,1793,68,16846593,151,137,
-                       182,1793,68,7,10,659713,1,659713,2,659713,3,659713,4,659713,5,659713,6,659713,7,659713,
-                       8,659713,9,45,0,1793,70630,17108737,3,2,524559,132,2049,132,2049,132,524545,0,132,524545,
-                       0,132,524545,0,132,524545,202,132,524545,202,132,524545,0,132,2049,146,1048838,2,1642241,10,
-                       7,69676,-460132687,167841793,240,11,17826049,0,240,2,15,25,524546,27598,134287105,241,29,2305,242,459023,
-                       250,2049,6226,134287361,241,245,659201,240,10,659969,7,2049,60,25,17694978,58,268,9,84152833,48,
-                       319750404,267,117507601,270,184618754,45,25,16974851,-1,168886532,1,134284289,1,283,134284289,0,270,660227,32,0,
-                       0,115,105,103,105,108,58,105,0,285278479,300,6,2576,524546,106,1641217,1,167838467,297,2049,
-                       312,2049,308,524545,300,260,17826050,299,0,2572,2563,2049,290,1793,158,459023,158,1793,338,17760513,
-                       170,3,204,8,251727617,3,2,2049,184,16,168820993,-1,151,2049,184,2575,2049,260,17563906,0,
-                       352,9,1793,158,285282049,3,2,134287105,151,349,524545,1793,132,16846593,3,0,132,8,659201,3,
-                       524545,28,137,17043201,3,13,2049,137,2049,132,268505092,151,1642241,151,656131,659201,3,524545,13,137,
-                       2049,132,459009,25,137,459009,59,137,459009,21,137,459009,23,137,1793,13459,10,524546,184,134284303,
-                       186,1807,1770,1642241,299,285282049,421,1,459012,416,117509889,240,416,134287105,421,260,16845825,0,429,413,
-                       1793,68,1793,443,17826050,421,318,8,117506305,422,432,68,2116,11340,11700,11400,13685,13104,12432,12402,
-                       9603,9801,11514,11413,11110,12528,11948,10302,13340,9700,13455,12753,10500,10670,12654,13320,11960,13908,10088,10605,
-                       11865,11025,0,2049,260,987393,1,1793,132,524546,519,2049,517,2049,517,17891588,2,519,8,17045505,
-                       -24,-16,17043736,-8,1118488,1793,132,17043202,1,169021201,2049,60,25,33883396,101450758,6404,459011,509,34668804,2,
-                       2049,506,524545,451,509,302056196,451,659969,1,114,101,116,114,111,46,109,117,114,105,0,
-                       0,15,176,17438,193489870,16498,0,0,44302,100,117,112,0,539,17,176,17438,2090195226,16489,0,
-                       0,44194,100,114,111,112,0,552,19,176,17438,2090739264,17194,0,0,63862,115,119,97,112,
-                       0,566,27,176,17438,2090140673,16307,0,0,39243,99,97,108,108,0,580,29,176,17438,193490778,
-                       16513,0,0,45086,101,113,63,0,594,31,176,17438,2088204551,15762,0,0,28999,45,101,113,
-                       63,0,607,33,176,17438,193498500,16650,0,0,54245,108,116,63,0,621,35,176,17438,193493055,
-                       16578,0,0,52125,103,116,63,0,634,37,176,17438,258875503,16518,0,0,49046,102,101,116,
-                       99,104,0,647,39,176,17438,274826578,17185,0,0,63750,115,116,111,114,101,0,662,41,
-                       176,0,266796918,16679,0,0,54655,110,58,97,100,100,0,677,43,176,0,266817079,16775,0,
-                       0,55731,110,58,115,117,98,0,692,45,176,0,266810555,16734,0,0,55280,110,58,109,
-                       117,108,0,707,47,176,0,1637942608,16699,0,0,54902,110,58,100,105,118,109,111,100,
-                       0,722,49,176,0,266800368,16694,0,0,54839,110,58,100,105,118,0,740,50,176,0,
-                       266810349,16729,0,0,55236,110,58,109,111,100,0,755,41,176,17438,177616,15747,0,0,28770,
-                       43,0,770,43,176,17438,177618,15755,0,0,28889,45,0,781,45,176,17438,177615,15742,0,
-                       0,28623,42,0,792,47,176,17438,2088285108,15780,0,0,29278,47,109,111,100,0,803,49,
-                       176,17465,177620,15775,0,0,29215,47,0,817,50,176,17465,193499461,16660,0,0,54413,109,111,
-                       100,0,828,51,176,17438,193486360,16146,0,0,36662,97,110,100,0,841,53,176,17438,5863686,
-                       16801,0,0,56023,111,114,0,854,55,176,17438,193511454,17324,0,0,68799,120,111,114,0,
-                       866,57,176,17465,274388419,17115,0,0,61873,115,104,105,102,116,0,879,407,182,17438,2090629861,
-                       16825,15698,0,56268,112,117,115,104,0,894,410,182,17438,193502740,16820,15695,0,56141,112,111,
-                       112,0,908,404,182,17438,5861552,15786,0,0,29355,48,59,0,921,60,170,17438,-1885660229,16522,
-                       0,0,49095,102,101,116,99,104,45,110,101,120,116,0,933,63,170,17438,1976567422,17189,
-                       0,0,63792,115,116,111,114,101,45,110,101,120,116,0,953,290,170,17438,-2005311157,17077,
-                       0,0,60517,115,58,116,111,45,110,117,109,98,101,114,0,973,120,170,17438,272731271,
-                       16950,0,0,58230,115,58,101,113,63,0,994,106,170,17438,289838292,17006,0,0,59239,115,
-                       58,108,101,110,103,116,104,0,1009,68,170,17438,-161057562,16348,0,0,39650,99,104,111,
-                       111,115,101,0,1027,78,176,17438,5863476,16616,0,0,52892,105,102,0,1043,76,170,17438,
-                       193429569,15767,0,0,29093,45,105,102,0,1055,329,182,0,-1801857825,0,0,0,0,115,105,
-                       103,105,108,58,40,0,1068,151,158,17438,-1210660288,15918,0,0,31113,67,111,109,112,105,
-                       108,101,114,0,1085,3,158,17438,2089174371,15935,0,0,32459,72,101,97,112,0,1103,132,
-                       170,17438,177617,15752,0,0,28810,44,0,1117,146,170,17438,5863748,16857,0,0,56622,115,44,
-                       0,1128,152,182,17438,177632,15796,0,0,29469,59,0,1140,363,182,17438,177664,15974,0,0,
-                       33556,91,0,1151,379,182,17438,177666,15976,0,0,33575,93,0,1162,2,158,17438,1264838491,15921,
-                       0,0,31934,68,105,99,116,105,111,110,97,114,121,0,1173,183,170,17438,-176589039,16445,
-                       0,0,42921,100,58,108,105,110,107,0,1193,184,170,17438,2090134543,16470,0,0,43798,100,
-                       58,120,116,0,1209,186,170,17438,-1543050247,16416,0,0,42195,100,58,99,108,97,115,115,
-                       0,1223,200,170,17438,-176525916,16457,0,0,43327,100,58,110,97,109,101,0,1240,170,170,
-                       17438,339514705,16369,0,0,39989,99,108,97,115,115,58,119,111,114,100,0,1256,182,170,
-                       17438,-1693294713,16363,0,0,39865,99,108,97,115,115,58,109,97,99,114,111,0,1276,158,
-                       170,17438,338816719,16353,0,0,39830,99,108,97,115,115,58,100,97,116,97,0,1297,204,
-                       170,17438,-2097653054,16411,0,0,42016,100,58,97,100,100,45,104,101,97,100,101,114,0,
-                       1317,330,182,17438,-1801857830,17134,0,0,62067,115,105,103,105,108,58,35,0,1339,336,182,
-                       17438,-1801857807,17153,0,0,62422,115,105,103,105,108,58,58,0,1356,355,182,17438,-1801857827,17142,
-                       0,0,62131,115,105,103,105,108,58,38,0,1373,334,182,17438,-1801857829,17138,0,0,62094,
-                       115,105,103,105,108,58,36,0,1390,394,182,17438,422440038,16842,0,0,56531,114,101,112,
-                       101,97,116,0,1407,396,182,17438,252997285,16141,0,0,36540,97,103,97,105,110,0,1423,
-                       441,170,17438,314257922,16630,0,0,53280,105,110,116,101,114,112,114,101,116,0,1438,260,
-                       170,17438,975220285,16449,0,0,42971,100,58,108,111,111,107,117,112,0,1457,176,170,17438,
-                       1687271822,16366,0,0,39917,99,108,97,115,115,58,112,114,105,109,105,116,105,118,101,
-                       0,1475,4,158,17438,-742861781,15971,0,0,33514,86,101,114,115,105,111,110,0,1500,488,
-                       170,17438,177678,16613,0,0,52809,105,0,1517,132,170,17438,177673,16408,0,0,41960,100,0,
-                       1528,482,170,17438,177687,16828,0,0,56322,114,0,1539,267,158,17438,2088954976,15915,0,0,31036,
-                       66,97,115,101,0,1550,94,170,17438,2090607556,16813,0,0,56097,112,97,99,107,0,1564,
-                       80,170,17438,550515207,17241,0,0,66241,117,110,112,97,99,107,0,1578,188,170,17438,1249390676,
-                       16466,0,0,43636,100,58,115,111,117,114,99,101,0,1594,190,170,17438,-176741337,16426,0,
-                       0,42532,100,58,104,97,115,104,0,1612,192,170,17438,-1523788551,15716,0,0,69329,100,58,
-                       115,116,97,99,107,0,1628,194,170,17438,549642842,15720,0,0,69396,100,58,97,115,116,
-                       97,99,107,0,1645,196,170,17438,745319807,15724,0,0,69466,100,58,102,115,116,97,99,
-                       107,0,1663,198,170,17438,-1542096812,15728,0,0,69534,100,58,100,101,115,99,114,0,1681,
-                       9,158,17438,1830486317,16430,0,0,42582,100,58,72,97,115,104,70,117,110,99,116,105,
-                       111,110,0,1698,10,158,17438,709912452,16463,0,0,43436,100,58,82,101,104,97,115,104,
-                       70,117,110,99,116,105,111,110,0,1722,413,170,17438,933914805,16511,0,0,45252,101,114,
-                       114,58,110,111,116,102,111,117,110,100,0,105,109,97,103,101,58,115,97,118,
-                       101,0,46,105,109,97,103,101,0,116,101,0,95,115,101,116,116,105,110,103,
-                       115,47,115,116,97,116,101,0,0,109,101,109,111,114,121,95,114,101,103,105,
-                       111,110,46,95,85,115,101,115,95,97,95,100,111,117,98,108,101,95,99,101,
-                       108,108,95,112,111,105,110,116,101,114,95,102,111,114,95,116,104,101,95,97,
-                       100,100,114,101,115,115,46,0,101,95,115,116,97,99,107,46,0,103,46,0,
-                       115,95,98,101,116,119,101,101,110,95,96,45,45,45,114,101,118,101,97,108,
-                       45,45,45,96,95,97,110,100,95,116,104,101,95,96,125,125,96,95,118,105,
-                       115,105,98,108,101,46,0,110,111,110,45,122,101,114,111,95,118,97,108,117,
-                       101,95,97,115,95,96,84,82,85,69,96,46,0,69,96,46,0,108,108,95,
-                       98,101,95,116,104,101,95,114,101,115,116,95,111,102,95,116,104,101,95,111,
-                       114,105,103,105,110,97,108,95,115,116,114,105,110,103,46,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,1748,2061,170,17465,193454822,15926,202,202,32094,69,79,
-                       77,0,1,-3,15,10,2048,2080,170,17465,256499866,16478,202,202,43937,100,101,112,116,104,
-                       0,1,-1,15,10,2065,2100,170,17465,-176597577,16433,202,202,42661,100,58,108,97,115,116,
-                       0,1,2,15,10,2084,2123,170,17465,1574593009,16442,202,202,42850,100,58,108,97,115,116,
-                       46,120,116,0,2049,2100,2049,184,15,10,2104,2151,170,17465,-70242661,16436,202,202,42703,100,
-                       58,108,97,115,116,46,99,108,97,115,115,0,2049,2100,2049,186,15,10,2129,2178,
-                       170,17465,1039459334,16439,202,202,42777,100,58,108,97,115,116,46,110,97,109,101,0,2049,
-                       2100,2049,200,10,2157,2200,170,17465,1040454034,16831,202,202,56405,114,101,99,108,97,115,115,
-                       0,2049,2100,2049,186,16,10,2183,2225,170,17465,178274228,16624,202,202,53007,105,109,109,101,
-                       100,105,97,116,101,0,1,182,2049,2200,10,2206,2244,170,17465,2090176863,16474,202,202,43846,
-                       100,97,116,97,0,1,158,2049,2200,10,2230,2268,170,17465,-1234078178,16823,202,202,56195,112,
-                       114,105,109,105,116,105,118,101,0,1,176,2049,2200,10,2249,2287,182,17465,2090335702,16611,
-                       202,202,52709,104,111,111,107,0,1,1793,2049,132,1,3,15,1,1,17,2049,132,
-                       10,2273,2318,170,17465,234850607,17111,202,202,61830,115,101,116,45,104,111,111,107,0,1,
-                       1,17,16,10,2300,2339,170,17465,550243353,17238,202,202,64310,117,110,104,111,111,107,0,
-                       1,1,17,2,1,1,17,4,16,10,2323,2360,182,17465,177613,15738,202,202,28533,40,
-                       0,10,2349,2372,182,17465,177614,15740,202,202,28578,41,0,10,2361,2394,170,17465,-898142575,16381,
-                       202,202,41049,99,111,109,112,105,108,101,58,108,105,116,0,1,1,2049,132,2049,
-                       132,10,2373,2423,170,17465,426007172,16378,202,202,40980,99,111,109,112,105,108,101,58,106,
-                       117,109,112,0,1,1793,2049,132,2049,132,10,2401,2452,170,17465,425733796,16375,202,202,40911,
-                       99,111,109,112,105,108,101,58,99,97,108,108,0,1,2049,2049,132,2049,132,10,
-                       2430,2480,170,17465,-898136173,16384,202,202,41125,99,111,109,112,105,108,101,58,114,101,116,
-                       0,1,10,2049,132,10,2459,2505,170,17465,-1979274138,16386,202,202,41183,99,111,109,112,105,
-                       108,105,110,103,63,0,1,151,15,10,2485,2526,182,17465,-1801857769,17166,202,202,62572,115,
-                       105,103,105,108,58,96,0,2049,290,2049,132,10,2509,2548,182,17465,-1801857773,17160,202,202,
-                       62493,115,105,103,105,108,58,92,0,2049,488,10,2531,2568,182,17465,-1801857771,17163,202,202,
-                       62533,115,105,103,105,108,58,94,0,2049,482,10,2551,2585,170,17465,2090324905,16606,202,202,
-                       52642,104,101,114,101,0,1,3,15,10,2571,2606,182,17465,-1801857801,17156,202,202,62463,115,
-                       105,103,105,108,58,64,0,2049,260,2049,184,15,2049,2505,1793,2622,1,3841,2049,132,
-                       2049,132,10,1,2615,1793,2628,15,10,1,2626,2049,68,10,2589,2650,182,17465,-1801857832,17130,
-                       202,202,62036,115,105,103,105,108,58,33,0,2049,260,2049,184,15,2049,2505,1793,2666,
-                       1,4097,2049,132,2049,132,10,1,2659,1793,2672,16,10,1,2670,2049,68,10,2633,2695,
-                       170,17465,626189207,16420,202,202,42246,100,58,99,114,101,97,116,101,0,1793,2697,1,158,
-                       1,0,2049,204,2049,2585,2049,2100,2049,184,16,10,2677,2726,170,17465,277702537,17291,202,202,
-                       68065,118,97,114,45,110,0,2049,2695,2049,132,10,2711,2744,170,17465,193508814,17288,202,202,
-                       68012,118,97,114,0,134284289,0,2726,10,2731,2763,170,17465,255671116,16394,202,202,41292,99,111,
-                       110,115,116,0,2049,2695,2049,2100,2049,184,16,10,2748,2785,176,17465,2090773084,17231,202,202,
-                       64248,116,117,99,107,0,100926722,10,2771,2801,176,17465,2090594561,16806,202,202,56073,111,118,101,
-                       114,0,67502597,10,2787,2816,176,17465,193500364,16788,202,202,55911,110,105,112,0,772,10,2803,
-                       2837,176,17465,288947475,16492,202,202,44230,100,114,111,112,45,112,97,105,114,0,771,10,
-                       2818,2853,176,17465,2088850509,15798,202,202,29497,63,100,117,112,0,6402,10,2839,2873,170,17465,
-                       -59285433,16503,202,202,44339,100,117,112,45,112,97,105,114,0,67502597,67502597,10,2855,2889,170,
-                       17465,193489474,16481,202,202,43978,100,105,112,0,525572,6,10,2876,2905,170,17465,193505809,17172,202,
-                       202,62622,115,105,112,0,67502597,1,27,2049,2889,10,2892,2923,170,17465,5863248,16175,202,202,
-                       37154,98,105,0,1,2905,2049,2889,8,10,2911,2942,170,17465,193487226,16181,202,202,37213,98,
-                       105,42,0,1,2889,2049,2889,8,10,2929,2961,170,17465,193487248,16188,202,202,37252,98,105,
-                       64,0,2,2049,2942,10,2948,2978,170,17465,193507188,17208,202,202,64047,116,114,105,0,1793,
-                       2987,1,2905,2049,2889,2049,2905,10,1,2980,2049,2889,8,10,2965,3007,170,17465,2090769950,17215,
-                       202,202,64138,116,114,105,42,0,1793,3024,1793,3017,4,1,2889,2049,2889,10,1,3011,
-                       2049,2889,2049,2889,10,1,3009,2049,2889,8,10,2993,3044,170,17465,2090769972,17224,202,202,64190,
-                       116,114,105,64,0,2,2,2049,3007,10,3030,3064,170,17465,279132286,17317,202,202,68618,119,
-                       104,105,108,101,0,1793,3073,525570,1639430,3,1,3066,7,10,1,3066,8,3,10,3049,
-                       3093,170,17465,276987953,17248,202,202,67053,117,110,116,105,108,0,1793,3104,525570,385942534,-1,25,
-                       3,1,3095,7,10,1,3095,8,3,10,3078,3126,170,17465,-1163346114,16572,202,202,52021,102,
-                       111,114,101,118,101,114,0,1793,3130,8,10,1,3128,2049,2905,1,3126,7,10,3109,
-                       3153,170,17465,275614599,17204,202,202,63992,116,105,109,101,115,0,1793,3165,4,25,33886721,1,
-                       2053,1542,1,3156,7,10,1,3155,8,3,10,3138,3187,182,17465,-1801857741,17169,202,202,62601,
-                       115,105,103,105,108,58,124,0,2049,260,1793,3195,2049,184,15,10,1,3191,1793,3203,
-                       2049,186,15,10,1,3199,2049,2923,2049,2505,1793,3218,1,158,2049,2889,2049,2452,10,1,
-                       3211,1,27,2049,68,10,3170,3239,170,17465,2089584485,15962,202,202,33206,84,82,85,69,0,
-                       1,-1,10,3225,3257,170,17465,219588176,15929,202,202,32149,70,65,76,83,69,0,1,0,
-                       10,3242,3274,170,17465,2090140897,16322,202,202,39373,99,97,115,101,0,1793,3279,67502597,11,10,
-                       1,3276,2049,2889,4,1793,3291,772,8,2049,3239,10,1,3286,1793,3299,3,2049,3257,10,
-                       1,3295,2049,68,25,6,3,3,10,3260,3324,170,17465,410109870,16888,202,202,57247,115,58,
-                       99,97,115,101,0,1793,3330,67502597,2049,120,10,1,3326,2049,2889,4,1793,3342,772,8,
-                       2049,3239,10,1,3337,1793,3350,3,2049,3257,10,1,3346,2049,68,25,6,3,3,10,
-                       3308,3372,170,17465,193500566,16795,202,202,55969,110,111,116,0,1,-1,23,10,3359,3391,170,
-                       17465,266514170,16655,202,202,54323,108,116,101,113,63,0,2049,2873,101516555,22,10,3376,3411,170,
-                       17465,260584565,16583,202,202,52206,103,116,101,113,63,0,4,2049,3391,10,3396,3430,170,17465,
-                       266773971,16669,202,202,54516,110,58,77,65,88,0,1,-5,15,10,3415,3449,170,17465,266774225,
-                       16672,202,202,54566,110,58,77,73,78,0,1,-4,15,10,3434,3470,170,17465,-1486229492,16784,
-                       202,202,55856,110,58,122,101,114,111,63,0,1,0,11,10,3453,3492,170,17465,-494948871,
-                       16665,202,202,54457,110,58,45,122,101,114,111,63,0,1,0,12,10,3474,3517,170,
-                       17465,1249353375,16743,202,202,55354,110,58,110,101,103,97,116,105,118,101,63,0,1,0,
-                       13,10,3496,3542,170,17465,476508031,16751,202,202,55461,110,58,112,111,115,105,116,105,118,
-                       101,63,0,1,-1,14,10,3521,3576,170,17465,-1782398742,16771,202,202,55656,110,58,115,116,
-                       114,105,99,116,108,121,45,112,111,115,105,116,105,118,101,63,0,1,0,14,
-                       10,3546,3597,170,17465,-1510537094,16705,202,202,54979,110,58,101,118,101,110,63,0,1,2,
-                       20,3,2049,3470,10,3580,3620,170,17465,214866883,16747,202,202,55410,110,58,111,100,100,63,
-                       0,2049,3597,2049,3372,10,3604,3638,170,17465,193494767,16620,202,202,52933,105,102,59,0,67502597,
-                       1,78,2049,2889,25,6,771,10,3625,3661,170,17465,2088208540,15771,202,202,29139,45,105,102,
-                       59,0,67502597,1,76,2049,2889,2049,3372,25,6,771,10,3647,3685,176,17465,193504922,16849,202,
-                       202,56593,114,111,116,0,67503109,10,3672,3702,170,17465,266813635,16755,202,202,55517,110,58,112,
-                       111,119,0,1,1,4,1793,3710,67502597,19,10,1,3707,2049,3153,772,10,3687,3734,170,
-                       17465,2024000897,16739,202,202,55325,110,58,110,101,103,97,116,101,0,1,-1,19,10,3716,
-                       3756,170,17465,-2060555330,16767,202,202,55625,110,58,115,113,117,97,114,101,0,4866,10,3738,
-                       3774,170,17465,215025303,16763,202,202,55589,110,58,115,113,114,116,0,1,1,1793,3792,2049,
-                       2873,167969812,67502597,18,1,2,167969812,25,17,1,3778,7,10,1,3778,8,772,10,3758,3812,
-                       170,17465,266810161,16724,202,202,55203,110,58,109,105,110,0,2049,2873,13,1793,3819,3,10,
-                       1,3817,1793,3825,772,10,1,3823,2049,68,10,3797,3845,170,17465,266809907,16719,202,202,55169,
-                       110,58,109,97,120,0,2049,2873,14,1793,3852,3,10,1,3850,1793,3858,772,10,1,
-                       3856,2049,68,10,3830,3878,170,17465,266796867,16675,202,202,54616,110,58,97,98,115,0,2,
-                       2049,3517,1,3734,9,10,3863,3902,170,17465,-1502694228,16713,202,202,55051,110,58,108,105,109,
-                       105,116,0,4,5,2049,3812,6,2049,3845,10,3885,3925,170,17465,266805959,16709,202,202,55031,
-                       110,58,105,110,99,0,659713,1,10,3910,3943,170,17465,266800217,16690,202,202,54819,110,58,
-                       100,101,99,0,659969,1,10,3928,3966,170,17465,1032861494,16684,202,202,54695,110,58,98,101,
-                       116,119,101,101,110,63,0,67503109,1793,3974,67503109,67503109,2049,3902,10,1,3969,2049,2905,11,
-                       10,3946,4000,170,17465,-38720901,17120,202,202,61987,115,104,105,102,116,45,108,101,102,116,
-                       0,2049,3734,24,10,3980,4025,170,17465,-1270529650,17125,202,202,62011,115,104,105,102,116,45,
-                       114,105,103,104,116,0,24,10,4004,4046,170,17465,-2130983749,15956,202,202,33091,83,99,111,
-                       112,101,76,105,115,116,0,71585,72228,10,4027,4061,170,17465,5864091,17331,202,202,68951,123,
-                       123,0,2049,2100,2,1,4046,2049,63,16,10,4049,4092,170,17465,-1644352334,15760,202,202,28936,
-                       45,45,45,114,101,118,101,97,108,45,45,45,0,2049,2100,1,4046,2049,3925,16,
-                       10,4070,4112,170,17465,5864159,17336,202,202,69045,125,125,0,1,4046,2049,60,4,15,11,
-                       1793,4126,3841,4046,4097,2,10,1,4121,1793,4152,3841,4046,1793,4147,1,2,983567,1,4046,
-                       2049,3925,1641487,3,1,4136,7,10,1,4134,8,16,10,1,4130,2049,68,10,4100,4171,
-                       170,0,0,0,202,202,0,66,121,116,101,0,10,4157,4191,170,0,0,0,202,
-                       202,0,98,121,116,101,45,109,97,115,107,0,1,255,4,1,8,19,2,1793,
-                       4205,2049,3734,24,21,10,1,4200,2049,2889,24,10,4172,4228,170,0,0,0,202,202,
-                       0,114,101,112,108,97,99,101,0,1,0,1793,4257,1793,4252,1793,4247,1793,4242,3,
-                       3841,4171,10,1,4238,2049,2889,10,1,4236,2049,2889,10,1,4234,2049,2889,10,1,4232,
-                       2049,3274,1,1,1793,4283,1793,4278,1793,4273,3,3841,4171,10,1,4269,2049,2889,10,1,
-                       4267,2049,2889,10,1,4265,2049,3274,1,2,1793,4302,1793,4297,3,3841,4171,10,1,4293,
-                       2049,2889,10,1,4291,2049,3274,1,3,1793,4314,3,3841,4171,10,1,4310,2049,3274,3,
-                       10,4100,4347,170,17465,1181794872,16169,202,202,37068,98,58,116,111,45,98,121,116,101,45,
-                       97,100,100,114,101,115,115,0,4865,4,10,4320,4367,170,17465,172307467,16151,202,202,36727,
-                       98,58,102,101,116,99,104,0,267265,4,134288385,4,3685,266001,2049,4191,10,4350,4393,170,
-                       17465,188258542,16160,202,202,36910,98,58,115,116,111,114,101,0,1048836,4171,267265,4,1793,4402,
-                       134287106,80,10,1,4399,2049,2889,2049,4228,2049,94,4,16,10,4376,4430,170,17465,-668819311,16588,
-                       202,202,52299,104,58,102,101,116,99,104,0,1,4367,1793,4442,2049,3925,2049,4367,1,
-                       -8,24,10,1,4434,2049,2923,22,10,4413,4465,170,17465,-652868236,16597,202,202,52483,104,58,
-                       115,116,111,114,101,0,2049,2873,102039813,255,2049,4393,2049,3925,18350341,8,255,117507605,4393,10,
-                       4448,4496,170,17465,1523331040,17299,202,202,68169,119,58,102,101,116,99,104,0,1,4,167969812,
-                       15,10,4479,4518,170,17465,1539282115,17308,202,202,68406,119,58,115,116,111,114,101,0,1,
-                       4,167969812,16,10,4501,4545,170,17465,-1431209524,17303,202,202,68317,119,58,102,101,116,99,104,
-                       45,110,101,120,116,0,2,1,4,17,4,2049,4496,10,4523,4575,170,17465,-865140451,16592,
-                       202,202,52394,104,58,102,101,116,99,104,45,110,101,120,116,0,2,1,2,17,
-                       4,2049,4430,10,4553,4605,170,17465,-1497706281,16155,202,202,36821,98,58,102,101,116,99,104,
-                       45,110,101,120,116,0,2,1,1,17,4,2049,4367,10,4583,4635,170,17465,-1863949169,17312,
-                       202,202,68548,119,58,115,116,111,114,101,45,110,101,120,116,0,2,1,4,17,
-                       1,4518,2049,2889,10,4613,4666,170,17465,-1297880096,16601,202,202,52572,104,58,115,116,111,114,
-                       101,45,110,101,120,116,0,2,1,2,17,1,4465,2049,2889,10,4644,4697,170,17465,
-                       -1930445926,16164,202,202,36998,98,58,115,116,111,114,101,45,110,101,120,116,0,2,1,
-                       1,17,1,4393,2049,2889,10,4675,4724,170,17465,-811043593,17265,202,202,67430,118,58,105,110,
-                       99,45,98,121,0,286196994,659462,10,4706,4745,170,17465,-1017393847,17258,202,202,67296,118,58,100,
-                       101,99,45,98,121,0,68093186,168822290,10,4727,4763,170,17465,276293327,17262,202,202,67372,118,58,
-                       105,110,99,0,1,1,4,2049,4724,10,4748,4784,170,17465,276287585,17255,202,202,67238,118,
-                       58,100,101,99,0,1,1,4,2049,4745,10,4769,4807,170,17465,239114932,17269,202,202,67506,
-                       118,58,108,105,109,105,116,0,251790597,1542,2049,3902,4100,10,4790,4827,170,17465,2090781106,17277,
-                       202,202,67702,118,58,111,110,0,2049,3239,4100,10,4813,4846,170,17465,276299600,17274,202,202,
-                       67681,118,58,111,102,102,0,2049,3257,4100,10,4831,4865,170,17465,253189153,16143,202,202,36606,
-                       97,108,108,111,116,0,1,3,2049,4724,10,4850,4890,170,17465,250474337,17280,202,202,67724,
-                       118,58,112,114,101,115,101,114,118,101,0,84869636,1,27,2049,2889,1049606,10,4870,4915,
-                       170,17465,-338953896,17284,202,202,67855,118,58,117,112,100,97,116,101,0,4,1793,4922,15,
-                       4,8,10,1,4918,2049,2905,16,10,4897,4942,170,17465,2090156064,16398,202,202,41341,99,111,
-                       112,121,0,1793,4951,285278725,1,33951492,268767489,1,6,10,1,4944,2049,3153,771,10,4928,4972,
-                       158,0,0,0,202,202,0,115,116,97,114,116,0,0,10,4957,4987,158,0,0,
-                       0,202,202,0,101,110,100,0,0,10,4974,5008,170,0,0,0,202,202,0,116,
-                       101,114,109,105,110,97,116,101,0,1,0,3841,4987,16,10,4928,5036,170,17465,470531271,
-                       16216,202,202,37953,98,117,102,102,101,114,58,115,116,97,114,116,0,3841,4972,10,
-                       5014,5059,170,17465,-1068395248,16201,202,202,37682,98,117,102,102,101,114,58,101,110,100,0,
-                       3841,4987,10,5039,5082,170,17465,-1068399934,16196,202,202,37600,98,117,102,102,101,114,58,97,
-                       100,100,0,3841,4987,16,1,4987,2049,4763,2049,5008,10,5062,5112,170,17465,-1068393351,16204,202,
-                       202,37740,98,117,102,102,101,114,58,103,101,116,0,1,4987,2049,4784,3841,4987,15,
-                       2049,5008,10,5092,5144,170,17465,453693224,16199,202,202,37638,98,117,102,102,101,114,58,101,
-                       109,112,116,121,0,3841,4972,4097,4987,2049,5008,10,5122,5172,170,17465,-896806316,16213,202,202,
-                       37911,98,117,102,102,101,114,58,115,105,122,101,0,3841,4987,3841,4972,18,10,5151,
-                       5198,170,17465,-1068380283,16210,202,202,37871,98,117,102,102,101,114,58,115,101,116,0,4097,
-                       4972,2049,5144,10,5178,5228,170,17465,-1235887835,16207,202,202,37787,98,117,102,102,101,114,58,
-                       112,114,101,115,101,114,118,101,0,3841,4972,3841,4987,1793,5241,1,27,2049,2889,4097,
-                       4972,10,1,5234,2049,2889,4097,4987,10,5203,5283,170,0,1528938663,0,202,202,0,84,69,
-                       77,80,45,83,84,82,73,78,71,45,68,69,70,65,85,76,84,45,67,79,
-                       85,78,84,0,1,32,10,5248,5324,170,0,-1160190388,0,202,202,0,84,69,77,80,
-                       45,83,84,82,73,78,71,45,68,69,70,65,85,76,84,45,67,65,80,65,
-                       67,73,84,89,0,1,512,10,5286,5360,170,0,1457553966,0,202,202,0,83,84,82,
-                       73,78,71,45,84,69,82,77,73,78,65,84,79,82,45,67,69,76,76,83,
-                       0,1,1,10,5327,5398,170,0,-205363849,0,202,202,0,67,85,82,82,69,78,84,
-                       45,76,73,78,69,45,83,84,82,73,78,71,45,67,79,85,78,84,0,1,
-                       2,10,5363,5422,158,17465,1204567429,15968,202,202,33320,84,101,109,112,83,116,114,105,110,
-                       103,115,0,32,5401,5446,158,17465,1808866840,15965,202,202,33262,84,101,109,112,83,116,114,
-                       105,110,103,77,97,120,0,512,5423,5464,170,17465,-1027089649,15953,202,202,32948,83,84,82,
-                       73,78,71,83,0,2049,2061,3841,5422,3841,5446,2049,5360,17,19,18,10,5447,5497,170,
-                       17465,-1748767096,15709,202,202,33369,115,58,111,118,101,114,115,105,122,101,63,0,2049,106,
-                       3841,5446,2049,3943,14,10,5476,5525,170,17465,-657703496,15705,202,202,33442,115,58,116,114,117,
-                       110,99,97,116,101,0,2,2049,5497,1793,5538,1,0,67502597,3841,5446,17,16,10,1,
-                       5530,9,10,5505,5559,158,0,0,0,202,202,0,67,117,114,114,101,110,116,0,
-                       5,10,5542,5580,170,0,0,0,202,202,0,115,58,112,111,105,110,116,101,114,
-                       0,3841,5559,3841,5446,2049,5360,17,19,2049,5464,17,10,5561,5608,170,0,0,0,202,
-                       202,0,115,58,110,101,120,116,0,1,5559,2049,4763,3841,5559,3841,5422,11,1793,5624,
-                       1,0,4097,5559,10,1,5619,9,10,5505,5644,170,17465,410724968,17069,202,202,60346,115,58,
-                       116,101,109,112,0,2049,5525,2,2049,106,2049,3925,2049,5580,4,2049,4942,2049,5580,2049,
-                       5608,10,5628,5678,170,17465,651524257,16942,202,202,58151,115,58,101,109,112,116,121,0,2049,
-                       5580,2049,5608,1,0,67502597,16,10,5661,5703,170,17465,410695433,17044,202,202,59792,115,58,115,
-                       107,105,112,0,6,1793,5711,68223234,1,786703,0,10,1,5706,2049,3064,2049,3943,5,10,
-                       5687,5735,170,17465,410401271,16997,202,202,59089,115,58,107,101,101,112,0,2049,2505,1793,5744,
-                       1,5703,2049,2452,10,1,5739,9,2049,2585,1,146,2049,2889,2049,158,10,5719,5773,182,
-                       0,-1801857826,0,202,202,0,115,105,103,105,108,58,39,0,2049,2505,1,5735,1,5644,
-                       2049,68,10,5756,5799,170,17465,652426460,16959,202,202,58367,115,58,102,101,116,99,104,0,
-                       17,15,10,5782,5819,170,17465,668377535,17058,202,202,60152,115,58,115,116,111,114,101,0,
-                       17,16,10,5802,5838,170,17465,410117372,16902,202,202,57396,115,58,99,104,111,112,0,2049,
-                       5644,2,2049,106,67502597,17,2049,3943,1,0,4,16,10,5822,5871,170,17465,143016046,17035,202,
-                       202,59640,115,58,114,101,118,101,114,115,101,0,1793,5913,2,2049,5644,2049,5198,1,
-                       106,1793,5889,2,2049,106,17,2049,3943,10,1,5882,2049,2923,4,1793,5903,2,15,2049,
-                       5082,2049,3943,10,1,5896,2049,3153,3,2049,5036,2049,5644,10,1,5873,2049,5228,10,5852,
-                       5937,170,17465,-1950939456,17015,202,202,59478,115,58,112,114,101,112,101,110,100,0,2049,5644,
-                       1793,5980,2049,2873,1,106,2049,2961,17,3841,5446,14,1,2837,1793,5975,2,2049,106,17,
-                       1793,5967,2,2049,106,2049,3925,10,1,5961,2049,2889,4,2049,4942,10,1,5955,2049,68,
-                       10,1,5941,2049,2905,10,5918,6003,170,17465,-127536406,16878,202,202,57137,115,58,97,112,112,
-                       101,110,100,0,4,2049,5937,10,5985,6027,170,17465,-89307369,16969,202,202,58596,115,58,102,
-                       111,114,45,101,97,99,104,0,1793,6042,67502597,6415,3,67502597,67502597,251987205,2054,101777670,1,1,
-                       6029,7,10,1,6029,8,771,10,6007,6069,170,17465,111909079,16987,202,202,58886,115,58,105,
-                       110,100,101,120,47,99,104,97,114,0,4,1793,6092,2049,60,25,4,1793,6081,67502597,
-                       12,10,1,6078,2049,2889,4,25,3,1,6072,7,10,1,6072,1793,6101,18,2049,3943,
-                       772,10,1,6096,1793,6110,2049,106,67502597,11,10,1,6105,2049,2978,1793,6120,3,1,-1,
-                       10,1,6116,9,10,6047,6150,170,17465,-552286499,16910,202,202,57570,115,58,99,111,110,116,
-                       97,105,110,115,47,99,104,97,114,63,0,2049,6069,1,-1,12,10,6124,5381,158,
-                       0,-1248927149,0,202,202,0,72,65,83,72,58,68,74,66,50,45,83,69,69,68,
-                       0,6156,33,158,0,736462553,0,202,202,0,72,65,83,72,58,68,74,66,50,45,
-                       77,85,76,84,73,80,76,73,69,82,0,6180,6226,170,17465,410289558,16983,202,202,58819,
-                       115,58,104,97,115,104,0,1,5381,4,1793,6237,4,1,33,19,17,10,1,6231,
-                       2049,6027,10,6210,6255,158,0,0,0,202,202,0,83,116,114,0,0,6242,6273,170,
-                       0,0,0,202,202,0,101,120,116,114,97,99,116,0,2049,2873,3841,6255,4,2049,
-                       4942,3841,6255,67502597,17,1,0,4,16,10,6256,6304,170,0,0,0,202,202,0,99,
-                       104,101,99,107,0,1,6273,2049,2889,1793,6315,1,3925,2049,2889,10,1,6310,2049,2889,
-                       3841,6255,2049,6226,67502597,11,10,6289,6344,170,0,0,0,202,202,0,108,111,99,97,
-                       116,105,111,110,0,67503109,67503109,1793,6377,1793,6372,4,1793,6358,67502597,2049,3470,21,10,1,
-                       6353,2049,2889,4,1793,6368,772,2,10,1,6365,9,10,1,6350,2049,2889,10,1,6348,
-                       2049,2889,10,6326,6397,170,0,0,0,202,202,0,115,101,116,117,112,0,2049,5678,
-                       4097,6255,1,0,67503109,67503109,1,106,1,6226,2049,2923,1793,6417,67502597,2049,106,10,1,6413,
-                       2049,2889,4,10,6210,6447,170,17465,-2044062352,16992,202,202,58970,115,58,105,110,100,101,120,
-                       47,115,116,114,105,110,103,0,67502597,1793,6466,2049,6397,1793,6459,2049,6304,2049,6344,10,
-                       1,6454,2049,3153,771,3,10,1,6450,2049,2889,18,1,2,18,1,-1,2049,3845,10,
-                       6423,6492,158,0,0,0,202,202,0,83,114,99,0,0,6479,6506,158,0,0,0,
-                       202,202,0,84,97,114,0,0,6493,6520,158,0,0,0,202,202,0,80,97,100,
-                       0,0,6507,6532,158,0,0,0,202,202,0,73,0,0,6521,6544,158,0,0,0,
-                       202,202,0,70,0,0,6533,6557,158,0,0,0,202,202,0,65,116,0,0,6545,
-                       6577,170,0,0,0,202,202,0,116,101,114,109,105,110,97,116,101,0,1,0,
-                       3841,6520,3841,6506,2049,106,17,16,10,6558,6605,170,0,0,0,202,202,0,101,120,
-                       116,114,97,99,116,0,3841,6492,3841,6532,17,3841,6520,3841,6506,2049,106,2049,4942,10,
-                       6588,6636,170,0,0,0,202,202,0,99,111,109,112,97,114,101,0,3841,6520,3841,
-                       6506,2049,120,3841,6544,22,4097,6544,3841,6544,1793,6656,3841,6532,4097,6557,10,1,6651,2049,
-                       76,10,6619,6675,170,0,0,0,202,202,0,110,101,120,116,0,1,6532,2049,4763,
-                       10,6423,6708,170,17465,-466408362,16915,202,202,57648,115,58,99,111,110,116,97,105,110,115,
-                       47,115,116,114,105,110,103,63,0,4097,6506,4097,6492,2049,5678,4097,6520,1,0,4097,
-                       6532,1,0,4097,6544,3841,6492,2049,106,1793,6739,2049,6605,2049,6577,2049,6636,2049,6675,10,
-                       1,6730,2049,3153,3841,6544,10,6680,6764,170,17465,59711416,16964,202,202,58438,115,58,102,105,
-                       108,116,101,114,0,67502597,2049,5497,1793,6774,1,5525,2049,2889,10,1,6769,9,1793,6805,
-                       2049,5678,2049,5198,4,1793,6797,2049,2873,4,8,1,5082,1,17,2049,68,10,1,6786,
-                       2049,6027,3,2049,5036,10,1,6779,2049,5228,10,6746,6825,170,17465,272739504,17010,202,202,59315,
-                       115,58,109,97,112,0,1793,6847,2049,5678,2049,5198,4,1793,6839,67502597,8,2049,5082,10,
-                       1,6834,2049,6027,3,2049,5036,10,1,6827,2049,5228,10,6810,6870,170,17465,582342613,17063,202,
-                       202,60216,115,58,115,117,98,115,116,114,0,1793,6876,17,2049,5678,10,1,6872,2049,
-                       2889,1793,6888,67502597,1,4942,2049,2889,10,1,6882,2049,2905,67502597,1793,6901,17,1,0,4,
-                       16,10,1,6895,2049,2889,10,6852,6923,170,17465,666787280,17039,202,202,59691,115,58,114,105,
-                       103,104,116,0,67502597,2049,106,67502597,18,4,2049,6870,10,6906,6948,170,17465,410437245,17001,202,
-                       202,59159,115,58,108,101,102,116,0,1,0,4,2049,6870,10,6932,6978,170,17465,-232792494,
-                       16883,202,202,57190,115,58,98,101,103,105,110,115,45,119,105,116,104,63,0,2,
-                       2049,106,1,19,2049,2889,2049,6948,2049,120,10,6954,7012,170,17465,-2108153340,16945,202,202,58175,
-                       115,58,101,110,100,115,45,119,105,116,104,63,0,2,2049,106,1,19,2049,2889,
-                       2049,6923,2049,120,10,6990,7040,170,17465,410125037,16920,202,202,57736,115,58,99,111,112,121,
-                       0,67502597,2049,106,2049,3925,2049,4942,10,7024,7066,170,17465,-1310218506,16869,202,202,56933,115,58,
-                       68,73,71,73,84,83,0,2049,5703,48,49,50,51,52,53,54,55,56,57,65,
-                       66,67,68,69,70,0,1,7068,10,7048,7115,170,17465,-1545673491,16863,202,202,56811,115,58,
-                       65,83,67,73,73,45,76,79,87,69,82,67,65,83,69,0,2049,5703,97,98,
-                       99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,
-                       119,120,121,122,0,1,7117,10,7088,7174,170,17465,-1918301808,16866,202,202,56872,115,58,65,
-                       83,67,73,73,45,85,80,80,69,82,67,65,83,69,0,2049,5703,65,66,67,
-                       68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,
-                       88,89,90,0,1,7176,10,7147,7231,170,17465,-1283195573,16860,202,202,56740,115,58,65,83,
-                       67,73,73,45,76,69,84,84,69,82,83,0,2049,5703,97,98,99,100,101,102,
-                       103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,
-                       65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,
-                       85,86,87,88,89,90,0,1,7233,10,7206,7312,170,17465,-1868975636,16872,202,202,57003,115,
-                       58,80,85,78,67,84,85,65,84,73,79,78,0,2049,5703,95,33,34,35,36,
-                       37,38,39,40,41,42,43,44,45,46,47,58,59,60,61,62,63,64,91,92,
-                       93,94,96,123,124,125,126,0,1,7314,1,95,67502597,16,10,7289,7376,158,17465,-143759681,
-                       16875,202,202,57070,115,58,87,72,73,84,69,83,80,65,67,69,0,32,9,10,
-                       13,0,7354,7392,182,17465,177612,15735,202,202,28509,39,0,1,5678,2049,170,10,7381,7408,
-                       182,17465,177609,15732,202,202,28487,36,0,1,0,2049,158,10,7397,0,158,17465,-199368937,15879,
-                       202,202,30503,65,83,67,73,73,58,78,85,76,0,7413,27,158,17465,-199378813,15852,202,
-                       202,30134,65,83,67,73,73,58,69,83,67,0,7432,8,158,17465,254259165,15816,202,202,
-                       29642,65,83,67,73,73,58,66,83,0,7451,9,158,17465,254259364,15870,202,202,30380,65,
-                       83,67,73,73,58,72,84,0,7469,10,158,17465,254259482,15873,202,202,30421,65,83,67,
-                       73,73,58,76,70,0,7487,11,158,17465,254259826,15909,202,202,30913,65,83,67,73,73,
-                       58,86,84,0,7505,12,158,17465,254259284,15861,202,202,30257,65,83,67,73,73,58,70,
-                       70,0,7523,13,158,17465,254259197,15822,202,202,29724,65,83,67,73,73,58,67,82,0,
-                       7541,32,158,17465,1936299924,15894,202,202,30708,65,83,67,73,73,58,83,80,65,67,69,
-                       0,7559,127,158,17465,-199380355,15837,202,202,29929,65,83,67,73,73,58,68,69,76,0,
-                       7580,1,158,17465,-199363694,15891,202,202,30667,65,83,67,73,73,58,83,79,72,0,7599,
-                       2,158,17465,-199363513,15897,202,202,30749,65,83,67,73,73,58,83,84,88,0,7618,3,
-                       158,17465,-199378759,15858,202,202,30216,65,83,67,73,73,58,69,84,88,0,7637,4,158,
-                       17465,-199378928,15849,202,202,30093,65,83,67,73,73,58,69,79,84,0,7656,5,158,17465,
-                       -199378964,15846,202,202,30052,65,83,67,73,73,58,69,78,81,0,7675,6,158,17465,-199383689,
-                       15810,202,202,29560,65,83,67,73,73,58,65,67,75,0,7694,7,158,17465,-199382533,15813,
-                       202,202,29601,65,83,67,73,73,58,66,69,76,0,7713,14,158,17465,254259722,15888,202,
-                       202,30626,65,83,67,73,73,58,83,79,0,7732,15,158,17465,254259716,15885,202,202,30585,
-                       65,83,67,73,73,58,83,73,0,7750,16,158,17465,-199380131,15840,202,202,29970,65,83,
-                       67,73,73,58,68,76,69,0,7768,17,158,17465,-199380448,15825,202,202,29765,65,83,67,
-                       73,73,58,68,67,49,0,7787,18,158,17465,-199380447,15828,202,202,29806,65,83,67,73,
-                       73,58,68,67,50,0,7806,19,158,17465,-199380446,15831,202,202,29847,65,83,67,73,73,
-                       58,68,67,51,0,7825,20,158,17465,-199380445,15834,202,202,29888,65,83,67,73,73,58,
-                       68,67,52,0,7844,21,158,17465,-199369598,15876,202,202,30462,65,83,67,73,73,58,78,
-                       65,75,0,7863,22,158,17465,-199363358,15903,202,202,30831,65,83,67,73,73,58,83,89,
-                       78,0,7882,23,158,17465,-199378781,15855,202,202,30175,65,83,67,73,73,58,69,84,66,
-                       0,7901,24,158,17465,-199381574,15819,202,202,29683,65,83,67,73,73,58,67,65,78,0,
-                       7920,25,158,17465,254259258,15843,202,202,30011,65,83,67,73,73,58,69,77,0,7939,26,
-                       158,17465,-199363502,15900,202,202,30790,65,83,67,73,73,58,83,85,66,0,7957,28,158,
-                       17465,254259297,15864,202,202,30298,65,83,67,73,73,58,70,83,0,7976,29,158,17465,254259330,
-                       15867,202,202,30339,65,83,67,73,73,58,71,83,0,7994,30,158,17465,254259693,15882,202,
-                       202,30544,65,83,67,73,73,58,82,83,0,8012,31,158,17465,254259792,15906,202,202,30872,
-                       65,83,67,73,73,58,85,83,0,8030,8070,170,17465,-157167450,16264,202,202,38677,99,58,
-                       108,111,119,101,114,99,97,115,101,63,0,1,97,1,122,2049,3966,10,8048,8099,
-                       170,17465,430999977,16291,202,202,39011,99,58,117,112,112,101,114,99,97,115,101,63,0,
-                       1,65,1,90,2049,3966,10,8077,8125,170,17465,-221932303,16260,202,202,38613,99,58,108,101,
-                       116,116,101,114,63,0,1,8070,1,8099,2049,2923,22,10,8106,8151,170,17465,985961842,16253,
-                       202,202,38515,99,58,100,105,103,105,116,63,0,1,48,1,57,2049,3966,10,8133,
-                       8178,170,17465,-1227520209,16295,202,202,39069,99,58,118,105,115,105,98,108,101,63,0,1,
-                       32,1,126,2049,3966,10,8158,8203,170,17465,1698084814,16299,202,202,39127,99,58,118,111,119,
-                       101,108,63,0,2049,5703,97,101,105,111,117,65,69,73,79,85,0,1,8205,4,
-                       2049,6150,10,8185,8244,170,17465,-1284960908,16249,202,202,38455,99,58,99,111,110,115,111,110,
-                       97,110,116,63,0,2,2049,8125,1793,8254,2049,8203,2049,3372,10,1,8249,1793,8262,3,
-                       2049,3257,10,1,8258,2049,68,10,8222,8290,170,17465,540935182,16303,202,202,39183,99,58,119,
-                       104,105,116,101,115,112,97,99,101,63,0,1,7376,4,2049,6150,10,8267,8319,170,
-                       17465,537650515,16229,202,202,38145,99,58,45,108,111,119,101,114,99,97,115,101,63,0,
-                       2049,8070,2049,3372,10,8296,8347,170,17465,1125817942,16233,202,202,38207,99,58,45,117,112,112,
-                       101,114,99,97,115,101,63,0,2049,8099,2049,3372,10,8324,8371,170,17465,-32679009,16225,202,
-                       202,38077,99,58,45,100,105,103,105,116,63,0,2049,8151,2049,3372,10,8352,8400,170,
-                       17465,1995091547,16245,202,202,38391,99,58,45,119,104,105,116,101,115,112,97,99,101,63,
-                       0,2049,8290,2049,3372,10,8376,8426,170,17465,1869122716,16237,202,202,38269,99,58,45,118,105,
-                       115,105,98,108,101,63,0,2049,8178,2049,3372,10,8405,8450,170,17465,679443963,16241,202,202,
-                       38331,99,58,45,118,111,119,101,108,63,0,2049,8203,2049,3372,10,8431,8478,170,17465,
-                       -590142943,16221,202,202,38013,99,58,45,99,111,110,115,111,110,97,110,116,63,0,2049,
-                       8244,2049,3372,10,8455,8503,170,17465,164041342,16283,202,202,38919,99,58,116,111,45,117,112,
-                       112,101,114,0,2,2049,8070,25,3,1,32,18,10,8483,8532,170,17465,153339739,16271,202,
-                       202,38773,99,58,116,111,45,108,111,119,101,114,0,2,2049,8099,25,3,1,32,
-                       17,10,8512,8562,170,17465,1044946089,16279,202,202,38886,99,58,116,111,45,115,116,114,105,
-                       110,103,0,2049,5703,46,0,1,8564,2049,5644,1,39,2049,2905,10,8541,8598,170,17465,
-                       -1181400147,16287,202,202,38962,99,58,116,111,103,103,108,101,45,99,97,115,101,0,2,
-                       2049,8070,1,8503,1,8532,2049,68,10,8575,8629,170,17465,850267451,16275,202,202,38816,99,58,
-                       116,111,45,110,117,109,98,101,114,0,2,2049,8151,1793,8638,1,48,18,10,1,
-                       8634,1793,8646,3,1,0,10,1,8642,2049,68,10,8608,8671,170,17465,1248863374,17081,202,202,
-                       60547,115,58,116,111,45,117,112,112,101,114,0,1,8503,2049,6825,10,8651,8696,170,
-                       17465,1238161771,17073,202,202,60456,115,58,116,111,45,108,111,119,101,114,0,1,8532,2049,
-                       6825,10,8676,8722,170,17465,1350078662,17099,202,202,60966,115,58,116,114,105,109,45,108,101,
-                       102,116,0,2049,5644,1793,8736,2049,60,1,8290,1,3492,2049,2923,21,10,1,8726,2049,
-                       3064,2049,3943,10,8701,8765,170,17465,1610182969,17103,202,202,61005,115,58,116,114,105,109,45,
-                       114,105,103,104,116,0,2049,5644,2049,5871,2049,8722,2049,5871,10,8743,8790,170,17465,410738990,
-                       17095,202,202,60914,115,58,116,114,105,109,0,2049,8765,2049,8722,10,8774,8823,158,17465,
-                       -1636174316,15950,202,202,32833,82,101,119,114,105,116,101,85,110,100,101,114,115,99,111,
-                       114,101,115,0,-1,8795,8837,170,0,0,0,202,202,0,115,117,98,0,1,95,
-                       1793,8844,1,32,10,1,8841,2049,3274,10,8824,8866,170,0,0,0,202,202,0,114,
-                       101,119,114,105,116,101,0,3841,8823,1793,8875,1,8837,2049,6825,10,1,8870,9,10,
-                       8849,8895,170,0,0,0,202,202,0,104,97,110,100,108,101,0,1,5773,8,10,
-                       8795,8916,182,17465,-1801857826,17146,202,202,62198,115,105,103,105,108,58,39,0,2049,8866,2049,
-                       8895,10,8899,8943,170,17465,-1531896405,17046,202,202,59861,115,58,115,112,108,105,116,47,99,
-                       104,97,114,0,2049,2873,2049,6069,772,2049,2873,2049,6948,1,41,2049,2889,10,8921,8981,
-                       170,17465,-1146871996,17052,202,202,59928,115,58,115,112,108,105,116,47,115,116,114,105,110,
-                       103,0,2049,2873,2049,6447,2049,3925,772,2049,2873,2049,6948,1,41,2049,2889,10,8957,9016,
-                       170,17465,136133038,17023,202,202,59549,115,58,114,101,112,108,97,99,101,0,67502597,2049,106,
-                       2049,2585,16,1793,9032,2049,8981,4,2049,2585,15,17,10,1,9024,2049,2889,2049,5937,2049,
-                       6003,10,8997,9059,158,0,0,0,202,202,0,83,112,108,105,116,45,79,110,0,
-                       0,9041,9076,170,0,0,0,202,202,0,109,97,116,99,104,63,0,3841,9059,11,
-                       10,9060,9099,170,0,0,0,202,202,0,116,101,114,109,105,110,97,116,101,0,
-                       1,0,67502597,2049,3943,16,10,9080,9120,170,0,0,0,202,202,0,115,116,101,112,
-                       0,1,3925,2049,2889,2049,9076,1793,9134,2,2049,132,2049,9099,10,1,9128,9,10,8997,
-                       9158,170,17465,-638763109,17085,202,202,60608,115,58,116,111,107,101,110,105,122,101,0,4097,
-                       9059,2049,5735,2049,2585,1,0,2049,132,1793,9180,2,2049,132,2,1,9120,2049,6027,3,
-                       10,1,9170,2049,2889,2049,2585,67502597,18,2049,3943,67502597,16,10,9138,128,158,0,0,0,
-                       202,202,0,84,79,75,69,78,73,90,69,45,83,84,82,73,78,71,45,67,
-                       65,80,65,67,73,84,89,0,9193,128,158,0,0,0,202,202,0,84,79,75,
-                       69,78,73,90,69,45,82,69,83,85,76,84,45,67,65,80,65,67,73,84,
-                       89,0,9227,9277,158,0,0,0,202,202,0,78,101,101,100,108,101,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,9261,9418,158,0,0,0,202,202,0,76,101,110,0,0,
-                       9405,9435,158,0,0,0,202,202,0,84,111,107,101,110,115,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,9419,9575,158,0,0,0,202,202,0,84,80,0,0,9563,9590,170,
-                       0,0,0,202,202,0,115,97,118,101,0,2049,5735,3841,9575,1,9435,17,2049,3925,
-                       16,1,9575,2049,4763,10,9576,9619,170,0,0,0,202,202,0,110,101,120,116,0,
-                       1793,9625,3841,9418,17,10,1,9621,2049,2905,10,9605,9645,170,0,0,0,202,202,0,
-                       100,111,110,101,63,0,2049,106,2049,3470,10,9138,9680,170,17465,-826994327,17090,202,202,60757,
-                       115,58,116,111,107,101,110,105,122,101,45,111,110,45,115,116,114,105,110,103,
-                       0,1,0,4097,9575,1793,9694,2,1,9277,2049,7040,2049,6003,10,1,9686,1793,9703,2049,
-                       106,4097,9418,10,1,9698,2049,2923,1793,9720,1,9277,2049,8981,2049,9590,2049,9619,2049,9645,
-                       10,1,9709,2049,3093,1,9435,3841,9575,2049,3943,4097,9435,772,10,9650,66,158,0,0,
-                       0,202,202,0,78,85,77,66,69,82,45,83,84,82,73,78,71,45,67,65,
-                       80,65,67,73,84,89,0,9734,9782,158,0,0,0,202,202,0,83,116,114,105,
-                       110,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,9766,9868,170,0,0,0,202,202,0,99,104,
-                       101,99,107,45,115,105,103,110,0,2049,3517,1793,9877,1,45,2049,5082,10,1,9872,
-                       9,10,9848,9899,170,0,0,0,202,202,0,110,45,62,100,105,103,105,116,0,
-                       2049,7066,17,15,10,9881,9921,170,0,0,0,202,202,0,99,111,110,118,101,114,
-                       116,0,1793,9935,3841,267,20,4,2049,9899,2049,5082,2,2049,3470,10,1,9923,2049,3093,
-                       3,10,9650,9971,170,17465,-1041675421,15701,202,202,69602,110,58,116,111,45,115,116,114,105,
-                       110,103,47,114,101,118,101,114,115,101,100,0,1793,9985,1,9782,2049,5198,2,2049,
-                       3878,2049,9921,2049,9868,10,1,9973,2049,5228,1,9782,10,9941,10013,170,17465,-112957836,16780,202,
-                       202,55824,110,58,116,111,45,115,116,114,105,110,103,0,2049,9971,2049,5871,10,9992,
-                       10032,170,0,0,0,202,202,0,99,104,97,114,0,1,32,1793,10041,1,95,2049,
-                       5082,10,1,10036,2049,3274,1,114,1793,10054,1,13,2049,5082,10,1,10049,2049,3274,1,
-                       110,1793,10067,1,10,2049,5082,10,1,10062,2049,3274,1,116,1793,10080,1,9,2049,5082,
-                       10,1,10075,2049,3274,1,48,1793,10093,1,0,2049,5082,10,1,10088,2049,3274,1,94,
-                       1793,10106,1,27,2049,5082,10,1,10101,2049,3274,2049,5082,10,10018,10127,170,0,0,0,
-                       202,202,0,116,121,112,101,0,1,99,1793,10135,4,2049,5082,10,1,10131,2049,3274,
-                       1,115,1793,10149,4,1,5082,2049,6027,10,1,10143,2049,3274,1,110,1793,10165,4,2049,
-                       10013,1,5082,2049,6027,10,1,10157,2049,3274,3,10,10113,10187,170,0,0,0,202,202,
-                       0,104,97,110,100,108,101,0,1,92,1793,10196,2049,60,2049,10032,10,1,10191,2049,
-                       3274,1,37,1793,10209,2049,60,2049,10127,10,1,10204,2049,3274,2049,5082,10,9992,10234,170,
-                       17465,67034811,16973,202,202,58649,115,58,102,111,114,109,97,116,0,1793,10263,2049,5678,1793,
-                       10258,2049,5198,1793,10253,2049,60,25,2049,10187,1,10244,7,10,1,10244,8,3,10,1,
-                       10240,2049,2905,10,1,10236,2049,5228,10,10216,10285,170,17465,649222073,16906,202,202,57459,115,58,
-                       99,111,110,115,116,0,1,5735,2049,2889,2049,2763,10,10268,10308,158,0,0,0,202,
-                       202,0,86,97,108,117,101,115,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10292,10350,170,
-                       0,0,0,202,202,0,102,114,111,109,0,2049,106,2,1793,10368,1793,10361,1,10308,
-                       4113,10,1,10357,2049,2905,2049,3943,10,1,10355,2049,3153,3,10,10336,10386,170,0,0,
-                       0,202,202,0,116,111,0,2,2049,106,1793,10402,2049,60,1,97,18,2049,3925,1,
-                       10308,266001,10,1,10391,2049,3153,3,10,10268,10425,170,17465,1054903512,16834,202,202,56486,114,101,
-                       111,114,100,101,114,0,1,10350,2049,2889,2049,10386,10,10408,10447,170,17465,255891066,16403,202,
-                       202,41881,99,117,114,114,121,0,2049,2585,1793,10457,4,2049,2394,2049,2423,10,1,10451,
-                       2049,2889,10,10432,10476,170,17465,2090191632,16486,202,202,44071,100,111,101,115,0,2049,2123,4,
-                       2049,10447,2049,2100,2049,184,16,1,170,2049,2200,10,10462,10511,170,17465,-1106328024,16423,202,202,
-                       42381,100,58,102,111,114,45,101,97,99,104,0,1,2,1793,10524,6415,2049,2873,134481157,
-                       1542,1,10515,7,10,1,10515,8,3,10,10491,10550,170,17465,-441700234,16453,202,202,43189,100,
-                       58,108,111,111,107,117,112,45,120,116,0,1,0,4,1793,10575,2049,2873,2049,184,
-                       2831,1793,10568,4,1,2816,2049,2889,10,1,10562,1,17,2049,68,10,1,10555,2049,10511,
-                       3,10,10529,10593,170,17465,5863407,16575,202,202,52055,103,99,0,1,3,4,2049,4890,10,
-                       10581,10617,170,17465,1957010690,16084,202,202,35420,97,58,108,101,110,103,116,104,0,15,10,
-                       10599,10637,170,17465,2000526863,16097,202,202,35691,97,58,109,105,100,100,108,101,0,2049,2585,
-                       1793,10660,2,2049,132,1793,10650,2049,3925,17,10,1,10646,2049,2889,2049,2585,4,2049,4942,
-                       10,1,10641,2049,2889,10,10619,10681,170,17465,-293999829,16079,202,202,35346,97,58,108,101,102,
-                       116,0,1,0,4,2049,10637,10,10665,10704,170,17465,-1104799682,16118,202,202,36128,97,58,114,
-                       105,103,104,116,0,67502597,2049,10617,67502597,18,4,2049,10637,10,10687,10740,170,17465,1310034705,16011,
-                       202,202,34128,97,58,99,111,117,110,116,101,100,45,114,101,115,117,108,116,115,
-                       0,8,2049,2585,1793,10753,2,2049,132,1,132,2049,3153,10,1,10745,2049,2889,10,10713,
-                       10781,170,17465,1031007224,16047,202,202,34873,97,58,102,114,111,109,45,115,116,114,105,110,
-                       103,0,2049,2585,1793,10795,2,2049,106,2049,132,1,132,2049,6027,10,1,10785,2049,2889,
-                       10,10758,10820,170,17465,-1309732155,16043,202,202,34822,97,58,102,111,114,45,101,97,99,104,
-                       0,4,2049,60,1,19,2049,2889,1793,10836,5,2049,60,84018692,525572,1542,10,1,10829,2049,
-                       3153,771,10,10800,10857,170,17465,251383785,16015,202,202,34275,97,58,100,117,112,0,2049,2585,
-                       1793,10870,2,15,2049,132,1,132,2049,10820,10,1,10861,2049,2889,10,10842,10891,170,17465,
-                       -294312037,16007,202,202,34086,97,58,99,111,112,121,0,1,3,1793,10907,4097,3,2,2049,
-                       10617,2049,132,1,132,2049,10820,10,1,10895,2049,4890,10,10875,10933,170,17465,865022503,16137,202,
-                       202,36399,97,58,116,111,45,115,116,114,105,110,103,0,1,3,1793,10946,2049,10857,
-                       1,0,2049,132,2049,3925,10,1,10937,2049,4890,2049,5644,10,10912,10971,170,17465,1539635992,15983,
-                       202,202,33738,97,58,97,112,112,101,110,100,0,2049,2873,1,37,2049,2961,17,2049,
-                       2585,1793,10996,2049,132,1793,10991,1,132,2049,10820,10,1,10986,2049,2961,10,1,10982,2049,
-                       2889,10,10953,11020,170,17465,1526142126,16103,202,202,35827,97,58,112,114,101,112,101,110,100,
-                       0,4,2049,10971,10,11001,11040,170,17465,-294319702,15993,202,202,33875,97,58,99,104,111,112,
-                       0,2049,10857,1,-1,2049,4865,2,2049,4784,10,11024,11068,170,17465,1726883814,16034,202,202,34603,
-                       97,58,102,105,108,116,101,114,0,1793,11083,67502597,1,27,2049,2889,4,1,132,1,
-                       17,2049,68,10,1,11070,2049,10447,2049,2585,1793,11098,67502597,15,2049,132,2049,10820,10,1,
-                       11091,2049,2889,2049,2585,67502597,18,2049,3943,67502597,16,10,11050,11132,170,17465,63806334,16002,202,202,
-                       34021,97,58,99,111,110,116,97,105,110,115,63,0,1,0,4,1793,11144,4,5,
-                       67502597,11,6,22,10,1,11137,2049,10820,772,10,11111,11178,170,17465,648332804,15997,202,202,33949,
-                       97,58,99,111,110,116,97,105,110,115,47,115,116,114,105,110,103,63,0,1,
-                       0,4,1793,11191,4,5,67502597,2049,120,6,22,10,1,11183,2049,10820,772,10,11150,11212,
-                       170,17465,251392926,16092,202,202,35583,97,58,109,97,112,0,4,1793,11242,2049,60,1793,11236,
-                       1793,11225,15,67502597,8,10,1,11221,2049,2905,1,39,2049,2905,2049,3925,10,1,11219,2049,
-                       3153,771,10,1,11215,2049,2905,10,11197,11266,170,17465,-674869668,16114,202,202,36059,97,58,114,
-                       101,118,101,114,115,101,0,2049,2585,1793,11300,2049,60,1793,11278,17,2049,3943,10,1,
-                       11274,2049,2905,2,2049,132,1793,11294,2,15,2049,132,2049,3943,10,1,11287,2049,3153,3,
-                       10,1,11270,2049,2889,10,11247,11319,170,17465,2090026588,16132,202,202,36341,97,58,116,104,0,
-                       17,2049,3925,10,11305,11340,170,17465,-1119160502,16029,202,202,34533,97,58,102,101,116,99,104,
-                       0,2049,11319,15,10,11323,11361,170,17465,-1103209427,16123,202,202,36223,97,58,115,116,111,114,
-                       101,0,2049,11319,16,10,11344,11382,170,17465,-1119018392,16039,202,202,34785,97,58,102,105,114,
-                       115,116,0,1,0,2049,11340,10,11365,11403,170,17465,-294003756,16075,202,202,35310,97,58,108,
-                       97,115,116,0,2,2049,10617,2049,3943,2049,11340,10,11387,11429,170,17465,-2103488936,16108,202,202,
-                       35907,97,58,114,101,100,117,99,101,0,1,19,2049,2889,2049,10820,10,11411,12,158,
-                       0,-1582797251,0,202,202,0,84,69,77,80,45,65,82,82,65,89,45,67,79,85,
-                       78,84,0,11436,11476,170,17465,2089080839,15932,202,202,32205,70,82,69,69,0,2049,5464,3841,
-                       5446,2049,5360,17,2049,5398,19,2049,5360,18,3841,5446,2049,5360,17,1,12,19,18,18,
-                       2049,2585,18,10,11462,11522,158,0,0,0,202,202,0,78,101,120,116,65,114,114,
-                       97,121,0,4,11503,11539,170,0,0,0,202,202,0,97,114,114,97,121,115,0,
-                       2049,11476,2049,2585,17,10,11462,11561,170,17465,-293712106,16128,202,202,36276,97,58,116,101,109,
-                       112,0,3841,11522,2,1,12,11,1793,11576,3,1,0,2,4097,11522,10,1,11569,9,
-                       3841,5446,2049,5360,17,19,2049,11539,17,67502597,2049,10617,2049,3925,2049,4942,3841,11522,3841,5446,
-                       2049,5360,17,19,2049,11539,17,1,11522,2049,4763,10,11545,11626,158,0,0,0,202,202,
-                       0,67,111,117,110,116,0,4,11611,11644,170,0,0,0,202,202,0,112,114,101,
-                       112,97,114,101,0,1,0,1,11626,16,10,11627,11667,170,0,0,0,202,202,0,
-                       114,101,115,101,114,118,101,0,4,1,0,2049,132,10,11650,11688,170,0,0,0,
-                       202,202,0,112,97,116,99,104,0,2049,2585,67502597,18,2049,3943,67502597,16,10,11673,11714,
-                       170,0,0,0,202,202,0,99,108,101,97,110,117,112,0,2,2049,11561,4,1,
-                       3,16,10,11697,11738,170,0,0,0,202,202,0,114,101,99,111,114,100,0,3841,
-                       11626,2049,132,10,11722,11762,170,0,0,0,202,202,0,105,116,101,114,97,116,101,
-                       47,110,0,1793,11774,67502597,11,1,11738,9,1,11626,2049,4763,10,1,11764,2049,10820,10,
-                       11743,11798,170,0,0,0,202,202,0,105,116,101,114,97,116,101,47,115,0,1793,
-                       11811,67502597,2049,120,1,11738,9,1,11626,2049,4763,10,1,11800,2049,10820,10,11545,11835,170,
-                       17465,917819423,16065,202,202,35135,97,58,105,110,100,105,99,101,115,0,2049,11644,2049,2585,
-                       1793,11847,2049,11667,2049,11762,3,10,1,11841,2049,2889,2049,11688,2049,11714,10,11816,11882,170,
-                       17465,1942579685,16070,202,202,35227,97,58,105,110,100,105,99,101,115,47,115,116,114,105,
-                       110,103,0,2049,11644,2049,2585,1793,11894,2049,11667,2049,11798,3,10,1,11888,2049,2889,2049,
-                       11688,2049,11714,10,11856,11920,170,17465,-1115296648,16055,202,202,34976,97,58,105,110,100,101,120,
-                       0,1793,11929,2049,11835,1,0,2049,11340,10,1,11922,2049,10593,10,11903,11958,170,17465,1537607710,
-                       16060,202,202,35055,97,58,105,110,100,101,120,47,115,116,114,105,110,103,0,1793,
-                       11967,2049,11882,1,0,2049,11340,10,1,11960,2049,10593,10,11934,11988,170,17465,-293968098,16088,202,
-                       202,35450,97,58,109,97,107,101,0,2049,10740,2,2,1,3,1793,11999,2049,11266,10,
-                       1,11996,2049,4890,4,2049,10891,10,11972,12018,182,17465,177696,17329,202,202,68832,123,0,1,
-                       363,2049,182,1,2080,2049,170,1,363,2049,182,10,12007,12042,182,17465,177698,17333,202,202,
-                       68982,125,0,1,379,2049,182,1,2889,2049,170,1,2080,2049,170,1,19,2049,176,1,
-                       43,2049,176,1,3943,2049,170,1,379,2049,182,1,11988,2049,170,10,12031,12091,170,17465,
-                       -294147516,16051,202,202,34934,97,58,104,97,115,104,0,1,5381,4,1793,12102,4,1,33,
-                       19,17,10,1,12096,2049,10820,10,12075,12122,170,17465,251384693,16024,202,202,34387,97,58,101,
-                       113,63,0,2049,12091,4,2049,12091,11,10,12107,12145,170,17465,-296263550,15978,202,202,33592,97,
-                       58,45,101,113,63,0,2049,12091,4,2049,12091,12,10,12129,12176,170,17465,-946089728,15988,202,
-                       202,33818,97,58,98,101,103,105,110,115,45,119,105,116,104,63,0,1,3,1793,
-                       12192,2,2049,10617,1,19,2049,2889,2049,10681,2049,12122,10,1,12180,2049,4890,10,12152,12219,
-                       170,17465,289116466,16019,202,202,34332,97,58,101,110,100,115,45,119,105,116,104,63,0,
-                       1,3,1793,12235,2,2049,10617,1,19,2049,2889,2049,10704,2049,12122,10,1,12223,2049,4890,
-                       10,12197,12260,158,0,0,0,202,202,0,83,117,98,115,116,105,116,117,116,101,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,12240,12405,170,0,0,0,202,202,0,101,120,
-                       116,114,97,99,116,0,1,12260,2049,7040,10,12388,12427,170,0,0,0,202,202,0,
-                       99,111,109,98,105,110,101,0,1,12260,2049,6003,2049,6003,10,12410,12452,170,0,0,
-                       0,202,202,0,102,105,110,100,45,101,110,100,0,2,2049,106,1,12260,2049,106,
-                       18,67502597,17,10,12434,12478,170,0,0,0,202,202,0,99,108,101,97,110,0,2049,
-                       12452,1,0,4,16,10,12197,12508,170,17465,-495404876,17029,202,202,59597,115,58,114,101,112,
-                       108,97,99,101,45,97,108,108,0,1,3,1793,12531,2049,12405,2049,9680,2049,5678,4,
-                       1793,12524,2049,12427,10,1,12521,2049,10820,2049,12478,10,1,12512,2049,4890,10,12485,12558,170,
-                       0,0,0,202,202,0,99,117,114,114,101,110,116,45,108,105,110,101,0,2049,
-                       5464,3841,5446,2049,5360,17,2049,5398,19,2049,5360,18,10,12536,12594,170,0,0,0,202,
-                       202,0,99,111,117,110,116,45,116,111,107,101,110,115,0,1793,12600,1,32,11,
-                       10,1,12596,2049,6764,2049,106,10,12572,12631,170,0,0,0,202,202,0,112,114,111,
-                       99,101,115,115,45,116,111,107,101,110,115,0,1793,12659,1,32,2049,8943,4,1793,
-                       12652,2,2049,106,2049,3492,1,441,1,17,2049,68,10,1,12640,2049,2889,2049,3925,10,
-                       1,12633,2049,3153,2049,441,10,12485,12686,170,17465,102250697,16955,202,21767,58310,115,58,101,118,
-                       97,108,117,97,116,101,0,2049,12558,2049,7040,2049,12558,2,2049,12594,2049,12631,10,12666,
-                       32,158,0,0,0,202,202,0,73,78,68,69,88,69,68,45,76,79,79,80,
-                       45,77,65,88,73,77,85,77,45,68,69,80,84,72,0,12698,12746,158,0,0,
-                       0,202,202,0,76,80,0,0,12734,12762,158,0,0,0,202,202,0,73,110,100,
-                       101,120,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12747,12808,170,0,0,
-                       0,202,202,0,110,101,120,116,0,3841,12746,1,12762,17,2049,4763,10,12794,12830,170,
-                       0,0,0,202,202,0,112,114,101,112,0,1,12746,2049,4763,1,0,3841,12746,1,
-                       12762,17,16,10,12816,12857,170,0,0,0,202,202,0,100,111,110,101,0,1,12746,
-                       2049,4784,10,12666,12873,170,17465,177646,15938,202,202,32515,73,0,3841,12746,1,12762,17,15,
-                       10,12862,12891,170,17465,177647,15944,202,202,32648,74,0,3841,12746,1,12762,17,2049,3943,15,
-                       10,12880,12911,170,17465,177648,15947,202,202,32738,75,0,3841,12746,1,12762,17,1,2,18,
-                       15,10,12900,12944,170,17465,123652725,16626,202,202,53113,105,110,100,101,120,101,100,45,116,
-                       105,109,101,115,0,2049,12830,4,1793,12960,25,33886721,1,2053,1542,2049,12808,1,12949,7,
-                       10,1,12949,8,3,2049,12857,10,12921,12984,170,17465,139676308,16476,202,202,43914,100,101,99,
-                       105,109,97,108,0,1,10,4097,267,10,12967,13005,170,17465,-199058230,16194,202,202,37299,98,
-                       105,110,97,114,121,0,1,2,4097,267,10,12989,13025,170,17465,269476856,16799,202,202,56002,
-                       111,99,116,97,108,0,1,8,4097,267,10,13010,13043,170,17465,193493706,16609,202,202,52682,
-                       104,101,120,0,1,16,4097,267,10,13030,13063,170,17465,277702542,17295,202,202,68117,118,97,
-                       114,45,115,0,1,5735,2049,2889,2049,2726,10,13048,13092,170,17465,-1648685963,17202,202,202,63945,
-                       116,97,105,108,45,114,101,99,117,114,115,101,0,1,1793,2049,2585,1,3,18,
-                       16,10,13070,13115,170,17465,2090257196,16527,202,202,51389,102,105,108,108,0,1793,13123,2049,2873,
-                       16,2049,3925,10,1,13117,2049,3153,771,10,13101,13151,170,17465,-680426787,16633,202,202,53394,105,
-                       111,58,101,110,117,109,101,114,97,116,101,0,27,10,13129,13171,170,17465,1388174477,16639,
-                       202,202,53470,105,111,58,113,117,101,114,121,0,28,10,13153,13192,170,17465,-1755659805,16636,
-                       202,202,53428,105,111,58,105,110,118,111,107,101,0,29,10,13173,13215,170,17465,-1816911632,
-                       16644,202,202,53549,105,111,58,115,99,97,110,45,102,111,114,0,1,-1,4,2049,
-                       13151,1793,13246,2049,12873,2049,13171,772,67502597,11,1793,13242,1793,13237,3,2049,12873,10,1,13233,
-                       2049,2889,10,1,13231,9,10,1,13222,2049,12944,3,10,13194,13267,170,17465,253768699,16268,202,
-                       202,38735,99,58,112,117,116,0,1793,13269,1,0,2049,13192,10,13252,13286,170,17465,5863647,
-                       16793,202,202,55950,110,108,0,1,10,2049,13267,10,13274,13303,170,17465,5863816,17183,202,202,
-                       63718,115,112,0,1,32,2049,13267,10,13291,13321,170,17465,193506620,17200,202,202,63918,116,97,
-                       98,0,1,9,2049,13267,10,13308,13341,170,17465,272743435,17020,202,202,59531,115,58,112,117,
-                       116,0,1,13267,2049,6027,10,13326,13361,170,17465,266813830,16760,202,202,55547,110,58,112,117,
-                       116,0,2049,9971,2,2049,106,1,41,2049,2905,2049,3925,1793,13381,2,15,2049,13267,2049,
-                       3943,10,1,13374,2049,3153,3,10,13346,13402,170,17465,273105544,16844,202,202,56560,114,101,115,
-                       101,116,0,2049,2080,25,771,1,13402,7,10,13387,13430,170,17465,-1114973730,16496,202,202,44265,
-                       100,117,109,112,45,115,116,97,99,107,0,2049,2080,25,134284547,13430,134283782,13361,2049,13303,
-                       10,13410,13453,170,17465,193470948,15959,202,202,33152,84,73,66,0,1,7,15,10,1793,13496,
-                       2049,5703,69,82,82,79,82,58,32,87,111,114,100,32,78,111,116,32,70,111,
-                       117,110,100,58,32,0,1,13461,2049,13341,2049,13453,2049,13341,2049,13286,10,1,13459,13440,
-                       13513,170,17465,253758370,16257,202,202,38579,99,58,103,101,116,0,1793,13515,1,1,2049,13215,
-                       2049,13192,10,13498,13535,170,17465,193487813,16219,202,202,38001,98,121,101,0,26,10,13522,13555,
-                       158,17465,-606612126,15941,202,202,32598,73,103,110,111,114,105,110,103,0,0,13537,13569,158,
-                       0,0,0,202,202,0,69,79,84,0,0,13556,13587,170,0,0,0,202,202,0,
-                       118,101,114,115,105,111,110,0,3841,4,1,100,20,10,13570,13608,170,0,0,0,
-                       202,202,0,100,111,110,101,63,0,2,4097,13569,1793,13617,1,13,11,10,1,13613,
-                       1793,13625,1,10,11,10,1,13621,1793,13633,1,32,11,10,1,13629,2049,2978,22,22,
-                       10,13593,13654,170,0,0,0,202,202,0,101,111,108,63,0,3841,13569,1793,13662,1,
-                       13,11,10,1,13658,1793,13670,1,10,11,10,1,13666,2049,2923,22,10,13640,13692,170,
-                       0,0,0,202,202,0,118,97,108,105,100,63,0,2,2049,106,2049,3576,10,13676,
-                       13717,170,0,0,0,202,202,0,99,104,101,99,107,45,101,111,102,0,2,1793,
-                       13724,1,-1,11,10,1,13720,1793,13732,1,4,11,10,1,13728,2049,2923,22,1,13535,
-                       9,10,13698,13753,170,0,0,0,202,202,0,98,115,0,2049,5172,1,2,2049,3411,
-                       1793,13765,2049,5112,3,10,1,13761,9,2049,5112,3,10,13741,13790,170,0,0,0,202,
-                       202,0,99,104,101,99,107,45,98,115,0,2,1793,13797,1,8,11,10,1,13793,
-                       1793,13805,1,127,11,10,1,13801,2049,2923,22,1,13753,9,10,13772,13829,170,0,0,
-                       0,202,202,0,99,104,101,99,107,0,2049,13717,2049,13790,10,13814,13853,170,0,0,
-                       0,202,202,0,99,104,97,114,97,99,116,101,114,0,2049,13513,2,2049,5082,10,
-                       13834,13875,170,0,0,0,202,202,0,98,117,102,102,101,114,0,1793,13885,2049,13453,
-                       2049,5198,8,2049,5036,10,1,13877,2049,5228,10,13859,13910,170,0,0,0,202,202,0,
-                       114,101,97,100,45,116,111,107,101,110,0,1793,13926,1793,13921,2049,13853,2049,13829,2049,
-                       13608,10,1,13914,2049,3093,10,1,13912,2049,13875,2049,5838,10,13890,13948,170,0,0,0,
-                       202,202,0,105,110,112,117,116,0,2049,13910,2049,13692,10,13933,13970,170,0,0,0,
-                       202,202,0,112,114,111,99,101,115,115,0,3841,13555,1793,13988,771,2049,13654,1793,13984,
-                       1,13555,2049,4846,10,1,13979,9,10,1,13974,2049,3638,1,441,1,17,2049,68,10,
-                       13537,14019,170,17465,-371381765,16980,202,202,58724,115,58,103,101,116,45,119,111,114,100,0,
-                       1793,14047,1,7,15,2049,5198,1793,14038,2049,13513,2,2049,5082,2049,13790,2049,13608,10,1,
-                       14028,2049,3093,2049,5036,2049,5838,10,1,14021,2049,5228,10,13999,14068,170,17465,-208531877,16173,202,
-                       202,37116,98,97,110,110,101,114,0,2049,13587,2049,5703,82,69,84,82,79,32,49,
-                       50,32,40,37,110,46,37,110,41,92,110,0,1,14072,2049,10234,2049,13341,2049,11476,
-                       2049,2061,2049,11476,18,2049,2061,2049,5703,37,110,32,77,97,120,44,32,37,110,32,
-                       85,115,101,100,44,32,37,110,32,70,114,101,101,92,110,0,1,14108,2049,10234,
-                       2049,13341,10,14052,14158,170,17465,192495636,16648,202,202,54204,108,105,115,116,101,110,0,2049,
-                       14068,2049,13948,2049,13970,1,14160,7,10,14142,14186,170,17465,1197910910,16461,202,202,43377,100,58,
-                       114,101,104,97,115,104,0,1793,14204,1793,14196,2049,200,3841,9,8,10,1,14190,2049,
-                       2905,2049,190,16,10,1,14188,2049,10511,10,14168,13,158,17451,215559733,15912,202,202,30954,66,
-                       85,73,76,68,0,14209,14239,170,14796,255669810,16372,202,202,40741,99,111,109,109,97,0,
-                       2049,132,10,14224,14256,170,14796,2090155992,16389,202,202,41237,99,111,110,115,0,2049,2585,1793,
-                       14266,4,2049,14239,2049,14239,10,1,14260,2049,2889,10,14242,14284,170,14796,193488123,16310,202,202,
-                       39260,99,97,114,0,10,14271,14298,170,14796,193488222,16336,202,202,39537,99,100,114,0,2049,
-                       3925,10,14285,14315,170,14796,2090140827,16318,202,202,39331,99,97,114,64,0,2049,14284,15,10,
-                       14301,14333,170,14796,2090140796,16314,202,202,39299,99,97,114,33,0,2049,14284,16,10,14319,14351,
-                       170,14796,2090144094,16344,202,202,39608,99,100,114,64,0,2049,14298,15,10,14337,14369,170,14796,
-                       2090144063,16340,202,202,39576,99,100,114,33,0,2049,14298,16,10,14355,14386,170,14796,193454780,15924,
-                       202,202,31998,69,78,68,0,10,14373,14407,170,14796,34709361,16536,202,202,51480,102,108,108,
-                       58,99,114,101,97,116,101,0,1,14386,2049,14256,10,14387,14423,158,0,177687,0,202,
-                       202,0,114,0,28274,14387,14444,170,14796,694444964,16563,202,202,51808,102,108,108,58,116,111,
-                       45,101,110,100,0,2,4097,14423,1793,14469,2049,14351,2,1,14386,12,2,1793,14462,67502597,
-                       4097,14423,10,1,14458,1,2816,2049,68,10,1,14449,2049,3064,3841,14423,10,14424,14502,170,
-                       14796,577969665,16532,202,202,51450,102,108,108,58,97,112,112,101,110,100,47,118,97,108,
-                       117,101,0,1,14386,2049,14256,4,2049,14444,2049,14369,10,14476,14534,170,14796,341068837,16567,202,
-                       202,51875,102,108,108,58,116,111,45,105,110,100,101,120,0,1,14351,2049,3153,10,
-                       14512,14556,170,14796,-1289432718,16540,202,202,51548,102,108,108,58,100,101,108,0,2049,2873,2049,
-                       3943,2049,14534,1793,14569,2049,3925,2049,14534,10,1,14564,2049,2889,2049,14369,10,14539,14592,158,
-                       0,-1497417501,0,202,202,0,65,99,116,105,111,110,0,14992,14539,14615,170,14796,-982785918,16547,
-                       202,202,51621,102,108,108,58,102,111,114,45,101,97,99,104,0,4097,14592,1793,14638,
-                       1793,14627,2049,14315,3841,14592,8,10,1,14621,2049,2905,2049,14351,2,1,14386,12,10,1,
-                       14619,2049,3064,3,10,14593,14664,170,14796,371840895,16556,202,202,51736,102,108,108,58,108,101,
-                       110,103,116,104,0,1,0,4,1793,14673,3,2049,3925,10,1,14669,2049,14615,2049,3943,
-                       10,14644,14698,170,14796,398407634,16544,202,202,51587,102,108,108,58,100,114,111,112,0,2,
-                       2049,14664,2049,3943,2049,14534,1,14386,4,2049,14369,10,14680,14722,158,0,177678,0,202,202,
-                       0,105,0,0,14680,14743,170,14796,264961530,16551,202,202,51667,102,108,108,58,105,110,106,
-                       101,99,116,0,2049,14407,4097,14722,2049,2873,2049,3943,2049,14534,1,14534,2049,2889,3841,14722,
-                       4,2049,14369,3841,14722,2049,14369,10,14723,14784,170,14796,-1289419114,16560,202,202,51765,102,108,108,
-                       58,112,117,116,0,1793,14791,2049,13361,2049,13303,10,1,14786,2049,14615,10,105,110,116,
-                       101,114,102,97,99,101,47,108,108,46,114,101,116,114,111,0,105,110,105,116,
-                       0,14815,15089,14767,14844,158,15067,-1761629780,16928,202,202,57878,115,58,100,101,100,117,112,46,
-                       100,97,116,97,0,14820,14822,14857,158,0,5863786,0,202,202,0,116,49,0,523262,14845,
-                       14870,158,0,5863787,0,202,202,0,116,50,0,28456,14822,14897,170,15067,-19532457,16939,202,202,
-                       58111,115,58,100,101,100,117,112,46,114,101,103,105,115,116,101,114,0,2049,5735,
-                       3841,14844,4,1,14502,2049,2905,10,14871,14933,170,15067,283388512,16931,202,202,57931,115,58,100,
-                       101,100,117,112,46,100,101,102,105,110,101,100,63,0,4097,14857,1,0,4097,14870,
-                       3841,14844,1793,14953,3841,14857,2049,120,3841,14870,22,4097,14870,10,1,14943,2049,14615,3841,14870,
-                       10,14907,14982,170,15067,-1761549389,16935,202,202,57986,115,58,100,101,100,117,112,46,102,105,
-                       110,100,0,4097,14857,1,0,4097,14870,3841,14844,1793,15009,2,3841,14857,2049,120,1793,15002,
-                       4097,14870,10,1,14999,1,17,2049,68,10,1,14992,2049,14615,3841,14870,10,14960,15033,170,
-                       15067,650037796,16924,202,202,57833,115,58,100,101,100,117,112,0,2049,5644,2,2049,14933,1,
-                       14982,1,14897,2049,68,10,15016,15064,170,15067,59688232,17107,202,202,61045,115,58,117,110,105,
-                       113,117,101,63,0,2049,14933,10,105,110,116,101,114,102,97,99,101,47,100,101,
-                       100,117,112,46,114,101,116,114,111,0,15067,17403,15045,2,158,0,223407283,0,202,202,
-                       0,83,84,65,67,75,45,67,79,77,77,69,78,84,45,83,84,82,73,78,
-                       71,45,79,70,70,83,69,84,0,15091,15142,170,0,2090715988,0,202,202,0,115,97,
-                       118,101,0,2049,3925,2049,5838,2049,2585,4,2049,5735,1,17,2049,176,1,2,17,2049,
-                       2100,2049,192,16,10,15128,15188,170,0,-1362045190,0,202,202,0,115,116,97,99,107,45,
-                       99,111,109,109,101,110,116,63,0,2,1,0,2049,5799,1,58,11,10,15045,15214,
-                       182,17405,-1801857825,17150,202,202,62225,115,105,103,105,108,58,40,0,2049,15188,1,15142,1,
-                       17,2049,68,10,15197,15243,170,17405,-369994876,15245,202,202,69200,100,58,100,101,115,99,114,
-                       105,98,101,0,2049,5703,115,45,0,1,15245,3,2049,260,25,2049,13286,2,2049,5703,
-                       78,97,109,101,58,32,32,32,32,32,0,1,15259,2049,13341,2049,200,2049,13341,2049,
-                       13286,2,2049,5703,65,100,100,114,101,115,115,58,32,32,0,1,15283,2049,13341,2049,
-                       184,15,2049,13361,2049,13286,2,2049,5703,67,108,97,115,115,58,32,32,32,32,0,
-                       1,15308,2049,13341,2049,186,15,2,2049,13361,2049,10550,2,2049,3492,1793,15343,2049,13303,2049,
-                       200,2049,13341,10,1,15336,1,17,2049,68,2049,13286,2,2049,5703,83,111,117,114,99,
-                       101,58,32,32,32,0,1,15354,2049,13341,2049,188,15,2,2049,3492,1,13341,1,17,
-                       2049,68,2049,13286,2,2049,5703,83,116,97,99,107,58,32,32,32,32,0,1,15386,
-                       2049,13341,2049,192,15,2,2049,3492,1,13341,1,17,2049,68,2049,13286,2,2049,5703,65,
-                       46,32,83,116,97,99,107,58,32,0,1,15418,2049,13341,2049,194,15,2,2049,3492,
-                       1,13341,1,17,2049,68,2049,13286,2,2049,5703,70,108,111,97,116,58,32,32,32,
-                       32,0,1,15450,2049,13341,2049,196,15,2,2049,3492,1,13341,1,17,2049,68,2049,13286,
-                       2,2049,5703,68,101,115,99,114,58,32,32,32,32,0,1,15482,2049,13341,2049,198,
-                       15,2,2049,3492,1,13341,1,17,2049,68,2049,13286,3,10,15223,15542,170,17405,1590555890,15544,
-                       202,202,69225,100,58,115,101,116,45,115,116,97,99,107,45,99,111,109,109,101,
-                       110,116,0,2049,5703,115,115,45,0,1,15544,3,2049,260,2,2049,3492,1793,15566,2049,
-                       192,1,5735,2049,2889,16,10,1,15558,1,2837,2049,68,10,15513,15603,170,17405,-18898317,15605,
-                       202,202,69294,100,58,115,101,116,45,97,115,116,97,99,107,45,99,111,109,109,
-                       101,110,116,0,2049,5703,115,115,45,0,1,15605,3,2049,260,2,2049,3492,1793,15627,
-                       2049,194,1,5735,2049,2889,16,10,1,15619,1,2837,2049,68,10,15573,15664,170,17405,656458392,
-                       15666,202,202,69259,100,58,115,101,116,45,102,115,116,97,99,107,45,99,111,109,
-                       109,101,110,116,0,2049,5703,115,115,45,0,1,15666,3,2049,260,2,2049,3492,1793,
-                       15688,2049,196,1,5735,2049,2889,16,10,1,15680,1,2837,2049,68,10,110,45,0,45,
-                       110,0,110,45,115,0,115,45,115,0,115,45,115,102,0,45,0,100,45,97,
-                       0,100,45,97,0,100,45,97,0,100,45,97,0,45,99,0,45,115,0,45,
-                       0,45,0,110,110,45,110,0,110,110,45,110,0,110,45,0,110,110,45,110,
-                       0,45,0,110,110,45,102,0,102,113,45,0,102,113,45,0,110,109,45,118,
-                       0,110,109,45,114,118,0,110,45,110,32,124,124,32,110,45,0,45,0,110,
-                       45,110,110,32,124,124,32,110,45,110,0,45,110,0,45,110,0,45,110,0,
-                       45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,
-                       0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,
-                       110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,
-                       45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,
-                       0,45,110,0,45,110,0,45,110,0,45,110,0,45,110,0,45,97,0,45,
-                       97,0,45,97,0,45,0,45,97,0,45,110,0,45,110,0,45,97,0,45,
-                       110,0,45,97,0,45,110,0,45,110,0,45,97,0,45,97,0,45,97,0,
-                       45,97,0,45,110,0,45,97,0,45,97,0,45,97,0,45,0,45,0,97,
-                       97,45,102,0,97,97,45,97,0,97,97,45,102,0,97,45,97,0,115,97,
-                       45,102,0,110,97,45,102,0,97,97,45,0,113,45,97,0,97,45,98,0,
-                       97,97,45,102,0,97,97,45,102,0,97,110,45,110,0,97,113,45,98,0,
-                       97,45,110,0,97,113,45,0,115,45,97,0,97,45,110,0,97,110,45,110,
-                       0,97,115,45,110,0,97,118,45,97,0,97,115,45,97,0,97,45,110,0,
-                       97,110,45,97,0,97,45,110,0,113,45,97,0,97,113,45,98,0,97,102,
-                       108,45,97,0,97,97,45,97,0,112,110,113,45,110,0,97,45,98,0,97,
-                       110,45,97,0,118,97,110,45,0,97,45,97,0,97,110,45,98,0,97,45,
-                       115,0,45,0,110,45,0,110,109,45,111,0,97,45,110,0,97,45,97,110,
-                       0,110,97,45,0,110,97,45,97,0,97,45,97,0,45,0,120,113,113,45,
-                       63,0,120,121,113,113,45,63,0,120,121,113,45,63,0,45,0,110,45,0,
-                       45,0,45,97,0,45,110,0,113,45,0,97,45,0,45,110,0,45,97,0,
-                       45,0,99,45,102,0,99,45,102,0,99,45,102,0,99,45,102,0,99,45,
-                       102,0,99,45,102,0,99,45,102,0,99,45,102,0,99,45,102,0,45,99,
-                       0,99,45,102,0,99,45,102,0,99,45,0,99,45,99,0,99,45,110,0,
-                       99,45,115,0,99,45,99,0,99,45,99,0,99,45,102,0,99,45,102,0,
-                       99,45,102,0,99,45,102,0,97,45,0,97,45,97,0,110,97,45,0,97,
-                       45,110,0,110,109,113,45,32,124,124,32,110,109,113,45,110,0,97,45,97,
-                       0,110,97,45,0,97,45,110,0,102,113,113,45,0,110,45,32,124,124,32,
-                       110,45,110,0,97,45,0,97,45,0,97,45,0,110,45,0,97,45,0,97,
-                       45,0,110,45,0,45,0,45,102,0,120,121,45,97,0,110,115,45,0,115,
-                       100,108,45,0,110,113,45,113,0,110,45,0,115,97,97,45,0,100,45,97,
-                       0,115,45,0,113,45,0,100,45,97,0,45,97,0,45,100,0,45,97,0,
-                       45,115,0,45,97,0,100,45,97,0,115,45,100,0,97,45,100,0,100,45,
-                       115,0,45,0,45,97,0,100,45,97,0,100,45,97,0,45,0,45,0,45,
-                       110,0,110,113,45,110,0,113,45,0,110,45,0,110,110,45,0,45,0,110,
-                       45,110,110,0,110,109,45,110,109,110,109,0,45,0,110,110,45,102,0,97,
-                       45,110,0,97,45,97,110,0,118,112,110,45,0,112,118,45,0,118,45,112,
-                       0,112,110,45,0,112,45,0,112,113,45,0,112,110,118,45,0,112,45,110,
-                       0,112,45,0,112,45,112,0,112,110,45,112,0,113,45,0,97,45,0,110,
-                       110,45,102,0,110,110,45,102,0,97,45,110,0,97,45,97,110,0,110,97,
-                       45,0,110,97,45,97,0,45,97,0,45,0,45,0,115,45,0,102,113,45,
-                       0,102,113,45,0,45,0,110,113,45,0,115,45,0,45,110,0,110,45,0,
-                       110,45,109,78,0,110,45,109,0,45,0,110,110,45,102,0,110,110,45,102,
-                       0,110,109,45,111,0,110,45,102,0,45,110,0,45,110,0,110,45,110,0,
-                       110,110,45,110,0,110,108,117,45,102,0,110,45,109,0,110,109,45,118,0,
-                       110,109,45,114,118,0,110,45,102,0,110,45,109,0,110,108,117,45,109,0,
-                       109,110,45,111,0,109,110,45,111,0,110,109,45,111,0,110,110,45,110,0,
-                       110,45,110,0,110,45,102,0,110,45,102,0,110,45,102,0,98,112,45,110,
-                       0,110,45,0,110,45,109,0,110,45,109,0,110,45,102,0,110,110,45,110,
-                       0,110,45,115,0,110,45,102,0,110,109,45,109,0,45,0,110,45,109,0,
-                       45,0,109,110,45,111,0,110,109,45,110,109,110,0,110,110,110,110,45,110,
-                       0,45,110,0,45,0,110,45,0,115,45,0,97,45,0,46,46,46,115,115,
-                       45,63,0,45,0,46,46,46,45,0,97,98,99,45,98,99,97,0,115,45,
-                       0,45,115,0,45,115,0,45,115,0,45,115,0,45,115,0,45,115,0,115,
-                       115,45,115,0,115,115,45,102,0,115,83,113,45,32,124,124,32,115,83,113,
-                       45,115,0,115,45,115,0,115,115,45,0,115,99,45,102,0,115,115,45,102,
-                       0,115,97,45,0,115,45,115,0,45,97,0,115,45,102,0,115,45,115,0,
-                       115,45,0,45,115,0,115,115,45,102,0,115,115,45,102,0,115,45,63,0,
-                       115,110,45,110,0,115,113,45,115,0,115,113,45,0,46,46,46,115,45,115,
-                       0,45,115,0,115,45,110,0,115,99,45,110,0,115,115,45,110,0,115,45,
-                       115,0,115,110,45,115,0,115,45,110,0,115,113,45,115,0,115,115,45,115,
-                       0,115,45,0,115,115,115,45,115,0,115,115,115,45,115,0,115,45,115,0,
-                       115,110,45,115,0,45,0,115,99,45,115,115,0,115,115,45,115,115,0,99,
-                       115,110,45,0,115,102,108,45,115,0,115,45,115,0,115,45,115,0,115,45,
-                       110,0,115,45,115,0,115,99,45,97,0,115,115,45,97,0,115,45,115,0,
-                       115,45,115,0,115,45,115,0,115,45,102,0,97,97,45,0,109,110,45,111,
-                       0,109,110,45,111,0,109,110,45,111,0,110,115,45,0,115,45,110,0,115,
-                       45,99,0,115,45,97,0,115,45,115,0,115,45,0,115,45,0,115,45,110,
-                       0,115,45,0,115,45,0,115,45,0,115,45,0,110,113,40,63,110,45,63,
-                       41,45,110,0,45,0,110,97,45,0,110,97,45,97,0,110,109,45,109,110,
-                       0,45,0,45,0,110,113,45,0,120,113,113,113,45,63,0,120,121,122,113,
-                       113,113,45,63,0,120,121,122,113,45,63,0,110,109,45,109,110,109,0,97,
-                       45,0,110,45,110,110,110,110,0,113,40,45,102,41,45,0,97,45,0,110,
-                       97,45,0,97,45,0,110,97,45,0,97,108,117,45,0,97,45,0,97,45,
-                       0,97,113,45,0,97,113,45,0,115,45,0,110,115,45,0,115,115,45,0,
-                       97,45,110,0,97,45,97,110,0,110,97,45,0,110,97,45,97,0,113,40,
-                       45,102,41,45,0,109,110,45,111,0,45,0,45,0,45,97,0,45,0,15634,
-                       17360,170,17379,515454189,17362,202,202,43522,100,58,115,101,116,45,115,111,117,114,99,101,
-                       0,2049,5703,115,115,45,0,1,17362,3,1,15033,2049,2889,2049,260,2049,188,16,10,
-                       105,110,116,101,114,102,97,99,101,47,115,111,117,114,99,101,115,46,114,101,
-                       116,114,111,0,17379,17436,105,110,116,101,114,102,97,99,101,47,115,116,97,99,
-                       107,45,99,111,109,109,101,110,116,115,46,114,101,116,114,111,0,17405,17449,114,
-                       101,116,114,111,46,109,117,114,105,0,17438,17463,98,117,105,108,100,46,114,101,
-                       116,114,111,0,17451,17477,114,101,116,114,111,46,102,111,114,116,104,0,17465,18061,
-                       17338,0,158,18037,24453216,17504,202,202,31630,68,69,86,73,67,69,58,79,85,84,80,
-                       85,84,0,45,110,0,17479,1,158,18037,-1120109408,17532,202,202,31514,68,69,86,73,67,
-                       69,58,75,69,89,66,79,65,82,68,0,45,110,0,17505,2,158,18037,-338634664,17558,
-                       202,202,31399,68,69,86,73,67,69,58,70,76,79,65,84,83,0,45,110,0,
-                       17533,4,158,18037,-10372606,17583,202,202,31359,68,69,86,73,67,69,58,70,73,76,69,
-                       83,0,45,110,0,17559,3,158,18037,-495174355,17609,202,202,31203,68,69,86,73,67,69,
-                       58,66,76,79,67,75,83,0,45,110,0,17584,5,158,18037,-13819365,17634,202,202,31239,
-                       68,69,86,73,67,69,58,67,76,79,67,75,0,45,110,0,17610,6,158,18037,
-                       -845755547,17663,202,202,31726,68,69,86,73,67,69,58,82,69,83,69,82,86,69,68,
-                       54,0,45,110,0,17635,7,158,18037,173262360,17689,202,202,31832,68,69,86,73,67,69,
-                       58,83,79,67,75,69,84,0,45,110,0,17664,8,158,18037,-1171124621,17713,202,202,31862,
-                       68,69,86,73,67,69,58,85,78,73,88,0,45,110,0,17690,9,158,18037,633651458,
-                       17742,202,202,31792,68,69,86,73,67,69,58,83,67,82,73,80,84,73,78,71,
-                       0,45,110,0,17714,10,158,18037,-1597298186,17765,202,202,31746,68,69,86,73,67,69,58,
-                       82,78,71,0,45,110,0,17743,11,158,18037,-2140129391,17795,202,202,31666,68,69,86,73,
-                       67,69,58,82,69,83,69,82,86,69,68,49,49,0,45,110,0,17766,12,158,
-                       18037,-2140129390,17825,202,202,31686,68,69,86,73,67,69,58,82,69,83,69,82,86,69,
-                       68,49,50,0,45,110,0,17796,13,158,18037,-2140129389,17855,202,202,31706,68,69,86,73,
-                       67,69,58,82,69,83,69,82,86,69,68,49,51,0,45,110,0,17826,14,158,
-                       18037,-6608534,17880,202,202,31471,68,69,86,73,67,69,58,73,79,67,84,76,0,45,
-                       110,0,17856,15,158,18037,-77828057,17906,202,202,31551,68,69,86,73,67,69,58,77,65,
-                       76,76,79,67,0,45,110,0,17881,1000,158,18037,-6683022,17931,202,202,31436,68,69,86,
-                       73,67,69,58,73,77,65,71,69,0,45,110,0,17907,1234,158,18037,-11228231,17956,202,
-                       202,31273,68,69,86,73,67,69,58,69,82,82,79,82,0,45,110,0,17932,8000,
-                       158,18037,1388216643,17985,202,202,31590,68,69,86,73,67,69,58,77,85,76,84,73,67,
-                       79,82,69,0,45,110,0,17957,8100,158,18037,-1597311516,18008,202,202,31310,68,69,86,73,
-                       67,69,58,70,70,73,0,45,110,0,17986,8101,158,18037,-1625916788,18036,202,202,31897,68,
-                       69,86,73,67,69,58,85,78,83,73,71,78,69,68,0,45,110,0,105,110,
-                       116,101,114,102,97,99,101,47,100,101,118,105,99,101,115,46,114,101,116,114,
-                       111,0,18037,21506,18009,18088,170,21476,1141548230,18090,202,202,51943,102,108,111,97,116,58,111,
-                       112,101,114,97,116,105,111,110,0,2049,5703,110,45,0,1,18090,3,1,2,2049,
-                       13215,2,2049,3517,1793,18154,3,2049,5703,69,114,114,111,114,58,32,102,108,111,97,
-                       116,105,110,103,32,112,111,105,110,116,32,100,101,118,105,99,101,32,110,111,
-                       116,32,102,111,117,110,100,0,1,18108,2049,13341,2049,13286,10,1,18105,2049,3638,2049,
-                       13192,10,18063,18181,170,21476,891922707,18183,202,21764,55778,110,58,116,111,45,102,108,111,97,
-                       116,0,2049,5703,110,45,95,102,58,45,110,0,1,18183,3,1,0,2049,18088,10,
-                       18161,18219,170,21476,1230929592,18221,202,21770,60395,115,58,116,111,45,102,108,111,97,116,0,
-                       2049,5703,115,45,95,102,58,45,110,0,1,18221,3,1,1,2049,18088,10,18199,18258,
-                       170,21476,-1027330818,18260,202,21751,48888,102,58,116,111,45,110,117,109,98,101,114,0,2049,
-                       5703,102,58,97,45,95,95,45,110,0,1,18260,3,1,2,2049,18088,10,18237,18298,
-                       170,21476,-832652180,18300,202,21754,48934,102,58,116,111,45,115,116,114,105,110,103,0,2049,
-                       5703,102,58,110,45,95,95,45,115,0,1,18300,3,2049,5678,2,1,3,2049,18088,
-                       10,18277,18333,170,21476,193490032,18335,202,21516,45476,102,58,43,0,2049,5703,102,58,97,98,
-                       45,99,0,1,18335,3,1,4,2049,18088,10,18320,18363,170,21476,193490034,18365,202,21521,45530,
-                       102,58,45,0,2049,5703,102,58,97,98,45,99,0,1,18365,3,1,5,2049,18088,
-                       10,18350,18393,170,21476,193490031,18395,202,21511,45417,102,58,42,0,2049,5703,102,58,97,98,
-                       45,99,0,1,18395,3,1,6,2049,18088,10,18380,18423,170,21476,193490036,18425,202,21536,45799,
-                       102,58,47,0,2049,5703,102,58,97,98,45,99,0,1,18425,3,1,7,2049,18088,
-                       10,18410,18457,170,21476,1043458567,18459,202,21621,47267,102,58,102,108,111,111,114,0,2049,5703,
-                       102,58,97,98,45,99,0,1,18459,3,1,8,2049,18088,10,18440,18493,170,21476,-1700567744,
-                       18495,202,21582,46641,102,58,99,101,105,108,105,110,103,0,2049,5703,102,58,102,45,
-                       102,0,1,18495,3,1,9,2049,18088,10,18474,18525,170,21476,-98057841,18527,202,21727,48571,102,
-                       58,115,113,114,116,0,2049,5703,102,58,102,45,102,0,1,18527,3,1,10,2049,
-                       18088,10,18509,18556,170,21476,257314298,18558,202,21614,47127,102,58,101,113,63,0,2049,5703,102,
-                       58,97,98,45,99,0,1,18558,3,1,11,2049,18088,10,18541,18589,170,21476,-100586585,18591,
-                       202,21529,45622,102,58,45,101,113,63,0,2049,5703,102,58,97,98,45,99,0,1,
-                       18591,3,1,12,2049,18088,10,18573,18621,170,21476,257322020,18623,202,21647,47646,102,58,108,116,
-                       63,0,2049,5703,102,58,97,98,45,99,0,1,18623,3,1,13,2049,18088,10,18606,
-                       18653,170,21476,257316575,18655,202,21625,47335,102,58,103,116,63,0,2049,5703,102,58,97,98,
-                       45,99,0,1,18655,3,1,14,2049,18088,10,18638,18687,170,21476,1040836410,18689,202,202,46788,
-                       102,58,100,101,112,116,104,0,2049,5703,45,110,0,1,18689,3,1,15,2049,18088,
-                       10,18670,18715,170,21476,257313390,18717,202,21601,47033,102,58,100,117,112,0,2049,5703,102,58,
-                       97,45,97,97,0,1,18717,3,1,16,2049,18088,10,18700,18748,170,21476,-98595910,18750,202,
-                       21594,46844,102,58,100,114,111,112,0,2049,5703,102,58,97,45,0,1,18750,3,1,
-                       17,2049,18088,10,18732,18779,170,21476,-98051872,18781,202,21738,48731,102,58,115,119,97,112,0,
-                       2049,5703,102,58,97,98,45,98,97,0,1,18781,3,1,18,2049,18088,10,18763,18812,
-                       170,21476,257321895,18814,202,21642,47592,102,58,108,111,103,0,2049,5703,102,58,97,98,45,
-                       99,0,1,18814,3,1,19,2049,18088,10,18797,18846,170,21476,1055433970,18848,202,21689,48171,102,
-                       58,112,111,119,101,114,0,2049,5703,102,58,97,98,45,99,0,1,18848,3,1,
-                       20,2049,18088,10,18829,18878,170,21476,257329327,18880,202,21723,48527,102,58,115,105,110,0,2049,
-                       5703,102,58,102,45,102,0,1,18880,3,1,21,2049,18088,10,18863,18909,170,21476,257330152,
-                       18911,202,21744,48794,102,58,116,97,110,0,2049,5703,102,58,102,45,102,0,1,18911,
-                       3,1,22,2049,18088,10,18894,18940,170,21476,257312106,18942,202,21586,46722,102,58,99,111,115,
-                       0,2049,5703,102,58,102,45,102,0,1,18942,3,1,23,2049,18088,10,18925,18972,170,
-                       21476,-98702832,18974,202,21564,46254,102,58,97,115,105,110,0,2049,5703,102,58,102,45,102,
-                       0,1,18974,3,1,24,2049,18088,10,18956,19004,170,21476,-98720053,19006,202,21560,46138,102,58,
-                       97,99,111,115,0,2049,5703,102,58,102,45,102,0,1,19006,3,1,25,2049,18088,
-                       10,18988,19036,170,21476,-98702007,19038,202,21568,46302,102,58,97,116,97,110,0,2049,5703,102,
-                       58,102,45,102,0,1,19038,3,1,26,2049,18088,10,19020,19068,170,21476,-98161275,19070,202,
-                       21694,48211,102,58,112,117,115,104,0,2049,5703,102,58,102,45,0,1,19070,3,1,
-                       27,2049,18088,10,19052,19098,170,21476,257326260,19100,202,21683,48046,102,58,112,111,112,0,2049,
-                       5703,102,58,45,102,0,1,19100,3,1,28,2049,18088,10,19083,19131,170,21476,-131128101,19133,
-                       202,202,46188,102,58,97,100,101,112,116,104,0,2049,5703,45,110,0,1,19133,3,
-                       1,29,2049,18088,10,19113,19160,170,21476,-98196575,19162,202,21676,47982,102,58,111,118,101,114,
-                       0,2049,5703,102,58,97,98,45,97,98,97,0,1,19162,3,2049,19068,2049,18715,2049,
-                       19098,2049,18779,10,19144,19199,170,21476,-98018052,19201,202,21757,48980,102,58,116,117,99,107,0,
-                       2049,5703,102,58,97,98,45,98,97,98,0,1,19201,3,2049,18715,2049,19068,2049,18779,
-                       2049,19098,10,19183,19237,170,21476,257323884,19239,202,21671,47943,102,58,110,105,112,0,2049,5703,
-                       102,58,97,98,45,98,0,1,19239,3,2049,18779,2049,18748,10,19222,19275,170,21476,400249779,
-                       19277,202,21597,46894,102,58,100,114,111,112,45,112,97,105,114,0,2049,5703,102,58,
-                       97,98,45,0,1,19277,3,2049,18748,2049,18748,10,19254,19311,170,21476,-1227267353,19313,202,21606,
-                       47085,102,58,100,117,112,45,112,97,105,114,0,2049,5703,102,58,97,98,45,97,
-                       98,97,98,0,1,19313,3,2049,19160,2049,19160,10,19291,19346,170,21476,257328442,19348,202,21700,
-                       48297,102,58,114,111,116,0,2049,5703,102,58,97,98,99,45,98,99,97,0,1,
-                       19348,3,2049,19068,2049,18779,2049,19098,2049,18779,10,19331,19387,182,21476,-1801857819,19389,202,21773,62253,
-                       115,105,103,105,108,58,46,0,2049,5703,115,45,95,95,102,58,45,97,0,1,
-                       19389,3,2049,2505,1,5735,1,5644,2049,68,1,18219,2049,170,10,19370,19432,170,21476,589284534,
-                       19434,202,21731,48622,102,58,115,113,117,97,114,101,0,2049,5703,102,58,110,45,109,
-                       0,1,19434,3,2049,18715,2049,18393,10,19414,19469,170,21476,-243186313,19471,202,21686,48099,102,58,
-                       112,111,115,105,116,105,118,101,63,0,2049,5703,45,102,95,95,102,58,97,45,
-                       0,1,19471,3,1,0,2049,18181,2049,18653,10,19448,19511,170,21476,529659031,19513,202,21668,47874,
-                       102,58,110,101,103,97,116,105,118,101,63,0,2049,5703,45,102,95,95,102,58,
-                       97,45,0,1,19513,3,1,0,2049,18181,2049,18621,10,19490,19550,170,21476,378873465,19552,202,
-                       21664,47829,102,58,110,101,103,97,116,101,0,2049,5703,102,58,97,45,98,0,1,
-                       19552,3,1,-1,2049,18181,2049,18393,10,19532,19583,170,21476,257309499,19585,202,21556,46084,102,58,
-                       97,98,115,0,2049,5703,102,58,97,45,98,0,1,19585,3,2049,18715,2049,19511,1,
-                       19550,9,10,19568,19617,170,21476,257326462,19619,202,21697,48264,102,58,112,117,116,0,2049,5703,
-                       102,58,97,45,0,1,19619,3,2049,18298,2049,13341,10,19602,19646,170,21476,2090205054,19648,202,
-                       21553,46044,102,58,80,73,0,2049,5703,102,58,45,70,0,1,19648,3,2049,5703,51,
-                       46,49,52,49,53,57,50,54,53,52,0,1,19658,2049,18219,10,19632,19688,170,21476,
-                       193490058,19690,202,21541,45837,102,58,69,0,2049,5703,102,58,45,70,0,1,19690,3,2049,
-                       5703,50,46,55,49,56,50,56,49,56,50,56,0,1,19700,2049,18219,10,19675,19732,
-                       170,21476,257287682,19734,202,21550,46008,102,58,78,65,78,0,2049,5703,102,58,45,110,0,
-                       1,19734,3,2049,5703,48,0,1,19744,2049,18219,2049,5703,48,0,1,19752,2049,18219,2049,
-                       18423,10,19717,19776,170,21476,257282658,19778,202,21547,45958,102,58,73,78,70,0,2049,5703,102,
-                       58,45,110,0,1,19778,3,2049,5703,49,46,48,0,1,19788,2049,18219,2049,5703,48,
-                       0,1,19798,2049,18219,2049,18423,10,19761,19823,170,21476,-100618225,19825,202,21526,45572,102,58,45,
-                       73,78,70,0,2049,5703,102,58,45,110,0,1,19825,3,2049,5703,45,49,46,48,
-                       0,1,19835,2049,18219,2049,5703,48,0,1,19846,2049,18219,2049,18423,10,19807,19871,170,21476,
-                       -98255135,19873,202,21661,47762,102,58,110,97,110,63,0,2049,5703,102,58,110,45,44,45,
-                       102,0,1,19873,3,2049,18715,2049,18589,10,19855,19905,170,21476,-98420927,19907,202,21633,47407,102,
-                       58,105,110,102,63,0,2049,5703,102,58,110,45,44,45,102,0,1,19907,3,2049,
-                       19776,2049,18556,10,19889,19940,170,21476,975751822,19942,202,21533,45731,102,58,45,105,110,102,63,
-                       0,2049,5703,102,58,110,45,44,45,102,0,1,19942,3,2049,19823,2049,18556,10,19923,
-                       19975,170,21476,1057803917,19977,202,21708,48326,102,58,114,111,117,110,100,0,2049,5703,45,124,
-                       102,58,97,45,98,0,1,19977,3,2049,18715,2049,19511,1793,20009,2049,5703,48,46,53,
-                       0,1,19996,2049,18219,2049,18363,2049,18493,10,1,19994,1793,20028,2049,5703,48,46,53,0,
-                       1,20015,2049,18219,2049,18333,2049,18457,10,1,20013,2049,68,10,19958,20048,170,21476,257322793,20050,
-                       202,21656,47729,102,58,109,105,110,0,2049,5703,102,58,110,110,45,110,0,1,20050,
-                       3,2049,19311,2049,18621,1,18748,1,19237,2049,68,10,20033,20086,170,21476,257322539,20088,202,21651,
-                       47695,102,58,109,97,120,0,2049,5703,102,58,110,110,45,110,0,1,20088,3,2049,
-                       19311,2049,18653,1,18748,1,19237,2049,68,10,20071,20126,170,21476,1050463908,20128,202,21636,47474,102,
-                       58,108,105,109,105,116,0,2049,5703,102,58,110,108,117,45,110,0,1,20128,3,
-                       2049,18779,2049,19068,2049,20048,2049,19098,2049,20086,10,20109,20170,170,21476,490450478,20172,202,21572,46353,
-                       102,58,98,101,116,119,101,101,110,63,0,2049,5703,102,58,110,108,117,45,110,
-                       0,1,20172,3,2049,19346,2049,18715,2049,19068,2049,19346,2049,19346,2049,20126,2049,19098,2049,18556,
-                       10,20150,20215,170,21476,257318591,20217,202,21629,47387,102,58,105,110,99,0,2049,5703,102,58,
-                       110,45,110,0,1,20217,3,2049,5703,49,0,1,20228,2049,18219,2049,18333,10,20200,20252,
-                       170,21476,257312849,20254,202,21590,46768,102,58,100,101,99,0,2049,5703,102,58,110,45,110,
-                       0,1,20254,3,2049,5703,49,0,1,20265,2049,18219,2049,18363,10,20237,20290,170,21476,-98650239,
-                       20292,202,21577,46477,102,58,99,97,115,101,0,2049,5703,102,58,102,102,45,44,113,
-                       45,0,1,20292,3,2049,19160,2049,18556,1793,20316,2049,18748,8,1,-1,10,1,20310,1793,
-                       20324,3,1,0,10,1,20320,2049,68,25,6,771,10,20274,20348,170,21476,-98066922,20350,202,
-                       21712,48356,102,58,115,105,103,110,0,2049,5703,45,110,124,102,58,97,45,0,1,
-                       20350,3,2049,18715,2049,5703,48,0,1,20365,2049,18219,2049,18556,1793,20380,1,0,2049,18748,
-                       10,1,20375,2049,3638,2049,5703,48,0,1,20386,2049,18219,2049,18653,1793,20399,1,1,10,
-                       1,20396,1793,20406,1,-1,10,1,20403,2049,68,10,20332,2147483645,158,21476,256100682,20428,202,202,
-                       44537,101,58,77,65,88,0,45,110,0,20411,-2147483645,158,21476,256100936,20446,202,202,44597,101,
-                       58,77,73,78,0,45,110,0,20429,-2147483647,158,21476,256101761,20464,202,202,44657,101,58,78,
-                       65,78,0,45,110,0,20447,2147483646,158,21476,256096737,20482,202,202,44482,101,58,73,78,70,
-                       0,45,110,0,20465,-2147483646,158,21476,-139753618,20501,202,202,44381,101,58,45,73,78,70,0,
-                       45,110,0,20483,20516,170,21476,2090170097,20518,202,202,44861,101,58,110,63,0,2049,5703,117,
-                       45,102,0,1,20518,3,1,-2147483645,2049,3925,1,2147483645,2049,3943,2049,3966,10,20502,20552,170,
-                       21476,-137426135,20554,202,202,44795,101,58,109,97,120,63,0,2049,5703,117,45,102,0,1,
-                       20554,3,1,2147483645,11,10,20536,20581,170,21476,-137417753,20583,202,202,44828,101,58,109,105,110,
-                       63,0,2049,5703,117,45,102,0,1,20583,3,1,-2147483645,11,10,20565,20611,170,21476,-224539325,
-                       20613,202,202,45028,101,58,122,101,114,111,63,0,2049,5703,117,45,102,0,1,20613,
-                       3,2049,3470,10,20594,20639,170,21476,-137390528,20641,202,202,44937,101,58,110,97,110,63,0,
-                       2049,5703,117,45,102,0,1,20641,3,1,-2147483647,11,10,20623,20668,170,21476,-137556320,20670,202,
-                       202,44768,101,58,105,110,102,63,0,2049,5703,117,45,102,0,1,20670,3,1,2147483646,
-                       11,10,20652,20698,170,21476,-315716147,20700,202,202,44446,101,58,45,105,110,102,63,0,2049,
-                       5703,117,45,102,0,1,20700,3,1,-2147483646,11,10,20681,20727,170,21476,-137773972,20729,202,202,
-                       44716,101,58,99,108,105,112,0,2049,5703,117,45,117,0,1,20729,3,1,-2147483645,1,
-                       2147483645,2049,3902,10,20711,20757,170,21476,2090204667,20759,202,21544,45889,102,58,69,49,0,2049,5703,
-                       45,124,102,58,45,110,41,95,101,45,117,110,105,116,95,105,110,95,102,108,
-                       111,97,0,1,20759,3,1793,20787,2049,5703,49,46,101,53,0,1,20789,2049,18219,10,
-                       20743,20822,170,21476,1656704630,20824,202,21715,48430,102,58,115,105,103,110,101,100,45,115,113,
-                       114,116,0,2049,5703,124,102,58,110,45,110,0,1,20824,3,2049,18715,2049,20348,2049,
-                       19583,2049,18525,2049,18181,2049,18393,10,20799,20872,170,21476,265168733,20874,202,21719,48481,102,58,115,
-                       105,103,110,101,100,45,115,113,117,97,114,101,0,2049,5703,124,102,58,110,45,
-                       110,0,1,20874,3,2049,18715,2049,20348,2049,18715,2049,18393,2049,18181,2049,18393,10,20847,20915,
-                       170,0,2146687312,0,202,202,0,102,58,45,115,104,105,102,116,0,2049,20757,2049,18393,
-                       10,20897,20938,170,0,2068416526,0,202,202,0,102,58,43,115,104,105,102,116,0,2049,
-                       20757,2049,18423,10,20920,20962,170,0,-1002717602,0,202,202,0,102,58,43,101,110,99,111,
-                       100,101,0,2049,20822,2049,20915,10,20943,20986,170,0,1580218336,0,202,202,0,102,58,45,
-                       101,110,99,111,100,101,0,2049,18715,2049,20348,2049,20938,2049,18715,2049,18393,2049,18181,2049,
-                       18393,10,20847,21017,170,21476,-98026374,21019,202,21748,48841,102,58,116,111,45,101,0,2049,5703,
-                       45,101,124,102,58,110,45,0,1,21019,3,2049,18715,2049,19871,1793,21041,2049,18748,1,
-                       -2147483647,10,1,21036,2049,3638,2049,18715,2049,19905,1793,21056,2049,18748,1,2147483646,10,1,21051,2049,
-                       3638,2049,18715,2049,19940,1793,21071,2049,18748,1,-2147483646,10,1,21066,2049,3638,2049,20962,2049,19975,
-                       2049,18258,2049,20727,1,-2147483645,1,18748,2049,3274,1,2147483645,1,18748,2049,3274,10,21001,21112,170,
-                       21476,-137161766,21114,202,21508,44988,101,58,116,111,45,102,0,2049,5703,101,45,124,102,58,
-                       45,110,0,1,21114,3,1,-2147483647,1,19732,2049,3274,1,2147483646,1,19776,2049,3274,1,-2147483646,
-                       1,19823,2049,3274,2049,18181,2049,20986,10,21096,21165,170,21476,1059163122,21167,202,21735,48668,102,58,
-                       115,116,111,114,101,0,2049,5703,97,45,124,102,58,110,45,0,1,21167,3,1,
-                       21017,2049,2889,16,10,21148,21201,170,21476,1043212047,21203,202,21618,47230,102,58,102,101,116,99,
-                       104,0,2049,5703,97,45,124,102,58,45,110,0,1,21203,3,15,2049,21112,10,21184,
-                       21240,170,21476,-1736964994,21242,202,202,46986,102,58,100,117,109,112,45,115,116,97,99,107,
-                       0,2049,5703,45,0,1,21242,3,2049,18687,2,1,19068,2049,3153,1793,21265,2049,19098,2049,
-                       18715,2049,19617,2049,13303,10,1,21256,2049,3153,10,21218,21293,170,21476,2104754815,21295,202,202,46929,
-                       102,58,100,117,109,112,45,97,115,116,97,99,107,0,2049,5703,45,0,1,21295,
-                       3,2049,19131,2,1,19098,2049,3153,1793,21318,2049,18715,2049,19617,2049,13303,2049,19068,10,1,
-                       21309,2049,3153,10,21270,21338,170,21476,256140541,21340,202,202,44961,101,58,112,117,116,0,2049,
-                       5703,101,45,0,1,21340,3,1,2147483645,1793,21363,2049,5703,101,58,77,65,88,0,1,
-                       21352,2049,13341,10,1,21350,2049,3274,1,-2147483645,1793,21384,2049,5703,101,58,77,73,78,0,
-                       1,21373,2049,13341,10,1,21371,2049,3274,1,0,1793,21403,2049,5703,101,58,48,0,1,
-                       21394,2049,13341,10,1,21392,2049,3274,1,-2147483647,1793,21424,2049,5703,101,58,78,65,78,0,
-                       1,21413,2049,13341,10,1,21411,2049,3274,1,2147483646,1793,21445,2049,5703,101,58,73,78,70,
-                       0,1,21434,2049,13341,10,1,21432,2049,3274,1,-2147483646,1793,21467,2049,5703,101,58,45,73,
-                       78,70,0,1,21455,2049,13341,10,1,21453,2049,3274,2049,21112,2049,19617,10,105,110,116,
-                       101,114,102,97,99,101,47,102,108,111,97,116,105,110,103,112,111,105,110,116,
-                       46,114,101,116,114,111,0,21476,23034,45,110,0,70,70,45,70,0,70,70,45,
-                       70,0,70,70,45,70,0,45,110,0,70,70,45,0,70,45,0,70,70,45,
-                       70,0,45,70,0,45,102,0,45,110,0,45,110,0,45,70,0,70,45,70,
-                       0,70,45,70,0,70,45,70,0,70,45,70,0,110,108,117,45,0,110,109,
-                       45,110,0,70,45,70,0,70,45,70,0,110,45,109,0,70,45,0,70,70,
-                       45,0,70,45,70,70,0,110,109,45,110,109,110,109,0,70,70,45,0,45,
-                       110,0,70,45,70,0,70,70,45,0,110,45,109,0,70,45,0,110,108,117,
-                       45,109,0,70,70,45,70,0,70,70,45,0,109,110,45,111,0,109,110,45,
-                       111,0,70,45,0,70,45,70,0,70,45,0,78,77,45,77,0,70,71,45,
-                       70,71,70,0,45,70,0,70,45,0,70,70,45,70,0,70,45,0,70,45,
-                       0,97,98,99,45,98,99,97,0,102,45,102,0,70,45,0,70,45,70,0,
-                       102,45,102,0,70,45,70,0,70,45,70,0,102,45,102,0,110,45,0,70,
-                       71,45,71,70,0,70,45,70,0,110,45,0,70,45,0,70,45,0,70,71,
-                       45,71,70,71,0,45,70,0,45,63,0,45,70,0,45,70,0,21323,21800,170,
-                       23007,-1289714992,21802,202,202,50226,102,105,108,101,58,111,112,101,114,97,116,105,111,110,
-                       0,2049,5703,45,110,0,1,21802,3,1,4,2049,13215,2,2049,3517,1793,21857,3,2049,
-                       5703,69,114,114,111,114,58,32,102,105,108,101,115,32,100,101,118,105,99,101,
-                       32,110,111,116,32,102,111,117,110,100,0,1,21820,2049,13341,2049,13286,10,1,21817,
-                       2049,3638,2049,13192,10,21776,0,158,23007,-42586063,21882,202,202,49472,102,105,108,101,58,82,
-                       0,45,110,0,21864,1,158,23007,-42586058,21901,202,202,49564,102,105,108,101,58,87,0,
-                       45,110,0,21883,2,158,23007,-42586080,21920,202,202,49428,102,105,108,101,58,65,0,45,
-                       110,0,21902,3,158,23007,-1405340036,21940,202,202,49514,102,105,108,101,58,82,43,0,45,
-                       110,0,21921,21960,170,23007,-1405821071,21962,202,202,49949,102,105,108,101,58,111,112,101,110,
-                       0,2049,5703,115,109,45,104,0,1,21962,3,1,0,2049,21800,10,21941,21995,170,23007,
-                       838181269,21997,202,202,49607,102,105,108,101,58,99,108,111,115,101,0,2049,5703,104,45,
-                       0,1,21997,3,1,1,2049,21800,10,21975,22027,170,23007,-1405725381,22029,202,202,50298,102,105,
-                       108,101,58,114,101,97,100,0,2049,5703,104,45,99,0,1,22029,3,1,2,2049,
-                       21800,10,22008,22061,170,23007,862108810,22063,202,202,51061,102,105,108,101,58,119,114,105,116,
-                       101,0,2049,5703,99,104,45,0,1,22063,3,1,3,2049,21800,10,22041,22094,170,23007,
-                       -1405653136,22096,202,202,51001,102,105,108,101,58,116,101,108,108,0,2049,5703,104,45,110,
-                       0,1,22096,3,1,4,2049,21800,10,22075,22127,170,23007,-1405689305,22129,202,202,50682,102,105,
-                       108,101,58,115,101,101,107,0,2049,5703,110,104,45,0,1,22129,3,1,5,2049,
-                       21800,10,22108,22160,170,23007,-1405684262,22162,202,202,50740,102,105,108,101,58,115,105,122,101,
-                       0,2049,5703,104,45,110,0,1,22162,3,1,6,2049,21800,10,22141,22195,170,23007,1920889586,
-                       22197,202,202,49644,102,105,108,101,58,100,101,108,101,116,101,0,2049,5703,115,45,
-                       0,1,22197,3,1,7,2049,21800,10,22174,22228,170,23007,841745569,22230,202,202,49740,102,105,
-                       108,101,58,102,108,117,115,104,0,2049,5703,102,45,0,1,22230,3,1,8,2049,
-                       21800,10,22208,22266,170,23007,-983416527,22268,202,202,50417,102,105,108,101,58,114,101,97,100,
-                       47,98,121,116,101,115,0,2049,5703,112,110,102,45,0,1,22268,3,1,9,2049,
-                       21800,10,22241,22307,170,23007,1832429504,22309,202,202,51113,102,105,108,101,58,119,114,105,116,
-                       101,47,98,121,116,101,115,0,2049,5703,112,110,102,45,0,1,22309,3,1,10,
-                       2049,21800,10,22281,22343,170,23007,-1826580883,22345,202,202,50555,102,105,108,101,58,114,101,97,
-                       100,47,99,0,2049,5703,104,45,99,0,1,22345,3,1,11,2049,21800,10,22322,22379,
-                       170,23007,-1761342084,22381,202,202,51229,102,105,108,101,58,119,114,105,116,101,47,99,0,
-                       2049,5703,99,104,45,99,0,1,22381,3,1,12,2049,21800,10,22357,22416,170,23007,996833214,
-                       22418,202,202,49667,102,105,108,101,58,101,120,105,115,116,115,63,0,2049,5703,115,
-                       45,102,0,1,22418,3,1,0,2049,21960,2,2049,3492,1793,22439,2049,21995,2049,3239,10,
-                       1,22434,1793,22447,3,2049,3257,10,1,22443,2049,68,10,22394,22483,170,23007,-1949048916,22485,202,
-                       202,50113,102,105,108,101,58,111,112,101,110,45,102,111,114,45,114,101,97,100,
-                       105,110,103,0,2049,5703,115,45,110,110,0,1,22485,3,1,0,2049,21960,2,2049,
-                       22160,4,10,22452,22532,170,23007,-190176246,22534,202,202,50035,102,105,108,101,58,111,112,101,
-                       110,45,102,111,114,45,97,112,112,101,110,100,0,2049,5703,115,45,110,110,0,
-                       1,22534,3,1,2,2049,21960,2,2049,22160,4,10,22502,22582,170,23007,732146102,22584,202,202,
-                       50181,102,105,108,101,58,111,112,101,110,45,102,111,114,45,119,114,105,116,105,
-                       110,103,0,2049,5703,115,45,110,0,1,22584,3,1,1,2049,21960,10,22551,22609,158,
-                       0,193455704,0,202,202,0,70,73,68,0,0,22596,22624,158,0,2089574848,0,202,202,0,
-                       83,105,122,101,0,0,22610,22641,158,0,-1497417501,0,202,202,0,65,99,116,105,111,
-                       110,0,0,22625,22657,170,0,191272619,0,202,202,0,45,101,111,102,63,0,3841,22609,
-                       2049,22094,3841,22624,13,10,22642,22683,170,0,333634225,0,202,202,0,112,114,101,115,101,
-                       114,118,101,0,1,22609,1793,22694,1,22624,1,27,2049,4890,10,1,22687,2049,4890,10,
-                       22551,22723,170,23007,-1853937936,22725,202,202,50356,102,105,108,101,58,114,101,97,100,45,108,
-                       105,110,101,0,2049,5703,102,45,115,0,1,22725,3,2049,2585,4,1,13,2049,21800,
-                       2049,2585,10,22699,22770,170,23007,-1671886311,22772,202,202,49795,102,105,108,101,58,102,111,114,
-                       45,101,97,99,104,45,108,105,110,101,0,2049,5703,115,113,45,0,1,22772,3,
-                       1793,22810,4097,22641,2049,22483,4097,22609,4097,22624,1793,22801,3841,22609,2049,22723,3841,22641,8,2049,
-                       22657,10,1,22791,2049,3064,3841,22609,2049,21995,10,1,22781,2049,22683,10,22742,22843,170,23007,
-                       -1672228059,22845,202,202,49872,102,105,108,101,58,102,111,114,45,101,97,99,104,45,98,
-                       121,116,101,0,2049,5703,115,113,45,0,1,22845,3,1793,22883,4097,22641,2049,22483,4097,
-                       22609,4097,22624,1793,22874,3841,22609,2049,22027,3841,22641,8,2049,22657,10,1,22864,2049,3064,3841,
-                       22609,2049,21995,10,1,22854,2049,22683,10,22815,22901,158,0,193455704,0,202,202,0,70,73,
-                       68,0,0,22815,22922,170,23007,857162517,22924,202,202,50801,102,105,108,101,58,115,108,117,
-                       114,112,0,2049,5703,97,115,45,0,1,22924,3,1793,22958,4,2049,5198,2049,22483,4097,
-                       22901,1793,22949,3841,22901,2049,22027,2049,5082,10,1,22942,2049,3153,3841,22901,2049,21995,10,1,
-                       22933,2049,5228,10,22902,22982,170,23007,-1405677314,22984,202,202,50895,102,105,108,101,58,115,112,
-                       101,119,0,2049,5703,115,115,45,0,1,22984,3,2049,22582,4,1793,23000,67502597,2049,22061,
-                       10,1,22996,2049,6027,2049,21995,10,105,110,116,101,114,102,97,99,101,47,102,105,
-                       108,101,115,121,115,116,101,109,46,114,101,116,114,111,0,23007,24073,22963,23061,170,
-                       24052,1814120867,23063,202,202,53651,105,111,58,117,110,105,120,45,115,121,115,99,97,108,
-                       108,0,2049,5703,110,45,0,1,23063,3,1,8,2049,13215,2,2049,3517,1793,23117,3,
-                       2049,5703,69,114,114,111,114,58,32,85,78,73,88,32,100,101,118,105,99,101,
-                       32,110,111,116,32,102,111,117,110,100,0,1,23081,2049,13341,2049,13286,10,1,23078,
-                       2049,3638,2049,13192,10,23036,23145,170,24052,-1493515992,23147,202,202,66075,117,110,105,120,58,115,
-                       121,115,116,101,109,0,2049,5703,115,45,0,1,23147,3,1,0,2049,23061,10,23124,
-                       23177,170,24052,1646723733,23179,202,202,65227,117,110,105,120,58,102,111,114,107,0,2049,5703,
-                       45,110,0,1,23179,3,1,1,2049,23061,10,23158,23210,170,24052,-1493568520,23212,202,202,64504,
-                       117,110,105,120,58,101,120,101,99,48,0,2049,5703,115,45,0,1,23212,3,1,
-                       2,2049,23061,10,23190,23243,170,24052,-1493568519,23245,202,202,64565,117,110,105,120,58,101,120,
-                       101,99,49,0,2049,5703,115,115,45,0,1,23245,3,1,3,2049,23061,10,23223,23277,
-                       170,24052,-1493568518,23279,202,202,64651,117,110,105,120,58,101,120,101,99,50,0,2049,5703,
-                       115,115,115,45,0,1,23279,3,1,4,2049,23061,10,23257,23312,170,24052,-1493568517,23314,202,
-                       202,64742,117,110,105,120,58,101,120,101,99,51,0,2049,5703,115,115,115,115,45,
-                       0,1,23314,3,1,5,2049,23061,10,23292,23347,170,24052,1646697309,23349,202,202,64985,117,110,
-                       105,120,58,101,120,105,116,0,2049,5703,110,45,0,1,23349,3,1,6,2049,23061,
-                       10,23328,23381,170,24052,-1986827424,23383,202,202,65382,117,110,105,120,58,103,101,116,112,105,
-                       100,0,2049,5703,45,110,0,1,23383,3,1,7,2049,23061,10,23360,23413,170,24052,1647319128,
-                       23415,202,202,66165,117,110,105,120,58,119,97,105,116,0,2049,5703,45,110,0,1,
-                       23415,3,1,8,2049,23061,10,23394,23445,170,24052,1646896687,23447,202,202,65421,117,110,105,120,
-                       58,107,105,108,108,0,2049,5703,110,110,45,0,1,23447,3,1,9,2049,23061,10,
-                       23426,23479,170,24052,-1480834715,23481,202,202,65629,117,110,105,120,58,112,111,112,101,110,0,
-                       2049,5703,115,110,45,110,0,1,23481,3,1,10,2049,23061,10,23459,23515,170,24052,-1637268983,
-                       23517,202,202,65481,117,110,105,120,58,112,99,108,111,115,101,0,2049,5703,110,45,
-                       0,1,23517,3,1,11,2049,23061,10,23494,23548,170,24052,-1496516179,23550,202,202,64364,117,110,
-                       105,120,58,99,104,100,105,114,0,2049,5703,115,45,0,1,23550,3,1,13,2049,
-                       23061,10,23528,23582,170,24052,-1986839220,23584,202,202,65305,117,110,105,120,58,103,101,116,101,
-                       110,118,0,2049,5703,115,97,45,0,1,23584,3,1,14,2049,23061,10,23561,23617,170,
-                       24052,-1615645947,23619,202,202,65804,117,110,105,120,58,112,117,116,101,110,118,0,2049,5703,
-                       115,45,0,1,23619,3,1,15,2049,23061,10,23596,23650,170,24052,-1477396740,23652,202,202,65902,
-                       117,110,105,120,58,115,108,101,101,112,0,2049,5703,110,45,0,1,23652,3,1,
-                       16,2049,23061,10,23630,23685,170,24052,1296565974,23687,202,202,64838,117,110,105,120,58,101,120,
-                       101,99,117,116,101,0,2049,5703,115,45,0,1,23687,3,1,17,2049,23061,10,23663,
-                       23717,170,24052,1647076497,23719,202,202,65495,117,110,105,120,58,112,105,112,101,0,2049,5703,
-                       115,45,115,0,1,23719,3,1,0,2049,23479,1,22723,1,23515,2049,2923,10,23698,23759,
-                       170,24052,-1143209138,23761,202,202,65268,117,110,105,120,58,103,101,116,45,99,119,100,0,
-                       2049,5703,45,115,41,0,1,23761,3,2049,5703,112,119,100,0,1,23770,2049,23717,2049,
-                       8790,2049,5703,47,0,1,23782,2049,6003,10,23737,23822,170,24052,-960446853,23824,202,202,64423,117,
-                       110,105,120,58,99,111,117,110,116,45,102,105,108,101,115,45,105,110,45,99,
-                       119,100,0,2049,5703,45,110,0,1,23824,3,2049,5703,108,115,32,45,49,32,124,
-                       32,119,99,32,45,108,0,1,23832,2049,23717,2049,8790,2049,290,10,23789,23883,170,24052,
-                       1737547061,23885,202,202,65048,117,110,105,120,58,102,111,114,45,101,97,99,104,45,102,
-                       105,108,101,0,2049,5703,113,45,0,1,23885,3,2049,5703,108,115,32,45,49,32,
-                       45,112,0,1,23893,1,0,2049,23479,2049,23822,1793,23926,1793,23921,2049,22723,2049,5644,67502597,
-                       8,10,1,23914,2049,2905,10,1,23912,2049,3153,2049,23515,3,10,23855,23949,170,0,274811347,
-                       0,202,202,0,115,116,97,114,116,0,4,2049,5198,1,0,2049,23479,10,23934,23971,
-                       170,0,2090683713,0,202,202,0,114,101,97,100,0,2,2049,22027,2,2049,5082,2049,3470,
-                       10,23957,23996,170,0,-42507930,0,202,202,0,102,105,110,105,115,104,0,2049,23515,2049,
-                       5172,10,23855,24026,170,24052,-1528406284,24028,202,202,65945,117,110,105,120,58,115,108,117,114,
-                       112,45,112,105,112,101,0,2049,5703,97,115,45,110,0,1,24028,3,1793,24047,2049,
-                       23949,1,23971,2049,3093,2049,23996,10,1,24038,2049,5228,10,105,110,116,101,114,102,97,
-                       99,101,47,117,110,105,120,46,114,101,116,114,111,0,24052,24175,24001,24093,170,24155,
-                       -2118913842,24095,202,202,55565,110,58,114,97,110,100,111,109,0,2049,5703,45,110,0,1,
-                       24095,3,1,10,2049,13215,2,2049,3517,1793,24148,3,2049,5703,69,114,114,111,114,58,
-                       32,82,78,71,32,100,101,118,105,99,101,32,110,111,116,32,102,111,117,110,
-                       100,0,1,24113,2049,13341,2049,13286,10,1,24110,2049,3638,2049,13192,10,105,110,116,101,
-                       114,102,97,99,101,47,114,110,103,46,114,101,116,114,111,0,24155,24754,24075,24202,
-                       170,24732,198751996,24204,202,202,40261,99,108,111,99,107,58,111,112,101,114,97,116,105,
-                       111,110,0,2049,5703,110,45,0,1,24204,3,1,5,2049,13215,2,2049,3517,1793,24259,
-                       3,2049,5703,69,114,114,111,114,58,32,99,108,111,99,107,32,100,101,118,105,
-                       99,101,32,110,111,116,32,102,111,117,110,100,0,1,24222,2049,13341,2049,13286,10,
-                       1,24219,2049,3638,2049,13192,10,24177,24291,170,24732,658409087,24293,202,202,40403,99,108,111,99,
-                       107,58,116,105,109,101,115,116,97,109,112,0,2049,5703,45,110,0,1,24293,3,
-                       1,0,2049,24202,10,24266,24323,170,24732,-115155671,24325,202,202,40021,99,108,111,99,107,58,
-                       100,97,121,0,2049,5703,45,110,0,1,24325,3,1,1,2049,24202,10,24304,24357,170,
-                       24732,-839305775,24359,202,202,40189,99,108,111,99,107,58,109,111,110,116,104,0,2049,5703,
-                       45,110,0,1,24359,3,1,2,2049,24202,10,24336,24390,170,24732,495588508,24392,202,202,40716,
-                       99,108,111,99,107,58,121,101,97,114,0,2049,5703,45,110,0,1,24392,3,1,
-                       3,2049,24202,10,24370,24423,170,24732,494989129,24425,202,202,40045,99,108,111,99,107,58,104,
-                       111,117,114,0,2049,5703,45,110,0,1,24425,3,1,4,2049,24202,10,24403,24458,170,
-                       24732,-1934400739,24460,202,202,40116,99,108,111,99,107,58,109,105,110,117,116,101,0,2049,
-                       5703,45,110,0,1,24460,3,1,5,2049,24202,10,24436,24493,170,24732,-1704734105,24495,202,202,
-                       40330,99,108,111,99,107,58,115,101,99,111,110,100,0,2049,5703,45,110,0,1,
-                       24495,3,1,6,2049,24202,10,24471,24529,170,24732,-1548566609,24531,202,202,40520,99,108,111,99,
-                       107,58,117,116,99,58,100,97,121,0,2049,5703,45,110,0,1,24531,3,1,7,
-                       2049,24202,10,24506,24567,170,24732,1544278487,24569,202,202,40617,99,108,111,99,107,58,117,116,
-                       99,58,109,111,110,116,104,0,2049,5703,45,110,0,1,24569,3,1,8,2049,24202,
-                       10,24542,24604,170,24732,437667810,24606,202,202,40684,99,108,111,99,107,58,117,116,99,58,
-                       121,101,97,114,0,2049,5703,45,110,0,1,24606,3,1,9,2049,24202,10,24580,24641,
-                       170,24732,437068431,24643,202,202,40551,99,108,111,99,107,58,117,116,99,58,104,111,117,
-                       114,0,2049,5703,45,110,0,1,24643,3,1,10,2049,24202,10,24617,24680,170,24732,-585531421,
-                       24682,202,202,40583,99,108,111,99,107,58,117,116,99,58,109,105,110,117,116,101,
-                       0,2049,5703,45,110,0,1,24682,3,1,11,2049,24202,10,24654,24719,170,24732,-355864787,24721,
-                       202,202,40650,99,108,111,99,107,58,117,116,99,58,115,101,99,111,110,100,0,
-                       2049,5703,45,110,0,1,24721,3,1,12,2049,24202,10,105,110,116,101,114,102,97,
-                       99,101,47,99,108,111,99,107,46,114,101,116,114,111,0,24732,25278,24693,24782,170,
-                       0,1615087013,0,202,202,0,115,99,114,105,112,116,58,111,112,101,114,97,116,105,
-                       111,110,0,1,9,2049,13215,2,2049,3517,1793,24835,3,2049,5703,69,114,114,111,114,
-                       58,32,115,99,114,105,112,116,105,110,103,32,100,101,118,105,99,101,32,110,
-                       111,116,32,102,111,117,110,100,0,1,24794,2049,13341,2049,13286,10,1,24791,2049,3638,
-                       2049,13192,10,24693,24868,170,25252,2076096266,24870,202,202,61200,115,99,114,105,112,116,58,97,
-                       114,103,117,109,101,110,116,115,0,2049,5703,45,110,0,1,24870,3,1,0,2049,
-                       24782,10,24842,24910,170,25252,-968823164,24912,202,202,61616,115,99,114,105,112,116,58,103,101,
-                       116,45,97,114,103,117,109,101,110,116,0,2049,5703,110,45,115,0,1,24912,3,
-                       2049,5678,4,1,1,2049,24782,10,24881,24944,170,25252,-1640583287,24946,202,202,53076,105,110,99,
-                       108,117,100,101,0,2049,5703,115,45,0,1,24946,3,1,2,2049,24782,10,24927,24978,
-                       170,25252,-352813579,24980,202,202,61784,115,99,114,105,112,116,58,110,97,109,101,0,2049,
-                       5703,45,115,0,1,24980,3,2049,5678,1,3,2049,24782,10,24957,25022,170,25252,1275782788,25024,
-                       202,202,61254,115,99,114,105,112,116,58,99,117,114,114,101,110,116,45,102,105,
-                       108,101,0,2049,5703,45,115,0,1,25024,3,2049,5678,1,4,2049,24782,10,24993,25066,
-                       182,25252,1275998476,25068,202,202,61381,115,99,114,105,112,116,58,99,117,114,114,101,110,
-                       116,45,108,105,110,101,0,2049,5703,45,110,0,1,25068,3,1,5,2049,24782,2049,
-                       158,10,25037,25111,170,25252,-1015360939,25113,202,202,61675,115,99,114,105,112,116,58,105,103,
-                       110,111,114,101,45,116,111,45,101,111,108,0,2049,5703,45,0,1,25113,3,1,
-                       6,2049,24782,10,25081,25153,170,25252,465657533,25155,202,202,61075,115,99,114,105,112,116,58,
-                       97,98,111,114,116,45,105,110,99,108,117,100,101,0,2049,5703,45,0,1,25155,
-                       3,1,7,2049,24782,10,25123,25180,170,25252,252833149,25182,202,202,36523,97,98,111,114,116,
-                       0,2049,5703,45,0,1,25182,3,1,151,2049,4846,1,8,2049,24782,10,25165,25230,170,
-                       25252,1895981246,25232,202,202,61538,115,99,114,105,112,116,58,99,117,114,114,101,110,116,
-                       45,108,105,110,101,45,116,101,120,116,0,2049,5703,45,115,0,1,25232,3,2049,
-                       5678,1793,25247,1,9,2049,24782,10,1,25242,2049,2905,10,105,110,116,101,114,102,97,
-                       99,101,47,115,99,114,105,112,116,105,110,103,46,114,101,116,114,111,0,25252,
-                       25884,25196,25306,170,25886,321067545,25308,202,202,63385,115,111,99,107,101,116,58,111,112,101,
-                       114,97,116,105,111,110,0,2049,5703,110,45,0,1,25308,3,1,7,2049,13215,2,
-                       2049,3517,1793,25471,3,2049,5703,69,114,114,111,114,58,32,115,111,99,107,101,116,
-                       32,100,101,118,105,99,101,32,110,111,116,32,102,111,117,110,100,0,1,25326,
-                       2049,13341,2049,13286,2049,5703,83,101,101,32,104,116,116,112,115,58,47,47,114,101,
-                       116,114,111,102,111,114,116,104,46,111,114,103,47,115,117,112,112,111,114,116,
-                       47,50,48,50,50,46,49,47,83,79,67,75,69,84,83,46,109,100,0,1,
-                       25365,2049,13341,2049,13286,2049,5703,102,111,114,32,105,110,115,116,114,117,99,116,105,
-                       111,110,115,32,111,110,32,101,110,97,98,108,105,110,103,32,115,111,99,107,
-                       101,116,115,46,0,1,25426,2049,13341,2049,13286,10,1,25323,2049,3638,2049,13192,10,25280,
-                       25508,170,25860,2071663234,25510,202,202,63095,115,111,99,107,101,116,58,103,101,116,104,111,
-                       115,116,98,121,110,97,109,101,0,2049,5703,97,115,45,0,1,25510,3,1,0,
-                       2049,25306,10,25478,25545,170,25860,-196324068,25547,202,202,63074,115,111,99,107,101,116,58,99,
-                       114,101,97,116,101,0,2049,5703,45,110,0,1,25547,3,1,1,2049,25306,10,25522,
-                       25579,170,25860,-773240955,25581,202,202,62771,115,111,99,107,101,116,58,98,105,110,100,0,
-                       2049,5703,115,110,45,110,0,1,25581,3,1,2,2049,25306,10,25558,25617,170,25860,145744503,
-                       25619,202,202,63229,115,111,99,107,101,116,58,108,105,115,116,101,110,0,2049,5703,
-                       110,110,45,110,110,0,1,25619,3,1,3,2049,25306,10,25594,25656,170,25860,-292451304,25658,
-                       202,202,62702,115,111,99,107,101,116,58,97,99,99,101,112,116,0,2049,5703,110,
-                       45,110,110,0,1,25658,3,1,4,2049,25306,10,25633,25695,170,25860,2004958354,25697,202,202,
-                       62985,115,111,99,107,101,116,58,99,111,110,110,101,99,116,0,2049,5703,110,45,
-                       110,110,0,1,25697,3,1,5,2049,25306,10,25671,25731,170,25860,-772634382,25733,202,202,63625,
-                       115,111,99,107,101,116,58,115,101,110,100,0,2049,5703,115,110,45,110,110,0,
-                       1,25733,3,1,6,2049,25306,10,25710,25768,170,25860,-772670664,25770,202,202,63455,115,111,99,
-                       107,101,116,58,114,101,99,118,0,2049,5703,97,110,110,45,110,110,0,1,25770,
-                       3,1,7,2049,25306,10,25747,25807,170,25860,254147678,25809,202,202,62884,115,111,99,107,101,
-                       116,58,99,108,111,115,101,0,2049,5703,110,45,0,1,25809,3,1,8,2049,25306,
-                       10,25785,25846,170,25860,1248070378,25848,202,202,62900,115,111,99,107,101,116,58,99,111,110,
-                       102,105,103,117,114,101,0,2049,5703,115,115,45,0,1,25848,3,1,9,2049,25306,
-                       10,105,110,116,101,114,102,97,99,101,47,115,111,99,107,101,116,115,46,114,
-                       101,116,114,111,0,25860,25903,115,111,99,107,101,116,58,111,112,101,114,97,116,
-                       105,111,110,0,25886,26211,25820,25922,170,26185,-1650400160,25924,202,202,53322,105,111,58,99,111,
-                       114,101,0,2049,5703,110,45,0,1,25924,3,1,8000,2049,13215,2049,13192,10,25905,25956,
-                       170,26185,-1507548164,25958,202,202,41423,99,111,114,101,58,105,110,105,116,0,2049,5703,110,
-                       45,0,1,25958,3,1,0,2049,25922,10,25937,25989,170,26185,1802584310,25991,202,202,41751,99,
-                       111,114,101,58,115,116,97,114,116,0,2049,5703,97,110,45,0,1,25991,3,1,
-                       1,2049,25922,10,25969,26023,170,26185,1798365542,26025,202,202,41551,99,111,114,101,58,112,97,
-                       117,115,101,0,2049,5703,110,45,0,1,26025,3,1,2,2049,25922,10,26003,26064,170,
-                       26185,-911635434,26066,202,202,41583,99,111,114,101,58,112,97,117,115,101,45,99,117,114,
-                       114,101,110,116,0,2049,5703,45,0,1,26066,3,1,3,2049,25922,10,26036,26097,170,
-                       26185,-700534119,26099,202,202,41675,99,111,114,101,58,114,101,115,117,109,101,0,2049,5703,
-                       110,45,0,1,26099,3,1,4,2049,25922,10,26076,26133,170,26185,895714865,26135,202,202,41623,
-                       99,111,114,101,58,114,101,97,100,47,114,101,103,0,2049,5703,110,45,118,0,
-                       1,26135,3,1,5,2049,25922,10,26110,26171,170,26185,-1200921056,26173,202,202,41823,99,111,114,
-                       101,58,119,114,105,116,101,47,114,101,103,0,2049,5703,118,110,45,0,1,26173,
-                       3,1,6,2049,25922,10,105,110,116,101,114,102,97,99,101,47,109,117,108,116,
-                       105,99,111,114,101,46,114,101,116,114,111,0,26185,26420,26147,26236,170,26400,2042654789,26238,
-                       202,202,49381,102,102,105,58,111,112,101,114,97,116,105,111,110,0,2049,5703,110,
-                       45,63,0,1,26238,3,1,8100,2049,13215,2,2049,3517,1793,26292,3,2049,5703,69,114,
-                       114,111,114,58,32,70,70,73,32,100,101,118,105,99,101,32,110,111,116,32,
-                       102,111,117,110,100,0,1,26257,2049,13341,2049,13286,10,1,26254,2049,3638,2049,13192,10,
-                       26213,26317,170,26400,1122521030,26319,202,202,49343,102,102,105,58,111,112,101,110,0,2049,5703,
-                       115,45,110,0,1,26319,3,1,0,2049,26236,10,26299,26352,170,26400,-1453717192,26354,202,202,
-                       49266,102,102,105,58,109,97,112,45,115,121,109,0,2049,5703,115,110,45,110,0,
-                       1,26354,3,1,1,2049,26236,10,26331,26387,170,26400,-1876846240,26389,202,202,49184,102,102,105,
-                       58,105,110,118,111,107,101,0,2049,5703,110,45,0,1,26389,3,1,2,2049,26236,
-                       10,105,110,116,101,114,102,97,99,101,47,102,102,105,46,114,101,116,114,111,
-                       0,26400,26910,26367,26442,170,26885,-931970681,26444,202,202,66434,117,110,115,105,103,110,101,100,
-                       58,43,0,2049,5703,110,110,45,110,0,1,26444,3,1,0,1,8101,2049,13215,2049,
-                       13192,17,10,26422,26482,170,26885,-931970679,26484,202,202,66474,117,110,115,105,103,110,101,100,
-                       58,45,0,2049,5703,110,110,45,110,0,1,26484,3,1,0,1,8101,2049,13215,2049,
-                       13192,18,10,26462,26522,170,26885,-931970682,26524,202,202,66287,117,110,115,105,103,110,101,100,
-                       58,42,0,2049,5703,110,110,45,110,0,1,26524,3,1,0,1,8101,2049,13215,2049,
-                       13192,19,10,26502,26565,170,26885,-75122677,26567,202,202,66615,117,110,115,105,103,110,101,100,
-                       58,47,109,111,100,0,2049,5703,110,110,45,110,110,0,1,26567,3,1,0,1,
-                       8101,2049,13215,2049,13192,20,10,26542,26608,170,26885,-1303722799,26610,202,202,66692,117,110,115,105,
-                       103,110,101,100,58,101,113,63,0,2049,5703,110,110,45,102,0,1,26610,3,1,
-                       0,1,8101,2049,13215,2049,13192,11,10,26586,26651,170,26885,-75203234,26653,202,202,66521,117,110,
-                       115,105,103,110,101,100,58,45,101,113,63,0,2049,5703,110,110,45,102,0,1,
-                       26653,3,1,0,1,8101,2049,13215,2049,13192,12,10,26628,26693,170,26885,-1303715077,26695,202,202,
-                       66861,117,110,115,105,103,110,101,100,58,108,116,63,0,2049,5703,110,110,45,102,
-                       0,1,26695,3,1,0,1,8101,2049,13215,2049,13192,13,10,26671,26735,170,26885,-1303720522,26737,
-                       202,202,66780,117,110,115,105,103,110,101,100,58,103,116,63,0,2049,5703,110,110,
-                       45,102,0,1,26737,3,1,0,1,8101,2049,13215,2049,13192,14,10,26713,26779,170,26885,
-                       1896375546,26781,202,202,66939,117,110,115,105,103,110,101,100,58,115,104,105,102,116,0,
-                       2049,5703,110,110,45,110,0,1,26781,3,1,0,1,8101,2049,13215,2049,13192,24,10,
-                       26755,26823,170,26885,1807759541,26825,202,202,66332,117,110,115,105,103,110,101,100,58,42,47,
-                       109,111,100,0,2049,5703,110,110,110,45,110,110,0,1,26825,3,1,1,1,0,
-                       1,8101,2049,13215,2,2049,13192,2049,13192,10,26799,26864,170,26885,185772414,26866,202,202,28668,42,
-                       47,109,111,100,0,2049,5703,110,110,110,45,110,110,0,1,26866,3,1,1,1,
-                       8101,2049,13215,2049,13192,10,105,110,116,101,114,102,97,99,101,47,117,110,115,105,
-                       103,110,101,100,46,114,101,116,114,111,0,26885,27144,26849,26926,158,0,2089576476,0,202,
-                       202,0,83,107,105,112,0,0,26912,26949,170,0,1388979734,0,202,202,0,98,108,111,
-                       99,107,58,105,110,118,111,107,101,0,1,3,2049,13215,2049,13192,10,26849,26976,170,
-                       27121,427535558,26978,202,202,37321,98,108,111,99,107,58,114,101,97,100,0,2049,5703,110,
-                       97,45,0,1,26978,3,1793,26991,3841,26926,17,10,1,26987,2049,2889,1,0,2049,26949,
-                       10,26956,27021,170,27121,1230177653,27023,202,202,37534,98,108,111,99,107,58,119,114,105,116,
-                       101,0,2049,5703,110,97,45,0,1,27023,3,1793,27036,3841,26926,17,10,1,27032,2049,
-                       2889,1,1,2049,26949,10,27000,27069,170,27121,-1436880765,27071,202,202,37397,98,108,111,99,107,
-                       58,115,101,116,45,102,105,108,101,0,2049,5703,115,45,0,1,27071,3,1,2,
-                       2049,26949,10,27045,27110,170,27121,928457859,27112,202,202,37444,98,108,111,99,107,58,115,101,
-                       116,45,114,101,115,101,114,118,101,100,0,2049,5703,110,45,0,1,27112,3,4097,
-                       26926,10,105,110,116,101,114,102,97,99,101,47,98,108,111,99,107,115,46,114,
-                       101,116,114,111,0,27121,27716,27082,27171,170,27437,-686480257,27173,202,202,45380,101,114,114,58,
-                       115,101,116,45,104,97,110,100,108,101,114,0,2049,5703,110,110,45,0,1,27173,
-                       3,1,1234,2049,13215,2,2049,3517,1793,27238,3,2049,5703,69,114,114,111,114,58,32,
-                       101,114,114,111,114,32,104,97,110,100,108,105,110,103,32,100,101,118,105,99,
-                       101,32,110,111,116,32,102,111,117,110,100,0,1,27192,2049,13341,2049,13286,10,1,
-                       27189,2049,3638,1,0,4,2049,13192,10,27146,27265,170,27437,1955994964,27267,202,202,45212,101,114,
-                       114,58,100,115,117,0,2049,5703,45,0,1,27267,3,2049,13402,2049,13286,2049,5703,69,
-                       82,82,79,82,58,32,68,83,85,58,32,68,65,84,65,32,83,84,65,67,
-                       75,32,85,78,68,69,82,70,76,79,87,0,1,27278,2049,13341,2049,13286,2049,13535,
-                       10,27248,27337,170,27437,1955994958,27339,202,202,45174,101,114,114,58,100,115,111,0,2049,5703,
-                       45,0,1,27339,3,2049,13402,2049,13286,2049,5703,69,82,82,79,82,58,32,68,83,
-                       79,58,32,68,65,84,65,32,83,84,65,67,75,32,79,86,69,82,70,76,
-                       79,87,0,1,27350,2049,13341,2049,13286,2049,13535,10,27320,27417,170,27437,700502841,27419,202,202,
-                       45325,101,114,114,58,115,101,116,45,100,101,102,97,117,108,116,115,0,2049,5703,
-                       45,0,1,27419,3,1,27265,1,1,2049,27171,1,27337,1,2,2049,27171,10,105,110,
-                       116,101,114,102,97,99,101,47,101,114,114,111,114,46,114,101,116,114,111,0,
-                       27391,5,158,0,890660657,0,202,202,0,75,69,82,78,69,76,58,68,58,76,79,
-                       79,75,85,80,45,67,79,77,80,65,82,65,84,79,82,45,79,70,70,83,
-                       69,84,0,27459,8,158,0,504129634,0,202,202,0,75,69,82,78,69,76,58,68,
-                       58,76,79,79,75,85,80,45,75,69,89,45,79,70,70,83,69,84,0,27502,
-                       2049,158,0,1194596711,0,202,202,0,78,71,65,58,79,80,58,76,73,67,65,0,
-                       27538,27581,170,27682,-1827032295,27583,202,202,43688,100,58,117,115,101,45,104,97,115,104,101,
-                       115,0,2049,5703,45,0,1,27583,3,1,29,1,260,1,5,18,16,1793,27602,2049,
-                       190,15,10,1,27598,1,260,1,8,18,16,1,2049,1,260,16,3841,9,1,260,
-                       2049,3925,16,10,27559,27646,170,27682,1901154183,27648,202,202,43744,100,58,117,115,101,45,115,
-                       116,114,105,110,103,115,0,2049,5703,45,0,1,27648,3,1,120,1,260,1,5,
-                       18,16,1,200,1,260,1,8,18,16,1,0,1,260,16,1,0,1,260,2049,
-                       3925,16,10,105,110,116,101,114,102,97,99,101,47,104,97,115,104,101,100,45,
-                       100,105,99,116,105,111,110,97,114,121,46,114,101,116,114,111,0,27682,28274,27623,
-                       2,158,0,113133676,0,202,202,0,75,69,82,78,69,76,58,68,58,65,68,68,
-                       45,72,69,65,68,69,82,45,66,79,68,89,45,79,70,70,83,69,84,0,
-                       1793,27780,1,204,1,2,17,8,2049,2100,2049,200,3841,9,8,2049,2100,2049,190,16,
-                       10,1,27761,27718,4096,158,0,8676415,0,202,202,0,76,73,66,82,65,82,89,58,
-                       72,79,77,69,45,66,85,70,70,69,82,45,67,65,80,65,67,73,84,89,
-                       0,27782,27834,170,28250,2089149710,27836,202,202,32373,72,79,77,69,0,2049,5703,45,115,0,
-                       1,27836,3,2049,2585,1,4096,17,10,37,115,47,46,99,111,110,102,105,103,47,
-                       114,101,116,114,111,102,111,114,116,104,47,108,105,98,114,97,114,121,47,37,
-                       115,46,114,101,116,114,111,0,27820,27848,158,28250,1492345816,27914,202,202,53721,108,105,98,
-                       114,97,114,121,58,46,67,79,78,70,73,71,0,45,115,0,46,47,108,105,
-                       98,114,97,114,121,47,37,115,46,114,101,116,114,111,0,27887,27915,158,28250,-516195150,
-                       27957,202,202,53922,108,105,98,114,97,114,121,58,67,87,68,0,45,115,0,27934,
-                       27979,170,28250,-516159214,27981,202,202,54020,108,105,98,114,97,114,121,58,99,119,100,0,
-                       2049,5703,115,45,115,0,1,27981,3,1,27915,2049,10234,10,27958,28018,170,28250,-1511153512,28020,
-                       202,202,53804,108,105,98,114,97,114,121,58,46,99,111,110,102,105,103,0,2049,
-                       5703,45,115,0,1,28020,3,2049,5703,72,79,77,69,0,1,28028,2049,27834,2049,23582,
-                       2049,27834,1,27848,2049,10234,10,27993,28072,170,28250,-666395371,28074,202,202,54085,108,105,98,114,
-                       97,114,121,58,102,105,108,101,110,97,109,101,0,2049,5703,115,45,115,0,1,
-                       28074,3,2,2049,27979,2,2049,22416,1,2816,2049,3638,3,2049,28018,2,2049,22416,1793,28100,
-                       10,1,28099,2049,3638,3,2049,5678,10,28046,28135,170,28250,-916721742,28137,202,202,53986,108,105,
-                       98,114,97,114,121,58,99,111,110,116,97,105,110,115,63,0,2049,5703,115,45,
-                       102,0,1,28137,3,1,27979,1,28018,2049,2923,1,22416,2049,2961,22,10,28108,28178,170,
-                       28250,146929844,28180,202,202,54146,108,105,98,114,97,114,121,58,108,111,97,100,0,2049,
-                       5703,115,45,0,1,28180,3,2,2049,28135,1793,28196,2049,28072,2049,24944,10,1,28191,1793,
-                       28245,2049,5703,69,82,82,79,82,58,32,76,105,98,114,97,114,121,32,96,37,
-                       115,96,32,119,97,115,32,110,111,116,32,102,111,117,110,100,0,1,28202,2049,
-                       10234,2049,13341,2049,13286,10,1,28200,2049,68,10,105,110,116,101,114,102,97,99,101,
-                       47,108,105,98,114,97,114,121,46,114,101,116,114,111,0,28250,28485,28156,28303,170,
-                       28456,-1980891296,28305,202,202,28334,100,58,115,101,116,45,100,101,115,99,114,105,112,116,
-                       105,111,110,0,2049,5703,115,115,45,0,1,28305,3,2049,260,2,2049,3492,1793,28327,
-                       2049,198,1,5735,2049,2889,16,10,1,28319,1,2837,2049,68,10,97,100,100,32,97,
-                       32,100,101,115,99,114,105,112,116,105,111,110,32,116,111,32,97,32,119,111,
-                       114,100,0,28276,28387,170,28456,-562402433,28389,202,202,28403,97,100,100,45,100,101,115,99,
-                       114,105,112,116,105,111,110,0,2049,5703,115,45,0,1,28389,3,2049,5735,2049,2100,
-                       2049,198,16,10,97,100,100,32,97,32,100,101,115,99,114,105,112,116,105,111,
-                       110,32,102,111,114,32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,
-                       116,108,121,32,100,101,102,105,110,101,100,32,119,111,114,100,0,105,110,116,
-                       101,114,102,97,99,101,47,100,101,115,99,114,105,112,116,105,111,110,115,46,
-                       114,101,116,114,111,0,28456,14386,82,101,116,117,114,110,32,65,83,67,73,73,
-                       58,78,85,76,32,40,48,41,46,0,82,101,116,117,114,110,32,97,110,32,
-                       101,109,112,116,121,32,115,116,114,105,110,103,46,0,80,114,111,118,105,100,
-                       101,32,97,32,118,105,115,117,97,108,32,105,110,100,105,99,97,116,105,111,
-                       110,32,111,102,32,97,32,99,111,100,101,32,103,114,111,117,112,46,0,80,
-                       114,111,118,105,100,101,32,97,32,118,105,115,117,97,108,32,105,110,100,105,
-                       99,97,116,105,111,110,32,111,102,32,97,32,99,111,100,101,32,103,114,111,
-                       117,112,46,0,77,117,108,116,105,112,108,121,32,96,110,49,96,32,98,121,
-                       32,96,110,50,96,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,
-                       32,114,101,115,117,108,116,46,0,77,117,108,116,105,112,108,121,32,96,120,
-                       96,32,98,121,32,96,121,96,32,97,110,100,32,116,104,101,110,32,100,105,
-                       118,105,100,101,32,98,121,32,96,122,96,32,97,110,100,32,114,101,116,117,
-                       114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,112,97,114,116,32,
-                       111,102,32,116,104,101,32,113,117,111,116,105,101,110,116,32,97,110,100,32,
-                       114,101,109,97,105,110,100,101,114,46,0,65,100,100,32,96,110,49,96,32,
-                       116,111,32,96,110,50,96,32,97,110,100,32,114,101,116,117,114,110,32,116,
-                       104,101,32,114,101,115,117,108,116,46,0,83,116,111,114,101,32,116,104,101,
-                       32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,101,32,105,110,116,
-                       111,32,116,104,101,32,109,101,109,111,114,121,32,97,116,32,96,104,101,114,
-                       101,96,32,97,110,100,32,105,110,99,114,101,109,101,110,116,32,96,72,101,
-                       97,112,96,32,98,121,32,49,46,0,83,117,98,116,114,97,99,116,32,96,
-                       110,50,96,32,102,114,111,109,32,96,110,49,96,32,97,110,100,32,114,101,
-                       116,117,114,110,32,116,104,101,32,114,101,115,117,108,116,46,0,83,119,105,
-                       116,99,104,32,116,111,32,116,104,101,32,101,120,112,111,115,101,100,32,40,
-                       112,117,98,108,105,99,41,32,112,111,114,116,105,111,110,32,111,102,32,97,
-                       32,108,101,120,105,99,97,108,32,110,97,109,101,115,112,97,99,101,46,0,
-                       67,111,109,112,97,114,101,32,116,119,111,32,118,97,108,117,101,115,32,102,
-                       111,114,32,105,110,101,113,117,97,108,105,116,121,46,32,82,101,116,117,114,
-                       110,115,32,96,84,82,85,69,96,32,105,102,32,116,104,101,121,32,97,114,
-                       101,32,110,111,116,32,101,113,117,97,108,32,111,114,32,96,70,65,76,83,
-                       69,96,32,111,116,104,101,114,119,105,115,101,46,0,69,120,101,99,117,116,
-                       101,32,116,104,101,32,113,117,111,116,97,116,105,111,110,32,105,102,32,116,
-                       104,101,32,102,108,97,103,32,105,115,32,96,70,65,76,83,69,96,46,0,
-                       69,120,101,99,117,116,101,32,116,104,101,32,113,117,111,116,97,116,105,111,
-                       110,32,105,102,32,116,104,101,32,102,108,97,103,32,105,115,32,96,70,65,
-                       76,83,69,96,46,32,73,102,32,102,97,108,115,101,44,32,97,108,115,111,
-                       32,101,120,105,116,32,116,104,101,32,119,111,114,100,46,0,68,105,118,105,
-                       100,101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,32,114,101,
-                       116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,112,97,114,
-                       116,32,111,102,32,116,104,101,32,113,117,111,116,105,101,110,116,46,0,68,
-                       105,118,105,100,101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,
-                       32,114,101,116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,
-                       112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,105,101,110,116,
-                       32,97,110,100,32,114,101,109,97,105,110,100,101,114,46,0,73,102,32,96,
-                       110,96,32,105,115,32,122,101,114,111,44,32,100,114,111,112,32,96,110,96,
-                       32,97,110,100,32,101,120,105,116,32,116,104,101,32,99,117,114,114,101,110,
-                       116,32,119,111,114,100,46,32,73,102,32,110,111,110,45,122,101,114,111,44,
-                       32,108,101,97,118,101,32,96,110,96,32,97,108,111,110,101,32,97,110,100,
-                       32,97,108,108,111,119,32,101,120,101,99,117,116,105,111,110,32,116,111,32,
-                       99,111,110,116,105,110,117,101,46,0,69,110,100,32,116,104,101,32,99,117,
-                       114,114,101,110,116,32,100,101,102,105,110,105,116,105,111,110,46,0,68,117,
-                       112,108,105,99,97,116,101,32,116,111,112,32,118,97,108,117,101,32,111,110,
-                       32,115,116,97,99,107,32,105,102,32,110,111,116,32,122,101,114,111,46,32,
-                       73,102,32,122,101,114,111,44,32,100,111,32,110,111,116,104,105,110,103,46,
-                       0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,
-                       32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,
-                       46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
-                       111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
-                       101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,
-                       116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,
-                       100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
-                       32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
-                       111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,
-                       115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,
-                       99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
-                       114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
-                       32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,
-                       101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,
-                       73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,
-                       102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
-                       73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,
-                       101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,
-                       67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,
-                       82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
-                       83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,
-                       32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,
-                       65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,
-                       46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
-                       32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,
-                       116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,
-                       99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,
-                       110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
-                       105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,
-                       97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,
-                       102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,
-                       116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
-                       105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,
-                       115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,
-                       99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,
-                       110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,
-                       101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,
-                       111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,
-                       112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,
-                       67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,
-                       115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
-                       0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,
-                       32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,
-                       46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
-                       111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
-                       101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,
-                       116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,
-                       100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
-                       32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
-                       111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,
-                       115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,
-                       99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
-                       114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
-                       32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,102,
-                       101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,
-                       73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,101,
-                       102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
-                       73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,82,
-                       101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,
-                       67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,32,
-                       82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
-                       83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,46,
-                       32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,
-                       65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,116,
-                       46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
-                       32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,110,
-                       116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,
-                       99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,97,
-                       110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
-                       105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,67,111,110,115,116,
-                       97,110,116,46,32,82,101,116,117,114,110,32,97,32,98,117,105,108,100,32,
-                       105,100,101,110,116,105,102,105,101,114,46,32,85,115,101,32,97,108,111,110,
-                       103,32,119,105,116,104,32,118,101,114,115,105,111,110,32,116,111,32,105,100,
-                       101,110,116,105,102,121,32,97,110,32,105,109,97,103,101,46,0,86,97,114,
-                       105,97,98,108,101,46,32,72,111,108,100,115,32,116,104,101,32,99,117,114,
-                       114,101,110,116,32,110,117,109,101,114,105,99,32,98,97,115,101,46,32,66,
-                       97,115,101,32,109,117,115,116,32,98,101,32,105,110,32,116,104,101,32,114,
-                       97,110,103,101,32,111,102,32,50,45,49,54,46,0,86,97,114,105,97,98,
-                       108,101,46,32,72,111,108,100,115,32,116,104,101,32,99,111,109,112,105,108,
-                       101,114,32,115,116,97,116,101,46,32,73,102,32,84,82,85,69,44,32,116,
-                       104,101,32,99,111,109,112,105,108,101,114,32,105,115,32,97,99,116,105,118,
-                       101,46,32,73,102,32,70,65,76,83,69,44,32,105,116,32,105,115,32,110,
-                       111,116,46,0,82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,68,
-                       32,102,111,114,32,98,108,111,99,107,32,115,117,112,112,111,114,116,46,0,
-                       82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,
-                       32,99,108,111,99,107,32,119,111,114,100,115,46,0,82,101,116,117,114,110,
-                       32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,101,114,114,111,114,
-                       32,104,97,110,100,108,101,114,115,46,0,82,101,116,117,114,110,32,100,101,
-                       118,105,99,101,32,73,68,32,102,111,114,32,102,111,114,101,105,103,110,32,
-                       102,117,110,99,116,105,111,110,32,105,110,116,101,114,102,97,99,101,46,0,
-                       82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,
-                       32,102,105,108,101,115,121,115,116,101,109,32,97,99,99,101,115,115,46,0,
-                       82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,
-                       32,102,108,111,97,116,105,110,103,32,112,111,105,110,116,46,0,82,101,116,
-                       117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,105,109,
-                       97,103,101,32,119,114,105,116,101,114,46,0,82,101,116,117,114,110,32,100,
-                       101,118,105,99,101,32,73,68,32,102,111,114,32,85,110,105,120,32,73,79,
-                       67,84,76,32,105,110,116,101,114,102,97,99,101,46,0,82,101,116,117,114,
-                       110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,75,101,121,98,
-                       111,97,114,100,32,105,110,112,117,116,46,0,82,101,116,117,114,110,32,100,
-                       101,118,105,99,101,32,73,68,32,102,111,114,32,109,101,109,111,114,121,32,
-                       97,108,108,111,99,97,116,111,114,46,0,82,101,116,117,114,110,32,100,101,
-                       118,105,99,101,32,73,68,32,102,111,114,32,109,117,108,116,105,99,111,114,
-                       101,32,115,117,112,112,111,114,116,46,0,82,101,116,117,114,110,32,100,101,
-                       118,105,99,101,32,73,68,32,102,111,114,32,79,117,116,112,117,116,32,100,
-                       101,118,105,99,101,46,0,82,101,115,101,114,118,101,100,32,100,101,118,105,
-                       99,101,32,73,68,46,0,82,101,115,101,114,118,101,100,32,100,101,118,105,
-                       99,101,32,73,68,46,0,82,101,115,101,114,118,101,100,32,100,101,118,105,
-                       99,101,32,73,68,46,0,82,101,115,101,114,118,101,100,32,100,101,118,105,
-                       99,101,32,73,68,46,0,82,101,116,117,114,110,32,100,101,118,105,99,101,
-                       32,73,68,32,102,111,114,32,114,97,110,100,111,109,32,110,117,109,98,101,
-                       114,32,103,101,110,101,114,97,116,111,114,46,0,82,101,116,117,114,110,32,
-                       100,101,118,105,99,101,32,73,68,32,102,111,114,32,115,99,114,105,112,116,
-                       105,110,103,32,115,117,112,112,111,114,116,46,0,82,101,116,117,114,110,32,
-                       100,101,118,105,99,101,32,73,68,32,102,111,114,32,115,111,99,107,101,116,
-                       115,46,0,82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,
-                       102,111,114,32,117,110,105,120,32,115,121,115,99,97,108,108,46,0,82,101,
-                       116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,117,
-                       110,115,105,103,110,101,100,32,109,97,116,104,115,46,0,86,97,114,105,97,
-                       98,108,101,46,32,72,111,108,100,115,32,97,32,112,111,105,110,116,101,114,
-                       32,116,111,32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,116,32,
-                       100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,114,46,0,85,
-                       115,101,100,32,116,111,32,100,101,110,111,116,101,32,116,104,101,32,101,110,
-                       100,32,111,102,32,97,32,108,105,110,107,101,100,32,108,105,115,116,46,32,
-                       84,104,101,32,108,97,115,116,32,99,111,110,115,32,119,105,108,108,32,104,
-                       97,118,101,32,116,104,101,32,99,100,114,32,112,111,105,110,116,32,116,111,
-                       32,116,104,105,115,32,97,100,100,114,101,115,115,46,0,67,111,110,115,116,
-                       97,110,116,46,32,82,101,116,117,114,110,115,32,116,104,101,32,108,97,115,
-                       116,32,97,100,100,114,101,115,115,97,98,108,101,32,109,101,109,111,114,121,
-                       32,97,100,100,114,101,115,115,46,0,82,101,116,117,114,110,115,32,96,48,
-                       96,44,32,116,104,101,32,118,97,108,117,101,32,117,115,101,100,32,116,111,
-                       32,105,110,100,105,99,97,116,101,32,97,32,70,65,76,83,69,32,114,101,
-                       115,117,108,116,46,0,82,101,116,117,114,110,115,32,116,104,101,32,110,117,
-                       109,98,101,114,32,111,102,32,99,101,108,108,115,32,97,118,97,105,108,97,
-                       98,108,101,32,116,111,32,121,111,117,114,32,97,112,112,108,105,99,97,116,
-                       105,111,110,46,32,84,104,105,115,32,105,115,32,116,104,101,32,97,109,111,
-                       117,110,116,32,111,102,32,109,101,109,111,114,121,44,32,108,101,115,115,32,
-                       116,104,101,32,97,108,114,101,97,100,121,32,99,111,110,115,117,109,101,100,
-                       32,112,111,114,116,105,111,110,32,97,110,100,32,98,117,102,102,101,114,115,
-                       32,109,97,112,112,101,100,32,102,111,114,32,82,101,116,114,111,39,115,32,
-                       105,110,116,101,114,110,97,108,32,117,115,101,46,0,72,111,108,100,32,116,
-                       104,101,32,112,97,116,104,32,116,111,32,116,104,101,32,117,115,101,114,115,
-                       32,104,111,109,101,32,100,105,114,101,99,116,111,114,121,46,32,68,101,102,
-                       105,110,101,100,32,97,115,32,97,32,102,108,111,97,116,105,110,103,32,98,
-                       117,102,102,101,114,32,97,98,111,118,101,32,96,104,101,114,101,96,46,0,
-                       86,97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,116,104,101,32,
-                       97,100,100,114,101,115,115,32,111,102,32,116,104,101,32,110,101,120,116,32,
-                       97,118,97,105,108,97,98,108,101,32,99,101,108,108,46,0,65,99,99,101,
-                       115,115,32,116,104,101,32,108,111,111,112,32,105,110,100,101,120,32,102,111,
-                       114,32,116,104,101,32,99,117,114,114,101,110,116,32,108,111,111,112,46,32,
-                       40,70,111,114,32,108,111,111,112,115,32,109,97,100,101,32,117,115,105,110,
-                       103,32,96,105,110,100,101,120,101,100,45,116,105,109,101,115,96,41,0,86,
-                       97,114,105,97,98,108,101,46,32,87,104,101,110,32,84,82,85,69,44,32,
-                       105,103,110,111,114,101,32,105,110,112,117,116,32,116,111,32,101,110,100,32,
-                       111,102,32,108,105,110,101,46,0,65,99,99,101,115,115,32,116,104,101,32,
-                       112,97,114,101,110,116,32,108,111,111,112,32,105,110,100,101,120,32,102,111,
-                       114,32,116,104,101,32,99,117,114,114,101,110,116,32,108,111,111,112,46,32,
-                       40,70,111,114,32,108,111,111,112,115,32,109,97,100,101,32,117,115,105,110,
-                       103,32,96,105,110,100,101,120,101,100,45,116,105,109,101,115,96,41,0,65,
-                       99,99,101,115,115,32,116,104,101,32,103,114,97,110,100,112,97,114,101,110,
-                       116,32,108,111,111,112,32,105,110,100,101,120,32,102,111,114,32,116,104,101,
-                       32,99,117,114,114,101,110,116,32,108,111,111,112,46,32,40,70,111,114,32,
-                       108,111,111,112,115,32,109,97,100,101,32,117,115,105,110,103,32,96,105,110,
-                       100,101,120,101,100,45,116,105,109,101,115,96,41,0,86,97,114,105,97,98,
-                       108,101,46,32,87,104,101,110,32,115,101,116,32,116,111,32,96,84,82,85,
-                       69,96,44,32,82,101,116,114,111,32,119,105,108,108,32,114,101,112,108,97,
-                       99,101,32,117,110,100,101,114,115,99,111,114,101,115,32,105,110,32,115,116,
-                       114,105,110,103,115,32,119,105,116,104,32,115,112,97,99,101,115,46,32,87,
-                       104,101,110,32,96,70,65,76,83,69,96,44,32,82,101,116,114,111,32,100,
-                       111,101,115,32,110,111,116,46,0,82,101,116,117,114,110,32,116,104,101,32,
-                       97,100,100,114,101,115,115,32,111,102,32,116,104,101,32,115,116,97,114,116,
-                       32,111,102,32,116,104,101,32,116,101,109,112,111,114,97,114,121,32,115,116,
-                       114,105,110,103,32,112,111,111,108,46,32,84,104,105,115,32,99,97,110,32,
-                       98,101,32,97,108,116,101,114,101,100,32,98,121,32,99,104,97,110,103,105,
-                       110,103,32,116,104,101,32,118,97,108,117,101,115,32,111,102,32,96,84,101,
-                       109,112,83,116,114,105,110,103,115,96,32,97,110,100,32,96,84,101,109,112,
-                       83,116,114,105,110,103,77,97,120,96,46,0,86,97,114,105,97,98,108,101,
-                       46,32,84,104,105,115,32,104,111,108,100,115,32,115,111,109,101,32,105,110,
-                       102,111,114,109,97,116,105,111,110,32,117,115,101,100,32,98,121,32,96,123,
-                       123,96,32,97,110,100,32,96,125,125,96,46,0,67,111,110,115,116,97,110,
-                       116,46,32,82,101,116,117,114,110,115,32,97,32,112,111,105,110,116,101,114,
-                       32,116,111,32,116,104,101,32,116,101,120,116,32,105,110,112,117,116,32,98,
-                       117,102,102,101,114,46,0,82,101,116,117,114,110,115,32,96,45,49,96,44,
-                       32,116,104,101,32,118,97,108,117,101,32,117,115,101,100,32,116,111,32,105,
-                       110,100,105,99,97,116,101,32,97,32,84,82,85,69,32,114,101,115,117,108,
-                       116,46,0,86,97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,116,
-                       104,101,32,109,97,120,105,109,117,109,32,108,101,110,103,116,104,32,111,102,
-                       32,97,32,116,101,109,112,111,114,97,114,121,32,115,116,114,105,110,103,46,
-                       0,86,97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,116,104,101,
-                       32,110,117,109,98,101,114,32,111,102,32,116,101,109,112,111,114,97,114,121,
-                       32,115,116,114,105,110,103,115,46,0,71,105,118,101,110,32,97,32,112,111,
-                       105,110,116,101,114,32,116,111,32,97,32,115,116,114,105,110,103,44,32,114,
-                       101,116,117,114,110,32,84,82,85,69,32,105,102,32,108,111,110,103,101,114,
-                       32,116,104,97,110,32,96,84,101,109,112,83,116,114,105,110,103,77,97,120,
-                       96,46,0,73,102,32,115,116,114,105,110,103,32,105,115,32,111,118,101,114,
-                       115,105,122,101,32,40,115,101,101,32,96,115,58,111,118,101,114,115,105,122,
-                       101,63,96,41,44,32,116,114,117,110,99,97,116,101,32,116,111,32,96,84,
-                       101,109,112,83,116,114,105,110,103,77,97,120,96,46,0,86,97,114,105,97,
-                       98,108,101,46,32,84,104,105,115,32,115,116,111,114,101,115,32,116,104,101,
-                       32,118,101,114,115,105,111,110,32,110,117,109,98,101,114,46,0,66,101,103,
-                       105,110,32,97,32,113,117,111,116,97,116,105,111,110,46,0,69,110,100,32,
-                       97,32,113,117,111,116,97,116,105,111,110,46,0,67,111,109,112,97,114,101,
-                       32,97,108,108,32,118,97,108,117,101,115,32,105,110,32,116,104,101,32,97,
-                       114,114,97,121,46,32,82,101,116,117,114,110,32,96,70,65,76,83,69,96,
-                       32,105,102,32,97,108,108,32,118,97,108,117,101,115,32,97,114,101,32,101,
-                       113,117,97,108,32,111,114,32,96,84,82,85,69,96,32,111,116,104,101,114,
-                       119,105,115,101,46,32,84,104,105,115,32,97,115,115,117,109,101,115,32,116,
-                       104,101,32,97,114,114,97,121,32,99,111,110,116,97,105,110,115,32,111,110,
-                       108,121,32,110,117,109,101,114,105,99,32,118,97,108,117,101,115,46,0,82,
-                       101,116,117,114,110,32,97,32,110,101,119,32,97,114,114,97,121,32,99,111,
-                       110,115,105,115,116,105,110,103,32,111,102,32,116,104,101,32,118,97,108,117,
-                       101,115,32,105,110,32,97,49,32,102,111,108,108,111,119,101,100,32,98,121,
-                       32,116,104,101,32,118,97,108,117,101,115,32,105,110,32,97,50,46,0,82,
-                       101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,97,49,32,98,
-                       101,103,105,110,115,32,119,105,116,104,32,97,50,32,111,114,32,96,70,65,
-                       76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,
-                       114,110,32,97,32,110,101,119,32,97,114,114,97,121,32,99,111,110,116,97,
-                       105,110,105,110,103,32,97,108,108,32,98,117,116,32,116,104,101,32,108,97,
-                       115,116,32,118,97,108,117,101,32,105,110,32,116,104,101,32,115,111,117,114,
-                       99,101,32,97,114,114,97,121,46,0,82,101,116,117,114,110,32,96,84,82,
-                       85,69,96,32,105,102,32,116,104,101,32,115,116,114,105,110,103,32,118,97,
-                       108,117,101,32,105,115,32,105,110,32,116,104,101,32,97,114,114,97,121,32,
-                       111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,
-                       46,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,116,
-                       104,101,32,118,97,108,117,101,32,105,115,32,105,110,32,116,104,101,32,97,
-                       114,114,97,121,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,
-                       114,119,105,115,101,46,0,67,111,112,121,32,97,110,32,97,114,114,97,121,
-                       32,40,97,49,41,32,116,111,32,97,32,100,101,115,116,105,110,97,116,105,
-                       111,110,32,40,97,50,41,46,0,82,117,110,32,97,32,113,117,111,116,101,
-                       32,97,110,100,32,99,111,110,115,116,114,117,99,116,32,97,32,110,101,119,
-                       32,97,114,114,97,121,32,102,114,111,109,32,116,104,101,32,114,101,116,117,
-                       114,110,101,100,32,118,97,108,117,101,115,46,32,84,104,101,32,113,117,111,
-                       116,101,32,115,104,111,117,108,100,32,114,101,116,117,114,110,32,116,104,101,
-                       32,118,97,108,117,101,115,32,97,110,100,32,116,104,101,32,110,117,109,98,
-                       101,114,32,111,102,32,118,97,108,117,101,115,32,116,111,32,112,117,116,32,
-                       105,110,116,111,32,116,104,101,32,97,114,114,97,121,46,0,77,97,107,101,
-                       32,97,32,99,111,112,121,32,111,102,32,97,110,32,97,114,114,97,121,46,
-                       32,82,101,116,117,114,110,32,116,104,101,32,97,100,100,114,101,115,115,32,
-                       111,102,32,116,104,101,32,99,111,112,121,46,0,82,101,116,117,114,110,32,
-                       96,84,82,85,69,96,32,105,102,32,97,49,32,101,110,100,115,32,119,105,
-                       116,104,32,97,50,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,
-                       101,114,119,105,115,101,46,0,67,111,109,112,97,114,101,32,97,108,108,32,
-                       118,97,108,117,101,115,32,105,110,32,116,104,101,32,97,114,114,97,121,46,
-                       32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,97,108,
-                       108,32,118,97,108,117,101,115,32,97,114,101,32,101,113,117,97,108,32,111,
-                       114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,
-                       32,84,104,105,115,32,97,115,115,117,109,101,115,32,116,104,101,32,97,114,
-                       114,97,121,32,99,111,110,116,97,105,110,115,32,111,110,108,121,32,110,117,
-                       109,101,114,105,99,32,118,97,108,117,101,115,46,0,70,101,116,99,104,32,
-                       116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,32,
-                       116,104,101,32,115,112,101,99,105,102,105,101,100,32,105,110,100,101,120,32,
-                       105,110,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,114,114,
-                       97,121,46,0,70,111,114,32,101,97,99,104,32,105,116,101,109,32,105,110,
-                       32,116,104,101,32,105,110,105,116,105,97,108,32,97,114,114,97,121,44,32,
-                       114,117,110,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,
-                       111,116,101,46,32,73,102,32,116,104,101,32,113,117,111,116,101,32,114,101,
-                       116,117,114,110,115,32,96,84,82,85,69,96,44,32,99,111,112,121,32,116,
-                       104,101,32,105,116,101,109,32,105,110,116,111,32,97,32,110,101,119,32,97,
-                       114,114,97,121,46,32,73,102,32,96,70,65,76,83,69,96,44,32,100,105,
-                       115,99,97,114,100,32,105,116,46,32,82,101,116,117,114,110,115,32,97,32,
-                       112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,110,101,119,32,97,
-                       114,114,97,121,46,0,82,101,116,117,114,110,32,116,104,101,32,102,105,114,
-                       115,116,32,118,97,108,117,101,32,105,110,32,116,104,101,32,97,114,114,97,
-                       121,46,0,69,120,101,99,117,116,101,32,116,104,101,32,113,117,111,116,101,
-                       32,111,110,99,101,32,102,111,114,32,101,97,99,104,32,105,116,101,109,32,
-                       105,110,32,116,104,101,32,97,114,114,97,121,46,0,67,114,101,97,116,101,
-                       32,97,32,110,101,119,32,97,114,114,97,121,32,119,105,116,104,32,116,104,
-                       101,32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,116,104,101,32,
-                       115,111,117,114,99,101,32,115,116,114,105,110,103,46,0,67,97,108,99,117,
-                       108,97,116,101,32,97,32,104,97,115,104,32,118,97,108,117,101,32,102,111,
-                       114,32,97,32,103,105,118,101,110,32,97,114,114,97,121,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,108,111,99,97,116,105,111,110,32,111,102,32,
-                       116,104,101,32,102,105,114,115,116,32,105,110,115,116,97,110,99,101,32,111,
-                       102,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,
-                       101,32,105,110,32,116,104,101,32,97,114,114,97,121,46,0,82,101,116,117,
-                       114,110,32,116,104,101,32,108,111,99,97,116,105,111,110,32,111,102,32,116,
-                       104,101,32,102,105,114,115,116,32,105,110,115,116,97,110,99,101,32,111,102,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,115,116,114,105,110,
-                       103,32,105,110,32,116,104,101,32,97,114,114,97,121,46,0,82,101,116,117,
-                       114,110,32,97,32,110,101,119,32,97,114,114,97,121,32,119,105,116,104,32,
-                       116,104,101,32,105,110,100,105,99,101,115,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,118,97,108,117,101,32,119,97,115,32,102,111,117,110,
-                       100,32,97,116,32,105,110,32,116,104,101,32,111,114,105,103,105,110,97,108,
-                       32,97,114,114,97,121,46,0,82,101,116,117,114,110,32,97,32,110,101,119,
-                       32,97,114,114,97,121,32,119,105,116,104,32,116,104,101,32,105,110,100,105,
-                       99,101,115,32,111,102,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
-                       32,115,116,114,105,110,103,32,105,110,32,116,104,101,32,111,114,105,103,105,
-                       110,97,108,32,97,114,114,97,121,46,0,82,101,116,117,114,110,32,116,104,
-                       101,32,108,97,115,116,32,118,97,108,117,101,32,105,110,32,116,104,101,32,
-                       97,114,114,97,121,46,0,82,101,116,117,114,110,32,97,32,110,101,119,32,
-                       97,114,114,97,121,32,99,111,110,116,97,105,110,105,110,103,32,116,104,101,
-                       32,102,105,114,115,116,32,96,110,96,32,118,97,108,117,101,115,32,102,114,
-                       111,109,32,116,104,101,32,115,111,117,114,99,101,32,97,114,114,97,121,46,
-                       0,82,101,116,117,114,110,32,116,104,101,32,108,101,110,103,116,104,32,111,
-                       102,32,97,32,97,114,114,97,121,46,0,69,120,101,99,117,116,101,32,113,
-                       117,111,116,101,46,32,82,101,116,117,114,110,32,97,32,110,101,119,32,97,
-                       114,114,97,121,32,99,111,110,116,97,105,110,105,110,103,32,116,104,101,32,
-                       118,97,108,117,101,115,32,116,104,101,32,113,117,111,116,101,32,108,101,97,
-                       118,101,115,32,111,110,32,116,104,101,32,115,116,97,99,107,46,32,84,104,
-                       105,115,32,105,115,32,105,100,101,110,116,105,99,97,108,32,116,111,32,100,
-                       111,105,110,103,32,96,97,58,99,111,117,110,116,101,100,45,114,101,115,117,
-                       108,116,115,0,69,120,101,99,117,116,101,32,113,117,111,116,101,32,111,110,
-                       99,101,32,102,111,114,32,101,97,99,104,32,105,116,101,109,32,105,110,32,
-                       116,104,101,32,97,114,114,97,121,46,32,67,111,110,115,116,114,117,99,116,
-                       115,32,97,32,110,101,119,32,97,114,114,97,121,32,102,114,111,109,32,116,
-                       104,101,32,118,97,108,117,101,32,114,101,116,117,114,110,101,100,32,98,121,
-                       32,116,104,101,32,113,117,111,116,101,46,0,69,120,116,114,97,99,116,32,
-                       97,32,110,101,119,32,97,114,114,97,121,32,102,114,111,109,32,116,104,101,
-                       32,109,105,100,100,108,101,32,111,102,32,116,104,101,32,115,112,101,99,105,
-                       102,105,101,100,32,97,114,114,97,121,46,32,84,104,105,115,32,119,105,108,
-                       108,32,116,97,107,101,32,116,104,101,32,118,97,108,117,101,115,32,115,116,
-                       97,114,116,105,110,103,32,97,116,32,96,102,96,32,97,110,100,32,101,120,
-                       116,101,110,100,32,116,111,32,116,104,101,32,96,108,96,32,108,97,115,116,
-                       32,118,97,108,117,101,46,0,82,101,116,117,114,110,32,97,32,110,101,119,
-                       32,97,114,114,97,121,32,99,111,110,115,105,115,116,105,110,103,32,111,102,
-                       32,116,104,101,32,118,97,108,117,101,115,32,105,110,32,97,50,32,102,111,
-                       108,108,111,119,101,100,32,98,121,32,116,104,101,32,118,97,108,117,101,115,
-                       32,105,110,32,97,49,46,0,84,97,107,101,115,32,97,110,32,97,114,114,
-                       97,121,44,32,97,32,115,116,97,114,116,105,110,103,32,118,97,108,117,101,
-                       44,32,97,110,100,32,97,32,113,117,111,116,101,46,32,84,104,105,115,32,
-                       119,105,108,108,32,97,112,112,108,121,32,116,104,101,32,113,117,111,116,101,
-                       32,116,111,32,101,97,99,104,32,105,116,101,109,32,105,110,32,116,104,101,
-                       32,97,114,114,97,121,59,32,116,104,101,32,113,117,111,116,101,32,115,104,
-                       111,117,108,100,32,99,111,110,115,117,109,101,32,116,119,111,32,118,97,108,
-                       117,101,115,32,97,110,100,32,114,101,116,117,114,110,32,111,110,101,46,0,
-                       82,101,118,101,114,115,101,32,116,104,101,32,111,114,100,101,114,32,111,102,
-                       32,105,116,101,109,115,32,105,110,32,97,32,97,114,114,97,121,46,32,84,
-                       104,105,115,32,119,105,108,108,32,114,101,116,117,114,110,32,97,32,110,101,
-                       119,32,97,114,114,97,121,46,0,82,101,116,117,114,110,32,97,32,110,101,
-                       119,32,97,114,114,97,121,32,99,111,110,116,97,105,110,105,110,103,32,116,
-                       104,101,32,115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,32,
-                       111,102,32,118,97,108,117,101,115,32,102,114,111,109,32,116,104,101,32,114,
-                       105,103,104,116,32,115,105,100,101,32,111,102,32,116,104,101,32,97,114,114,
-                       97,121,46,0,83,116,111,114,101,32,97,32,118,97,108,117,101,32,105,110,
-                       116,111,32,116,104,101,32,97,114,114,97,121,32,97,116,32,116,104,101,32,
-                       115,112,101,99,105,102,105,101,100,32,105,110,100,101,120,46,0,77,97,107,
-                       101,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,97,114,114,97,
-                       121,32,105,110,32,97,32,114,111,116,97,116,105,110,103,32,115,101,116,32,
-                       111,102,32,116,101,109,112,111,114,97,114,121,32,98,117,102,102,101,114,115,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,97,99,116,117,97,108,32,
-                       97,100,100,114,101,115,115,32,111,102,32,116,104,101,32,96,110,96,116,104,
-                       32,105,116,101,109,32,105,110,32,116,104,101,32,97,114,114,97,121,46,0,
-                       67,114,101,97,116,101,32,97,32,110,101,119,32,115,116,114,105,110,103,32,
-                       102,114,111,109,32,116,104,101,32,112,114,111,118,105,100,101,100,32,97,114,
-                       114,97,121,32,111,102,32,99,104,97,114,97,99,116,101,114,32,118,97,108,
-                       117,101,115,46,32,84,104,105,115,32,115,116,114,105,110,103,32,119,105,108,
-                       108,32,98,101,32,115,116,111,114,101,100,32,105,110,32,116,104,101,32,116,
-                       101,109,112,111,114,97,108,32,115,116,114,105,110,103,32,98,117,102,102,101,
-                       114,115,46,0,65,98,111,114,116,32,101,120,101,99,117,116,105,111,110,46,
-                       0,67,108,111,115,101,32,97,110,32,117,110,99,111,110,100,105,116,105,111,
-                       110,97,108,32,108,111,111,112,46,32,66,114,97,110,99,104,101,115,32,98,
-                       97,99,107,32,116,111,32,116,104,101,32,112,114,105,111,114,32,96,114,101,
-                       112,101,97,116,96,46,0,65,108,108,111,99,97,116,101,32,116,104,101,32,
-                       115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,32,
-                       99,101,108,108,115,32,102,114,111,109,32,116,104,101,32,96,72,101,97,112,
-                       96,46,0,80,101,114,102,111,114,109,32,97,32,98,105,116,119,105,115,101,
-                       32,65,78,68,32,111,112,101,114,97,116,105,111,110,32,98,101,116,119,101,
-                       101,110,32,116,104,101,32,116,119,111,32,112,114,111,118,105,100,101,100,32,
-                       118,97,108,117,101,115,46,0,70,101,116,99,104,32,116,104,101,32,56,45,
-                       98,105,116,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,32,
-                       116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,
-                       115,46,32,65,100,100,114,101,115,115,105,110,103,32,102,111,114,32,116,104,
-                       105,115,32,105,115,32,105,110,32,56,45,98,105,116,32,117,110,105,116,115,
-                       46,0,70,101,116,99,104,32,116,104,101,32,118,97,108,117,101,32,115,116,
-                       111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,
-                       100,32,97,100,100,114,101,115,115,46,32,82,101,116,117,114,110,115,32,116,
-                       104,101,32,110,101,120,116,32,97,100,100,114,101,115,115,32,97,110,100,32,
-                       116,104,101,32,118,97,108,117,101,46,0,83,116,111,114,101,32,97,110,32,
-                       56,45,98,105,116,32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,
-                       32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,32,
-                       65,100,100,114,101,115,115,105,110,103,32,102,111,114,32,116,104,105,115,32,
-                       105,115,32,105,110,32,56,45,98,105,116,32,117,110,105,116,115,46,0,83,
-                       116,111,114,101,32,97,32,118,97,108,117,101,32,105,110,116,111,32,116,104,
-                       101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,32,
-                       97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,
-                       97,100,100,114,101,115,115,46,0,84,114,97,110,115,108,97,116,101,32,97,
-                       32,112,104,121,115,105,99,97,108,32,97,100,100,114,101,115,115,32,116,111,
-                       32,97,32,98,121,116,101,32,97,100,100,114,101,115,115,46,0,68,105,115,
-                       112,108,97,121,32,97,32,119,101,108,99,111,109,101,32,109,101,115,115,97,
-                       103,101,32,111,110,32,115,116,97,114,116,117,112,46,0,69,120,101,99,117,
-                       116,101,32,113,49,32,97,103,97,105,110,115,116,32,120,44,32,116,104,101,
-                       110,32,101,120,101,99,117,116,101,32,113,50,32,97,103,97,105,110,115,116,
-                       32,97,32,99,111,112,121,32,111,102,32,120,46,0,69,120,101,99,117,116,
-                       101,32,113,49,32,97,103,97,105,110,115,116,32,120,32,97,110,100,32,113,
-                       50,32,97,103,97,105,110,115,116,32,121,46,0,69,120,101,99,117,116,101,
-                       32,113,32,97,103,97,105,110,115,116,32,120,44,32,116,104,101,110,32,101,
-                       120,101,99,117,116,101,32,113,32,97,103,97,105,110,115,116,32,121,46,0,
-                       83,101,116,32,96,66,97,115,101,96,32,116,111,32,98,105,110,97,114,121,
-                       46,0,82,101,97,100,32,49,48,50,52,32,99,101,108,108,115,32,102,114,
-                       111,109,32,98,108,111,99,107,32,110,32,105,110,32,116,104,101,32,98,108,
-                       111,99,107,32,115,116,111,114,97,103,101,32,105,110,116,111,32,109,101,109,
-                       111,114,121,32,97,116,32,97,100,100,114,101,115,115,32,97,46,0,83,101,
-                       116,32,116,104,101,32,102,105,108,101,32,110,97,109,101,32,111,102,32,116,
-                       104,101,32,98,108,111,99,107,32,115,116,111,114,97,103,101,32,100,101,118,
-                       105,99,101,46,0,83,101,116,32,116,104,101,32,110,117,109,98,101,114,32,
-                       111,102,32,98,108,111,99,107,115,32,116,111,32,114,101,115,101,114,118,101,
-                       46,32,84,104,101,115,101,32,97,114,101,32,114,101,115,101,114,118,101,100,
-                       32,102,114,111,109,32,116,104,101,32,115,116,97,114,116,32,111,102,32,116,
-                       104,101,32,98,108,111,99,107,32,102,105,108,101,46,0,83,97,118,101,32,
-                       116,104,101,32,49,48,50,52,32,99,101,108,108,115,32,97,116,32,97,100,
-                       100,114,101,115,115,32,97,32,116,111,32,98,108,111,99,107,32,110,32,105,
-                       110,32,116,104,101,32,98,108,111,99,107,32,115,116,111,114,97,103,101,46,
-                       0,65,112,112,101,110,100,32,97,32,118,97,108,117,101,32,116,111,32,116,
-                       104,101,32,99,117,114,114,101,110,116,32,98,117,102,102,101,114,46,0,82,
-                       101,115,101,116,32,116,104,101,32,99,117,114,114,101,110,116,32,98,117,102,
-                       102,101,114,32,116,111,32,97,110,32,101,109,112,116,121,32,115,116,97,116,
-                       101,46,0,82,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,
-                       116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,101,110,100,32,111,
-                       102,32,116,104,101,32,97,99,116,105,118,101,32,98,117,102,102,101,114,46,
-                       0,82,101,109,111,118,101,32,116,104,101,32,108,97,115,116,32,118,97,108,
-                       117,101,32,102,114,111,109,32,116,104,101,32,99,117,114,114,101,110,116,32,
-                       98,117,102,102,101,114,46,0,83,97,118,101,32,97,110,100,32,114,101,115,
-                       116,111,114,101,32,116,104,101,32,99,117,114,114,101,110,116,32,98,117,102,
-                       102,101,114,32,98,101,102,111,114,101,32,97,110,100,32,97,102,116,101,114,
-                       32,101,120,101,99,117,116,105,110,103,32,116,104,101,32,115,112,101,99,105,
-                       102,105,101,100,32,113,117,111,116,101,46,0,65,115,115,105,103,110,32,97,
-                       32,110,101,119,32,98,117,102,102,101,114,32,97,115,32,116,104,101,32,99,
-                       117,114,114,101,110,116,32,111,110,101,46,0,82,101,116,117,114,110,32,116,
-                       104,101,32,110,117,109,98,101,114,32,111,102,32,99,101,108,108,115,32,105,
-                       110,32,116,104,101,32,98,117,102,102,101,114,46,0,82,101,116,117,114,110,
-                       32,116,104,101,32,115,116,97,114,116,32,97,100,100,114,101,115,115,32,111,
-                       102,32,116,104,101,32,99,117,114,114,101,110,116,32,98,117,102,102,101,114,
-                       46,0,69,120,105,116,32,82,101,116,114,111,46,0,82,101,116,117,114,110,
-                       32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,
-                       115,32,97,32,110,111,116,32,99,111,110,115,111,110,97,110,116,32,111,114,
-                       32,70,65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,82,101,
-                       116,117,114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,
-                       101,114,32,105,115,32,97,32,110,111,116,32,110,117,109,101,114,105,99,32,
-                       100,105,103,105,116,32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,
-                       119,105,115,101,46,0,82,101,116,117,114,110,32,84,82,85,69,32,105,102,
-                       32,99,104,97,114,97,99,116,101,114,32,105,115,32,110,111,116,32,108,111,
-                       119,101,114,99,97,115,101,32,111,114,32,70,65,76,83,69,32,111,116,104,
-                       101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,82,85,69,32,
-                       105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,110,111,116,32,
-                       117,112,112,101,114,99,97,115,101,32,111,114,32,70,65,76,83,69,32,111,
-                       116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,82,85,
-                       69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,110,111,
-                       116,32,112,114,105,110,116,97,98,108,101,32,111,114,32,70,65,76,83,69,
-                       32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,
-                       82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,
-                       110,111,116,32,97,32,118,111,119,101,108,32,111,114,32,70,65,76,83,69,
-                       32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,
-                       82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,
-                       110,111,116,32,119,104,105,116,101,115,112,97,99,101,44,32,111,114,32,70,
-                       65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,
-                       114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,
-                       32,105,115,32,97,32,99,111,110,115,111,110,97,110,116,32,111,114,32,70,
-                       65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,
-                       114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,
-                       32,105,115,32,97,32,110,117,109,101,114,105,99,32,100,105,103,105,116,32,
-                       111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,
-                       86,101,99,116,111,114,101,100,46,32,82,101,97,100,32,97,32,115,105,110,
-                       103,108,101,32,107,101,121,112,114,101,115,115,46,0,82,101,116,117,114,110,
-                       32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,
-                       115,32,97,110,32,65,83,67,73,73,32,108,101,116,116,101,114,32,111,114,
-                       32,70,65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,82,101,
-                       116,117,114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,
-                       101,114,32,105,115,32,108,111,119,101,114,99,97,115,101,32,111,114,32,70,
-                       65,76,83,69,32,111,116,104,101,114,119,105,115,101,46,0,86,101,99,116,
-                       111,114,101,100,46,32,68,105,115,112,108,97,121,32,97,32,115,105,110,103,
-                       108,101,32,99,104,97,114,97,99,116,101,114,46,0,67,111,110,118,101,114,
-                       116,32,99,104,97,114,97,99,116,101,114,32,116,111,32,108,111,119,101,114,
-                       99,97,115,101,32,101,113,117,105,118,97,108,101,110,116,46,0,67,111,110,
-                       118,101,114,116,32,97,110,32,65,83,67,73,73,32,100,105,103,105,116,32,
-                       99,104,97,114,97,99,116,101,114,32,105,110,116,111,32,116,104,101,32,99,
-                       111,114,114,101,115,112,111,110,100,105,110,103,32,100,101,99,105,109,97,108,
-                       32,118,97,108,117,101,0,67,111,110,118,101,114,116,32,99,104,97,114,97,
-                       99,116,101,114,32,105,110,116,111,32,97,32,115,116,114,105,110,103,46,0,
-                       67,111,110,118,101,114,116,32,99,104,97,114,97,99,116,101,114,32,116,111,
-                       32,117,112,112,101,114,99,97,115,101,32,101,113,117,105,118,97,108,101,110,
-                       116,46,0,67,111,110,118,101,114,116,32,97,110,32,65,83,67,73,73,32,
-                       99,104,97,114,97,99,116,101,114,32,116,111,32,116,104,101,32,111,112,112,
-                       111,115,105,116,101,32,99,97,115,101,46,0,82,101,116,117,114,110,32,84,
-                       82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,
-                       117,112,112,101,114,99,97,115,101,32,111,114,32,70,65,76,83,69,32,111,
-                       116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,82,85,
-                       69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,112,114,
-                       105,110,116,97,98,108,101,32,111,114,32,70,65,76,83,69,32,111,116,104,
-                       101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,84,82,85,69,32,
-                       105,102,32,99,104,97,114,97,99,116,101,114,32,105,115,32,97,32,118,111,
-                       119,101,108,32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,105,
-                       115,101,46,0,82,101,116,117,114,110,32,84,82,85,69,32,105,102,32,99,
-                       104,97,114,97,99,116,101,114,32,105,115,32,119,104,105,116,101,115,112,97,
-                       99,101,44,32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,105,
-                       115,101,46,0,67,97,108,108,32,97,32,102,117,110,99,116,105,111,110,46,
-                       0,82,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,
-                       32,116,104,101,32,99,97,114,32,111,102,32,99,111,110,115,32,97,46,0,
-                       83,116,111,114,101,32,110,32,105,110,116,111,32,116,104,101,32,99,97,114,
-                       32,111,102,32,99,111,110,115,32,97,46,0,82,101,116,117,114,110,32,116,
-                       104,101,32,99,111,110,116,101,110,116,115,32,111,102,32,116,104,101,32,99,
-                       97,114,32,111,102,32,99,111,110,115,32,97,46,0,73,102,32,96,110,96,
-                       32,105,115,32,101,113,117,97,108,32,116,111,32,96,109,96,44,32,100,114,
-                       111,112,32,98,111,116,104,32,97,110,100,32,101,120,101,99,117,116,101,32,
-                       116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,111,116,101,32,
-                       98,101,102,111,114,101,32,101,120,105,116,105,110,103,32,116,104,101,32,99,
-                       97,108,108,105,110,103,32,119,111,114,100,46,32,73,102,32,110,111,116,32,
-                       101,113,117,97,108,44,32,108,101,97,118,101,32,96,110,96,32,111,110,32,
-                       116,104,101,32,115,116,97,99,107,32,97,110,100,32,108,101,116,32,101,120,
-                       101,99,117,116,105,111,110,32,99,111,110,116,105,110,117,101,46,0,82,101,
-                       116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,
-                       101,32,99,100,114,32,111,102,32,99,111,110,115,32,97,46,0,83,116,111,
-                       114,101,32,110,32,105,110,116,111,32,116,104,101,32,99,100,114,32,111,102,
-                       32,99,111,110,115,32,97,46,0,82,101,116,117,114,110,32,116,104,101,32,
-                       99,111,110,116,101,110,116,115,32,111,102,32,116,104,101,32,99,100,114,32,
-                       111,102,32,99,111,110,115,32,97,46,0,69,120,101,99,117,116,101,32,113,
-                       49,32,105,102,32,116,104,101,32,102,108,97,103,32,105,115,32,116,114,117,
-                       101,32,40,45,49,41,32,111,114,32,113,50,32,105,102,32,116,104,101,32,
-                       102,108,97,103,32,105,115,32,102,97,108,115,101,32,40,48,41,46,32,79,
-                       110,108,121,32,116,104,101,115,101,32,102,108,97,103,115,32,97,114,101,32,
-                       118,97,108,105,100,32,119,104,101,110,32,117,115,105,110,103,32,96,99,104,
-                       111,111,115,101,96,59,32,112,97,115,115,105,110,103,32,111,116,104,101,114,
-                       32,118,97,108,117,101,115,32,97,115,32,102,108,97,103,115,32,119,105,108,
-                       108,32,114,101,115,117,108,116,32,105,110,32,109,101,109,111,114,121,32,99,
-                       111,114,114,117,112,116,105,111,110,46,0,67,108,97,115,115,32,104,97,110,
-                       100,108,101,114,32,102,111,114,32,100,97,116,97,32,115,116,114,117,99,116,
-                       117,114,101,115,46,0,67,108,97,115,115,32,104,97,110,100,108,101,114,32,
-                       102,111,114,32,99,111,109,112,105,108,101,114,32,109,97,99,114,111,115,32,
-                       40,105,109,109,101,100,105,97,116,101,32,119,111,114,100,115,41,0,67,108,
-                       97,115,115,32,104,97,110,100,108,101,114,32,102,111,114,32,112,114,105,109,
-                       105,116,105,118,101,32,119,111,114,100,115,32,40,119,111,114,100,115,32,119,
-                       104,105,99,104,32,109,97,112,32,116,111,32,78,103,97,32,105,110,115,116,
-                       114,117,99,116,105,111,110,115,41,0,67,108,97,115,115,32,104,97,110,100,
-                       108,101,114,32,102,111,114,32,110,111,114,109,97,108,32,119,111,114,100,115,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,
-                       32,100,97,121,46,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,
-                       114,101,110,116,32,104,111,117,114,46,32,84,104,105,115,32,119,105,108,108,
-                       32,98,101,32,105,110,32,116,104,101,32,114,97,110,103,101,32,111,102,32,
-                       48,45,50,51,44,32,105,110,99,108,117,115,105,118,101,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,109,105,110,117,
-                       116,101,46,32,84,104,105,115,32,119,105,108,108,32,98,101,32,105,110,32,
-                       116,104,101,32,114,97,110,103,101,32,111,102,32,48,45,53,57,44,32,105,
-                       110,99,108,117,115,105,118,101,46,0,82,101,116,117,114,110,32,116,104,101,
-                       32,99,117,114,114,101,110,116,32,109,111,110,116,104,46,32,84,104,105,115,
-                       32,119,105,108,108,32,98,101,32,105,110,32,116,104,101,32,114,97,110,103,
-                       101,32,111,102,32,49,45,49,50,44,32,105,110,99,108,117,115,105,118,101,
-                       46,0,84,114,105,103,103,101,114,32,97,32,99,108,111,99,107,32,111,112,
-                       101,114,97,116,105,111,110,46,32,84,104,105,115,32,105,115,32,110,111,116,
-                       32,105,110,116,101,110,100,101,100,32,116,111,32,98,101,32,117,115,101,100,
-                       32,100,105,114,101,99,116,108,121,46,0,82,101,116,117,114,110,32,116,104,
-                       101,32,99,117,114,114,101,110,116,32,115,101,99,111,110,100,46,32,84,104,
-                       105,115,32,119,105,108,108,32,98,101,32,105,110,32,116,104,101,32,114,97,
-                       110,103,101,32,111,102,32,48,45,53,57,44,32,105,110,99,108,117,115,105,
-                       118,101,46,0,82,101,116,117,114,110,32,97,32,104,111,115,116,32,115,112,
-                       101,99,105,102,105,99,32,116,105,109,101,115,116,97,109,112,46,32,73,110,
-                       32,116,104,101,32,115,116,97,110,100,97,114,100,32,115,121,115,116,101,109,
-                       44,32,116,104,105,115,32,105,115,32,97,32,51,50,45,98,105,116,32,85,
-                       110,105,120,32,116,105,109,101,115,116,97,109,112,44,32,98,117,116,32,116,
-                       104,105,115,32,105,115,32,110,111,116,32,114,101,113,117,105,114,101,100,46,
-                       0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,
-                       100,97,121,32,105,110,32,85,84,67,46,0,82,101,116,117,114,110,32,116,
-                       104,101,32,99,117,114,114,101,110,116,32,104,111,117,114,32,105,110,32,85,
-                       84,67,46,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,
-                       110,116,32,109,105,110,117,116,101,32,105,110,32,85,84,67,46,0,82,101,
-                       116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,109,111,110,
-                       116,104,32,105,110,32,85,84,67,46,0,82,101,116,117,114,110,32,116,104,
-                       101,32,99,117,114,114,101,110,116,32,115,101,99,111,110,100,32,105,110,32,
-                       85,84,67,46,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,114,
-                       101,110,116,32,121,101,97,114,32,105,110,32,85,84,67,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,121,101,97,114,
-                       46,0,83,116,111,114,101,32,116,104,101,32,115,112,101,99,105,102,105,101,
-                       100,32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,109,101,109,
-                       111,114,121,32,97,116,32,96,104,101,114,101,96,32,97,110,100,32,105,110,
-                       99,114,101,109,101,110,116,32,96,72,101,97,112,96,32,98,121,32,49,46,
-                       32,73,100,101,110,116,105,99,97,108,32,116,111,32,96,44,96,44,32,116,
-                       104,105,115,32,105,115,32,112,114,111,118,105,100,101,100,32,102,111,114,32,
-                       99,111,109,112,97,116,105,98,105,108,105,116,121,32,119,105,116,104,32,116,
-                       104,101,32,82,101,116,114,111,70,111,114,116,104,32,111,110,32,105,108,111,
-                       32,97,110,100,32,110,97,112,105,97,46,0,67,111,109,112,105,108,101,32,
-                       97,32,99,97,108,108,32,116,111,32,116,104,101,32,115,112,101,99,105,102,
-                       105,101,100,32,97,100,100,114,101,115,115,32,105,110,116,111,32,116,104,101,
-                       32,99,117,114,114,101,110,116,32,100,101,102,105,110,105,116,105,111,110,46,
-                       0,67,111,109,112,105,108,101,32,97,32,106,117,109,112,32,116,111,32,116,
-                       104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,
-                       32,105,110,116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,100,101,
-                       102,105,110,105,116,105,111,110,46,0,67,111,109,112,105,108,101,32,116,104,
-                       101,32,99,111,100,101,32,116,111,32,112,117,115,104,32,97,32,110,117,109,
-                       98,101,114,32,116,111,32,116,104,101,32,115,116,97,99,107,32,105,110,116,
-                       111,32,116,104,101,32,99,117,114,114,101,110,116,32,100,101,102,105,110,105,
-                       116,105,111,110,46,0,67,111,109,112,105,108,101,32,97,32,114,101,116,117,
-                       114,110,32,105,110,115,116,114,117,99,116,105,111,110,32,105,110,116,111,32,
-                       116,104,101,32,99,117,114,114,101,110,116,32,100,101,102,105,110,105,116,105,
-                       111,110,46,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,
-                       32,99,111,109,112,105,108,101,114,32,105,115,32,111,110,32,111,114,32,96,
-                       70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,67,114,
-                       101,97,116,101,32,97,32,110,101,119,32,99,111,110,115,32,99,101,108,108,
-                       32,119,105,116,104,32,97,32,99,97,114,32,111,102,32,120,32,97,110,100,
-                       32,97,32,99,100,114,32,111,102,32,121,46,0,67,114,101,97,116,101,32,
-                       97,32,99,111,110,115,116,97,110,116,32,114,101,116,117,114,110,105,110,103,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,101,
-                       46,0,67,111,112,121,32,96,108,96,32,99,101,108,108,115,32,102,114,111,
-                       109,32,109,101,109,111,114,121,32,97,116,32,96,115,96,32,116,111,32,116,
-                       104,101,32,109,101,109,111,114,121,32,97,116,32,96,100,96,46,32,84,104,
-                       101,115,101,32,115,104,111,117,108,100,32,110,111,116,32,111,118,101,114,108,
-                       97,112,46,0,67,108,101,97,114,32,116,104,101,32,105,110,116,101,114,110,
-                       97,108,32,115,116,97,116,101,32,111,102,32,99,111,114,101,32,96,110,96,
-                       46,32,84,104,105,115,32,115,104,111,117,108,100,32,98,101,32,100,111,110,
-                       101,32,112,114,105,111,114,32,116,111,32,117,115,101,32,111,102,32,96,99,
-                       111,114,101,58,115,116,97,114,116,96,44,32,119,104,105,99,104,32,97,99,
-                       116,105,118,97,116,101,115,32,112,114,111,99,101,115,115,105,110,103,32,111,
-                       110,32,116,104,101,32,99,111,114,101,46,0,83,117,115,112,101,110,100,32,
-                       112,114,111,99,101,115,115,105,110,103,32,111,110,32,99,111,114,101,32,96,
-                       110,96,46,0,83,117,115,112,101,110,100,32,112,114,111,99,101,115,115,105,
-                       110,103,32,111,110,32,116,104,101,32,99,117,114,114,101,110,116,32,99,111,
-                       114,101,46,0,82,101,97,100,32,97,32,118,97,108,117,101,32,102,114,111,
-                       109,32,114,101,103,105,115,116,101,114,32,96,110,96,32,111,110,32,116,104,
-                       101,32,99,117,114,114,101,110,116,32,99,111,114,101,46,0,82,101,115,117,
-                       109,101,32,112,114,111,99,101,115,115,105,110,103,32,111,110,32,99,111,114,
-                       101,32,96,110,96,32,97,102,116,101,114,32,97,32,96,99,111,114,101,58,
-                       112,97,117,115,101,96,32,111,114,32,96,99,111,114,101,58,112,97,117,115,
-                       101,45,99,117,114,114,101,110,116,96,46,0,83,101,116,32,116,104,101,32,
-                       73,80,32,111,102,32,99,111,114,101,32,96,110,96,32,116,111,32,97,100,
-                       100,114,101,115,115,32,96,97,96,32,97,110,100,32,98,101,103,105,110,32,
-                       112,114,111,99,101,115,115,105,110,103,32,111,110,32,99,111,114,101,32,96,
-                       110,96,46,0,87,114,105,116,101,32,97,32,118,97,108,117,101,32,116,111,
-                       32,114,101,103,105,115,116,101,114,32,110,117,109,98,101,114,32,96,110,96,
-                       32,111,110,32,116,104,101,32,99,117,114,114,101,110,116,32,99,111,114,101,
-                       46,0,66,105,110,100,32,97,32,118,97,108,117,101,32,116,111,32,97,32,
-                       102,117,110,99,116,105,111,110,32,97,110,100,32,114,101,116,117,114,110,32,
-                       97,32,110,101,119,32,113,117,111,116,101,32,116,104,97,116,32,99,97,108,
-                       108,115,32,116,104,101,32,98,111,117,110,100,32,97,99,116,105,111,110,46,
-                       0,73,110,108,105,110,101,32,97,32,110,117,109,101,114,105,99,32,118,97,
-                       108,117,101,32,116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,97,
-                       115,115,101,109,98,108,121,32,115,101,103,109,101,110,116,46,0,86,101,99,
-                       116,111,114,101,100,46,32,67,114,101,97,116,101,32,97,32,104,101,97,100,
-                       101,114,46,32,80,114,111,118,105,100,101,32,97,32,115,116,114,105,110,103,
-                       32,40,115,41,32,102,111,114,32,116,104,101,32,110,97,109,101,44,32,97,
-                       32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,99,108,97,115,
-                       115,32,104,97,110,100,108,101,114,32,40,97,49,41,32,97,110,100,32,97,
-                       32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,119,111,114,100,
-                       32,100,101,102,105,110,105,116,105,111,110,32,40,97,50,41,32,71,101,110,
-                       101,114,97,108,108,121,32,116,104,105,115,32,119,111,110,39,116,32,98,101,
-                       32,117,115,101,100,32,100,105,114,101,99,116,108,121,46,0,71,105,118,101,
-                       110,32,97,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,
-                       114,44,32,114,101,116,117,114,110,32,116,104,101,32,99,108,97,115,115,32,
-                       102,105,101,108,100,46,0,72,111,111,107,46,32,67,114,101,97,116,101,32,
-                       97,32,110,101,119,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,
-                       100,101,114,32,110,97,109,101,100,32,116,104,101,32,115,112,101,99,105,102,
-                       105,101,100,32,115,116,114,105,110,103,46,32,84,104,101,32,110,101,119,32,
-                       104,101,97,100,101,114,32,119,105,108,108,32,112,111,105,110,116,32,116,111,
-                       32,96,104,101,114,101,96,32,97,110,100,32,104,97,118,101,32,97,32,99,
-                       108,97,115,115,32,111,102,32,96,99,108,97,115,115,58,100,97,116,97,96,
-                       46,0,69,120,101,99,117,116,101,32,116,104,101,32,115,112,101,99,105,102,
-                       105,101,100,32,113,117,111,116,101,32,111,110,99,101,32,102,111,114,32,101,
-                       97,99,104,32,104,101,97,100,101,114,32,105,110,32,116,104,101,32,100,105,
-                       99,116,105,111,110,97,114,121,46,32,66,101,102,111,114,101,32,114,117,110,
-                       110,105,110,103,32,116,104,101,32,113,117,111,116,101,44,32,116,104,105,115,
-                       32,97,108,115,111,32,112,117,115,104,101,115,32,97,32,112,111,105,110,116,
-                       101,114,32,116,111,32,116,104,101,32,104,101,97,100,101,114,32,111,110,116,
-                       111,32,116,104,101,32,115,116,97,99,107,46,0,71,105,118,101,110,32,97,
-                       32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,114,44,32,
-                       114,101,116,117,114,110,32,116,104,101,32,104,97,115,104,32,102,105,101,108,
-                       100,46,0,86,97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,97,
-                       32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,102,117,110,99,
-                       116,105,111,110,32,117,115,101,100,32,116,111,32,99,97,108,99,117,108,97,
-                       116,101,32,100,105,99,116,105,111,110,97,114,121,32,104,97,115,104,101,115,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,109,111,115,116,32,114,101,
-                       99,101,110,116,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,
-                       101,114,46,0,82,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,
-                       32,116,111,32,116,104,101,32,99,108,97,115,115,32,102,105,101,108,100,32,
-                       111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,116,32,100,
-                       105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,114,46,0,82,101,
-                       116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,
-                       101,32,110,97,109,101,32,102,105,101,108,100,32,111,102,32,116,104,101,32,
-                       109,111,115,116,32,114,101,99,101,110,116,32,100,105,99,116,105,111,110,97,
-                       114,121,32,104,101,97,100,101,114,46,0,82,101,116,117,114,110,32,97,32,
-                       112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,120,116,32,102,105,
-                       101,108,100,32,111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,101,
-                       110,116,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,114,
-                       46,0,71,105,118,101,110,32,97,32,100,105,99,116,105,111,110,97,114,121,
-                       32,104,101,97,100,101,114,44,32,114,101,116,117,114,110,32,116,104,101,32,
-                       108,105,110,107,32,102,105,101,108,100,46,0,76,111,111,107,117,112,32,116,
-                       104,101,32,115,112,101,99,105,102,105,101,100,32,110,97,109,101,32,105,110,
-                       32,116,104,101,32,100,105,99,116,105,111,110,97,114,121,32,97,110,100,32,
-                       114,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,
-                       105,116,115,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,
-                       114,46,32,84,104,105,115,32,114,101,116,117,114,110,115,32,122,101,114,111,
-                       32,105,102,32,116,104,101,32,119,111,114,100,32,105,115,32,110,111,116,32,
-                       102,111,117,110,100,46,32,84,104,105,115,32,97,108,115,111,32,115,101,116,
-                       115,32,97,110,32,105,110,116,101,114,110,97,108,32,118,97,114,105,97,98,
-                       108,101,32,40,39,119,104,105,99,104,39,32,105,110,32,114,101,116,114,111,
-                       46,109,117,114,105,41,32,116,111,32,116,104,101,32,104,101,97,100,101,114,
-                       32,97,100,100,114,101,115,115,46,0,76,111,111,107,117,112,32,116,104,101,
-                       32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,32,105,
-                       110,32,116,104,101,32,100,105,99,116,105,111,110,97,114,121,32,97,110,100,
-                       32,114,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,
-                       32,105,116,115,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,
-                       101,114,46,32,84,104,105,115,32,114,101,116,117,114,110,115,32,122,101,114,
-                       111,32,105,102,32,116,104,101,32,119,111,114,100,32,105,115,32,110,111,116,
-                       32,102,111,117,110,100,46,0,71,105,118,101,110,32,97,32,100,105,99,116,
-                       105,111,110,97,114,121,32,104,101,97,100,101,114,44,32,114,101,116,117,114,
-                       110,32,116,104,101,32,110,97,109,101,32,102,105,101,108,100,46,0,85,112,
-                       100,97,116,101,32,116,104,101,32,104,97,115,104,101,115,32,102,111,114,32,
-                       97,108,108,32,118,105,115,105,98,108,101,32,119,111,114,100,115,32,105,110,
-                       32,116,104,101,32,100,105,99,116,105,111,110,97,114,121,46,0,86,97,114,
-                       105,97,98,108,101,46,32,72,111,108,100,115,32,97,32,112,111,105,110,116,
-                       101,114,32,116,111,32,116,104,101,32,102,117,110,99,116,105,111,110,32,105,
-                       110,118,111,107,101,100,32,97,102,116,101,114,32,97,32,100,105,99,116,105,
-                       111,110,97,114,121,32,104,101,97,100,101,114,32,105,115,32,97,100,100,101,
-                       100,46,0,83,101,116,32,116,104,101,32,96,100,58,115,111,117,114,99,101,
-                       96,32,102,105,101,108,100,32,111,102,32,116,104,101,32,104,101,97,100,101,
-                       114,32,102,111,114,32,116,104,101,32,110,97,109,101,100,32,119,111,114,100,
-                       32,40,115,50,41,32,116,111,32,115,116,114,105,110,103,32,40,115,49,41,
-                       46,32,84,104,101,32,115,116,114,105,110,103,32,119,105,108,108,32,110,111,
-                       116,32,98,101,32,100,117,112,108,105,99,97,116,101,100,46,0,71,105,118,
-                       101,110,32,97,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,
-                       101,114,44,32,114,101,116,117,114,110,32,116,104,101,32,115,111,117,114,99,
-                       101,32,102,105,101,108,100,46,0,67,104,97,110,103,101,32,100,105,99,116,
-                       105,111,110,97,114,121,32,115,101,97,114,99,104,32,116,111,32,117,115,101,
-                       32,104,97,115,104,101,100,32,110,97,109,101,32,99,111,109,112,97,114,105,
-                       111,110,115,46,0,67,104,97,110,103,101,32,100,105,99,116,105,111,110,97,
-                       114,121,32,115,101,97,114,99,104,32,116,111,32,117,115,101,32,102,117,108,
-                       108,32,110,97,109,101,32,99,111,109,112,97,114,105,111,110,115,46,0,71,
-                       105,118,101,110,32,97,32,100,105,99,116,105,111,110,97,114,121,32,104,101,
-                       97,100,101,114,44,32,114,101,116,117,114,110,32,116,104,101,32,120,116,32,
-                       102,105,101,108,100,46,0,67,104,97,110,103,101,32,116,104,101,32,99,108,
-                       97,115,115,32,111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,101,
-                       110,116,108,121,32,100,101,102,105,110,101,100,32,119,111,114,100,32,116,111,
-                       32,96,99,108,97,115,115,58,100,97,116,97,96,46,0,83,101,116,32,96,
-                       66,97,115,101,96,32,116,111,32,100,101,99,105,109,97,108,46,0,82,101,
-                       116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,105,
-                       116,101,109,115,32,111,110,32,116,104,101,32,115,116,97,99,107,46,0,84,
-                       101,109,112,111,114,97,114,105,108,121,32,114,101,109,111,118,101,32,110,32,
-                       102,114,111,109,32,116,104,101,32,115,116,97,99,107,44,32,101,120,101,99,
-                       117,116,101,32,116,104,101,32,113,117,111,116,97,116,105,111,110,44,32,97,
-                       110,100,32,116,104,101,110,32,114,101,115,116,111,114,101,32,110,32,116,111,
-                       32,116,104,101,32,115,116,97,99,107,46,0,65,116,116,97,99,104,32,97,
-                       110,32,97,99,116,105,111,110,32,116,111,32,116,104,101,32,109,111,115,116,
-                       32,114,101,99,101,110,116,108,121,32,99,114,101,97,116,101,100,32,119,111,
-                       114,100,46,32,84,104,105,115,32,105,115,32,117,115,101,100,32,105,110,32,
-                       97,32,109,97,110,110,101,114,32,115,105,109,105,108,97,114,32,116,111,32,
-                       67,82,69,65,84,69,47,68,79,69,83,62,32,105,110,32,116,114,97,100,
-                       105,116,105,111,110,97,108,32,70,111,114,116,104,46,0,68,105,115,99,97,
-                       114,100,32,116,104,101,32,116,111,112,32,118,97,108,117,101,32,111,110,32,
-                       116,104,101,32,115,116,97,99,107,46,0,82,101,109,111,118,101,32,116,111,
-                       112,32,116,119,111,32,105,116,101,109,115,32,111,110,32,116,104,101,32,115,
-                       116,97,99,107,46,0,68,105,115,112,108,97,121,32,116,104,101,32,105,116,
-                       101,109,115,32,111,110,32,116,104,101,32,100,97,116,97,32,115,116,97,99,
-                       107,46,0,68,117,112,108,105,99,97,116,101,32,116,104,101,32,116,111,112,
-                       32,105,116,101,109,32,111,110,32,116,104,101,32,115,116,97,99,107,46,0,
-                       68,117,112,108,105,99,97,116,101,32,116,104,101,32,116,111,112,32,116,119,
-                       111,32,105,116,101,109,115,32,111,110,32,116,104,101,32,115,116,97,99,107,
-                       46,0,67,111,110,115,116,97,110,116,46,32,78,101,103,97,116,105,118,101,
-                       32,105,110,102,105,110,105,116,121,46,32,32,70,111,114,32,101,110,99,111,
-                       100,101,100,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,
-                       97,108,117,101,115,46,0,73,115,32,101,110,99,111,100,101,100,32,118,97,
-                       108,117,101,32,110,101,103,97,116,105,118,101,32,105,110,102,105,110,105,116,
-                       121,63,0,67,111,110,115,116,97,110,116,46,32,73,110,102,105,110,105,116,
-                       121,46,32,70,111,114,32,101,110,99,111,100,101,100,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,46,0,67,111,
-                       110,115,116,97,110,116,46,32,77,97,120,105,109,117,109,32,118,97,108,117,
-                       101,46,32,70,111,114,32,101,110,99,111,100,101,100,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,46,0,67,111,
-                       110,115,116,97,110,116,46,32,77,105,110,105,109,117,109,32,118,97,108,117,
-                       101,46,32,70,111,114,32,101,110,99,111,100,101,100,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,46,0,67,111,
-                       110,115,116,97,110,116,46,32,78,111,116,32,97,32,78,117,109,98,101,114,
-                       46,32,70,111,114,32,101,110,99,111,100,101,100,32,102,108,111,97,116,105,
-                       110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,46,0,67,111,110,
-                       115,116,114,97,105,110,32,116,104,101,32,101,110,99,111,100,101,100,32,118,
-                       97,108,117,101,32,116,111,32,116,104,101,32,97,108,108,111,119,97,98,108,
-                       101,32,114,97,110,103,101,46,0,73,115,32,101,110,99,111,100,101,100,32,
-                       118,97,108,117,101,32,105,110,102,105,110,105,116,121,63,0,73,115,32,101,
-                       110,99,111,100,101,100,32,118,97,108,117,101,32,97,116,32,116,104,101,32,
-                       109,97,120,105,109,117,109,63,0,73,115,32,101,110,99,111,100,101,100,32,
-                       118,97,108,117,101,32,97,116,32,116,104,101,32,109,105,110,105,109,117,109,
-                       63,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,116,
-                       104,101,32,101,110,99,111,100,101,100,32,118,97,108,117,101,32,105,115,32,
-                       97,32,118,97,108,105,100,32,110,117,109,98,101,114,44,32,111,114,32,96,
-                       70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,73,115,
-                       32,101,110,99,111,100,101,100,32,118,97,108,117,101,32,97,32,78,97,110,
-                       63,0,68,105,115,112,108,97,121,32,97,110,32,101,110,99,111,100,101,100,
-                       32,110,117,109,98,101,114,46,0,68,101,99,111,100,101,32,97,110,32,101,
-                       110,99,111,100,101,100,32,102,108,111,97,116,105,110,103,45,112,111,105,110,
-                       116,32,118,97,108,117,101,46,0,82,101,116,117,114,110,32,96,84,82,85,
-                       69,96,32,105,102,32,116,104,101,32,118,97,108,117,101,32,105,115,32,122,
-                       101,114,111,44,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,
-                       114,119,105,115,101,46,0,67,111,109,112,97,114,101,32,116,119,111,32,118,
-                       97,108,117,101,115,32,102,111,114,32,101,113,117,97,108,105,116,121,46,32,
-                       82,101,116,117,114,110,115,32,96,84,82,85,69,96,32,105,102,32,116,104,
-                       101,121,32,97,114,101,32,101,113,117,97,108,32,111,114,32,96,70,65,76,
-                       83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,69,114,114,111,114,
-                       32,104,97,110,100,108,101,114,32,102,111,114,32,100,97,116,97,32,115,116,
-                       97,99,107,32,111,118,101,114,102,108,111,119,0,69,114,114,111,114,32,104,
-                       97,110,100,108,101,114,32,102,111,114,32,100,97,116,97,32,115,116,97,99,
-                       107,32,117,110,100,101,114,102,108,111,119,46,0,86,101,99,116,111,114,101,
-                       100,46,32,69,114,114,111,114,32,104,97,110,100,108,101,114,46,32,67,97,
-                       108,108,101,100,32,119,104,101,110,32,97,32,119,111,114,100,32,105,115,32,
-                       110,111,116,32,102,111,117,110,100,32,98,121,32,96,105,110,116,101,114,112,
-                       114,101,116,96,46,0,83,101,116,32,116,104,101,32,100,101,102,97,117,108,
-                       116,32,101,114,114,111,114,32,104,97,110,100,108,101,114,115,32,102,111,114,
-                       32,118,97,114,105,111,117,115,32,99,111,110,100,105,116,105,111,110,115,46,
-                       0,83,101,116,32,101,114,114,111,114,32,104,97,110,100,108,101,114,32,102,
-                       111,114,32,101,114,114,111,114,32,99,111,100,101,32,78,46,32,0,77,117,
-                       108,116,105,112,108,121,32,116,119,111,32,102,108,111,97,116,105,110,103,45,
-                       112,111,105,110,116,32,110,117,109,98,101,114,115,44,32,114,101,116,117,114,
-                       110,105,110,103,32,116,104,101,32,114,101,115,117,108,116,46,0,65,100,100,
-                       32,116,119,111,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
-                       110,117,109,98,101,114,115,44,32,114,101,116,117,114,110,105,110,103,32,116,
-                       104,101,32,114,101,115,117,108,116,46,0,83,117,98,116,114,97,99,116,32,
-                       70,50,32,102,114,111,109,32,70,49,32,114,101,116,117,114,110,105,110,103,
-                       32,116,104,101,32,114,101,115,117,108,116,46,0,82,101,116,117,114,110,32,
-                       97,32,118,97,108,117,101,32,99,111,114,114,101,115,112,111,110,100,105,110,
-                       103,32,116,111,32,110,101,103,97,116,105,118,101,32,105,110,102,105,110,105,
-                       116,121,0,67,111,109,112,97,114,101,32,116,119,111,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,32,102,111,114,
-                       32,105,110,101,113,117,97,108,105,116,121,46,32,82,101,116,117,114,110,115,
-                       32,96,84,82,85,69,96,32,105,102,32,116,104,101,121,32,97,114,101,32,
-                       110,111,116,32,101,113,117,97,108,32,111,114,32,96,70,65,76,83,69,96,
-                       32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,96,
-                       84,82,85,69,96,32,105,102,32,102,108,111,97,116,105,110,103,45,112,111,
-                       105,110,116,32,118,97,108,117,101,32,105,115,32,45,73,78,70,32,111,114,
-                       32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,
-                       68,105,118,105,100,101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,
-                       116,32,118,97,108,117,101,32,70,49,32,98,121,32,70,50,46,0,82,101,
-                       116,117,114,110,32,116,104,101,32,102,108,111,97,116,105,110,103,45,112,111,
-                       105,110,116,32,118,97,108,117,101,32,102,111,114,32,69,117,108,101,114,39,
-                       115,32,110,117,109,98,101,114,46,0,72,111,111,107,46,32,82,101,116,117,
-                       114,110,32,97,32,99,111,110,115,116,97,110,116,32,117,115,101,100,32,97,
-                       115,32,116,104,101,32,115,99,97,108,105,110,103,32,102,97,99,116,111,114,
-                       32,102,111,114,32,116,104,101,32,101,58,32,119,111,114,100,115,46,0,82,
-                       101,116,117,114,110,32,97,32,118,97,108,117,101,32,99,111,114,114,101,115,
-                       112,111,110,100,105,110,103,32,116,111,32,112,111,115,105,116,105,118,101,32,
-                       105,110,102,105,110,105,116,121,0,82,101,116,117,114,110,32,97,32,118,97,
-                       108,117,101,32,99,111,114,114,101,115,112,111,110,100,105,110,103,32,116,111,
-                       32,78,97,78,0,82,101,116,117,114,110,32,116,104,101,32,102,108,111,97,
-                       116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,102,111,114,
-                       32,80,73,46,0,82,101,116,117,114,110,32,116,104,101,32,97,98,115,111,
-                       108,117,116,101,32,118,97,108,117,101,32,102,111,114,32,97,32,102,108,111,
-                       97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,82,
-                       101,116,117,114,110,32,116,104,101,32,97,114,99,32,99,111,115,105,110,101,
-                       32,111,102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
-                       32,110,117,109,98,101,114,46,0,82,101,116,117,114,110,32,116,104,101,32,
-                       110,117,109,98,101,114,32,111,102,32,105,116,101,109,115,32,111,110,32,116,
-                       104,101,32,97,108,116,101,114,110,97,116,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,115,116,97,99,107,46,0,82,101,116,117,114,
-                       110,32,116,104,101,32,97,114,99,32,115,105,110,101,32,111,102,32,97,32,
-                       102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,
-                       114,46,0,82,101,116,117,114,110,32,116,104,101,32,97,114,99,32,116,97,
-                       110,103,101,110,116,32,111,102,32,97,32,102,108,111,97,116,105,110,103,45,
-                       112,111,105,110,116,32,110,117,109,98,101,114,46,0,82,101,116,117,114,110,
-                       32,84,82,85,69,32,105,102,32,110,117,109,98,101,114,32,105,115,32,98,
-                       101,116,119,101,101,110,32,116,104,101,32,108,111,119,101,114,32,40,108,41,
-                       32,97,110,100,32,117,112,112,101,114,32,40,117,41,32,98,111,117,110,100,
-                       115,46,32,73,102,32,110,111,116,44,32,114,101,116,117,114,110,32,70,65,
-                       76,83,69,46,32,84,104,105,115,32,105,115,32,105,110,99,108,117,115,105,
-                       118,101,32,111,102,32,116,104,101,32,108,105,109,105,116,115,46,0,73,102,
-                       32,96,110,96,32,105,115,32,101,113,117,97,108,32,116,111,32,96,109,96,
-                       44,32,100,114,111,112,32,98,111,116,104,32,97,110,100,32,101,120,101,99,
-                       117,116,101,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,
-                       111,116,101,32,98,101,102,111,114,101,32,101,120,105,116,105,110,103,32,116,
-                       104,101,32,99,97,108,108,105,110,103,32,119,111,114,100,46,32,73,102,32,
-                       110,111,116,32,101,113,117,97,108,44,32,108,101,97,118,101,32,96,110,96,
-                       32,111,110,32,116,104,101,32,115,116,97,99,107,32,97,110,100,32,108,101,
-                       116,32,101,120,101,99,117,116,105,111,110,32,99,111,110,116,105,110,117,101,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,115,109,97,108,108,101,115,
-                       116,32,105,110,116,101,103,114,97,108,32,118,97,108,117,101,32,103,114,101,
-                       97,116,101,114,32,116,104,97,110,32,111,114,32,101,113,117,97,108,32,116,
-                       111,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,
-                       101,46,0,82,101,116,117,114,110,32,116,104,101,32,99,111,115,105,110,101,
-                       32,111,102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
-                       32,110,117,109,98,101,114,46,0,68,101,99,114,101,109,101,110,116,32,110,
-                       32,98,121,32,111,110,101,46,0,82,101,116,117,114,110,32,116,104,101,32,
-                       110,117,109,98,101,114,32,111,102,32,105,116,101,109,115,32,111,110,32,116,
-                       104,101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,115,116,
-                       97,99,107,46,0,68,105,115,99,97,114,100,32,116,104,101,32,116,111,112,
-                       32,105,116,101,109,32,111,110,32,116,104,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,115,116,97,99,107,46,0,82,101,109,111,118,
-                       101,32,116,111,112,32,116,119,111,32,105,116,101,109,115,32,111,110,32,116,
-                       104,101,32,115,116,97,99,107,46,0,68,105,115,112,108,97,121,32,116,104,
-                       101,32,105,116,101,109,115,32,111,110,32,116,104,101,32,97,108,116,101,114,
-                       110,97,116,101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
-                       115,116,97,99,107,46,0,68,105,115,112,108,97,121,32,116,104,101,32,105,
-                       116,101,109,115,32,111,110,32,116,104,101,32,102,108,111,97,116,105,110,103,
-                       45,112,111,105,110,116,32,115,116,97,99,107,46,0,68,117,112,108,105,99,
-                       97,116,101,32,116,104,101,32,116,111,112,32,105,116,101,109,32,111,110,32,
-                       116,104,101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,115,
-                       116,97,99,107,46,0,68,117,112,108,105,99,97,116,101,32,116,104,101,32,
-                       116,111,112,32,116,119,111,32,105,116,101,109,115,32,111,110,32,116,104,101,
-                       32,115,116,97,99,107,46,0,67,111,109,112,97,114,101,32,116,119,111,32,
-                       102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,
-                       115,32,102,111,114,32,101,113,117,97,108,105,116,121,46,32,82,101,116,117,
-                       114,110,115,32,96,84,82,85,69,96,32,105,102,32,116,104,101,121,32,97,
-                       114,101,32,101,113,117,97,108,32,111,114,32,96,70,65,76,83,69,96,32,
-                       111,116,104,101,114,119,105,115,101,46,0,70,101,116,99,104,32,97,32,115,
-                       116,111,114,101,100,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
-                       32,118,97,108,117,101,46,0,80,101,114,102,111,114,109,32,97,32,109,97,
-                       116,104,101,109,97,116,105,99,97,108,32,102,108,111,111,114,32,111,112,101,
-                       114,97,116,105,111,110,32,111,110,32,116,104,101,32,102,108,111,97,116,105,
-                       110,103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,67,111,109,112,
-                       97,114,101,32,116,119,111,32,102,108,111,97,116,105,110,103,45,112,111,105,
-                       110,116,32,118,97,108,117,101,115,32,102,111,114,32,103,114,101,97,116,101,
-                       114,32,116,104,97,110,46,0,73,110,99,114,101,109,101,110,116,32,110,32,
-                       98,121,32,111,110,101,46,0,82,101,116,117,114,110,32,96,84,82,85,69,
-                       96,32,105,102,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
-                       118,97,108,117,101,32,105,115,32,73,78,70,32,111,114,32,96,70,65,76,
-                       83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,
-                       110,32,110,32,105,102,32,105,116,32,105,115,32,119,105,116,104,105,110,32,
-                       116,104,101,32,108,111,119,101,114,32,40,108,41,32,97,110,100,32,117,112,
-                       112,101,114,32,40,117,41,32,98,111,117,110,100,115,46,32,73,102,32,111,
-                       117,116,115,105,100,101,32,116,104,101,32,98,111,117,110,100,115,44,32,114,
-                       101,116,117,114,110,32,116,104,101,32,99,108,111,115,101,115,32,98,111,117,
-                       110,100,97,114,121,32,118,97,108,117,101,46,0,82,101,116,117,114,110,32,
-                       108,111,103,40,70,49,41,32,102,111,114,32,98,97,115,101,32,70,50,32,
-                       102,111,114,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,
-                       97,108,117,101,115,46,0,67,111,109,112,97,114,101,32,116,119,111,32,102,
-                       108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,
-                       32,102,111,114,32,108,101,115,115,32,116,104,97,110,46,0,82,101,116,117,
-                       114,110,32,116,104,101,32,103,114,101,97,116,101,114,32,111,102,32,116,119,
-                       111,32,118,97,108,117,101,115,46,0,82,101,116,117,114,110,32,116,104,101,
-                       32,108,101,115,115,101,114,32,111,102,32,116,119,111,32,118,97,108,117,101,
-                       115,46,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,
-                       102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,
-                       32,105,115,32,78,97,78,32,111,114,32,96,70,65,76,83,69,96,32,111,
-                       116,104,101,114,119,105,115,101,46,0,73,110,118,101,114,116,32,116,104,101,
-                       32,115,105,103,110,32,111,102,32,116,104,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,82,101,116,117,114,
-                       110,32,96,84,82,85,69,96,32,105,102,32,102,108,111,97,116,105,110,103,
-                       45,112,111,105,110,116,32,118,97,108,117,101,32,105,115,32,110,101,103,97,
-                       116,105,118,101,32,111,114,32,96,70,65,76,83,69,96,32,105,102,32,110,
-                       111,116,46,0,82,101,109,111,118,101,32,116,104,101,32,115,101,99,111,110,
-                       100,32,105,116,101,109,32,102,114,111,109,32,116,104,101,32,115,116,97,99,
-                       107,46,0,80,117,116,32,97,32,99,111,112,121,32,111,102,32,116,104,101,
-                       32,115,101,99,111,110,100,32,102,108,111,97,116,105,110,103,45,112,111,105,
-                       110,116,32,118,97,108,117,101,32,111,118,101,114,32,116,104,101,32,116,111,
-                       112,32,111,110,101,46,0,80,111,112,32,97,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,118,97,108,117,101,32,102,114,111,109,32,116,
-                       104,101,32,97,108,116,101,114,110,97,116,101,32,115,116,97,99,107,46,0,
-                       82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,102,108,111,
-                       97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,105,115,
-                       32,112,111,115,105,116,105,118,101,32,111,114,32,96,70,65,76,83,69,96,
-                       32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,70,
-                       49,94,70,50,32,102,111,114,32,102,108,111,97,116,105,110,103,45,112,111,
-                       105,110,116,32,118,97,108,117,101,115,46,0,80,117,115,104,32,97,32,102,
-                       108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,
-                       116,111,32,97,110,32,97,108,116,101,114,110,97,116,105,118,101,32,115,116,
-                       97,99,107,46,0,68,105,115,112,108,97,121,32,97,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,114,46,0,82,111,
-                       116,97,116,101,32,116,104,101,32,116,111,112,32,116,104,114,101,101,32,118,
-                       97,108,117,101,115,46,0,82,111,117,110,100,32,97,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,82,101,116,
-                       117,114,110,32,49,32,105,102,32,116,104,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,118,97,108,117,101,32,105,115,32,112,111,115,
-                       105,116,105,118,101,32,111,114,32,45,49,32,105,102,32,105,116,32,105,115,
-                       32,110,101,103,97,116,105,118,101,46,0,82,101,116,117,114,110,32,116,104,
-                       101,32,115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,32,102,
-                       108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,114,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,115,113,117,97,114,101,32,
-                       111,102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
-                       110,117,109,98,101,114,46,0,82,101,116,117,114,110,32,116,104,101,32,115,
-                       105,110,101,32,111,102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,
-                       105,110,116,32,110,117,109,98,101,114,46,0,82,101,116,117,114,110,32,116,
-                       104,101,32,115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,32,
-                       102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,
-                       114,46,0,82,101,116,117,114,110,32,116,104,101,32,115,113,117,97,114,101,
-                       32,111,102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
-                       32,110,117,109,98,101,114,46,0,83,116,111,114,101,32,97,32,102,108,111,
-                       97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,116,111,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,109,101,109,111,114,
-                       121,32,108,111,99,97,116,105,111,110,46,0,69,120,99,104,97,110,103,101,
-                       32,116,104,101,32,116,111,112,32,97,110,100,32,115,101,99,111,110,100,32,
-                       105,116,101,109,115,32,111,110,32,116,104,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,115,116,97,99,107,46,0,82,101,116,117,114,
-                       110,32,116,104,101,32,116,97,110,103,101,110,116,32,111,102,32,97,32,102,
-                       108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,114,
-                       46,0,69,110,99,111,100,101,32,116,104,101,32,102,108,111,97,116,105,110,
-                       103,45,112,111,105,110,116,32,118,97,108,117,101,32,116,111,32,97,110,32,
-                       105,110,116,101,103,101,114,46,0,67,111,110,118,101,114,116,32,97,32,102,
-                       108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,
-                       105,110,116,111,32,97,32,110,117,109,98,101,114,46,0,67,111,110,118,101,
-                       114,116,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
-                       118,97,108,117,101,32,105,110,116,111,32,97,32,115,116,114,105,110,103,46,
-                       0,84,117,99,107,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,
-                       116,111,112,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,
-                       97,108,117,101,32,117,110,100,101,114,32,116,104,101,32,115,101,99,111,110,
-                       100,32,111,110,101,46,0,70,101,116,99,104,32,116,104,101,32,118,97,108,
-                       117,101,32,115,116,111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,0,70,101,116,99,
-                       104,32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,
-                       116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,
-                       101,115,115,46,32,82,101,116,117,114,110,115,32,116,104,101,32,110,101,120,
-                       116,32,97,100,100,114,101,115,115,32,97,110,100,32,116,104,101,32,118,97,
-                       108,117,101,46,0,73,110,118,111,107,101,32,97,110,32,70,70,73,32,102,
-                       117,110,99,116,105,111,110,46,32,83,101,116,32,116,104,101,32,115,116,97,
-                       99,107,32,97,115,32,110,101,101,100,101,100,44,32,97,110,100,32,112,97,
-                       115,115,32,116,104,101,32,70,70,73,32,104,97,110,100,108,101,32,116,111,
-                       32,116,104,105,115,46,0,77,97,112,32,105,110,32,97,32,115,121,109,98,
-                       111,108,32,102,114,111,109,32,97,32,115,104,97,114,101,100,32,108,105,98,
-                       114,97,114,121,32,111,114,32,111,98,106,101,99,116,32,102,105,108,101,46,
-                       32,82,101,116,117,114,110,115,32,97,110,32,70,70,73,32,104,97,110,100,
-                       108,101,46,0,79,112,101,110,32,97,32,115,104,97,114,101,100,32,108,105,
-                       98,114,97,114,121,32,111,114,32,111,98,106,101,99,116,32,102,105,108,101,
-                       46,0,84,114,105,103,103,101,114,32,97,110,32,105,47,111,32,111,112,101,
-                       114,97,116,105,111,110,32,117,115,105,110,103,32,116,104,101,32,70,70,73,
-                       32,100,101,118,105,99,101,46,0,67,111,110,115,116,97,110,116,32,102,111,
-                       114,32,111,112,101,110,105,110,103,32,97,32,102,105,108,101,32,105,110,32,
-                       65,80,80,69,78,68,32,109,111,100,101,46,0,67,111,110,115,116,97,110,
-                       116,32,102,111,114,32,111,112,101,110,105,110,103,32,97,32,102,105,108,101,
-                       32,105,110,32,82,69,65,68,32,109,111,100,101,46,0,67,111,110,115,116,
-                       97,110,116,32,102,111,114,32,111,112,101,110,105,110,103,32,97,32,102,105,
-                       108,101,32,105,110,32,82,69,65,68,32,38,32,87,82,73,84,69,32,109,
-                       111,100,101,46,0,67,111,110,115,116,97,110,116,32,102,111,114,32,111,112,
-                       101,110,105,110,103,32,97,32,102,105,108,101,32,105,110,32,87,82,73,84,
-                       69,32,109,111,100,101,46,0,71,105,118,101,110,32,97,32,102,105,108,101,
-                       32,104,97,110,100,108,101,44,32,99,108,111,115,101,32,116,104,101,32,102,
-                       105,108,101,46,0,68,101,108,101,116,101,32,116,104,101,32,110,97,109,101,
-                       100,32,102,105,108,101,46,0,71,105,118,101,110,32,97,32,102,105,108,101,
-                       32,110,97,109,101,44,32,114,101,116,117,114,110,32,96,84,82,85,69,96,
-                       32,105,102,32,105,116,32,101,120,105,115,116,115,32,111,114,32,96,70,65,
-                       76,83,69,96,32,105,102,32,105,116,32,100,111,101,115,32,110,111,116,46,
-                       0,71,105,118,101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,
-                       44,32,102,108,117,115,104,32,97,110,121,32,112,101,110,100,105,110,103,32,
-                       119,114,105,116,101,115,32,116,111,32,100,105,115,107,46,0,71,105,118,101,
-                       110,32,97,32,102,105,108,101,32,110,97,109,101,44,32,111,112,101,110,32,
-                       105,116,32,97,110,100,32,114,117,110,32,116,104,101,32,113,117,111,116,101,
-                       32,111,110,99,101,32,102,111,114,32,101,97,99,104,32,108,105,110,101,32,
-                       105,110,32,116,104,101,32,102,105,108,101,46,0,71,105,118,101,110,32,97,
-                       32,102,105,108,101,32,110,97,109,101,44,32,111,112,101,110,32,105,116,32,
-                       97,110,100,32,114,117,110,32,116,104,101,32,113,117,111,116,101,32,111,110,
-                       99,101,32,102,111,114,32,101,97,99,104,32,98,121,116,101,32,105,110,32,
-                       116,104,101,32,102,105,108,101,46,0,79,112,101,110,32,97,32,110,97,109,
-                       101,100,32,102,105,108,101,32,40,115,41,32,119,105,116,104,32,116,104,101,
-                       32,103,105,118,101,110,32,109,111,100,101,32,40,109,41,46,32,82,101,116,
-                       117,114,110,115,32,97,32,104,97,110,100,108,101,32,105,100,101,110,116,105,
-                       102,121,105,110,103,32,116,104,101,32,102,105,108,101,46,0,79,112,101,110,
-                       32,97,32,102,105,108,101,32,102,111,114,32,114,101,97,100,105,110,103,32,
-                       38,32,119,114,105,116,105,110,103,46,32,82,101,116,117,114,110,115,32,116,
-                       104,101,32,115,105,122,101,32,40,78,79,83,41,32,97,110,100,32,97,32,
-                       102,105,108,101,32,73,68,32,40,84,79,83,41,0,79,112,101,110,32,97,
-                       32,102,105,108,101,32,102,111,114,32,114,101,97,100,105,110,103,46,32,82,
-                       101,116,117,114,110,115,32,116,104,101,32,115,105,122,101,32,40,78,79,83,
-                       41,32,97,110,100,32,97,32,102,105,108,101,32,73,68,32,40,84,79,83,
-                       41,0,79,112,101,110,32,97,32,102,105,108,101,32,102,111,114,32,119,114,
-                       105,116,105,110,103,46,32,82,101,116,117,114,110,115,32,116,104,101,32,102,
-                       105,108,101,32,73,68,0,84,114,105,103,103,101,114,32,97,32,102,105,108,
-                       101,32,73,47,79,32,111,112,101,114,97,116,105,111,110,46,32,84,104,105,
-                       115,32,105,115,32,110,111,116,32,105,110,116,101,110,100,101,100,32,116,111,
-                       32,98,101,32,117,115,101,100,32,100,105,114,101,99,116,108,121,46,0,71,
-                       105,118,101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,44,32,
-                       114,101,97,100,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,
-                       110,101,120,116,32,98,121,116,101,32,105,110,32,105,116,46,0,71,105,118,
-                       101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,44,32,114,101,
-                       97,100,32,97,32,108,105,110,101,32,97,110,100,32,114,101,116,117,114,110,
-                       32,97,32,112,111,105,110,116,101,114,32,116,111,32,105,116,46,0,71,105,
-                       118,101,110,32,97,32,112,111,105,110,116,101,114,44,32,97,32,99,111,117,
-                       110,116,44,32,97,110,100,32,97,32,102,105,108,101,32,104,97,110,100,108,
-                       101,44,32,114,101,97,100,32,97,110,100,32,115,116,111,114,101,32,116,104,
-                       101,32,114,101,113,117,101,115,116,101,100,32,110,117,109,98,101,114,32,111,
-                       102,32,98,121,116,101,115,32,105,110,116,111,32,109,101,109,111,114,121,44,
-                       32,115,116,97,114,116,105,110,103,32,97,116,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,0,71,105,118,101,
-                       110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,44,32,114,101,97,
-                       100,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,110,101,120,
-                       116,32,99,104,97,114,97,99,116,101,114,32,105,110,32,105,116,46,32,73,
-                       102,32,99,111,109,112,105,108,101,100,32,119,105,116,104,32,85,84,70,51,
-                       50,32,115,117,112,112,111,114,116,32,116,104,105,115,32,119,105,108,108,32,
-                       114,101,97,100,32,97,110,100,32,99,111,110,118,101,114,116,32,85,84,70,
-                       56,46,0,77,111,118,101,32,116,104,101,32,99,117,114,114,101,110,116,32,
-                       111,102,102,115,101,116,32,105,110,116,111,32,97,32,102,105,108,101,32,116,
-                       111,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,111,110,101,46,
-                       0,71,105,118,101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,
-                       44,32,114,101,116,117,114,110,32,116,104,101,32,115,105,122,101,32,111,102,
-                       32,116,104,101,32,102,105,108,101,32,40,105,110,32,98,121,116,101,115,41,
-                       46,0,71,105,118,101,110,32,97,110,32,97,100,100,114,101,115,115,32,97,
-                       110,100,32,97,32,102,105,108,101,32,110,97,109,101,44,32,114,101,97,100,
-                       32,116,104,101,32,102,105,108,101,32,99,111,110,116,101,110,116,115,32,105,
-                       110,116,111,32,109,101,109,111,114,121,32,115,116,97,114,116,105,110,103,32,
-                       97,116,32,116,104,101,32,97,100,100,114,101,115,115,46,0,71,105,118,101,
-                       110,32,97,32,115,116,114,105,110,103,32,40,115,49,41,32,97,110,100,32,
-                       97,32,102,105,108,101,32,110,97,109,101,32,40,115,50,41,44,32,119,114,
-                       105,116,101,32,116,104,101,32,115,116,114,105,110,103,32,105,110,116,111,32,
-                       116,104,101,32,102,105,108,101,44,32,114,101,112,108,97,99,105,110,103,32,
-                       97,110,121,32,101,120,105,115,116,105,110,103,32,99,111,110,116,101,110,116,
-                       46,0,71,105,118,101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,
-                       101,44,32,114,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,
-                       116,32,111,102,102,115,101,116,32,105,110,32,116,104,101,32,102,105,108,101,
-                       46,0,87,114,105,116,101,32,97,32,98,121,116,101,32,116,111,32,116,104,
-                       101,32,102,105,108,101,32,114,101,112,114,101,115,101,110,116,101,100,32,98,
-                       121,32,116,104,101,32,104,97,110,100,108,101,46,0,87,114,105,116,101,32,
-                       110,32,98,121,116,101,115,32,116,111,32,116,104,101,32,102,105,108,101,32,
-                       114,101,112,114,101,115,101,110,116,101,100,32,98,121,32,116,104,101,32,104,
-                       97,110,100,108,101,46,32,66,121,116,101,115,32,97,114,101,32,116,97,107,
-                       101,110,32,102,114,111,109,32,109,101,109,111,114,121,44,32,115,116,97,114,
-                       116,105,110,103,32,97,116,32,116,104,101,32,112,114,111,118,105,100,101,100,
-                       32,97,100,100,114,101,115,115,46,0,87,114,105,116,101,32,97,32,99,104,
-                       97,114,97,99,116,101,114,32,116,111,32,116,104,101,32,102,105,108,101,32,
-                       114,101,112,114,101,115,101,110,116,101,100,32,98,121,32,116,104,101,32,104,
-                       97,110,100,108,101,46,32,73,102,32,98,117,105,108,116,32,119,105,116,104,
-                       32,85,84,70,51,50,32,115,117,112,112,111,114,116,44,32,116,104,105,115,
-                       32,119,105,108,108,32,116,114,97,110,115,108,97,116,101,32,116,104,101,32,
-                       99,104,97,114,97,99,116,101,114,32,98,97,99,107,32,116,111,32,97,32,
-                       85,84,70,56,32,115,101,113,117,101,110,99,101,32,98,101,102,111,114,101,
-                       32,119,114,105,116,105,110,103,46,0,70,105,108,108,32,109,101,109,111,114,
-                       121,32,115,116,97,114,116,105,110,103,32,97,116,32,34,112,34,32,119,105,
-                       116,104,32,118,97,108,117,101,32,34,118,34,46,32,70,105,108,108,115,32,
-                       34,110,34,32,99,101,108,108,115,46,0,65,112,112,101,110,100,32,97,32,
-                       99,111,110,115,32,99,101,108,108,32,116,111,32,97,32,108,105,115,116,46,
-                       0,67,114,101,97,116,101,32,97,32,110,101,119,32,108,105,115,116,32,119,
-                       105,116,32,116,104,101,32,103,105,118,101,110,32,118,97,108,117,101,32,97,
-                       115,32,116,104,101,32,99,97,114,32,111,102,32,116,104,101,32,102,105,114,
-                       115,116,32,110,111,100,101,46,0,82,101,109,111,118,101,32,116,104,101,32,
-                       115,112,101,99,105,102,105,101,100,32,99,111,110,115,32,102,114,111,109,32,
-                       97,32,108,105,115,116,46,0,82,101,109,111,118,101,32,116,104,101,32,108,
-                       97,115,116,32,99,111,110,115,32,102,114,111,109,32,97,32,108,105,115,116,
-                       46,0,82,117,110,32,97,32,113,117,111,116,97,116,105,111,110,32,97,103,
-                       97,105,110,115,116,32,101,97,99,104,32,118,97,108,117,101,32,105,110,32,
-                       97,32,108,105,115,116,46,0,73,110,115,101,114,116,32,97,32,110,101,119,
-                       32,99,111,110,115,32,40,118,41,32,105,110,116,111,32,116,104,101,32,108,
-                       105,115,116,32,40,112,41,44,32,97,116,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,105,110,100,101,120,32,40,110,41,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,108,101,110,103,116,104,32,111,102,32,97,32,
-                       108,105,115,116,46,0,68,105,115,112,108,97,121,32,116,104,101,32,40,97,
-                       115,32,110,117,109,98,101,114,115,41,32,118,97,108,117,101,115,32,105,110,
-                       32,97,32,108,105,115,116,46,0,71,105,118,101,110,32,97,32,112,111,105,
-                       110,116,101,114,32,116,111,32,97,32,108,105,115,116,44,32,114,101,116,117,
-                       114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
-                       108,97,115,116,32,99,111,110,115,32,99,101,108,108,46,0,71,105,118,101,
-                       110,32,97,32,110,111,100,101,32,110,117,109,98,101,114,44,32,114,101,116,
-                       117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,
-                       32,99,111,110,115,32,99,101,108,108,32,105,110,32,116,104,101,32,108,105,
-                       115,116,46,0,84,114,105,103,103,101,114,32,97,32,102,108,111,97,116,105,
-                       110,103,45,112,111,105,110,116,32,111,112,101,114,97,116,105,111,110,46,32,
-                       84,104,105,115,32,105,115,32,110,111,116,32,105,110,116,101,110,100,101,100,
-                       32,116,111,32,98,101,32,117,115,101,100,32,100,105,114,101,99,116,108,121,
-                       46,0,82,117,110,32,113,117,111,116,97,116,105,111,110,32,105,110,32,97,
-                       110,32,101,110,100,108,101,115,115,32,108,111,111,112,46,0,83,97,118,101,
-                       32,118,97,108,117,101,32,111,102,32,96,72,101,97,112,96,44,32,114,117,
-                       110,32,116,104,101,32,102,117,110,99,116,105,111,110,32,112,114,111,118,105,
-                       100,101,100,44,32,116,104,101,110,32,114,101,115,116,111,114,101,32,96,72,
-                       101,97,112,96,46,0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,
-                       32,110,50,46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,
-                       102,32,110,49,32,105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,
-                       32,110,50,44,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,
-                       114,119,105,115,101,46,0,67,111,109,112,97,114,101,32,110,49,32,97,110,
-                       100,32,110,50,46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,
-                       105,102,32,110,49,32,105,115,32,103,114,101,97,116,101,114,32,116,104,97,
-                       110,32,111,114,32,101,113,117,97,108,32,116,111,32,110,50,44,32,111,114,
-                       32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,
-                       70,101,116,99,104,32,116,104,101,32,49,54,45,98,105,116,32,118,97,108,
-                       117,101,32,115,116,111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,32,65,100,100,114,
-                       101,115,115,105,110,103,32,102,111,114,32,116,104,105,115,32,105,115,32,105,
-                       110,32,56,45,98,105,116,32,117,110,105,116,115,46,0,70,101,116,99,104,
-                       32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,
-                       115,115,46,32,82,101,116,117,114,110,115,32,116,104,101,32,110,101,120,116,
-                       32,97,100,100,114,101,115,115,32,97,110,100,32,116,104,101,32,118,97,108,
-                       117,101,46,0,83,116,111,114,101,32,97,110,32,49,54,45,98,105,116,32,
-                       118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,99,105,
-                       102,105,101,100,32,97,100,100,114,101,115,115,46,32,65,100,100,114,101,115,
-                       115,105,110,103,32,102,111,114,32,116,104,105,115,32,105,115,32,105,110,32,
-                       56,45,98,105,116,32,117,110,105,116,115,46,0,83,116,111,114,101,32,97,
-                       32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,97,100,100,114,101,115,115,32,97,110,100,32,114,101,
-                       116,117,114,110,32,116,104,101,32,110,101,120,116,32,97,100,100,114,101,115,
-                       115,46,0,82,101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,102,
-                       114,101,101,32,97,100,100,114,101,115,115,32,105,110,32,109,101,109,111,114,
-                       121,46,0,83,101,116,32,96,66,97,115,101,96,32,116,111,32,104,101,120,
-                       97,100,101,99,105,109,97,108,46,0,65,100,100,32,97,32,104,111,111,107,
-                       32,112,111,105,110,116,32,105,110,116,111,32,116,104,101,32,99,117,114,114,
-                       101,110,116,32,119,111,114,100,46,32,84,104,105,115,32,115,104,111,117,108,
-                       100,32,111,110,108,121,32,98,101,32,117,115,101,100,32,97,115,32,116,104,
-                       101,32,102,105,114,115,116,32,119,111,114,100,32,105,110,32,97,32,100,101,
-                       102,105,110,105,116,105,111,110,46,0,65,115,115,101,109,98,108,101,32,116,
-                       104,101,32,105,110,115,116,114,117,99,116,105,111,110,115,32,115,112,101,99,
-                       105,102,105,101,100,32,98,121,32,116,104,101,32,115,116,114,105,110,103,32,
-                       105,110,116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,97,115,115,
-                       101,109,98,108,121,32,115,99,111,112,101,46,0,69,120,101,99,117,116,101,
-                       32,116,104,101,32,113,117,111,116,101,32,105,102,32,116,104,101,32,102,108,
-                       97,103,32,105,115,32,96,84,82,85,69,96,46,0,69,120,101,99,117,116,
-                       101,32,116,104,101,32,113,117,111,116,97,116,105,111,110,32,105,102,32,116,
-                       104,101,32,102,108,97,103,32,105,115,32,96,84,82,85,69,96,46,32,73,
-                       102,32,116,114,117,101,44,32,97,108,115,111,32,101,120,105,116,32,116,104,
-                       101,32,119,111,114,100,46,0,67,104,97,110,103,101,32,116,104,101,32,99,
-                       108,97,115,115,32,111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,
-                       101,110,116,108,121,32,100,101,102,105,110,101,100,32,119,111,114,100,32,116,
-                       111,32,96,99,108,97,115,115,58,109,97,99,114,111,96,46,0,82,117,110,
-                       32,116,104,101,32,99,111,100,101,32,105,110,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,102,105,108,101,46,32,0,82,117,110,32,97,32,
-                       113,117,111,116,101,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
-                       110,117,109,98,101,114,32,111,102,32,116,105,109,101,115,44,32,116,114,97,
-                       99,107,105,110,103,32,116,104,101,32,108,111,111,112,32,105,110,100,101,120,
-                       32,105,110,32,96,73,96,46,32,84,104,105,115,32,105,115,32,108,101,115,
-                       115,32,101,102,102,105,99,105,101,110,116,32,116,104,97,110,32,96,116,105,
-                       109,101,115,96,44,32,115,111,32,105,102,32,116,104,101,32,105,110,100,101,
-                       120,32,105,115,32,110,111,116,32,110,101,101,100,101,100,44,32,116,104,105,
-                       115,32,115,104,111,117,108,100,32,98,101,32,97,118,111,105,100,101,100,46,
-                       0,86,101,99,116,111,114,101,100,46,32,73,110,116,101,114,112,114,101,116,
-                       32,97,32,115,105,110,103,108,101,32,105,110,112,117,116,32,116,111,107,101,
-                       110,46,0,84,114,105,103,103,101,114,32,97,110,32,73,47,79,32,111,112,
-                       101,114,97,116,105,111,110,32,105,110,118,111,108,118,105,110,103,32,109,117,
-                       108,116,105,99,111,114,101,32,115,117,112,112,111,114,116,46,32,85,110,105,
-                       120,32,115,121,115,116,101,109,32,99,97,108,108,46,0,82,101,116,117,114,
-                       110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,73,47,79,32,
-                       100,101,118,105,99,101,115,46,0,73,110,118,111,107,101,32,97,110,32,105,
-                       110,116,101,114,97,99,116,105,111,110,32,119,105,116,104,32,97,110,32,73,
-                       47,79,32,100,101,118,105,99,101,46,0,65,115,107,32,97,110,32,73,47,
-                       79,32,100,101,118,105,99,101,32,116,111,32,105,100,101,110,116,105,102,121,
-                       32,105,116,115,101,108,102,46,32,82,101,116,117,114,110,115,32,97,32,118,
-                       101,114,115,105,111,110,32,40,109,41,32,97,110,100,32,100,101,118,105,99,
-                       101,32,73,68,32,40,78,41,46,0,83,99,97,110,32,116,104,101,32,73,
-                       47,79,32,100,101,118,105,99,101,115,32,102,111,114,32,97,32,100,101,118,
-                       105,99,101,32,119,105,116,104,32,97,32,115,112,101,99,105,102,105,101,100,
-                       32,73,68,46,32,82,101,116,117,114,110,115,32,116,104,101,32,100,101,118,
-                       105,99,101,32,110,117,109,98,101,114,44,32,111,114,32,45,49,32,105,102,
-                       32,110,111,116,32,102,111,117,110,100,46,0,84,114,105,103,103,101,114,32,
-                       97,32,85,110,105,120,32,115,121,115,116,101,109,32,99,97,108,108,46,32,
-                       84,104,105,115,32,105,115,32,110,111,116,32,105,110,116,101,110,100,101,100,
-                       32,116,111,32,98,101,32,117,115,101,100,32,100,105,114,101,99,116,108,121,
-                       46,0,68,97,116,97,46,32,82,101,116,117,114,110,32,97,32,116,101,109,
-                       112,108,97,116,101,32,102,111,114,32,97,32,108,105,98,114,97,114,121,32,
-                       102,105,108,101,32,110,97,109,101,32,105,110,32,96,126,47,46,99,111,110,
-                       102,105,103,47,114,101,116,114,111,102,111,114,116,104,47,108,105,98,114,97,
-                       114,121,96,46,0,70,105,110,100,32,116,104,101,32,117,115,101,114,115,32,
-                       104,111,109,101,32,100,105,114,101,99,116,111,114,121,32,97,110,100,32,99,
-                       111,110,115,116,114,117,99,116,32,97,32,102,105,108,101,110,97,109,101,32,
-                       102,111,114,32,97,32,108,105,98,114,97,114,121,32,105,110,32,116,104,101,
-                       32,96,126,47,46,99,111,110,102,105,103,47,114,101,116,114,111,102,111,114,
-                       116,104,47,108,105,98,114,97,114,121,96,32,100,105,114,101,99,116,111,114,
-                       121,46,0,68,97,116,97,46,32,82,101,116,117,114,110,32,97,32,116,101,
-                       109,112,108,97,116,101,32,102,111,114,32,97,32,108,105,98,114,97,114,121,
-                       32,102,105,108,101,32,110,97,109,101,32,105,110,32,96,46,47,108,105,98,
-                       114,97,114,121,96,46,0,67,104,101,99,107,32,116,111,32,115,101,101,32,
-                       105,102,32,97,32,108,105,98,114,97,114,121,32,101,120,105,115,116,115,46,
-                       0,67,111,110,115,116,114,117,99,116,32,97,32,102,105,108,101,110,97,109,
-                       101,32,102,111,114,32,97,32,108,105,98,114,97,114,121,32,105,110,32,116,
-                       104,101,32,96,126,47,108,105,98,114,97,114,121,96,32,100,105,114,101,99,
-                       116,111,114,121,46,0,71,105,118,101,110,32,97,32,108,105,98,114,97,114,
-                       121,32,110,97,109,101,44,32,99,111,110,115,116,114,117,99,116,32,116,104,
-                       101,32,97,99,116,117,97,108,32,102,105,108,101,110,97,109,101,32,116,111,
-                       32,108,111,97,100,46,0,76,111,97,100,32,97,32,108,105,98,114,97,114,
-                       121,46,32,84,104,105,115,32,119,105,108,108,32,108,111,97,100,32,116,104,
-                       101,32,115,116,114,105,110,103,44,32,119,105,116,104,32,34,46,114,101,116,
-                       114,111,34,46,0,34,82,117,110,32,105,110,116,101,114,97,99,116,105,118,
-                       101,32,34,34,108,105,115,116,101,110,101,114,34,34,32,40,97,32,82,69,
-                       80,76,41,46,34,0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,
-                       32,110,50,46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,
-                       102,32,110,49,32,105,115,32,108,101,115,115,32,116,104,97,110,32,110,50,
-                       44,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,
-                       115,101,46,0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,32,110,
-                       50,46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,
-                       110,49,32,105,115,32,108,101,115,115,32,116,104,97,110,32,111,114,32,101,
-                       113,117,97,108,32,116,111,32,110,50,44,32,111,114,32,96,70,65,76,83,
-                       69,96,32,111,116,104,101,114,119,105,115,101,46,0,68,105,118,105,100,101,
-                       32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,32,114,101,116,117,
-                       114,110,32,116,104,101,32,114,101,109,97,105,110,100,101,114,46,0,82,101,
-                       116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,117,109,98,101,
-                       114,32,105,115,32,110,111,116,32,122,101,114,111,44,32,111,114,32,96,70,
-                       65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,109,97,120,105,109,117,109,32,118,97,108,117,
-                       101,32,116,104,97,116,32,119,105,108,108,32,102,105,116,32,105,110,32,97,
-                       32,99,101,108,108,46,0,82,101,116,117,114,110,32,116,104,101,32,109,105,
-                       110,105,109,117,109,32,118,97,108,117,101,32,116,104,97,116,32,119,105,108,
-                       108,32,102,105,116,32,105,110,32,97,32,99,101,108,108,46,0,82,101,116,
-                       117,114,110,32,116,104,101,32,97,98,115,111,108,117,116,101,32,118,97,108,
-                       117,101,32,111,102,32,97,32,110,117,109,98,101,114,46,0,65,100,100,32,
-                       96,110,49,96,32,116,111,32,96,110,50,96,32,97,110,100,32,114,101,116,
-                       117,114,110,32,116,104,101,32,114,101,115,117,108,116,46,0,82,101,116,117,
-                       114,110,32,84,82,85,69,32,105,102,32,110,117,109,98,101,114,32,105,115,
-                       32,98,101,116,119,101,101,110,32,116,104,101,32,108,111,119,101,114,32,40,
-                       108,41,32,97,110,100,32,117,112,112,101,114,32,40,117,41,32,98,111,117,
-                       110,100,115,46,32,73,102,32,110,111,116,44,32,114,101,116,117,114,110,32,
-                       70,65,76,83,69,46,32,84,104,105,115,32,105,115,32,105,110,99,108,117,
-                       115,105,118,101,32,111,102,32,116,104,101,32,108,105,109,105,116,115,46,0,
-                       68,101,99,114,101,109,101,110,116,32,110,32,98,121,32,111,110,101,46,0,
-                       68,105,118,105,100,101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,
-                       100,32,114,101,116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,
-                       32,112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,105,101,110,
-                       116,46,0,68,105,118,105,100,101,32,96,110,96,32,98,121,32,96,109,96,
-                       32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,105,110,116,101,
-                       103,101,114,32,112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,
-                       105,101,110,116,32,97,110,100,32,114,101,109,97,105,110,100,101,114,46,0,
-                       82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,117,109,
-                       98,101,114,32,105,115,32,101,118,101,110,44,32,111,114,32,96,70,65,76,
-                       83,69,96,32,105,102,32,110,111,116,46,0,73,110,99,114,101,109,101,110,
-                       116,32,110,32,98,121,32,111,110,101,46,0,82,101,116,117,114,110,32,110,
-                       32,105,102,32,105,116,32,105,115,32,119,105,116,104,105,110,32,116,104,101,
-                       32,108,111,119,101,114,32,40,108,41,32,97,110,100,32,117,112,112,101,114,
-                       32,40,117,41,32,98,111,117,110,100,115,46,32,73,102,32,111,117,116,115,
-                       105,100,101,32,116,104,101,32,98,111,117,110,100,115,44,32,114,101,116,117,
-                       114,110,32,116,104,101,32,99,108,111,115,101,115,32,98,111,117,110,100,97,
-                       114,121,32,118,97,108,117,101,46,0,82,101,116,117,114,110,32,116,104,101,
-                       32,103,114,101,97,116,101,114,32,111,102,32,116,119,111,32,118,97,108,117,
-                       101,115,46,0,82,101,116,117,114,110,32,116,104,101,32,108,101,115,115,101,
-                       114,32,111,102,32,116,119,111,32,118,97,108,117,101,115,46,0,68,105,118,
-                       105,100,101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,32,114,
-                       101,116,117,114,110,32,116,104,101,32,114,101,109,97,105,110,100,101,114,46,
-                       0,77,117,108,116,105,112,108,121,32,96,110,49,96,32,98,121,32,96,110,
-                       50,96,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,114,101,
-                       115,117,108,116,46,0,73,110,118,101,114,116,32,116,104,101,32,115,105,103,
-                       110,32,111,102,32,97,32,110,117,109,98,101,114,46,0,82,101,116,117,114,
-                       110,32,96,84,82,85,69,96,32,105,102,32,110,117,109,98,101,114,32,105,
-                       115,32,110,101,103,97,116,105,118,101,44,32,111,114,32,96,70,65,76,83,
-                       69,96,32,105,102,32,110,111,116,46,0,82,101,116,117,114,110,32,96,84,
-                       82,85,69,96,32,105,102,32,110,117,109,98,101,114,32,105,115,32,111,100,
-                       100,44,32,111,114,32,96,70,65,76,83,69,96,32,105,102,32,110,111,116,
-                       46,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,
-                       117,109,98,101,114,32,105,115,32,112,111,115,105,116,105,118,101,44,32,111,
-                       114,32,96,70,65,76,83,69,96,32,105,102,32,110,111,116,46,0,82,101,
-                       116,117,114,110,32,98,97,115,101,32,40,98,41,32,116,111,32,112,111,119,
-                       101,114,32,40,112,41,46,0,68,105,115,112,108,97,121,32,97,32,110,117,
-                       109,98,101,114,46,0,82,101,116,117,114,110,32,97,32,114,97,110,100,111,
-                       109,32,110,117,109,98,101,114,46,0,82,101,116,117,114,110,32,116,104,101,
-                       32,115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,32,110,117,
-                       109,98,101,114,46,0,82,101,116,117,114,110,32,116,104,101,32,115,113,117,
-                       97,114,101,32,111,102,32,97,32,110,117,109,98,101,114,46,0,82,101,116,
-                       117,114,110,32,84,82,85,69,32,105,102,32,110,117,109,98,101,114,32,105,
-                       115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,122,101,114,111,32,
-                       111,114,32,70,65,76,83,69,32,105,102,32,105,116,32,105,115,32,122,101,
-                       114,111,32,111,114,32,108,101,115,115,46,0,83,117,98,116,114,97,99,116,
-                       32,96,110,50,96,32,102,114,111,109,32,96,110,49,96,32,97,110,100,32,
-                       114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,108,116,46,0,67,
-                       111,110,118,101,114,116,32,97,32,110,117,109,98,101,114,32,105,110,116,111,
-                       32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,
-                       108,117,101,46,0,67,111,110,118,101,114,116,32,97,32,110,117,109,98,101,
-                       114,32,105,110,116,111,32,97,32,115,116,114,105,110,103,46,0,82,101,116,
-                       117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,117,109,98,101,114,
-                       32,105,115,32,122,101,114,111,44,32,111,114,32,96,70,65,76,83,69,96,
-                       32,111,116,104,101,114,119,105,115,101,46,0,82,101,109,111,118,101,32,116,
-                       104,101,32,115,101,99,111,110,100,32,105,116,101,109,32,102,114,111,109,32,
-                       116,104,101,32,115,116,97,99,107,46,0,68,105,115,112,108,97,121,32,97,
-                       32,110,101,119,108,105,110,101,46,0,80,101,114,102,111,114,109,32,97,32,
-                       108,111,103,105,99,97,108,32,78,79,84,32,111,112,101,114,97,116,105,111,
-                       110,46,0,83,101,116,32,96,66,97,115,101,96,32,116,111,32,111,99,116,
-                       97,108,46,0,80,101,114,102,111,114,109,32,97,32,98,105,116,119,105,115,
-                       101,32,79,82,32,98,101,116,119,101,101,110,32,116,104,101,32,112,114,111,
-                       118,105,100,101,100,32,118,97,108,117,101,115,46,0,80,117,116,32,97,32,
-                       99,111,112,121,32,111,102,32,110,32,111,118,101,114,32,109,46,0,80,97,
-                       99,107,32,102,111,117,114,32,56,45,98,105,116,32,118,97,108,117,101,115,
-                       32,105,110,116,111,32,97,32,51,50,45,98,105,116,32,118,97,108,117,101,
-                       46,0,77,111,118,101,32,97,32,118,97,108,117,101,32,102,114,111,109,32,
-                       116,104,101,32,114,101,116,117,114,110,32,115,116,97,99,107,32,116,111,32,
-                       116,104,101,32,100,97,116,97,32,115,116,97,99,107,46,0,67,104,97,110,
-                       103,101,32,116,104,101,32,99,108,97,115,115,32,111,102,32,116,104,101,32,
-                       109,111,115,116,32,114,101,99,101,110,116,108,121,32,100,101,102,105,110,101,
-                       100,32,119,111,114,100,32,116,111,32,96,99,108,97,115,115,58,112,114,105,
-                       109,105,116,105,118,101,96,46,0,77,111,118,101,32,97,32,118,97,108,117,
-                       101,32,102,114,111,109,32,116,104,101,32,100,97,116,97,32,115,116,97,99,
-                       107,32,116,111,32,116,104,101,32,114,101,116,117,114,110,32,115,116,97,99,
-                       107,46,0,76,111,111,107,117,112,32,97,32,114,101,102,101,114,101,110,99,
-                       101,32,98,121,32,110,97,109,101,32,97,110,100,32,105,110,108,105,110,101,
-                       32,105,116,115,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
-                       99,117,114,114,101,110,116,32,97,115,115,101,109,98,108,121,32,115,101,103,
-                       109,101,110,116,46,0,67,104,97,110,103,101,32,116,104,101,32,99,108,97,
-                       115,115,32,104,97,110,100,108,101,114,32,111,102,32,116,104,101,32,109,111,
-                       115,116,32,114,101,99,101,110,116,108,121,32,100,101,102,105,110,101,100,32,
-                       119,111,114,100,32,116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,
-                       100,32,111,110,101,46,0,82,101,115,116,114,117,99,116,117,114,101,32,116,
-                       104,101,32,111,114,100,101,114,32,111,102,32,105,116,101,109,115,32,111,110,
-                       32,116,104,101,32,115,116,97,99,107,46,0,66,101,103,105,110,32,97,110,
-                       32,117,110,99,111,110,100,105,116,105,111,110,97,108,32,108,111,111,112,46,
-                       0,82,101,109,111,118,101,32,97,108,108,32,105,116,101,109,115,32,102,114,
-                       111,109,32,116,104,101,32,115,116,97,99,107,46,0,82,111,116,97,116,101,
-                       32,116,104,101,32,116,111,112,32,116,104,114,101,101,32,118,97,108,117,101,
-                       115,46,0,67,111,109,112,105,108,101,32,116,104,101,32,99,111,100,101,32,
-                       110,101,101,100,101,100,32,116,111,32,112,117,115,104,32,97,32,115,116,114,
-                       105,110,103,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,115,
-                       116,97,99,107,32,97,110,100,32,105,110,108,105,110,101,32,116,104,101,32,
-                       115,116,114,105,110,103,32,100,97,116,97,32,105,110,116,111,32,116,104,101,
-                       32,99,117,114,114,101,110,116,32,100,101,102,105,110,105,116,105,111,110,46,
-                       0,67,111,110,115,116,97,110,116,46,32,82,101,116,117,114,110,115,32,97,
-                       32,115,116,114,105,110,103,32,111,102,32,116,104,101,32,65,83,67,73,73,
-                       32,108,101,116,116,101,114,115,32,40,117,112,112,101,114,32,97,110,100,32,
-                       108,111,119,101,114,32,99,97,115,101,41,0,67,111,110,115,116,97,110,116,
-                       46,32,82,101,116,117,114,110,115,32,97,32,115,116,114,105,110,103,32,111,
-                       102,32,116,104,101,32,65,83,67,73,73,32,108,101,116,116,101,114,115,32,
-                       105,110,32,108,111,119,101,114,99,97,115,101,0,67,111,110,115,116,97,110,
-                       116,46,32,82,101,116,117,114,110,115,32,97,32,115,116,114,105,110,103,32,
-                       111,102,32,116,104,101,32,65,83,67,73,73,32,108,101,116,116,101,114,115,
-                       32,105,110,32,117,112,112,101,114,99,97,115,101,0,67,111,110,115,116,97,
-                       110,116,46,32,82,101,116,117,114,110,32,97,32,115,116,114,105,110,103,32,
-                       111,102,32,99,104,97,114,97,99,116,101,114,115,32,114,101,99,111,103,110,
-                       105,122,101,100,32,97,115,32,110,117,109,101,114,105,99,32,100,105,103,105,
-                       116,115,46,0,67,111,110,115,116,97,110,116,46,32,82,101,116,117,114,110,
-                       32,97,32,115,116,114,105,110,103,32,111,102,32,99,104,97,114,97,99,116,
-                       101,114,115,32,114,101,99,111,103,110,105,122,101,100,32,97,115,32,112,117,
-                       110,99,116,117,97,116,105,111,110,46,0,67,111,110,115,116,97,110,116,46,
-                       32,82,101,116,117,114,110,115,32,97,32,115,116,114,105,110,103,32,111,102,
-                       32,99,104,97,114,97,99,116,101,114,115,32,114,101,99,111,103,110,105,122,
-                       101,100,32,97,115,32,119,104,105,116,101,115,112,97,99,101,46,0,82,101,
-                       116,117,114,110,32,97,32,110,101,119,32,115,116,114,105,110,103,32,99,111,
-                       110,115,105,115,116,105,110,103,32,111,102,32,115,49,32,102,111,108,108,111,
-                       119,101,100,32,98,121,32,115,50,46,0,82,101,116,117,114,110,32,96,84,
-                       82,85,69,96,32,105,102,32,115,49,32,98,101,103,105,110,115,32,119,105,
-                       116,104,32,115,50,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,
-                       101,114,119,105,115,101,46,0,73,102,32,116,104,101,32,96,115,96,32,109,
-                       97,116,99,104,101,115,32,96,83,96,44,32,100,105,115,99,97,114,100,32,
-                       96,115,96,32,97,110,100,32,114,117,110,32,116,104,101,32,113,117,111,116,
-                       101,32,98,101,102,111,114,101,32,101,120,105,116,105,110,103,32,116,104,101,
-                       32,99,97,108,108,101,114,46,32,73,102,32,116,104,101,121,32,100,111,32,
-                       110,111,116,32,109,97,116,99,104,44,32,100,105,115,99,97,114,100,32,116,
-                       104,101,32,113,117,111,116,101,32,97,110,100,32,108,101,97,118,101,32,96,
-                       115,96,32,111,110,32,116,104,101,32,115,116,97,99,107,46,0,82,101,109,
-                       111,118,101,32,116,104,101,32,108,97,115,116,32,99,104,97,114,97,99,116,
-                       101,114,32,102,114,111,109,32,97,32,115,116,114,105,110,103,46,32,82,101,
-                       116,117,114,110,115,32,97,32,110,101,119,32,115,116,114,105,110,103,46,0,
-                       67,114,101,97,116,101,32,97,32,99,111,110,115,116,97,110,116,32,110,97,
-                       109,101,100,32,115,50,44,32,114,101,116,117,114,110,105,110,103,32,97,32,
-                       112,111,105,110,116,101,114,32,116,111,32,115,49,46,32,84,104,105,115,32,
-                       119,105,108,108,32,117,115,101,32,96,115,58,107,101,101,112,96,32,116,111,
-                       32,112,114,101,115,101,114,118,101,32,116,104,101,32,111,114,105,103,105,110,
-                       97,108,32,115,116,114,105,110,103,46,0,82,101,116,117,114,110,32,96,84,
-                       82,85,69,96,32,105,102,32,116,104,101,32,99,104,97,114,97,99,116,101,
-                       114,32,105,115,32,112,114,101,115,101,110,116,32,105,110,32,116,104,101,32,
-                       115,116,114,105,110,103,32,111,114,32,96,70,65,76,83,69,96,32,111,116,
-                       104,101,114,119,105,115,101,46,0,82,101,116,117,114,110,32,96,84,82,85,
-                       69,96,32,105,102,32,116,104,101,32,115,101,99,111,110,100,32,115,116,114,
-                       105,110,103,32,105,115,32,112,114,101,115,101,110,116,32,105,110,32,116,104,
-                       101,32,102,105,114,115,116,32,115,116,114,105,110,103,32,111,114,32,96,70,
-                       65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,67,111,112,
-                       121,32,97,32,115,116,114,105,110,103,32,40,115,41,32,116,111,32,97,32,
-                       100,101,115,116,105,110,97,116,105,111,110,32,40,97,41,46,32,84,104,105,
-                       115,32,119,105,108,108,32,105,110,99,108,117,100,101,32,116,104,101,32,116,
-                       101,114,109,105,110,97,116,111,114,32,99,104,97,114,97,99,116,101,114,32,
-                       119,104,101,110,32,99,111,112,121,105,110,103,46,0,82,101,116,117,114,110,
-                       32,97,32,100,101,100,117,112,108,105,99,97,116,101,100,32,118,101,114,115,
-                       105,111,110,32,111,102,32,116,104,101,32,115,116,114,105,110,103,46,0,86,
-                       97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,97,32,112,111,105,
-                       110,116,101,114,32,116,111,32,116,104,101,32,100,101,100,117,112,108,105,99,
-                       97,116,105,111,110,32,108,105,115,116,46,0,67,104,101,99,107,32,116,111,
-                       32,115,101,101,32,105,102,32,97,32,115,116,114,105,110,103,32,105,115,32,
-                       105,110,32,116,104,101,32,100,101,100,117,112,108,105,99,97,116,105,111,110,
-                       32,108,105,115,116,46,0,82,101,116,117,114,110,32,97,32,112,111,105,110,
-                       116,101,114,32,116,111,32,97,32,100,101,100,117,112,108,105,99,97,116,101,
-                       100,32,99,111,112,121,32,111,102,32,97,32,115,116,114,105,110,103,46,32,
-                       73,102,32,116,104,101,32,115,116,114,105,110,103,32,105,115,32,110,111,116,
-                       32,105,110,32,116,104,101,32,100,101,100,117,112,108,105,99,97,116,105,111,
-                       110,32,108,105,115,116,44,32,116,104,105,115,32,119,105,108,108,32,99,97,
-                       117,115,101,32,101,114,114,111,114,115,46,0,65,100,100,32,97,32,115,116,
-                       114,105,110,103,32,116,111,32,116,104,101,32,100,101,100,117,112,108,105,99,
-                       97,116,105,111,110,32,108,105,115,116,46,0,82,101,116,117,114,110,32,97,
-                       110,32,101,109,112,116,121,32,115,116,114,105,110,103,46,0,82,101,116,117,
-                       114,110,32,96,84,82,85,69,96,32,105,102,32,115,49,32,101,110,100,115,
-                       32,119,105,116,104,32,115,50,32,111,114,32,96,70,65,76,83,69,96,32,
-                       111,116,104,101,114,119,105,115,101,46,0,67,111,109,112,97,114,101,32,116,
-                       119,111,32,115,116,114,105,110,103,115,32,102,111,114,32,101,113,117,97,108,
-                       105,116,121,46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,
-                       102,32,105,100,101,110,116,105,99,97,108,32,111,114,32,96,70,65,76,83,
-                       69,96,32,105,102,32,110,111,116,46,0,69,118,97,108,117,97,116,101,32,
-                       115,116,114,105,110,103,32,97,115,32,105,102,32,105,116,32,119,97,115,32,
-                       116,121,112,101,100,32,105,110,116,111,32,116,104,101,32,105,110,116,101,114,
-                       112,114,101,116,101,114,46,0,70,101,116,99,104,32,116,104,101,32,99,104,
-                       97,114,97,99,116,101,114,32,118,97,108,117,101,32,115,116,111,114,101,100,
-                       32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,105,110,
-                       100,101,120,32,105,110,32,116,104,101,32,115,116,114,105,110,103,46,0,69,
-                       120,101,99,117,116,101,32,116,104,101,32,113,117,111,116,101,32,111,110,99,
-                       101,32,102,111,114,32,101,97,99,104,32,118,97,108,117,101,32,105,110,32,
-                       116,104,101,32,115,116,114,105,110,103,46,32,73,102,32,116,104,101,32,113,
-                       117,111,116,101,32,114,101,116,117,114,110,115,32,96,84,82,85,69,96,44,
-                       32,97,112,112,101,110,100,32,116,104,101,32,118,97,108,117,101,32,105,110,
-                       116,111,32,97,32,110,101,119,32,115,116,114,105,110,103,46,32,73,102,32,
-                       96,70,65,76,83,69,96,32,116,104,101,32,118,97,108,117,101,32,119,105,
-                       108,108,32,98,101,32,100,105,115,99,97,114,100,101,100,46,0,69,120,101,
-                       99,117,116,101,32,116,104,101,32,113,117,111,116,101,32,111,110,99,101,32,
-                       102,111,114,32,101,97,99,104,32,118,97,108,117,101,32,105,110,32,116,104,
-                       101,32,115,116,114,105,110,103,46,0,67,111,110,115,116,114,117,99,116,32,
-                       97,32,110,101,119,32,115,116,114,105,110,103,32,117,115,105,110,103,32,116,
-                       104,101,32,116,101,109,112,108,97,116,101,32,112,97,115,115,101,100,32,97,
-                       110,100,32,105,116,101,109,115,32,102,114,111,109,32,116,104,101,32,115,116,
-                       97,99,107,46,0,82,101,97,100,32,105,110,112,117,116,32,102,114,111,109,
-                       32,115,116,97,110,100,97,114,100,32,105,110,32,40,118,105,97,32,96,99,
-                       58,103,101,116,96,41,32,117,110,116,105,108,32,97,32,119,104,105,116,101,
-                       115,112,97,99,101,32,105,115,32,101,110,99,111,117,110,116,101,114,101,100,
-                       46,32,82,101,116,117,114,110,115,32,97,32,115,116,114,105,110,103,46,0,
-                       67,97,108,99,117,108,97,116,101,32,97,32,104,97,115,104,32,118,97,108,
-                       117,101,32,102,111,114,32,97,32,115,116,114,105,110,103,46,32,84,104,105,
-                       115,32,117,115,101,115,32,116,104,101,32,100,106,98,50,32,97,108,103,111,
-                       114,105,116,104,109,46,0,82,101,116,117,114,110,32,116,104,101,32,108,111,
-                       99,97,116,105,111,110,32,111,102,32,116,104,101,32,102,105,114,115,116,32,
-                       105,110,115,116,97,110,99,101,32,111,102,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,99,104,97,114,97,99,116,101,114,32,105,110,32,116,
-                       104,101,32,115,116,114,105,110,103,46,0,82,101,116,117,114,110,32,116,104,
-                       101,32,108,111,99,97,116,105,111,110,32,111,102,32,116,104,101,32,102,105,
-                       114,115,116,32,105,110,115,116,97,110,99,101,32,111,102,32,116,104,101,32,
-                       115,112,101,99,105,102,105,101,100,32,115,117,98,115,116,114,105,110,103,32,
-                       40,115,50,41,32,105,110,32,116,104,101,32,115,116,114,105,110,103,32,40,
-                       115,49,41,46,32,82,101,116,117,114,110,115,32,45,49,32,105,102,32,110,
-                       111,116,32,102,111,117,110,100,46,0,83,116,111,114,101,32,97,32,115,116,
-                       114,105,110,103,32,105,110,116,111,32,116,104,101,32,104,101,97,112,32,97,
-                       110,100,32,114,101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,
-                       116,111,32,116,104,101,32,115,116,97,114,116,32,111,102,32,105,116,46,0,
-                       82,101,116,117,114,110,32,97,32,110,101,119,32,115,116,114,105,110,103,32,
-                       99,111,110,116,97,105,110,105,110,103,32,116,104,101,32,102,105,114,115,116,
-                       32,96,110,96,32,99,104,97,114,97,99,116,101,114,115,32,102,114,111,109,
-                       32,116,104,101,32,115,111,117,114,99,101,32,115,116,114,105,110,103,46,0,
-                       82,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,
-                       32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,97,32,115,116,114,
-                       105,110,103,44,32,101,120,99,108,117,100,105,110,103,32,116,104,101,32,78,
-                       85,76,76,32,116,101,114,109,105,110,97,116,111,114,46,0,69,120,101,99,
-                       117,116,101,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,
-                       111,116,101,32,111,110,99,101,32,102,111,114,32,101,97,99,104,32,99,104,
-                       97,114,97,99,116,101,114,32,105,110,32,116,104,101,32,115,116,114,105,110,
-                       103,46,32,66,117,105,108,100,115,32,97,32,110,101,119,32,115,116,114,105,
-                       110,103,32,102,114,111,109,32,116,104,101,32,114,101,116,117,114,110,32,118,
-                       97,108,117,101,32,111,102,32,116,104,101,32,113,117,111,116,101,46,32,84,
-                       104,101,32,113,117,111,116,101,32,115,104,111,117,108,100,32,114,101,116,117,
-                       114,110,32,111,110,108,121,32,111,110,101,32,118,97,108,117,101,46,0,82,
-                       101,116,117,114,110,32,97,32,110,101,119,32,115,116,114,105,110,103,32,99,
-                       111,110,115,105,115,116,105,110,103,32,111,102,32,115,50,32,102,111,108,108,
-                       111,119,101,100,32,98,121,32,115,49,46,0,68,105,115,112,108,97,121,32,
-                       97,32,115,116,114,105,110,103,46,0,82,101,112,108,97,99,101,32,116,104,
-                       101,32,102,105,114,115,116,32,105,110,115,116,97,110,99,101,32,111,102,32,
-                       115,50,32,105,110,32,115,49,32,119,105,116,104,32,115,51,46,0,82,101,
-                       112,108,97,99,101,32,97,108,108,32,105,110,115,116,97,110,99,101,115,32,
-                       111,102,32,115,50,32,105,110,32,115,49,32,119,105,116,104,32,115,51,46,
-                       0,82,101,118,101,114,115,101,32,116,104,101,32,111,114,100,101,114,32,111,
-                       102,32,65,83,67,73,73,32,99,104,97,114,97,99,116,101,114,115,32,105,
-                       110,32,97,32,115,116,114,105,110,103,46,0,82,101,116,117,114,110,32,97,
-                       32,110,101,119,32,115,116,114,105,110,103,32,99,111,110,116,97,105,110,105,
-                       110,103,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,110,117,109,
-                       98,101,114,32,111,102,32,99,104,97,114,97,99,116,101,114,115,32,102,114,
-                       111,109,32,116,104,101,32,114,105,103,104,116,32,115,105,100,101,32,111,102,
-                       32,116,104,101,32,115,116,114,105,110,103,46,0,73,110,116,101,114,110,97,
-                       108,32,104,101,108,112,101,114,32,102,117,110,99,116,105,111,110,32,117,115,
-                       101,100,32,116,111,32,115,107,105,112,32,111,118,101,114,32,97,32,115,116,
-                       114,105,110,103,32,105,110,32,97,32,100,101,102,105,110,105,116,105,111,110,
-                       46,0,83,112,108,105,116,32,97,32,115,116,114,105,110,103,32,111,110,32,
-                       116,104,101,32,102,105,114,115,116,32,111,99,99,117,114,114,101,110,99,101,
-                       32,111,102,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,99,104,
-                       97,114,97,99,116,101,114,46,0,83,112,108,105,116,32,97,32,115,116,114,
-                       105,110,103,32,111,110,32,116,104,101,32,102,105,114,115,116,32,111,99,99,
-                       117,114,114,101,110,99,101,32,111,102,32,116,104,101,32,115,112,101,99,105,
-                       102,105,101,100,32,115,116,114,105,110,103,46,32,65,102,116,101,114,32,116,
-                       104,101,32,115,112,108,105,116,44,32,116,104,101,32,116,111,112,32,115,116,
-                       97,99,107,32,105,116,101,109,32,119,105,108,108,32,98,101,32,116,104,101,
-                       32,112,97,114,116,32,111,102,32,116,104,101,32,115,116,114,105,110,103,32,
-                       98,101,102,111,114,101,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
-                       32,115,117,98,115,116,114,105,110,103,44,32,97,110,100,32,116,104,101,32,
-                       115,101,99,111,110,100,32,105,116,101,109,32,119,105,108,108,32,98,101,32,
-                       116,104,101,32,114,101,115,116,32,111,102,32,116,104,101,32,111,114,105,103,
-                       105,110,97,108,32,115,116,114,105,110,103,46,0,83,116,111,114,101,32,97,
-                       32,99,104,97,114,97,99,116,101,114,32,118,97,108,117,101,32,105,110,116,
-                       111,32,116,104,101,32,115,116,114,105,110,103,32,97,116,32,116,104,101,32,
-                       115,112,101,99,105,102,105,101,100,32,105,110,100,101,120,46,0,69,120,116,
-                       114,97,99,116,32,97,32,115,117,98,115,116,114,105,110,103,32,102,114,111,
-                       109,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,115,116,114,105,
-                       110,103,46,32,84,104,105,115,32,119,105,108,108,32,116,97,107,101,32,116,
-                       104,101,32,99,104,97,114,97,99,116,101,114,115,32,115,116,97,114,116,105,
-                       110,103,32,97,116,32,96,102,96,32,97,110,100,32,101,120,116,101,110,100,
-                       32,96,108,96,32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,108,
-                       101,110,103,116,104,46,0,77,111,118,101,32,97,32,115,116,114,105,110,103,
-                       32,105,110,116,111,32,116,104,101,32,116,101,109,112,111,114,97,114,121,32,
-                       115,116,114,105,110,103,32,98,117,102,102,101,114,115,46,0,67,111,110,118,
-                       101,114,116,32,97,32,115,116,114,105,110,103,32,114,101,112,114,101,115,101,
-                       110,116,97,116,105,111,110,32,105,110,116,111,32,97,32,102,108,111,97,116,
-                       105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,67,111,110,
-                       118,101,114,116,32,117,112,112,101,114,99,97,115,101,32,65,83,67,73,73,
-                       32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,97,32,115,116,114,
-                       105,110,103,32,116,111,32,108,111,119,101,114,99,97,115,101,46,0,67,111,
-                       110,118,101,114,116,32,97,32,115,116,114,105,110,103,32,116,111,32,97,32,
-                       110,117,109,98,101,114,46,0,67,111,110,118,101,114,116,32,108,111,119,101,
-                       114,99,97,115,101,32,65,83,67,73,73,32,99,104,97,114,97,99,116,101,
-                       114,115,32,105,110,32,97,32,115,116,114,105,110,103,32,116,111,32,117,112,
-                       112,101,114,99,97,115,101,46,0,84,97,107,101,115,32,97,32,115,116,114,
-                       105,110,103,32,97,110,100,32,97,32,99,104,97,114,97,99,116,101,114,32,
-                       116,111,32,117,115,101,32,97,115,32,97,32,115,101,112,97,114,97,116,111,
-                       114,46,32,73,116,32,115,112,108,105,116,115,32,116,104,101,32,115,116,114,
-                       105,110,103,32,105,110,116,111,32,115,117,98,115,116,114,105,110,103,115,32,
-                       97,110,100,32,114,101,116,117,114,110,115,32,97,110,32,97,114,114,97,121,
-                       32,99,111,110,116,97,105,110,105,110,103,32,112,111,105,110,116,101,114,115,
-                       32,116,111,32,101,97,99,104,32,111,102,32,116,104,101,109,46,0,84,97,
-                       107,101,115,32,97,32,115,116,114,105,110,103,32,40,115,49,41,32,97,110,
-                       100,32,97,32,115,117,98,115,116,114,105,110,103,32,40,115,50,41,32,32,
-                       117,115,101,32,97,115,32,97,32,115,101,112,97,114,97,116,111,114,46,32,
-                       73,116,32,115,112,108,105,116,115,32,116,104,101,32,115,116,114,105,110,103,
-                       32,105,110,116,111,32,115,117,98,115,116,114,105,110,103,115,32,97,110,100,
-                       32,114,101,116,117,114,110,115,32,97,115,32,97,114,114,97,121,32,99,111,
-                       110,116,97,105,110,105,110,103,32,112,111,105,110,116,101,114,115,32,116,111,
-                       32,101,97,99,104,32,111,102,32,116,104,101,109,46,0,84,114,105,109,32,
-                       108,101,97,100,105,110,103,32,97,110,100,32,116,114,97,105,108,105,110,103,
-                       32,119,104,105,116,101,115,112,97,99,101,32,102,114,111,109,32,97,32,115,
-                       116,114,105,110,103,46,0,84,114,105,109,32,108,101,97,100,105,110,103,32,
-                       119,104,105,116,101,115,112,97,99,101,32,102,114,111,109,32,97,32,115,116,
-                       114,105,110,103,46,0,84,114,105,109,32,116,114,97,105,108,105,110,103,32,
-                       119,104,105,116,101,115,112,97,99,101,32,102,114,111,109,32,97,32,115,116,
-                       114,105,110,103,46,0,65,108,105,97,115,32,102,111,114,32,96,115,58,100,
-                       101,100,117,112,46,100,101,102,105,110,101,100,63,96,46,0,68,105,115,99,
-                       97,114,100,32,114,101,109,97,105,110,105,110,103,32,116,111,107,101,110,115,
-                       32,111,110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,105,110,101,
-                       32,98,101,105,110,103,32,101,118,97,108,117,97,116,101,100,46,32,84,104,
-                       105,115,32,111,110,108,121,32,119,111,114,107,115,32,119,104,101,110,32,105,
-                       110,99,108,117,100,105,110,103,32,97,32,102,105,108,101,44,32,110,111,116,
-                       32,97,116,32,116,104,101,32,105,110,116,101,114,112,114,101,116,101,114,46,
-                       0,82,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,
-                       102,32,97,114,103,117,109,101,110,116,115,32,112,97,115,115,101,100,32,116,
-                       111,32,116,104,101,32,112,114,111,103,114,97,109,46,0,82,101,116,117,114,
-                       110,32,116,104,101,32,102,105,108,101,110,97,109,101,32,111,102,32,116,104,
-                       101,32,102,105,108,101,32,98,101,105,110,103,32,112,114,111,99,101,115,115,
-                       101,100,32,98,121,32,116,104,101,32,99,117,114,114,101,110,116,32,96,105,
-                       110,99,108,117,100,101,96,44,32,111,114,32,96,47,100,101,118,47,115,116,
-                       100,105,110,96,32,105,102,32,116,104,101,32,105,110,112,117,116,32,115,111,
-                       117,114,99,101,32,105,115,32,116,104,101,32,116,101,114,109,105,110,97,108,
-                       46,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,
-                       32,108,105,110,101,32,110,117,109,98,101,114,32,111,102,32,116,104,101,32,
-                       102,105,108,101,32,98,101,105,110,103,32,112,114,111,99,101,115,115,101,100,
-                       32,98,121,32,116,104,101,32,99,117,114,114,101,110,116,32,96,105,110,99,
-                       108,117,100,101,96,44,32,111,114,32,96,48,96,32,105,102,32,116,104,101,
-                       32,105,110,112,117,116,32,115,111,117,114,99,101,32,105,115,32,116,104,101,
-                       32,116,101,114,109,105,110,97,108,46,32,76,105,110,101,32,110,117,109,98,
-                       101,114,105,110,103,32,115,116,97,114,116,115,32,97,116,32,49,46,0,82,
-                       101,116,117,114,110,32,116,104,101,32,116,101,120,116,32,111,102,32,116,104,
-                       101,32,99,117,114,114,101,110,116,32,108,105,110,101,32,98,101,105,110,103,
-                       32,112,114,111,99,101,115,115,101,100,32,98,121,32,116,104,101,32,99,117,
-                       114,114,101,110,116,32,96,105,110,99,108,117,100,101,96,46,0,71,105,118,
-                       101,110,32,97,110,32,97,114,103,117,109,101,110,116,32,110,117,109,98,101,
-                       114,44,32,114,101,116,117,114,110,32,116,104,101,32,97,114,103,117,109,101,
-                       110,116,32,97,115,32,97,32,115,116,114,105,110,103,46,0,68,105,115,99,
-                       97,114,100,32,114,101,109,97,105,110,105,110,103,32,116,111,107,101,110,115,
-                       32,105,110,32,116,104,101,32,99,117,114,114,101,110,116,32,108,105,110,101,
-                       46,32,84,104,105,115,32,111,110,108,121,32,119,111,114,107,115,32,119,104,
-                       101,110,32,105,110,99,108,117,100,105,110,103,32,97,32,102,105,108,101,44,
-                       32,110,111,116,32,97,116,32,116,104,101,32,105,110,116,101,114,112,114,101,
-                       116,101,114,46,0,82,101,116,117,114,110,32,116,104,101,32,102,105,108,101,
-                       110,97,109,101,32,111,102,32,116,104,101,32,112,114,111,103,114,97,109,32,
-                       98,101,105,110,103,32,114,117,110,46,0,80,97,116,99,104,32,116,104,101,
-                       32,104,111,111,107,32,112,111,105,110,116,32,105,110,32,97,50,32,116,111,
-                       32,112,111,105,110,116,32,116,111,32,97,49,46,0,80,101,102,111,114,109,
-                       32,97,32,98,105,116,119,105,115,101,32,115,104,105,102,116,32,111,102,32,
-                       109,32,98,121,32,110,32,98,105,116,115,46,32,73,102,32,110,32,105,115,
-                       32,112,111,115,105,116,105,118,101,44,32,115,104,105,102,116,32,114,105,103,
-                       104,116,46,32,73,102,32,110,101,103,97,116,105,118,101,44,32,116,104,101,
-                       32,115,104,105,102,116,32,119,105,108,108,32,98,101,32,116,111,32,116,104,
-                       101,32,108,101,102,116,46,0,83,104,105,102,116,32,109,32,108,101,102,116,
-                       32,98,121,32,110,32,98,105,116,115,46,0,83,104,105,102,116,32,109,32,
-                       114,105,103,104,116,32,98,121,32,110,32,98,105,116,115,46,0,83,116,111,
-                       114,101,32,97,32,118,97,108,117,101,32,105,110,116,111,32,97,32,118,97,
-                       114,105,97,98,108,101,46,0,80,114,111,99,101,115,115,32,116,111,107,101,
-                       110,32,97,115,32,97,32,110,117,109,98,101,114,46,0,80,114,111,99,101,
-                       115,115,32,116,111,107,101,110,32,97,115,32,97,110,32,65,83,67,73,73,
-                       32,99,104,97,114,97,99,116,101,114,46,0,82,101,116,117,114,110,32,97,
-                       32,112,111,105,110,116,101,114,32,116,111,32,97,32,110,97,109,101,100,32,
-                       105,116,101,109,46,32,73,102,32,110,97,109,101,32,105,115,32,110,111,116,
-                       32,102,111,117,110,100,44,32,114,101,116,117,114,110,115,32,48,46,0,80,
-                       114,111,99,101,115,115,32,116,111,107,101,110,32,97,115,32,97,32,115,116,
-                       114,105,110,103,46,0,80,114,111,99,101,115,115,32,116,111,107,101,110,32,
-                       97,115,32,97,32,99,111,109,109,101,110,116,46,0,73,110,116,101,114,112,
-                       114,101,116,32,116,105,109,101,58,32,99,111,110,118,101,114,116,32,115,116,
-                       114,105,110,103,32,116,111,32,97,32,102,108,111,97,116,105,110,103,45,112,
-                       111,105,110,116,32,118,97,108,117,101,46,32,67,111,109,112,105,108,101,32,
-                       116,105,109,101,58,32,99,111,110,118,101,114,116,32,115,116,114,105,110,103,
-                       32,116,111,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
-                       32,118,97,108,117,101,32,97,110,100,32,99,111,109,112,105,108,101,32,99,
-                       111,100,101,32,116,111,32,112,117,115,104,32,116,104,105,115,32,118,97,108,
-                       117,101,32,116,111,32,116,104,101,32,102,108,111,97,116,32,115,116,97,99,
-                       107,46,0,72,111,111,107,46,32,80,114,111,99,101,115,115,32,116,111,107,
-                       101,110,32,97,115,32,97,32,110,101,119,32,100,101,102,105,110,105,116,105,
-                       111,110,46,0,70,101,116,99,104,32,102,114,111,109,32,97,32,115,116,111,
-                       114,101,100,32,118,97,114,105,97,98,108,101,46,0,80,114,111,99,101,115,
-                       115,32,116,111,107,101,110,32,97,115,32,97,110,32,105,110,115,116,114,117,
-                       99,116,105,111,110,32,98,117,110,100,108,101,46,0,80,114,111,99,101,115,
-                       115,32,116,111,107,101,110,32,97,115,32,97,32,102,117,110,99,116,105,111,
-                       110,32,114,101,102,101,114,101,110,99,101,46,0,80,114,111,99,101,115,115,
-                       32,116,111,107,101,110,32,97,115,32,97,32,98,121,116,101,99,111,100,101,
-                       46,0,80,79,83,84,80,79,78,69,32,101,113,117,105,118,97,108,101,110,
-                       116,46,0,82,117,110,32,113,117,111,116,101,46,32,65,102,116,101,114,32,
-                       101,120,101,99,117,116,105,111,110,32,99,111,109,112,108,101,116,101,115,44,
-                       32,112,117,116,32,97,32,99,111,112,121,32,111,102,32,110,32,98,97,99,
-                       107,32,111,110,32,116,111,112,32,111,102,32,116,104,101,32,115,116,97,99,
-                       107,46,0,66,101,103,105,110,32,97,99,99,101,112,116,105,110,103,32,99,
-                       111,110,110,101,99,116,105,111,110,115,46,32,82,101,116,117,114,110,115,32,
-                       97,32,110,101,119,32,115,111,99,107,101,116,32,97,110,100,32,97,110,32,
-                       101,114,114,111,114,32,99,111,100,101,46,0,66,105,110,100,32,97,32,115,
-                       111,99,107,101,116,32,116,111,32,97,32,112,111,114,116,46,32,84,104,101,
-                       32,112,111,114,116,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,
-                       114,105,110,103,46,32,82,101,116,117,114,110,115,32,48,32,105,102,32,115,
-                       117,99,99,101,115,115,102,117,108,32,111,114,32,45,49,32,111,116,104,101,
-                       114,119,105,115,101,32,97,110,100,32,97,110,32,101,114,114,111,114,32,99,
-                       111,100,101,46,0,67,108,111,115,101,32,97,32,115,111,99,107,101,116,46,
-                       0,67,111,110,102,105,103,117,114,101,32,105,110,116,101,114,110,97,108,32,
-                       115,101,116,116,105,110,103,115,32,102,111,114,32,97,32,104,111,115,116,32,
-                       40,115,49,41,32,97,110,100,32,112,111,114,116,32,40,115,50,41,46,32,
-                       85,115,101,32,98,101,102,111,114,101,32,96,115,111,99,107,101,116,58,98,
-                       105,110,100,96,46,0,67,111,110,110,101,99,116,32,116,111,32,97,32,115,
-                       101,114,118,101,114,46,32,80,114,111,118,105,100,101,32,97,32,115,111,99,
-                       107,101,116,44,32,116,104,105,115,32,119,105,108,108,32,114,101,116,117,114,
-                       110,32,97,32,115,116,97,116,117,115,32,102,108,97,103,32,97,110,100,32,
-                       97,110,32,101,114,114,111,114,32,99,111,100,101,46,0,79,98,116,97,105,
-                       110,32,97,32,110,101,119,32,115,111,99,107,101,116,46,0,71,101,116,32,
-                       116,104,101,32,104,111,115,116,32,73,80,32,105,110,32,100,111,116,116,101,
-                       100,32,110,111,116,97,116,105,111,110,46,32,84,104,101,32,104,111,115,116,
-                       32,105,115,32,115,112,101,99,105,102,105,101,100,32,98,121,32,116,104,101,
-                       32,115,116,114,105,110,103,32,97,110,100,32,116,104,101,32,97,100,100,114,
-                       101,115,115,32,105,115,32,116,104,101,32,115,116,97,114,116,32,111,102,32,
-                       116,104,101,32,98,117,102,102,101,114,32,102,111,114,32,116,104,101,32,100,
-                       111,116,116,101,100,32,73,80,46,0,80,114,101,112,97,114,101,32,97,32,
-                       115,111,99,107,101,116,32,102,111,114,32,97,99,99,101,112,116,105,110,103,
-                       32,105,110,99,111,109,105,110,103,32,99,111,110,110,101,99,116,105,111,110,
-                       115,46,32,84,97,107,101,115,32,97,32,98,97,99,107,108,111,103,32,99,
-                       111,117,110,116,32,40,110,49,41,32,97,110,100,32,97,32,115,111,99,107,
-                       101,116,32,40,110,50,41,46,32,82,101,116,117,114,110,115,32,97,32,102,
-                       108,97,103,32,40,48,32,115,117,99,99,101,115,115,44,32,45,49,32,102,
-                       97,105,108,101,100,41,32,97,110,100,32,97,110,32,101,114,114,111,114,32,
-                       99,111,100,101,46,0,84,114,105,103,103,101,114,32,97,32,115,111,99,107,
-                       101,116,32,111,112,101,114,97,116,105,111,110,46,32,84,104,105,115,32,105,
-                       115,32,110,111,116,32,105,110,116,101,110,100,101,100,32,116,111,32,98,101,
-                       32,117,115,101,100,32,100,105,114,101,99,116,108,121,46,0,82,101,99,101,
-                       105,118,101,32,100,97,116,97,32,102,114,111,109,32,97,32,115,111,99,107,
-                       101,116,46,32,84,104,105,115,32,119,105,108,108,32,114,101,97,100,32,105,
-                       110,116,111,32,109,101,109,111,114,121,32,115,116,97,114,116,105,110,103,32,
-                       97,116,32,97,100,100,114,101,115,115,32,42,97,42,44,32,117,112,32,116,
-                       111,32,42,110,49,42,32,98,121,116,101,115,46,32,42,110,50,42,32,105,
-                       115,32,116,104,101,32,115,111,99,107,101,116,46,32,82,101,116,117,114,110,
-                       115,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,98,121,116,101,
-                       115,32,114,101,97,100,32,97,110,100,32,97,110,32,101,114,114,111,114,32,
-                       99,111,100,101,46,0,83,101,110,100,32,97,32,115,116,114,105,110,103,32,
-                       116,111,32,97,32,115,111,99,107,101,116,46,32,84,104,105,115,32,119,105,
-                       108,108,32,114,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,
-                       32,111,102,32,99,104,97,114,97,99,116,101,114,115,32,115,101,110,116,32,
-                       97,110,100,32,97,110,32,101,114,114,111,114,32,99,111,100,101,46,0,68,
-                       105,115,112,108,97,121,32,97,32,115,112,97,99,101,32,40,96,65,83,67,
-                       73,73,58,83,80,65,67,69,96,41,0,83,116,111,114,101,32,97,32,118,
-                       97,108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,99,105,102,
-                       105,101,100,32,97,100,100,114,101,115,115,46,0,83,116,111,114,101,32,97,
-                       32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,97,100,100,114,101,115,115,32,97,110,100,32,114,101,
-                       116,117,114,110,32,116,104,101,32,110,101,120,116,32,97,100,100,114,101,115,
-                       115,46,0,69,120,99,104,97,110,103,101,32,116,104,101,32,112,111,115,105,
-                       116,105,111,110,32,111,102,32,116,104,101,32,116,111,112,32,116,119,111,32,
-                       105,116,101,109,115,32,111,110,32,116,104,101,32,115,116,97,99,107,0,68,
-                       105,115,112,108,97,121,32,97,32,116,97,98,32,40,96,65,83,67,73,73,
-                       58,72,84,96,41,0,67,111,110,118,101,114,116,32,97,32,99,97,108,108,
-                       32,98,101,102,111,114,101,32,116,104,101,32,115,101,109,105,99,111,108,111,
-                       110,32,116,111,32,97,32,106,117,109,112,46,0,82,117,110,32,116,104,101,
-                       32,115,112,101,99,105,102,105,101,100,32,113,117,111,116,101,32,116,104,101,
-                       32,115,112,101,99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,
-                       32,116,105,109,101,115,46,0,65,112,112,108,121,32,113,49,32,97,103,97,
-                       105,110,115,116,32,120,44,32,116,104,101,110,32,113,50,32,97,103,97,105,
-                       110,115,116,32,97,32,99,111,112,121,32,111,102,32,120,44,32,97,110,100,
-                       32,102,105,110,97,108,108,121,32,113,51,32,97,103,97,105,110,115,116,32,
-                       97,110,111,116,104,101,114,32,99,111,112,121,32,111,102,32,120,46,0,65,
-                       112,112,108,121,32,113,49,32,97,103,97,105,110,115,116,32,120,44,32,113,
-                       50,32,97,103,97,105,110,115,116,32,121,44,32,97,110,100,32,113,51,32,
-                       97,103,97,105,110,115,116,32,122,46,0,65,112,112,108,121,32,113,32,97,
-                       103,97,105,110,115,116,32,120,44,32,116,104,101,110,32,97,103,97,105,110,
-                       115,116,32,121,44,32,97,110,100,32,102,105,110,97,108,108,121,32,97,103,
-                       97,105,110,115,116,32,122,46,0,80,117,116,32,97,32,99,111,112,121,32,
-                       111,102,32,116,104,101,32,116,111,112,32,105,116,101,109,32,111,110,32,116,
-                       104,101,32,115,116,97,99,107,32,117,110,100,101,114,32,116,104,101,32,115,
-                       101,99,111,110,100,32,111,110,101,46,0,82,101,115,101,116,32,116,104,101,
-                       32,104,111,111,107,32,112,111,105,110,116,32,105,110,32,97,49,32,116,111,
-                       32,116,104,101,32,100,101,102,97,117,108,116,32,100,101,102,105,110,105,116,
-                       105,111,110,46,0,67,104,97,110,103,101,32,116,104,101,32,99,117,114,114,
-                       101,110,116,32,119,111,114,107,105,110,103,32,100,105,114,101,99,116,111,114,
-                       121,32,116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,111,
-                       110,101,46,0,82,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,
-                       114,32,111,102,32,102,105,108,101,115,32,40,97,110,100,32,115,117,98,100,
-                       105,114,101,99,116,111,114,105,101,115,41,32,105,110,32,116,104,101,32,99,
-                       117,114,114,101,110,116,32,119,111,114,107,105,110,103,32,100,105,114,101,99,
-                       116,111,114,121,0,69,120,101,99,117,116,101,32,97,32,112,114,111,99,101,
-                       115,115,32,98,121,32,114,117,110,110,105,110,103,32,116,104,101,32,97,112,
-                       112,108,105,99,97,116,105,111,110,32,115,112,101,99,105,102,105,101,100,32,
-                       98,121,32,115,46,0,69,120,101,99,117,116,101,32,97,32,112,114,111,99,
-                       101,115,115,32,98,121,32,114,117,110,110,105,110,103,32,116,104,101,32,97,
-                       112,112,108,105,99,97,116,105,111,110,32,115,112,101,99,105,102,105,101,100,
-                       32,98,121,32,115,49,46,32,80,97,115,115,32,115,50,32,97,115,32,97,
-                       110,32,97,114,103,117,109,101,110,116,46,0,69,120,101,99,117,116,101,32,
-                       97,32,112,114,111,99,101,115,115,32,98,121,32,114,117,110,110,105,110,103,
-                       32,116,104,101,32,97,112,112,108,105,99,97,116,105,111,110,32,115,112,101,
-                       99,105,102,105,101,100,32,98,121,32,115,49,46,32,80,97,115,115,32,115,
-                       50,32,97,110,100,32,115,51,32,97,115,32,97,114,103,117,109,101,110,116,
-                       115,46,0,69,120,101,99,117,116,101,32,97,32,112,114,111,99,101,115,115,
-                       32,98,121,32,114,117,110,110,105,110,103,32,116,104,101,32,97,112,112,108,
-                       105,99,97,116,105,111,110,32,115,112,101,99,105,102,105,101,100,32,98,121,
-                       32,115,49,46,32,80,97,115,115,32,115,50,44,32,115,51,44,32,97,110,
-                       100,32,115,52,32,97,115,32,97,114,103,117,109,101,110,116,115,46,0,82,
-                       117,110,115,32,97,110,111,116,104,101,114,32,97,112,112,108,105,99,97,116,
-                       105,111,110,32,97,110,100,32,114,101,116,117,114,110,32,97,102,116,101,114,
-                       32,101,120,101,99,117,116,105,111,110,32,105,115,32,99,111,109,112,108,101,
-                       116,101,100,46,32,84,104,105,115,32,100,111,101,115,32,110,111,116,32,105,
-                       110,118,111,107,101,32,116,104,101,32,115,104,101,108,108,32,108,105,107,101,
-                       32,96,117,110,105,120,58,115,121,115,116,101,109,96,32,97,110,100,32,100,
-                       111,101,115,32,110,111,116,32,115,117,112,112,111,114,116,32,103,108,111,98,
-                       98,105,110,103,46,0,69,120,105,116,32,116,104,101,32,99,117,114,114,101,
-                       110,116,32,112,114,111,99,101,115,115,44,32,114,101,116,117,114,110,105,110,
-                       103,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,114,101,116,117,
-                       114,110,32,99,111,100,101,46,0,82,117,110,32,97,32,113,117,111,116,101,
-                       32,111,110,99,101,32,102,111,114,32,101,97,99,104,32,102,105,108,101,32,
-                       111,114,32,115,117,98,100,105,114,101,99,116,111,114,121,32,105,110,32,116,
-                       104,101,32,99,117,114,114,101,110,116,32,100,105,114,101,99,116,111,114,121,
-                       46,32,84,104,101,32,113,117,111,116,101,32,119,105,108,108,32,114,101,99,
-                       101,105,118,101,32,116,104,101,32,102,105,108,101,32,110,97,109,101,32,97,
-                       115,32,97,32,115,116,114,105,110,103,32,97,110,100,32,115,104,111,117,108,
-                       100,32,99,111,110,115,117,109,101,32,116,104,105,115,32,97,110,100,32,114,
-                       101,116,117,114,110,32,110,111,116,104,105,110,103,32,111,110,32,116,104,101,
-                       32,115,116,97,99,107,46,0,70,111,114,107,32,116,104,101,32,99,117,114,
-                       114,101,110,116,32,112,114,111,99,101,115,115,46,32,82,101,116,117,114,110,
-                       115,32,97,32,80,73,68,46,0,82,101,116,117,114,110,32,116,104,101,32,
-                       99,117,114,114,101,110,116,32,119,111,114,107,105,110,103,32,100,105,114,101,
-                       99,116,111,114,121,0,71,101,116,32,97,110,32,101,110,118,105,114,111,110,
-                       109,101,110,116,32,118,97,114,105,97,98,108,101,46,32,80,114,111,118,105,
-                       100,101,32,116,104,101,32,110,97,109,101,32,97,110,100,32,97,110,32,97,
-                       100,100,114,101,115,115,32,116,111,32,115,116,111,114,101,32,105,116,32,105,
-                       110,46,0,82,101,116,117,114,110,32,116,104,101,32,80,73,68,32,111,102,
-                       32,116,104,101,32,99,117,114,114,101,110,116,32,112,114,111,99,101,115,115,
-                       46,0,84,101,114,109,105,110,97,116,101,115,32,97,32,112,114,111,99,101,
-                       115,115,46,32,84,97,107,101,115,32,97,32,112,114,111,99,101,115,115,32,
-                       97,110,100,32,97,32,115,105,103,110,97,108,32,116,111,32,115,101,110,100,
-                       46,0,67,108,111,115,101,32,97,32,112,105,112,101,46,0,84,97,107,101,
-                       115,32,97,32,115,116,114,105,110,103,32,119,105,116,104,32,97,32,85,110,
-                       105,120,32,99,111,109,109,97,110,100,32,108,105,110,101,32,97,110,100,32,
-                       114,117,110,32,105,116,32,105,110,32,97,32,112,105,112,101,44,32,114,101,
-                       116,117,114,110,105,110,103,32,97,32,110,101,119,32,115,116,114,105,110,103,
-                       32,119,105,116,104,32,116,104,101,32,102,105,114,115,116,32,108,105,110,101,
-                       32,111,102,32,116,104,101,32,111,117,116,112,117,116,32,102,114,111,109,32,
-                       116,104,101,32,112,105,112,101,46,0,79,112,101,110,32,97,32,112,105,112,
-                       101,46,32,84,97,107,101,115,32,97,32,99,111,109,109,97,110,100,32,116,
-                       111,32,114,117,110,44,32,97,110,100,32,97,32,102,105,108,101,32,109,111,
-                       100,101,32,40,96,102,105,108,101,58,82,96,32,111,114,32,96,102,105,108,
-                       101,58,87,96,59,32,96,102,105,108,101,58,82,43,96,32,109,97,121,32,
-                       119,111,114,107,32,111,110,32,115,111,109,101,32,115,121,115,116,101,109,115,
-                       41,46,32,82,101,116,117,114,110,115,32,97,32,102,105,108,101,32,73,68,
-                       32,117,115,97,98,108,101,32,119,105,116,104,32,119,111,114,100,115,32,105,
-                       110,32,116,104,101,32,96,102,105,108,101,58,96,32,110,97,109,101,115,112,
-                       97,99,101,46,0,84,97,107,101,115,32,97,32,115,116,114,105,110,103,32,
-                       105,110,32,116,104,101,32,102,111,114,109,32,96,110,97,109,101,61,118,97,
-                       108,117,101,96,32,97,110,100,32,115,101,116,115,32,97,110,32,101,110,118,
-                       105,114,111,110,109,101,110,116,32,118,97,114,105,97,98,108,101,32,110,97,
-                       109,101,100,32,96,110,97,109,101,96,32,116,111,32,96,118,97,108,117,101,
-                       96,46,0,83,108,101,101,112,32,102,111,114,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,32,115,101,99,
-                       111,110,100,115,46,0,79,112,101,110,32,97,32,112,105,112,101,46,32,82,
-                       101,97,100,32,97,108,108,32,111,117,116,112,117,116,32,102,114,111,109,32,
-                       116,104,101,32,112,105,112,101,32,40,117,110,116,105,108,32,65,83,67,73,
-                       73,58,78,85,76,76,41,32,97,110,100,32,115,116,111,114,101,32,105,110,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,98,117,102,102,101,
-                       114,46,32,82,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,
-                       32,111,102,32,98,121,116,101,115,32,114,101,97,100,46,0,82,117,110,115,
-                       32,97,110,111,116,104,101,114,32,97,112,112,108,105,99,97,116,105,111,110,
-                       32,117,115,105,110,103,32,116,104,101,32,115,121,115,116,101,109,32,115,104,
-                       101,108,108,32,97,110,100,32,114,101,116,117,114,110,115,32,97,102,116,101,
-                       114,32,101,120,101,99,117,116,105,111,110,32,105,115,32,99,111,109,112,108,
-                       101,116,101,100,46,0,87,97,105,116,115,32,102,111,114,32,97,32,99,104,
-                       105,108,100,32,112,114,111,99,101,115,115,32,116,111,32,99,111,109,112,108,
-                       101,116,101,46,32,84,104,105,115,32,109,97,112,115,32,116,111,32,116,104,
-                       101,32,119,97,105,116,40,41,32,115,121,115,116,101,109,32,99,97,108,108,
-                       46,0,85,110,112,97,99,107,32,97,32,51,50,45,98,105,116,32,118,97,
-                       108,117,101,32,105,110,116,111,32,102,111,117,114,32,56,45,98,105,116,32,
-                       118,97,108,117,101,115,46,0,77,117,108,116,105,112,108,121,32,96,110,49,
-                       96,32,98,121,32,96,110,50,96,32,97,110,100,32,114,101,116,117,114,110,
-                       32,116,104,101,32,114,101,115,117,108,116,46,0,77,117,108,116,105,112,108,
-                       121,32,96,120,96,32,98,121,32,96,121,96,32,97,110,100,32,116,104,101,
-                       110,32,100,105,118,105,100,101,32,98,121,32,96,122,96,32,97,110,100,32,
-                       114,101,116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,112,
-                       97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,105,101,110,116,32,
-                       97,110,100,32,114,101,109,97,105,110,100,101,114,46,0,65,100,100,32,96,
-                       110,49,96,32,116,111,32,96,110,50,96,32,97,110,100,32,114,101,116,117,
-                       114,110,32,116,104,101,32,114,101,115,117,108,116,46,0,83,117,98,116,114,
-                       97,99,116,32,96,110,50,96,32,102,114,111,109,32,96,110,49,96,32,97,
-                       110,100,32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,108,116,
-                       46,0,67,111,109,112,97,114,101,32,116,119,111,32,118,97,108,117,101,115,
-                       32,102,111,114,32,105,110,101,113,117,97,108,105,116,121,46,32,82,101,116,
-                       117,114,110,115,32,96,84,82,85,69,96,32,105,102,32,116,104,101,121,32,
-                       97,114,101,32,110,111,116,32,101,113,117,97,108,32,111,114,32,96,70,65,
-                       76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,68,105,118,105,
-                       100,101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,32,114,101,
-                       116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,112,97,114,
-                       116,32,111,102,32,116,104,101,32,113,117,111,116,105,101,110,116,32,97,110,
-                       100,32,114,101,109,97,105,110,100,101,114,46,0,67,111,109,112,97,114,101,
-                       32,116,119,111,32,118,97,108,117,101,115,32,102,111,114,32,101,113,117,97,
-                       108,105,116,121,46,32,82,101,116,117,114,110,115,32,96,84,82,85,69,96,
-                       32,105,102,32,116,104,101,121,32,97,114,101,32,101,113,117,97,108,32,111,
-                       114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,
-                       0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,32,110,50,46,32,
-                       82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,49,32,
-                       105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,110,50,44,32,
-                       111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,
-                       46,0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,32,110,50,46,
-                       32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,49,
-                       32,105,115,32,108,101,115,115,32,116,104,97,110,32,110,50,44,32,111,114,
-                       32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,
-                       80,101,102,111,114,109,32,97,32,98,105,116,119,105,115,101,32,115,104,105,
-                       102,116,32,111,102,32,109,32,98,121,32,110,32,98,105,116,115,46,32,73,
-                       102,32,110,32,105,115,32,112,111,115,105,116,105,118,101,44,32,115,104,105,
-                       102,116,32,114,105,103,104,116,46,32,73,102,32,110,101,103,97,116,105,118,
-                       101,44,32,116,104,101,32,115,104,105,102,116,32,119,105,108,108,32,98,101,
-                       32,116,111,32,116,104,101,32,108,101,102,116,46,0,69,120,101,99,117,116,
-                       101,32,113,117,111,116,101,32,114,101,112,101,97,116,101,100,108,121,32,119,
-                       104,105,108,101,32,116,104,101,32,113,117,111,116,101,32,114,101,116,117,114,
-                       110,115,32,97,32,118,97,108,117,101,32,111,102,32,96,70,65,76,83,69,
-                       96,46,32,84,104,101,32,113,117,111,116,101,32,115,104,111,117,108,100,32,
-                       114,101,116,117,114,110,32,97,32,102,108,97,103,32,111,102,32,101,105,116,
-                       104,101,114,32,96,84,82,85,69,96,32,111,114,32,96,70,65,76,83,69,
-                       96,44,32,116,104,111,117,103,104,32,96,117,110,116,105,108,96,32,119,105,
-                       108,108,32,116,114,101,97,116,32,97,110,121,32,110,111,110,45,122,101,114,
-                       111,32,118,97,108,117,101,32,97,115,32,96,84,82,85,69,96,46,0,68,
-                       101,99,114,101,109,101,110,116,32,116,104,101,32,118,97,108,117,101,32,115,
-                       116,111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,
-                       101,100,32,97,100,100,114,101,115,115,32,98,121,32,49,46,0,68,101,99,
-                       114,101,109,101,110,116,32,116,104,101,32,118,97,108,117,101,32,115,116,111,
-                       114,101,100,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
-                       32,97,100,100,114,101,115,115,32,98,121,32,116,104,101,32,115,112,101,99,
-                       105,102,105,101,100,32,118,97,108,117,101,46,0,73,110,99,114,101,109,101,
-                       110,116,32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,
-                       97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,
-                       114,101,115,115,32,98,121,32,49,46,0,73,110,99,114,101,109,101,110,116,
-                       32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,
-                       115,115,32,98,121,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
-                       118,97,108,117,101,46,0,70,101,116,99,104,32,116,104,101,32,118,97,108,
-                       117,101,32,115,116,111,114,101,100,32,97,116,32,116,104,101,32,97,100,100,
-                       114,101,115,115,44,32,116,104,101,110,32,114,117,110,32,96,110,58,108,105,
-                       109,105,116,96,32,97,103,97,105,110,115,116,32,105,116,44,32,117,115,105,
-                       110,103,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,108,111,119,
-                       101,114,32,97,110,100,32,117,112,112,101,114,32,98,111,117,110,100,115,46,
-                       32,84,104,101,110,32,115,116,111,114,101,32,116,104,101,32,114,101,115,117,
-                       108,116,105,110,103,32,118,97,108,117,101,32,98,97,99,107,32,116,111,32,
-                       116,104,101,32,111,114,105,103,105,110,97,108,32,97,100,100,114,101,115,115,
-                       46,0,83,101,116,32,97,32,118,97,114,105,97,98,108,101,32,116,111,32,
-                       48,46,0,83,101,116,32,97,32,118,97,114,105,97,98,108,101,32,116,111,
-                       32,45,49,46,0,77,97,107,101,32,97,32,99,111,112,121,32,111,102,32,
-                       116,104,101,32,118,97,108,117,101,32,97,116,32,116,104,101,32,97,100,100,
-                       114,101,115,115,44,32,116,104,101,110,32,114,117,110,32,116,104,101,32,113,
-                       117,111,116,101,46,32,79,110,99,101,32,116,104,101,32,113,117,111,116,101,
-                       32,99,111,109,112,108,101,116,101,115,44,32,114,101,115,116,111,114,101,32,
-                       116,104,101,32,97,100,100,114,101,115,115,32,116,111,32,116,104,101,32,115,
-                       112,101,99,105,102,105,101,100,32,118,97,108,117,101,46,0,70,101,116,99,
-                       104,32,97,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,32,115,
-                       112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,44,32,116,104,
-                       101,110,32,114,117,110,32,116,104,101,32,113,117,111,116,97,116,105,111,110,
-                       32,119,105,116,104,32,116,104,105,115,32,118,97,108,117,101,32,111,110,32,
-                       116,104,101,32,115,116,97,99,107,46,32,65,102,116,101,114,119,97,114,100,
-                       115,44,32,115,116,111,114,101,32,116,104,101,32,114,101,116,117,114,110,101,
-                       100,32,118,97,108,117,101,32,97,116,32,116,104,101,32,111,114,105,103,105,
-                       110,97,108,32,97,100,100,114,101,115,115,46,0,67,114,101,97,116,101,32,
-                       97,32,118,97,114,105,97,98,108,101,46,32,84,104,101,32,118,97,114,105,
-                       97,98,108,101,32,105,115,32,105,110,105,116,105,97,108,105,122,101,100,32,
-                       116,111,32,48,46,0,67,114,101,97,116,101,32,97,32,118,97,114,105,97,
-                       98,108,101,32,119,105,116,104,32,116,104,101,32,115,112,101,99,105,102,105,
-                       101,100,32,105,110,105,116,105,97,108,32,118,97,108,117,101,46,0,67,114,
-                       101,97,116,101,32,97,32,118,97,114,105,97,98,108,101,32,119,105,116,104,
-                       32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,105,110,105,116,105,
-                       97,108,32,118,97,108,117,101,46,0,70,101,116,99,104,32,116,104,101,32,
-                       51,50,45,98,105,116,32,118,97,108,117,101,32,115,116,111,114,101,100,32,
-                       97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,
-                       114,101,115,115,46,32,65,100,100,114,101,115,115,105,110,103,32,102,111,114,
-                       32,116,104,105,115,32,105,115,32,105,110,32,56,45,98,105,116,32,117,110,
-                       105,116,115,46,32,84,104,101,32,97,100,100,114,101,115,115,32,109,117,115,
-                       116,32,98,101,32,97,108,105,103,110,101,100,32,111,110,32,97,32,102,111,
-                       117,114,32,98,121,116,101,32,98,111,117,110,100,97,114,121,46,0,70,101,
-                       116,99,104,32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,
-                       32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,
-                       100,114,101,115,115,46,32,82,101,116,117,114,110,115,32,116,104,101,32,110,
-                       101,120,116,32,97,100,100,114,101,115,115,32,97,110,100,32,116,104,101,32,
-                       118,97,108,117,101,46,0,83,116,111,114,101,32,97,110,32,51,50,45,98,
-                       105,116,32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,
-                       101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,32,65,100,100,
-                       114,101,115,115,105,110,103,32,102,111,114,32,116,104,105,115,32,105,115,32,
-                       105,110,32,56,45,98,105,116,32,117,110,105,116,115,46,32,84,104,101,32,
-                       97,100,100,114,101,115,115,32,109,117,115,116,32,98,101,32,97,108,105,103,
-                       110,101,100,32,111,110,32,97,32,102,111,117,114,32,98,121,116,101,32,98,
-                       111,117,110,100,97,114,121,46,0,83,116,111,114,101,32,97,32,118,97,108,
-                       117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,
-                       100,32,97,100,100,114,101,115,115,32,97,110,100,32,114,101,116,117,114,110,
-                       32,116,104,101,32,110,101,120,116,32,97,100,100,114,101,115,115,46,0,69,
-                       120,101,99,117,116,101,32,113,117,111,116,101,32,114,101,112,101,97,116,101,
-                       100,108,121,32,119,104,105,108,101,32,116,104,101,32,113,117,111,116,101,32,
-                       114,101,116,117,114,110,115,32,97,32,96,84,82,85,69,96,32,118,97,108,
-                       117,101,46,32,84,104,101,32,113,117,111,116,101,32,115,104,111,117,108,100,
-                       32,114,101,116,117,114,110,32,97,32,102,108,97,103,32,111,102,32,101,105,
-                       116,104,101,114,32,96,84,82,85,69,96,32,111,114,32,96,70,65,76,83,
-                       69,96,44,32,116,104,111,117,103,104,32,96,119,104,105,108,101,96,32,119,
-                       105,108,108,32,116,114,101,97,116,32,97,110,121,32,110,111,110,45,122,101,
-                       114,111,32,118,97,108,117,101,32,97,115,32,96,84,82,85,69,96,46,0,
-                       80,101,114,102,111,114,109,32,97,32,98,105,116,119,105,115,101,32,88,79,
-                       82,32,111,112,101,114,97,116,105,111,110,46,0,66,101,103,105,110,32,97,
-                       110,32,97,114,114,97,121,46,32,84,104,105,115,32,105,115,32,105,110,116,
-                       101,110,100,101,100,32,116,111,32,109,97,107,101,32,99,114,101,97,116,105,
-                       110,103,32,97,114,114,97,121,115,32,97,32,98,105,116,32,99,108,101,97,
-                       110,101,114,32,116,104,97,110,32,117,115,105,110,103,32,97,32,113,117,111,
-                       116,97,116,105,111,110,32,97,110,100,32,96,97,58,99,111,117,110,116,101,
-                       100,45,114,101,115,117,108,116,115,96,46,0,66,101,103,105,110,32,97,32,
-                       108,101,120,105,99,97,108,108,121,32,115,99,111,112,101,100,32,97,114,101,
-                       97,46,0,67,111,109,112,108,101,116,101,32,97,110,32,97,114,114,97,121,
-                       32,98,101,103,117,110,32,98,121,32,96,123,96,46,32,82,101,116,117,114,
-                       110,115,32,97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
-                       100,97,116,97,46,0,69,110,100,32,97,32,108,101,120,105,99,97,108,108,
-                       121,32,115,99,111,112,101,100,32,97,114,101,97,46,32,84,104,105,115,32,
-                       119,105,108,108,32,104,105,100,101,32,97,110,121,32,104,101,97,100,101,114,
-                       115,32,98,101,116,119,101,101,110,32,96,123,123,96,32,97,110,100,32,96,
-                       45,45,45,114,101,118,101,97,108,45,45,45,96,44,32,108,101,97,118,105,
-                       110,103,32,111,110,108,121,32,104,101,97,100,101,114,115,32,98,101,116,119,
-                       101,101,110,32,96,45,45,45,114,101,118,101,97,108,45,45,45,96,32,97,
-                       110,100,32,116,104,101,32,96,125,125,96,32,118,105,115,105,98,108,101,46,
-                       0,68,101,115,99,114,105,98,101,32,97,32,119,111,114,100,32,98,121,32,
-                       110,97,109,101,46,0,83,101,116,32,116,104,101,32,100,58,115,116,97,99,
-                       107,32,102,105,101,108,100,32,102,111,114,32,97,32,119,111,114,100,46,0,
-                       83,101,116,32,116,104,101,32,100,58,102,115,116,97,99,107,32,102,105,101,
-                       108,100,32,102,111,114,32,97,32,119,111,114,100,46,0,83,101,116,32,116,
-                       104,101,32,100,58,97,115,116,97,99,107,32,102,105,101,108,100,32,102,111,
-                       114,32,97,32,119,111,114,100,46,0,71,105,118,101,110,32,97,32,100,105,
-                       99,116,105,111,110,97,114,121,32,112,111,105,110,116,101,114,44,32,114,101,
-                       116,117,114,110,32,97,100,100,114,101,115,115,32,111,102,32,116,104,101,32,
-                       100,97,116,97,32,115,116,97,99,107,32,102,105,101,108,100,0,71,105,118,
-                       101,110,32,97,32,100,105,99,116,105,111,110,97,114,121,32,112,111,105,110,
-                       116,101,114,44,32,114,101,116,117,114,110,32,97,100,100,114,101,115,115,32,
-                       111,102,32,116,104,101,32,97,100,100,114,101,115,115,32,115,116,97,99,107,
-                       32,102,105,101,108,100,0,71,105,118,101,110,32,97,32,100,105,99,116,105,
-                       111,110,97,114,121,32,112,111,105,110,116,101,114,44,32,114,101,116,117,114,
-                       110,32,97,100,100,114,101,115,115,32,111,102,32,116,104,101,32,102,108,111,
-                       97,116,32,115,116,97,99,107,32,102,105,101,108,100,0,71,105,118,101,110,
-                       32,97,32,100,105,99,116,105,111,110,97,114,121,32,112,111,105,110,116,101,
-                       114,44,32,114,101,116,117,114,110,32,97,100,100,114,101,115,115,32,111,102,
-                       32,116,104,101,32,100,101,115,99,114,105,112,116,105,111,110,32,102,105,101,
-                       108,100,0,82,101,116,117,114,110,32,97,32,115,116,114,105,110,103,32,114,
-                       101,112,114,101,115,101,110,116,97,116,105,111,110,32,102,111,114,32,97,32,
-                       110,117,109,98,101,114,44,32,119,105,116,104,32,100,105,103,105,116,115,32,
-                       105,110,32,114,101,118,101,114,115,101,32,111,114,100,101,114,0,28362,69696,170,
-                       70015,-460132687,69698,202,202,70042,105,109,97,103,101,58,115,97,118,101,0,2049,5703,115,
-                       45,0,1,69698,3,1,1000,2049,13215,2049,13192,10,69676,69726,170,0,257642186,0,202,202,
-                       0,101,100,105,116,63,0,2,1793,69733,1,8,11,10,1,69729,1793,69741,1,127,
-                       11,10,1,69737,2049,2923,22,10,69711,69763,170,0,-76077980,0,202,202,0,101,110,100,
-                       101,100,63,0,2049,5172,3841,5446,2049,3411,10,69747,69783,170,0,193486030,0,202,202,0,
-                       97,100,100,0,2049,69763,1,17,1,5082,2049,68,10,69770,69808,170,0,-12645824,0,202,
-                       202,0,103,97,116,104,101,114,0,2049,69726,1,17,1,69783,2049,68,10,69792,69832,
-                       170,0,256018261,0,202,202,0,99,121,99,108,101,0,2049,13513,2049,2873,4,8,2049,
-                       3372,25,3,2049,69808,1,69832,7,10,69676,69869,170,70015,-1658019367,69871,202,202,70087,112,97,
-                       114,115,101,45,117,110,116,105,108,0,2049,5703,113,45,115,0,1,69871,3,1793,
-                       69890,2049,5678,2049,5198,2049,69832,771,2049,5036,10,1,69880,2049,5228,10,69848,69910,170,70015,
-                       272733106,69912,202,202,70195,115,58,103,101,116,0,2049,5703,45,115,0,1,69912,3,1793,
-                       69940,1793,69926,1,13,11,10,1,69922,1793,69934,1,10,11,10,1,69930,2049,2923,22,
-                       10,1,69920,2049,69869,10,69895,69960,170,70015,255552908,69962,202,202,70288,99,108,101,97,114,
-                       0,2049,5703,45,0,1,69962,3,2049,5703,92,94,91,50,74,92,94,91,48,59,
-                       48,72,0,1,69969,2049,10234,2049,13341,10,69945,70001,182,70015,5861507,70003,202,202,70307,47,
-                       47,0,2049,5703,45,0,1,70003,3,2049,25111,1,13555,2049,4827,10,105,110,116,101,
-                       114,102,97,99,101,47,114,101,116,114,111,45,117,110,105,120,46,114,101,116,
-                       114,111,0,83,97,118,101,32,116,104,101,32,99,117,114,114,101,110,116,32,
-                       115,121,115,116,101,109,32,116,111,32,97,32,110,101,119,32,105,109,97,103,
-                       101,32,102,105,108,101,46,0,82,101,97,100,32,105,110,112,117,116,32,102,
-                       114,111,109,32,115,116,100,105,110,32,40,118,105,97,32,96,99,58,103,101,
-                       116,96,41,32,117,110,116,105,108,32,116,104,101,32,114,101,116,117,114,110,
-                       101,100,32,99,104,97,114,97,99,116,101,114,32,105,115,32,109,97,116,99,
-                       104,101,100,32,98,121,32,116,104,101,32,113,117,111,116,101,46,32,82,101,
-                       116,117,114,110,115,32,97,32,115,116,114,105,110,103,46,0,82,101,97,100,
-                       32,105,110,112,117,116,32,102,114,111,109,32,115,116,97,110,100,97,114,100,
-                       32,105,110,32,40,118,105,97,32,96,99,58,103,101,116,96,41,32,117,110,
-                       116,105,108,32,97,32,67,82,32,111,114,32,76,70,32,105,115,32,101,110,
-                       99,111,117,110,116,101,114,101,100,46,32,82,101,116,117,114,110,115,32,97,
-                       32,115,116,114,105,110,103,46,0,67,108,101,97,114,32,116,104,101,32,100,
-                       105,115,112,108,97,121,46,0,73,103,110,111,114,101,32,97,110,121,32,116,
-                       111,107,101,110,115,32,114,101,109,97,105,110,105,110,103,32,111,110,32,116,
-                       104,101,32,99,117,114,114,101,110,116,32,108,105,110,101,46,32,87,111,114,
-                       107,115,32,119,105,116,104,32,102,105,108,101,115,32,97,110,100,32,116,104,
-                       101,32,105,110,116,101,114,97,99,116,105,118,101,32,96,108,105,115,116,101,
-                       110,101,114,96,46,0,69989,70422,158,0,72570505,0,202,202,0,83,111,117,114,99,
-                       101,115,0,4,70673,71326,72118,73121,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-                       0,0,0,0,0,0,0,0,0,0,0,70405,70566,170,0,159149617,0,202,202,0,
-                       107,110,111,119,110,63,0,2,1,70422,2049,11178,10,70550,70587,170,0,262739357,0,202,
-                       202,0,105,110,100,101,120,0,1,70422,4,2049,11958,1,70422,4,2049,11340,10,70572,
-                       70614,170,0,421984292,0,202,202,0,114,101,99,111,114,100,0,2049,5735,2,1,70422,
-                       2049,4763,3841,70422,1,70422,17,16,10,1793,70671,2049,25022,2049,70566,1,70587,1,70614,2049,
-                       68,1793,70649,1,204,1,2,17,8,10,1,70642,2049,2889,2049,2100,2049,188,16,2049,
-                       2100,2049,200,3841,9,8,2049,2100,2049,190,16,10,1,70630,100,105,99,116,45,119,
-                       111,114,100,115,45,108,105,115,116,105,110,103,46,102,111,114,116,104,0,69989,
-                       70715,170,70673,-1519205998,70717,202,202,71301,100,58,119,111,114,100,115,0,2049,5703,45,0,
-                       1,70717,3,1793,70731,2049,200,2049,13341,2049,13303,10,1,70724,2049,10511,10,70698,70758,170,
-                       70673,1750461083,70760,202,202,71245,100,58,119,111,114,100,115,45,119,105,116,104,0,2049,
-                       5703,115,45,0,1,70760,3,2049,2585,2049,7040,1793,70797,2049,200,2,2049,2585,2049,6708,
-                       1793,70786,2049,13341,2049,13303,10,1,70781,1793,70792,3,10,1,70790,2049,68,10,1,70772,
-                       2049,10511,10,70736,70827,170,70673,-1509196721,0,202,202,0,100,105,115,112,108,97,121,45,
-                       105,102,45,108,101,102,116,0,2,2049,2585,2049,6978,1793,70839,2049,13341,2049,13303,10,
-                       1,70834,1793,70845,3,10,1,70843,2049,68,10,70736,70882,170,70673,-1159574567,70884,202,202,71186,
-                       100,58,119,111,114,100,115,45,98,101,103,105,110,110,105,110,103,45,119,105,
-                       116,104,0,2049,5703,115,45,0,1,70884,3,2049,2585,2049,7040,1793,70901,2049,200,2049,
-                       70827,10,1,70896,2049,10511,10,70850,70939,170,70673,-986950196,70941,202,202,71132,100,58,119,111,
-                       114,100,115,45,109,105,115,115,105,110,103,45,100,101,116,97,105,108,115,0,
-                       2049,5703,45,0,1,70941,3,2049,5703,68,46,83,116,97,99,107,58,0,1,70948,
-                       2049,13341,2049,13286,1793,70987,2,2049,192,15,2049,3470,1793,70980,2049,200,2049,13341,2049,13303,
-                       10,1,70973,1,17,2049,68,10,1,70965,2049,10511,2049,13286,2049,5703,65,46,83,116,
-                       97,99,107,58,0,1,70995,2049,13341,2049,13286,1793,71034,2,2049,194,15,2049,3470,1793,
-                       71027,2049,200,2049,13341,2049,13303,10,1,71020,1,17,2049,68,10,1,71012,2049,10511,2049,
-                       13286,2049,5703,70,46,83,116,97,99,107,58,0,1,71042,2049,13341,2049,13286,1793,71081,
-                       2,2049,196,15,2049,3470,1793,71074,2049,200,2049,13341,2049,13303,10,1,71067,1,17,2049,
-                       68,10,1,71059,2049,10511,2049,13286,2049,5703,68,101,115,99,58,0,1,71089,2049,13341,
-                       2049,13286,1793,71125,2,2049,198,15,2049,3470,1793,71118,2049,200,2049,13341,2049,13303,10,1,
-                       71111,1,17,2049,68,10,1,71103,2049,10511,2049,13286,10,68,105,115,112,108,97,121,
-                       32,119,111,114,100,115,32,109,105,115,115,105,110,103,32,111,110,101,32,111,
-                       114,32,109,111,114,101,32,105,110,102,111,114,109,97,116,105,111,110,32,102,
-                       105,101,108,100,115,46,0,68,105,115,112,108,97,121,32,119,111,114,100,115,
-                       32,119,105,116,104,32,110,97,109,101,32,115,116,97,114,116,105,110,103,32,
-                       119,105,116,104,32,116,104,101,32,112,114,111,118,105,100,101,100,32,115,116,
-                       114,105,110,103,46,0,68,105,115,112,108,97,121,32,119,111,114,100,115,32,
-                       119,105,116,104,32,110,97,109,101,32,99,111,110,116,97,105,110,105,110,103,
-                       32,116,104,101,32,112,114,111,118,105,100,101,100,32,115,116,114,105,110,103,
-                       46,0,68,105,115,112,108,97,121,32,97,108,108,32,110,97,109,101,100,32,
-                       119,111,114,100,115,46,0,101,120,116,101,110,115,105,111,110,115,47,100,111,
-                       117,98,108,101,46,114,101,116,114,111,0,70906,71370,170,71326,-1059603453,71372,202,202,72055,
-                       100,111,117,98,108,101,58,118,97,114,0,2049,5703,110,110,115,45,0,1,71372,
-                       3,2049,2695,4,2049,132,2049,132,10,71350,71410,170,71326,1419216868,71412,202,202,71790,100,111,
-                       117,98,108,101,58,102,101,116,99,104,0,2049,5703,97,45,110,110,0,1,71412,
-                       3,2049,60,4,15,10,71388,71447,170,71326,1435167943,71449,202,202,71946,100,111,117,98,108,
-                       101,58,115,116,111,114,101,0,2049,5703,110,110,97,45,0,1,71449,3,1,19,
-                       2049,2889,2049,63,16,10,71425,71487,170,71326,1416012481,71489,202,202,71624,100,111,117,98,108,
-                       101,58,99,111,110,115,116,0,2049,5703,110,110,115,45,0,1,71489,3,2049,71370,
-                       1,71410,2049,10476,10,71465,71525,170,71326,-607259883,71527,202,202,72022,100,111,117,98,108,101,
-                       58,115,119,97,112,0,2049,5703,110,110,109,109,45,109,109,110,110,0,1,71527,
-                       3,67503109,5,67503109,6,10,71504,71565,170,71326,-1059622793,71567,202,202,71685,100,111,117,98,108,
-                       101,58,100,105,112,0,2049,5703,109,110,113,45,109,110,0,1,71567,3,67503109,67503109,
-                       5,5,8,6,6,10,71545,71605,170,71326,-1059606458,71607,202,202,71860,100,111,117,98,108,
-                       101,58,115,105,112,0,2049,5703,109,110,113,45,109,110,0,1,71607,3,1,2873,
-                       2049,2889,2049,71565,10,67,114,101,97,116,101,32,97,32,99,111,110,115,116,97,
-                       110,116,32,114,101,116,117,114,110,105,110,103,32,116,104,101,32,115,112,101,
-                       99,105,102,105,101,100,32,100,111,117,98,108,101,32,99,101,108,108,32,118,
-                       97,108,117,101,46,0,84,101,109,112,111,114,97,114,105,108,121,32,114,101,
-                       109,111,118,101,32,109,32,97,110,100,32,110,32,102,114,111,109,32,116,104,
-                       101,32,115,116,97,99,107,44,32,101,120,101,99,117,116,101,32,116,104,101,
-                       32,113,117,111,116,97,116,105,111,110,44,32,97,110,100,32,116,104,101,110,
-                       32,114,101,115,116,111,114,101,32,109,32,97,110,100,32,110,32,116,111,32,
-                       116,104,101,32,115,116,97,99,107,46,0,70,101,116,99,104,32,116,104,101,
-                       32,100,111,117,98,108,101,32,99,101,108,108,32,118,97,108,117,101,115,32,
-                       115,116,111,114,101,100,32,105,110,32,116,104,101,32,100,111,117,98,108,101,
-                       32,99,101,108,108,32,118,97,114,105,97,98,108,101,32,97,116,32,97,46,
-                       0,82,117,110,32,113,117,111,116,101,46,32,65,102,116,101,114,32,101,120,
-                       101,99,117,116,105,111,110,32,99,111,109,112,108,101,116,101,115,44,32,112,
-                       117,116,32,97,32,99,111,112,121,32,111,102,32,109,32,97,110,100,32,110,
-                       32,98,97,99,107,32,111,110,32,116,111,112,32,111,102,32,116,104,101,32,
-                       115,116,97,99,107,46,0,83,116,111,114,101,32,116,104,101,32,100,111,117,
-                       98,108,101,32,99,101,108,108,32,118,97,108,117,101,115,32,111,110,32,116,
-                       104,101,32,115,116,97,99,107,32,105,110,32,116,104,101,32,100,111,117,98,
-                       108,101,32,99,101,108,108,32,118,97,114,105,97,98,108,101,32,97,116,32,
-                       97,46,0,83,119,97,112,32,100,111,117,98,108,101,32,99,101,108,108,32,
-                       118,97,108,117,101,32,111,110,32,115,116,97,99,107,46,0,67,114,101,97,
-                       116,101,32,97,32,118,97,114,105,97,98,108,101,32,102,111,114,32,104,111,
-                       108,100,105,110,103,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
-                       100,111,117,98,108,101,32,99,101,108,108,32,118,97,108,117,101,46,0,101,
-                       120,116,101,110,115,105,111,110,115,47,109,97,108,108,111,99,46,114,101,116,
-                       114,111,0,71585,72162,170,72118,-386501686,0,202,202,0,109,101,109,58,105,110,118,111,
-                       107,101,0,1,15,2049,13215,2049,13192,10,72142,0,158,72118,214053744,0,202,202,0,65,
-                       76,76,79,67,0,72169,1,158,72118,2089080839,0,202,202,0,70,82,69,69,0,72184,
-                       2,158,72118,235691186,0,202,202,0,83,84,79,82,69,0,72198,3,158,72118,219740111,0,
-                       202,202,0,70,69,84,67,72,0,72213,4,158,72118,-868914953,0,202,202,0,82,69,
-                       83,73,90,69,0,71585,72263,170,72118,369169257,72265,202,202,72547,109,101,109,58,97,108,
-                       108,111,99,0,2049,5703,110,45,45,97,0,1,72265,3,1,0,2049,72162,10,72244,
-                       72297,170,72118,390806699,72299,202,202,72936,109,101,109,58,115,116,111,114,101,0,2049,5703,
-                       97,110,45,45,0,1,72299,3,1,2,2049,72162,10,72278,72331,170,72118,374855624,72333,202,
-                       202,72694,109,101,109,58,102,101,116,99,104,0,2049,5703,97,45,45,110,0,1,
-                       72333,3,1,3,2049,72162,10,72312,72364,170,72118,1963630784,72366,202,202,72822,109,101,109,58,
-                       102,114,101,101,0,2049,5703,97,45,45,0,1,72366,3,1,1,2049,72162,10,72346,
-                       72398,170,72118,-45070288,72400,202,202,72905,109,101,109,58,114,101,115,105,122,101,0,2049,
-                       5703,97,110,45,45,0,1,72400,3,1,4,2049,72162,10,72378,72432,170,72118,371289385,72434,
-                       202,202,72624,109,101,109,58,99,101,108,108,43,0,2049,5703,110,110,45,110,0,
-                       1,72434,3,1,8,19,17,10,72413,72473,170,72118,84495120,72475,202,202,72767,109,101,109,
-                       58,102,101,116,99,104,45,100,111,117,98,108,101,0,2049,5703,110,45,110,110,
-                       0,1,72475,3,2,1,1,2049,72432,15,5,2049,72331,6,10,72447,72520,170,72118,1277424275,
-                       72522,202,202,73025,109,101,109,58,115,116,111,114,101,45,100,111,117,98,108,101,
-                       0,2049,5703,97,110,110,45,110,110,0,1,72522,3,5,5,2049,2873,1,1,2049,
-                       72432,6,2049,72297,6,2049,72297,10,85,115,101,32,109,97,108,108,111,99,32,116,
-                       111,32,97,108,108,111,99,97,116,101,32,109,101,109,111,114,121,46,32,82,
-                       101,116,117,114,110,115,32,97,32,100,111,117,98,108,101,32,99,101,108,108,
-                       32,112,111,105,110,116,101,114,32,116,111,32,116,104,105,115,32,109,101,109,
-                       111,114,121,46,0,82,101,116,117,114,110,32,97,100,100,114,101,115,115,32,
-                       111,102,32,110,101,120,116,32,99,101,108,108,46,32,85,115,101,115,32,97,
-                       32,100,111,117,98,108,101,32,99,101,108,108,32,112,111,105,110,116,101,114,
-                       32,111,110,32,116,104,101,32,115,116,97,99,107,46,0,70,101,116,99,104,
-                       32,118,97,108,117,101,32,102,114,111,109,32,109,97,108,108,111,99,39,100,
-                       32,109,101,109,111,114,121,32,114,101,103,105,111,110,46,32,65,100,100,114,
-                       101,115,115,32,105,115,32,97,32,100,111,117,98,108,101,32,99,101,108,108,
-                       32,118,97,108,117,101,46,0,70,101,116,99,104,32,97,32,100,111,117,98,
-                       108,101,32,99,101,108,108,32,118,97,108,117,101,32,102,114,111,109,32,97,
-                       32,109,97,108,108,111,99,32,109,101,109,111,114,121,32,114,101,103,105,111,
-                       110,46,0,70,114,101,32,97,32,109,97,108,108,111,99,39,100,32,114,101,
-                       103,105,111,110,32,111,102,32,109,101,109,111,114,121,46,32,80,97,115,115,
-                       32,97,32,100,111,117,98,108,101,32,99,101,108,108,32,112,111,105,110,116,
-                       101,114,32,116,111,32,116,104,101,32,109,101,109,111,114,121,32,116,111,32,
-                       102,114,101,101,46,0,82,101,115,105,122,101,32,97,32,109,97,108,108,111,
-                       99,39,100,32,109,101,109,111,114,121,32,97,114,101,97,46,0,83,116,111,
-                       114,101,32,97,32,118,97,108,117,101,32,105,110,116,111,32,97,32,109,97,
-                       108,108,111,99,39,100,32,109,101,109,111,114,121,32,114,101,103,105,111,110,
-                       46,32,85,115,101,115,32,97,32,100,111,117,98,108,101,32,99,101,108,108,
-                       32,112,111,105,110,116,101,114,32,102,111,114,32,116,104,101,32,97,100,100,
-                       114,101,115,115,46,0,83,116,111,114,101,32,97,32,100,111,117,98,108,101,
-                       32,118,97,108,117,101,32,105,110,116,111,32,97,32,109,97,108,108,111,99,
-                       39,100,32,109,101,109,111,114,121,32,114,101,103,105,111,110,46,32,85,115,
-                       101,115,32,97,32,100,111,117,98,108,101,32,99,101,108,108,32,112,111,105,
-                       110,116,101,114,32,102,111,114,32,116,104,101,32,97,100,100,114,101,115,115,
-                       46,0,101,120,116,101,110,115,105,111,110,115,47,105,111,99,116,108,46,114,
-                       101,116,114,111,0,72494,73169,170,73121,-1638437621,73171,202,202,73427,105,111,99,116,108,58,
-                       111,112,101,114,97,116,105,111,110,0,2049,5703,110,45,0,1,73171,3,1,14,
-                       2049,13215,2,2049,3517,1793,73226,3,2049,5703,69,114,114,111,114,58,32,105,111,99,
-                       116,108,32,100,101,118,105,99,101,32,110,111,116,32,102,111,117,110,100,0,
-                       1,73189,2049,13341,2049,13286,10,1,73186,2049,3638,2049,13192,10,73144,73258,170,73121,-1756413478,73260,
-                       202,202,73461,105,111,99,116,108,58,116,101,114,109,45,115,105,122,101,0,2049,
-                       5703,45,110,110,0,1,73260,3,1,0,2049,73169,10,73233,73298,170,73121,-1813451557,73300,202,
-                       202,73498,105,111,99,116,108,58,115,101,116,45,99,98,114,101,97,107,0,2049,
-                       5703,45,0,1,73300,3,1,1,2049,73169,10,73272,73336,170,73121,-1461233020,73338,202,202,73517,
-                       105,111,99,116,108,58,115,101,116,45,108,98,114,101,97,107,0,2049,5703,45,
-                       0,1,73338,3,1,2,2049,73169,10,73310,73374,170,73121,-193579625,73376,202,202,73536,105,111,
-                       99,116,108,58,115,97,118,101,45,115,116,97,116,101,0,2049,5703,45,0,1,
-                       73376,3,1,3,2049,73169,10,73348,73415,170,73121,-2031814164,73417,202,202,73570,105,111,99,116,
-                       108,58,114,101,115,116,111,114,101,45,115,116,97,116,101,0,2049,5703,45,0,
-                       1,73417,3,1,4,2049,73169,10,80,101,114,102,111,114,109,32,97,110,32,105,
-                       111,99,116,108,32,100,101,118,105,99,101,32,111,112,101,114,97,116,105,111,
-                       110,0,82,101,116,117,114,110,32,104,101,105,103,104,116,44,32,119,105,100,
-                       116,104,32,111,102,32,116,104,101,32,116,101,114,109,105,110,97,108,0,83,
-                       101,116,32,39,99,98,114,101,97,107,39,32,115,116,97,116,101,0,83,101,
-                       116,32,39,108,98,114,101,97,107,39,32,115,116,97,116,101,0,83,97,118,
-                       101,32,99,117,114,114,101,110,116,32,105,111,99,116,108,32,115,101,116,116,
-                       105,110,103,115,47,115,116,97,116,101,0,82,101,115,116,111,114,101,32,115,
-                       97,118,101,100,32,105,111,99,116,108,101,32,115,101,116,116,105,110,103,115,
-                       47,115,116,97,116,101,0,0 };
+CELL ngaImageCells = 83496;
+size_t ngaImagePackedBytes = 109376;
+const unsigned char ngaImagePacked[] = {
+  78,71,65,122,1,4,1,1,1,1,0,168,140,5,175,214,
+  6,129,14,210,133,1,205,138,5,167,140,5,240,174,12,210,
+  3,182,3,168,14,192,16,143,63,237,133,1,0,0,10,1,
+  10,2,10,3,10,4,10,5,10,6,10,7,10,8,10,11,
+  10,12,10,13,10,14,10,15,10,16,10,17,10,18,10,19,
+  10,20,10,148,136,12,10,148,6,10,21,10,22,10,23,10,
+  24,10,25,130,130,196,32,1,143,20,130,130,196,40,1,144,
+  140,40,185,1,205,1,129,160,132,128,1,69,68,129,152,132,
+  136,1,0,0,69,143,16,10,133,130,172,48,0,0,9,10,
+  130,130,212,32,255,1,130,130,224,8,8,255,1,149,8,130,
+  130,224,8,16,255,1,149,8,129,176,132,168,1,24,255,1,
+  10,129,176,16,0,47,129,176,196,32,0,31,129,176,196,32,
+  0,15,145,20,129,16,62,25,131,130,28,103,130,130,32,103,
+  129,164,144,144,1,1,10,131,134,140,8,0,0,134,140,140,
+  24,10,25,131,130,32,122,134,140,140,24,10,130,158,148,8,
+  1,145,136,136,120,133,130,196,48,1,130,140,176,8,113,129,
+  130,32,117,70,131,134,132,80,0,1,129,158,132,64,3,65,
+  129,160,40,3,129,14,177,44,143,130,28,134,1,129,16,62,
+  25,129,16,134,1,129,14,143,1,129,16,143,1,131,130,132,
+  56,0,0,134,1,0,0,241,138,5,0,0,129,158,100,157,
+  1,131,130,188,8,3,2,146,130,188,88,156,1,25,131,130,
+  132,120,129,14,156,1,144,20,129,16,158,1,129,130,32,28,
+  139,1,129,130,192,80,0,0,155,1,129,158,100,155,1,131,
+  130,132,64,13,139,1,129,14,134,1,129,158,132,128,1,3,
+  156,1,129,130,32,129,16,134,1,129,14,134,1,129,158,132,
+  8,155,1,185,1,205,1,129,14,70,129,158,132,8,155,1,
+  139,1,205,1,129,14,70,7,10,129,162,40,1,129,162,40,
+  2,129,162,40,3,129,162,40,4,129,162,40,5,129,162,40,
+  6,129,162,40,7,129,162,40,8,129,162,40,9,45,0,0,
+  129,14,196,245,4,129,158,148,8,3,2,143,130,32,134,1,
+  129,16,134,1,129,16,134,1,129,130,32,0,0,134,1,129,
+  130,32,0,0,134,1,129,130,32,0,0,134,1,129,130,32,
+  225,1,134,1,129,130,32,225,1,134,1,129,130,32,0,0,
+  134,1,129,16,150,1,134,130,64,2,129,158,100,10,7,173,
+  233,4,0,157,197,232,182,3,129,160,132,80,135,2,11,129,
+  130,192,8,0,0,135,2,2,15,25,130,130,32,151,255,1,
+  129,158,132,64,136,2,29,129,18,137,2,143,130,28,145,2,
+  129,16,143,63,129,160,132,64,136,2,140,2,129,158,40,135,
+  2,10,129,164,40,7,129,16,62,25,130,130,184,8,58,163,
+  2,9,129,164,144,40,48,132,130,188,152,1,162,2,145,140,
+  132,56,165,2,130,158,132,88,45,25,131,136,140,8,0,1,
+  132,130,196,80,1,129,136,132,64,1,178,2,129,136,132,64,
+  0,0,165,2,131,166,40,32,0,2,115,105,103,105,108,58,
+  105,0,0,143,130,132,136,1,195,2,6,144,20,130,130,32,
+  108,129,150,100,1,131,134,132,80,192,2,129,16,207,2,129,
+  16,203,2,129,130,32,195,2,155,2,130,130,192,8,194,2,
+  0,0,140,20,131,20,129,16,185,2,129,14,178,1,143,130,
+  28,178,1,129,14,233,2,129,130,188,8,193,1,3,227,1,
+  8,129,158,132,120,3,2,129,16,207,1,16,129,130,192,80,
+  0,1,155,1,129,16,207,1,143,20,129,16,155,2,130,130,
+  176,8,0,0,247,2,9,129,14,178,1,129,158,132,136,1,
+  3,2,129,158,132,64,155,1,244,2,129,130,32,129,14,134,
+  1,129,158,132,8,3,0,0,134,1,8,129,158,40,3,129,
+  16,158,1,129,130,32,28,139,1,129,158,144,8,3,13,129,
+  16,139,1,129,16,134,1,132,160,132,128,1,155,1,129,158,
+  100,155,1,131,134,40,129,158,40,3,129,130,32,13,139,1,
+  129,16,134,1,129,130,28,25,139,1,129,130,28,61,139,1,
+  129,130,28,21,139,1,129,130,28,23,139,1,129,14,197,220,
+  1,10,130,130,32,207,1,143,136,132,64,209,1,143,14,168,
+  14,129,158,100,194,2,129,158,132,136,1,190,3,1,132,130,
+  28,185,3,129,158,132,56,135,2,185,3,129,158,132,64,190,
+  3,155,2,129,152,132,8,0,0,198,3,182,3,129,14,70,
+  129,14,212,3,130,130,192,8,190,3,213,2,8,129,130,132,
+  56,191,3,201,3,70,196,16,204,88,180,91,136,89,245,106,
+  176,102,144,97,242,96,131,75,201,76,250,89,149,89,230,86,
+  240,97,172,93,190,80,156,104,228,75,143,105,209,99,132,82,
+  174,83,238,98,136,104,184,93,212,108,232,78,237,82,217,92,
+  145,86,0,0,129,16,155,2,129,162,60,1,129,14,134,1,
+  130,130,32,160,4,129,16,158,4,129,16,158,4,132,130,196,
+  8,2,160,4,8,129,176,144,8,0,47,0,31,152,162,144,
+  8,0,15,152,162,68,129,14,134,1,130,158,144,8,1,145,
+  158,204,80,129,16,62,25,132,138,148,16,134,136,176,48,132,
+  50,131,130,28,150,4,132,130,196,16,2,129,16,147,4,129,
+  130,32,220,3,150,4,132,134,132,144,1,220,3,129,164,40,
+  1,114,101,116,114,111,46,109,117,114,105,0,2,15,199,1,
+  244,159,1,206,215,161,92,200,152,1,0,2,170,143,3,100,
+  117,112,0,0,180,4,17,199,1,244,159,1,154,178,215,228,
+  7,191,152,1,0,2,190,142,3,100,114,111,112,0,0,193,
+  4,19,199,1,244,159,1,192,204,248,228,7,130,158,1,0,
+  2,206,170,4,115,119,97,112,0,0,207,4,27,199,1,244,
+  159,1,129,136,212,228,7,128,151,1,0,2,195,222,2,99,
+  97,108,108,0,0,221,4,29,199,1,244,159,1,218,222,161,
+  92,215,152,1,0,2,186,149,3,101,113,63,0,0,235,4,
+  31,199,1,244,159,1,135,242,221,227,7,220,146,1,0,2,
+  238,137,2,45,101,113,63,0,0,248,4,33,199,1,244,159,
+  1,132,155,162,92,226,153,1,0,2,182,221,3,108,116,63,
+  0,0,134,5,35,199,1,244,159,1,191,240,161,92,152,153,
+  1,0,2,185,204,3,103,116,63,0,0,147,5,37,199,1,
+  244,159,1,239,192,184,123,220,152,1,0,2,178,180,3,102,
+  101,116,99,104,0,0,160,5,39,199,1,244,159,1,210,138,
+  134,131,1,249,157,1,0,2,222,169,4,115,116,111,114,101,
+  0,0,175,5,41,199,1,0,0,246,254,155,127,255,153,1,
+  0,2,208,224,3,110,58,97,100,100,0,0,190,5,43,199,
+  1,0,0,183,156,157,127,223,154,1,0,2,132,233,3,110,
+  58,115,117,98,0,0,205,5,45,199,1,0,0,187,233,156,
+  127,182,154,1,0,2,193,229,3,110,58,109,117,108,0,0,
+  220,5,47,199,1,0,0,208,138,132,141,6,147,154,1,0,
+  2,199,226,3,110,58,100,105,118,109,111,100,0,0,235,5,
+  49,199,1,0,0,240,153,156,127,142,154,1,0,2,136,226,
+  3,110,58,100,105,118,0,0,253,5,51,199,1,0,0,237,
+  231,156,127,177,154,1,0,2,149,229,3,110,58,109,111,100,
+  0,0,140,6,41,199,1,244,159,1,208,235,10,205,146,1,
+  0,2,137,136,2,43,0,0,155,6,43,199,1,244,159,1,
+  210,235,10,213,146,1,0,2,128,137,2,45,0,0,166,6,
+  45,199,1,244,159,1,207,235,10,200,146,1,0,2,246,134,
+  2,42,0,0,177,6,47,199,1,244,159,1,180,231,226,227,
+  7,238,146,1,0,2,133,140,2,47,109,111,100,0,0,188,
+  6,49,199,1,143,160,1,212,235,10,233,146,1,0,2,198,
+  139,2,47,0,0,202,6,51,199,1,143,160,1,197,162,162,
+  92,236,153,1,0,2,222,222,3,109,111,100,0,0,213,6,
+  53,199,1,244,159,1,152,188,161,92,223,149,1,0,2,174,
+  202,2,97,110,100,0,0,226,6,55,199,1,244,159,1,134,
+  242,229,2,249,154,1,0,2,168,235,3,111,114,0,0,239,
+  6,57,199,1,244,159,1,158,128,163,92,132,159,1,0,2,
+  151,209,4,120,111,114,0,0,251,6,59,199,1,143,160,1,
+  195,171,235,130,1,179,157,1,0,2,137,155,4,115,104,105,
+  102,116,0,0,136,7,176,3,205,1,244,159,1,229,245,241,
+  228,7,145,155,1,141,146,1,0,0,157,237,3,112,117,115,
+  104,0,0,151,7,179,3,205,1,244,159,1,148,188,162,92,
+  140,155,1,138,146,1,0,0,158,236,3,112,111,112,0,0,
+  165,7,173,3,205,1,244,159,1,176,225,229,2,244,146,1,
+  0,2,210,140,2,48,59,0,0,178,7,62,158,59,244,159,
+  1,0,137,145,167,134,14,224,152,1,0,2,227,180,3,102,
+  101,116,99,104,45,110,101,120,116,0,0,190,7,65,158,59,
+  244,159,1,254,140,192,174,7,253,157,1,0,2,136,170,4,
+  115,116,111,114,101,45,110,101,120,116,0,0,210,7,185,2,
+  193,1,244,159,1,0,233,250,180,248,14,141,157,1,0,2,
+  182,142,4,115,58,116,111,45,110,117,109,98,101,114,0,0,
+  230,7,122,193,1,244,159,1,135,153,134,130,1,142,156,1,
+  0,2,199,252,3,115,58,101,113,63,0,0,251,7,108,193,
+  1,244,159,1,212,169,154,138,1,198,156,1,0,2,184,132,
+  4,115,58,108,101,110,103,116,104,0,0,138,8,70,179,124,
+  244,159,1,0,179,172,204,153,1,169,151,1,0,2,218,225,
+  2,99,104,111,111,115,101,0,0,156,8,80,199,1,244,159,
+  1,180,240,229,2,190,153,1,0,2,184,210,3,105,102,0,
+  0,172,8,78,179,124,244,159,1,193,128,158,92,225,146,1,
+  0,2,204,138,2,45,105,102,0,0,184,8,224,2,205,1,
+  0,0,0,193,172,177,182,13,0,6,115,105,103,105,108,58,
+  40,0,0,197,8,155,1,178,1,244,159,1,0,255,214,201,
+  130,9,248,147,1,0,2,176,154,2,67,111,109,112,105,108,
+  101,114,0,0,214,8,3,178,1,244,159,1,227,138,153,228,
+  7,137,148,1,0,2,151,165,2,72,101,97,112,0,0,232,
+  8,156,1,178,1,244,159,1,0,213,235,173,149,4,152,148,
+  1,0,2,141,168,2,76,97,115,116,67,97,108,108,0,0,
+  246,8,157,1,178,1,244,159,1,158,151,155,155,4,144,146,
+  1,0,2,160,169,2,84,97,105,108,67,97,108,108,115,0,
+  0,136,9,134,1,193,1,244,159,1,209,235,10,210,146,1,
+  0,2,177,136,2,44,0,0,155,9,150,1,193,1,244,159,
+  1,196,242,229,2,177,155,1,0,2,255,239,3,115,44,0,
+  0,166,9,170,1,205,1,244,159,1,224,235,10,254,146,1,
+  0,2,196,141,2,59,0,0,178,9,130,3,205,1,244,159,
+  1,128,236,10,179,148,1,0,2,175,176,2,91,0,0,189,
+  9,146,3,205,1,244,159,1,130,236,10,181,148,1,0,2,
+  194,176,2,93,0,0,200,9,2,178,1,244,159,1,219,206,
+  143,219,4,251,147,1,0,2,138,161,2,68,105,99,116,105,
+  111,110,97,114,121,0,0,211,9,206,1,193,1,244,159,1,
+  0,221,163,180,168,1,147,152,1,0,2,182,130,3,100,58,
+  108,105,110,107,0,0,231,9,207,1,158,59,244,159,1,143,
+  216,211,228,7,172,152,1,0,2,178,139,3,100,58,120,116,
+  0,0,247,9,209,1,158,59,244,159,1,0,141,208,200,191,
+  11,246,151,1,0,2,224,252,2,100,58,99,108,97,115,115,
+  0,0,133,10,223,1,158,59,244,159,1,0,183,201,172,168,
+  1,159,152,1,0,2,219,135,3,100,58,110,97,109,101,0,
+  0,150,10,193,1,193,1,244,159,1,209,170,242,161,1,196,
+  151,1,0,2,195,230,2,99,108,97,115,115,58,119,111,114,
+  100,0,0,166,10,205,1,193,1,244,159,1,0,241,129,237,
+  206,12,190,151,1,0,2,199,229,2,99,108,97,115,115,58,
+  109,97,99,114,111,0,0,186,10,178,1,193,1,244,159,1,
+  207,221,199,161,1,177,151,1,0,2,157,228,2,99,108,97,
+  115,115,58,100,97,116,97,0,0,207,10,227,1,193,1,244,
+  159,1,0,251,148,189,208,15,241,151,1,0,2,173,251,2,
+  100,58,97,100,100,45,104,101,97,100,101,114,0,0,227,10,
+  225,2,205,1,244,159,1,0,203,172,177,182,13,198,157,1,
+  0,2,203,156,4,115,105,103,105,108,58,35,0,0,249,10,
+  231,2,205,1,244,159,1,0,157,172,177,182,13,217,157,1,
+  0,2,174,159,4,115,105,103,105,108,58,58,0,0,138,11,
+  250,2,205,1,244,159,1,0,197,172,177,182,13,206,157,1,
+  0,2,139,157,4,115,105,103,105,108,58,38,0,0,155,11,
+  229,2,205,1,244,159,1,0,201,172,177,182,13,202,157,1,
+  0,2,230,156,4,115,105,103,105,108,58,36,0,0,172,11,
+  163,3,205,1,0,0,230,216,183,201,1,0,6,114,101,112,
+  101,97,116,0,0,189,11,165,3,205,1,244,159,1,165,221,
+  209,120,218,149,1,0,2,180,201,2,97,103,97,105,110,0,
+  0,205,11,210,3,193,1,244,159,1,130,228,236,149,1,206,
+  153,1,0,2,188,213,3,105,110,116,101,114,112,114,101,116,
+  0,0,220,11,155,2,193,1,244,159,1,189,220,130,209,3,
+  151,152,1,0,2,232,130,3,100,58,108,111,111,107,117,112,
+  0,0,239,11,199,1,193,1,244,159,1,142,243,198,164,6,
+  193,151,1,0,2,251,229,2,99,108,97,115,115,58,112,114,
+  105,109,105,116,105,118,101,0,0,129,12,4,178,1,244,159,
+  1,0,169,175,185,196,5,176,148,1,0,2,133,176,2,86,
+  101,114,115,105,111,110,0,0,154,12,129,4,193,1,244,159,
+  1,142,236,10,187,153,1,0,2,229,209,3,105,0,0,171,
+  12,134,1,193,1,244,159,1,137,236,10,238,151,1,0,2,
+  245,250,2,100,0,0,182,12,251,3,193,1,244,159,1,151,
+  236,10,148,155,1,0,2,211,237,3,114,0,0,193,12,162,
+  2,178,1,244,159,1,224,216,139,228,7,245,147,1,0,2,
+  227,153,2,66,97,115,101,0,0,204,12,96,193,1,244,159,
+  1,196,199,240,228,7,133,155,1,0,2,242,235,3,112,97,
+  99,107,0,0,218,12,82,193,1,244,159,1,135,228,192,134,
+  2,177,158,1,0,2,153,189,4,117,110,112,97,99,107,0,
+  0,232,12,211,1,193,1,244,159,1,212,224,224,211,4,168,
+  152,1,0,2,144,138,3,100,58,115,111,117,114,99,101,0,
+  0,248,12,213,1,193,1,244,159,1,0,177,239,198,168,1,
+  128,152,1,0,2,177,255,2,100,58,104,97,115,104,0,0,
+  138,13,215,1,193,1,244,159,1,0,141,172,153,173,11,166,
+  146,1,0,2,169,213,4,100,58,115,116,97,99,107,0,0,
+  154,13,217,1,193,1,244,159,1,218,196,139,134,2,170,146,
+  1,0,2,236,213,4,100,58,97,115,116,97,99,107,0,0,
+  171,13,219,1,193,1,244,159,1,255,218,178,227,2,174,146,
+  1,0,2,178,214,4,100,58,102,115,116,97,99,107,0,0,
+  189,13,221,1,193,1,244,159,1,0,215,158,212,190,11,178,
+  146,1,0,2,246,214,4,100,58,100,101,115,99,114,0,0,
+  207,13,9,178,1,244,159,1,173,130,236,232,6,132,152,1,
+  0,2,227,255,2,100,58,72,97,115,104,70,117,110,99,116,
+  105,111,110,0,0,224,13,10,178,1,244,159,1,132,207,193,
+  210,2,165,152,1,0,2,200,136,3,100,58,82,101,104,97,
+  115,104,70,117,110,99,116,105,111,110,0,0,248,13,182,3,
+  193,1,244,159,1,181,209,169,189,3,213,152,1,0,2,224,
+  150,3,101,114,114,58,110,111,116,102,111,117,110,100,0,0,
+  105,109,97,103,101,58,115,97,118,101,0,0,46,105,109,97,
+  103,101,0,0,116,101,0,0,95,115,101,116,116,105,110,103,
+  115,47,115,116,97,116,101,0,2,109,101,109,111,114,121,95,
+  114,101,103,105,111,110,46,95,85,115,101,115,95,97,95,100,
+  111,117,98,108,101,95,99,101,108,108,95,112,111,105,110,116,
+  101,114,95,102,111,114,95,116,104,101,95,97,100,100,114,101,
+  115,115,46,0,0,101,95,115,116,97,99,107,46,0,0,103,
+  46,0,0,114,44,95,108,105,107,101,95,96,99,97,115,101,
+  96,41,46,0,0,73,110,108,105,110,105,110,103,95,115,101,
+  99,116,105,111,110,95,111,102,95,114,101,116,114,111,46,102,
+  111,114,116,104,95,102,111,114,95,116,104,101,95,108,105,109,
+  105,116,115,46,0,0,96,84,82,85,69,96,46,0,0,69,
+  96,46,0,0,108,108,95,98,101,95,116,104,101,95,114,101,
+  115,116,95,111,102,95,116,104,101,95,111,114,105,103,105,110,
+  97,108,95,115,116,114,105,110,103,46,0,0,115,99,114,105,
+  98,101,96,95,105,110,95,105,109,97,103,101,115,95,98,117,
+  105,108,116,95,119,105,116,104,111,117,116,95,119,111,114,100,
+  95,109,101,116,97,100,97,116,97,46,0,16,146,14,205,16,
+  193,1,143,160,1,230,197,159,92,128,148,1,225,1,225,1,
+  170,162,2,69,79,77,0,0,1,0,5,15,10,192,16,224,
+  16,193,1,143,160,1,154,193,167,122,180,152,1,225,1,225,
+  1,189,140,3,100,101,112,116,104,0,0,1,0,1,15,10,
+  209,16,244,16,193,1,143,160,1,0,145,169,181,168,1,135,
+  152,1,225,1,225,1,178,128,3,100,58,108,97,115,116,0,
+  0,1,2,15,10,228,16,139,17,193,1,143,160,1,241,195,
+  233,238,5,144,152,1,225,1,225,1,239,129,3,100,58,108,
+  97,115,116,46,120,116,0,0,129,16,244,16,129,16,207,1,
+  15,10,248,16,167,17,193,1,143,160,1,0,201,197,254,66,
+  138,152,1,225,1,225,1,220,128,3,100,58,108,97,115,116,
+  46,99,108,97,115,115,0,0,129,16,244,16,129,16,209,1,
+  15,10,145,17,194,17,193,1,143,160,1,134,200,211,239,3,
+  141,152,1,225,1,225,1,166,129,3,100,58,108,97,115,116,
+  46,110,97,109,101,0,0,129,16,244,16,129,16,223,1,10,
+  173,17,216,17,193,1,143,160,1,146,163,144,240,3,151,155,
+  1,225,1,225,1,166,238,3,114,101,99,108,97,115,115,0,
+  0,129,16,244,16,129,16,209,1,16,10,199,17,241,17,193,
+  1,143,160,1,180,255,128,85,198,153,1,225,1,225,1,171,
+  211,3,105,109,109,101,100,105,97,116,101,0,0,1,205,1,
+  129,16,216,17,10,222,17,132,18,193,1,143,160,1,223,162,
+  214,228,7,176,152,1,225,1,225,1,226,139,3,100,97,116,
+  97,0,0,1,178,1,129,16,216,17,10,246,17,156,18,193,
+  1,143,160,1,0,195,167,244,152,9,143,155,1,225,1,225,
+  1,212,236,3,112,114,105,109,105,116,105,118,101,0,0,1,
+  199,1,129,16,216,17,10,137,18,175,18,205,1,143,160,1,
+  214,251,223,228,7,185,153,1,225,1,225,1,129,209,3,104,
+  111,111,107,0,0,1,129,14,129,16,134,1,1,3,15,1,
+  1,17,129,16,134,1,10,161,18,206,18,193,1,143,160,1,
+  175,146,254,111,175,157,1,225,1,225,1,222,154,4,115,101,
+  116,45,104,111,111,107,0,0,1,1,17,16,10,188,18,227,
+  18,193,1,143,160,1,153,152,176,134,2,174,158,1,225,1,
+  225,1,142,174,4,117,110,104,111,111,107,0,0,1,1,17,
+  2,1,1,17,4,16,10,211,18,248,18,205,1,143,160,1,
+  205,235,10,196,146,1,225,1,225,1,156,134,2,40,0,0,
+  10,237,18,132,19,205,1,143,160,1,206,235,10,198,146,1,
+  225,1,225,1,201,134,2,41,0,0,10,249,18,154,19,193,
+  1,143,160,1,0,221,197,196,216,6,208,151,1,225,1,225,
+  1,231,238,2,99,111,109,112,105,108,101,58,108,105,116,0,
+  0,1,1,129,16,134,1,129,16,134,1,10,133,19,183,19,
+  193,1,143,160,1,132,181,145,203,1,205,151,1,225,1,225,
+  1,162,238,2,99,111,109,112,105,108,101,58,106,117,109,112,
+  0,0,1,129,14,129,16,134,1,129,16,134,1,10,161,19,
+  212,19,193,1,143,160,1,164,221,128,203,1,202,151,1,225,
+  1,225,1,221,237,2,99,111,109,112,105,108,101,58,99,97,
+  108,108,0,0,1,129,16,129,16,134,1,129,16,134,1,10,
+  190,19,240,19,193,1,143,160,1,0,217,225,195,216,6,214,
+  151,1,225,1,225,1,202,240,2,99,111,109,112,105,108,101,
+  58,114,101,116,0,0,1,10,129,16,134,1,10,219,19,137,
+  20,193,1,143,160,1,0,179,206,202,223,14,216,151,1,225,
+  1,225,1,132,241,2,99,111,109,112,105,108,105,110,103,63,
+  0,0,1,155,1,15,10,245,19,158,20,205,1,143,160,1,
+  0,209,171,177,182,13,230,157,1,225,1,225,1,196,160,4,
+  115,105,103,105,108,58,96,0,0,129,16,185,2,129,16,134,
+  1,10,141,20,180,20,205,1,143,160,1,0,217,171,177,182,
+  13,224,157,1,225,1,225,1,245,159,4,115,105,103,105,108,
+  58,92,0,0,129,16,129,4,10,163,20,200,20,205,1,143,
+  160,1,0,213,171,177,182,13,227,157,1,225,1,225,1,157,
+  160,4,115,105,103,105,108,58,94,0,0,129,16,251,3,10,
+  183,20,217,20,193,1,143,160,1,169,167,223,228,7,180,153,
+  1,225,1,225,1,190,208,3,104,101,114,101,0,0,129,14,
+  185,44,1,3,15,10,203,20,240,20,205,1,0,0,0,145,
+  172,177,182,13,0,0,225,1,225,1,0,0,115,105,103,105,
+  108,58,64,0,0,129,16,155,2,129,16,207,1,15,129,16,
+  137,20,129,14,128,21,1,129,30,129,16,134,1,129,16,134,
+  1,10,1,249,20,129,14,134,21,15,10,1,132,21,129,16,
+  70,10,223,20,156,21,205,1,0,0,0,207,172,177,182,13,
+  0,0,225,1,225,1,0,0,115,105,103,105,108,58,33,0,
+  0,129,16,155,2,129,16,207,1,15,129,16,137,20,129,14,
+  172,21,1,129,32,129,16,134,1,129,16,134,1,10,1,165,
+  21,129,14,178,21,16,10,1,176,21,129,16,70,10,139,21,
+  201,21,193,1,143,160,1,151,199,203,170,2,250,151,1,225,
+  1,225,1,147,253,2,100,58,99,114,101,97,116,101,0,0,
+  129,14,203,21,1,178,1,1,0,0,129,16,227,1,129,16,
+  217,20,129,16,244,16,129,16,207,1,16,10,183,21,232,21,
+  193,1,143,160,1,137,207,181,132,1,227,158,1,225,1,225,
+  1,185,203,4,118,97,114,45,110,0,0,129,16,201,21,129,
+  16,134,1,10,217,21,250,21,193,1,143,160,1,206,235,162,
+  92,224,158,1,225,1,225,1,132,203,4,118,97,114,0,0,
+  129,136,132,64,0,0,232,21,10,237,21,141,22,193,1,143,
+  160,1,204,246,244,121,224,151,1,225,1,225,1,241,241,2,
+  99,111,110,115,116,0,0,129,16,201,21,129,16,244,16,129,
+  16,207,1,16,10,254,21,163,22,199,1,143,160,1,220,212,
+  250,228,7,167,158,1,225,1,225,1,208,173,4,116,117,99,
+  107,0,0,130,138,144,48,10,149,22,179,22,199,1,143,160,
+  1,129,226,239,228,7,254,154,1,225,1,225,1,218,235,3,
+  111,118,101,114,0,0,133,132,152,32,10,165,22,194,22,199,
+  1,143,160,1,204,169,162,92,236,154,1,225,1,225,1,184,
+  234,3,110,105,112,0,0,132,6,10,181,22,215,22,199,1,
+  143,160,1,147,250,227,137,1,194,152,1,225,1,225,1,226,
+  142,3,100,114,111,112,45,112,97,105,114,0,0,131,6,10,
+  196,22,231,22,199,1,143,160,1,205,168,133,228,7,128,147,
+  1,225,1,225,1,224,141,2,63,100,117,112,0,0,130,50,
+  10,217,22,251,22,158,59,143,160,1,0,241,254,196,56,205,
+  152,1,225,1,225,1,207,143,3,100,117,112,45,112,97,105,
+  114,0,0,133,132,152,32,133,132,152,32,10,233,22,139,23,
+  179,124,143,160,1,194,212,161,92,183,152,1,225,1,225,1,
+  230,140,3,100,105,112,0,0,132,138,32,6,10,254,22,155,
+  23,179,124,143,160,1,145,212,162,92,236,157,1,225,1,225,
+  1,246,160,4,115,105,112,0,0,133,132,152,32,1,27,129,
+  16,139,23,10,142,23,173,23,179,124,143,160,1,208,238,229,
+  2,252,149,1,225,1,225,1,154,206,2,98,105,0,0,1,
+  155,23,129,16,139,23,8,10,161,23,192,23,193,1,143,160,
+  1,250,194,161,92,130,150,1,225,1,225,1,213,206,2,98,
+  105,42,0,0,1,139,23,129,16,139,23,8,10,179,23,211,
+  23,193,1,143,160,1,144,195,161,92,137,150,1,225,1,225,
+  1,252,206,2,98,105,64,0,0,2,129,16,192,23,10,198,
+  23,228,23,193,1,143,160,1,244,222,162,92,144,158,1,225,
+  1,225,1,135,172,4,116,114,105,0,0,129,14,237,23,1,
+  155,23,129,16,139,23,129,16,155,23,10,1,230,23,129,16,
+  139,23,8,10,215,23,129,24,193,1,143,160,1,158,188,250,
+  228,7,151,158,1,225,1,225,1,226,172,4,116,114,105,42,
+  0,0,129,14,146,24,129,14,139,24,4,1,139,23,129,16,
+  139,23,10,1,133,24,129,16,139,23,129,16,139,23,10,1,
+  131,24,129,16,139,23,8,10,243,23,166,24,193,1,143,160,
+  1,180,188,250,228,7,160,158,1,225,1,225,1,150,173,4,
+  116,114,105,64,0,0,2,2,129,16,129,24,10,152,24,186,
+  24,193,1,143,160,1,254,240,140,133,1,253,158,1,225,1,
+  225,1,226,207,4,119,104,105,108,101,0,0,129,14,195,24,
+  130,138,32,134,136,100,3,1,188,24,7,10,1,188,24,8,
+  3,10,171,24,215,24,193,1,143,160,1,177,128,138,132,1,
+  184,158,1,225,1,225,1,197,195,4,117,110,116,105,108,0,
+  0,129,14,226,24,130,138,32,134,136,132,184,1,0,1,25,
+  3,1,217,24,7,10,1,217,24,8,3,10,200,24,248,24,
+  193,1,143,160,1,0,131,131,186,213,8,146,153,1,225,1,
+  225,1,209,203,3,102,111,114,101,118,101,114,0,0,129,14,
+  252,24,8,10,1,250,24,129,16,155,23,1,248,24,7,10,
+  231,24,147,25,179,124,143,160,1,135,151,182,131,1,140,158,
+  1,225,1,225,1,208,171,4,116,105,109,101,115,0,0,129,
+  14,159,25,4,25,129,164,148,16,1,133,16,134,12,1,150,
+  25,7,10,1,149,25,8,3,10,132,25,181,25,205,1,143,
+  160,1,0,153,171,177,182,13,233,157,1,225,1,225,1,225,
+  160,4,115,105,103,105,108,58,124,0,0,129,16,155,2,129,
+  14,189,25,129,16,207,1,15,10,1,185,25,129,14,197,25,
+  129,16,209,1,15,10,1,193,25,129,16,173,23,129,16,137,
+  20,129,14,212,25,1,178,1,129,16,139,23,129,16,212,19,
+  10,1,205,25,1,27,129,16,70,10,164,25,233,25,193,1,
+  143,160,1,229,142,178,228,7,167,148,1,225,1,225,1,209,
+  173,2,84,82,85,69,0,0,1,0,1,10,219,25,251,25,
+  193,1,143,160,1,208,204,218,104,131,148,1,225,1,225,1,
+  225,162,2,70,65,76,83,69,0,0,1,0,0,10,236,25,
+  140,26,193,1,143,160,1,225,137,212,228,7,143,151,1,225,
+  1,225,1,197,223,2,99,97,115,101,0,0,129,14,145,26,
+  133,132,152,32,11,10,1,142,26,129,16,139,23,4,129,14,
+  157,26,132,6,8,129,16,233,25,10,1,152,26,129,14,165,
+  26,3,129,16,251,25,10,1,161,26,129,16,70,25,6,3,
+  3,10,254,25,190,26,193,1,143,160,1,174,143,199,195,1,
+  208,155,1,225,1,225,1,240,244,3,115,58,99,97,115,101,
+  0,0,129,14,196,26,133,132,152,32,129,16,122,10,1,192,
+  26,129,16,139,23,4,129,14,208,26,132,6,8,129,16,233,
+  25,10,1,203,26,129,14,216,26,3,129,16,251,25,10,1,
+  212,26,129,16,70,25,6,3,3,10,174,26,238,26,158,59,
+  143,160,1,150,171,162,92,243,154,1,225,1,225,1,242,234,
+  3,110,111,116,0,0,1,0,1,23,10,225,26,129,27,193,
+  1,143,160,1,250,221,138,127,231,153,1,225,1,225,1,132,
+  222,3,108,116,101,113,63,0,0,129,16,251,22,139,138,180,
+  48,22,10,242,26,149,27,193,1,143,160,1,245,232,160,124,
+  157,153,1,225,1,225,1,138,205,3,103,116,101,113,63,0,
+  0,4,129,16,129,27,10,134,27,168,27,193,1,143,160,1,
+  211,203,154,127,245,153,1,225,1,225,1,197,223,3,110,58,
+  77,65,88,0,0,1,0,9,15,10,153,27,187,27,193,1,
+  143,160,1,209,205,154,127,248,153,1,225,1,225,1,247,223,
+  3,110,58,77,73,78,0,0,1,0,7,15,10,172,27,208,
+  27,193,1,143,160,1,0,231,191,176,137,11,232,154,1,225,
+  1,225,1,129,234,3,110,58,122,101,114,111,63,0,0,1,
+  0,0,11,10,191,27,230,27,193,1,143,160,1,0,141,200,
+  130,216,3,241,153,1,225,1,225,1,138,223,3,110,58,45,
+  122,101,114,111,63,0,0,1,0,0,12,10,212,27,255,27,
+  193,1,143,160,1,159,189,222,211,4,191,154,1,225,1,225,
+  1,139,230,3,110,58,110,101,103,97,116,105,118,101,63,0,
+  0,1,0,0,13,10,234,27,152,28,193,1,143,160,1,255,
+  222,155,227,1,199,154,1,225,1,225,1,246,230,3,110,58,
+  112,111,115,105,116,105,118,101,63,0,0,1,0,1,14,10,
+  131,28,186,28,193,1,143,160,1,0,171,252,233,163,13,219,
+  154,1,225,1,225,1,185,232,3,110,58,115,116,114,105,99,
+  116,108,121,45,112,111,115,105,116,105,118,101,63,0,0,1,
+  0,0,14,10,156,28,207,28,193,1,143,160,1,0,139,222,
+  199,160,11,153,154,1,225,1,225,1,148,227,3,110,58,101,
+  118,101,110,63,0,0,1,2,20,3,129,16,208,27,10,190,
+  28,230,28,193,1,143,160,1,195,183,186,102,195,154,1,225,
+  1,225,1,195,230,3,110,58,111,100,100,63,0,0,129,16,
+  207,28,129,16,238,26,10,214,28,248,28,193,1,143,160,1,
+  239,253,161,92,194,153,1,225,1,225,1,225,210,3,105,102,
+  59,0,0,133,132,152,32,1,80,129,16,139,23,25,6,131,
+  6,10,235,28,143,29,193,1,143,160,1,156,145,222,227,7,
+  229,146,1,225,1,225,1,250,138,2,45,105,102,59,0,0,
+  133,132,152,32,1,78,129,16,139,23,129,16,238,26,25,6,
+  131,6,10,129,29,167,29,199,1,143,160,1,154,205,162,92,
+  169,155,1,225,1,225,1,226,239,3,114,111,116,0,0,133,
+  136,152,32,10,154,29,184,29,193,1,143,160,1,195,129,157,
+  127,203,154,1,225,1,225,1,174,231,3,110,58,112,111,119,
+  0,0,1,1,4,129,14,192,29,133,132,152,32,19,10,1,
+  189,29,129,16,147,25,132,6,10,169,29,216,29,193,1,143,
+  160,1,129,155,143,197,7,187,154,1,225,1,225,1,238,229,
+  3,110,58,110,101,103,97,116,101,0,0,1,0,1,19,10,
+  198,29,238,29,193,1,143,160,1,0,131,209,140,173,15,215,
+  154,1,225,1,225,1,154,232,3,110,58,115,113,117,97,114,
+  101,0,0,130,38,10,220,29,128,30,193,1,143,160,1,151,
+  141,196,102,211,154,1,225,1,225,1,246,231,3,110,58,115,
+  113,114,116,0,0,1,1,129,14,146,30,129,16,251,22,148,
+  136,12,133,132,152,32,18,1,2,148,136,12,25,17,1,132,
+  30,7,10,1,132,30,8,132,6,10,240,29,166,30,193,1,
+  143,160,1,177,230,156,127,172,154,1,225,1,225,1,244,228,
+  3,110,58,109,105,110,0,0,129,16,251,22,13,129,14,173,
+  30,3,10,1,171,30,129,14,179,30,132,6,10,1,177,30,
+  129,16,70,10,151,30,199,30,193,1,143,160,1,179,228,156,
+  127,167,154,1,225,1,225,1,210,228,3,110,58,109,97,120,
+  0,0,129,16,251,22,14,129,14,206,30,3,10,1,204,30,
+  129,14,212,30,132,6,10,1,210,30,129,16,70,10,184,30,
+  232,30,193,1,143,160,1,195,254,155,127,251,153,1,225,1,
+  225,1,169,224,3,110,58,97,98,115,0,0,2,129,16,255,
+  27,1,216,29,9,10,217,30,128,31,193,1,143,160,1,0,
+  167,173,138,153,11,161,154,1,225,1,225,1,220,227,3,110,
+  58,108,105,109,105,116,0,0,4,5,129,16,166,30,6,129,
+  16,199,30,10,239,30,151,31,158,59,143,160,1,199,197,156,
+  127,157,154,1,225,1,225,1,200,227,3,110,58,105,110,99,
+  0,0,129,162,40,1,10,136,31,169,31,158,59,143,160,1,
+  217,152,156,127,138,154,1,225,1,225,1,244,225,3,110,58,
+  100,101,99,0,0,129,164,40,1,10,154,31,192,31,193,1,
+  143,160,1,182,238,192,236,3,132,154,1,225,1,225,1,248,
+  224,3,110,58,98,101,116,119,101,101,110,63,0,0,133,136,
+  152,32,129,14,200,31,133,136,152,32,133,136,152,32,129,16,
+  128,31,10,1,195,31,129,16,155,23,11,10,172,31,226,31,
+  193,1,143,160,1,0,137,214,246,36,184,157,1,225,1,225,
+  1,251,155,4,115,104,105,102,116,45,108,101,102,116,0,0,
+  129,16,216,29,24,10,206,31,251,31,193,1,143,160,1,0,
+  227,249,213,187,9,189,157,1,225,1,225,1,147,156,4,115,
+  104,105,102,116,45,114,105,103,104,116,0,0,24,10,230,31,
+  144,32,193,1,143,160,1,0,137,237,161,240,15,161,148,1,
+  225,1,225,1,222,172,2,83,99,111,112,101,76,105,115,116,
+  0,0,228,252,4,229,129,5,10,253,31,159,32,193,1,143,
+  160,1,155,245,229,2,139,159,1,225,1,225,1,175,210,4,
+  123,123,0,0,129,16,244,16,2,1,144,32,129,16,65,16,
+  10,147,32,190,32,193,1,143,160,1,0,155,205,150,160,12,
+  218,146,1,225,1,225,1,175,137,2,45,45,45,114,101,118,
+  101,97,108,45,45,45,0,0,129,16,244,16,1,144,32,129,
+  16,151,31,16,10,168,32,210,32,193,1,143,160,1,223,245,
+  229,2,144,159,1,225,1,225,1,141,211,4,125,125,0,0,
+  1,144,32,129,16,62,4,15,11,129,14,224,32,129,30,144,
+  32,129,32,2,10,1,219,32,129,14,250,32,129,30,144,32,
+  129,14,245,32,1,2,143,132,60,1,144,32,129,16,151,31,
+  143,152,100,3,1,234,32,7,10,1,232,32,8,16,10,1,
+  228,32,129,16,70,10,198,32,141,33,193,1,0,4,225,1,
+  225,1,0,0,66,121,116,101,0,0,10,255,32,161,33,193,
+  1,0,4,225,1,225,1,0,0,98,121,116,101,45,109,97,
+  115,107,0,0,1,255,1,4,1,8,19,2,129,14,175,33,
+  129,16,216,29,24,21,10,1,170,33,129,16,139,23,24,10,
+  142,33,198,33,193,1,0,4,225,1,225,1,0,0,114,101,
+  112,108,97,99,101,0,0,1,0,0,129,14,227,33,129,14,
+  222,33,129,14,217,33,129,14,212,33,3,129,30,141,33,10,
+  1,208,33,129,16,139,23,10,1,206,33,129,16,139,23,10,
+  1,204,33,129,16,139,23,10,1,202,33,129,16,140,26,1,
+  1,129,14,253,33,129,14,248,33,129,14,243,33,3,129,30,
+  141,33,10,1,239,33,129,16,139,23,10,1,237,33,129,16,
+  139,23,10,1,235,33,129,16,140,26,1,2,129,14,144,34,
+  129,14,139,34,3,129,30,141,33,10,1,135,34,129,16,139,
+  23,10,1,133,34,129,16,140,26,1,3,129,14,156,34,3,
+  129,30,141,33,10,1,152,34,129,16,140,26,3,10,198,32,
+  189,34,193,1,143,160,1,184,132,195,179,4,246,149,1,225,
+  1,225,1,196,205,2,98,58,116,111,45,98,121,116,101,45,
+  97,100,100,114,101,115,115,0,0,129,38,4,10,162,34,209,
+  34,193,1,143,160,1,139,232,148,82,228,149,1,225,1,225,
+  1,239,202,2,98,58,102,101,116,99,104,0,0,129,168,16,
+  4,129,168,132,64,4,167,29,145,158,16,129,16,161,33,10,
+  192,34,235,34,193,1,143,160,1,238,177,226,89,237,149,1,
+  225,1,225,1,166,204,2,98,58,115,116,111,114,101,0,0,
+  132,130,64,141,33,129,168,16,4,129,14,244,34,130,158,132,
+  64,82,10,1,241,34,129,16,139,23,129,16,198,33,129,16,
+  96,4,16,10,218,34,144,35,193,1,143,160,1,0,221,253,
+  234,253,4,162,153,1,225,1,225,1,231,205,3,104,58,102,
+  101,116,99,104,0,0,1,209,34,129,14,156,35,129,16,151,
+  31,129,16,209,34,1,0,15,24,10,1,148,35,129,16,173,
+  23,22,10,255,34,179,35,193,1,143,160,1,0,151,234,207,
+  238,4,171,153,1,225,1,225,1,159,207,3,104,58,115,116,
+  111,114,101,0,0,129,16,251,22,133,130,212,48,255,1,129,
+  16,235,34,129,16,151,31,133,130,224,8,8,255,1,149,140,
+  132,56,235,34,10,162,35,210,35,193,1,143,160,1,224,223,
+  176,214,5,235,158,1,225,1,225,1,161,204,4,119,58,102,
+  101,116,99,104,0,0,1,4,148,136,12,15,10,193,35,232,
+  35,193,1,143,160,1,195,169,254,221,5,244,158,1,225,1,
+  225,1,142,206,4,119,58,115,116,111,114,101,0,0,1,4,
+  148,136,12,16,10,215,35,131,36,193,1,143,160,1,0,231,
+  152,244,212,10,239,158,1,225,1,225,1,181,205,4,119,58,
+  102,101,116,99,104,45,110,101,120,116,0,0,2,1,4,17,
+  4,129,16,210,35,10,237,35,161,36,193,1,143,160,1,0,
+  197,251,135,185,6,166,153,1,225,1,225,1,198,206,3,104,
+  58,102,101,116,99,104,45,110,101,120,116,0,0,2,1,2,
+  17,4,129,16,144,35,10,139,36,191,36,193,1,143,160,1,
+  0,209,188,169,148,11,232,149,1,225,1,225,1,205,203,2,
+  98,58,102,101,116,99,104,45,110,101,120,116,0,0,2,1,
+  1,17,4,129,16,209,34,10,169,36,221,36,193,1,143,160,
+  1,0,225,237,204,241,13,248,158,1,225,1,225,1,156,207,
+  4,119,58,115,116,111,114,101,45,110,101,120,116,0,0,2,
+  1,4,17,1,232,35,129,16,139,23,10,199,36,252,36,193,
+  1,143,160,1,0,191,208,224,213,9,175,153,1,225,1,225,
+  1,248,207,3,104,58,115,116,111,114,101,45,110,101,120,116,
+  0,0,2,1,2,17,1,179,35,129,16,139,23,10,230,36,
+  155,37,193,1,143,160,1,0,203,145,130,177,14,241,149,1,
+  225,1,225,1,254,204,2,98,58,115,116,111,114,101,45,110,
+  101,120,116,0,0,2,1,1,17,1,235,34,129,16,139,23,
+  10,133,37,182,37,193,1,143,160,1,0,145,172,188,133,6,
+  201,158,1,225,1,225,1,190,198,4,118,58,105,110,99,45,
+  98,121,0,0,130,138,188,136,1,134,160,40,10,164,37,203,
+  37,193,1,143,160,1,0,237,202,161,202,7,194,158,1,225,
+  1,225,1,184,197,4,118,58,100,101,99,45,98,121,0,0,
+  130,138,188,32,146,140,192,80,10,185,37,221,37,193,1,143,
+  160,1,207,205,223,131,1,198,158,1,225,1,225,1,132,198,
+  4,118,58,105,110,99,0,0,1,1,4,129,16,182,37,10,
+  206,37,242,37,193,1,143,160,1,225,160,223,131,1,191,158,
+  1,225,1,225,1,254,196,4,118,58,100,101,99,0,0,1,
+  1,4,129,16,203,37,10,227,37,137,38,193,1,143,160,1,
+  180,181,130,114,205,158,1,225,1,225,1,138,199,4,118,58,
+  108,105,109,105,116,0,0,133,138,136,120,134,12,129,16,128,
+  31,132,32,10,248,37,157,38,193,1,143,160,1,178,147,251,
+  228,7,213,158,1,225,1,225,1,206,200,4,118,58,111,110,
+  0,0,129,16,233,25,132,32,10,143,38,176,38,193,1,143,
+  160,1,208,254,223,131,1,210,158,1,225,1,225,1,185,200,
+  4,118,58,111,102,102,0,0,129,16,251,25,132,32,10,161,
+  38,195,38,193,1,143,160,1,161,184,221,120,220,149,1,225,
+  1,225,1,246,201,2,97,108,108,111,116,0,0,1,3,129,
+  16,182,37,10,180,38,220,38,193,1,143,160,1,225,222,183,
+  119,216,158,1,225,1,225,1,228,200,4,118,58,112,114,101,
+  115,101,114,118,101,0,0,132,132,188,40,1,27,129,16,139,
+  23,134,136,64,10,200,38,245,38,193,1,143,160,1,0,207,
+  154,160,195,2,220,158,1,225,1,225,1,231,201,4,118,58,
+  117,112,100,97,116,101,0,0,4,129,14,252,38,15,4,8,
+  10,1,248,38,129,16,155,23,16,10,227,38,144,39,193,1,
+  143,160,1,160,128,213,228,7,228,151,1,225,1,225,1,162,
+  242,2,99,111,112,121,0,0,129,14,153,39,133,132,132,136,
+  1,1,132,158,152,16,129,162,148,128,1,1,6,10,1,146,
+  39,129,16,147,25,131,6,10,130,39,176,39,178,1,0,4,
+  225,1,225,1,0,0,80,97,99,107,105,110,103,0,2,10,
+  159,39,192,39,178,1,0,4,225,1,225,1,0,0,67,101,
+  108,108,0,0,238,138,5,10,178,39,208,39,178,1,0,4,
+  225,1,225,1,0,0,83,108,111,116,0,0,3,10,194,39,
+  226,39,178,1,0,4,225,1,225,1,0,0,80,97,99,107,
+  101,100,0,0,129,134,4,10,210,39,245,39,178,1,0,4,
+  225,1,225,1,0,0,83,99,114,97,116,99,104,0,0,145,
+  20,10,228,39,132,40,193,1,0,4,225,1,225,1,0,0,
+  111,112,64,0,0,1,8,19,129,30,226,39,4,24,1,255,
+  1,21,10,247,39,158,40,193,1,0,4,225,1,225,1,0,
+  0,111,112,101,110,63,0,0,129,30,176,39,129,30,3,11,
+  129,30,192,39,15,129,30,226,39,11,21,10,143,40,189,40,
+  193,1,0,4,225,1,225,1,0,0,99,111,110,116,114,111,
+  108,63,0,0,2,1,25,11,4,129,14,200,40,1,6,14,
+  10,1,196,40,129,14,208,40,1,11,13,10,1,204,40,129,
+  16,173,23,21,22,10,171,40,230,40,193,1,0,4,225,1,
+  225,1,0,0,112,117,114,101,63,0,0,129,14,239,40,1,
+  11,1,14,129,16,192,31,10,1,232,40,129,14,250,40,1,
+  17,1,19,129,16,192,31,10,1,243,40,129,14,133,41,1,
+  21,1,24,129,16,192,31,10,1,254,40,129,16,228,23,22,
+  22,10,215,40,155,41,193,1,0,4,225,1,225,1,0,0,
+  99,111,117,110,116,0,0,1,0,0,4,129,14,172,41,25,
+  1,151,31,129,16,139,23,1,8,24,1,160,41,7,10,1,
+  160,41,8,10,140,41,191,41,193,1,0,4,225,1,225,1,
+  0,0,102,105,116,115,63,0,0,129,16,155,41,129,30,208,
+  39,17,1,5,13,10,176,41,219,41,193,1,0,4,225,1,
+  225,1,0,0,108,105,116,101,114,97,108,115,63,0,0,129,
+  30,208,39,1,2,13,129,14,229,41,129,16,251,25,10,1,
+  226,41,129,16,248,28,129,30,208,39,129,16,169,31,129,30,
+  208,39,1,2,18,129,14,250,41,129,16,132,40,1,1,11,
+  10,1,244,41,129,16,211,23,21,10,200,41,143,42,193,1,
+  0,4,225,1,225,1,0,0,102,114,101,115,104,0,0,129,
+  30,3,129,32,192,39,1,0,0,129,16,134,1,1,0,0,
+  129,32,208,39,1,0,0,129,32,226,39,10,128,42,173,42,
+  193,1,0,4,225,1,225,1,0,0,115,101,116,0,0,2,
+  129,32,226,39,129,30,192,39,16,10,160,42,193,42,193,1,
+  0,4,225,1,225,1,0,0,97,100,100,0,0,2,129,16,
+  208,27,129,14,200,42,3,10,1,198,42,129,16,248,28,2,
+  129,30,208,39,1,8,19,129,16,226,31,129,30,226,39,22,
+  129,16,173,42,1,208,39,129,16,221,37,2,1,1,11,129,
+  14,232,42,1,176,39,129,16,221,37,10,1,227,42,9,129,
+  16,189,40,129,14,244,42,1,4,129,32,208,39,10,1,239,
+  42,9,10,180,42,134,43,193,1,0,4,225,1,225,1,0,
+  0,102,111,108,100,0,0,1,128,20,22,129,32,245,39,129,
+  30,3,1,2,18,15,129,30,3,129,16,169,31,15,1,245,
+  39,8,129,30,3,1,2,18,16,1,3,129,16,242,37,129,
+  30,3,129,32,176,39,1,208,39,129,16,242,37,1,255,1,
+  129,30,208,39,1,8,19,129,16,226,31,129,16,238,26,129,
+  30,226,39,21,129,16,173,42,10,130,39,208,43,193,1,143,
+  160,1,0,177,132,227,223,14,211,151,1,225,1,225,1,179,
+  239,2,99,111,109,112,105,108,101,58,111,112,0,0,2,129,
+  16,208,27,129,14,216,43,129,16,134,1,10,1,213,43,129,
+  16,248,28,2,1,10,11,129,14,233,43,1,0,0,129,32,
+  176,39,129,16,134,1,10,1,226,43,129,16,248,28,2,129,
+  16,230,40,129,16,158,40,21,129,16,219,41,21,1,134,43,
+  129,16,248,28,129,16,158,40,133,132,152,32,129,16,191,41,
+  21,1,143,42,129,16,78,129,30,3,129,32,176,39,1,4,
+  129,14,150,44,2,1,255,1,21,129,16,193,42,1,8,24,
+  10,1,140,44,129,16,147,25,3,10,188,43,172,44,205,1,
+  143,160,1,230,216,183,201,1,162,155,1,225,1,225,1,164,
+  239,3,114,101,112,101,97,116,0,0,129,16,217,20,10,129,
+  14,181,44,15,129,16,208,43,10,1,177,44,129,14,192,44,
+  1,0,0,129,32,176,39,129,30,3,10,1,185,44,156,44,
+  211,44,205,1,143,160,1,0,145,172,177,182,13,220,157,1,
+  225,1,225,1,215,159,4,115,105,103,105,108,58,64,0,0,
+  129,16,155,2,129,16,207,1,15,129,16,137,20,129,14,227,
+  44,129,16,178,1,1,37,129,16,199,1,10,1,220,44,129,
+  14,233,44,15,10,1,231,44,129,16,70,10,194,44,255,44,
+  205,1,143,160,1,0,207,172,177,182,13,194,157,1,225,1,
+  225,1,172,156,4,115,105,103,105,108,58,33,0,0,129,16,
+  155,2,129,16,207,1,15,129,16,137,20,129,14,143,45,129,
+  16,178,1,1,39,129,16,199,1,10,1,136,45,129,14,149,
+  45,16,10,1,147,45,129,16,70,10,238,44,167,45,178,1,
+  0,4,225,1,225,1,0,0,79,112,115,0,2,10,154,45,
+  181,45,178,1,0,4,225,1,225,1,0,0,65,116,0,0,
+  189,238,1,10,169,45,198,45,178,1,0,4,225,1,225,1,
+  0,0,68,101,112,116,104,0,2,10,183,45,214,45,178,1,
+  0,4,225,1,225,1,0,0,76,97,115,116,0,0,10,10,
+  200,45,233,45,178,1,0,4,225,1,225,1,0,0,76,105,
+  116,101,114,97,108,0,0,146,226,1,10,216,45,249,45,178,
+  1,0,4,225,1,225,1,0,0,68,111,110,101,0,0,0,
+  1,10,235,45,137,46,178,1,0,4,225,1,225,1,0,0,
+  83,97,102,101,0,0,0,1,10,251,45,156,46,193,1,0,
+  4,225,1,225,1,0,0,110,101,120,116,45,111,112,0,0,
+  129,158,136,8,167,45,8,152,130,192,8,167,45,255,1,21,
+  10,139,46,180,46,193,1,0,4,225,1,225,1,0,0,117,
+  110,115,97,102,101,0,0,129,16,251,25,129,32,137,46,129,
+  16,233,25,129,32,249,45,10,164,46,203,46,193,1,0,4,
+  225,1,225,1,0,0,106,117,109,112,0,0,129,158,132,96,
+  214,45,1,1,180,46,129,16,248,28,129,158,132,120,233,45,
+  181,45,13,129,14,221,46,129,16,233,25,129,32,249,45,10,
+  1,216,46,129,16,248,28,129,158,132,128,1,233,45,181,45,
+  129,130,64,0,0,167,45,10,189,46,247,46,193,1,0,4,
+  225,1,225,1,0,0,99,104,101,99,107,0,0,1,1,129,
+  14,131,47,129,158,188,8,181,45,233,45,144,2,181,45,129,
+  16,221,37,10,1,251,46,129,16,140,26,1,5,129,14,144,
+  47,1,198,45,129,16,221,37,10,1,139,47,129,16,140,26,
+  1,6,129,14,163,47,1,198,45,129,16,242,37,129,30,198,
+  45,129,16,255,27,129,18,180,46,10,1,152,47,129,16,140,
+  26,129,2,7,203,46,129,16,140,26,1,10,129,14,193,47,
+  129,30,198,45,129,16,208,27,129,14,187,47,129,16,233,25,
+  129,32,249,45,10,129,2,182,47,180,46,129,16,70,10,1,
+  176,47,129,16,140,26,3,10,232,46,211,47,193,1,0,4,
+  225,1,225,1,0,0,111,112,0,0,2,129,16,208,27,129,
+  14,218,47,3,10,1,216,47,129,16,248,28,129,14,227,47,
+  129,16,247,46,10,1,224,47,129,16,155,23,129,32,214,45,
+  10,238,44,129,48,193,1,143,160,1,0,157,177,253,227,7,
+  147,146,1,225,1,225,1,176,232,4,101,120,105,116,115,45,
+  99,97,108,108,101,114,63,0,0,129,32,181,45,129,16,233,
+  25,129,32,137,46,129,16,251,25,129,160,132,8,249,45,0,
+  0,198,45,144,130,132,128,1,0,0,214,45,1,64,129,14,
+  202,48,129,30,249,45,129,14,197,48,129,158,132,120,181,45,
+  3,11,129,14,163,48,129,16,233,25,129,32,249,45,10,1,
+  158,48,129,16,248,28,129,158,188,8,181,45,167,45,144,2,
+  181,45,129,16,221,37,1,4,129,14,192,48,129,30,249,45,
+  129,14,187,48,129,16,156,46,129,16,211,47,10,1,182,48,
+  129,16,78,10,1,178,48,129,16,147,25,10,1,152,48,129,
+  16,78,10,1,148,48,129,16,147,25,129,158,132,120,249,45,
+  137,46,21,129,16,238,26,10,234,47,228,48,178,1,0,4,
+  225,1,225,1,0,0,115,116,97,114,116,0,2,10,213,48,
+  243,48,178,1,0,4,225,1,225,1,0,0,101,110,100,0,
+  2,10,230,48,136,49,193,1,0,4,225,1,225,1,0,0,
+  116,101,114,109,105,110,97,116,101,0,0,129,130,188,128,1,
+  0,0,243,48,10,234,47,162,49,193,1,143,160,1,199,249,
+  174,224,1,165,150,1,225,1,225,1,185,212,2,98,117,102,
+  102,101,114,58,115,116,97,114,116,0,0,129,30,228,48,10,
+  140,49,185,49,193,1,143,160,1,0,223,171,243,250,7,150,
+  150,1,225,1,225,1,170,210,2,98,117,102,102,101,114,58,
+  101,110,100,0,0,129,30,243,48,10,165,49,208,49,193,1,
+  143,160,1,0,251,244,243,250,7,145,150,1,225,1,225,1,
+  216,209,2,98,117,102,102,101,114,58,97,100,100,0,0,129,
+  158,192,8,243,48,243,48,129,16,221,37,129,16,136,49,10,
+  188,49,236,49,193,1,143,160,1,0,141,142,243,250,7,153,
+  150,1,225,1,225,1,228,210,2,98,117,102,102,101,114,58,
+  103,101,116,0,0,1,243,48,129,16,242,37,129,158,60,243,
+  48,129,16,136,49,10,216,49,139,50,193,1,143,160,1,168,
+  158,171,216,1,148,150,1,225,1,225,1,254,209,2,98,117,
+  102,102,101,114,58,101,109,112,116,121,0,0,129,158,132,128,
+  1,228,48,243,48,129,16,136,49,10,245,49,166,50,193,1,
+  143,160,1,0,215,182,161,215,6,162,150,1,225,1,225,1,
+  143,212,2,98,117,102,102,101,114,58,115,105,122,101,0,0,
+  129,158,132,120,243,48,228,48,18,10,145,50,191,50,193,1,
+  143,160,1,0,245,193,241,250,7,159,150,1,225,1,225,1,
+  231,211,2,98,117,102,102,101,114,58,115,101,116,0,0,129,
+  32,228,48,129,16,139,50,10,171,50,221,50,193,1,143,160,
+  1,0,181,155,209,154,9,156,150,1,225,1,225,1,147,211,
+  2,98,117,102,102,101,114,58,112,114,101,115,101,114,118,101,
+  0,0,129,158,132,120,228,48,243,48,129,14,233,50,1,27,
+  129,16,139,23,129,32,228,48,10,1,226,50,129,16,139,23,
+  129,32,243,48,10,196,50,147,51,193,1,0,0,167,129,135,
+  217,5,0,0,225,1,225,1,0,0,84,69,77,80,45,83,
+  84,82,73,78,71,45,68,69,70,65,85,76,84,45,67,79,
+  85,78,84,0,0,1,32,10,240,50,188,51,193,1,0,0,
+  0,231,230,184,210,8,0,0,225,1,225,1,0,0,84,69,
+  77,80,45,83,84,82,73,78,71,45,68,69,70,65,85,76,
+  84,45,67,65,80,65,67,73,84,89,0,0,1,128,4,10,
+  150,51,224,51,193,1,0,0,174,132,130,183,5,0,0,225,
+  1,225,1,0,0,83,84,82,73,78,71,45,84,69,82,77,
+  73,78,65,84,79,82,45,67,69,76,76,83,0,0,1,1,
+  10,191,51,134,52,193,1,0,0,0,145,234,236,195,1,0,
+  0,225,1,225,1,0,0,67,85,82,82,69,78,84,45,76,
+  73,78,69,45,83,84,82,73,78,71,45,67,79,85,78,84,
+  0,0,1,2,10,227,51,158,52,178,1,143,160,1,133,251,
+  176,190,4,173,148,1,225,1,225,1,195,174,2,84,101,109,
+  112,83,116,114,105,110,103,115,0,0,32,137,52,182,52,178,
+  1,143,160,1,152,188,196,222,6,170,148,1,225,1,225,1,
+  137,174,2,84,101,109,112,83,116,114,105,110,103,77,97,120,
+  0,0,128,4,159,52,200,52,193,1,143,160,1,0,225,147,
+  193,211,7,158,148,1,225,1,225,1,207,171,2,83,84,82,
+  73,78,71,83,0,0,129,16,205,16,129,158,132,120,158,52,
+  182,52,129,16,224,51,145,166,72,10,183,52,230,52,193,1,
+  143,160,1,0,239,197,224,131,13,159,146,1,225,1,225,1,
+  244,174,2,115,58,111,118,101,114,115,105,122,101,63,0,0,
+  129,16,108,129,30,182,52,129,16,169,31,14,10,209,52,130,
+  53,193,1,143,160,1,0,143,137,158,243,4,155,146,1,225,
+  1,225,1,189,175,2,115,58,116,114,117,110,99,97,116,101,
+  0,0,2,129,16,230,52,129,14,141,53,1,0,0,133,132,
+  152,32,129,158,196,128,1,182,52,10,129,18,135,53,10,238,
+  52,161,53,178,1,0,4,225,1,225,1,0,0,67,117,114,
+  114,101,110,116,0,0,2,10,144,53,182,53,193,1,0,4,
+  225,1,225,1,0,0,115,58,112,111,105,110,116,101,114,0,
+  0,129,158,132,120,161,53,182,52,129,16,224,51,145,38,129,
+  16,200,52,17,10,163,53,208,53,193,1,0,4,225,1,225,
+  1,0,0,115,58,110,101,120,116,0,0,1,161,53,129,16,
+  221,37,129,158,132,120,161,53,158,52,11,129,14,222,53,129,
+  130,64,0,0,161,53,10,129,18,218,53,10,238,52,241,53,
+  193,1,143,160,1,232,212,236,195,1,133,157,1,225,1,225,
+  1,139,141,4,115,58,116,101,109,112,0,0,129,16,130,53,
+  2,129,16,108,129,16,151,31,129,16,182,53,4,129,16,144,
+  39,129,16,182,53,129,16,208,53,10,225,53,147,54,193,1,
+  143,160,1,161,241,213,182,2,134,156,1,225,1,225,1,248,
+  251,3,115,58,101,109,112,116,121,0,0,129,16,182,53,129,
+  16,208,53,1,0,0,133,132,152,32,16,10,130,54,172,54,
+  193,1,143,160,1,137,238,234,195,1,236,156,1,225,1,225,
+  1,225,136,4,115,58,115,107,105,112,0,0,6,129,14,180,
+  54,130,130,196,32,1,143,130,48,0,0,10,1,175,54,129,
+  16,186,24,129,16,169,31,5,10,156,54,204,54,193,1,143,
+  160,1,247,243,216,195,1,189,156,1,225,1,225,1,162,131,
+  4,115,58,107,101,101,112,0,0,129,16,137,20,129,14,213,
+  54,1,172,54,129,16,212,19,10,129,18,208,54,129,16,217,
+  20,1,150,1,129,16,139,23,129,16,178,1,10,188,54,241,
+  54,205,1,0,0,0,195,172,177,182,13,0,0,225,1,225,
+  1,0,0,115,105,103,105,108,58,39,0,0,129,16,137,20,
+  129,2,204,54,241,53,129,16,70,10,224,54,137,55,178,1,
+  0,4,225,1,225,1,0,0,65,99,116,105,111,110,0,0,
+  187,58,249,54,151,55,178,1,0,4,225,1,225,1,0,0,
+  79,112,115,0,2,138,55,166,55,178,1,0,4,225,1,225,
+  1,0,0,68,111,110,101,0,0,0,1,152,55,181,55,178,
+  1,0,4,225,1,225,1,0,0,70,105,116,115,0,0,0,
+  1,167,55,196,55,178,1,0,4,225,1,225,1,0,0,84,
+  97,105,108,0,2,182,55,212,55,178,1,0,4,225,1,225,
+  1,0,0,68,101,112,116,104,0,2,197,55,227,55,178,1,
+  0,4,225,1,225,1,0,0,76,97,115,116,0,0,6,213,
+  55,245,55,178,1,0,4,225,1,225,1,0,0,76,105,116,
+  101,114,97,108,0,0,1,228,55,135,56,193,1,0,4,225,
+  1,225,1,0,0,110,101,120,116,45,111,112,0,0,129,158,
+  136,8,151,55,8,152,130,192,8,151,55,255,1,21,10,246,
+  55,157,56,193,1,0,4,225,1,225,1,0,0,119,97,108,
+  107,0,0,129,32,137,55,129,16,251,25,129,32,166,55,129,
+  14,217,56,129,16,62,129,160,4,151,55,4,129,14,205,56,
+  129,30,166,55,129,14,200,56,129,16,135,56,130,130,44,10,
+  129,14,188,56,3,129,16,233,25,129,32,166,55,10,1,182,
+  56,129,14,195,56,129,158,32,137,55,10,1,192,56,129,16,
+  70,10,1,176,56,129,16,78,10,1,172,56,129,16,147,25,
+  129,30,166,55,129,16,238,26,25,131,130,28,165,56,10,129,
+  16,165,56,3,10,143,56,235,56,193,1,0,4,225,1,225,
+  1,0,0,102,97,105,108,0,0,129,16,251,25,129,32,181,
+  55,129,16,233,25,129,32,166,55,10,221,56,132,57,193,1,
+  0,4,225,1,225,1,0,0,101,120,105,116,115,63,0,0,
+  129,30,245,55,129,14,139,57,129,22,172,54,10,1,136,57,
+  129,14,146,57,129,16,129,48,10,1,143,57,129,16,173,23,
+  22,10,244,56,167,57,193,1,0,4,225,1,225,1,0,0,
+  99,104,101,99,107,0,0,2,129,16,208,27,129,14,174,57,
+  3,10,1,172,57,129,16,248,28,129,30,196,55,129,14,186,
+  57,3,129,16,235,56,10,1,182,57,129,16,248,28,130,130,
+  44,1,129,14,206,57,129,14,201,57,129,16,62,129,32,245,
+  55,10,1,196,57,129,16,139,23,10,129,18,194,57,129,30,
+  227,55,133,132,152,32,129,160,144,8,227,55,5,129,14,221,
+  57,131,2,212,55,129,16,221,37,10,1,216,57,129,16,140,
+  26,1,6,129,14,240,57,131,2,212,55,129,16,242,37,129,
+  30,212,55,129,16,255,27,129,18,235,56,10,1,229,57,129,
+  16,140,26,1,7,129,14,135,58,129,22,1,129,14,129,58,
+  129,16,233,25,129,32,196,55,10,129,2,252,57,235,56,129,
+  16,70,10,1,248,57,129,16,140,26,1,8,129,14,155,58,
+  129,22,1,129,14,152,58,129,16,132,57,129,18,235,56,10,
+  129,18,147,58,10,1,143,58,129,16,140,26,1,25,129,14,
+  167,58,3,129,16,235,56,10,1,163,58,129,16,140,26,131,
+  6,10,152,57,187,58,193,1,0,4,225,1,225,1,0,0,
+  99,111,112,121,0,0,1,0,0,129,14,192,58,10,1,191,
+  58,129,16,140,26,1,7,129,14,205,58,1,8,129,16,208,
+  43,10,1,200,58,129,16,140,26,2,129,16,208,43,129,22,
+  1,129,14,221,58,129,16,62,129,16,134,1,10,129,18,216,
+  58,10,173,58,244,58,193,1,0,4,225,1,225,1,0,0,
+  105,110,108,105,110,97,98,108,101,63,0,0,129,16,233,25,
+  129,32,181,55,129,16,251,25,129,160,132,8,196,55,0,0,
+  212,55,144,130,132,128,1,0,0,227,55,1,167,57,129,16,
+  157,56,129,30,181,55,10,224,54,158,59,193,1,143,160,1,
+  0,215,168,178,176,1,187,151,1,225,1,225,1,192,228,2,
+  99,108,97,115,115,58,105,110,108,105,110,101,0,0,129,16,
+  137,20,129,14,167,59,1,187,58,129,16,157,56,10,129,2,
+  162,59,27,129,16,70,10,136,59,189,59,193,1,143,160,1,
+  228,248,192,38,204,153,1,225,1,225,1,131,231,4,105,110,
+  108,105,110,101,0,0,129,16,139,17,129,16,244,58,129,14,
+  200,59,1,158,59,129,16,216,17,10,129,18,195,59,10,129,
+  14,227,59,129,16,155,2,2,129,16,207,1,15,129,16,244,
+  58,129,14,221,59,129,8,158,59,129,16,209,1,16,10,129,
+  2,215,59,17,129,16,70,10,1,205,59,173,59,246,59,193,
+  1,143,160,1,220,249,140,183,2,151,156,1,225,1,225,1,
+  208,253,3,115,58,102,101,116,99,104,0,0,145,30,10,229,
+  59,137,60,193,1,143,160,1,191,195,218,190,2,250,156,1,
+  225,1,225,1,201,139,4,115,58,115,116,111,114,101,0,0,
+  145,32,10,248,59,155,60,193,1,143,160,1,252,201,199,195,
+  1,222,155,1,225,1,225,1,133,246,3,115,58,99,104,111,
+  112,0,0,129,16,241,53,2,129,16,108,133,132,152,32,145,
+  130,200,8,1,0,0,132,32,10,139,60,185,60,193,1,143,
+  160,1,238,128,153,68,227,156,1,225,1,225,1,201,135,4,
+  115,58,114,101,118,101,114,115,101,0,0,129,14,225,60,2,
+  129,16,241,53,129,16,191,50,1,108,129,14,202,60,2,129,
+  16,108,145,130,72,1,10,1,196,60,129,16,173,23,4,129,
+  14,215,60,130,30,129,16,208,49,129,36,1,10,1,209,60,
+  129,16,147,25,3,129,16,162,49,129,16,241,53,10,1,187,
+  60,129,16,221,50,10,166,60,249,60,193,1,143,160,1,0,
+  255,228,199,196,14,207,156,1,225,1,225,1,167,134,4,115,
+  58,112,114,101,112,101,110,100,0,0,129,16,241,53,129,14,
+  162,61,133,132,152,32,133,132,152,32,1,108,129,16,211,23,
+  145,130,188,112,182,52,1,215,22,129,14,157,61,2,129,16,
+  108,17,129,14,149,61,2,129,16,108,129,34,1,10,1,143,
+  61,129,16,139,23,4,129,16,144,39,10,1,137,61,129,16,
+  70,10,1,253,60,129,16,155,23,10,230,60,185,61,193,1,
+  143,160,1,0,171,180,208,121,198,155,1,225,1,225,1,130,
+  244,3,115,58,97,112,112,101,110,100,0,0,4,129,16,249,
+  60,10,167,61,209,61,193,1,143,160,1,0,209,227,149,85,
+  161,156,1,225,1,225,1,181,255,3,115,58,102,111,114,45,
+  101,97,99,104,0,0,129,14,223,61,133,132,152,32,143,50,
+  3,133,132,152,32,133,132,152,32,133,138,148,120,134,16,134,
+  130,196,48,1,129,14,211,61,10,129,16,211,61,131,6,10,
+  189,61,249,61,193,1,143,160,1,215,177,174,53,179,156,1,
+  225,1,225,1,215,129,4,115,58,105,110,100,101,120,47,99,
+  104,97,114,0,0,4,129,14,141,62,130,130,196,32,1,143,
+  50,4,129,14,133,62,133,132,152,32,12,10,1,130,62,129,
+  16,139,23,132,50,131,130,28,252,61,10,1,252,61,129,14,
+  149,62,146,130,72,1,132,6,10,1,145,62,129,14,158,62,
+  129,16,108,133,132,152,32,11,10,1,153,62,129,16,228,23,
+  129,14,167,62,131,2,0,1,10,129,18,164,62,10,227,61,
+  196,62,193,1,143,160,1,0,197,228,217,142,4,230,155,1,
+  225,1,225,1,179,247,3,115,58,99,111,110,116,97,105,110,
+  115,47,99,104,97,114,63,0,0,129,16,249,61,129,24,0,
+  1,10,170,62,133,42,178,1,0,0,0,217,246,136,167,9,
+  0,0,225,1,225,1,0,0,72,65,83,72,58,68,74,66,
+  50,45,83,69,69,68,0,0,201,62,33,178,1,0,0,217,
+  141,150,223,2,0,0,225,1,225,1,0,0,72,65,83,72,
+  58,68,74,66,50,45,77,85,76,84,73,80,76,73,69,82,
+  0,0,225,62,143,63,193,1,143,160,1,150,139,210,195,1,
+  175,156,1,225,1,225,1,148,129,4,115,58,104,97,115,104,
+  0,0,129,8,133,42,129,14,150,63,132,130,204,136,1,33,
+  10,1,147,63,129,16,209,61,10,255,62,168,63,178,1,0,
+  4,225,1,225,1,0,0,83,116,114,0,2,155,63,186,63,
+  193,1,0,4,225,1,225,1,0,0,101,120,116,114,97,99,
+  116,0,0,133,132,152,32,133,132,152,32,129,158,16,168,63,
+  129,16,144,39,129,30,168,63,133,132,152,32,145,130,144,128,
+  1,0,0,10,169,63,213,63,193,1,0,4,225,1,225,1,
+  0,0,99,104,101,99,107,0,0,1,186,63,129,16,139,23,
+  129,14,224,63,1,151,31,129,16,139,23,10,1,219,63,129,
+  16,139,23,129,30,168,63,129,16,143,63,133,132,152,32,11,
+  10,198,63,253,63,193,1,0,4,225,1,225,1,0,0,108,
+  111,99,97,116,105,111,110,0,0,133,136,152,32,133,136,152,
+  32,129,14,156,64,129,14,151,64,4,129,14,139,64,133,132,
+  152,32,129,16,208,27,21,10,1,134,64,129,16,139,23,4,
+  129,14,148,64,132,134,8,10,129,18,146,64,10,1,131,64,
+  129,16,139,23,10,1,129,64,129,16,139,23,10,235,63,176,
+  64,193,1,0,4,225,1,225,1,0,0,115,101,116,117,112,
+  0,0,129,16,147,54,129,160,4,168,63,0,0,133,136,152,
+  32,133,136,152,32,129,2,108,143,63,129,16,173,23,129,14,
+  194,64,133,132,152,32,129,16,108,10,1,190,64,129,16,139,
+  23,4,10,255,62,224,64,193,1,143,160,1,0,159,170,175,
+  157,15,184,156,1,225,1,225,1,171,130,4,115,58,105,110,
+  100,101,120,47,115,116,114,105,110,103,0,0,133,132,152,32,
+  129,14,242,64,129,16,176,64,129,14,236,64,129,16,213,63,
+  129,16,253,63,10,1,231,64,129,16,147,25,131,134,12,10,
+  1,227,64,129,16,139,23,146,130,200,8,2,0,1,129,16,
+  199,30,10,200,64,137,65,178,1,0,4,225,1,225,1,0,
+  0,83,114,99,0,2,252,64,151,65,178,1,0,4,225,1,
+  225,1,0,0,84,97,114,0,2,138,65,165,65,178,1,0,
+  4,225,1,225,1,0,0,80,97,100,0,2,152,65,177,65,
+  178,1,0,4,225,1,225,1,0,0,73,0,2,166,65,189,
+  65,178,1,0,4,225,1,225,1,0,0,70,0,2,178,65,
+  202,65,178,1,0,4,225,1,225,1,0,0,65,116,0,2,
+  190,65,222,65,193,1,0,4,225,1,225,1,0,0,116,101,
+  114,109,105,110,97,116,101,0,0,129,130,188,8,0,0,165,
+  65,151,65,15,129,16,108,145,32,10,203,65,248,65,193,1,
+  0,4,225,1,225,1,0,0,101,120,116,114,97,99,116,0,
+  0,129,158,132,120,137,65,177,65,145,130,188,8,165,65,151,
+  65,15,129,16,108,129,16,144,39,10,231,65,149,66,193,1,
+  0,4,225,1,225,1,0,0,99,111,109,112,97,114,101,0,
+  0,129,158,132,120,165,65,151,65,129,16,122,129,158,216,8,
+  189,65,189,65,144,130,60,189,65,129,14,165,66,129,158,132,
+  128,1,177,65,202,65,10,1,161,66,129,16,78,10,132,66,
+  184,66,193,1,0,4,225,1,225,1,0,0,110,101,120,116,
+  0,0,1,177,65,129,16,221,37,10,200,64,217,66,193,1,
+  143,160,1,0,211,206,230,188,3,235,155,1,225,1,225,1,
+  129,248,3,115,58,99,111,110,116,97,105,110,115,47,115,116,
+  114,105,110,103,63,0,0,129,160,132,128,1,151,65,137,65,
+  129,16,147,54,129,160,132,8,165,65,0,0,177,65,144,130,
+  132,128,1,0,0,189,65,129,30,137,65,129,16,108,129,14,
+  244,66,129,16,248,65,129,16,222,65,129,16,149,66,129,16,
+  184,66,10,1,235,66,129,16,147,25,129,30,189,65,10,189,
+  66,141,67,193,1,143,160,1,184,191,188,28,156,156,1,225,
+  1,225,1,151,254,3,115,58,102,105,108,116,101,114,0,0,
+  133,132,152,32,129,16,230,52,129,14,151,67,1,130,53,129,
+  16,139,23,10,129,18,146,67,129,14,179,67,129,16,147,54,
+  129,16,191,50,4,129,14,171,67,133,132,152,32,133,132,152,
+  32,132,16,129,2,208,49,17,129,16,70,10,1,162,67,129,
+  16,209,61,3,129,16,162,49,10,1,155,67,129,16,221,50,
+  10,251,66,199,67,193,1,143,160,1,176,217,134,130,1,202,
+  156,1,225,1,225,1,132,133,4,115,58,109,97,112,0,0,
+  129,14,221,67,129,16,147,54,129,16,191,50,4,129,14,213,
+  67,133,132,152,32,8,129,16,208,49,10,1,208,67,129,16,
+  209,61,3,129,16,162,49,10,1,201,67,129,16,221,50,10,
+  184,67,244,67,193,1,143,160,1,213,175,215,149,2,255,156,
+  1,225,1,225,1,137,140,4,115,58,115,117,98,115,116,114,
+  0,0,129,14,250,67,17,129,16,147,54,10,1,246,67,129,
+  16,139,23,129,14,134,68,133,132,152,32,1,144,39,129,16,
+  139,23,10,1,128,68,129,16,155,23,133,132,152,32,129,14,
+  144,68,145,130,144,128,1,0,0,10,1,141,68,129,16,139,
+  23,10,226,67,166,68,193,1,143,160,1,208,187,249,189,2,
+  231,156,1,225,1,225,1,252,135,4,115,58,114,105,103,104,
+  116,0,0,133,132,152,32,129,16,108,133,132,152,32,146,8,
+  129,16,244,67,10,149,68,190,68,193,1,143,160,1,253,140,
+  219,195,1,193,156,1,225,1,225,1,232,131,4,115,58,108,
+  101,102,116,0,0,129,8,0,0,129,16,244,67,10,174,68,
+  219,68,193,1,143,160,1,0,219,134,129,222,1,203,155,1,
+  225,1,225,1,183,244,3,115,58,98,101,103,105,110,115,45,
+  119,105,116,104,63,0,0,2,129,16,108,1,19,129,16,139,
+  23,129,16,190,68,129,16,122,10,195,68,253,68,193,1,143,
+  160,1,0,247,247,190,218,15,137,156,1,225,1,225,1,144,
+  252,3,115,58,101,110,100,115,45,119,105,116,104,63,0,0,
+  2,129,16,108,1,19,129,16,139,23,129,16,166,68,129,16,
+  122,10,231,68,153,69,193,1,143,160,1,237,133,200,195,1,
+  240,155,1,225,1,225,1,217,248,3,115,58,99,111,112,121,
+  0,0,133,132,152,32,129,16,108,129,34,1,129,16,144,39,
+  10,137,69,179,69,193,1,143,160,1,0,147,228,194,225,9,
+  189,155,1,225,1,225,1,182,242,3,115,58,68,73,71,73,
+  84,83,0,0,129,16,172,54,48,49,50,51,52,53,54,55,
+  56,57,65,66,67,68,69,70,0,0,1,181,69,10,161,69,
+  228,69,193,1,143,160,1,0,165,236,136,194,11,183,155,1,
+  225,1,225,1,188,241,3,115,58,65,83,67,73,73,45,76,
+  79,87,69,82,67,65,83,69,0,0,129,16,172,54,97,98,
+  99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,
+  115,116,117,118,119,120,121,122,0,0,1,230,69,10,201,69,
+  159,70,193,1,143,160,1,0,223,217,183,165,14,186,155,1,
+  225,1,225,1,249,241,3,115,58,65,83,67,73,73,45,85,
+  80,80,69,82,67,65,83,69,0,0,129,16,172,54,65,66,
+  67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,
+  83,84,85,86,87,88,89,90,0,0,1,161,70,10,132,70,
+  216,70,193,1,143,160,1,0,233,138,224,199,9,180,155,1,
+  225,1,225,1,245,240,3,115,58,65,83,67,73,73,45,76,
+  69,84,84,69,82,83,0,0,129,16,172,54,97,98,99,100,
+  101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,
+  117,118,119,120,121,122,65,66,67,68,69,70,71,72,73,74,
+  75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,
+  0,0,1,218,70,10,191,70,169,71,193,1,143,160,1,0,
+  167,184,178,246,13,192,155,1,225,1,225,1,252,242,3,115,
+  58,80,85,78,67,84,85,65,84,73,79,78,0,0,129,16,
+  172,54,95,33,34,35,36,37,38,39,40,41,42,43,44,45,
+  46,47,58,59,60,61,62,63,64,91,92,93,94,96,123,124,
+  125,126,0,0,129,2,171,71,95,133,132,152,32,16,10,146,
+  71,232,71,178,1,143,160,1,0,129,229,140,137,1,195,155,
+  1,225,1,225,1,191,243,3,115,58,87,72,73,84,69,83,
+  80,65,67,69,0,0,32,9,10,13,0,0,210,71,248,71,
+  205,1,143,160,1,204,235,10,193,146,1,225,1,225,1,132,
+  134,2,39,0,0,1,147,54,129,16,193,1,10,237,71,136,
+  72,205,1,143,160,1,201,235,10,190,146,1,225,1,225,1,
+  238,133,2,36,0,0,1,0,0,129,16,178,1,10,253,71,
+  0,0,178,1,143,160,1,0,209,131,145,190,1,209,147,1,
+  225,1,225,1,206,149,2,65,83,67,73,73,58,78,85,76,
+  0,0,141,72,27,178,1,143,160,1,0,249,157,146,190,1,
+  182,147,1,225,1,225,1,221,146,2,65,83,67,73,73,58,
+  69,83,67,0,0,160,72,8,178,1,143,160,1,221,223,158,
+  121,146,147,1,225,1,225,1,241,142,2,65,83,67,73,73,
+  58,66,83,0,0,179,72,9,178,1,143,160,1,164,225,158,
+  121,200,147,1,225,1,225,1,211,148,2,65,83,67,73,73,
+  58,72,84,0,0,197,72,10,178,1,143,160,1,154,226,158,
+  121,203,147,1,225,1,225,1,252,148,2,65,83,67,73,73,
+  58,76,70,0,0,215,72,11,178,1,143,160,1,242,228,158,
+  121,239,147,1,225,1,225,1,232,152,2,65,83,67,73,73,
+  58,86,84,0,0,233,72,12,178,1,143,160,1,212,224,158,
+  121,191,147,1,225,1,225,1,216,147,2,65,83,67,73,73,
+  58,70,70,0,0,251,72,13,178,1,143,160,1,253,223,158,
+  121,152,147,1,225,1,225,1,195,143,2,65,83,67,73,73,
+  58,67,82,0,0,141,73,32,178,1,143,160,1,148,175,166,
+  155,7,224,147,1,225,1,225,1,155,151,2,65,83,67,73,
+  73,58,83,80,65,67,69,0,0,159,73,127,178,1,143,160,
+  1,0,133,182,146,190,1,167,147,1,225,1,225,1,144,145,
+  2,65,83,67,73,73,58,68,69,76,0,0,180,73,1,178,
+  1,143,160,1,0,219,177,144,190,1,221,147,1,225,1,225,
+  1,242,150,2,65,83,67,73,73,58,83,79,72,0,0,199,
+  73,2,178,1,143,160,1,0,241,174,144,190,1,227,147,1,
+  225,1,225,1,196,151,2,65,83,67,73,73,58,83,84,88,
+  0,0,218,73,3,178,1,143,160,1,0,141,157,146,190,1,
+  188,147,1,225,1,225,1,175,147,2,65,83,67,73,73,58,
+  69,84,88,0,0,237,73,4,178,1,143,160,1,0,223,159,
+  146,190,1,179,147,1,225,1,225,1,180,146,2,65,83,67,
+  73,73,58,69,79,84,0,0,128,74,5,178,1,143,160,1,
+  0,167,160,146,190,1,176,147,1,225,1,225,1,139,146,2,
+  65,83,67,73,73,58,69,78,81,0,0,147,74,6,178,1,
+  143,160,1,0,145,234,146,190,1,140,147,1,225,1,225,1,
+  159,142,2,65,83,67,73,73,58,65,67,75,0,0,166,74,
+  7,178,1,143,160,1,0,137,216,146,190,1,143,147,1,225,
+  1,225,1,200,142,2,65,83,67,73,73,58,66,69,76,0,
+  0,185,74,14,178,1,143,160,1,138,228,158,121,218,147,1,
+  225,1,225,1,201,150,2,65,83,67,73,73,58,83,79,0,
+  0,204,74,15,178,1,143,160,1,132,228,158,121,215,147,1,
+  225,1,225,1,160,150,2,65,83,67,73,73,58,83,73,0,
+  0,222,74,16,178,1,143,160,1,0,197,178,146,190,1,170,
+  147,1,225,1,225,1,185,145,2,65,83,67,73,73,58,68,
+  76,69,0,0,240,74,17,178,1,143,160,1,0,191,183,146,
+  190,1,155,147,1,225,1,225,1,236,143,2,65,83,67,73,
+  73,58,68,67,49,0,0,131,75,18,178,1,143,160,1,0,
+  189,183,146,190,1,158,147,1,225,1,225,1,149,144,2,65,
+  83,67,73,73,58,68,67,50,0,0,150,75,19,178,1,143,
+  160,1,0,187,183,146,190,1,161,147,1,225,1,225,1,190,
+  144,2,65,83,67,73,73,58,68,67,51,0,0,169,75,20,
+  178,1,143,160,1,0,185,183,146,190,1,164,147,1,225,1,
+  225,1,231,144,2,65,83,67,73,73,58,68,67,52,0,0,
+  188,75,21,178,1,143,160,1,0,251,141,145,190,1,206,147,
+  1,225,1,225,1,165,149,2,65,83,67,73,73,58,78,65,
+  75,0,0,207,75,22,178,1,143,160,1,0,187,172,144,190,
+  1,233,147,1,225,1,225,1,150,152,2,65,83,67,73,73,
+  58,83,89,78,0,0,226,75,23,178,1,143,160,1,0,185,
+  157,146,190,1,185,147,1,225,1,225,1,134,147,2,65,83,
+  67,73,73,58,69,84,66,0,0,245,75,24,178,1,143,160,
+  1,0,139,201,146,190,1,149,147,1,225,1,225,1,154,143,
+  2,65,83,67,73,73,58,67,65,78,0,0,136,76,25,178,
+  1,143,160,1,186,224,158,121,173,147,1,225,1,225,1,226,
+  145,2,65,83,67,73,73,58,69,77,0,0,155,76,26,178,
+  1,143,160,1,0,219,174,144,190,1,230,147,1,225,1,225,
+  1,237,151,2,65,83,67,73,73,58,83,85,66,0,0,173,
+  76,28,178,1,143,160,1,225,224,158,121,194,147,1,225,1,
+  225,1,129,148,2,65,83,67,73,73,58,70,83,0,0,192,
+  76,29,178,1,143,160,1,130,225,158,121,197,147,1,225,1,
+  225,1,170,148,2,65,83,67,73,73,58,71,83,0,0,210,
+  76,30,178,1,143,160,1,237,227,158,121,212,147,1,225,1,
+  225,1,247,149,2,65,83,67,73,73,58,82,83,0,0,228,
+  76,31,178,1,143,160,1,208,228,158,121,236,147,1,225,1,
+  225,1,191,152,2,65,83,67,73,73,58,85,83,0,0,246,
+  76,158,77,193,1,143,160,1,0,179,189,241,149,1,213,150,
+  1,225,1,225,1,141,218,2,99,58,108,111,119,101,114,99,
+  97,115,101,63,0,0,129,2,97,122,129,16,192,31,10,136,
+  77,186,77,193,1,143,160,1,169,147,194,205,1,240,150,1,
+  225,1,225,1,219,220,2,99,58,117,112,112,101,114,99,97,
+  115,101,63,0,0,129,2,65,90,129,16,192,31,10,164,77,
+  211,77,193,1,143,160,1,0,157,172,211,211,1,209,150,1,
+  225,1,225,1,205,217,2,99,58,108,101,116,116,101,114,63,
+  0,0,129,2,158,77,186,77,129,16,173,23,22,10,192,77,
+  236,77,193,1,143,160,1,242,170,146,214,3,202,150,1,225,
+  1,225,1,235,216,2,99,58,100,105,103,105,116,63,0,0,
+  129,2,48,57,129,16,192,31,10,218,77,134,78,193,1,143,
+  160,1,0,161,227,211,146,9,244,150,1,225,1,225,1,149,
+  221,2,99,58,118,105,115,105,98,108,101,63,0,0,129,2,
+  32,126,129,16,192,31,10,242,77,158,78,193,1,143,160,1,
+  206,239,218,169,6,248,150,1,225,1,225,1,207,221,2,99,
+  58,118,111,119,101,108,63,0,0,129,16,172,54,97,101,105,
+  111,117,65,69,73,79,85,0,0,129,8,160,78,129,16,196,
+  62,10,140,78,198,78,193,1,143,160,1,0,151,202,183,201,
+  9,198,150,1,225,1,225,1,175,216,2,99,58,99,111,110,
+  115,111,110,97,110,116,63,0,0,2,129,16,211,77,129,14,
+  208,78,129,16,158,78,129,46,0,1,10,1,203,78,129,14,
+  216,78,3,129,16,251,25,10,1,212,78,129,16,70,10,176,
+  78,244,78,193,1,143,160,1,142,136,248,129,2,252,150,1,
+  225,1,225,1,135,222,2,99,58,119,104,105,116,101,115,112,
+  97,99,101,63,0,0,129,8,232,71,129,16,196,62,10,221,
+  78,144,79,193,1,143,160,1,211,202,175,128,2,178,150,1,
+  225,1,225,1,249,213,2,99,58,45,108,111,119,101,114,99,
+  97,115,101,63,0,0,129,16,158,77,129,46,0,1,10,249,
+  78,172,79,193,1,143,160,1,214,188,234,152,4,182,150,1,
+  225,1,225,1,183,214,2,99,58,45,117,112,112,101,114,99,
+  97,115,101,63,0,0,129,16,186,77,129,46,0,1,10,149,
+  79,196,79,193,1,143,160,1,0,193,145,149,31,174,150,1,
+  225,1,225,1,181,213,2,99,58,45,100,105,103,105,116,63,
+  0,0,129,16,236,77,129,46,0,1,10,177,79,225,79,193,
+  1,143,160,1,219,220,170,183,7,194,150,1,225,1,225,1,
+  239,215,2,99,58,45,119,104,105,116,101,115,112,97,99,101,
+  63,0,0,129,16,244,78,129,46,0,1,10,201,79,251,79,
+  193,1,143,160,1,156,153,162,251,6,186,150,1,225,1,225,
+  1,245,214,2,99,58,45,118,105,115,105,98,108,101,63,0,
+  0,129,16,134,78,129,46,0,1,10,230,79,147,80,193,1,
+  143,160,1,251,251,253,195,2,190,150,1,225,1,225,1,179,
+  215,2,99,58,45,118,111,119,101,108,63,0,0,129,16,158,
+  78,129,46,0,1,10,128,80,175,80,193,1,143,160,1,0,
+  189,247,230,178,4,170,150,1,225,1,225,1,245,212,2,99,
+  58,45,99,111,110,115,111,110,97,110,116,63,0,0,129,16,
+  198,78,129,46,0,1,10,152,80,200,80,193,1,143,160,1,
+  254,164,156,78,232,150,1,225,1,225,1,255,219,2,99,58,
+  116,111,45,117,112,112,101,114,0,0,2,129,16,158,77,25,
+  131,130,72,32,10,180,80,227,80,193,1,143,160,1,219,142,
+  143,73,220,150,1,225,1,225,1,237,218,2,99,58,116,111,
+  45,108,111,119,101,114,0,0,2,129,16,186,77,25,131,130,
+  68,32,10,207,80,255,80,193,1,143,160,1,169,185,162,242,
+  3,228,150,1,225,1,225,1,222,219,2,99,58,116,111,45,
+  115,116,114,105,110,103,0,0,129,16,172,54,46,0,0,1,
+  129,81,129,16,241,53,1,39,129,16,155,23,10,234,80,163,
+  81,193,1,143,160,1,0,165,241,213,230,8,236,150,1,225,
+  1,225,1,170,220,2,99,58,116,111,103,103,108,101,45,99,
+  97,115,101,0,0,2,129,16,158,77,129,2,200,80,227,80,
+  129,16,70,10,140,81,193,81,193,1,143,160,1,187,154,184,
+  149,3,224,150,1,225,1,225,1,152,219,2,99,58,116,111,
+  45,110,117,109,98,101,114,0,0,2,129,16,236,77,129,14,
+  201,81,129,36,48,10,1,198,81,129,14,208,81,131,2,0,
+  0,10,1,205,81,129,16,70,10,172,81,233,81,193,1,143,
+  160,1,142,201,192,211,4,145,157,1,225,1,225,1,212,142,
+  4,115,58,116,111,45,117,112,112,101,114,0,0,1,200,80,
+  129,16,199,67,10,213,81,130,82,193,1,143,160,1,235,178,
+  179,206,4,137,157,1,225,1,225,1,249,141,4,115,58,116,
+  111,45,108,111,119,101,114,0,0,1,227,80,129,16,199,67,
+  10,238,81,156,82,193,1,143,160,1,198,161,226,131,5,163,
+  157,1,225,1,225,1,247,145,4,115,58,116,114,105,109,45,
+  108,101,102,116,0,0,129,16,241,53,129,14,169,82,130,130,
+  196,32,1,143,130,4,244,78,230,27,129,16,173,23,21,10,
+  1,160,82,129,16,186,24,129,36,1,10,135,82,198,82,193,
+  1,143,160,1,185,226,229,255,5,167,157,1,225,1,225,1,
+  158,146,4,115,58,116,114,105,109,45,114,105,103,104,116,0,
+  0,129,16,241,53,129,16,185,60,129,16,156,82,129,16,185,
+  60,10,176,82,223,82,193,1,143,160,1,174,194,237,195,1,
+  159,157,1,225,1,225,1,195,145,4,115,58,116,114,105,109,
+  0,0,129,16,198,82,129,16,156,82,10,207,82,128,83,178,
+  1,143,160,1,0,215,167,176,152,12,155,148,1,225,1,225,
+  1,220,170,2,82,101,119,114,105,116,101,85,110,100,101,114,
+  115,99,111,114,101,115,0,0,0,1,228,82,142,83,193,1,
+  0,4,225,1,225,1,0,0,115,117,98,0,0,1,95,129,
+  14,149,83,1,32,10,1,146,83,129,16,140,26,10,129,83,
+  171,83,193,1,0,4,225,1,225,1,0,0,114,101,119,114,
+  105,116,101,0,0,129,30,128,83,129,14,180,83,1,142,83,
+  129,16,199,67,10,129,18,175,83,10,154,83,199,83,193,1,
+  0,4,225,1,225,1,0,0,104,97,110,100,108,101,0,0,
+  129,16,241,54,10,228,82,219,83,205,1,143,160,1,0,195,
+  172,177,182,13,210,157,1,225,1,225,1,206,157,4,115,105,
+  103,105,108,58,39,0,0,129,16,171,83,129,16,199,83,10,
+  202,83,246,83,193,1,143,160,1,0,169,137,247,180,11,238,
+  156,1,225,1,225,1,166,137,4,115,58,115,112,108,105,116,
+  47,99,104,97,114,0,0,133,132,152,32,133,132,152,32,129,
+  16,249,61,132,134,148,16,134,136,148,16,134,8,129,16,190,
+  68,1,41,129,16,139,23,10,224,83,156,84,193,1,143,160,
+  1,0,247,130,223,197,8,244,156,1,225,1,225,1,233,137,
+  4,115,58,115,112,108,105,116,47,115,116,114,105,110,103,0,
+  0,133,132,152,32,133,132,152,32,129,16,224,64,129,162,144,
+  24,1,133,132,152,32,133,132,152,32,129,16,190,68,1,41,
+  129,16,139,23,10,132,84,190,84,193,1,143,160,1,174,243,
+  244,64,215,156,1,225,1,225,1,238,134,4,115,58,114,101,
+  112,108,97,99,101,0,0,133,132,152,32,129,16,108,129,16,
+  217,20,16,129,14,205,84,129,16,156,84,4,129,16,217,20,
+  143,34,10,1,198,84,129,16,139,23,129,16,249,60,129,16,
+  185,61,10,171,84,232,84,178,1,0,4,225,1,225,1,0,
+  0,83,112,108,105,116,45,79,110,0,2,214,84,249,84,193,
+  1,0,4,225,1,225,1,0,0,109,97,116,99,104,63,0,
+  0,129,158,44,232,84,10,233,84,143,85,193,1,0,4,225,
+  1,225,1,0,0,116,101,114,109,105,110,97,116,101,0,0,
+  1,0,0,133,132,152,32,129,164,64,1,10,252,84,163,85,
+  193,1,0,4,225,1,225,1,0,0,115,116,101,112,0,0,
+  1,151,31,129,16,139,23,129,16,249,84,129,14,177,85,2,
+  129,16,134,1,129,16,143,85,10,129,18,171,85,10,171,84,
+  200,85,193,1,143,160,1,0,201,129,150,225,4,149,157,1,
+  225,1,225,1,145,143,4,115,58,116,111,107,101,110,105,122,
+  101,0,0,129,32,232,84,129,16,204,54,129,16,217,20,1,
+  0,0,129,16,134,1,129,14,221,85,2,129,16,134,1,130,
+  2,163,85,129,16,209,61,3,10,1,212,85,129,16,139,23,
+  129,16,217,20,133,132,152,32,146,130,72,1,133,132,152,32,
+  16,10,180,85,128,1,178,1,0,4,225,1,225,1,0,0,
+  84,79,75,69,78,73,90,69,45,83,84,82,73,78,71,45,
+  67,65,80,65,67,73,84,89,0,0,233,85,128,1,178,1,
+  0,4,225,1,225,1,0,0,84,79,75,69,78,73,90,69,
+  45,82,69,83,85,76,84,45,67,65,80,65,67,73,84,89,
+  0,0,139,86,189,86,178,1,0,4,225,1,225,1,0,0,
+  78,101,101,100,108,101,0,128,2,173,86,202,87,178,1,0,
+  4,225,1,225,1,0,0,76,101,110,0,2,189,87,219,87,
+  178,1,0,4,225,1,225,1,0,0,84,111,107,101,110,115,
+  0,128,2,203,87,231,88,178,1,0,4,225,1,225,1,0,
+  0,84,80,0,2,219,88,246,88,193,1,0,4,225,1,225,
+  1,0,0,115,97,118,101,0,0,129,16,204,54,129,158,132,
+  136,1,231,88,219,87,129,162,192,8,1,231,88,129,16,221,
+  37,10,232,88,143,89,193,1,0,4,225,1,225,1,0,0,
+  110,101,120,116,0,0,129,14,148,89,129,158,68,202,87,10,
+  1,145,89,129,16,155,23,10,129,89,168,89,193,1,0,4,
+  225,1,225,1,0,0,100,111,110,101,63,0,0,129,16,108,
+  129,16,208,27,10,180,85,203,89,193,1,143,160,1,0,173,
+  186,215,148,6,154,157,1,225,1,225,1,166,144,4,115,58,
+  116,111,107,101,110,105,122,101,45,111,110,45,115,116,114,105,
+  110,103,0,0,129,130,64,0,0,231,88,129,14,215,89,130,
+  2,189,86,129,16,153,69,129,16,185,61,10,1,208,89,129,
+  14,224,89,129,16,108,129,32,202,87,10,1,219,89,129,16,
+  173,23,129,14,241,89,1,189,86,129,16,156,84,129,16,246,
+  88,129,16,143,89,129,16,168,89,10,1,230,89,129,16,215,
+  24,129,130,188,8,219,87,231,88,1,146,130,64,219,87,132,
+  6,10,173,89,66,178,1,0,4,225,1,225,1,0,0,78,
+  85,77,66,69,82,45,83,84,82,73,78,71,45,67,65,80,
+  65,67,73,84,89,0,0,253,89,173,90,178,1,0,4,225,
+  1,225,1,0,0,83,116,114,105,110,103,0,132,1,157,90,
+  131,91,193,1,0,4,225,1,225,1,0,0,99,104,101,99,
+  107,45,115,105,103,110,0,0,129,16,255,27,129,14,140,91,
+  1,45,129,16,208,49,10,129,18,135,91,10,239,90,161,91,
+  193,1,0,4,225,1,225,1,0,0,110,45,62,100,105,103,
+  105,116,0,0,129,16,179,69,145,30,10,143,91,182,91,193,
+  1,0,4,225,1,225,1,0,0,99,111,110,118,101,114,116,
+  0,0,129,14,194,91,129,158,208,32,162,2,129,16,161,91,
+  129,16,208,49,2,129,16,208,27,10,1,184,91,129,16,215,
+  24,3,10,173,89,230,91,193,1,143,160,1,0,185,210,181,
+  225,7,151,146,1,225,1,225,1,186,215,4,110,58,116,111,
+  45,115,116,114,105,110,103,47,114,101,118,101,114,115,101,100,
+  0,0,129,14,244,91,1,173,90,129,16,191,50,2,129,16,
+  232,30,129,16,182,91,129,16,131,91,10,1,232,91,129,16,
+  221,50,1,173,90,10,200,91,144,92,193,1,143,160,1,0,
+  151,230,220,107,228,154,1,225,1,225,1,225,233,3,110,58,
+  116,111,45,115,116,114,105,110,103,0,0,129,16,230,91,129,
+  16,185,60,10,251,91,163,92,193,1,0,4,225,1,225,1,
+  0,0,99,104,97,114,0,0,1,32,129,14,172,92,1,95,
+  129,16,208,49,10,1,167,92,129,16,140,26,1,114,129,14,
+  185,92,1,13,129,16,208,49,10,1,180,92,129,16,140,26,
+  1,110,129,14,198,92,1,10,129,16,208,49,10,1,193,92,
+  129,16,140,26,1,116,129,14,211,92,1,9,129,16,208,49,
+  10,1,206,92,129,16,140,26,1,48,129,14,224,92,1,0,
+  0,129,16,208,49,10,1,219,92,129,16,140,26,1,94,129,
+  14,237,92,1,27,129,16,208,49,10,1,232,92,129,16,140,
+  26,129,16,208,49,10,149,92,130,93,193,1,0,4,225,1,
+  225,1,0,0,116,121,112,101,0,0,1,99,129,14,138,93,
+  4,129,16,208,49,10,1,134,93,129,16,140,26,1,115,129,
+  14,151,93,132,2,208,49,129,16,209,61,10,1,146,93,129,
+  16,140,26,1,110,129,14,167,93,4,129,16,144,92,1,208,
+  49,129,16,209,61,10,1,159,93,129,16,140,26,3,10,244,
+  92,189,93,193,1,0,4,225,1,225,1,0,0,104,97,110,
+  100,108,101,0,0,1,92,129,14,199,93,130,130,196,32,1,
+  15,129,16,163,92,10,1,193,93,129,16,140,26,1,37,129,
+  14,213,93,130,130,196,32,1,15,129,16,130,93,10,1,207,
+  93,129,16,140,26,129,16,208,49,10,251,91,238,93,193,1,
+  143,160,1,187,189,251,31,165,156,1,225,1,225,1,234,255,
+  3,115,58,102,111,114,109,97,116,0,0,129,14,137,94,129,
+  16,147,54,129,14,132,94,129,16,191,50,129,14,128,94,130,
+  130,196,32,1,143,50,129,16,189,93,129,14,248,93,10,129,
+  16,248,93,3,10,1,244,93,129,16,155,23,10,1,240,93,
+  129,16,221,50,10,220,93,159,94,193,1,143,160,1,185,175,
+  201,181,2,226,155,1,225,1,225,1,196,246,3,115,58,99,
+  111,110,115,116,0,0,1,204,54,129,16,139,23,129,16,141,
+  22,10,142,94,182,94,178,1,0,4,225,1,225,1,0,0,
+  86,97,108,117,101,115,0,56,166,94,224,94,193,1,0,4,
+  225,1,225,1,0,0,102,114,111,109,0,0,129,16,108,2,
+  129,14,242,94,129,14,235,94,1,182,94,145,32,10,1,231,
+  94,129,16,155,23,129,36,1,10,1,229,94,129,16,147,25,
+  3,10,210,94,132,95,193,1,0,4,225,1,225,1,0,0,
+  116,111,0,0,2,129,16,108,129,14,146,95,130,130,196,32,
+  1,143,130,200,8,97,1,145,2,182,94,145,158,16,10,1,
+  137,95,129,16,147,25,3,10,142,94,169,95,193,1,143,160,
+  1,216,153,130,247,3,154,155,1,225,1,225,1,247,238,3,
+  114,101,111,114,100,101,114,0,0,1,224,94,129,16,139,23,
+  129,16,132,95,10,152,95,191,95,193,1,143,160,1,250,172,
+  130,122,233,151,1,225,1,225,1,166,250,2,99,117,114,114,
+  121,0,0,129,16,217,20,129,14,201,95,4,129,16,154,19,
+  129,16,183,19,10,1,195,95,129,16,139,23,10,176,95,220,
+  95,193,1,143,160,1,144,150,215,228,7,188,152,1,225,1,
+  225,1,195,141,3,100,111,101,115,0,0,129,16,139,17,4,
+  129,16,191,95,129,16,244,16,129,162,192,8,1,193,1,129,
+  16,216,17,10,206,95,253,95,193,1,143,160,1,0,175,231,
+  137,159,8,253,151,1,225,1,225,1,154,254,2,100,58,102,
+  111,114,45,101,97,99,104,0,0,1,2,129,14,137,96,143,
+  50,133,132,152,32,133,132,152,32,133,138,144,64,134,12,129,
+  14,129,96,10,129,16,129,96,3,10,233,95,162,96,193,1,
+  143,160,1,0,147,190,158,165,3,155,152,1,225,1,225,1,
+  194,132,3,100,58,108,111,111,107,117,112,45,120,116,0,0,
+  129,8,0,0,129,14,184,96,133,132,152,32,133,132,152,32,
+  129,34,1,143,22,129,14,178,96,132,2,194,22,129,16,139,
+  23,10,129,2,173,96,17,129,16,70,10,1,166,96,129,16,
+  253,95,3,10,141,96,202,96,193,1,143,160,1,239,239,229,
+  2,149,153,1,225,1,225,1,243,203,3,103,99,0,0,129,
+  8,3,129,16,220,38,10,190,96,225,96,193,1,143,160,1,
+  130,186,150,165,7,161,149,1,225,1,225,1,247,190,2,97,
+  58,108,101,110,103,116,104,0,0,15,10,207,96,245,96,193,
+  1,143,160,1,143,188,246,185,7,174,149,1,225,1,225,1,
+  246,193,2,97,58,109,105,100,100,108,101,0,0,129,16,217,
+  20,129,14,139,97,2,129,16,134,1,129,14,129,97,129,162,
+  68,1,10,1,254,96,129,16,139,23,129,16,217,20,4,129,
+  16,144,39,10,1,249,96,129,16,139,23,10,227,96,160,97,
+  193,1,143,160,1,0,169,211,176,152,2,156,149,1,225,1,
+  225,1,173,190,2,97,58,108,101,102,116,0,0,129,8,0,
+  0,129,16,245,96,10,144,97,182,97,193,1,143,160,1,0,
+  131,159,207,157,8,195,149,1,225,1,225,1,152,198,2,97,
+  58,114,105,103,104,116,0,0,133,132,152,32,129,16,225,96,
+  133,132,152,32,146,8,129,16,245,96,10,165,97,217,97,193,
+  1,143,160,1,145,150,214,240,4,216,148,1,225,1,225,1,
+  235,180,2,97,58,99,111,117,110,116,101,100,45,114,101,115,
+  117,108,116,115,0,0,8,129,16,217,20,129,14,230,97,2,
+  129,16,134,1,1,134,1,129,16,147,25,10,1,222,97,129,
+  16,139,23,10,190,97,130,98,193,1,143,160,1,248,215,207,
+  235,3,252,148,1,225,1,225,1,212,186,2,97,58,102,114,
+  111,109,45,115,116,114,105,110,103,0,0,129,16,217,20,129,
+  14,144,98,2,129,16,108,129,16,134,1,1,134,1,129,16,
+  209,61,10,1,134,98,129,16,139,23,10,235,97,169,98,193,
+  1,143,160,1,0,245,180,135,225,9,248,148,1,225,1,225,
+  1,161,186,2,97,58,102,111,114,45,101,97,99,104,0,0,
+  132,132,132,136,1,1,132,158,4,19,129,16,139,23,129,14,
+  184,98,133,132,132,136,1,1,132,30,132,140,136,40,132,138,
+  32,134,12,10,1,177,98,129,16,147,25,131,6,10,149,98,
+  205,98,193,1,143,160,1,233,159,239,119,220,148,1,225,1,
+  225,1,254,181,2,97,58,100,117,112,0,0,129,16,217,20,
+  129,14,217,98,130,30,129,16,134,1,1,134,1,129,16,169,
+  98,10,1,209,98,129,16,139,23,10,190,98,238,98,193,1,
+  143,160,1,0,201,225,214,152,2,212,148,1,225,1,225,1,
+  193,180,2,97,58,99,111,112,121,0,0,1,3,129,14,253,
+  98,129,160,8,3,129,16,225,96,129,16,134,1,1,134,1,
+  129,16,169,98,10,1,242,98,129,16,220,38,10,222,98,151,
+  99,193,1,143,160,1,167,228,188,156,3,214,149,1,225,1,
+  225,1,167,200,2,97,58,116,111,45,115,116,114,105,110,103,
+  0,0,1,3,129,14,164,99,129,16,205,98,1,0,0,129,
+  16,134,1,129,34,1,10,1,155,99,129,16,220,38,129,16,
+  241,53,10,130,99,189,99,193,1,143,160,1,152,246,147,222,
+  5,188,148,1,225,1,225,1,229,177,2,97,58,97,112,112,
+  101,110,100,0,0,133,132,152,32,133,132,152,32,1,37,129,
+  16,211,23,17,129,16,217,20,129,14,214,99,129,16,134,1,
+  129,14,209,99,1,134,1,129,16,169,98,10,1,204,99,129,
+  16,211,23,10,1,200,99,129,16,139,23,10,171,99,238,99,
+  193,1,143,160,1,174,169,220,215,5,180,149,1,225,1,225,
+  1,254,194,2,97,58,112,114,101,112,101,110,100,0,0,4,
+  129,16,189,99,10,219,99,130,100,193,1,143,160,1,0,171,
+  217,215,152,2,198,148,1,225,1,225,1,238,178,2,97,58,
+  99,104,111,112,0,0,129,16,205,98,1,0,1,129,16,195,
+  38,2,129,16,242,37,10,242,99,158,100,193,1,143,160,1,
+  230,207,184,183,6,239,148,1,225,1,225,1,198,184,2,97,
+  58,102,105,108,116,101,114,0,0,129,14,171,100,133,132,152,
+  32,1,27,129,16,139,23,132,130,4,134,1,17,129,16,70,
+  10,1,160,100,129,16,191,95,129,16,217,20,129,14,186,100,
+  133,132,152,32,15,129,16,134,1,129,16,169,98,10,1,179,
+  100,129,16,139,23,129,16,217,20,133,132,152,32,146,130,72,
+  1,133,132,152,32,16,10,140,100,219,100,193,1,143,160,1,
+  254,182,182,30,207,148,1,225,1,225,1,128,180,2,97,58,
+  99,111,110,116,97,105,110,115,63,0,0,129,8,0,0,129,
+  14,227,100,132,10,133,132,152,32,139,140,88,10,1,223,100,
+  129,16,169,98,132,6,10,198,100,133,101,193,1,143,160,1,
+  132,140,147,181,2,202,148,1,225,1,225,1,184,179,2,97,
+  58,99,111,110,116,97,105,110,115,47,115,116,114,105,110,103,
+  63,0,0,129,8,0,0,129,14,143,101,132,10,133,132,152,
+  32,129,16,122,134,44,10,1,137,101,129,16,169,98,132,6,
+  10,233,100,164,101,193,1,143,160,1,158,231,239,119,169,149,
+  1,225,1,225,1,154,192,2,97,58,109,97,112,0,0,4,
+  129,14,195,101,130,130,196,32,1,15,129,14,189,101,129,14,
+  178,101,15,133,132,152,32,8,10,1,174,101,129,16,155,23,
+  1,39,129,16,155,23,129,34,1,10,1,172,101,129,16,147,
+  25,131,6,10,1,167,101,129,16,155,23,10,149,101,219,101,
+  193,1,143,160,1,0,199,198,205,131,5,191,149,1,225,1,
+  225,1,211,197,2,97,58,114,101,118,101,114,115,101,0,0,
+  129,16,217,20,129,14,252,101,130,130,196,32,1,15,129,14,
+  231,101,145,130,72,1,10,1,228,101,129,16,155,23,2,129,
+  16,134,1,129,14,246,101,130,30,129,16,134,1,129,36,1,
+  10,1,240,101,129,16,147,25,3,10,1,223,101,129,16,139,
+  23,10,200,101,143,102,193,1,143,160,1,220,140,205,228,7,
+  209,149,1,225,1,225,1,237,199,2,97,58,116,104,0,0,
+  145,130,68,1,10,129,102,163,102,193,1,143,160,1,0,235,
+  162,168,171,8,234,148,1,225,1,225,1,128,184,2,97,58,
+  102,101,116,99,104,0,0,129,16,143,102,15,10,146,102,184,
+  102,193,1,143,160,1,0,165,143,141,156,8,200,149,1,225,
+  1,225,1,247,198,2,97,58,115,116,111,114,101,0,0,129,
+  16,143,102,16,10,167,102,205,102,193,1,143,160,1,0,175,
+  246,150,171,8,244,148,1,225,1,225,1,252,185,2,97,58,
+  102,105,114,115,116,0,0,1,0,0,129,16,163,102,10,188,
+  102,226,102,193,1,143,160,1,0,215,144,177,152,2,152,149,
+  1,225,1,225,1,137,190,2,97,58,108,97,115,116,0,0,
+  2,129,16,225,96,129,36,1,129,16,163,102,10,210,102,252,
+  102,193,1,143,160,1,0,207,198,133,214,15,185,149,1,225,
+  1,225,1,206,195,2,97,58,114,101,100,117,99,101,0,0,
+  1,19,129,16,139,23,129,16,169,98,10,234,102,12,178,1,
+  0,0,0,133,199,188,229,11,0,0,225,1,225,1,0,0,
+  84,69,77,80,45,65,82,82,65,89,45,67,79,85,78,84,
+  0,0,131,103,171,103,193,1,143,160,1,135,176,147,228,7,
+  134,148,1,225,1,225,1,153,163,2,70,82,69,69,0,0,
+  129,16,200,52,129,30,182,52,129,16,224,51,17,129,16,134,
+  52,19,129,16,224,51,146,130,60,182,52,129,16,224,51,145,
+  130,204,144,1,12,18,129,16,217,20,18,10,157,103,213,103,
+  178,1,0,4,225,1,225,1,0,0,78,101,120,116,65,114,
+  114,97,121,0,0,4,194,103,230,103,193,1,0,4,225,1,
+  225,1,0,0,97,114,114,97,121,115,0,0,129,16,171,103,
+  129,16,217,20,17,10,157,103,252,103,193,1,143,160,1,0,
+  211,195,141,152,2,205,149,1,225,1,225,1,172,199,2,97,
+  58,116,101,109,112,0,0,129,158,136,8,213,103,12,11,129,
+  14,135,104,131,130,136,8,0,0,213,103,16,10,129,18,130,
+  104,129,30,182,52,129,16,224,51,145,38,129,16,230,103,17,
+  133,132,152,32,129,16,225,96,129,34,1,129,16,144,39,129,
+  158,132,120,213,103,182,52,129,16,224,51,145,38,129,16,230,
+  103,145,2,213,103,129,16,221,37,10,236,103,180,104,178,1,
+  0,4,225,1,225,1,0,0,67,111,117,110,116,0,0,4,
+  165,104,198,104,193,1,0,4,225,1,225,1,0,0,112,114,
+  101,112,97,114,101,0,0,129,130,64,0,0,180,104,10,181,
+  104,219,104,193,1,0,4,225,1,225,1,0,0,114,101,115,
+  101,114,118,101,0,0,132,2,0,0,129,16,134,1,10,202,
+  104,239,104,193,1,0,4,225,1,225,1,0,0,112,97,116,
+  99,104,0,0,129,16,217,20,133,132,152,32,146,130,72,1,
+  133,132,152,32,16,10,224,104,136,105,193,1,0,4,225,1,
+  225,1,0,0,99,108,101,97,110,117,112,0,0,2,129,16,
+  252,103,132,130,64,3,10,247,104,158,105,193,1,0,4,225,
+  1,225,1,0,0,114,101,99,111,114,100,0,0,129,30,180,
+  104,129,16,134,1,10,142,105,182,105,193,1,0,4,225,1,
+  225,1,0,0,105,116,101,114,97,116,101,47,110,0,0,129,
+  14,192,105,133,132,152,32,139,130,36,158,105,1,180,104,129,
+  16,221,37,10,1,184,105,129,16,169,98,10,163,105,216,105,
+  193,1,0,4,225,1,225,1,0,0,105,116,101,114,97,116,
+  101,47,115,0,0,129,14,228,105,133,132,152,32,129,16,122,
+  129,18,158,105,1,180,104,129,16,221,37,10,1,218,105,129,
+  16,169,98,10,236,103,252,105,193,1,143,160,1,159,160,211,
+  181,3,142,149,1,225,1,225,1,218,188,2,97,58,105,110,
+  100,105,99,101,115,0,0,129,16,198,104,129,16,217,20,129,
+  14,136,106,129,16,219,104,129,16,182,105,3,10,1,130,106,
+  129,16,139,23,129,16,239,104,129,16,136,105,10,233,105,171,
+  106,193,1,143,160,1,229,211,165,158,7,147,149,1,225,1,
+  225,1,182,189,2,97,58,105,110,100,105,99,101,115,47,115,
+  116,114,105,110,103,0,0,129,16,198,104,129,16,217,20,129,
+  14,183,106,129,16,219,104,129,16,216,105,3,10,1,177,106,
+  129,16,139,23,129,16,239,104,129,16,136,105,10,145,106,209,
+  106,193,1,143,160,1,0,143,206,208,167,8,132,149,1,225,
+  1,225,1,187,187,2,97,58,105,110,100,101,120,0,0,129,
+  14,218,106,129,16,252,105,1,0,0,129,16,163,102,10,1,
+  211,106,129,16,202,96,10,192,106,247,106,193,1,143,160,1,
+  158,144,152,221,5,137,149,1,225,1,225,1,138,188,2,97,
+  58,105,110,100,101,120,47,115,116,114,105,110,103,0,0,129,
+  14,128,107,129,16,171,106,1,0,0,129,16,163,102,10,1,
+  249,106,129,16,202,96,10,223,106,149,107,193,1,143,160,1,
+  0,195,227,172,152,2,165,149,1,225,1,225,1,149,191,2,
+  97,58,109,97,107,101,0,0,129,16,217,97,130,132,4,3,
+  129,14,158,107,129,16,219,101,10,1,155,107,129,16,220,38,
+  4,129,16,238,98,10,133,107,177,107,205,1,143,160,1,160,
+  236,10,137,159,1,225,1,225,1,184,209,4,123,0,0,1,
+  130,3,129,16,205,1,1,224,16,129,16,193,1,1,130,3,
+  129,16,205,1,10,166,107,201,107,205,1,143,160,1,162,236,
+  10,141,159,1,225,1,225,1,206,210,4,125,0,0,1,146,
+  3,129,16,205,1,1,139,23,129,16,193,1,1,224,16,129,
+  16,193,1,1,19,129,16,199,1,1,43,129,16,199,1,1,
+  169,31,129,16,158,59,1,146,3,129,16,205,1,1,149,107,
+  129,16,193,1,10,190,107,250,107,193,1,143,160,1,0,247,
+  214,194,152,2,128,149,1,225,1,225,1,145,187,2,97,58,
+  104,97,115,104,0,0,129,8,133,42,129,14,129,108,132,130,
+  204,136,1,33,10,1,254,107,129,16,169,98,10,234,107,149,
+  108,193,1,143,160,1,245,166,239,119,229,148,1,225,1,225,
+  1,238,182,2,97,58,101,113,63,0,0,129,16,250,107,4,
+  129,16,250,107,11,10,134,108,172,108,193,1,143,160,1,0,
+  251,253,196,154,2,183,148,1,225,1,225,1,211,176,2,97,
+  58,45,101,113,63,0,0,129,16,250,107,4,129,16,250,107,
+  12,10,156,108,203,108,193,1,143,160,1,0,255,187,161,134,
+  7,193,148,1,225,1,225,1,181,178,2,97,58,98,101,103,
+  105,110,115,45,119,105,116,104,63,0,0,1,3,129,14,219,
+  108,2,129,16,225,96,1,19,129,16,139,23,129,16,160,97,
+  129,16,149,108,10,1,207,108,129,16,220,38,10,179,108,246,
+  108,193,1,143,160,1,178,162,238,137,1,224,148,1,225,1,
+  225,1,183,182,2,97,58,101,110,100,115,45,119,105,116,104,
+  63,0,0,1,3,129,14,134,109,2,129,16,225,96,1,19,
+  129,16,139,23,129,16,182,97,129,16,149,108,10,1,250,108,
+  129,16,220,38,10,224,108,159,109,178,1,0,4,225,1,225,
+  1,0,0,83,117,98,115,116,105,116,117,116,101,0,128,2,
+  139,109,176,110,193,1,0,4,225,1,225,1,0,0,101,120,
+  116,114,97,99,116,0,0,1,159,109,129,16,153,69,10,159,
+  110,198,110,193,1,0,4,225,1,225,1,0,0,99,111,109,
+  98,105,110,101,0,0,1,159,109,129,16,185,61,129,16,185,
+  61,10,181,110,223,110,193,1,0,4,225,1,225,1,0,0,
+  102,105,110,100,45,101,110,100,0,0,2,129,16,108,1,159,
+  109,129,16,108,18,133,132,152,32,17,10,205,110,249,110,193,
+  1,0,4,225,1,225,1,0,0,99,108,101,97,110,0,0,
+  129,16,223,110,129,136,64,0,0,10,224,108,149,111,193,1,
+  143,160,1,0,151,157,186,216,3,221,156,1,225,1,225,1,
+  158,135,4,115,58,114,101,112,108,97,99,101,45,97,108,108,
+  0,0,1,3,129,14,172,111,129,16,176,110,129,16,203,89,
+  129,16,147,54,4,129,14,165,111,129,16,198,110,10,1,162,
+  111,129,16,169,98,129,16,249,110,10,1,153,111,129,16,220,
+  38,10,254,110,199,111,193,1,0,4,225,1,225,1,0,0,
+  99,117,114,114,101,110,116,45,108,105,110,101,0,0,129,16,
+  200,52,129,30,182,52,129,16,224,51,17,129,16,134,52,19,
+  129,16,224,51,18,10,177,111,235,111,193,1,0,4,225,1,
+  225,1,0,0,99,111,117,110,116,45,116,111,107,101,110,115,
+  0,0,129,14,240,111,129,22,32,10,1,237,111,129,16,141,
+  67,129,16,108,10,213,111,143,112,193,1,0,4,225,1,225,
+  1,0,0,112,114,111,99,101,115,115,45,116,111,107,101,110,
+  115,0,0,129,14,170,112,1,32,129,16,246,83,4,129,14,
+  163,112,2,129,16,108,129,16,230,27,129,2,210,3,17,129,
+  16,70,10,1,152,112,129,16,139,23,129,34,1,10,1,145,
+  112,129,16,147,25,129,16,210,3,10,254,110,197,112,193,1,
+  143,160,1,201,241,224,48,147,156,1,225,1,246,192,1,151,
+  253,3,115,58,101,118,97,108,117,97,116,101,0,0,129,16,
+  199,111,129,16,153,69,129,16,199,111,2,129,16,235,111,129,
+  16,143,112,10,177,112,32,178,1,0,4,225,1,225,1,0,
+  0,73,78,68,69,88,69,68,45,76,79,79,80,45,77,65,
+  88,73,77,85,77,45,68,69,80,84,72,0,0,209,112,129,
+  113,178,1,0,4,225,1,225,1,0,0,76,80,0,2,245,
+  112,145,113,178,1,0,4,225,1,225,1,0,0,73,110,100,
+  101,120,0,64,130,113,191,113,193,1,0,4,225,1,225,1,
+  0,0,110,101,120,116,0,0,129,158,132,136,1,129,113,145,
+  113,129,16,221,37,10,177,113,211,113,193,1,0,4,225,1,
+  225,1,0,0,112,114,101,112,0,0,1,129,113,129,16,221,
+  37,129,130,188,8,0,0,129,113,145,113,145,32,10,197,113,
+  235,113,193,1,0,4,225,1,225,1,0,0,100,111,110,101,
+  0,0,1,129,113,129,16,242,37,10,221,113,255,113,178,1,
+  0,4,225,1,225,1,0,0,81,117,111,116,101,0,0,131,
+  247,4,240,113,145,114,178,1,0,4,225,1,225,1,0,0,
+  76,105,116,101,114,97,108,0,0,130,253,4,128,114,163,114,
+  178,1,0,4,225,1,225,1,0,0,73,110,100,101,120,101,
+  100,0,0,132,124,146,114,180,114,193,1,0,4,225,1,225,
+  1,0,0,113,117,111,116,101,63,0,0,130,130,64,145,114,
+  129,16,255,27,129,14,189,114,129,16,251,25,10,1,186,114,
+  129,16,248,28,129,158,188,8,145,114,1,12,129,14,202,114,
+  129,16,251,25,10,1,199,114,129,16,248,28,129,158,132,136,
+  1,145,114,1,143,132,132,128,1,255,113,129,130,60,2,145,
+  114,129,16,192,31,129,46,0,1,129,14,223,114,129,16,251,
+  25,10,1,220,114,129,16,248,28,129,158,132,144,1,255,113,
+  2,143,130,172,8,129,14,255,113,143,130,200,120,1,129,158,
+  172,168,1,145,114,10,164,114,255,114,193,1,0,4,225,1,
+  225,1,0,0,115,105,110,103,108,101,63,0,0,129,16,217,
+  20,129,36,2,129,16,180,114,10,238,114,149,115,193,1,0,
+  4,225,1,225,1,0,0,112,97,105,114,63,0,0,129,16,
+  255,114,129,14,159,115,129,158,132,144,1,255,113,4,129,16,
+  180,114,10,1,153,115,129,14,166,115,129,16,251,25,10,1,
+  163,115,129,16,70,10,134,115,183,115,178,1,0,4,225,1,
+  225,1,0,0,65,116,0,0,188,242,1,171,115,197,115,178,
+  1,0,4,225,1,225,1,0,0,69,110,100,0,0,188,242,
+  1,184,115,211,115,178,1,0,4,225,1,225,1,0,0,79,
+  112,115,0,2,198,115,226,115,178,1,0,4,225,1,225,1,
+  0,0,76,97,115,116,0,0,6,212,115,242,115,178,1,0,
+  4,225,1,225,1,0,0,86,97,108,117,101,0,0,199,235,
+  1,227,115,130,116,178,1,0,4,225,1,225,1,0,0,68,
+  101,112,116,104,0,2,243,115,145,116,178,1,0,4,225,1,
+  225,1,0,0,83,97,102,101,0,0,0,1,131,116,163,116,
+  193,1,0,4,225,1,225,1,0,0,110,101,120,116,45,111,
+  112,0,0,129,158,136,8,211,115,8,152,130,192,8,211,115,
+  255,1,21,10,146,116,187,116,193,1,0,4,225,1,225,1,
+  0,0,117,110,115,97,102,101,0,0,129,16,251,25,129,160,
+  132,120,145,116,197,115,129,32,183,115,10,171,116,213,116,193,
+  1,0,4,225,1,225,1,0,0,108,105,116,101,114,97,108,
+  63,0,0,129,158,132,88,226,115,1,10,195,116,237,116,193,
+  1,0,4,225,1,225,1,0,0,99,104,101,99,107,45,106,
+  117,109,112,0,0,129,16,213,116,129,14,244,116,129,16,187,
+  116,10,1,241,116,129,16,143,29,129,158,132,120,242,115,255,
+  113,129,30,197,115,129,16,192,31,129,14,132,117,129,16,187,
+  116,10,1,129,117,129,16,143,29,129,158,132,120,242,115,183,
+  115,14,129,14,146,117,129,158,132,128,1,242,115,183,115,10,
+  129,18,142,117,10,217,116,169,117,193,1,0,4,225,1,225,
+  1,0,0,99,104,101,99,107,45,99,97,108,108,0,0,129,
+  16,213,116,25,131,130,188,8,242,115,172,54,11,129,14,195,
+  117,129,30,183,115,129,14,188,117,130,130,196,32,1,15,129,
+  16,230,27,10,1,182,117,129,16,186,24,129,32,183,115,10,
+  1,178,117,129,16,248,28,129,30,242,115,129,16,129,48,129,
+  14,208,117,129,16,187,116,10,129,18,205,117,10,149,117,226,
+  117,193,1,0,4,225,1,225,1,0,0,99,104,101,99,107,
+  0,0,1,1,129,14,238,117,129,158,188,8,183,115,242,115,
+  144,2,183,115,129,16,221,37,10,1,230,117,129,16,140,26,
+  1,5,129,14,251,117,1,130,116,129,16,221,37,10,1,246,
+  117,129,16,140,26,1,6,129,14,147,118,1,130,116,129,16,
+  242,37,129,30,130,116,129,16,255,27,129,14,144,118,129,16,
+  187,116,10,129,18,141,118,10,1,131,118,129,16,140,26,1,
+  7,129,14,158,118,129,16,237,116,10,1,155,118,129,16,140,
+  26,1,8,129,14,169,118,129,16,169,117,10,1,166,118,129,
+  16,140,26,1,9,129,14,180,118,129,16,169,117,10,1,177,
+  118,129,16,140,26,1,10,129,14,191,118,129,16,187,116,10,
+  1,188,118,129,16,140,26,1,25,129,14,202,118,129,16,187,
+  116,10,1,199,118,129,16,140,26,3,10,211,117,220,118,193,
+  1,0,4,225,1,225,1,0,0,111,112,0,0,2,129,16,
+  208,27,129,14,227,118,3,10,1,225,118,129,16,248,28,129,
+  14,236,118,129,16,226,117,10,1,233,118,129,16,155,23,129,
+  32,226,115,10,208,118,131,119,193,1,0,4,225,1,225,1,
+  0,0,117,110,116,97,105,108,0,0,129,158,132,144,1,145,
+  114,3,130,130,188,88,156,1,133,132,152,32,143,130,172,168,
+  1,129,14,129,14,144,119,129,136,64,129,16,10,129,2,141,
+  119,17,129,16,70,10,243,118,165,119,193,1,0,4,225,1,
+  225,1,0,0,108,111,111,112,63,0,0,129,16,255,114,129,
+  14,172,119,129,16,251,25,10,1,169,119,129,16,143,29,129,
+  16,131,119,129,16,233,25,129,160,132,8,145,116,0,0,130,
+  116,144,130,132,128,1,0,0,226,115,129,158,132,128,1,255,
+  113,183,115,129,158,132,144,1,145,114,1,129,32,197,115,129,
+  14,224,119,129,158,132,120,183,115,197,115,141,50,131,130,188,
+  120,183,115,129,160,4,211,115,183,115,129,16,221,37,1,4,
+  129,14,217,119,129,16,163,116,129,16,220,118,10,1,212,119,
+  129,16,147,25,129,14,197,119,10,129,16,197,119,129,30,145,
+  116,10,150,119,245,119,193,1,0,4,225,1,225,1,0,0,
+  98,114,97,110,99,104,0,0,7,10,229,119,135,120,193,1,
+  0,4,225,1,225,1,0,0,98,111,116,116,111,109,0,0,
+  129,16,217,20,1,134,130,200,200,1,129,16,134,1,1,1,
+  129,16,134,1,1,133,130,28,129,16,134,1,129,30,255,113,
+  129,16,134,1,10,247,119,169,120,193,1,0,4,225,1,225,
+  1,0,0,101,110,116,101,114,0,0,1,129,162,132,40,129,
+  16,134,1,1,1,129,16,134,1,129,16,217,20,129,34,2,
+  129,16,134,1,1,133,130,28,129,16,134,1,129,16,134,1,
+  10,154,120,210,120,193,1,0,4,225,1,225,1,0,0,102,
+  117,115,101,45,116,105,109,101,115,0,0,129,158,132,144,1,
+  145,114,1,129,32,3,129,16,135,120,129,16,217,20,129,158,
+  132,144,1,255,113,1,16,129,16,169,120,10,190,120,254,120,
+  193,1,0,4,225,1,225,1,0,0,102,117,115,101,45,105,
+  110,100,101,120,101,100,45,116,105,109,101,115,0,0,129,158,
+  132,144,1,145,114,1,129,160,4,3,191,113,129,16,212,19,
+  129,16,135,120,129,16,217,20,129,158,132,144,1,255,113,1,
+  144,2,211,113,129,16,212,19,129,16,169,120,1,235,113,129,
+  16,212,19,10,226,120,170,121,193,1,0,4,225,1,225,1,
+  0,0,102,117,115,101,45,100,105,112,0,0,129,130,188,128,
+  1,133,130,32,145,114,1,6,129,16,134,1,10,152,121,196,
+  121,193,1,0,4,225,1,225,1,0,0,102,117,115,101,45,
+  115,105,112,0,0,129,130,188,128,1,130,138,132,64,145,114,
+  1,6,129,16,134,1,10,178,121,221,121,193,1,0,4,225,
+  1,225,1,0,0,102,117,115,101,45,98,105,0,0,129,130,
+  188,128,1,130,138,132,64,145,114,129,130,188,8,134,130,28,
+  145,114,2,145,32,129,16,217,20,129,164,132,128,1,2,3,
+  129,158,132,136,1,145,114,4,129,16,193,1,10,204,121,133,
+  122,193,1,0,4,225,1,225,1,0,0,102,117,115,101,45,
+  99,104,111,111,115,101,0,0,129,16,217,20,129,164,136,8,
+  2,255,113,143,130,200,128,1,1,129,160,4,3,129,152,132,
+  168,1,129,16,134,1,1,0,0,129,16,134,1,129,158,132,
+  120,255,113,145,114,129,162,92,4,129,16,134,1,1,129,46,
+  129,16,134,1,129,158,132,136,1,145,114,4,129,16,134,1,
+  1,245,119,129,16,193,1,10,240,121,188,122,193,1,0,4,
+  225,1,225,1,0,0,102,117,115,101,45,45,105,102,0,0,
+  129,158,132,128,1,145,114,3,1,129,150,132,72,129,16,134,
+  1,1,0,0,129,16,134,1,129,30,255,113,129,16,134,1,
+  10,170,122,220,122,193,1,0,4,225,1,225,1,0,0,102,
+  117,115,101,100,63,0,0,1,147,25,129,14,229,122,129,16,
+  165,119,130,130,36,210,120,10,1,224,122,129,16,140,26,129,
+  30,163,114,129,14,242,122,129,16,165,119,130,130,36,254,120,
+  10,1,237,122,129,16,140,26,1,139,23,129,14,255,122,129,
+  16,255,114,130,130,36,170,121,10,1,250,122,129,16,140,26,
+  1,155,23,129,14,140,123,129,16,255,114,130,130,36,196,121,
+  10,1,135,123,129,16,140,26,1,173,23,129,14,153,123,129,
+  16,149,115,130,130,36,221,121,10,1,148,123,129,16,140,26,
+  1,70,129,14,166,123,129,16,149,115,130,130,36,133,122,10,
+  1,161,123,129,16,140,26,1,78,129,14,179,123,129,16,255,
+  114,130,130,36,188,122,10,1,174,123,129,16,140,26,3,129,
+  16,251,25,10,177,112,198,123,193,1,143,160,1,238,235,10,
+  140,148,1,225,1,225,1,207,165,2,73,0,0,129,158,132,
+  136,1,129,113,145,113,15,10,187,123,214,123,193,1,143,160,
+  1,239,235,10,146,148,1,225,1,225,1,212,166,2,74,0,
+  0,129,158,132,136,1,129,113,145,113,129,164,60,1,10,203,
+  123,231,123,193,1,143,160,1,240,235,10,149,148,1,225,1,
+  225,1,174,167,2,75,0,0,129,158,132,136,1,129,113,145,
+  113,129,164,60,2,10,220,123,132,124,179,124,143,160,1,245,
+  148,251,58,200,153,1,225,1,225,1,149,212,3,105,110,100,
+  101,120,101,100,45,116,105,109,101,115,0,0,129,16,211,113,
+  4,129,14,147,124,25,129,164,148,16,1,133,16,134,12,129,
+  16,191,113,129,14,137,124,10,129,16,137,124,3,129,16,235,
+  113,10,237,123,179,124,193,1,143,160,1,0,249,175,128,150,
+  7,174,151,1,225,1,225,1,142,227,2,99,108,97,115,115,
+  58,99,111,109,98,105,110,97,116,111,114,0,0,129,16,137,
+  20,129,14,192,124,2,129,16,220,122,129,2,17,193,1,129,
+  16,70,10,129,2,183,124,27,129,16,70,10,129,14,207,124,
+  129,16,155,2,129,162,132,32,2,179,124,16,10,1,200,124,
+  153,124,226,124,193,1,143,160,1,148,149,205,66,178,152,1,
+  225,1,225,1,166,140,3,100,101,99,105,109,97,108,0,0,
+  129,130,64,10,162,2,10,209,124,246,124,193,1,143,160,1,
+  0,235,140,235,189,1,143,150,1,225,1,225,1,171,207,2,
+  98,105,110,97,114,121,0,0,129,130,64,2,162,2,10,230,
+  124,137,125,193,1,143,160,1,248,199,191,128,1,247,154,1,
+  225,1,225,1,147,235,3,111,99,116,97,108,0,0,129,130,
+  64,8,162,2,10,250,124,154,125,193,1,143,160,1,202,245,
+  161,92,183,153,1,225,1,225,1,230,208,3,104,101,120,0,
+  0,129,130,64,16,162,2,10,141,125,173,125,193,1,143,160,
+  1,142,207,181,132,1,231,158,1,225,1,225,1,237,203,4,
+  118,97,114,45,115,0,0,1,204,54,129,16,139,23,129,16,
+  232,21,10,158,125,202,125,193,1,143,160,1,0,149,206,167,
+  164,12,138,158,1,225,1,225,1,161,171,4,116,97,105,108,
+  45,114,101,99,117,114,115,101,0,0,1,129,14,129,16,217,
+  20,129,164,64,3,10,180,125,223,125,193,1,143,160,1,172,
+  150,219,228,7,229,152,1,225,1,225,1,217,198,3,102,105,
+  108,108,0,0,129,14,233,125,133,132,152,32,133,132,152,32,
+  144,130,68,1,134,130,200,200,1,1,133,130,28,225,125,129,
+  162,132,40,1,237,125,133,130,28,229,125,131,6,10,209,125,
+  134,126,193,1,143,160,1,0,197,244,243,136,5,209,153,1,
+  225,1,225,1,174,214,3,105,111,58,101,110,117,109,101,114,
+  97,116,101,0,0,27,10,240,125,154,126,193,1,143,160,1,
+  141,185,247,149,5,215,153,1,225,1,225,1,175,215,3,105,
+  111,58,113,117,101,114,121,0,0,28,10,136,126,175,126,193,
+  1,143,160,1,0,185,248,169,138,13,212,153,1,225,1,225,
+  1,133,215,3,105,111,58,105,110,118,111,107,101,0,0,29,
+  10,156,126,198,126,193,1,143,160,1,0,159,252,222,196,13,
+  220,153,1,225,1,225,1,254,215,3,105,111,58,115,99,97,
+  110,45,102,111,114,0,0,129,16,134,126,129,14,221,126,129,
+  164,8,1,129,16,255,27,129,14,211,126,129,16,251,25,10,
+  1,208,126,129,16,248,28,133,132,152,32,133,132,152,32,129,
+  16,154,126,132,134,48,10,1,202,126,129,16,186,24,132,6,
+  10,177,126,242,126,193,1,143,160,1,251,231,128,121,217,150,
+  1,225,1,225,1,199,218,2,99,58,112,117,116,0,0,129,
+  14,244,126,1,0,0,129,16,175,126,10,227,126,133,127,193,
+  1,143,160,1,223,241,229,2,241,154,1,225,1,225,1,223,
+  234,3,110,108,0,0,1,10,129,16,242,126,10,249,126,150,
+  127,193,1,143,160,1,136,243,229,2,247,157,1,225,1,225,
+  1,190,169,4,115,112,0,0,1,32,129,16,242,126,10,138,
+  127,168,127,193,1,143,160,1,188,218,162,92,136,158,1,225,
+  1,225,1,134,171,4,116,97,98,0,0,1,9,129,16,242,
+  126,10,155,127,188,127,193,1,143,160,1,139,248,134,130,1,
+  212,156,1,225,1,225,1,220,134,4,115,58,112,117,116,0,
+  0,1,242,126,129,16,209,61,10,173,127,208,127,193,1,143,
+  160,1,134,131,157,127,208,154,1,225,1,225,1,204,231,3,
+  110,58,112,117,116,0,0,129,16,230,91,2,129,16,108,1,
+  41,129,16,155,23,129,34,1,129,14,230,127,130,30,129,16,
+  242,126,129,36,1,134,130,200,200,1,1,133,130,28,221,127,
+  129,162,132,40,1,234,127,133,130,28,226,127,3,10,193,127,
+  252,127,193,1,143,160,1,136,133,157,130,1,164,155,1,225,
+  1,225,1,193,239,3,114,101,115,101,116,0,0,129,16,224,
+  16,25,131,134,132,56,252,127,10,237,127,150,128,1,193,1,
+  143,160,1,0,195,152,169,167,8,198,152,1,225,1,225,1,
+  133,143,3,100,117,109,112,45,115,116,97,99,107,0,0,129,
+  16,224,16,25,131,138,132,64,150,128,1,134,132,132,64,208,
+  127,129,16,150,127,10,130,128,1,173,128,1,193,1,143,160,
+  1,228,195,160,92,164,148,1,225,1,225,1,155,173,2,84,
+  73,66,0,0,129,30,7,10,129,14,215,128,1,129,16,172,
+  54,69,82,82,79,82,58,32,87,111,114,100,32,78,111,116,
+  32,70,111,117,110,100,58,32,0,0,1,180,128,1,129,16,
+  188,127,129,16,173,128,1,129,16,188,127,129,16,133,127,10,
+  1,178,128,1,160,128,1,232,128,1,193,1,143,160,1,162,
+  151,128,121,206,150,1,225,1,225,1,171,217,2,99,58,103,
+  101,116,0,0,129,14,234,128,1,1,1,129,16,198,126,129,
+  16,175,126,10,217,128,1,254,128,1,193,1,143,160,1,197,
+  199,161,92,168,150,1,225,1,225,1,233,212,2,98,121,101,
+  0,0,26,10,241,128,1,146,129,1,178,1,143,160,1,0,
+  187,170,193,194,4,143,148,1,225,1,225,1,162,166,2,73,
+  103,110,111,114,105,110,103,0,2,128,129,1,160,129,1,178,
+  1,0,4,225,1,225,1,0,0,69,79,84,0,2,147,129,
+  1,178,129,1,193,1,0,4,225,1,225,1,0,0,118,101,
+  114,115,105,111,110,0,0,129,158,132,160,1,4,100,10,161,
+  129,1,197,129,1,193,1,0,4,225,1,225,1,0,0,100,
+  111,110,101,63,0,0,130,130,64,160,129,1,129,14,204,129,
+  1,129,22,13,10,1,201,129,1,129,14,211,129,1,129,22,
+  10,10,1,208,129,1,129,14,218,129,1,129,22,32,10,1,
+  215,129,1,129,16,228,23,150,44,10,182,129,1,238,129,1,
+  193,1,0,4,225,1,225,1,0,0,101,111,108,63,0,0,
+  129,30,160,129,1,129,14,245,129,1,129,22,13,10,130,138,
+  132,64,242,129,1,134,130,28,252,129,1,129,22,10,10,129,
+  16,249,129,1,22,10,224,129,1,144,130,1,193,1,0,4,
+  225,1,225,1,0,0,118,97,108,105,100,63,0,0,2,129,
+  16,108,129,16,186,28,10,128,130,1,169,130,1,193,1,0,
+  4,225,1,225,1,0,0,99,104,101,99,107,45,101,111,102,
+  0,0,2,129,14,175,130,1,129,22,0,1,10,130,138,132,
+  64,172,130,1,134,130,28,182,130,1,129,22,4,10,129,16,
+  179,130,1,150,130,36,254,128,1,10,150,130,1,199,130,1,
+  193,1,0,4,225,1,225,1,0,0,98,115,0,0,129,16,
+  166,50,1,2,129,16,149,27,129,14,211,130,1,129,16,236,
+  49,3,10,129,18,207,130,1,129,16,236,49,3,10,187,130,
+  1,235,130,1,193,1,0,4,225,1,225,1,0,0,99,104,
+  101,99,107,45,98,115,0,0,2,129,14,241,130,1,129,22,
+  8,10,130,138,132,64,238,130,1,134,130,28,248,130,1,129,
+  22,127,10,129,16,245,130,1,150,130,36,199,130,1,10,217,
+  130,1,140,131,1,193,1,0,4,225,1,225,1,0,0,99,
+  104,101,99,107,0,0,129,16,169,130,1,129,16,235,130,1,
+  10,253,130,1,164,131,1,193,1,0,4,225,1,225,1,0,
+  0,99,104,97,114,97,99,116,101,114,0,0,129,16,232,128,
+  1,2,129,16,208,49,10,145,131,1,186,131,1,193,1,0,
+  4,225,1,225,1,0,0,98,117,102,102,101,114,0,0,129,
+  14,196,131,1,129,16,173,128,1,129,16,191,50,8,129,16,
+  162,49,10,1,188,131,1,129,16,221,50,10,170,131,1,221,
+  131,1,193,1,0,4,225,1,225,1,0,0,114,101,97,100,
+  45,116,111,107,101,110,0,0,129,14,237,131,1,129,14,232,
+  131,1,129,16,164,131,1,129,16,140,131,1,129,16,197,129,
+  1,10,1,225,131,1,129,16,215,24,10,1,223,131,1,129,
+  16,186,131,1,129,16,155,60,10,201,131,1,131,132,1,193,
+  1,0,4,225,1,225,1,0,0,105,110,112,117,116,0,0,
+  129,16,221,131,1,129,16,144,130,1,10,244,131,1,153,132,
+  1,193,1,0,4,225,1,225,1,0,0,112,114,111,99,101,
+  115,115,0,0,129,30,146,129,1,129,14,170,132,1,131,6,
+  129,16,238,129,1,129,14,167,132,1,1,146,129,1,129,16,
+  176,38,10,129,18,162,132,1,10,1,157,132,1,129,16,248,
+  28,129,2,210,3,17,129,16,70,10,128,129,1,200,132,1,
+  193,1,143,160,1,0,137,216,150,226,2,172,156,1,225,1,
+  225,1,181,128,4,115,58,103,101,116,45,119,111,114,100,0,
+  0,129,14,227,132,1,129,30,7,129,16,191,50,129,14,218,
+  132,1,129,16,232,128,1,2,129,16,208,49,129,16,235,130,
+  1,129,16,197,129,1,10,1,208,132,1,129,16,215,24,129,
+  16,162,49,129,16,155,60,10,1,202,132,1,129,16,221,50,
+  10,180,132,1,248,132,1,193,1,143,160,1,0,201,198,239,
+  198,1,250,149,1,225,1,225,1,244,205,2,98,97,110,110,
+  101,114,0,0,129,16,178,129,1,129,16,172,54,82,69,84,
+  82,79,32,49,50,32,40,37,110,46,37,110,41,92,110,0,
+  0,1,252,132,1,129,16,238,93,129,16,188,127,129,16,171,
+  103,129,16,205,16,129,16,171,103,18,129,16,205,16,129,16,
+  172,54,37,110,32,77,97,120,44,32,37,110,32,85,115,101,
+  100,44,32,37,110,32,70,114,101,101,92,110,0,0,1,160,
+  133,1,129,16,238,93,129,16,188,127,10,232,132,1,210,133,
+  1,193,1,143,160,1,148,128,229,91,224,153,1,225,1,225,
+  1,141,221,3,108,105,115,116,101,110,0,0,129,16,248,132,
+  1,129,16,131,132,1,129,16,153,132,1,129,14,212,133,1,
+  10,194,133,1,237,133,1,193,1,143,160,1,254,214,154,187,
+  4,163,152,1,225,1,225,1,141,136,3,100,58,114,101,104,
+  97,115,104,0,0,129,14,253,133,1,129,14,246,133,1,129,
+  162,132,120,9,9,8,10,130,138,132,64,241,133,1,6,129,
+  16,213,1,16,10,1,239,133,1,129,16,253,95,10,219,133,
+  1,13,178,1,129,160,1,181,220,228,102,242,147,1,225,1,
+  225,1,145,153,2,66,85,73,76,68,0,0,130,134,1,160,
+  134,1,193,1,189,138,1,178,236,244,121,199,151,1,225,1,
+  225,1,179,236,2,99,111,109,109,97,0,0,129,16,134,1,
+  10,145,134,1,177,134,1,193,1,189,138,1,216,255,212,228,
+  7,219,151,1,225,1,225,1,186,241,2,99,111,110,115,0,
+  0,129,16,217,20,129,14,187,134,1,4,129,16,160,134,1,
+  129,16,160,134,1,10,133,130,32,181,134,1,6,10,163,134,
+  1,204,134,1,193,1,189,138,1,251,201,161,92,131,151,1,
+  225,1,225,1,212,222,2,99,97,114,0,0,10,191,134,1,
+  218,134,1,193,1,189,138,1,222,202,161,92,157,151,1,225,
+  1,225,1,233,224,2,99,100,114,0,0,129,34,1,10,205,
+  134,1,235,134,1,193,1,189,138,1,155,137,212,228,7,139,
+  151,1,225,1,225,1,155,223,2,99,97,114,64,0,0,129,
+  16,204,134,1,15,10,221,134,1,253,134,1,193,1,189,138,
+  1,252,136,212,228,7,135,151,1,225,1,225,1,251,222,2,
+  99,97,114,33,0,0,129,16,204,134,1,16,10,239,134,1,
+  143,135,1,193,1,189,138,1,222,162,212,228,7,165,151,1,
+  225,1,225,1,176,225,2,99,100,114,64,0,0,129,16,218,
+  134,1,15,10,129,135,1,161,135,1,193,1,189,138,1,191,
+  162,212,228,7,161,151,1,225,1,225,1,144,225,2,99,100,
+  114,33,0,0,129,16,218,134,1,16,10,147,135,1,178,135,
+  1,193,1,189,138,1,188,197,159,92,254,147,1,225,1,225,
+  1,202,161,2,69,78,68,0,0,10,165,135,1,199,135,1,
+  193,1,189,138,1,241,190,198,16,238,152,1,225,1,225,1,
+  180,199,3,102,108,108,58,99,114,101,97,116,101,0,0,1,
+  178,135,1,129,16,177,134,1,10,179,135,1,215,135,1,178,
+  1,0,0,151,236,10,0,0,225,1,225,1,0,0,114,0,
+  0,145,132,2,179,135,1,236,135,1,193,1,189,138,1,164,
+  199,145,203,2,137,153,1,225,1,225,1,252,201,3,102,108,
+  108,58,116,111,45,101,110,100,0,0,130,130,64,215,135,1,
+  129,14,128,136,1,129,16,143,135,1,130,130,176,16,178,135,
+  1,129,14,250,135,1,133,132,152,32,129,32,215,135,1,10,
+  129,2,246,135,1,194,22,129,16,70,10,1,240,135,1,129,
+  16,186,24,129,30,215,135,1,10,216,135,1,161,136,1,193,
+  1,189,138,1,129,188,204,147,2,234,152,1,225,1,225,1,
+  150,199,3,102,108,108,58,97,112,112,101,110,100,47,118,97,
+  108,117,101,0,0,1,178,135,1,129,16,177,134,1,4,129,
+  16,236,135,1,129,16,161,135,1,10,135,136,1,193,136,1,
+  193,1,189,138,1,165,152,209,162,1,141,153,1,225,1,225,
+  1,191,202,3,102,108,108,58,116,111,45,105,110,100,101,120,
+  0,0,1,143,135,1,129,16,147,25,10,171,136,1,215,136,
+  1,193,1,189,138,1,0,155,186,217,205,9,242,152,1,225,
+  1,225,1,248,199,3,102,108,108,58,100,101,108,0,0,133,
+  132,152,32,133,132,152,32,129,36,1,129,16,193,136,1,129,
+  14,228,136,1,129,34,1,129,16,193,136,1,10,133,130,32,
+  223,136,1,6,129,16,161,135,1,10,198,136,1,250,136,1,
+  178,1,0,0,0,185,156,134,148,11,0,0,225,1,225,1,
+  0,0,65,99,116,105,111,110,0,0,250,139,1,198,136,1,
+  145,137,1,193,1,189,138,1,0,251,253,160,169,7,249,152,
+  1,225,1,225,1,193,200,3,102,108,108,58,102,111,114,45,
+  101,97,99,104,0,0,129,32,250,136,1,129,14,164,137,1,
+  129,14,156,137,1,129,16,235,134,1,129,158,32,250,136,1,
+  10,130,138,132,64,151,137,1,6,129,16,143,135,1,130,130,
+  48,178,135,1,10,1,149,137,1,129,16,186,24,3,10,251,
+  136,1,190,137,1,193,1,189,138,1,255,174,167,177,1,130,
+  153,1,225,1,225,1,180,201,3,102,108,108,58,108,101,110,
+  103,116,104,0,0,129,8,0,0,129,14,197,137,1,131,130,
+  68,1,10,1,194,137,1,129,16,145,137,1,129,36,1,10,
+  170,137,1,222,137,1,193,1,189,138,1,210,239,252,189,1,
+  246,152,1,225,1,225,1,159,200,3,102,108,108,58,100,114,
+  111,112,0,0,2,129,16,190,137,1,129,36,1,129,16,193,
+  136,1,129,8,178,135,1,129,16,161,135,1,10,204,137,1,
+  245,137,1,178,1,0,0,142,236,10,0,0,225,1,225,1,
+  0,0,105,0,2,204,137,1,138,138,1,193,1,189,138,1,
+  250,251,171,126,253,152,1,225,1,225,1,239,200,3,102,108,
+  108,58,105,110,106,101,99,116,0,0,129,16,199,135,1,129,
+  160,148,16,245,137,1,134,136,148,16,134,136,132,144,1,1,
+  129,16,193,136,1,1,193,136,1,129,16,139,23,129,158,16,
+  245,137,1,129,16,161,135,1,129,30,245,137,1,129,16,161,
+  135,1,10,246,137,1,177,138,1,193,1,189,138,1,0,211,
+  229,215,205,9,134,153,1,225,1,225,1,209,201,3,102,108,
+  108,58,112,117,116,0,0,129,14,184,138,1,129,16,208,127,
+  129,16,150,127,10,1,179,138,1,129,16,145,137,1,10,105,
+  110,116,101,114,102,97,99,101,47,108,108,46,114,101,116,114,
+  111,0,0,105,110,105,116,0,0,208,138,1,216,140,1,160,
+  138,1,237,138,1,178,1,194,140,1,0,167,217,130,144,13,
+  248,155,1,225,1,225,1,231,249,3,115,58,100,101,100,117,
+  112,46,100,97,116,97,0,0,213,138,1,215,138,1,250,138,
+  1,178,1,0,0,234,242,229,2,0,0,225,1,225,1,0,
+  0,116,49,0,0,224,255,30,238,138,1,135,139,1,178,1,
+  0,0,235,242,229,2,0,0,225,1,225,1,0,0,116,50,
+  0,0,207,133,2,215,138,1,162,139,1,193,1,194,140,1,
+  0,209,170,208,18,131,156,1,225,1,225,1,208,251,3,115,
+  58,100,101,100,117,112,46,114,101,103,105,115,116,101,114,0,
+  0,129,16,204,54,129,158,144,8,237,138,1,161,136,1,129,
+  16,155,23,10,136,139,1,196,139,1,193,1,194,140,1,224,
+  212,144,135,1,251,155,1,225,1,225,1,156,250,3,115,58,
+  100,101,100,117,112,46,100,101,102,105,110,101,100,63,0,0,
+  129,160,132,8,250,138,1,0,0,135,139,1,144,130,60,237,
+  138,1,129,14,213,139,1,129,30,250,138,1,129,16,122,129,
+  158,216,8,135,139,1,135,139,1,16,10,1,204,139,1,129,
+  16,145,137,1,129,30,135,139,1,10,170,139,1,242,139,1,
+  193,1,194,140,1,0,153,241,248,143,13,255,155,1,225,1,
+  225,1,211,250,3,115,58,100,101,100,117,112,46,102,105,110,
+  100,0,0,129,160,132,8,250,138,1,0,0,135,139,1,144,
+  130,60,237,138,1,129,14,137,140,1,130,130,60,250,138,1,
+  129,16,122,129,14,131,140,1,129,32,135,139,1,10,129,2,
+  128,140,1,17,129,16,70,10,1,250,139,1,129,16,145,137,
+  1,129,30,135,139,1,10,220,139,1,161,140,1,193,1,194,
+  140,1,164,148,251,181,2,244,155,1,225,1,225,1,186,249,
+  3,115,58,100,101,100,117,112,0,0,129,16,241,53,2,129,
+  16,196,139,1,129,2,242,139,1,162,139,1,129,16,70,10,
+  144,140,1,191,140,1,193,1,194,140,1,168,138,187,28,171,
+  157,1,225,1,225,1,198,146,4,115,58,117,110,105,113,117,
+  101,63,0,0,129,16,196,139,1,10,105,110,116,101,114,102,
+  97,99,101,47,100,101,100,117,112,46,114,101,116,114,111,0,
+  0,194,140,1,209,159,1,129,14,238,140,1,129,16,233,25,
+  129,16,172,54,77,101,116,97,100,97,116,97,0,0,1,224,
+  140,1,129,16,232,21,10,1,220,140,1,172,140,1,130,141,
+  1,178,1,211,159,1,0,243,137,220,1,187,146,1,225,1,
+  225,1,215,229,4,77,101,116,97,100,97,116,97,0,0,0,
+  1,240,140,1,2,178,1,0,0,179,217,195,106,0,0,225,
+  1,225,1,0,0,83,84,65,67,75,45,67,79,77,77,69,
+  78,84,45,83,84,82,73,78,71,45,79,70,70,83,69,84,
+  0,0,131,141,1,182,141,1,193,1,0,0,212,150,247,228,
+  7,0,0,225,1,225,1,0,0,115,97,118,101,0,0,129,
+  34,1,129,16,155,60,129,16,217,20,4,129,16,204,54,1,
+  17,129,16,199,1,129,34,2,129,16,244,16,129,16,215,1,
+  16,10,168,141,1,227,141,1,193,1,0,0,0,139,164,249,
+  146,10,0,0,225,1,225,1,0,0,115,116,97,99,107,45,
+  99,111,109,109,101,110,116,63,0,0,130,2,0,0,129,16,
+  246,59,129,22,58,10,240,140,1,251,141,1,205,1,211,159,
+  1,0,193,172,177,182,13,214,157,1,225,1,225,1,233,157,
+  4,115,105,103,105,108,58,40,0,0,129,16,227,141,1,129,
+  158,212,8,130,141,1,182,141,1,1,17,129,16,70,10,234,
+  141,1,153,142,1,193,1,211,159,1,132,244,175,211,3,182,
+  146,1,225,1,225,1,204,133,3,100,58,109,101,116,97,100,
+  97,116,97,0,0,129,14,227,220,1,131,6,129,16,147,54,
+  10,133,142,1,173,142,1,193,1,0,0,198,208,247,228,7,
+  0,0,225,1,225,1,0,0,115,104,111,119,0,0,2,129,
+  16,230,27,129,2,188,127,17,129,16,70,129,16,133,127,10,
+  159,142,1,199,142,1,193,1,0,0,201,166,192,123,0,0,
+  225,1,225,1,0,0,102,105,101,108,100,0,0,129,14,205,
+  142,1,133,132,152,32,132,16,15,10,133,130,32,201,142,1,
+  6,133,132,152,32,129,16,208,27,129,158,132,184,1,130,141,
+  1,0,1,21,129,14,224,142,1,132,6,133,132,152,32,129,
+  162,16,9,129,16,153,142,1,10,129,2,217,142,1,17,129,
+  16,70,129,16,173,142,1,10,133,142,1,252,142,1,193,1,
+  211,159,1,0,247,177,237,224,2,254,142,1,225,1,225,1,
+  168,212,4,100,58,100,101,115,99,114,105,98,101,0,0,129,
+  16,172,54,115,45,0,0,129,6,254,142,1,129,16,155,2,
+  25,129,16,133,127,2,129,16,172,54,78,97,109,101,58,32,
+  32,32,32,32,0,0,1,139,143,1,129,16,188,127,129,34,
+  9,129,16,188,127,129,16,133,127,2,129,16,172,54,65,100,
+  100,114,101,115,115,58,32,32,0,0,1,163,143,1,129,16,
+  188,127,129,162,60,1,129,16,208,127,129,16,133,127,2,129,
+  16,172,54,67,108,97,115,115,58,32,32,32,32,0,0,1,
+  187,143,1,129,16,188,127,129,162,188,16,2,129,16,208,127,
+  129,16,162,96,2,129,16,230,27,129,14,220,143,1,129,16,
+  150,127,129,34,9,129,16,188,127,10,129,2,213,143,1,17,
+  129,16,70,129,16,133,127,2,129,16,172,54,83,111,117,114,
+  99,101,58,32,32,32,0,0,1,230,143,1,129,16,188,127,
+  129,16,211,1,15,129,16,173,142,1,129,16,172,54,83,116,
+  97,99,107,58,32,32,32,32,0,0,1,252,143,1,129,16,
+  188,127,129,2,215,1,0,0,129,16,199,142,1,129,16,172,
+  54,65,46,32,83,116,97,99,107,58,32,0,0,1,146,144,
+  1,129,16,188,127,129,2,217,1,1,129,16,199,142,1,129,
+  16,172,54,70,108,111,97,116,58,32,32,32,32,0,0,1,
+  168,144,1,129,16,188,127,129,2,219,1,2,129,16,199,142,
+  1,129,16,172,54,68,101,115,99,114,58,32,32,32,32,0,
+  0,1,190,144,1,129,16,188,127,129,2,221,1,3,129,16,
+  199,142,1,3,10,232,142,1,241,144,1,193,1,211,159,1,
+  242,233,183,246,5,243,144,1,225,1,225,1,193,212,4,100,
+  58,115,101,116,45,115,116,97,99,107,45,99,111,109,109,101,
+  110,116,0,0,129,16,172,54,115,115,45,0,0,129,6,243,
+  144,1,129,16,155,2,2,129,16,230,27,129,158,84,130,141,
+  1,129,14,138,145,1,129,16,215,1,1,204,54,129,16,139,
+  23,16,10,129,2,130,145,1,215,22,129,16,70,10,212,144,
+  1,174,145,1,193,1,211,159,1,0,153,246,130,18,176,145,
+  1,225,1,225,1,134,213,4,100,58,115,101,116,45,97,115,
+  116,97,99,107,45,99,111,109,109,101,110,116,0,0,129,16,
+  172,54,115,115,45,0,0,129,6,176,145,1,129,16,155,2,
+  2,129,16,230,27,129,158,84,130,141,1,129,14,199,145,1,
+  129,16,217,1,1,204,54,129,16,139,23,16,10,129,2,191,
+  145,1,215,22,129,16,70,10,144,145,1,235,145,1,193,1,
+  211,159,1,152,133,131,185,2,237,145,1,225,1,225,1,227,
+  212,4,100,58,115,101,116,45,102,115,116,97,99,107,45,99,
+  111,109,109,101,110,116,0,0,129,16,172,54,115,115,45,0,
+  0,129,6,237,145,1,129,16,155,2,2,129,16,230,27,129,
+  158,84,130,141,1,129,14,132,146,1,129,16,219,1,1,204,
+  54,129,16,139,23,16,10,129,2,252,145,1,215,22,129,16,
+  70,10,110,45,0,0,45,110,0,0,45,97,0,0,97,45,
+  102,0,0,110,45,115,0,0,115,45,115,0,0,115,45,115,
+  102,0,0,45,0,0,100,45,97,0,0,100,45,97,0,0,
+  100,45,97,0,0,100,45,97,0,0,115,110,45,115,0,0,
+  45,97,0,0,45,99,0,0,45,115,0,0,45,0,0,45,
+  0,0,110,110,45,110,0,0,110,110,45,110,0,0,110,45,
+  0,0,110,110,45,110,0,0,45,0,0,110,110,45,102,0,
+  0,102,113,45,0,0,102,113,45,0,0,110,109,45,118,0,
+  0,110,109,45,114,118,0,0,110,45,110,32,124,124,32,110,
+  45,0,0,45,0,0,110,45,110,110,32,124,124,32,110,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  110,0,0,45,110,0,0,45,110,0,0,45,110,0,0,45,
+  97,0,0,45,97,0,0,45,97,0,0,45,0,0,45,97,
+  0,0,45,110,0,0,45,110,0,0,45,97,0,0,45,110,
+  0,0,45,97,0,0,45,110,0,0,45,110,0,0,45,97,
+  0,0,45,97,0,0,45,97,0,0,45,97,0,0,45,97,
+  0,0,45,110,0,0,45,97,0,0,45,97,0,0,45,97,
+  0,0,45,0,0,45,0,0,97,97,45,102,0,0,97,97,
+  45,97,0,0,97,97,45,102,0,0,97,45,97,0,0,115,
+  97,45,102,0,0,110,97,45,102,0,0,97,97,45,0,0,
+  113,45,97,0,0,97,45,98,0,0,97,97,45,102,0,0,
+  97,97,45,102,0,0,97,110,45,110,0,0,97,113,45,98,
+  0,0,97,45,110,0,0,97,113,45,0,0,115,45,97,0,
+  0,97,45,110,0,0,97,110,45,110,0,0,97,115,45,110,
+  0,0,97,118,45,97,0,0,97,115,45,97,0,0,97,45,
+  110,0,0,97,110,45,97,0,0,97,45,110,0,0,113,45,
+  97,0,0,97,113,45,98,0,0,97,102,108,45,97,0,0,
+  97,97,45,97,0,0,112,110,113,45,110,0,0,97,45,98,
+  0,0,97,110,45,97,0,0,118,97,110,45,0,0,97,45,
+  97,0,0,97,110,45,98,0,0,97,45,115,0,0,45,0,
+  0,110,45,0,0,110,109,45,111,0,0,97,45,110,0,0,
+  97,45,97,110,0,0,110,97,45,0,0,110,97,45,97,0,
+  0,97,45,97,0,0,45,0,0,120,113,113,45,63,0,0,
+  120,121,113,113,45,63,0,0,120,121,113,45,63,0,0,45,
+  0,0,110,45,0,0,45,0,0,45,97,0,0,45,110,0,
+  0,113,45,0,0,97,45,0,0,45,110,0,0,45,97,0,
+  0,45,0,0,99,45,102,0,0,99,45,102,0,0,99,45,
+  102,0,0,99,45,102,0,0,99,45,102,0,0,99,45,102,
+  0,0,99,45,102,0,0,99,45,102,0,0,99,45,102,0,
+  0,45,99,0,0,99,45,102,0,0,99,45,102,0,0,99,
+  45,0,0,99,45,99,0,0,99,45,110,0,0,99,45,115,
+  0,0,99,45,99,0,0,99,45,99,0,0,99,45,102,0,
+  0,99,45,102,0,0,99,45,102,0,0,99,45,102,0,0,
+  97,45,0,0,97,45,97,0,0,110,97,45,0,0,97,45,
+  110,0,0,110,109,113,45,32,124,124,32,110,109,113,45,110,
+  0,0,97,45,97,0,0,110,97,45,0,0,97,45,110,0,
+  0,102,113,113,45,0,0,97,45,0,0,110,45,32,124,124,
+  32,110,45,110,0,0,97,45,0,0,97,45,0,0,97,45,
+  0,0,97,45,0,0,110,45,0,0,97,45,0,0,97,45,
+  0,0,110,45,0,0,110,45,0,0,45,0,0,45,102,0,
+  0,120,121,45,97,0,0,110,115,45,0,0,115,100,108,45,
+  0,0,110,113,45,113,0,0,110,45,0,0,115,97,97,45,
+  0,0,100,45,97,0,0,115,45,0,0,113,45,0,0,100,
+  45,97,0,0,45,97,0,0,45,100,0,0,45,97,0,0,
+  45,115,0,0,45,97,0,0,100,45,97,0,0,115,45,100,
+  0,0,97,45,100,0,0,100,45,115,0,0,45,0,0,45,
+  97,0,0,100,45,97,0,0,100,45,97,0,0,45,0,0,
+  45,0,0,45,110,0,0,110,113,45,110,0,0,113,45,0,
+  0,110,45,0,0,110,110,45,0,0,45,0,0,110,45,110,
+  110,0,0,110,109,45,110,109,110,109,0,0,45,0,0,110,
+  110,45,102,0,0,97,45,110,0,0,97,45,97,110,0,0,
+  118,112,110,45,0,0,112,118,45,0,0,118,45,112,0,0,
+  112,110,45,0,0,112,45,0,0,112,113,45,0,0,112,110,
+  118,45,0,0,112,45,110,0,0,112,45,0,0,112,45,112,
+  0,0,112,110,45,112,0,0,113,45,0,0,97,45,0,0,
+  110,110,45,102,0,0,110,110,45,102,0,0,97,45,110,0,
+  0,97,45,97,110,0,0,110,97,45,0,0,110,97,45,97,
+  0,0,45,97,0,0,45,0,0,45,0,0,115,45,0,0,
+  102,113,45,0,0,102,113,45,0,0,45,0,0,110,113,45,
+  0,0,45,0,0,115,45,0,0,45,110,0,0,110,45,0,
+  0,110,45,109,78,0,0,110,45,109,0,0,45,0,0,110,
+  110,45,102,0,0,110,110,45,102,0,0,110,109,45,111,0,
+  0,110,45,102,0,0,45,110,0,0,45,110,0,0,110,45,
+  110,0,0,110,110,45,110,0,0,110,108,117,45,102,0,0,
+  110,45,109,0,0,110,109,45,118,0,0,110,109,45,114,118,
+  0,0,110,45,102,0,0,110,45,109,0,0,110,108,117,45,
+  109,0,0,109,110,45,111,0,0,109,110,45,111,0,0,110,
+  109,45,111,0,0,110,110,45,110,0,0,110,45,110,0,0,
+  110,45,102,0,0,110,45,102,0,0,110,45,102,0,0,98,
+  112,45,110,0,0,110,45,0,0,110,45,109,0,0,110,45,
+  109,0,0,110,45,102,0,0,110,110,45,110,0,0,110,45,
+  115,0,0,110,45,102,0,0,110,109,45,109,0,0,45,0,
+  0,110,45,109,0,0,45,0,0,109,110,45,111,0,0,110,
+  109,45,110,109,110,0,0,110,110,110,110,45,110,0,0,45,
+  110,0,0,45,0,0,110,45,0,0,115,45,0,0,97,45,
+  0,0,46,46,46,115,115,45,63,0,0,45,0,0,46,46,
+  46,45,0,0,97,98,99,45,98,99,97,0,0,115,45,0,
+  0,45,115,0,0,45,115,0,0,45,115,0,0,45,115,0,
+  0,45,115,0,0,45,115,0,0,115,115,45,115,0,0,115,
+  115,45,102,0,0,115,83,113,45,32,124,124,32,115,83,113,
+  45,115,0,0,115,45,115,0,0,115,115,45,0,0,115,99,
+  45,102,0,0,115,115,45,102,0,0,115,97,45,0,0,115,
+  45,115,0,0,45,97,0,0,115,45,102,0,0,115,45,115,
+  0,0,115,45,0,0,45,115,0,0,115,115,45,102,0,0,
+  115,115,45,102,0,0,115,45,63,0,0,115,110,45,110,0,
+  0,115,113,45,115,0,0,115,113,45,0,0,46,46,46,115,
+  45,115,0,0,45,115,0,0,115,45,110,0,0,115,99,45,
+  110,0,0,115,115,45,110,0,0,115,45,115,0,0,115,110,
+  45,115,0,0,115,45,110,0,0,115,113,45,115,0,0,115,
+  115,45,115,0,0,115,45,0,0,115,115,115,45,115,0,0,
+  115,115,115,45,115,0,0,115,45,115,0,0,115,110,45,115,
+  0,0,45,0,0,115,99,45,115,115,0,0,115,115,45,115,
+  115,0,0,99,115,110,45,0,0,115,102,108,45,115,0,0,
+  115,45,115,0,0,115,45,115,0,0,115,45,110,0,0,115,
+  45,115,0,0,115,99,45,97,0,0,115,115,45,97,0,0,
+  115,45,115,0,0,115,45,115,0,0,115,45,115,0,0,115,
+  45,102,0,0,97,97,45,0,0,109,110,45,111,0,0,109,
+  110,45,111,0,0,109,110,45,111,0,0,110,115,45,0,0,
+  115,45,110,0,0,115,45,99,0,0,115,45,97,0,0,115,
+  45,115,0,0,115,45,0,0,115,45,0,0,115,45,110,0,
+  0,115,45,0,0,115,45,0,0,115,45,0,0,115,45,0,
+  0,110,113,40,63,110,45,63,41,45,110,0,0,45,0,0,
+  110,97,45,0,0,110,97,45,97,0,0,110,109,45,109,110,
+  0,0,45,0,0,45,0,0,110,113,45,0,0,120,113,113,
+  113,45,63,0,0,120,121,122,113,113,113,45,63,0,0,120,
+  121,122,113,45,63,0,0,110,109,45,109,110,109,0,0,97,
+  45,0,0,110,45,110,110,110,110,0,0,113,40,45,102,41,
+  45,0,0,97,45,0,0,110,97,45,0,0,97,45,0,0,
+  110,97,45,0,0,97,108,117,45,0,0,97,45,0,0,97,
+  45,0,0,97,113,45,0,0,97,113,45,0,0,115,45,0,
+  0,110,115,45,0,0,115,115,45,0,0,97,45,110,0,0,
+  97,45,97,110,0,0,110,97,45,0,0,110,97,45,97,0,
+  0,113,40,45,102,41,45,0,0,109,110,45,111,0,0,45,
+  0,0,45,0,0,45,97,0,0,45,0,0,205,145,1,168,
+  159,1,193,1,185,159,1,237,233,228,245,1,170,159,1,225,
+  1,225,1,158,137,3,100,58,115,101,116,45,115,111,117,114,
+  99,101,0,0,129,16,172,54,115,115,45,0,0,129,134,4,
+  170,159,1,161,140,1,129,16,139,23,129,16,155,2,129,16,
+  211,1,16,10,105,110,116,101,114,102,97,99,101,47,115,111,
+  117,114,99,101,115,46,114,101,116,114,111,0,0,185,159,1,
+  242,159,1,105,110,116,101,114,102,97,99,101,47,115,116,97,
+  99,107,45,99,111,109,109,101,110,116,115,46,114,101,116,114,
+  111,0,0,211,159,1,255,159,1,114,101,116,114,111,46,109,
+  117,114,105,0,0,244,159,1,141,160,1,98,117,105,108,100,
+  46,114,101,116,114,111,0,0,129,160,1,155,160,1,114,101,
+  116,114,111,46,102,111,114,116,104,0,0,143,160,1,253,164,
+  1,146,159,1,0,0,178,1,229,164,1,224,192,212,11,182,
+  160,1,225,1,225,1,218,158,2,68,69,86,73,67,69,58,
+  79,85,84,80,85,84,0,0,45,110,0,0,157,160,1,1,
+  178,1,229,164,1,0,191,141,156,172,8,210,160,1,225,1,
+  225,1,230,157,2,68,69,86,73,67,69,58,75,69,89,66,
+  79,65,82,68,0,0,45,110,0,0,183,160,1,2,178,1,
+  229,164,1,0,207,158,249,194,2,236,160,1,225,1,225,1,
+  243,156,2,68,69,86,73,67,69,58,70,76,79,65,84,83,
+  0,0,45,110,0,0,211,160,1,4,178,1,229,164,1,0,
+  251,151,242,9,133,161,1,225,1,225,1,203,156,2,68,69,
+  86,73,67,69,58,70,73,76,69,83,0,0,45,110,0,0,
+  237,160,1,3,178,1,229,164,1,0,165,139,158,216,3,159,
+  161,1,225,1,225,1,138,155,2,68,69,86,73,67,69,58,
+  66,76,79,67,75,83,0,0,45,110,0,0,134,161,1,5,
+  178,1,229,164,1,0,201,247,150,13,184,161,1,225,1,225,
+  1,174,155,2,68,69,86,73,67,69,58,67,76,79,67,75,
+  0,0,45,110,0,0,160,161,1,6,178,1,229,164,1,0,
+  181,210,201,166,6,213,161,1,225,1,225,1,186,159,2,68,
+  69,86,73,67,69,58,82,69,83,69,82,86,69,68,54,0,
+  0,45,110,0,0,185,161,1,7,178,1,229,164,1,152,140,
+  207,82,239,161,1,225,1,225,1,164,160,2,68,69,86,73,
+  67,69,58,83,79,67,75,69,84,0,0,45,110,0,0,214,
+  161,1,8,178,1,229,164,1,0,153,198,239,220,8,135,162,
+  1,225,1,225,1,194,160,2,68,69,86,73,67,69,58,85,
+  78,73,88,0,0,45,110,0,0,240,161,1,9,178,1,229,
+  164,1,130,130,147,174,2,164,162,1,225,1,225,1,252,159,
+  2,68,69,86,73,67,69,58,83,67,82,73,80,84,73,78,
+  71,0,0,45,110,0,0,136,162,1,10,178,1,229,164,1,
+  0,147,216,166,243,11,187,162,1,225,1,225,1,206,159,2,
+  68,69,86,73,67,69,58,82,78,71,0,0,45,110,0,0,
+  165,162,1,11,178,1,229,164,1,0,221,161,254,248,15,217,
+  162,1,225,1,225,1,254,158,2,68,69,86,73,67,69,58,
+  82,69,83,69,82,86,69,68,49,49,0,0,45,110,0,0,
+  188,162,1,12,178,1,229,164,1,0,219,161,254,248,15,247,
+  162,1,225,1,225,1,146,159,2,68,69,86,73,67,69,58,
+  82,69,83,69,82,86,69,68,49,50,0,0,45,110,0,0,
+  218,162,1,13,178,1,229,164,1,0,217,161,254,248,15,149,
+  163,1,225,1,225,1,166,159,2,68,69,86,73,67,69,58,
+  82,69,83,69,82,86,69,68,49,51,0,0,45,110,0,0,
+  248,162,1,14,178,1,229,164,1,0,171,218,166,6,174,163,
+  1,225,1,225,1,187,157,2,68,69,86,73,67,69,58,73,
+  79,67,84,76,0,0,45,110,0,0,150,163,1,15,178,1,
+  229,164,1,0,177,191,156,74,200,163,1,225,1,225,1,139,
+  158,2,68,69,86,73,67,69,58,77,65,76,76,79,67,0,
+  0,45,110,0,0,175,163,1,232,7,178,1,229,164,1,0,
+  155,230,175,6,225,163,1,225,1,225,1,152,157,2,68,69,
+  86,73,67,69,58,73,77,65,71,69,0,0,45,110,0,0,
+  201,163,1,210,9,178,1,229,164,1,0,141,209,218,10,250,
+  163,1,225,1,225,1,208,155,2,68,69,86,73,67,69,58,
+  69,82,82,79,82,0,0,45,110,0,0,226,163,1,192,62,
+  178,1,229,164,1,195,130,250,149,5,151,164,1,225,1,225,
+  1,178,158,2,68,69,86,73,67,69,58,77,85,76,84,73,
+  67,79,82,69,0,0,45,110,0,0,251,163,1,136,64,178,
+  1,229,164,1,0,247,254,164,221,2,177,164,1,225,1,225,
+  1,245,155,2,68,69,86,73,67,69,58,69,86,69,78,84,
+  83,0,0,45,110,0,0,152,164,1,164,63,178,1,229,164,
+  1,0,183,168,168,243,11,200,164,1,225,1,225,1,154,156,
+  2,68,69,86,73,67,69,58,70,70,73,0,0,45,110,0,
+  0,178,164,1,165,63,178,1,229,164,1,0,231,149,204,142,
+  12,228,164,1,225,1,225,1,229,160,2,68,69,86,73,67,
+  69,58,85,78,83,73,71,78,69,68,0,0,45,110,0,0,
+  105,110,116,101,114,102,97,99,101,47,100,101,118,105,99,101,
+  115,46,114,101,116,114,111,0,0,229,164,1,241,190,1,201,
+  164,1,152,165,1,193,1,211,190,1,198,201,170,160,4,154,
+  165,1,225,1,225,1,131,203,3,102,108,111,97,116,58,111,
+  112,101,114,97,116,105,111,110,0,0,129,16,172,54,110,45,
+  0,0,129,134,4,154,165,1,2,129,16,198,126,2,129,16,
+  255,27,129,14,216,165,1,3,129,16,172,54,69,114,114,111,
+  114,58,32,102,108,111,97,116,105,110,103,32,112,111,105,110,
+  116,32,100,101,118,105,99,101,32,110,111,116,32,102,111,117,
+  110,100,0,0,1,170,165,1,129,16,188,127,129,16,133,127,
+  10,1,167,165,1,129,16,248,28,129,16,175,126,10,255,164,
+  1,243,165,1,193,1,211,190,1,147,210,166,169,3,245,165,
+  1,225,1,243,192,1,179,233,3,110,58,116,111,45,102,108,
+  111,97,116,0,0,129,16,172,54,110,45,95,102,58,45,110,
+  0,0,129,134,4,245,165,1,0,0,129,16,152,165,1,10,
+  223,165,1,151,166,1,193,1,211,190,1,184,253,249,202,4,
+  153,166,1,225,1,249,192,1,188,141,4,115,58,116,111,45,
+  102,108,111,97,116,0,0,129,16,172,54,115,45,95,102,58,
+  45,110,0,0,129,134,4,153,166,1,1,129,16,152,165,1,
+  10,131,166,1,188,166,1,193,1,211,190,1,0,131,204,222,
+  211,7,190,166,1,225,1,230,192,1,148,179,3,102,58,116,
+  111,45,110,117,109,98,101,114,0,0,129,16,172,54,102,58,
+  97,45,95,95,45,110,0,0,129,134,4,190,166,1,2,129,
+  16,152,165,1,10,167,166,1,226,166,1,193,1,211,190,1,
+  0,167,142,138,154,6,228,166,1,225,1,233,192,1,194,179,
+  3,102,58,116,111,45,115,116,114,105,110,103,0,0,129,16,
+  172,54,102,58,110,45,95,95,45,115,0,0,129,6,228,166,
+  1,129,16,147,54,130,2,3,129,16,152,165,1,10,205,166,
+  1,131,167,1,193,1,211,190,1,240,216,161,92,133,167,1,
+  225,1,251,190,1,192,152,3,102,58,43,0,0,129,16,172,
+  54,102,58,97,98,45,99,0,0,129,134,4,133,167,1,4,
+  129,16,152,165,1,10,246,166,1,159,167,1,193,1,211,190,
+  1,242,216,161,92,161,167,1,225,1,128,191,1,246,152,3,
+  102,58,45,0,0,129,16,172,54,102,58,97,98,45,99,0,
+  0,129,134,4,161,167,1,5,129,16,152,165,1,10,146,167,
+  1,187,167,1,193,1,211,190,1,239,216,161,92,189,167,1,
+  225,1,246,190,1,133,152,3,102,58,42,0,0,129,16,172,
+  54,102,58,97,98,45,99,0,0,129,134,4,189,167,1,6,
+  129,16,152,165,1,10,174,167,1,215,167,1,193,1,211,190,
+  1,244,216,161,92,217,167,1,225,1,143,191,1,131,155,3,
+  102,58,47,0,0,129,16,172,54,102,58,97,98,45,99,0,
+  0,129,134,4,217,167,1,7,129,16,152,165,1,10,202,167,
+  1,247,167,1,193,1,211,190,1,135,212,199,241,3,249,167,
+  1,225,1,228,191,1,191,166,3,102,58,102,108,111,111,114,
+  0,0,129,16,172,54,102,58,97,98,45,99,0,0,129,134,
+  4,249,167,1,8,129,16,152,165,1,10,230,167,1,153,168,
+  1,193,1,211,190,1,0,255,234,228,213,12,155,168,1,225,
+  1,189,191,1,205,161,3,102,58,99,101,105,108,105,110,103,
+  0,0,129,16,172,54,102,58,102,45,102,0,0,129,134,4,
+  155,168,1,9,129,16,152,165,1,10,134,168,1,183,168,1,
+  193,1,211,190,1,0,225,249,193,93,185,168,1,225,1,206,
+  192,1,215,176,3,102,58,115,113,114,116,0,0,129,16,172,
+  54,102,58,102,45,102,0,0,129,134,4,185,168,1,10,129,
+  16,152,165,1,10,167,168,1,212,168,1,193,1,211,190,1,
+  250,155,217,122,214,168,1,225,1,221,191,1,179,165,3,102,
+  58,101,113,63,0,0,129,16,172,54,102,58,97,98,45,99,
+  0,0,129,134,4,214,168,1,11,129,16,152,165,1,10,197,
+  168,1,243,168,1,193,1,211,190,1,0,177,209,246,95,245,
+  168,1,225,1,136,191,1,210,153,3,102,58,45,101,113,63,
+  0,0,129,16,172,54,102,58,97,98,45,99,0,0,129,134,
+  4,245,168,1,12,129,16,152,165,1,10,227,168,1,145,169,
+  1,193,1,211,190,1,164,216,217,122,147,169,1,225,1,254,
+  191,1,186,169,3,102,58,108,116,63,0,0,129,16,172,54,
+  102,58,97,98,45,99,0,0,129,134,4,147,169,1,13,129,
+  16,152,165,1,10,130,169,1,175,169,1,193,1,211,190,1,
+  223,173,217,122,177,169,1,225,1,232,191,1,131,167,3,102,
+  58,103,116,63,0,0,129,16,172,54,102,58,97,98,45,99,
+  0,0,129,134,4,177,169,1,14,129,16,152,165,1,10,160,
+  169,1,207,169,1,193,1,211,190,1,186,206,167,240,3,209,
+  169,1,225,1,225,1,224,162,3,102,58,100,101,112,116,104,
+  0,0,129,16,172,54,45,110,0,0,129,134,4,209,169,1,
+  15,129,16,152,165,1,10,190,169,1,233,169,1,193,1,211,
+  190,1,238,148,217,122,235,169,1,225,1,208,191,1,213,164,
+  3,102,58,100,117,112,0,0,129,16,172,54,102,58,97,45,
+  97,97,0,0,129,134,4,235,169,1,16,129,16,152,165,1,
+  10,218,169,1,136,170,1,193,1,211,190,1,0,139,209,131,
+  94,138,170,1,225,1,201,191,1,152,163,3,102,58,100,114,
+  111,112,0,0,129,16,172,54,102,58,97,45,0,0,129,134,
+  4,138,170,1,17,129,16,152,165,1,10,248,169,1,165,170,
+  1,193,1,211,190,1,0,191,156,193,93,167,170,1,225,1,
+  217,192,1,247,177,3,102,58,115,119,97,112,0,0,129,16,
+  172,54,102,58,97,98,45,98,97,0,0,129,134,4,167,170,
+  1,18,129,16,152,165,1,10,149,170,1,196,170,1,193,1,
+  211,190,1,167,215,217,122,198,170,1,225,1,249,191,1,132,
+  169,3,102,58,108,111,103,0,0,129,16,172,54,102,58,97,
+  98,45,99,0,0,129,134,4,198,170,1,19,129,16,152,165,
+  1,10,181,170,1,228,170,1,193,1,211,190,1,242,201,162,
+  247,3,230,170,1,225,1,168,192,1,199,173,3,102,58,112,
+  111,119,101,114,0,0,129,16,172,54,102,58,97,98,45,99,
+  0,0,129,134,4,230,170,1,20,129,16,152,165,1,10,211,
+  170,1,130,171,1,193,1,211,190,1,175,145,218,122,132,171,
+  1,225,1,202,192,1,171,176,3,102,58,115,105,110,0,0,
+  129,16,172,54,102,58,102,45,102,0,0,129,134,4,132,171,
+  1,21,129,16,152,165,1,10,243,170,1,159,171,1,193,1,
+  211,190,1,232,151,218,122,161,171,1,225,1,223,192,1,182,
+  178,3,102,58,116,97,110,0,0,129,16,172,54,102,58,102,
+  45,102,0,0,129,134,4,161,171,1,22,129,16,152,165,1,
+  10,144,171,1,188,171,1,193,1,211,190,1,234,138,217,122,
+  190,171,1,225,1,193,191,1,158,162,3,102,58,99,111,115,
+  0,0,129,16,172,54,102,58,102,45,102,0,0,129,134,4,
+  190,171,1,23,129,16,152,165,1,10,173,171,1,218,171,1,
+  193,1,211,190,1,0,223,215,144,94,220,171,1,225,1,171,
+  191,1,202,158,3,102,58,97,115,105,110,0,0,129,16,172,
+  54,102,58,102,45,102,0,0,129,134,4,220,171,1,24,129,
+  16,152,165,1,10,202,171,1,248,171,1,193,1,211,190,1,
+  0,233,228,146,94,250,171,1,225,1,167,191,1,214,157,3,
+  102,58,97,99,111,115,0,0,129,16,172,54,102,58,102,45,
+  102,0,0,129,134,4,250,171,1,25,129,16,152,165,1,10,
+  232,171,1,150,172,1,193,1,211,190,1,0,237,202,144,94,
+  152,172,1,225,1,175,191,1,250,158,3,102,58,97,116,97,
+  110,0,0,129,16,172,54,102,58,102,45,102,0,0,129,134,
+  4,152,172,1,26,129,16,152,165,1,10,134,172,1,180,172,
+  1,193,1,211,190,1,0,245,201,206,93,182,172,1,225,1,
+  173,192,1,239,173,3,102,58,112,117,115,104,0,0,129,16,
+  172,54,102,58,102,45,0,0,129,134,4,182,172,1,27,129,
+  16,152,165,1,10,164,172,1,208,172,1,193,1,211,190,1,
+  180,249,217,122,210,172,1,225,1,162,192,1,202,172,3,102,
+  58,112,111,112,0,0,129,16,172,54,102,58,45,102,0,0,
+  129,134,4,210,172,1,28,129,16,152,165,1,10,193,172,1,
+  239,172,1,193,1,211,190,1,0,201,236,134,125,241,172,1,
+  225,1,225,1,136,158,3,102,58,97,100,101,112,116,104,0,
+  0,129,16,172,54,45,110,0,0,129,134,4,241,172,1,29,
+  129,16,152,165,1,10,221,172,1,138,173,1,193,1,211,190,
+  1,0,189,241,210,93,140,173,1,225,1,155,192,1,138,172,
+  3,102,58,111,118,101,114,0,0,129,16,172,54,102,58,97,
+  98,45,97,98,97,0,0,129,6,140,173,1,129,16,180,172,
+  1,129,16,233,169,1,129,16,208,172,1,129,16,165,170,1,
+  10,250,172,1,176,173,1,193,1,211,190,1,0,135,140,189,
+  93,178,173,1,225,1,236,192,1,240,179,3,102,58,116,117,
+  99,107,0,0,129,16,172,54,102,58,97,98,45,98,97,98,
+  0,0,129,6,178,173,1,129,16,233,169,1,129,16,180,172,
+  1,129,16,165,170,1,129,16,208,172,1,10,160,173,1,213,
+  173,1,193,1,211,190,1,236,230,217,122,215,173,1,225,1,
+  150,192,1,227,171,3,102,58,110,105,112,0,0,129,16,172,
+  54,102,58,97,98,45,98,0,0,129,6,215,173,1,129,16,
+  165,170,1,129,16,136,170,1,10,198,173,1,250,173,1,193,
+  1,211,190,1,179,167,237,190,1,252,173,1,225,1,204,191,
+  1,202,163,3,102,58,100,114,111,112,45,112,97,105,114,0,
+  0,129,16,172,54,102,58,97,98,45,0,0,129,6,252,173,
+  1,129,16,136,170,1,129,16,136,170,1,10,229,173,1,157,
+  174,1,193,1,211,190,1,0,177,244,180,146,9,159,174,1,
+  225,1,213,191,1,137,165,3,102,58,100,117,112,45,112,97,
+  105,114,0,0,129,16,172,54,102,58,97,98,45,97,98,97,
+  98,0,0,129,6,159,174,1,129,16,138,173,1,129,16,138,
+  173,1,10,137,174,1,191,174,1,193,1,211,190,1,186,138,
+  218,122,193,174,1,225,1,179,192,1,197,174,3,102,58,114,
+  111,116,0,0,129,16,172,54,102,58,97,98,99,45,98,99,
+  97,0,0,129,6,193,174,1,129,16,180,172,1,129,16,165,
+  170,1,129,16,208,172,1,129,16,165,170,1,10,176,174,1,
+  231,174,1,205,1,211,190,1,0,181,172,177,182,13,233,174,
+  1,225,1,252,192,1,133,158,4,115,105,103,105,108,58,46,
+  0,0,129,16,172,54,115,45,95,95,102,58,45,97,0,0,
+  129,6,233,174,1,129,16,137,20,129,2,204,54,241,53,129,
+  16,70,1,151,166,1,129,16,193,1,10,214,174,1,146,175,
+  1,193,1,211,190,1,182,137,255,152,2,148,175,1,225,1,
+  210,192,1,138,177,3,102,58,115,113,117,97,114,101,0,0,
+  129,16,172,54,102,58,110,45,109,0,0,129,6,148,175,1,
+  129,16,233,169,1,129,16,187,167,1,10,128,175,1,182,175,
+  1,193,1,211,190,1,0,145,234,245,231,1,184,175,1,225,
+  1,165,192,1,255,172,3,102,58,112,111,115,105,116,105,118,
+  101,63,0,0,129,16,172,54,45,102,95,95,102,58,97,45,
+  0,0,129,134,4,184,175,1,0,0,129,16,243,165,1,129,
+  16,175,169,1,10,161,175,1,222,175,1,193,1,211,190,1,
+  151,233,199,252,1,224,175,1,225,1,147,192,1,158,171,3,
+  102,58,110,101,103,97,116,105,118,101,63,0,0,129,16,172,
+  54,45,102,95,95,102,58,97,45,0,0,129,134,4,224,175,
+  1,0,0,129,16,243,165,1,129,16,145,169,1,10,201,175,
+  1,131,176,1,193,1,211,190,1,249,204,212,180,1,133,176,
+  1,225,1,143,192,1,241,170,3,102,58,110,101,103,97,116,
+  101,0,0,129,16,172,54,102,58,97,45,98,0,0,129,134,
+  4,133,176,1,0,1,129,16,243,165,1,129,16,187,167,1,
+  10,241,175,1,162,176,1,193,1,211,190,1,187,246,216,122,
+  164,176,1,225,1,163,191,1,160,157,3,102,58,97,98,115,
+  0,0,129,16,172,54,102,58,97,45,98,0,0,129,6,164,
+  176,1,129,16,233,169,1,129,16,222,175,1,129,18,131,176,
+  1,10,147,176,1,194,176,1,193,1,211,190,1,254,250,217,
+  122,196,176,1,225,1,176,192,1,164,174,3,102,58,112,117,
+  116,0,0,129,16,172,54,102,58,97,45,0,0,129,6,196,
+  176,1,129,16,226,166,1,129,16,188,127,10,179,176,1,222,
+  176,1,193,1,211,190,1,254,254,215,228,7,224,176,1,225,
+  1,160,191,1,248,156,3,102,58,80,73,0,0,129,16,172,
+  54,102,58,45,70,0,0,129,6,224,176,1,129,16,172,54,
+  51,46,49,52,49,53,57,50,54,53,52,0,0,1,233,176,
+  1,129,16,151,166,1,10,208,176,1,135,177,1,193,1,211,
+  190,1,138,217,161,92,137,177,1,225,1,148,191,1,169,155,
+  3,102,58,69,0,0,129,16,172,54,102,58,45,70,0,0,
+  129,6,137,177,1,129,16,172,54,50,46,55,49,56,50,56,
+  49,56,50,56,0,0,1,146,177,1,129,16,151,166,1,10,
+  250,176,1,178,177,1,193,1,211,190,1,130,204,215,122,180,
+  177,1,225,1,157,191,1,212,156,3,102,58,78,65,78,0,
+  0,129,16,172,54,102,58,45,110,0,0,129,6,180,177,1,
+  129,16,172,54,48,0,0,1,189,177,1,129,16,151,166,1,
+  129,16,172,54,48,0,0,1,197,177,1,129,16,151,166,1,
+  129,16,215,167,1,10,163,177,1,221,177,1,193,1,211,190,
+  1,226,164,215,122,223,177,1,225,1,154,191,1,162,156,3,
+  102,58,73,78,70,0,0,129,16,172,54,102,58,45,110,0,
+  0,129,6,223,177,1,129,16,172,54,49,46,48,0,0,1,
+  232,177,1,129,16,151,166,1,129,16,172,54,48,0,0,1,
+  242,177,1,129,16,151,166,1,129,16,215,167,1,10,206,177,
+  1,139,178,1,193,1,211,190,1,0,225,191,250,95,141,178,
+  1,225,1,133,191,1,160,153,3,102,58,45,73,78,70,0,
+  0,129,16,172,54,102,58,45,110,0,0,129,6,141,178,1,
+  129,16,172,54,45,49,46,48,0,0,1,150,178,1,129,16,
+  151,166,1,129,16,172,54,48,0,0,1,161,178,1,129,16,
+  151,166,1,129,16,215,167,1,10,251,177,1,186,178,1,193,
+  1,211,190,1,0,189,132,218,93,188,178,1,225,1,140,192,
+  1,174,170,3,102,58,110,97,110,63,0,0,129,16,172,54,
+  102,58,110,45,44,45,102,0,0,129,6,188,178,1,129,16,
+  233,169,1,129,16,243,168,1,10,170,178,1,219,178,1,193,
+  1,211,190,1,0,253,162,238,93,221,178,1,225,1,240,191,
+  1,203,167,3,102,58,105,110,102,63,0,0,129,16,172,54,
+  102,58,110,45,44,45,102,0,0,129,6,221,178,1,129,16,
+  221,177,1,129,16,212,168,1,10,203,178,1,253,178,1,193,
+  1,211,190,1,142,149,163,209,3,255,178,1,225,1,140,191,
+  1,191,154,3,102,58,45,105,110,102,63,0,0,129,16,172,
+  54,102,58,110,45,44,45,102,0,0,129,6,255,178,1,129,
+  16,139,178,1,129,16,212,168,1,10,236,178,1,159,179,1,
+  193,1,211,190,1,141,157,179,248,3,161,179,1,225,1,187,
+  192,1,226,174,3,102,58,114,111,117,110,100,0,0,129,16,
+  172,54,45,124,102,58,97,45,98,0,0,129,6,161,179,1,
+  129,16,233,169,1,129,16,222,175,1,129,14,211,179,1,129,
+  16,172,54,48,46,53,0,0,1,179,179,1,129,16,151,166,
+  1,129,16,159,167,1,129,16,153,168,1,10,1,177,179,1,
+  129,14,211,179,1,129,16,172,54,48,46,53,0,0,1,198,
+  179,1,129,16,151,166,1,129,16,131,167,1,129,16,247,167,
+  1,10,129,152,132,168,1,0,0,117,129,46,196,179,1,129,
+  16,245,119,10,142,179,1,234,179,1,193,1,211,190,1,169,
+  222,217,122,236,179,1,225,1,135,192,1,141,170,3,102,58,
+  109,105,110,0,0,129,16,172,54,102,58,110,110,45,110,0,
+  0,129,6,236,179,1,129,16,157,174,1,129,16,145,169,1,
+  129,2,136,170,1,213,173,1,129,16,70,10,219,179,1,142,
+  180,1,193,1,211,190,1,171,220,217,122,144,180,1,225,1,
+  130,192,1,235,169,3,102,58,109,97,120,0,0,129,16,172,
+  54,102,58,110,110,45,110,0,0,129,6,144,180,1,129,16,
+  157,174,1,129,16,175,169,1,129,2,136,170,1,213,173,1,
+  129,16,70,10,255,179,1,180,180,1,193,1,211,190,1,164,
+  157,243,244,3,182,180,1,225,1,243,191,1,142,168,3,102,
+  58,108,105,109,105,116,0,0,129,16,172,54,102,58,110,108,
+  117,45,110,0,0,129,6,182,180,1,129,16,165,170,1,129,
+  16,180,172,1,129,16,234,179,1,129,16,208,172,1,129,16,
+  142,180,1,10,163,180,1,223,180,1,193,1,211,190,1,174,
+  220,238,233,1,225,180,1,225,1,179,191,1,173,159,3,102,
+  58,98,101,116,119,101,101,110,63,0,0,129,16,172,54,102,
+  58,110,108,117,45,110,0,0,129,6,225,180,1,129,16,191,
+  174,1,129,16,233,169,1,129,16,180,172,1,129,16,191,174,
+  1,129,16,191,174,1,129,16,180,180,1,129,16,208,172,1,
+  129,16,212,168,1,10,203,180,1,139,181,1,193,1,211,190,
+  1,191,189,217,122,141,181,1,225,1,236,191,1,183,167,3,
+  102,58,105,110,99,0,0,129,16,172,54,102,58,110,45,110,
+  0,0,129,6,141,181,1,129,16,172,54,49,0,0,1,151,
+  181,1,129,16,151,166,1,129,16,131,167,1,10,252,180,1,
+  175,181,1,193,1,211,190,1,209,144,217,122,177,181,1,225,
+  1,197,191,1,204,162,3,102,58,100,101,99,0,0,129,16,
+  172,54,102,58,110,45,110,0,0,129,6,177,181,1,129,16,
+  172,54,49,0,0,1,187,181,1,129,16,151,166,1,129,16,
+  159,167,1,10,160,181,1,212,181,1,193,1,211,190,1,0,
+  253,161,138,94,214,181,1,225,1,184,191,1,169,160,3,102,
+  58,99,97,115,101,0,0,129,16,172,54,102,58,102,102,45,
+  44,113,45,0,0,129,6,214,181,1,129,16,138,173,1,129,
+  16,212,168,1,129,14,244,181,1,129,16,136,170,1,8,1,
+  0,1,10,1,231,181,1,129,14,244,181,1,131,2,0,0,
+  10,129,152,132,168,1,0,0,22,129,46,241,181,1,129,16,
+  245,119,25,134,134,12,10,196,181,1,142,182,1,193,1,211,
+  190,1,0,211,135,195,93,144,182,1,225,1,191,192,1,128,
+  175,3,102,58,115,105,103,110,0,0,129,16,172,54,45,110,
+  124,102,58,97,45,0,0,129,6,144,182,1,129,16,233,169,
+  1,129,16,172,54,48,0,0,1,158,182,1,129,16,151,166,
+  1,129,16,212,168,1,129,14,173,182,1,1,0,0,129,16,
+  136,170,1,10,1,168,182,1,129,16,248,28,129,16,172,54,
+  48,0,0,1,179,182,1,129,16,151,166,1,129,16,175,169,
+  1,129,14,199,182,1,1,1,10,1,189,182,1,129,14,199,
+  182,1,1,0,1,10,129,152,132,168,1,0,0,121,129,46,
+  196,182,1,129,16,245,119,10,254,181,1,253,255,255,255,7,
+  178,1,211,190,1,202,146,143,122,224,182,1,225,1,225,1,
+  149,145,3,101,58,77,65,88,0,0,45,110,0,0,207,182,
+  1,0,249,255,255,255,15,178,1,211,190,1,200,148,143,122,
+  242,182,1,225,1,225,1,209,145,3,101,58,77,73,78,0,
+  0,45,110,0,0,225,182,1,0,253,255,255,255,15,178,1,
+  211,190,1,129,155,143,122,132,183,1,225,1,225,1,141,146,
+  3,101,58,78,65,78,0,0,45,110,0,0,243,182,1,254,
+  255,255,255,7,178,1,211,190,1,225,243,142,122,150,183,1,
+  225,1,225,1,222,144,3,101,58,73,78,70,0,0,45,110,
+  0,0,133,183,1,0,251,255,255,255,15,178,1,211,190,1,
+  0,163,226,163,133,1,169,183,1,225,1,225,1,249,143,3,
+  101,58,45,73,78,70,0,0,45,110,0,0,151,183,1,184,
+  183,1,193,1,211,190,1,241,237,213,228,7,186,183,1,225,
+  1,225,1,217,147,3,101,58,110,63,0,0,129,16,172,54,
+  117,45,102,0,0,129,134,132,8,186,183,1,0,247,255,255,
+  255,15,253,255,255,255,7,129,36,1,129,16,192,31,10,170,
+  183,1,215,183,1,193,1,211,190,1,0,173,211,135,131,1,
+  217,183,1,225,1,225,1,151,147,3,101,58,109,97,120,63,
+  0,0,129,16,172,54,117,45,102,0,0,129,134,132,88,217,
+  183,1,253,255,255,255,7,10,199,183,1,241,183,1,193,1,
+  211,190,1,0,177,208,134,131,1,243,183,1,225,1,225,1,
+  184,147,3,101,58,109,105,110,63,0,0,129,16,172,54,117,
+  45,102,0,0,129,134,132,88,243,183,1,0,249,255,255,255,
+  15,10,225,183,1,140,184,1,193,1,211,190,1,0,249,202,
+  145,214,1,142,184,1,225,1,225,1,128,149,3,101,58,122,
+  101,114,111,63,0,0,129,16,172,54,117,45,102,0,0,129,
+  6,142,184,1,129,16,208,27,10,251,183,1,167,184,1,193,
+  1,211,190,1,0,255,166,131,131,1,169,184,1,225,1,225,
+  1,165,148,3,101,58,110,97,110,63,0,0,129,16,172,54,
+  117,45,102,0,0,129,134,132,88,169,184,1,0,253,255,255,
+  255,15,10,151,184,1,193,184,1,193,1,211,190,1,0,191,
+  197,151,131,1,195,184,1,225,1,225,1,252,146,3,101,58,
+  105,110,102,63,0,0,129,16,172,54,117,45,102,0,0,129,
+  134,132,88,195,184,1,254,255,255,255,7,10,177,184,1,220,
+  184,1,193,1,211,190,1,0,229,200,139,173,2,222,184,1,
+  225,1,225,1,186,144,3,101,58,45,105,110,102,63,0,0,
+  129,16,172,54,117,45,102,0,0,129,134,132,88,222,184,1,
+  0,251,255,255,255,15,10,203,184,1,246,184,1,193,1,211,
+  190,1,0,167,142,178,131,1,248,184,1,225,1,225,1,200,
+  146,3,101,58,99,108,105,112,0,0,129,16,172,54,117,45,
+  117,0,0,129,134,132,8,248,184,1,0,249,255,255,255,15,
+  253,255,255,255,7,129,16,128,31,10,230,184,1,145,185,1,
+  193,1,211,190,1,251,251,215,228,7,147,185,1,225,1,151,
+  191,1,221,155,3,102,58,69,49,0,0,129,16,172,54,45,
+  124,102,58,45,110,41,95,101,45,117,110,105,116,95,105,110,
+  95,102,108,111,97,0,0,129,6,147,185,1,129,14,174,185,
+  1,129,16,172,54,49,46,101,53,0,0,1,176,185,1,129,
+  16,151,166,1,10,131,185,1,209,185,1,193,1,211,190,1,
+  246,156,253,149,6,211,185,1,225,1,194,192,1,202,175,3,
+  102,58,115,105,103,110,101,100,45,115,113,114,116,0,0,129,
+  16,172,54,124,102,58,110,45,110,0,0,129,6,211,185,1,
+  129,16,233,169,1,129,16,142,182,1,129,16,162,176,1,129,
+  16,183,168,1,129,16,243,165,1,129,16,187,167,1,10,186,
+  185,1,130,186,1,193,1,211,190,1,221,206,184,126,132,186,
+  1,225,1,198,192,1,253,175,3,102,58,115,105,103,110,101,
+  100,45,115,113,117,97,114,101,0,0,129,16,172,54,124,102,
+  58,110,45,110,0,0,129,6,132,186,1,129,16,233,169,1,
+  129,16,142,182,1,129,16,233,169,1,129,16,187,167,1,129,
+  16,243,165,1,129,16,187,167,1,10,233,185,1,172,186,1,
+  193,1,0,0,208,178,207,255,7,0,0,225,1,225,1,0,
+  0,102,58,45,115,104,105,102,116,0,0,129,16,145,185,1,
+  129,16,187,167,1,10,154,186,1,195,186,1,193,1,0,0,
+  142,144,166,218,7,0,0,225,1,225,1,0,0,102,58,43,
+  115,104,105,102,116,0,0,129,16,145,185,1,129,16,215,167,
+  1,10,177,186,1,219,186,1,193,1,0,0,0,195,134,162,
+  188,7,0,0,225,1,225,1,0,0,102,58,43,101,110,99,
+  111,100,101,0,0,129,16,209,185,1,129,16,172,186,1,10,
+  200,186,1,243,186,1,193,1,0,0,224,239,192,241,5,0,
+  0,225,1,225,1,0,0,102,58,45,101,110,99,111,100,101,
+  0,0,129,16,233,169,1,129,16,142,182,1,129,16,195,186,
+  1,129,16,233,169,1,129,16,187,167,1,129,16,243,165,1,
+  129,16,187,167,1,10,233,185,1,146,187,1,193,1,211,190,
+  1,0,139,142,190,93,148,187,1,225,1,227,192,1,229,178,
+  3,102,58,116,111,45,101,0,0,129,16,172,54,45,101,124,
+  102,58,110,45,0,0,129,6,148,187,1,129,16,233,169,1,
+  129,16,186,178,1,129,14,169,187,1,129,16,136,170,1,1,
+  0,253,255,255,255,15,10,1,164,187,1,129,16,248,28,129,
+  16,233,169,1,129,16,219,178,1,129,14,184,187,1,129,16,
+  136,170,1,1,254,255,255,255,7,10,1,179,187,1,129,16,
+  248,28,129,16,233,169,1,129,16,253,178,1,129,14,199,187,
+  1,129,16,136,170,1,1,0,251,255,255,255,15,10,1,194,
+  187,1,129,16,248,28,129,16,219,186,1,129,16,159,179,1,
+  129,16,188,166,1,129,16,246,184,1,129,2,0,249,255,255,
+  255,15,136,170,1,129,16,140,26,129,2,253,255,255,255,7,
+  136,170,1,129,16,140,26,10,130,187,1,238,187,1,193,1,
+  211,190,1,0,203,176,231,130,1,240,187,1,225,1,243,190,
+  1,216,148,3,101,58,116,111,45,102,0,0,129,16,172,54,
+  101,45,124,102,58,45,110,0,0,129,134,132,8,240,187,1,
+  0,253,255,255,255,15,178,177,1,129,16,140,26,129,2,254,
+  255,255,255,7,221,177,1,129,16,140,26,129,2,0,251,255,
+  255,255,15,139,178,1,129,16,140,26,129,16,243,165,1,129,
+  16,243,186,1,10,222,187,1,158,188,1,193,1,211,190,1,
+  242,151,134,249,3,160,188,1,225,1,214,192,1,184,177,3,
+  102,58,115,116,111,114,101,0,0,129,16,172,54,97,45,124,
+  102,58,110,45,0,0,129,134,4,160,188,1,146,187,1,129,
+  16,139,23,16,10,141,188,1,192,188,1,193,1,211,190,1,
+  143,206,184,241,3,194,188,1,225,1,225,191,1,154,166,3,
+  102,58,102,101,116,99,104,0,0,129,16,172,54,97,45,124,
+  102,58,45,110,0,0,129,134,60,194,188,1,129,16,238,187,
+  1,10,175,188,1,229,188,1,193,1,211,190,1,0,131,238,
+  191,248,12,231,188,1,225,1,225,1,166,164,3,102,58,100,
+  117,109,112,45,115,116,97,99,107,0,0,129,16,172,54,45,
+  0,0,129,6,231,188,1,129,16,207,169,1,130,2,180,172,
+  1,129,16,147,25,129,14,255,188,1,129,16,208,172,1,129,
+  16,233,169,1,129,16,194,176,1,129,16,150,127,134,130,200,
+  200,1,1,133,130,28,243,188,1,129,162,132,40,1,131,189,
+  1,133,130,28,251,188,1,10,207,188,1,156,189,1,193,1,
+  211,190,1,255,132,208,235,7,158,189,1,225,1,225,1,237,
+  163,3,102,58,100,117,109,112,45,97,115,116,97,99,107,0,
+  0,129,16,172,54,45,0,0,129,6,158,189,1,129,16,239,
+  172,1,130,2,208,172,1,129,16,147,25,129,14,182,189,1,
+  129,16,233,169,1,129,16,194,176,1,129,16,150,127,129,16,
+  180,172,1,134,130,200,200,1,1,133,130,28,170,189,1,129,
+  162,132,40,1,186,189,1,133,130,28,178,189,1,10,133,189,
+  1,203,189,1,193,1,211,190,1,253,201,145,122,205,189,1,
+  225,1,225,1,189,148,3,101,58,112,117,116,0,0,129,16,
+  172,54,101,45,0,0,129,134,4,205,189,1,253,255,255,255,
+  7,129,14,226,189,1,129,16,172,54,101,58,77,65,88,0,
+  0,1,215,189,1,129,16,188,127,10,1,213,189,1,129,16,
+  140,26,1,0,249,255,255,255,15,129,14,247,189,1,129,16,
+  172,54,101,58,77,73,78,0,0,1,236,189,1,129,16,188,
+  127,10,1,234,189,1,129,16,140,26,1,0,0,129,14,138,
+  190,1,129,16,172,54,101,58,48,0,0,1,129,190,1,129,
+  16,188,127,10,1,255,189,1,129,16,140,26,1,0,253,255,
+  255,255,15,129,14,159,190,1,129,16,172,54,101,58,78,65,
+  78,0,0,1,148,190,1,129,16,188,127,10,1,146,190,1,
+  129,16,140,26,1,254,255,255,255,7,129,14,180,190,1,129,
+  16,172,54,101,58,73,78,70,0,0,1,169,190,1,129,16,
+  188,127,10,1,167,190,1,129,16,140,26,1,0,251,255,255,
+  255,15,129,14,202,190,1,129,16,172,54,101,58,45,73,78,
+  70,0,0,1,190,190,1,129,16,188,127,10,1,188,190,1,
+  129,16,140,26,129,16,238,187,1,129,16,194,176,1,10,105,
+  110,116,101,114,102,97,99,101,47,102,108,111,97,116,105,110,
+  103,112,111,105,110,116,46,114,101,116,114,111,0,0,211,190,
+  1,192,202,1,45,110,0,0,70,70,45,70,0,0,70,70,
+  45,70,0,0,70,70,45,70,0,0,45,110,0,0,70,70,
+  45,0,0,70,45,0,0,70,70,45,70,0,0,45,70,0,
+  0,45,102,0,0,45,110,0,0,45,110,0,0,45,70,0,
+  0,70,45,70,0,0,70,45,70,0,0,70,45,70,0,0,
+  70,45,70,0,0,110,108,117,45,0,0,110,109,45,110,0,
+  0,70,45,70,0,0,70,45,70,0,0,110,45,109,0,0,
+  70,45,0,0,70,70,45,0,0,70,45,70,70,0,0,110,
+  109,45,110,109,110,109,0,0,70,70,45,0,0,45,110,0,
+  0,70,45,70,0,0,70,70,45,0,0,110,45,109,0,0,
+  70,45,0,0,110,108,117,45,109,0,0,70,70,45,70,0,
+  0,70,70,45,0,0,109,110,45,111,0,0,109,110,45,111,
+  0,0,70,45,0,0,70,45,70,0,0,70,45,0,0,78,
+  77,45,77,0,0,70,71,45,70,71,70,0,0,45,70,0,
+  0,70,45,0,0,70,70,45,70,0,0,70,45,0,0,70,
+  45,0,0,97,98,99,45,98,99,97,0,0,102,45,102,0,
+  0,70,45,0,0,70,45,70,0,0,102,45,102,0,0,70,
+  45,70,0,0,70,45,70,0,0,102,45,102,0,0,110,45,
+  0,0,70,71,45,71,70,0,0,70,45,70,0,0,110,45,
+  0,0,70,45,0,0,70,45,0,0,70,71,45,71,70,71,
+  0,0,45,70,0,0,45,63,0,0,45,70,0,0,45,70,
+  0,0,188,189,1,151,193,1,193,1,165,202,1,0,223,244,
+  251,205,9,153,193,1,225,1,225,1,206,189,3,102,105,108,
+  101,58,111,112,101,114,97,116,105,111,110,0,0,129,16,172,
+  54,45,110,0,0,129,134,4,153,193,1,4,129,16,198,126,
+  2,129,16,255,27,129,14,206,193,1,3,129,16,172,54,69,
+  114,114,111,114,58,32,102,105,108,101,115,32,100,101,118,105,
+  99,101,32,110,111,116,32,102,111,117,110,100,0,0,1,169,
+  193,1,129,16,188,127,129,16,133,127,10,1,166,193,1,129,
+  16,248,28,129,16,175,126,10,255,192,1,0,0,178,1,165,
+  202,1,0,157,191,206,40,231,193,1,225,1,225,1,220,183,
+  3,102,105,108,101,58,82,0,0,45,110,0,0,213,193,1,
+  1,178,1,165,202,1,0,147,191,206,40,250,193,1,225,1,
+  225,1,184,184,3,102,105,108,101,58,87,0,0,45,110,0,
+  0,232,193,1,2,178,1,165,202,1,0,191,191,206,40,141,
+  194,1,225,1,225,1,176,183,3,102,105,108,101,58,65,0,
+  0,45,110,0,0,251,193,1,3,178,1,165,202,1,0,135,
+  166,158,188,10,161,194,1,225,1,225,1,134,184,3,102,105,
+  108,101,58,82,43,0,0,45,110,0,0,142,194,1,181,194,
+  1,193,1,165,202,1,0,157,130,217,188,10,183,194,1,225,
+  1,225,1,185,187,3,102,105,108,101,58,111,112,101,110,0,
+  0,129,16,172,54,115,109,45,104,0,0,129,134,4,183,194,
+  1,0,0,129,16,151,193,1,10,162,194,1,214,194,1,193,
+  1,165,202,1,149,195,214,143,3,216,194,1,225,1,225,1,
+  227,184,3,102,105,108,101,58,99,108,111,115,101,0,0,129,
+  16,172,54,104,45,0,0,129,134,4,216,194,1,1,129,16,
+  151,193,1,10,194,194,1,244,194,1,193,1,165,202,1,0,
+  137,171,205,188,10,246,194,1,225,1,225,1,150,190,3,102,
+  105,108,101,58,114,101,97,100,0,0,129,16,172,54,104,45,
+  99,0,0,129,134,4,246,194,1,2,129,16,151,193,1,10,
+  225,194,1,148,195,1,193,1,165,202,1,138,249,138,155,3,
+  150,195,1,225,1,225,1,145,196,3,102,105,108,101,58,119,
+  114,105,116,101,0,0,129,16,172,54,99,104,45,0,0,129,
+  134,4,150,195,1,3,129,16,151,193,1,10,128,195,1,179,
+  195,1,193,1,165,202,1,0,159,194,196,188,10,181,195,1,
+  225,1,225,1,213,195,3,102,105,108,101,58,116,101,108,108,
+  0,0,129,16,172,54,104,45,110,0,0,129,134,4,181,195,
+  1,4,129,16,151,193,1,10,160,195,1,210,195,1,193,1,
+  165,202,1,0,177,247,200,188,10,212,195,1,225,1,225,1,
+  150,193,3,102,105,108,101,58,115,101,101,107,0,0,129,16,
+  172,54,110,104,45,0,0,129,134,4,212,195,1,5,129,16,
+  151,193,1,10,191,195,1,241,195,1,193,1,165,202,1,0,
+  203,168,200,188,10,243,195,1,225,1,225,1,208,193,3,102,
+  105,108,101,58,115,105,122,101,0,0,129,16,172,54,104,45,
+  110,0,0,129,134,4,243,195,1,6,129,16,151,193,1,10,
+  222,195,1,146,196,1,193,1,165,202,1,242,229,249,147,7,
+  148,196,1,225,1,225,1,136,185,3,102,105,108,101,58,100,
+  101,108,101,116,101,0,0,129,16,172,54,115,45,0,0,129,
+  134,4,148,196,1,7,129,16,151,193,1,10,253,195,1,177,
+  196,1,193,1,165,202,1,161,137,176,145,3,179,196,1,225,
+  1,225,1,232,185,3,102,105,108,101,58,102,108,117,115,104,
+  0,0,129,16,172,54,102,45,0,0,129,134,4,179,196,1,
+  8,129,16,151,193,1,10,157,196,1,213,196,1,193,1,165,
+  202,1,0,157,251,237,169,7,215,196,1,225,1,225,1,141,
+  191,3,102,105,108,101,58,114,101,97,100,47,98,121,116,101,
+  115,0,0,129,16,172,54,112,110,102,45,0,0,129,134,4,
+  215,196,1,9,129,16,151,193,1,10,188,196,1,252,196,1,
+  193,1,165,202,1,192,207,226,233,6,254,196,1,225,1,225,
+  1,197,196,3,102,105,108,101,58,119,114,105,116,101,47,98,
+  121,116,101,115,0,0,129,16,172,54,112,110,102,45,0,0,
+  129,134,4,254,196,1,10,129,16,151,193,1,10,226,196,1,
+  158,197,1,193,1,165,202,1,0,165,166,251,205,13,160,197,
+  1,225,1,225,1,151,192,3,102,105,108,101,58,114,101,97,
+  100,47,99,0,0,129,16,172,54,104,45,99,0,0,129,134,
+  4,160,197,1,11,129,16,151,193,1,10,137,197,1,192,197,
+  1,193,1,165,202,1,0,135,202,223,143,13,194,197,1,225,
+  1,225,1,185,197,3,102,105,108,101,58,119,114,105,116,101,
+  47,99,0,0,129,16,172,54,99,104,45,99,0,0,129,134,
+  4,194,197,1,12,129,16,151,193,1,10,170,197,1,227,197,
+  1,193,1,165,202,1,190,239,169,219,3,229,197,1,225,1,
+  225,1,159,185,3,102,105,108,101,58,101,120,105,115,116,115,
+  63,0,0,129,16,172,54,115,45,102,0,0,129,134,4,229,
+  197,1,0,0,129,16,181,194,1,2,129,16,230,27,129,14,
+  128,198,1,129,16,214,194,1,129,16,233,25,10,1,243,197,
+  1,129,14,128,198,1,3,129,16,251,25,10,129,152,132,168,
+  1,0,0,15,129,46,252,197,1,129,16,245,119,10,205,197,
+  1,167,198,1,193,1,165,202,1,0,167,129,225,194,14,169,
+  198,1,225,1,225,1,221,188,3,102,105,108,101,58,111,112,
+  101,110,45,102,111,114,45,114,101,97,100,105,110,103,0,0,
+  129,16,172,54,115,45,110,110,0,0,129,134,4,169,198,1,
+  0,0,129,16,181,194,1,2,129,16,241,195,1,4,10,136,
+  198,1,214,198,1,193,1,165,202,1,0,235,239,174,181,1,
+  216,198,1,225,1,225,1,143,188,3,102,105,108,101,58,111,
+  112,101,110,45,102,111,114,45,97,112,112,101,110,100,0,0,
+  129,16,172,54,115,45,110,110,0,0,129,134,4,216,198,1,
+  2,129,16,181,194,1,2,129,16,241,195,1,4,10,184,198,
+  1,134,199,1,193,1,165,202,1,182,211,142,221,2,136,199,
+  1,225,1,225,1,161,189,3,102,105,108,101,58,111,112,101,
+  110,45,102,111,114,45,119,114,105,116,105,110,103,0,0,129,
+  16,172,54,115,45,110,0,0,129,134,4,136,199,1,1,129,
+  16,181,194,1,10,231,198,1,159,199,1,178,1,0,0,216,
+  204,159,92,0,0,225,1,225,1,0,0,70,73,68,0,2,
+  146,199,1,174,199,1,178,1,0,0,192,195,177,228,7,0,
+  0,225,1,225,1,0,0,83,105,122,101,0,2,160,199,1,
+  191,199,1,178,1,0,0,0,185,156,134,148,11,0,0,225,
+  1,225,1,0,0,65,99,116,105,111,110,0,2,175,199,1,
+  207,199,1,193,1,0,0,171,173,154,91,0,0,225,1,225,
+  1,0,0,45,101,111,102,63,0,0,129,30,159,199,1,129,
+  16,179,195,1,129,158,52,174,199,1,10,192,199,1,232,199,
+  1,193,1,0,0,177,181,139,159,1,0,0,225,1,225,1,
+  0,0,112,114,101,115,101,114,118,101,0,0,1,159,199,1,
+  129,14,242,199,1,129,2,174,199,1,27,129,16,220,38,10,
+  1,236,199,1,129,16,220,38,10,231,198,1,143,200,1,193,
+  1,165,202,1,0,159,228,134,232,13,145,200,1,225,1,225,
+  1,208,190,3,102,105,108,101,58,114,101,97,100,45,108,105,
+  110,101,0,0,129,16,172,54,102,45,115,0,0,129,6,145,
+  200,1,129,16,217,20,132,2,13,129,16,151,193,1,129,16,
+  217,20,10,247,199,1,188,200,1,193,1,165,202,1,0,205,
+  215,183,186,12,190,200,1,225,1,225,1,159,186,3,102,105,
+  108,101,58,102,111,114,45,101,97,99,104,45,108,105,110,101,
+  0,0,129,16,172,54,115,113,45,0,0,129,6,190,200,1,
+  129,14,225,200,1,129,32,191,199,1,129,16,167,198,1,129,
+  160,132,128,1,159,199,1,174,199,1,129,14,216,200,1,129,
+  30,159,199,1,129,16,143,200,1,129,158,32,191,199,1,129,
+  16,207,199,1,10,1,207,200,1,129,16,186,24,129,30,159,
+  199,1,129,16,214,194,1,10,1,198,200,1,129,16,232,199,
+  1,10,160,200,1,130,201,1,193,1,165,202,1,0,181,179,
+  225,186,12,132,201,1,225,1,225,1,236,186,3,102,105,108,
+  101,58,102,111,114,45,101,97,99,104,45,98,121,116,101,0,
+  0,129,16,172,54,115,113,45,0,0,129,6,132,201,1,129,
+  14,167,201,1,129,32,191,199,1,129,16,167,198,1,129,160,
+  132,128,1,159,199,1,174,199,1,129,14,158,201,1,129,30,
+  159,199,1,129,16,244,194,1,129,158,32,191,199,1,129,16,
+  207,199,1,10,1,149,201,1,129,16,186,24,129,30,159,199,
+  1,129,16,214,194,1,10,1,140,201,1,129,16,232,199,1,
+  10,230,200,1,185,201,1,178,1,0,0,216,204,159,92,0,
+  0,225,1,225,1,0,0,70,73,68,0,2,230,200,1,206,
+  201,1,193,1,165,202,1,149,134,221,152,3,208,201,1,225,
+  1,225,1,141,194,3,102,105,108,101,58,115,108,117,114,112,
+  0,0,129,16,172,54,97,115,45,0,0,129,6,208,201,1,
+  129,14,245,201,1,4,129,16,191,50,129,16,167,198,1,129,
+  32,185,201,1,129,14,235,201,1,129,30,185,201,1,129,16,
+  244,194,1,129,16,208,49,134,130,200,200,1,1,133,130,28,
+  225,201,1,129,162,132,40,1,239,201,1,133,130,28,231,201,
+  1,129,30,185,201,1,129,16,214,194,1,10,1,216,201,1,
+  129,16,221,50,10,186,201,1,141,202,1,193,1,165,202,1,
+  0,131,188,199,188,10,143,202,1,225,1,225,1,235,194,3,
+  102,105,108,101,58,115,112,101,119,0,0,129,16,172,54,115,
+  115,45,0,0,129,6,143,202,1,129,16,134,199,1,4,129,
+  14,158,202,1,133,132,152,32,129,16,148,195,1,10,1,154,
+  202,1,129,16,209,61,129,16,214,194,1,10,105,110,116,101,
+  114,102,97,99,101,47,102,105,108,101,115,121,115,116,101,109,
+  46,114,101,116,114,111,0,0,165,202,1,166,210,1,250,201,
+  1,219,202,1,193,1,145,210,1,163,147,133,225,6,221,202,
+  1,225,1,225,1,228,216,3,105,111,58,117,110,105,120,45,
+  115,121,115,99,97,108,108,0,0,129,16,172,54,110,45,0,
+  0,129,134,4,221,202,1,8,129,16,198,126,2,129,16,255,
+  27,129,14,145,203,1,3,129,16,172,54,69,114,114,111,114,
+  58,32,85,78,73,88,32,100,101,118,105,99,101,32,110,111,
+  116,32,102,111,117,110,100,0,0,1,237,202,1,129,16,188,
+  127,129,16,133,127,10,1,234,202,1,129,16,248,28,129,16,
+  175,126,10,194,202,1,173,203,1,193,1,145,210,1,0,175,
+  251,169,144,11,175,203,1,225,1,225,1,243,187,4,117,110,
+  105,120,58,115,121,115,116,101,109,0,0,129,16,172,54,115,
+  45,0,0,129,134,4,175,203,1,0,0,129,16,219,202,1,
+  10,152,203,1,203,203,1,193,1,145,210,1,149,133,156,145,
+  6,205,203,1,225,1,225,1,163,181,4,117,110,105,120,58,
+  102,111,114,107,0,0,129,16,172,54,45,110,0,0,129,134,
+  4,205,203,1,1,129,16,219,202,1,10,184,203,1,234,203,
+  1,193,1,145,210,1,0,143,176,176,144,11,236,203,1,225,
+  1,225,1,208,175,4,117,110,105,120,58,101,120,101,99,48,
+  0,0,129,16,172,54,115,45,0,0,129,134,4,236,203,1,
+  2,129,16,219,202,1,10,214,203,1,137,204,1,193,1,145,
+  210,1,0,141,176,176,144,11,139,204,1,225,1,225,1,141,
+  176,4,117,110,105,120,58,101,120,101,99,49,0,0,129,16,
+  172,54,115,115,45,0,0,129,134,4,139,204,1,3,129,16,
+  219,202,1,10,245,203,1,169,204,1,193,1,145,210,1,0,
+  139,176,176,144,11,171,204,1,225,1,225,1,227,176,4,117,
+  110,105,120,58,101,120,101,99,50,0,0,129,16,172,54,115,
+  115,115,45,0,0,129,134,4,171,204,1,4,129,16,219,202,
+  1,10,149,204,1,202,204,1,193,1,145,210,1,0,137,176,
+  176,144,11,204,204,1,225,1,225,1,190,177,4,117,110,105,
+  120,58,101,120,101,99,51,0,0,129,16,172,54,115,115,115,
+  115,45,0,0,129,134,4,204,204,1,5,129,16,219,202,1,
+  10,182,204,1,235,204,1,193,1,145,210,1,221,182,154,145,
+  6,237,204,1,225,1,225,1,177,179,4,117,110,105,120,58,
+  101,120,105,116,0,0,129,16,172,54,110,45,0,0,129,134,
+  4,237,204,1,6,129,16,219,202,1,10,216,204,1,139,205,
+  1,193,1,145,210,1,0,191,210,228,230,14,141,205,1,225,
+  1,225,1,190,182,4,117,110,105,120,58,103,101,116,112,105,
+  100,0,0,129,16,172,54,45,110,0,0,129,134,4,141,205,
+  1,7,129,16,219,202,1,10,246,204,1,169,205,1,193,1,
+  145,210,1,216,176,192,145,6,171,205,1,225,1,225,1,205,
+  188,4,117,110,105,120,58,119,97,105,116,0,0,129,16,172,
+  54,45,110,0,0,129,134,4,171,205,1,8,129,16,219,202,
+  1,10,150,205,1,199,205,1,193,1,145,210,1,175,204,166,
+  145,6,201,205,1,225,1,225,1,229,182,4,117,110,105,120,
+  58,107,105,108,108,0,0,129,16,172,54,110,110,45,0,0,
+  129,134,4,201,205,1,9,129,16,219,202,1,10,180,205,1,
+  231,205,1,193,1,145,210,1,0,181,250,157,132,11,233,205,
+  1,225,1,225,1,181,184,4,117,110,105,120,58,112,111,112,
+  101,110,0,0,129,16,172,54,115,110,45,110,0,0,129,134,
+  4,233,205,1,10,129,16,219,202,1,10,211,205,1,137,206,
+  1,193,1,145,210,1,0,237,247,181,153,12,139,206,1,225,
+  1,225,1,161,183,4,117,110,105,120,58,112,99,108,111,115,
+  101,0,0,129,16,172,54,110,45,0,0,129,134,4,139,206,
+  1,11,129,16,219,202,1,10,244,205,1,168,206,1,193,1,
+  145,210,1,0,165,153,152,147,11,170,206,1,225,1,225,1,
+  196,174,4,117,110,105,120,58,99,104,100,105,114,0,0,129,
+  16,172,54,115,45,0,0,129,134,4,170,206,1,13,129,16,
+  219,202,1,10,148,206,1,200,206,1,193,1,145,210,1,0,
+  231,138,230,230,14,202,206,1,225,1,225,1,241,181,4,117,
+  110,105,120,58,103,101,116,101,110,118,0,0,129,16,172,54,
+  115,97,45,0,0,129,134,4,202,206,1,14,129,16,219,202,
+  1,10,179,206,1,233,206,1,193,1,145,210,1,0,245,179,
+  230,132,12,235,206,1,225,1,225,1,228,185,4,117,110,105,
+  120,58,112,117,116,101,110,118,0,0,129,16,172,54,115,45,
+  0,0,129,134,4,235,206,1,15,129,16,219,202,1,10,212,
+  206,1,136,207,1,193,1,145,210,1,0,135,164,250,128,11,
+  138,207,1,225,1,225,1,198,186,4,117,110,105,120,58,115,
+  108,101,101,112,0,0,129,16,172,54,110,45,0,0,129,134,
+  4,138,207,1,16,129,16,219,202,1,10,244,206,1,169,207,
+  1,193,1,145,210,1,214,141,160,234,4,171,207,1,225,1,
+  225,1,158,178,4,117,110,105,120,58,101,120,101,99,117,116,
+  101,0,0,129,16,172,54,115,45,0,0,129,134,4,171,207,
+  1,17,129,16,219,202,1,10,147,207,1,199,207,1,193,1,
+  145,210,1,145,201,177,145,6,201,207,1,225,1,225,1,175,
+  183,4,117,110,105,120,58,112,105,112,101,0,0,129,16,172,
+  54,115,45,115,0,0,129,134,4,201,207,1,0,0,129,16,
+  231,205,1,129,2,143,200,1,137,206,1,129,16,173,23,10,
+  180,207,1,238,207,1,193,1,145,210,1,0,227,242,159,194,
+  8,240,207,1,225,1,225,1,204,181,4,117,110,105,120,58,
+  103,101,116,45,99,119,100,0,0,129,16,172,54,45,115,41,
+  0,0,129,6,240,207,1,129,16,172,54,112,119,100,0,0,
+  1,248,207,1,129,16,199,207,1,129,16,223,82,129,16,172,
+  54,47,0,0,1,132,208,1,129,16,185,61,10,216,207,1,
+  172,208,1,193,1,145,210,1,0,137,134,250,147,7,174,208,
+  1,225,1,225,1,255,174,4,117,110,105,120,58,99,111,117,
+  110,116,45,102,105,108,101,115,45,105,110,45,99,119,100,0,
+  0,129,16,172,54,45,110,0,0,129,6,174,208,1,129,16,
+  172,54,108,115,32,45,49,32,124,32,119,99,32,45,108,0,
+  0,1,181,208,1,129,16,199,207,1,129,16,223,82,129,16,
+  185,2,10,139,208,1,232,208,1,193,1,145,210,1,181,186,
+  195,188,6,234,208,1,225,1,225,1,240,179,4,117,110,105,
+  120,58,102,111,114,45,101,97,99,104,45,102,105,108,101,0,
+  0,129,16,172,54,113,45,0,0,129,6,234,208,1,129,16,
+  172,54,108,115,32,45,49,32,45,112,0,0,129,2,241,208,
+  1,0,0,129,16,231,205,1,129,16,172,208,1,129,14,147,
+  209,1,129,14,140,209,1,129,16,143,200,1,129,16,241,53,
+  133,132,152,32,8,10,130,138,132,64,133,209,1,6,134,130,
+  200,200,1,1,133,130,28,131,209,1,129,162,132,40,1,151,
+  209,1,133,130,28,143,209,1,129,16,137,206,1,3,10,204,
+  208,1,171,209,1,193,1,0,0,211,147,133,131,1,0,0,
+  225,1,225,1,0,0,115,116,97,114,116,0,0,4,129,16,
+  191,50,1,0,0,129,16,231,205,1,10,156,209,1,193,209,
+  1,193,1,0,0,193,154,245,228,7,0,0,225,1,225,1,
+  0,0,114,101,97,100,0,0,2,129,16,244,194,1,2,129,
+  16,208,49,129,16,208,27,10,179,209,1,218,209,1,193,1,
+  0,0,0,179,250,196,40,0,0,225,1,225,1,0,0,102,
+  105,110,105,115,104,0,0,129,16,137,206,1,129,16,166,50,
+  10,204,208,1,248,209,1,193,1,145,210,1,0,151,132,205,
+  177,11,250,209,1,225,1,225,1,241,186,4,117,110,105,120,
+  58,115,108,117,114,112,45,112,105,112,101,0,0,129,16,172,
+  54,97,115,45,110,0,0,129,6,250,209,1,129,14,140,210,
+  1,129,16,171,209,1,1,193,209,1,129,16,215,24,129,16,
+  218,209,1,10,1,131,210,1,129,16,221,50,10,105,110,116,
+  101,114,102,97,99,101,47,117,110,105,120,46,114,101,116,114,
+  111,0,0,145,210,1,138,211,1,223,209,1,186,210,1,193,
+  1,246,210,1,0,227,188,224,228,15,188,210,1,225,1,225,
+  1,222,231,3,110,58,114,97,110,100,111,109,0,0,129,16,
+  172,54,45,110,0,0,129,134,4,188,210,1,10,129,16,198,
+  126,2,129,16,255,27,129,14,239,210,1,3,129,16,172,54,
+  69,114,114,111,114,58,32,82,78,71,32,100,101,118,105,99,
+  101,32,110,111,116,32,102,111,117,110,100,0,0,1,204,210,
+  1,129,16,188,127,129,16,133,127,10,1,201,210,1,129,16,
+  248,28,129,16,175,126,10,105,110,116,101,114,102,97,99,101,
+  47,114,110,103,46,114,101,116,114,111,0,0,246,210,1,177,
+  215,1,168,210,1,165,211,1,193,1,155,215,1,252,237,226,
+  94,167,211,1,225,1,225,1,211,232,2,99,108,111,99,107,
+  58,111,112,101,114,97,116,105,111,110,0,0,129,16,172,54,
+  110,45,0,0,129,134,4,167,211,1,5,129,16,198,126,2,
+  129,16,255,27,129,14,220,211,1,3,129,16,172,54,69,114,
+  114,111,114,58,32,99,108,111,99,107,32,100,101,118,105,99,
+  101,32,110,111,116,32,102,111,117,110,100,0,0,1,183,211,
+  1,129,16,188,127,129,16,133,127,10,1,180,211,1,129,16,
+  248,28,129,16,175,126,10,140,211,1,252,211,1,193,1,155,
+  215,1,255,140,250,185,2,254,211,1,225,1,225,1,225,233,
+  2,99,108,111,99,107,58,116,105,109,101,115,116,97,109,112,
+  0,0,129,16,172,54,45,110,0,0,129,134,4,254,211,1,
+  0,0,129,16,165,211,1,10,227,211,1,154,212,1,193,1,
+  155,215,1,0,173,139,233,109,156,212,1,225,1,225,1,227,
+  230,2,99,108,111,99,107,58,100,97,121,0,0,129,16,172,
+  54,45,110,0,0,129,134,4,156,212,1,1,129,16,165,211,
+  1,10,135,212,1,186,212,1,193,1,155,215,1,0,221,168,
+  182,160,6,188,212,1,225,1,225,1,139,232,2,99,108,111,
+  99,107,58,109,111,110,116,104,0,0,129,16,172,54,45,110,
+  0,0,129,134,4,188,212,1,2,129,16,165,211,1,10,165,
+  212,1,217,212,1,193,1,155,215,1,156,169,168,236,1,219,
+  212,1,225,1,225,1,154,236,2,99,108,111,99,107,58,121,
+  101,97,114,0,0,129,16,172,54,45,110,0,0,129,134,4,
+  219,212,1,3,129,16,165,211,1,10,197,212,1,248,212,1,
+  193,1,155,215,1,201,222,131,236,1,250,212,1,225,1,225,
+  1,251,230,2,99,108,111,99,107,58,104,111,117,114,0,0,
+  129,16,172,54,45,110,0,0,129,134,4,250,212,1,4,129,
+  16,165,211,1,10,228,212,1,153,213,1,193,1,155,215,1,
+  0,197,243,228,180,14,155,213,1,225,1,225,1,194,231,2,
+  99,108,111,99,107,58,109,105,110,117,116,101,0,0,129,16,
+  172,54,45,110,0,0,129,134,4,155,213,1,5,129,16,165,
+  211,1,10,131,213,1,186,213,1,193,1,155,215,1,0,177,
+  182,225,217,12,188,213,1,225,1,225,1,152,233,2,99,108,
+  111,99,107,58,115,101,99,111,110,100,0,0,129,16,172,54,
+  45,110,0,0,129,134,4,188,213,1,6,129,16,165,211,1,
+  10,164,213,1,220,213,1,193,1,155,215,1,0,161,129,234,
+  196,11,222,213,1,225,1,225,1,214,234,2,99,108,111,99,
+  107,58,117,116,99,58,100,97,121,0,0,129,16,172,54,45,
+  110,0,0,129,134,4,222,213,1,7,129,16,165,211,1,10,
+  197,213,1,128,214,1,193,1,155,215,1,215,163,175,224,5,
+  130,214,1,225,1,225,1,183,235,2,99,108,111,99,107,58,
+  117,116,99,58,109,111,110,116,104,0,0,129,16,172,54,45,
+  110,0,0,129,134,4,130,214,1,8,129,16,165,211,1,10,
+  231,213,1,163,214,1,193,1,155,215,1,226,143,217,208,1,
+  165,214,1,225,1,225,1,250,235,2,99,108,111,99,107,58,
+  117,116,99,58,121,101,97,114,0,0,129,16,172,54,45,110,
+  0,0,129,134,4,165,214,1,9,129,16,165,211,1,10,139,
+  214,1,198,214,1,193,1,155,215,1,143,197,180,208,1,200,
+  214,1,225,1,225,1,245,234,2,99,108,111,99,107,58,117,
+  116,99,58,104,111,117,114,0,0,129,16,172,54,45,110,0,
+  0,129,134,4,200,214,1,10,129,16,165,211,1,10,174,214,
+  1,235,214,1,193,1,155,215,1,0,185,128,180,174,4,237,
+  214,1,225,1,225,1,149,235,2,99,108,111,99,107,58,117,
+  116,99,58,109,105,110,117,116,101,0,0,129,16,172,54,45,
+  110,0,0,129,134,4,237,214,1,11,129,16,165,211,1,10,
+  209,214,1,144,215,1,193,1,155,215,1,0,165,195,176,211,
+  2,146,215,1,225,1,225,1,216,235,2,99,108,111,99,107,
+  58,117,116,99,58,115,101,99,111,110,100,0,0,129,16,172,
+  54,45,110,0,0,129,134,4,146,215,1,12,129,16,165,211,
+  1,10,105,110,116,101,114,102,97,99,101,47,99,108,111,99,
+  107,46,114,101,116,114,111,0,0,155,215,1,140,221,1,246,
+  214,1,205,215,1,193,1,0,0,165,139,145,130,6,0,0,
+  225,1,225,1,0,0,115,99,114,105,112,116,58,111,112,101,
+  114,97,116,105,111,110,0,0,1,9,129,16,198,126,2,129,
+  16,255,27,129,14,130,216,1,3,129,16,172,54,69,114,114,
+  111,114,58,32,115,99,114,105,112,116,105,110,103,32,100,101,
+  118,105,99,101,32,110,111,116,32,102,111,117,110,100,0,0,
+  1,217,215,1,129,16,188,127,129,16,133,127,10,1,214,215,
+  1,129,16,248,28,129,16,175,126,10,179,215,1,156,216,1,
+  193,1,0,0,0,171,173,220,144,1,0,0,225,1,225,1,
+  0,0,106,117,109,112,45,111,118,101,114,0,0,1,129,14,
+  129,16,134,1,129,16,217,20,1,0,0,129,16,134,1,1,
+  155,1,129,16,176,38,10,137,216,1,185,216,1,193,1,0,
+  0,164,231,231,228,7,0,0,225,1,225,1,0,0,108,97,
+  110,100,0,0,129,16,217,20,132,160,4,155,1,129,16,157,
+  38,10,171,216,1,210,216,1,178,1,0,0,0,219,156,172,
+  191,2,0,0,225,1,225,1,0,0,78,111,116,70,111,117,
+  110,100,0,0,178,128,1,246,214,1,237,216,1,193,1,242,
+  220,1,138,238,250,221,7,239,216,1,225,1,225,1,225,147,
+  4,115,99,114,105,112,116,58,97,114,103,117,109,101,110,116,
+  115,0,0,129,16,172,54,45,110,0,0,129,134,4,239,216,
+  1,0,0,129,16,205,215,1,10,211,216,1,149,217,1,193,
+  1,242,220,1,0,247,197,248,155,7,151,217,1,225,1,225,
+  1,136,153,4,115,99,114,105,112,116,58,103,101,116,45,97,
+  114,103,117,109,101,110,116,0,0,129,16,172,54,110,45,115,
+  0,0,129,6,151,217,1,129,16,147,54,132,2,1,129,16,
+  205,215,1,10,248,216,1,181,217,1,193,1,242,220,1,0,
+  237,193,202,156,12,183,217,1,225,1,225,1,240,211,3,105,
+  110,99,108,117,100,101,0,0,129,16,172,54,115,45,0,0,
+  129,134,4,183,217,1,2,129,16,205,215,1,10,164,217,1,
+  213,217,1,193,1,242,220,1,0,149,136,188,208,2,215,217,
+  1,225,1,225,1,176,154,4,115,99,114,105,112,116,58,110,
+  97,109,101,0,0,129,16,172,54,45,115,0,0,129,6,215,
+  217,1,129,16,147,54,1,3,129,16,205,215,1,10,192,217,
+  1,128,218,1,193,1,242,220,1,132,205,171,224,4,130,218,
+  1,225,1,225,1,158,150,4,115,99,114,105,112,116,58,99,
+  117,114,114,101,110,116,45,102,105,108,101,0,0,129,16,172,
+  54,45,115,0,0,129,6,130,218,1,129,16,147,54,1,4,
+  129,16,205,215,1,10,227,217,1,171,218,1,205,1,242,220,
+  1,140,226,184,224,4,173,218,1,225,1,225,1,157,151,4,
+  115,99,114,105,112,116,58,99,117,114,114,101,110,116,45,108,
+  105,110,101,0,0,129,16,172,54,45,110,0,0,129,134,4,
+  173,218,1,5,129,16,205,215,1,129,16,178,1,10,142,218,
+  1,214,218,1,193,1,242,220,1,0,213,182,169,200,7,216,
+  218,1,225,1,225,1,195,153,4,115,99,114,105,112,116,58,
+  105,103,110,111,114,101,45,116,111,45,101,111,108,0,0,129,
+  16,172,54,45,0,0,129,134,4,216,218,1,6,129,16,205,
+  215,1,10,184,218,1,254,218,1,193,1,242,220,1,189,189,
+  133,222,1,128,219,1,225,1,225,1,228,146,4,115,99,114,
+  105,112,116,58,97,98,111,114,116,45,105,110,99,108,117,100,
+  101,0,0,129,16,172,54,45,0,0,129,134,4,128,219,1,
+  7,129,16,205,215,1,10,224,218,1,151,219,1,193,1,242,
+  220,1,253,218,199,120,153,219,1,225,1,225,1,163,201,2,
+  97,98,111,114,116,0,0,129,16,172,54,45,0,0,129,134,
+  4,153,219,1,155,1,129,16,176,38,1,8,129,16,205,215,
+  1,10,136,219,1,199,219,1,193,1,242,220,1,190,193,137,
+  136,7,201,219,1,225,1,225,1,186,152,4,115,99,114,105,
+  112,116,58,99,117,114,114,101,110,116,45,108,105,110,101,45,
+  116,101,120,116,0,0,129,16,172,54,45,115,0,0,129,6,
+  201,219,1,129,16,147,54,129,14,215,219,1,1,9,129,16,
+  205,215,1,10,130,138,132,64,210,219,1,6,10,165,219,1,
+  250,219,1,193,1,142,221,1,0,219,131,252,217,3,252,219,
+  1,225,1,225,1,161,149,4,115,99,114,105,112,116,58,97,
+  117,116,111,108,111,97,100,45,105,110,100,101,120,0,0,129,
+  16,172,54,115,45,102,0,0,129,134,4,252,219,1,11,129,
+  16,205,215,1,10,219,219,1,159,220,1,193,1,142,221,1,
+  0,229,193,163,196,11,161,220,1,225,1,225,1,151,148,4,
+  115,99,114,105,112,116,58,97,117,116,111,108,111,97,100,0,
+  0,129,16,172,54,115,45,102,0,0,129,6,161,220,1,129,
+  16,137,20,129,14,186,220,1,129,16,156,216,1,129,14,180,
+  220,1,1,12,129,16,205,215,1,10,133,130,32,175,220,1,
+  6,129,16,185,216,1,10,1,171,220,1,129,16,248,28,1,
+  12,129,16,205,215,1,10,129,14,223,220,1,129,16,173,128,
+  1,129,16,159,220,1,129,14,215,220,1,129,16,173,128,1,
+  129,16,210,3,10,1,203,220,1,129,14,215,220,1,129,158,
+  32,210,216,1,10,129,152,132,168,1,0,0,31,129,46,212,
+  220,1,129,16,245,119,10,1,197,220,1,129,14,240,220,1,
+  129,16,147,54,129,14,236,220,1,1,13,129,16,205,215,1,
+  10,130,138,132,64,231,220,1,6,10,1,227,220,1,105,110,
+  116,101,114,102,97,99,101,47,115,99,114,105,112,116,105,110,
+  103,46,114,101,116,114,111,0,0,242,220,1,164,221,1,115,
+  99,114,105,112,116,58,97,117,116,111,108,111,97,100,45,105,
+  110,100,101,120,0,0,142,221,1,236,225,1,134,220,1,192,
+  221,1,193,1,238,225,1,153,180,140,153,1,194,221,1,225,
+  1,225,1,241,166,4,115,111,99,107,101,116,58,111,112,101,
+  114,97,116,105,111,110,0,0,129,16,172,54,110,45,0,0,
+  129,134,4,194,221,1,7,129,16,198,126,2,129,16,255,27,
+  129,14,227,222,1,3,129,16,172,54,69,114,114,111,114,58,
+  32,115,111,99,107,101,116,32,100,101,118,105,99,101,32,110,
+  111,116,32,102,111,117,110,100,0,0,1,210,221,1,129,16,
+  188,127,129,16,133,127,129,16,172,54,83,101,101,32,104,116,
+  116,112,115,58,47,47,114,101,116,114,111,102,111,114,116,104,
+  46,111,114,103,47,115,117,112,112,111,114,116,47,50,48,50,
+  50,46,49,47,83,79,67,75,69,84,83,46,109,100,0,0,
+  1,249,221,1,129,16,188,127,129,16,133,127,129,16,172,54,
+  102,111,114,32,105,110,115,116,114,117,99,116,105,111,110,115,
+  32,111,110,32,101,110,97,98,108,105,110,103,32,115,111,99,
+  107,101,116,115,46,0,0,1,182,222,1,129,16,188,127,129,
+  16,133,127,10,1,207,221,1,129,16,248,28,129,16,175,126,
+  10,166,221,1,136,223,1,193,1,212,225,1,130,165,236,219,
+  7,138,223,1,225,1,225,1,207,164,4,115,111,99,107,101,
+  116,58,103,101,116,104,111,115,116,98,121,110,97,109,101,0,
+  0,129,16,172,54,97,115,45,0,0,129,134,4,138,223,1,
+  0,0,129,16,192,221,1,10,234,222,1,171,223,1,193,1,
+  212,225,1,0,199,171,157,187,1,173,223,1,225,1,225,1,
+  186,164,4,115,111,99,107,101,116,58,99,114,101,97,116,101,
+  0,0,129,16,172,54,45,110,0,0,129,134,4,173,223,1,
+  1,129,16,192,221,1,10,148,223,1,203,223,1,193,1,212,
+  225,1,0,245,225,181,225,5,205,223,1,225,1,225,1,139,
+  162,4,115,111,99,107,101,116,58,98,105,110,100,0,0,129,
+  16,172,54,115,110,45,110,0,0,129,134,4,205,223,1,2,
+  129,16,192,221,1,10,182,223,1,239,223,1,193,1,212,225,
+  1,247,196,191,69,241,223,1,225,1,225,1,213,165,4,115,
+  111,99,107,101,116,58,108,105,115,116,101,110,0,0,129,16,
+  172,54,110,110,45,110,110,0,0,129,134,4,241,223,1,3,
+  129,16,192,221,1,10,216,223,1,148,224,1,193,1,212,225,
+  1,0,207,207,243,150,2,150,224,1,225,1,225,1,198,161,
+  4,115,111,99,107,101,116,58,97,99,99,101,112,116,0,0,
+  129,16,172,54,110,45,110,110,0,0,129,134,4,150,224,1,
+  4,129,16,192,221,1,10,253,223,1,185,224,1,193,1,212,
+  225,1,146,249,132,188,7,187,224,1,225,1,225,1,225,163,
+  4,115,111,99,107,101,116,58,99,111,110,110,101,99,116,0,
+  0,129,16,172,54,110,45,110,110,0,0,129,134,4,187,224,
+  1,5,129,16,192,221,1,10,161,224,1,219,224,1,193,1,
+  212,225,1,0,155,220,235,224,5,221,224,1,225,1,225,1,
+  225,168,4,115,111,99,107,101,116,58,115,101,110,100,0,0,
+  129,16,172,54,115,110,45,110,110,0,0,129,134,4,221,224,
+  1,6,129,16,192,221,1,10,198,224,1,254,224,1,193,1,
+  212,225,1,0,143,147,240,224,5,128,225,1,225,1,225,1,
+  183,167,4,115,111,99,107,101,116,58,114,101,99,118,0,0,
+  129,16,172,54,97,110,110,45,110,110,0,0,129,134,4,128,
+  225,1,7,129,16,192,221,1,10,233,224,1,163,225,1,193,
+  1,212,225,1,222,248,151,121,165,225,1,225,1,225,1,252,
+  162,4,115,111,99,107,101,116,58,99,108,111,115,101,0,0,
+  129,16,172,54,110,45,0,0,129,134,4,165,225,1,8,129,
+  16,192,221,1,10,141,225,1,200,225,1,193,1,212,225,1,
+  234,149,144,211,4,202,225,1,225,1,225,1,140,163,4,115,
+  111,99,107,101,116,58,99,111,110,102,105,103,117,114,101,0,
+  0,129,16,172,54,115,115,45,0,0,129,134,4,202,225,1,
+  9,129,16,192,221,1,10,105,110,116,101,114,102,97,99,101,
+  47,115,111,99,107,101,116,115,46,114,101,116,114,111,0,0,
+  212,225,1,255,225,1,115,111,99,107,101,116,58,111,112,101,
+  114,97,116,105,111,110,0,0,238,225,1,225,242,1,174,225,
+  1,146,226,1,193,1,199,242,1,0,191,238,248,165,12,148,
+  226,1,225,1,225,1,230,213,3,105,111,58,99,111,114,101,
+  0,0,129,16,172,54,110,45,0,0,129,134,4,148,226,1,
+  192,62,129,16,198,126,129,16,175,126,10,129,226,1,178,226,
+  1,193,1,199,242,1,0,135,240,218,157,11,180,226,1,225,
+  1,225,1,202,243,2,99,111,114,101,58,105,110,105,116,0,
+  0,129,16,172,54,110,45,0,0,129,134,4,180,226,1,0,
+  0,129,16,146,226,1,10,159,226,1,209,226,1,193,1,199,
+  242,1,246,129,197,219,6,211,226,1,225,1,225,1,204,248,
+  2,99,111,114,101,58,115,116,97,114,116,0,0,129,16,172,
+  54,97,110,45,0,0,129,134,4,211,226,1,1,129,16,146,
+  226,1,10,189,226,1,241,226,1,193,1,199,242,1,230,194,
+  195,217,6,243,226,1,225,1,225,1,253,244,2,99,111,114,
+  101,58,112,97,117,115,101,0,0,129,16,172,54,110,45,0,
+  0,129,134,4,243,226,1,2,129,16,146,226,1,10,221,226,
+  1,152,227,1,193,1,199,242,1,0,211,207,179,229,6,154,
+  227,1,225,1,225,1,157,245,2,99,111,114,101,58,112,97,
+  117,115,101,45,99,117,114,114,101,110,116,0,0,129,16,172,
+  54,45,0,0,129,134,4,154,227,1,3,129,16,146,226,1,
+  10,252,226,1,183,227,1,193,1,199,242,1,0,205,181,138,
+  156,5,185,227,1,225,1,225,1,175,246,2,99,111,114,101,
+  58,114,101,115,117,109,101,0,0,129,16,172,54,110,45,0,
+  0,129,134,4,185,227,1,4,129,16,146,226,1,10,162,227,
+  1,217,227,1,193,1,199,242,1,177,140,142,171,3,219,227,
+  1,225,1,225,1,197,245,2,99,111,114,101,58,114,101,97,
+  100,47,114,101,103,0,0,129,16,172,54,110,45,118,0,0,
+  129,134,4,219,227,1,5,129,16,146,226,1,10,194,227,1,
+  253,227,1,193,1,199,242,1,0,191,231,164,249,8,255,227,
+  1,225,1,225,1,148,249,2,99,111,114,101,58,119,114,105,
+  116,101,47,114,101,103,0,0,129,16,172,54,118,110,45,0,
+  0,129,134,4,255,227,1,6,129,16,146,226,1,10,229,227,
+  1,157,228,1,193,1,199,242,1,255,183,223,222,6,159,228,
+  1,225,1,225,1,206,249,2,99,111,114,101,58,121,105,101,
+  108,100,0,0,129,16,172,54,45,0,0,129,134,4,159,228,
+  1,7,129,16,146,226,1,10,137,228,1,191,228,1,193,1,
+  199,242,1,0,157,200,233,233,13,193,228,1,225,1,225,1,
+  241,247,2,99,111,114,101,58,115,101,116,45,115,108,105,99,
+  101,0,0,129,16,172,54,110,45,0,0,129,134,4,193,228,
+  1,8,129,16,146,226,1,10,167,228,1,223,228,1,193,1,
+  199,242,1,173,162,158,207,2,225,228,1,225,1,225,1,132,
+  216,4,99,104,97,110,58,99,114,101,97,116,101,0,0,129,
+  16,172,54,110,45,99,0,0,129,134,4,225,228,1,9,129,
+  16,146,226,1,10,202,228,1,129,229,1,193,1,199,242,1,
+  0,185,132,187,151,13,131,229,1,225,1,225,1,194,216,4,
+  99,104,97,110,58,100,101,115,116,114,111,121,0,0,129,16,
+  172,54,99,45,0,0,129,134,4,131,229,1,10,129,16,146,
+  226,1,10,235,228,1,163,229,1,193,1,199,242,1,239,207,
+  165,235,1,165,229,1,225,1,225,1,168,219,4,99,104,97,
+  110,58,116,114,121,45,115,101,110,100,0,0,129,16,172,54,
+  118,99,45,102,0,0,129,134,4,165,229,1,11,129,16,146,
+  226,1,10,140,229,1,202,229,1,193,1,199,242,1,232,203,
+  160,224,7,204,229,1,225,1,225,1,190,218,4,99,104,97,
+  110,58,116,114,121,45,114,101,99,101,105,118,101,0,0,129,
+  16,172,54,99,45,118,102,0,0,129,134,4,204,229,1,12,
+  129,16,146,226,1,10,176,229,1,234,229,1,193,1,199,242,
+  1,195,153,246,197,2,236,229,1,225,1,225,1,255,217,4,
+  99,104,97,110,58,115,101,110,100,0,0,129,16,172,54,118,
+  99,45,0,0,129,6,236,229,1,129,14,137,230,1,133,132,
+  152,32,133,132,152,32,129,16,163,229,1,129,14,254,229,1,
+  131,6,129,16,251,25,10,1,250,229,1,129,16,248,28,130,
+  2,14,129,16,146,226,1,129,16,233,25,10,1,244,229,1,
+  129,16,186,24,10,215,229,1,164,230,1,193,1,199,242,1,
+  0,135,215,143,207,6,166,230,1,225,1,225,1,233,216,4,
+  99,104,97,110,58,114,101,99,101,105,118,101,0,0,129,16,
+  172,54,99,45,118,0,0,129,6,166,230,1,129,14,194,230,
+  1,2,129,16,202,229,1,129,14,183,230,1,132,6,129,16,
+  251,25,10,1,179,230,1,129,16,248,28,131,132,4,13,129,
+  16,146,226,1,129,16,233,25,10,1,174,230,1,129,16,186,
+  24,10,142,230,1,220,230,1,193,1,199,242,1,185,132,203,
+  242,4,222,230,1,225,1,225,1,164,217,4,99,104,97,110,
+  58,115,101,108,101,99,116,0,0,129,16,172,54,97,45,110,
+  0,0,129,6,222,230,1,129,14,254,230,1,130,2,15,129,
+  16,146,226,1,2,129,16,255,27,129,14,243,230,1,132,6,
+  129,16,251,25,10,1,239,230,1,129,16,143,29,131,132,4,
+  16,129,16,146,226,1,129,16,233,25,10,1,230,230,1,129,
+  16,186,24,10,199,230,1,148,231,1,193,1,199,242,1,0,
+  149,215,183,196,5,150,231,1,225,1,225,1,163,243,2,99,
+  111,114,101,58,105,100,0,0,129,16,172,54,45,110,0,0,
+  129,134,4,150,231,1,18,129,16,146,226,1,10,131,231,1,
+  181,231,1,193,1,199,242,1,244,195,140,153,1,183,231,1,
+  225,1,225,1,202,244,2,99,111,114,101,58,109,97,105,108,
+  98,111,120,0,0,129,16,172,54,110,45,99,0,0,129,134,
+  4,183,231,1,17,129,16,146,226,1,10,159,231,1,212,231,
+  1,193,1,199,242,1,0,219,151,176,157,11,214,231,1,225,
+  1,225,1,202,247,2,99,111,114,101,58,115,101,110,100,0,
+  0,129,16,172,54,118,110,45,0,0,129,6,214,231,1,129,
+  16,181,231,1,129,16,234,229,1,10,193,231,1,247,231,1,
+  193,1,199,242,1,0,169,219,170,177,12,249,231,1,225,1,
+  225,1,249,245,2,99,111,114,101,58,114,101,99,101,105,118,
+  101,0,0,129,16,172,54,45,118,0,0,129,6,249,231,1,
+  129,16,148,231,1,129,16,181,231,1,129,16,164,230,1,10,
+  225,231,1,155,232,1,193,1,199,242,1,0,179,167,156,145,
+  3,157,232,1,225,1,225,1,226,222,4,97,116,111,109,105,
+  99,58,102,101,116,99,104,0,0,129,16,172,54,97,45,110,
+  0,0,129,134,4,157,232,1,19,129,16,146,226,1,10,133,
+  232,1,189,232,1,193,1,199,242,1,0,237,147,129,130,3,
+  191,232,1,225,1,225,1,166,224,4,97,116,111,109,105,99,
+  58,115,116,111,114,101,0,0,129,16,172,54,110,97,45,0,
+  0,129,134,4,191,232,1,20,129,16,146,226,1,10,167,232,
+  1,221,232,1,193,1,199,242,1,0,153,252,192,236,8,223,
+  232,1,225,1,225,1,245,219,4,97,116,111,109,105,99,58,
+  99,97,115,0,0,129,16,172,54,111,110,97,45,102,0,0,
+  129,134,4,223,232,1,21,129,16,146,226,1,10,201,232,1,
+  133,233,1,193,1,199,242,1,0,199,191,244,143,5,135,233,
+  1,225,1,225,1,147,223,4,97,116,111,109,105,99,58,102,
+  101,116,99,104,45,97,100,100,0,0,129,16,172,54,110,97,
+  45,110,0,0,129,134,4,135,233,1,22,129,16,146,226,1,
+  10,235,232,1,171,233,1,193,1,199,242,1,0,215,149,205,
+  252,5,173,233,1,225,1,225,1,220,223,4,97,116,111,109,
+  105,99,58,102,101,116,99,104,45,111,114,0,0,129,16,172,
+  54,110,97,45,110,0,0,129,134,4,173,233,1,23,129,16,
+  146,226,1,10,146,233,1,209,233,1,193,1,199,242,1,159,
+  153,220,153,7,211,233,1,225,1,225,1,217,220,4,97,116,
+  111,109,105,99,58,101,120,99,104,97,110,103,101,0,0,129,
+  16,172,54,110,97,45,110,0,0,129,134,4,211,233,1,24,
+  129,16,146,226,1,10,184,233,1,244,233,1,193,1,199,242,
+  1,0,197,141,157,145,3,246,233,1,225,1,225,1,159,221,
+  4,97,116,111,109,105,99,58,102,101,110,99,101,0,0,129,
+  16,172,54,45,0,0,129,134,4,246,233,1,25,129,16,146,
+  226,1,10,222,233,1,156,234,1,193,1,199,242,1,0,211,
+  250,141,161,9,158,234,1,225,1,225,1,225,221,4,97,116,
+  111,109,105,99,58,102,101,110,99,101,47,97,99,113,117,105,
+  114,101,0,0,129,16,172,54,45,0,0,129,134,4,158,234,
+  1,26,129,16,146,226,1,10,254,233,1,196,234,1,193,1,
+  199,242,1,0,165,156,230,146,5,198,234,1,225,1,225,1,
+  161,222,4,97,116,111,109,105,99,58,102,101,110,99,101,47,
+  114,101,108,101,97,115,101,0,0,129,16,172,54,45,0,0,
+  129,134,4,198,234,1,27,129,16,146,226,1,10,166,234,1,
+  229,234,1,193,1,199,242,1,136,169,188,161,2,231,234,1,
+  225,1,225,1,251,246,2,99,111,114,101,58,114,117,110,110,
+  105,110,103,63,0,0,129,16,172,54,110,45,102,0,0,129,
+  134,4,231,234,1,30,129,16,146,226,1,10,206,234,1,133,
+  235,1,193,1,199,242,1,145,159,181,210,6,135,235,1,225,
+  1,225,1,244,242,2,99,111,114,101,58,99,111,117,110,116,
+  0,0,129,16,172,54,45,110,0,0,129,134,4,135,235,1,
+  31,129,16,146,226,1,10,241,234,1,128,2,178,1,199,242,
+  1,0,253,209,231,135,7,0,0,225,1,225,1,208,224,4,
+  80,65,82,58,77,65,88,45,67,72,85,78,75,83,0,0,
+  144,235,1,183,235,1,178,1,0,0,132,220,222,102,0,0,
+  225,1,225,1,0,0,65,114,114,97,121,0,2,168,235,1,
+  199,235,1,178,1,0,0,211,161,235,111,0,0,225,1,225,
+  1,0,0,81,117,111,116,101,0,2,184,235,1,214,235,1,
+  178,1,0,0,192,195,177,228,7,0,0,225,1,225,1,0,
+  0,83,105,122,101,0,2,200,235,1,231,235,1,178,1,0,
+  0,0,221,232,218,195,10,0,0,225,1,225,1,0,0,67,
+  104,117,110,107,115,0,2,215,235,1,249,235,1,178,1,0,
+  0,202,151,171,44,0,0,225,1,225,1,0,0,80,101,110,
+  100,105,110,103,0,2,232,235,1,140,236,1,178,1,0,0,
+  214,181,146,202,7,0,0,225,1,225,1,0,0,82,101,100,
+  117,99,105,110,103,0,2,250,235,1,158,236,1,178,1,0,
+  0,0,209,128,231,129,12,0,0,225,1,225,1,0,0,82,
+  101,115,117,108,116,115,0,128,4,141,236,1,177,238,1,193,
+  1,0,0,0,251,249,252,161,6,179,238,1,225,1,225,1,
+  0,0,119,111,114,107,58,112,117,115,104,0,0,129,16,172,
+  54,110,99,45,0,0,129,134,4,179,238,1,28,129,16,146,
+  226,1,10,158,238,1,208,238,1,193,1,0,0,0,177,140,
+  238,161,6,210,238,1,225,1,225,1,0,0,119,111,114,107,
+  58,116,97,107,101,0,0,129,16,172,54,45,110,0,0,129,
+  134,4,210,238,1,29,129,16,146,226,1,10,189,238,1,235,
+  238,1,193,1,0,0,0,159,144,230,182,1,0,0,225,1,
+  225,1,0,0,98,111,117,110,100,115,0,0,129,158,204,8,
+  214,235,1,183,235,1,15,129,16,225,96,133,132,152,32,146,
+  132,132,120,214,235,1,14,129,14,250,238,1,131,130,60,214,
+  235,1,10,129,18,247,238,1,129,14,131,239,1,129,30,183,
+  235,1,129,16,143,102,10,133,130,32,254,238,1,6,10,219,
+  238,1,154,239,1,193,1,0,0,169,151,222,237,2,0,0,
+  225,1,225,1,0,0,109,97,112,45,99,104,117,110,107,0,
+  0,129,14,166,239,1,130,158,132,120,199,235,1,8,133,132,
+  152,32,144,130,68,1,134,130,200,200,1,1,133,130,28,156,
+  239,1,129,162,132,40,1,170,239,1,133,130,28,162,239,1,
+  3,10,135,239,1,195,239,1,193,1,0,0,0,249,240,190,
+  128,8,0,0,225,1,225,1,0,0,114,101,100,117,99,101,
+  45,99,104,117,110,107,0,0,1,62,129,16,139,23,129,36,
+  1,129,14,213,239,1,1,62,129,16,139,23,132,130,188,64,
+  199,235,1,134,130,200,200,1,1,133,130,28,203,239,1,129,
+  162,132,40,1,217,239,1,133,130,28,209,239,1,132,6,10,
+  173,239,1,233,239,1,193,1,0,0,218,206,162,92,0,0,
+  225,1,225,1,0,0,114,117,110,0,0,2,129,16,235,238,
+  1,129,30,140,236,1,129,14,245,239,1,129,16,195,239,1,
+  132,130,196,128,1,158,236,1,10,1,240,239,1,129,16,248,
+  28,129,16,154,239,1,3,10,220,239,1,141,240,1,193,1,
+  0,0,223,190,183,172,2,0,0,225,1,225,1,0,0,119,
+  111,114,107,101,114,0,0,129,14,169,240,1,129,16,208,238,
+  1,2,129,16,255,27,129,14,154,240,1,3,129,16,251,25,
+  10,1,150,240,1,129,16,248,28,129,16,233,239,1,129,2,
+  0,1,249,235,1,129,16,133,233,1,3,129,16,233,25,10,
+  1,143,240,1,129,16,186,24,10,253,239,1,189,240,1,193,
+  1,0,0,241,139,253,130,1,0,0,225,1,225,1,0,0,
+  115,112,108,105,116,0,0,130,130,64,183,235,1,129,16,225,
+  96,2,129,16,133,235,1,129,166,132,144,1,4,1,17,129,
+  16,133,235,1,129,38,4,148,136,140,8,1,129,16,199,30,
+  133,132,152,32,129,162,4,255,1,128,2,148,136,12,129,16,
+  199,30,129,160,132,120,214,235,1,214,235,1,129,164,196,8,
+  1,214,235,1,143,168,144,24,129,32,231,235,1,10,174,240,
+  1,248,240,1,193,1,0,0,0,165,229,191,203,8,0,0,
+  225,1,225,1,0,0,115,116,97,114,116,45,119,111,114,107,
+  101,114,115,0,0,1,1,129,16,133,235,1,129,36,1,129,
+  14,151,241,1,2,129,16,229,234,1,129,14,142,241,1,2,
+  129,16,178,226,1,1,141,240,1,133,132,152,32,129,16,209,
+  226,1,10,129,150,132,72,0,0,133,241,1,129,34,1,134,
+  130,200,200,1,1,133,130,28,128,241,1,129,162,132,40,1,
+  155,241,1,133,130,28,147,241,1,3,10,225,240,1,176,241,
+  1,193,1,0,0,181,130,194,227,6,0,0,225,1,225,1,
+  0,0,100,105,115,112,97,116,99,104,0,0,129,158,4,231,
+  235,1,249,235,1,129,16,189,232,1,129,130,60,0,0,231,
+  235,1,129,14,198,241,1,130,4,129,16,133,235,1,148,6,
+  129,16,177,238,1,129,34,1,134,130,200,200,1,1,133,130,
+  28,186,241,1,129,162,132,40,1,202,241,1,133,130,28,194,
+  241,1,3,129,16,248,240,1,129,16,141,240,1,129,14,219,
+  241,1,1,249,235,1,129,16,155,232,1,129,16,230,27,130,
+  130,36,157,228,1,10,1,210,241,1,129,16,186,24,10,144,
+  235,1,243,241,1,193,1,199,242,1,208,131,145,232,4,245,
+  241,1,225,1,225,1,134,193,2,97,58,109,97,112,47,112,
+  97,114,0,0,129,16,172,54,97,113,45,97,0,0,129,134,
+  132,128,1,245,241,1,199,235,1,2,129,16,189,240,1,129,
+  16,251,25,129,32,140,236,1,129,16,176,241,1,10,224,241,
+  1,157,242,1,193,1,199,242,1,138,211,169,159,4,159,242,
+  1,225,1,225,1,230,196,2,97,58,114,101,100,117,99,101,
+  47,112,97,114,0,0,129,16,172,54,97,110,113,45,110,0,
+  0,129,134,132,128,1,159,242,1,199,235,1,4,129,16,189,
+  240,1,129,16,233,25,129,32,140,236,1,129,16,176,241,1,
+  129,130,60,158,236,1,231,235,1,129,14,192,242,1,130,130,
+  196,32,1,143,136,148,8,199,235,1,143,16,6,134,130,200,
+  200,1,1,133,130,28,182,242,1,129,162,132,40,1,196,242,
+  1,133,130,28,188,242,1,3,10,105,110,116,101,114,102,97,
+  99,101,47,109,117,108,116,105,99,111,114,101,46,114,101,116,
+  114,111,0,0,199,242,1,237,244,1,135,242,1,246,242,1,
+  193,1,214,244,1,0,167,200,147,151,14,248,242,1,225,1,
+  225,1,208,214,3,105,111,58,101,118,101,110,116,115,0,0,
+  129,16,172,54,110,45,0,0,129,134,4,248,242,1,136,64,
+  129,16,198,126,129,16,175,126,10,227,242,1,155,243,1,193,
+  1,214,244,1,0,245,233,161,179,12,157,243,1,225,1,225,
+  1,228,225,4,101,118,101,110,116,58,112,101,110,100,105,110,
+  103,63,0,0,129,16,172,54,45,102,0,0,129,134,4,157,
+  243,1,0,0,129,16,246,242,1,10,131,243,1,186,243,1,
+  193,1,214,244,1,0,207,165,227,197,4,188,243,1,225,1,
+  225,1,156,226,4,101,118,101,110,116,58,112,111,108,108,0,
+  0,129,16,172,54,97,45,116,102,0,0,129,134,4,188,243,
+  1,1,129,16,246,242,1,10,166,243,1,219,243,1,193,1,
+  214,244,1,0,211,186,198,197,4,221,243,1,225,1,225,1,
+  200,228,4,101,118,101,110,116,58,119,97,105,116,0,0,129,
+  16,172,54,97,110,45,116,102,0,0,129,134,4,221,243,1,
+  2,129,16,246,242,1,10,199,243,1,253,243,1,193,1,214,
+  244,1,0,241,161,227,197,4,255,243,1,225,1,225,1,128,
+  227,4,101,118,101,110,116,58,112,111,115,116,0,0,129,16,
+  172,54,116,97,45,102,0,0,129,134,4,255,243,1,3,129,
+  16,246,242,1,10,233,243,1,165,244,1,193,1,214,244,1,
+  0,207,134,143,138,1,167,244,1,225,1,225,1,130,228,4,
+  101,118,101,110,116,58,115,101,116,45,104,97,110,100,108,101,
+  114,0,0,129,16,172,54,113,45,0,0,129,134,4,167,244,
+  1,4,129,16,246,242,1,10,138,244,1,203,244,1,193,1,
+  214,244,1,158,130,219,12,205,244,1,225,1,225,1,171,225,
+  4,101,118,101,110,116,58,109,97,120,45,112,97,121,108,111,
+  97,100,0,0,129,16,172,54,45,110,0,0,129,134,4,205,
+  244,1,5,129,16,246,242,1,10,105,110,116,101,114,102,97,
+  99,101,47,101,118,101,110,116,115,46,114,101,116,114,111,0,
+  0,214,244,1,182,246,1,176,244,1,134,245,1,193,1,162,
+  246,1,197,224,129,206,7,136,245,1,225,1,225,1,129,183,
+  3,102,102,105,58,111,112,101,114,97,116,105,111,110,0,0,
+  129,16,172,54,110,45,63,0,0,129,134,4,136,245,1,164,
+  63,129,16,198,126,2,129,16,255,27,129,14,188,245,1,3,
+  129,16,172,54,69,114,114,111,114,58,32,70,70,73,32,100,
+  101,118,105,99,101,32,110,111,116,32,102,111,117,110,100,0,
+  0,1,153,245,1,129,16,188,127,129,16,133,127,10,1,150,
+  245,1,129,16,248,28,129,16,175,126,10,239,244,1,213,245,
+  1,193,1,162,246,1,198,159,161,151,4,215,245,1,225,1,
+  225,1,219,182,3,102,102,105,58,111,112,101,110,0,0,129,
+  16,172,54,115,45,110,0,0,129,134,4,215,245,1,0,0,
+  129,16,134,245,1,10,195,245,1,246,245,1,193,1,162,246,
+  1,0,143,219,175,234,10,248,245,1,225,1,225,1,142,182,
+  3,102,102,105,58,109,97,112,45,115,121,109,0,0,129,16,
+  172,54,115,110,45,110,0,0,129,134,4,248,245,1,1,129,
+  16,134,245,1,10,225,245,1,151,246,1,193,1,162,246,1,
+  0,191,154,243,253,13,153,246,1,225,1,225,1,188,181,3,
+  102,102,105,58,105,110,118,111,107,101,0,0,129,16,172,54,
+  110,45,0,0,129,134,4,153,246,1,2,129,16,134,245,1,
+  10,105,110,116,101,114,102,97,99,101,47,102,102,105,46,114,
+  101,116,114,111,0,0,162,246,1,255,249,1,131,246,1,204,
+  246,1,193,1,230,249,1,0,241,249,229,248,6,206,246,1,
+  225,1,225,1,218,190,4,117,110,115,105,103,110,101,100,58,
+  43,0,0,129,16,172,54,110,110,45,110,0,0,129,134,132,
+  8,206,246,1,0,0,165,63,129,16,198,126,129,16,175,126,
+  17,10,184,246,1,241,246,1,193,1,230,249,1,0,237,249,
+  229,248,6,243,246,1,225,1,225,1,130,191,4,117,110,115,
+  105,103,110,101,100,58,45,0,0,129,16,172,54,110,110,45,
+  110,0,0,129,134,132,8,243,246,1,0,0,165,63,129,16,
+  198,126,129,16,175,126,18,10,221,246,1,150,247,1,193,1,
+  230,249,1,0,243,249,229,248,6,152,247,1,225,1,225,1,
+  199,189,4,117,110,115,105,103,110,101,100,58,42,0,0,129,
+  16,172,54,110,110,45,110,0,0,129,134,132,8,152,247,1,
+  0,0,165,63,129,16,198,126,129,16,175,126,19,10,130,247,
+  1,190,247,1,193,1,230,249,1,0,233,159,210,71,192,247,
+  1,225,1,225,1,143,192,4,117,110,115,105,103,110,101,100,
+  58,47,109,111,100,0,0,129,16,172,54,110,110,45,110,110,
+  0,0,129,134,132,8,192,247,1,0,0,165,63,129,16,198,
+  126,129,16,175,126,20,10,167,247,1,230,247,1,193,1,230,
+  249,1,0,221,236,169,219,9,232,247,1,225,1,225,1,220,
+  192,4,117,110,115,105,103,110,101,100,58,101,113,63,0,0,
+  129,16,172,54,110,110,45,102,0,0,129,134,132,8,232,247,
+  1,0,0,165,63,129,16,198,126,129,16,175,126,11,10,208,
+  247,1,142,248,1,193,1,230,249,1,0,195,138,220,71,144,
+  248,1,225,1,225,1,177,191,4,117,110,115,105,103,110,101,
+  100,58,45,101,113,63,0,0,129,16,172,54,110,110,45,102,
+  0,0,129,134,132,8,144,248,1,0,0,165,63,129,16,198,
+  126,129,16,175,126,12,10,247,247,1,181,248,1,193,1,230,
+  249,1,0,137,244,168,219,9,183,248,1,225,1,225,1,133,
+  194,4,117,110,115,105,103,110,101,100,58,108,116,63,0,0,
+  129,16,172,54,110,110,45,102,0,0,129,134,132,8,183,248,
+  1,0,0,165,63,129,16,198,126,129,16,175,126,13,10,159,
+  248,1,220,248,1,193,1,230,249,1,0,147,201,169,219,9,
+  222,248,1,225,1,225,1,180,193,4,117,110,115,105,103,110,
+  101,100,58,103,116,63,0,0,129,16,172,54,110,110,45,102,
+  0,0,129,134,132,8,222,248,1,0,0,165,63,129,16,198,
+  126,129,16,175,126,14,10,198,248,1,133,249,1,193,1,230,
+  249,1,250,201,161,136,7,135,249,1,225,1,225,1,211,194,
+  4,117,110,115,105,103,110,101,100,58,115,104,105,102,116,0,
+  0,129,16,172,54,110,110,45,110,0,0,129,134,132,8,135,
+  249,1,0,0,165,63,129,16,198,126,129,16,175,126,24,10,
+  237,248,1,174,249,1,193,1,230,249,1,181,241,128,222,6,
+  176,249,1,225,1,225,1,244,189,4,117,110,115,105,103,110,
+  101,100,58,42,47,109,111,100,0,0,129,16,172,54,110,110,
+  110,45,110,110,0,0,129,134,132,8,176,249,1,1,0,0,
+  1,165,63,129,16,198,126,2,129,16,175,126,129,16,175,126,
+  10,150,249,1,212,249,1,193,1,230,249,1,254,210,202,88,
+  214,249,1,225,1,225,1,163,135,2,42,47,109,111,100,0,
+  0,129,16,172,54,110,110,110,45,110,110,0,0,129,134,132,
+  8,214,249,1,1,165,63,129,16,198,126,129,16,175,126,10,
+  105,110,116,101,114,102,97,99,101,47,117,110,115,105,103,110,
+  101,100,46,114,101,116,114,111,0,0,230,249,1,223,251,1,
+  197,249,1,143,250,1,178,1,0,0,156,208,177,228,7,0,
+  0,225,1,225,1,0,0,83,107,105,112,0,2,129,250,1,
+  166,250,1,193,1,0,0,150,204,168,150,5,0,0,225,1,
+  225,1,0,0,98,108,111,99,107,58,105,110,118,111,107,101,
+  0,0,1,3,129,16,198,126,129,16,175,126,10,197,249,1,
+  193,250,1,193,1,200,251,1,198,217,238,203,1,195,250,1,
+  225,1,225,1,193,207,2,98,108,111,99,107,58,114,101,97,
+  100,0,0,129,16,172,54,110,97,45,0,0,129,6,195,250,
+  1,129,14,206,250,1,129,158,68,143,250,1,10,133,130,32,
+  203,250,1,6,1,0,0,129,16,166,250,1,10,173,250,1,
+  235,250,1,193,1,200,251,1,245,138,204,202,4,237,250,1,
+  225,1,225,1,150,209,2,98,108,111,99,107,58,119,114,105,
+  116,101,0,0,129,16,172,54,110,97,45,0,0,129,6,237,
+  250,1,129,14,248,250,1,129,158,68,143,250,1,10,133,130,
+  32,245,250,1,6,1,1,129,16,166,250,1,10,214,250,1,
+  152,251,1,193,1,200,251,1,0,249,189,168,218,10,154,251,
+  1,225,1,225,1,141,208,2,98,108,111,99,107,58,115,101,
+  116,45,102,105,108,101,0,0,129,16,172,54,115,45,0,0,
+  129,134,4,154,251,1,2,129,16,166,250,1,10,128,251,1,
+  191,251,1,193,1,200,251,1,131,201,220,186,3,193,251,1,
+  225,1,225,1,188,208,2,98,108,111,99,107,58,115,101,116,
+  45,114,101,115,101,114,118,101,100,0,0,129,16,172,54,110,
+  45,0,0,129,134,132,128,1,193,251,1,143,250,1,10,105,
+  110,116,101,114,102,97,99,101,47,98,108,111,99,107,115,46,
+  114,101,116,114,111,0,0,200,251,1,241,255,1,163,251,1,
+  250,251,1,193,1,251,253,1,0,129,238,214,142,5,252,251,
+  1,225,1,225,1,224,151,3,101,114,114,58,115,101,116,45,
+  104,97,110,100,108,101,114,0,0,129,16,172,54,110,110,45,
+  0,0,129,134,4,252,251,1,210,9,129,16,198,126,2,129,
+  16,255,27,129,14,187,252,1,3,129,16,172,54,69,114,114,
+  111,114,58,32,101,114,114,111,114,32,104,97,110,100,108,105,
+  110,103,32,100,101,118,105,99,101,32,110,111,116,32,102,111,
+  117,110,100,0,0,1,141,252,1,129,16,188,127,129,16,133,
+  127,10,1,138,252,1,129,16,248,28,129,8,0,0,129,16,
+  175,126,10,225,251,1,213,252,1,193,1,251,253,1,212,186,
+  216,164,7,215,252,1,225,1,225,1,184,150,3,101,114,114,
+  58,100,115,117,0,0,129,16,172,54,45,0,0,129,6,215,
+  252,1,129,16,252,127,129,16,133,127,129,16,172,54,69,82,
+  82,79,82,58,32,68,83,85,58,32,68,65,84,65,32,83,
+  84,65,67,75,32,85,78,68,69,82,70,76,79,87,0,0,
+  1,225,252,1,129,16,188,127,129,16,133,127,129,16,254,128,
+  1,10,196,252,1,156,253,1,193,1,251,253,1,206,186,216,
+  164,7,158,253,1,225,1,225,1,146,150,3,101,114,114,58,
+  100,115,111,0,0,129,16,172,54,45,0,0,129,6,158,253,
+  1,129,16,252,127,129,16,133,127,129,16,172,54,69,82,82,
+  79,82,58,32,68,83,79,58,32,68,65,84,65,32,83,84,
+  65,67,75,32,79,86,69,82,70,76,79,87,0,0,1,168,
+  253,1,129,16,188,127,129,16,133,127,129,16,254,128,1,10,
+  139,253,1,235,253,1,193,1,251,253,1,185,166,131,206,2,
+  237,253,1,225,1,225,1,169,151,3,101,114,114,58,115,101,
+  116,45,100,101,102,97,117,108,116,115,0,0,129,16,172,54,
+  45,0,0,129,134,132,8,237,253,1,213,252,1,1,129,16,
+  250,251,1,129,2,156,253,1,2,129,16,250,251,1,10,105,
+  110,116,101,114,102,97,99,101,47,101,114,114,111,114,46,114,
+  101,116,114,111,0,0,209,253,1,5,178,1,0,0,177,206,
+  217,168,3,0,0,225,1,225,1,0,0,75,69,82,78,69,
+  76,58,68,58,76,79,79,75,85,80,45,67,79,77,80,65,
+  82,65,84,79,82,45,79,70,70,83,69,84,0,0,145,254,
+  1,8,178,1,0,0,226,208,177,240,1,0,0,225,1,225,
+  1,0,0,75,69,82,78,69,76,58,68,58,76,79,79,75,
+  85,80,45,75,69,89,45,79,70,70,83,69,84,0,0,188,
+  254,1,129,16,178,1,0,0,231,178,208,185,4,0,0,225,
+  1,225,1,0,0,78,71,65,58,79,80,58,76,73,67,65,
+  0,0,224,254,1,139,255,1,193,1,207,255,1,0,205,179,
+  178,206,13,141,255,1,225,1,225,1,196,138,3,100,58,117,
+  115,101,45,104,97,115,104,101,115,0,0,129,16,172,54,45,
+  0,0,129,134,132,8,141,255,1,29,155,2,129,164,64,5,
+  129,14,155,255,1,129,16,213,1,15,10,129,130,192,8,151,
+  255,1,147,2,129,16,129,160,132,120,155,2,9,129,32,156,
+  2,10,245,254,1,188,255,1,193,1,207,255,1,135,159,197,
+  138,7,190,255,1,225,1,225,1,252,138,3,100,58,117,115,
+  101,45,115,116,114,105,110,103,115,0,0,129,16,172,54,45,
+  0,0,129,134,132,8,190,255,1,122,155,2,129,164,192,8,
+  5,223,1,129,160,132,8,147,2,0,0,155,2,144,130,132,
+  128,1,0,0,156,2,10,105,110,116,101,114,102,97,99,101,
+  47,104,97,115,104,101,100,45,100,105,99,116,105,111,110,97,
+  114,121,46,114,101,116,114,111,0,0,207,255,1,145,132,2,
+  165,255,1,2,178,1,0,0,236,144,249,53,0,0,225,1,
+  225,1,0,0,75,69,82,78,69,76,58,68,58,65,68,68,
+  45,72,69,65,68,69,82,45,66,79,68,89,45,79,70,70,
+  83,69,84,0,0,129,14,172,128,2,129,16,229,1,129,16,
+  244,16,129,162,132,120,9,9,8,129,16,244,16,129,16,213,
+  1,16,10,1,158,128,2,243,255,1,128,32,178,1,0,0,
+  191,200,145,4,0,0,225,1,225,1,0,0,76,73,66,82,
+  65,82,89,58,72,79,77,69,45,66,85,70,70,69,82,45,
+  67,65,80,65,67,73,84,89,0,0,174,128,2,226,128,2,
+  193,1,249,131,2,142,202,151,228,7,228,128,2,225,1,225,
+  1,193,164,2,72,79,77,69,0,0,129,16,172,54,45,115,
+  0,0,129,6,228,128,2,129,16,217,20,129,34,128,32,10,
+  37,115,47,46,99,111,110,102,105,103,47,114,101,116,114,111,
+  102,111,114,116,104,47,108,105,98,114,97,114,121,47,37,115,
+  46,114,101,116,114,111,0,0,212,128,2,238,128,2,178,1,
+  249,131,2,216,199,205,199,5,176,129,2,225,1,225,1,170,
+  217,3,108,105,98,114,97,114,121,58,46,67,79,78,70,73,
+  71,0,0,45,115,0,0,46,47,108,105,98,114,97,114,121,
+  47,37,115,46,114,101,116,114,111,0,0,149,129,2,177,129,
+  2,178,1,249,131,2,0,155,141,164,236,3,219,129,2,225,
+  1,225,1,243,218,3,108,105,98,114,97,114,121,58,67,87,
+  68,0,0,45,115,0,0,196,129,2,241,129,2,193,1,249,
+  131,2,0,219,219,159,236,3,243,129,2,225,1,225,1,213,
+  219,3,108,105,98,114,97,114,121,58,99,119,100,0,0,129,
+  16,172,54,115,45,115,0,0,129,134,4,243,129,2,177,129,
+  2,129,16,238,93,10,220,129,2,150,130,2,193,1,249,131,
+  2,0,207,253,146,161,11,152,130,2,225,1,225,1,253,217,
+  3,108,105,98,114,97,114,121,58,46,99,111,110,102,105,103,
+  0,0,129,16,172,54,45,115,0,0,129,6,152,130,2,129,
+  16,172,54,72,79,77,69,0,0,1,159,130,2,129,16,226,
+  128,2,129,16,200,206,1,129,16,226,128,2,1,238,128,2,
+  129,16,238,93,10,253,129,2,203,130,2,193,1,249,131,2,
+  0,213,139,195,251,4,205,130,2,225,1,225,1,150,220,3,
+  108,105,98,114,97,114,121,58,102,105,108,101,110,97,109,101,
+  0,0,129,16,172,54,115,45,115,0,0,129,134,8,205,130,
+  2,129,16,241,129,2,2,129,16,227,197,1,1,194,22,129,
+  16,248,28,3,129,16,150,130,2,2,129,16,227,197,1,129,
+  14,229,130,2,10,1,228,130,2,129,16,248,28,3,129,16,
+  147,54,10,177,130,2,136,131,2,193,1,249,131,2,0,155,
+  193,160,234,6,138,131,2,225,1,225,1,179,219,3,108,105,
+  98,114,97,114,121,58,99,111,110,116,97,105,110,115,63,0,
+  0,129,16,172,54,115,45,102,0,0,129,134,132,8,138,131,
+  2,241,129,2,150,130,2,129,16,173,23,1,227,197,1,129,
+  16,211,23,22,10,237,130,2,176,131,2,193,1,249,131,2,
+  180,241,135,70,178,131,2,225,1,225,1,211,220,3,108,105,
+  98,114,97,114,121,58,108,111,97,100,0,0,129,16,172,54,
+  115,45,0,0,129,134,8,178,131,2,129,16,136,131,2,129,
+  14,241,131,2,129,16,203,130,2,129,16,181,217,1,10,1,
+  187,131,2,129,14,241,131,2,129,16,172,54,69,82,82,79,
+  82,58,32,76,105,98,114,97,114,121,32,96,37,115,96,32,
+  119,97,115,32,110,111,116,32,102,111,117,110,100,0,0,1,
+  198,131,2,129,16,238,93,129,16,188,127,129,16,133,127,10,
+  129,152,132,168,1,0,0,127,129,46,196,131,2,129,16,245,
+  119,10,105,110,116,101,114,102,97,99,101,47,108,105,98,114,
+  97,114,121,46,114,101,116,114,111,0,0,249,131,2,236,133,
+  2,154,131,2,174,132,2,193,1,207,133,2,0,191,130,144,
+  225,14,176,132,2,225,1,225,1,205,132,2,100,58,115,101,
+  116,45,100,101,115,99,114,105,112,116,105,111,110,0,0,129,
+  16,172,54,115,115,45,0,0,129,6,176,132,2,129,16,155,
+  2,2,129,16,230,27,129,158,84,130,141,1,129,14,199,132,
+  2,129,16,221,1,1,204,54,129,16,139,23,16,10,129,2,
+  191,132,2,215,22,129,16,70,10,97,100,100,32,97,32,100,
+  101,115,99,114,105,112,116,105,111,110,32,116,111,32,97,32,
+  119,111,114,100,0,0,147,132,2,130,133,2,193,1,207,133,
+  2,0,129,210,172,152,4,132,133,2,225,1,225,1,154,133,
+  2,97,100,100,45,100,101,115,99,114,105,112,116,105,111,110,
+  0,0,129,16,172,54,115,45,0,0,129,134,132,120,132,133,
+  2,130,141,1,129,14,148,133,2,129,16,204,54,129,16,244,
+  16,129,16,221,1,16,10,129,2,140,133,2,17,129,16,70,
+  10,97,100,100,32,97,32,100,101,115,99,114,105,112,116,105,
+  111,110,32,102,111,114,32,116,104,101,32,109,111,115,116,32,
+  114,101,99,101,110,116,108,121,32,100,101,102,105,110,101,100,
+  32,119,111,114,100,0,0,105,110,116,101,114,102,97,99,101,
+  47,100,101,115,99,114,105,112,116,105,111,110,115,46,114,101,
+  116,114,111,0,0,207,133,2,178,135,1,82,101,116,117,114,
+  110,32,65,83,67,73,73,58,78,85,76,32,40,48,41,46,
+  0,0,82,101,116,117,114,110,32,97,110,32,101,109,112,116,
+  121,32,115,116,114,105,110,103,46,0,0,80,114,111,118,105,
+  100,101,32,97,32,118,105,115,117,97,108,32,105,110,100,105,
+  99,97,116,105,111,110,32,111,102,32,97,32,99,111,100,101,
+  32,103,114,111,117,112,46,0,0,80,114,111,118,105,100,101,
+  32,97,32,118,105,115,117,97,108,32,105,110,100,105,99,97,
+  116,105,111,110,32,111,102,32,97,32,99,111,100,101,32,103,
+  114,111,117,112,46,0,0,77,117,108,116,105,112,108,121,32,
+  96,110,49,96,32,98,121,32,96,110,50,96,32,97,110,100,
+  32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,
+  108,116,46,0,0,77,117,108,116,105,112,108,121,32,96,120,
+  96,32,98,121,32,96,121,96,32,97,110,100,32,116,104,101,
+  110,32,100,105,118,105,100,101,32,98,121,32,96,122,96,32,
+  97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,105,
+  110,116,101,103,101,114,32,112,97,114,116,32,111,102,32,116,
+  104,101,32,113,117,111,116,105,101,110,116,32,97,110,100,32,
+  114,101,109,97,105,110,100,101,114,46,0,0,65,100,100,32,
+  96,110,49,96,32,116,111,32,96,110,50,96,32,97,110,100,
+  32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,
+  108,116,46,0,0,83,116,111,114,101,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,118,97,108,117,101,32,105,
+  110,116,111,32,116,104,101,32,109,101,109,111,114,121,32,97,
+  116,32,96,104,101,114,101,96,32,97,110,100,32,105,110,99,
+  114,101,109,101,110,116,32,96,72,101,97,112,96,32,98,121,
+  32,49,46,0,0,83,117,98,116,114,97,99,116,32,96,110,
+  50,96,32,102,114,111,109,32,96,110,49,96,32,97,110,100,
+  32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,
+  108,116,46,0,0,83,119,105,116,99,104,32,116,111,32,116,
+  104,101,32,101,120,112,111,115,101,100,32,40,112,117,98,108,
+  105,99,41,32,112,111,114,116,105,111,110,32,111,102,32,97,
+  32,108,101,120,105,99,97,108,32,110,97,109,101,115,112,97,
+  99,101,46,0,0,67,111,109,112,97,114,101,32,116,119,111,
+  32,118,97,108,117,101,115,32,102,111,114,32,105,110,101,113,
+  117,97,108,105,116,121,46,32,82,101,116,117,114,110,115,32,
+  96,84,82,85,69,96,32,105,102,32,116,104,101,121,32,97,
+  114,101,32,110,111,116,32,101,113,117,97,108,32,111,114,32,
+  96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,
+  101,46,0,0,69,120,101,99,117,116,101,32,116,104,101,32,
+  113,117,111,116,97,116,105,111,110,32,105,102,32,116,104,101,
+  32,102,108,97,103,32,105,115,32,96,70,65,76,83,69,96,
+  46,0,0,69,120,101,99,117,116,101,32,116,104,101,32,113,
+  117,111,116,97,116,105,111,110,32,105,102,32,116,104,101,32,
+  102,108,97,103,32,105,115,32,96,70,65,76,83,69,96,46,
+  32,73,102,32,102,97,108,115,101,44,32,97,108,115,111,32,
+  101,120,105,116,32,116,104,101,32,119,111,114,100,46,0,0,
+  68,105,118,105,100,101,32,96,110,96,32,98,121,32,96,109,
+  96,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,
+  32,105,110,116,101,103,101,114,32,112,97,114,116,32,111,102,
+  32,116,104,101,32,113,117,111,116,105,101,110,116,46,0,0,
+  68,105,118,105,100,101,32,96,110,96,32,98,121,32,96,109,
+  96,32,97,110,100,32,114,101,116,117,114,110,32,116,104,101,
+  32,105,110,116,101,103,101,114,32,112,97,114,116,32,111,102,
+  32,116,104,101,32,113,117,111,116,105,101,110,116,32,97,110,
+  100,32,114,101,109,97,105,110,100,101,114,46,0,0,73,102,
+  32,96,110,96,32,105,115,32,122,101,114,111,44,32,100,114,
+  111,112,32,96,110,96,32,97,110,100,32,101,120,105,116,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,119,111,114,100,
+  46,32,73,102,32,110,111,110,45,122,101,114,111,44,32,108,
+  101,97,118,101,32,96,110,96,32,97,108,111,110,101,32,97,
+  110,100,32,97,108,108,111,119,32,101,120,101,99,117,116,105,
+  111,110,32,116,111,32,99,111,110,116,105,110,117,101,46,0,
+  0,69,110,100,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,100,101,102,105,110,105,116,105,111,110,46,0,0,68,117,
+  112,108,105,99,97,116,101,32,116,111,112,32,118,97,108,117,
+  101,32,111,110,32,115,116,97,99,107,32,105,102,32,110,111,
+  116,32,122,101,114,111,46,32,73,102,32,122,101,114,111,44,
+  32,100,111,32,110,111,116,104,105,110,103,46,0,0,67,111,
+  110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
+  111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
+  32,99,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
+  105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
+  114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
+  83,67,73,73,32,99,111,100,101,46,0,0,67,111,110,115,
+  116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,
+  115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
+  111,100,101,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
+  105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,0,
+  67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
+  32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
+  73,73,32,99,111,100,101,46,0,0,67,111,110,115,116,97,
+  110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,
+  101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
+  101,46,0,0,67,111,110,115,116,97,110,116,46,32,82,101,
+  102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
+  32,65,83,67,73,73,32,99,111,100,101,46,0,0,67,111,
+  110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
+  111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
+  32,99,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
+  105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
+  114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
+  83,67,73,73,32,99,111,100,101,46,0,0,67,111,110,115,
+  116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,
+  115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
+  111,100,101,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
+  105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,0,
+  67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
+  32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
+  73,73,32,99,111,100,101,46,0,0,67,111,110,115,116,97,
+  110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,
+  101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
+  101,46,0,0,67,111,110,115,116,97,110,116,46,32,82,101,
+  102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
+  32,65,83,67,73,73,32,99,111,100,101,46,0,0,67,111,
+  110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
+  111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
+  32,99,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
+  105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
+  114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
+  83,67,73,73,32,99,111,100,101,46,0,0,67,111,110,115,
+  116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,
+  115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
+  111,100,101,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
+  105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,0,
+  67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
+  32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
+  73,73,32,99,111,100,101,46,0,0,67,111,110,115,116,97,
+  110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,
+  101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
+  101,46,0,0,67,111,110,115,116,97,110,116,46,32,82,101,
+  102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
+  32,65,83,67,73,73,32,99,111,100,101,46,0,0,67,111,
+  110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
+  111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
+  32,99,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
+  105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,102,101,
+  114,115,32,116,111,32,115,112,101,99,105,102,105,99,32,65,
+  83,67,73,73,32,99,111,100,101,46,0,0,67,111,110,115,
+  116,97,110,116,46,32,82,101,102,101,114,115,32,116,111,32,
+  115,112,101,99,105,102,105,99,32,65,83,67,73,73,32,99,
+  111,100,101,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  82,101,102,101,114,115,32,116,111,32,115,112,101,99,105,102,
+  105,99,32,65,83,67,73,73,32,99,111,100,101,46,0,0,
+  67,111,110,115,116,97,110,116,46,32,82,101,102,101,114,115,
+  32,116,111,32,115,112,101,99,105,102,105,99,32,65,83,67,
+  73,73,32,99,111,100,101,46,0,0,67,111,110,115,116,97,
+  110,116,46,32,82,101,102,101,114,115,32,116,111,32,115,112,
+  101,99,105,102,105,99,32,65,83,67,73,73,32,99,111,100,
+  101,46,0,0,67,111,110,115,116,97,110,116,46,32,82,101,
+  102,101,114,115,32,116,111,32,115,112,101,99,105,102,105,99,
+  32,65,83,67,73,73,32,99,111,100,101,46,0,0,67,111,
+  110,115,116,97,110,116,46,32,82,101,102,101,114,115,32,116,
+  111,32,115,112,101,99,105,102,105,99,32,65,83,67,73,73,
+  32,99,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  46,32,82,101,102,101,114,115,32,116,111,32,115,112,101,99,
+  105,102,105,99,32,65,83,67,73,73,32,99,111,100,101,46,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,116,117,
+  114,110,32,97,32,98,117,105,108,100,32,105,100,101,110,116,
+  105,102,105,101,114,46,32,85,115,101,32,97,108,111,110,103,
+  32,119,105,116,104,32,118,101,114,115,105,111,110,32,116,111,
+  32,105,100,101,110,116,105,102,121,32,97,110,32,105,109,97,
+  103,101,46,0,0,86,97,114,105,97,98,108,101,46,32,72,
+  111,108,100,115,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,110,117,109,101,114,105,99,32,98,97,115,101,46,32,66,
+  97,115,101,32,109,117,115,116,32,98,101,32,105,110,32,116,
+  104,101,32,114,97,110,103,101,32,111,102,32,50,45,49,54,
+  46,0,0,86,97,114,105,97,98,108,101,46,32,72,111,108,
+  100,115,32,116,104,101,32,99,111,109,112,105,108,101,114,32,
+  115,116,97,116,101,46,32,73,102,32,84,82,85,69,44,32,
+  116,104,101,32,99,111,109,112,105,108,101,114,32,105,115,32,
+  97,99,116,105,118,101,46,32,73,102,32,70,65,76,83,69,
+  44,32,105,116,32,105,115,32,110,111,116,46,0,0,82,101,
+  116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,
+  111,114,32,98,108,111,99,107,32,115,117,112,112,111,114,116,
+  46,0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,
+  32,73,68,32,102,111,114,32,99,108,111,99,107,32,119,111,
+  114,100,115,46,0,0,82,101,116,117,114,110,32,100,101,118,
+  105,99,101,32,73,68,32,102,111,114,32,101,114,114,111,114,
+  32,104,97,110,100,108,101,114,115,46,0,0,82,101,116,117,
+  114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,
+  32,105,110,98,111,117,110,100,32,101,118,101,110,116,115,46,
+  0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,32,
+  73,68,32,102,111,114,32,102,111,114,101,105,103,110,32,102,
+  117,110,99,116,105,111,110,32,105,110,116,101,114,102,97,99,
+  101,46,0,0,82,101,116,117,114,110,32,100,101,118,105,99,
+  101,32,73,68,32,102,111,114,32,102,105,108,101,115,121,115,
+  116,101,109,32,97,99,99,101,115,115,46,0,0,82,101,116,
+  117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,111,
+  114,32,102,108,111,97,116,105,110,103,32,112,111,105,110,116,
+  46,0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,
+  32,73,68,32,102,111,114,32,105,109,97,103,101,32,119,114,
+  105,116,101,114,46,0,0,82,101,116,117,114,110,32,100,101,
+  118,105,99,101,32,73,68,32,102,111,114,32,85,110,105,120,
+  32,73,79,67,84,76,32,105,110,116,101,114,102,97,99,101,
+  46,0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,
+  32,73,68,32,102,111,114,32,75,101,121,98,111,97,114,100,
+  32,105,110,112,117,116,46,0,0,82,101,116,117,114,110,32,
+  100,101,118,105,99,101,32,73,68,32,102,111,114,32,109,101,
+  109,111,114,121,32,97,108,108,111,99,97,116,111,114,46,0,
+  0,82,101,116,117,114,110,32,100,101,118,105,99,101,32,73,
+  68,32,102,111,114,32,109,117,108,116,105,99,111,114,101,32,
+  115,117,112,112,111,114,116,46,0,0,82,101,116,117,114,110,
+  32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,79,
+  117,116,112,117,116,32,100,101,118,105,99,101,46,0,0,82,
+  101,115,101,114,118,101,100,32,100,101,118,105,99,101,32,73,
+  68,46,0,0,82,101,115,101,114,118,101,100,32,100,101,118,
+  105,99,101,32,73,68,46,0,0,82,101,115,101,114,118,101,
+  100,32,100,101,118,105,99,101,32,73,68,46,0,0,82,101,
+  115,101,114,118,101,100,32,100,101,118,105,99,101,32,73,68,
+  46,0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,
+  32,73,68,32,102,111,114,32,114,97,110,100,111,109,32,110,
+  117,109,98,101,114,32,103,101,110,101,114,97,116,111,114,46,
+  0,0,82,101,116,117,114,110,32,100,101,118,105,99,101,32,
+  73,68,32,102,111,114,32,115,99,114,105,112,116,105,110,103,
+  32,115,117,112,112,111,114,116,46,0,0,82,101,116,117,114,
+  110,32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,
+  115,111,99,107,101,116,115,46,0,0,82,101,116,117,114,110,
+  32,100,101,118,105,99,101,32,73,68,32,102,111,114,32,117,
+  110,105,120,32,115,121,115,99,97,108,108,46,0,0,82,101,
+  116,117,114,110,32,100,101,118,105,99,101,32,73,68,32,102,
+  111,114,32,117,110,115,105,103,110,101,100,32,109,97,116,104,
+  115,46,0,0,86,97,114,105,97,98,108,101,46,32,72,111,
+  108,100,115,32,97,32,112,111,105,110,116,101,114,32,116,111,
+  32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,116,
+  32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,
+  101,114,46,0,0,85,115,101,100,32,116,111,32,100,101,110,
+  111,116,101,32,116,104,101,32,101,110,100,32,111,102,32,97,
+  32,108,105,110,107,101,100,32,108,105,115,116,46,32,84,104,
+  101,32,108,97,115,116,32,99,111,110,115,32,119,105,108,108,
+  32,104,97,118,101,32,116,104,101,32,99,100,114,32,112,111,
+  105,110,116,32,116,111,32,116,104,105,115,32,97,100,100,114,
+  101,115,115,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  82,101,116,117,114,110,115,32,116,104,101,32,108,97,115,116,
+  32,97,100,100,114,101,115,115,97,98,108,101,32,109,101,109,
+  111,114,121,32,97,100,100,114,101,115,115,46,0,0,82,101,
+  116,117,114,110,115,32,96,48,96,44,32,116,104,101,32,118,
+  97,108,117,101,32,117,115,101,100,32,116,111,32,105,110,100,
+  105,99,97,116,101,32,97,32,70,65,76,83,69,32,114,101,
+  115,117,108,116,46,0,0,82,101,116,117,114,110,115,32,116,
+  104,101,32,110,117,109,98,101,114,32,111,102,32,99,101,108,
+  108,115,32,97,118,97,105,108,97,98,108,101,32,116,111,32,
+  121,111,117,114,32,97,112,112,108,105,99,97,116,105,111,110,
+  46,32,84,104,105,115,32,105,115,32,116,104,101,32,97,109,
+  111,117,110,116,32,111,102,32,109,101,109,111,114,121,44,32,
+  108,101,115,115,32,116,104,101,32,97,108,114,101,97,100,121,
+  32,99,111,110,115,117,109,101,100,32,112,111,114,116,105,111,
+  110,32,97,110,100,32,98,117,102,102,101,114,115,32,109,97,
+  112,112,101,100,32,102,111,114,32,82,101,116,114,111,39,115,
+  32,105,110,116,101,114,110,97,108,32,117,115,101,46,0,0,
+  72,111,108,100,32,116,104,101,32,112,97,116,104,32,116,111,
+  32,116,104,101,32,117,115,101,114,115,32,104,111,109,101,32,
+  100,105,114,101,99,116,111,114,121,46,32,68,101,102,105,110,
+  101,100,32,97,115,32,97,32,102,108,111,97,116,105,110,103,
+  32,98,117,102,102,101,114,32,97,98,111,118,101,32,96,104,
+  101,114,101,96,46,0,0,86,97,114,105,97,98,108,101,46,
+  32,72,111,108,100,115,32,116,104,101,32,97,100,100,114,101,
+  115,115,32,111,102,32,116,104,101,32,110,101,120,116,32,97,
+  118,97,105,108,97,98,108,101,32,99,101,108,108,46,0,0,
+  65,99,99,101,115,115,32,116,104,101,32,108,111,111,112,32,
+  105,110,100,101,120,32,102,111,114,32,116,104,101,32,99,117,
+  114,114,101,110,116,32,108,111,111,112,46,32,40,70,111,114,
+  32,108,111,111,112,115,32,109,97,100,101,32,117,115,105,110,
+  103,32,96,105,110,100,101,120,101,100,45,116,105,109,101,115,
+  96,41,0,0,86,97,114,105,97,98,108,101,46,32,87,104,
+  101,110,32,84,82,85,69,44,32,105,103,110,111,114,101,32,
+  105,110,112,117,116,32,116,111,32,101,110,100,32,111,102,32,
+  108,105,110,101,46,0,0,65,99,99,101,115,115,32,116,104,
+  101,32,112,97,114,101,110,116,32,108,111,111,112,32,105,110,
+  100,101,120,32,102,111,114,32,116,104,101,32,99,117,114,114,
+  101,110,116,32,108,111,111,112,46,32,40,70,111,114,32,108,
+  111,111,112,115,32,109,97,100,101,32,117,115,105,110,103,32,
+  96,105,110,100,101,120,101,100,45,116,105,109,101,115,96,41,
+  0,0,65,99,99,101,115,115,32,116,104,101,32,103,114,97,
+  110,100,112,97,114,101,110,116,32,108,111,111,112,32,105,110,
+  100,101,120,32,102,111,114,32,116,104,101,32,99,117,114,114,
+  101,110,116,32,108,111,111,112,46,32,40,70,111,114,32,108,
+  111,111,112,115,32,109,97,100,101,32,117,115,105,110,103,32,
+  96,105,110,100,101,120,101,100,45,116,105,109,101,115,96,41,
+  0,0,86,97,114,105,97,98,108,101,46,32,72,111,108,100,
+  115,32,116,104,101,32,97,100,100,114,101,115,115,32,111,102,
+  32,116,104,101,32,108,97,115,116,32,99,97,108,108,32,99,
+  111,109,112,105,108,101,100,32,98,121,32,99,108,97,115,115,
+  58,119,111,114,100,46,32,65,32,99,97,108,108,32,104,101,
+  114,101,32,116,104,97,116,32,101,110,100,115,32,97,32,100,
+  101,102,105,110,105,116,105,111,110,32,105,115,32,116,117,114,
+  110,101,100,32,105,110,116,111,32,97,32,106,117,109,112,32,
+  105,102,32,84,97,105,108,67,97,108,108,115,32,105,115,32,
+  115,101,116,46,0,0,86,97,114,105,97,98,108,101,46,32,
+  87,104,101,110,32,84,82,85,69,44,32,97,32,99,97,108,
+  108,32,97,116,32,116,104,101,32,101,110,100,32,111,102,32,
+  97,32,100,101,102,105,110,105,116,105,111,110,32,111,114,32,
+  113,117,111,116,97,116,105,111,110,32,105,115,32,99,111,109,
+  112,105,108,101,100,32,97,115,32,97,32,106,117,109,112,46,
+  32,79,102,102,32,98,121,32,100,101,102,97,117,108,116,44,
+  32,115,105,110,99,101,32,119,111,114,100,115,32,116,104,97,
+  116,32,101,120,105,116,32,116,104,101,105,114,32,99,97,108,
+  108,101,114,32,40,108,105,107,101,32,96,99,97,115,101,96,
+  41,32,119,111,117,108,100,32,116,104,101,110,32,101,120,105,
+  116,32,116,104,101,32,119,114,111,110,103,32,119,111,114,100,
+  46,0,0,86,97,114,105,97,98,108,101,46,32,87,104,101,
+  110,32,115,101,116,32,116,111,32,96,84,82,85,69,96,44,
+  32,82,101,116,114,111,32,119,105,108,108,32,114,101,112,108,
+  97,99,101,32,117,110,100,101,114,115,99,111,114,101,115,32,
+  105,110,32,115,116,114,105,110,103,115,32,119,105,116,104,32,
+  115,112,97,99,101,115,46,32,87,104,101,110,32,96,70,65,
+  76,83,69,96,44,32,82,101,116,114,111,32,100,111,101,115,
+  32,110,111,116,46,0,0,82,101,116,117,114,110,32,116,104,
+  101,32,97,100,100,114,101,115,115,32,111,102,32,116,104,101,
+  32,115,116,97,114,116,32,111,102,32,116,104,101,32,116,101,
+  109,112,111,114,97,114,121,32,115,116,114,105,110,103,32,112,
+  111,111,108,46,32,84,104,105,115,32,99,97,110,32,98,101,
+  32,97,108,116,101,114,101,100,32,98,121,32,99,104,97,110,
+  103,105,110,103,32,116,104,101,32,118,97,108,117,101,115,32,
+  111,102,32,96,84,101,109,112,83,116,114,105,110,103,115,96,
+  32,97,110,100,32,96,84,101,109,112,83,116,114,105,110,103,
+  77,97,120,96,46,0,0,86,97,114,105,97,98,108,101,46,
+  32,84,104,105,115,32,104,111,108,100,115,32,115,111,109,101,
+  32,105,110,102,111,114,109,97,116,105,111,110,32,117,115,101,
+  100,32,98,121,32,96,123,123,96,32,97,110,100,32,96,125,
+  125,96,46,0,0,67,111,110,115,116,97,110,116,46,32,82,
+  101,116,117,114,110,115,32,97,32,112,111,105,110,116,101,114,
+  32,116,111,32,116,104,101,32,116,101,120,116,32,105,110,112,
+  117,116,32,98,117,102,102,101,114,46,0,0,82,101,116,117,
+  114,110,115,32,96,45,49,96,44,32,116,104,101,32,118,97,
+  108,117,101,32,117,115,101,100,32,116,111,32,105,110,100,105,
+  99,97,116,101,32,97,32,84,82,85,69,32,114,101,115,117,
+  108,116,46,0,0,86,97,114,105,97,98,108,101,46,32,72,
+  111,108,100,115,32,116,104,101,32,109,97,120,105,109,117,109,
+  32,108,101,110,103,116,104,32,111,102,32,97,32,116,101,109,
+  112,111,114,97,114,121,32,115,116,114,105,110,103,46,0,0,
+  86,97,114,105,97,98,108,101,46,32,72,111,108,100,115,32,
+  116,104,101,32,110,117,109,98,101,114,32,111,102,32,116,101,
+  109,112,111,114,97,114,121,32,115,116,114,105,110,103,115,46,
+  0,0,71,105,118,101,110,32,97,32,112,111,105,110,116,101,
+  114,32,116,111,32,97,32,115,116,114,105,110,103,44,32,114,
+  101,116,117,114,110,32,84,82,85,69,32,105,102,32,108,111,
+  110,103,101,114,32,116,104,97,110,32,96,84,101,109,112,83,
+  116,114,105,110,103,77,97,120,96,46,0,0,73,102,32,115,
+  116,114,105,110,103,32,105,115,32,111,118,101,114,115,105,122,
+  101,32,40,115,101,101,32,96,115,58,111,118,101,114,115,105,
+  122,101,63,96,41,44,32,116,114,117,110,99,97,116,101,32,
+  116,111,32,96,84,101,109,112,83,116,114,105,110,103,77,97,
+  120,96,46,0,0,86,97,114,105,97,98,108,101,46,32,84,
+  104,105,115,32,115,116,111,114,101,115,32,116,104,101,32,118,
+  101,114,115,105,111,110,32,110,117,109,98,101,114,46,0,0,
+  66,101,103,105,110,32,97,32,113,117,111,116,97,116,105,111,
+  110,46,0,0,69,110,100,32,97,32,113,117,111,116,97,116,
+  105,111,110,46,0,0,67,111,109,112,97,114,101,32,97,108,
+  108,32,118,97,108,117,101,115,32,105,110,32,116,104,101,32,
+  97,114,114,97,121,46,32,82,101,116,117,114,110,32,96,70,
+  65,76,83,69,96,32,105,102,32,97,108,108,32,118,97,108,
+  117,101,115,32,97,114,101,32,101,113,117,97,108,32,111,114,
+  32,96,84,82,85,69,96,32,111,116,104,101,114,119,105,115,
+  101,46,32,84,104,105,115,32,97,115,115,117,109,101,115,32,
+  116,104,101,32,97,114,114,97,121,32,99,111,110,116,97,105,
+  110,115,32,111,110,108,121,32,110,117,109,101,114,105,99,32,
+  118,97,108,117,101,115,46,0,0,82,101,116,117,114,110,32,
+  97,32,110,101,119,32,97,114,114,97,121,32,99,111,110,115,
+  105,115,116,105,110,103,32,111,102,32,116,104,101,32,118,97,
+  108,117,101,115,32,105,110,32,97,49,32,102,111,108,108,111,
+  119,101,100,32,98,121,32,116,104,101,32,118,97,108,117,101,
+  115,32,105,110,32,97,50,46,0,0,82,101,116,117,114,110,
+  32,96,84,82,85,69,96,32,105,102,32,97,49,32,98,101,
+  103,105,110,115,32,119,105,116,104,32,97,50,32,111,114,32,
+  96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,
+  101,46,0,0,82,101,116,117,114,110,32,97,32,110,101,119,
+  32,97,114,114,97,121,32,99,111,110,116,97,105,110,105,110,
+  103,32,97,108,108,32,98,117,116,32,116,104,101,32,108,97,
+  115,116,32,118,97,108,117,101,32,105,110,32,116,104,101,32,
+  115,111,117,114,99,101,32,97,114,114,97,121,46,0,0,82,
+  101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,
+  116,104,101,32,115,116,114,105,110,103,32,118,97,108,117,101,
+  32,105,115,32,105,110,32,116,104,101,32,97,114,114,97,121,
+  32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,
+  114,119,105,115,101,46,0,0,82,101,116,117,114,110,32,96,
+  84,82,85,69,96,32,105,102,32,116,104,101,32,118,97,108,
+  117,101,32,105,115,32,105,110,32,116,104,101,32,97,114,114,
+  97,121,32,111,114,32,96,70,65,76,83,69,96,32,111,116,
+  104,101,114,119,105,115,101,46,0,0,67,111,112,121,32,97,
+  110,32,97,114,114,97,121,32,40,97,49,41,32,116,111,32,
+  97,32,100,101,115,116,105,110,97,116,105,111,110,32,40,97,
+  50,41,46,0,0,82,117,110,32,97,32,113,117,111,116,101,
+  32,97,110,100,32,99,111,110,115,116,114,117,99,116,32,97,
+  32,110,101,119,32,97,114,114,97,121,32,102,114,111,109,32,
+  116,104,101,32,114,101,116,117,114,110,101,100,32,118,97,108,
+  117,101,115,46,32,84,104,101,32,113,117,111,116,101,32,115,
+  104,111,117,108,100,32,114,101,116,117,114,110,32,116,104,101,
+  32,118,97,108,117,101,115,32,97,110,100,32,116,104,101,32,
+  110,117,109,98,101,114,32,111,102,32,118,97,108,117,101,115,
+  32,116,111,32,112,117,116,32,105,110,116,111,32,116,104,101,
+  32,97,114,114,97,121,46,0,0,77,97,107,101,32,97,32,
+  99,111,112,121,32,111,102,32,97,110,32,97,114,114,97,121,
+  46,32,82,101,116,117,114,110,32,116,104,101,32,97,100,100,
+  114,101,115,115,32,111,102,32,116,104,101,32,99,111,112,121,
+  46,0,0,82,101,116,117,114,110,32,96,84,82,85,69,96,
+  32,105,102,32,97,49,32,101,110,100,115,32,119,105,116,104,
+  32,97,50,32,111,114,32,96,70,65,76,83,69,96,32,111,
+  116,104,101,114,119,105,115,101,46,0,0,67,111,109,112,97,
+  114,101,32,97,108,108,32,118,97,108,117,101,115,32,105,110,
+  32,116,104,101,32,97,114,114,97,121,46,32,82,101,116,117,
+  114,110,32,96,84,82,85,69,96,32,105,102,32,97,108,108,
+  32,118,97,108,117,101,115,32,97,114,101,32,101,113,117,97,
+  108,32,111,114,32,96,70,65,76,83,69,96,32,111,116,104,
+  101,114,119,105,115,101,46,32,84,104,105,115,32,97,115,115,
+  117,109,101,115,32,116,104,101,32,97,114,114,97,121,32,99,
+  111,110,116,97,105,110,115,32,111,110,108,121,32,110,117,109,
+  101,114,105,99,32,118,97,108,117,101,115,46,0,0,70,101,
+  116,99,104,32,116,104,101,32,118,97,108,117,101,32,115,116,
+  111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,99,
+  105,102,105,101,100,32,105,110,100,101,120,32,105,110,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,97,114,114,
+  97,121,46,0,0,70,111,114,32,101,97,99,104,32,105,116,
+  101,109,32,105,110,32,116,104,101,32,105,110,105,116,105,97,
+  108,32,97,114,114,97,121,44,32,114,117,110,32,116,104,101,
+  32,115,112,101,99,105,102,105,101,100,32,113,117,111,116,101,
+  46,32,73,102,32,116,104,101,32,113,117,111,116,101,32,114,
+  101,116,117,114,110,115,32,96,84,82,85,69,96,44,32,99,
+  111,112,121,32,116,104,101,32,105,116,101,109,32,105,110,116,
+  111,32,97,32,110,101,119,32,97,114,114,97,121,46,32,73,
+  102,32,96,70,65,76,83,69,96,44,32,100,105,115,99,97,
+  114,100,32,105,116,46,32,82,101,116,117,114,110,115,32,97,
+  32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
+  110,101,119,32,97,114,114,97,121,46,0,0,82,101,116,117,
+  114,110,32,116,104,101,32,102,105,114,115,116,32,118,97,108,
+  117,101,32,105,110,32,116,104,101,32,97,114,114,97,121,46,
+  0,0,69,120,101,99,117,116,101,32,116,104,101,32,113,117,
+  111,116,101,32,111,110,99,101,32,102,111,114,32,101,97,99,
+  104,32,105,116,101,109,32,105,110,32,116,104,101,32,97,114,
+  114,97,121,46,0,0,67,114,101,97,116,101,32,97,32,110,
+  101,119,32,97,114,114,97,121,32,119,105,116,104,32,116,104,
+  101,32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,
+  116,104,101,32,115,111,117,114,99,101,32,115,116,114,105,110,
+  103,46,0,0,67,97,108,99,117,108,97,116,101,32,97,32,
+  104,97,115,104,32,118,97,108,117,101,32,102,111,114,32,97,
+  32,103,105,118,101,110,32,97,114,114,97,121,46,0,0,82,
+  101,116,117,114,110,32,116,104,101,32,108,111,99,97,116,105,
+  111,110,32,111,102,32,116,104,101,32,102,105,114,115,116,32,
+  105,110,115,116,97,110,99,101,32,111,102,32,116,104,101,32,
+  115,112,101,99,105,102,105,101,100,32,118,97,108,117,101,32,
+  105,110,32,116,104,101,32,97,114,114,97,121,46,0,0,82,
+  101,116,117,114,110,32,116,104,101,32,108,111,99,97,116,105,
+  111,110,32,111,102,32,116,104,101,32,102,105,114,115,116,32,
+  105,110,115,116,97,110,99,101,32,111,102,32,116,104,101,32,
+  115,112,101,99,105,102,105,101,100,32,115,116,114,105,110,103,
+  32,105,110,32,116,104,101,32,97,114,114,97,121,46,0,0,
+  82,101,116,117,114,110,32,97,32,110,101,119,32,97,114,114,
+  97,121,32,119,105,116,104,32,116,104,101,32,105,110,100,105,
+  99,101,115,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,118,97,108,117,101,32,119,97,115,32,102,111,117,110,
+  100,32,97,116,32,105,110,32,116,104,101,32,111,114,105,103,
+  105,110,97,108,32,97,114,114,97,121,46,0,0,82,101,116,
+  117,114,110,32,97,32,110,101,119,32,97,114,114,97,121,32,
+  119,105,116,104,32,116,104,101,32,105,110,100,105,99,101,115,
+  32,111,102,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,115,116,114,105,110,103,32,105,110,32,116,104,101,32,
+  111,114,105,103,105,110,97,108,32,97,114,114,97,121,46,0,
+  0,82,101,116,117,114,110,32,116,104,101,32,108,97,115,116,
+  32,118,97,108,117,101,32,105,110,32,116,104,101,32,97,114,
+  114,97,121,46,0,0,82,101,116,117,114,110,32,97,32,110,
+  101,119,32,97,114,114,97,121,32,99,111,110,116,97,105,110,
+  105,110,103,32,116,104,101,32,102,105,114,115,116,32,96,110,
+  96,32,118,97,108,117,101,115,32,102,114,111,109,32,116,104,
+  101,32,115,111,117,114,99,101,32,97,114,114,97,121,46,0,
+  0,82,101,116,117,114,110,32,116,104,101,32,108,101,110,103,
+  116,104,32,111,102,32,97,32,97,114,114,97,121,46,0,0,
+  69,120,101,99,117,116,101,32,113,117,111,116,101,46,32,82,
+  101,116,117,114,110,32,97,32,110,101,119,32,97,114,114,97,
+  121,32,99,111,110,116,97,105,110,105,110,103,32,116,104,101,
+  32,118,97,108,117,101,115,32,116,104,101,32,113,117,111,116,
+  101,32,108,101,97,118,101,115,32,111,110,32,116,104,101,32,
+  115,116,97,99,107,46,32,84,104,105,115,32,105,115,32,105,
+  100,101,110,116,105,99,97,108,32,116,111,32,100,111,105,110,
+  103,32,96,97,58,99,111,117,110,116,101,100,45,114,101,115,
+  117,108,116,115,0,0,69,120,101,99,117,116,101,32,113,117,
+  111,116,101,32,111,110,99,101,32,102,111,114,32,101,97,99,
+  104,32,105,116,101,109,32,105,110,32,116,104,101,32,97,114,
+  114,97,121,46,32,67,111,110,115,116,114,117,99,116,115,32,
+  97,32,110,101,119,32,97,114,114,97,121,32,102,114,111,109,
+  32,116,104,101,32,118,97,108,117,101,32,114,101,116,117,114,
+  110,101,100,32,98,121,32,116,104,101,32,113,117,111,116,101,
+  46,0,0,76,105,107,101,32,97,58,109,97,112,44,32,98,
+  117,116,32,116,104,101,32,97,114,114,97,121,32,105,115,32,
+  115,112,108,105,116,32,105,110,116,111,32,99,104,117,110,107,
+  115,32,116,104,97,116,32,114,117,110,32,111,110,32,97,108,
+  108,32,105,100,108,101,32,99,111,114,101,115,46,32,84,104,
+  101,32,113,117,111,116,101,32,109,117,115,116,32,110,111,116,
+  32,117,115,101,32,115,104,97,114,101,100,32,115,116,97,116,
+  101,46,0,0,69,120,116,114,97,99,116,32,97,32,110,101,
+  119,32,97,114,114,97,121,32,102,114,111,109,32,116,104,101,
+  32,109,105,100,100,108,101,32,111,102,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,97,114,114,97,121,46,32,
+  84,104,105,115,32,119,105,108,108,32,116,97,107,101,32,116,
+  104,101,32,118,97,108,117,101,115,32,115,116,97,114,116,105,
+  110,103,32,97,116,32,96,102,96,32,97,110,100,32,101,120,
+  116,101,110,100,32,116,111,32,116,104,101,32,96,108,96,32,
+  108,97,115,116,32,118,97,108,117,101,46,0,0,82,101,116,
+  117,114,110,32,97,32,110,101,119,32,97,114,114,97,121,32,
+  99,111,110,115,105,115,116,105,110,103,32,111,102,32,116,104,
+  101,32,118,97,108,117,101,115,32,105,110,32,97,50,32,102,
+  111,108,108,111,119,101,100,32,98,121,32,116,104,101,32,118,
+  97,108,117,101,115,32,105,110,32,97,49,46,0,0,84,97,
+  107,101,115,32,97,110,32,97,114,114,97,121,44,32,97,32,
+  115,116,97,114,116,105,110,103,32,118,97,108,117,101,44,32,
+  97,110,100,32,97,32,113,117,111,116,101,46,32,84,104,105,
+  115,32,119,105,108,108,32,97,112,112,108,121,32,116,104,101,
+  32,113,117,111,116,101,32,116,111,32,101,97,99,104,32,105,
+  116,101,109,32,105,110,32,116,104,101,32,97,114,114,97,121,
+  59,32,116,104,101,32,113,117,111,116,101,32,115,104,111,117,
+  108,100,32,99,111,110,115,117,109,101,32,116,119,111,32,118,
+  97,108,117,101,115,32,97,110,100,32,114,101,116,117,114,110,
+  32,111,110,101,46,0,0,76,105,107,101,32,97,58,114,101,
+  100,117,99,101,44,32,98,117,116,32,116,104,101,32,97,114,
+  114,97,121,32,105,115,32,115,112,108,105,116,32,105,110,116,
+  111,32,99,104,117,110,107,115,32,116,104,97,116,32,114,117,
+  110,32,111,110,32,97,108,108,32,105,100,108,101,32,99,111,
+  114,101,115,46,32,84,104,101,32,113,117,111,116,101,32,109,
+  117,115,116,32,98,101,32,97,115,115,111,99,105,97,116,105,
+  118,101,46,0,0,82,101,118,101,114,115,101,32,116,104,101,
+  32,111,114,100,101,114,32,111,102,32,105,116,101,109,115,32,
+  105,110,32,97,32,97,114,114,97,121,46,32,84,104,105,115,
+  32,119,105,108,108,32,114,101,116,117,114,110,32,97,32,110,
+  101,119,32,97,114,114,97,121,46,0,0,82,101,116,117,114,
+  110,32,97,32,110,101,119,32,97,114,114,97,121,32,99,111,
+  110,116,97,105,110,105,110,103,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,
+  32,118,97,108,117,101,115,32,102,114,111,109,32,116,104,101,
+  32,114,105,103,104,116,32,115,105,100,101,32,111,102,32,116,
+  104,101,32,97,114,114,97,121,46,0,0,83,116,111,114,101,
+  32,97,32,118,97,108,117,101,32,105,110,116,111,32,116,104,
+  101,32,97,114,114,97,121,32,97,116,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,105,110,100,101,120,46,0,
+  0,77,97,107,101,32,97,32,99,111,112,121,32,111,102,32,
+  116,104,101,32,97,114,114,97,121,32,105,110,32,97,32,114,
+  111,116,97,116,105,110,103,32,115,101,116,32,111,102,32,116,
+  101,109,112,111,114,97,114,121,32,98,117,102,102,101,114,115,
+  46,0,0,82,101,116,117,114,110,32,116,104,101,32,97,99,
+  116,117,97,108,32,97,100,100,114,101,115,115,32,111,102,32,
+  116,104,101,32,96,110,96,116,104,32,105,116,101,109,32,105,
+  110,32,116,104,101,32,97,114,114,97,121,46,0,0,67,114,
+  101,97,116,101,32,97,32,110,101,119,32,115,116,114,105,110,
+  103,32,102,114,111,109,32,116,104,101,32,112,114,111,118,105,
+  100,101,100,32,97,114,114,97,121,32,111,102,32,99,104,97,
+  114,97,99,116,101,114,32,118,97,108,117,101,115,46,32,84,
+  104,105,115,32,115,116,114,105,110,103,32,119,105,108,108,32,
+  98,101,32,115,116,111,114,101,100,32,105,110,32,116,104,101,
+  32,116,101,109,112,111,114,97,108,32,115,116,114,105,110,103,
+  32,98,117,102,102,101,114,115,46,0,0,65,98,111,114,116,
+  32,101,120,101,99,117,116,105,111,110,46,0,0,67,108,111,
+  115,101,32,97,110,32,117,110,99,111,110,100,105,116,105,111,
+  110,97,108,32,108,111,111,112,46,32,66,114,97,110,99,104,
+  101,115,32,98,97,99,107,32,116,111,32,116,104,101,32,112,
+  114,105,111,114,32,96,114,101,112,101,97,116,96,46,0,0,
+  65,108,108,111,99,97,116,101,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,102,
+  32,99,101,108,108,115,32,102,114,111,109,32,116,104,101,32,
+  96,72,101,97,112,96,46,0,0,80,101,114,102,111,114,109,
+  32,97,32,98,105,116,119,105,115,101,32,65,78,68,32,111,
+  112,101,114,97,116,105,111,110,32,98,101,116,119,101,101,110,
+  32,116,104,101,32,116,119,111,32,112,114,111,118,105,100,101,
+  100,32,118,97,108,117,101,115,46,0,0,70,101,116,99,104,
+  32,116,104,101,32,56,45,98,105,116,32,118,97,108,117,101,
+  32,115,116,111,114,101,100,32,97,116,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,115,
+  46,32,65,100,100,114,101,115,115,105,110,103,32,102,111,114,
+  32,116,104,105,115,32,105,115,32,105,110,32,56,45,98,105,
+  116,32,117,110,105,116,115,46,0,0,70,101,116,99,104,32,
+  116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,
+  32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,97,100,100,114,101,115,115,46,32,82,101,116,117,114,
+  110,115,32,116,104,101,32,110,101,120,116,32,97,100,100,114,
+  101,115,115,32,97,110,100,32,116,104,101,32,118,97,108,117,
+  101,46,0,0,83,116,111,114,101,32,97,110,32,56,45,98,
+  105,116,32,118,97,108,117,101,32,105,110,116,111,32,116,104,
+  101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,
+  101,115,115,46,32,65,100,100,114,101,115,115,105,110,103,32,
+  102,111,114,32,116,104,105,115,32,105,115,32,105,110,32,56,
+  45,98,105,116,32,117,110,105,116,115,46,0,0,83,116,111,
+  114,101,32,97,32,118,97,108,117,101,32,105,110,116,111,32,
+  116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,
+  100,114,101,115,115,32,97,110,100,32,114,101,116,117,114,110,
+  32,116,104,101,32,110,101,120,116,32,97,100,100,114,101,115,
+  115,46,0,0,84,114,97,110,115,108,97,116,101,32,97,32,
+  112,104,121,115,105,99,97,108,32,97,100,100,114,101,115,115,
+  32,116,111,32,97,32,98,121,116,101,32,97,100,100,114,101,
+  115,115,46,0,0,68,105,115,112,108,97,121,32,97,32,119,
+  101,108,99,111,109,101,32,109,101,115,115,97,103,101,32,111,
+  110,32,115,116,97,114,116,117,112,46,0,0,69,120,101,99,
+  117,116,101,32,113,49,32,97,103,97,105,110,115,116,32,120,
+  44,32,116,104,101,110,32,101,120,101,99,117,116,101,32,113,
+  50,32,97,103,97,105,110,115,116,32,97,32,99,111,112,121,
+  32,111,102,32,120,46,0,0,69,120,101,99,117,116,101,32,
+  113,49,32,97,103,97,105,110,115,116,32,120,32,97,110,100,
+  32,113,50,32,97,103,97,105,110,115,116,32,121,46,0,0,
+  69,120,101,99,117,116,101,32,113,32,97,103,97,105,110,115,
+  116,32,120,44,32,116,104,101,110,32,101,120,101,99,117,116,
+  101,32,113,32,97,103,97,105,110,115,116,32,121,46,0,0,
+  83,101,116,32,96,66,97,115,101,96,32,116,111,32,98,105,
+  110,97,114,121,46,0,0,82,101,97,100,32,49,48,50,52,
+  32,99,101,108,108,115,32,102,114,111,109,32,98,108,111,99,
+  107,32,110,32,105,110,32,116,104,101,32,98,108,111,99,107,
+  32,115,116,111,114,97,103,101,32,105,110,116,111,32,109,101,
+  109,111,114,121,32,97,116,32,97,100,100,114,101,115,115,32,
+  97,46,0,0,83,101,116,32,116,104,101,32,102,105,108,101,
+  32,110,97,109,101,32,111,102,32,116,104,101,32,98,108,111,
+  99,107,32,115,116,111,114,97,103,101,32,100,101,118,105,99,
+  101,46,0,0,83,101,116,32,116,104,101,32,110,117,109,98,
+  101,114,32,111,102,32,98,108,111,99,107,115,32,116,111,32,
+  114,101,115,101,114,118,101,46,32,84,104,101,115,101,32,97,
+  114,101,32,114,101,115,101,114,118,101,100,32,102,114,111,109,
+  32,116,104,101,32,115,116,97,114,116,32,111,102,32,116,104,
+  101,32,98,108,111,99,107,32,102,105,108,101,46,0,0,83,
+  97,118,101,32,116,104,101,32,49,48,50,52,32,99,101,108,
+  108,115,32,97,116,32,97,100,100,114,101,115,115,32,97,32,
+  116,111,32,98,108,111,99,107,32,110,32,105,110,32,116,104,
+  101,32,98,108,111,99,107,32,115,116,111,114,97,103,101,46,
+  0,0,65,112,112,101,110,100,32,97,32,118,97,108,117,101,
+  32,116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,
+  98,117,102,102,101,114,46,0,0,82,101,115,101,116,32,116,
+  104,101,32,99,117,114,114,101,110,116,32,98,117,102,102,101,
+  114,32,116,111,32,97,110,32,101,109,112,116,121,32,115,116,
+  97,116,101,46,0,0,82,101,116,117,114,110,32,97,32,112,
+  111,105,110,116,101,114,32,116,111,32,116,104,101,32,99,117,
+  114,114,101,110,116,32,101,110,100,32,111,102,32,116,104,101,
+  32,97,99,116,105,118,101,32,98,117,102,102,101,114,46,0,
+  0,82,101,109,111,118,101,32,116,104,101,32,108,97,115,116,
+  32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,32,
+  99,117,114,114,101,110,116,32,98,117,102,102,101,114,46,0,
+  0,83,97,118,101,32,97,110,100,32,114,101,115,116,111,114,
+  101,32,116,104,101,32,99,117,114,114,101,110,116,32,98,117,
+  102,102,101,114,32,98,101,102,111,114,101,32,97,110,100,32,
+  97,102,116,101,114,32,101,120,101,99,117,116,105,110,103,32,
+  116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,
+  111,116,101,46,0,0,65,115,115,105,103,110,32,97,32,110,
+  101,119,32,98,117,102,102,101,114,32,97,115,32,116,104,101,
+  32,99,117,114,114,101,110,116,32,111,110,101,46,0,0,82,
+  101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,114,
+  32,111,102,32,99,101,108,108,115,32,105,110,32,116,104,101,
+  32,98,117,102,102,101,114,46,0,0,82,101,116,117,114,110,
+  32,116,104,101,32,115,116,97,114,116,32,97,100,100,114,101,
+  115,115,32,111,102,32,116,104,101,32,99,117,114,114,101,110,
+  116,32,98,117,102,102,101,114,46,0,0,69,120,105,116,32,
+  82,101,116,114,111,46,0,0,82,101,116,117,114,110,32,84,
+  82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,
+  32,105,115,32,97,32,110,111,116,32,99,111,110,115,111,110,
+  97,110,116,32,111,114,32,70,65,76,83,69,32,111,116,104,
+  101,114,119,105,115,101,46,0,0,82,101,116,117,114,110,32,
+  84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,
+  114,32,105,115,32,97,32,110,111,116,32,110,117,109,101,114,
+  105,99,32,100,105,103,105,116,32,111,114,32,70,65,76,83,
+  69,32,111,116,104,101,114,119,105,115,101,46,0,0,82,101,
+  116,117,114,110,32,84,82,85,69,32,105,102,32,99,104,97,
+  114,97,99,116,101,114,32,105,115,32,110,111,116,32,108,111,
+  119,101,114,99,97,115,101,32,111,114,32,70,65,76,83,69,
+  32,111,116,104,101,114,119,105,115,101,46,0,0,82,101,116,
+  117,114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,
+  97,99,116,101,114,32,105,115,32,110,111,116,32,117,112,112,
+  101,114,99,97,115,101,32,111,114,32,70,65,76,83,69,32,
+  111,116,104,101,114,119,105,115,101,46,0,0,82,101,116,117,
+  114,110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,
+  99,116,101,114,32,105,115,32,110,111,116,32,112,114,105,110,
+  116,97,98,108,101,32,111,114,32,70,65,76,83,69,32,111,
+  116,104,101,114,119,105,115,101,46,0,0,82,101,116,117,114,
+  110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,
+  116,101,114,32,105,115,32,110,111,116,32,97,32,118,111,119,
+  101,108,32,111,114,32,70,65,76,83,69,32,111,116,104,101,
+  114,119,105,115,101,46,0,0,82,101,116,117,114,110,32,84,
+  82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,114,
+  32,105,115,32,110,111,116,32,119,104,105,116,101,115,112,97,
+  99,101,44,32,111,114,32,70,65,76,83,69,32,111,116,104,
+  101,114,119,105,115,101,46,0,0,82,101,116,117,114,110,32,
+  84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,101,
+  114,32,105,115,32,97,32,99,111,110,115,111,110,97,110,116,
+  32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,
+  105,115,101,46,0,0,82,101,116,117,114,110,32,84,82,85,
+  69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,
+  115,32,97,32,110,117,109,101,114,105,99,32,100,105,103,105,
+  116,32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,
+  119,105,115,101,46,0,0,86,101,99,116,111,114,101,100,46,
+  32,82,101,97,100,32,97,32,115,105,110,103,108,101,32,107,
+  101,121,112,114,101,115,115,46,0,0,82,101,116,117,114,110,
+  32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,116,
+  101,114,32,105,115,32,97,110,32,65,83,67,73,73,32,108,
+  101,116,116,101,114,32,111,114,32,70,65,76,83,69,32,111,
+  116,104,101,114,119,105,115,101,46,0,0,82,101,116,117,114,
+  110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,
+  116,101,114,32,105,115,32,108,111,119,101,114,99,97,115,101,
+  32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,
+  105,115,101,46,0,0,86,101,99,116,111,114,101,100,46,32,
+  68,105,115,112,108,97,121,32,97,32,115,105,110,103,108,101,
+  32,99,104,97,114,97,99,116,101,114,46,0,0,67,111,110,
+  118,101,114,116,32,99,104,97,114,97,99,116,101,114,32,116,
+  111,32,108,111,119,101,114,99,97,115,101,32,101,113,117,105,
+  118,97,108,101,110,116,46,0,0,67,111,110,118,101,114,116,
+  32,97,110,32,65,83,67,73,73,32,100,105,103,105,116,32,
+  99,104,97,114,97,99,116,101,114,32,105,110,116,111,32,116,
+  104,101,32,99,111,114,114,101,115,112,111,110,100,105,110,103,
+  32,100,101,99,105,109,97,108,32,118,97,108,117,101,0,0,
+  67,111,110,118,101,114,116,32,99,104,97,114,97,99,116,101,
+  114,32,105,110,116,111,32,97,32,115,116,114,105,110,103,46,
+  0,0,67,111,110,118,101,114,116,32,99,104,97,114,97,99,
+  116,101,114,32,116,111,32,117,112,112,101,114,99,97,115,101,
+  32,101,113,117,105,118,97,108,101,110,116,46,0,0,67,111,
+  110,118,101,114,116,32,97,110,32,65,83,67,73,73,32,99,
+  104,97,114,97,99,116,101,114,32,116,111,32,116,104,101,32,
+  111,112,112,111,115,105,116,101,32,99,97,115,101,46,0,0,
+  82,101,116,117,114,110,32,84,82,85,69,32,105,102,32,99,
+  104,97,114,97,99,116,101,114,32,105,115,32,117,112,112,101,
+  114,99,97,115,101,32,111,114,32,70,65,76,83,69,32,111,
+  116,104,101,114,119,105,115,101,46,0,0,82,101,116,117,114,
+  110,32,84,82,85,69,32,105,102,32,99,104,97,114,97,99,
+  116,101,114,32,105,115,32,112,114,105,110,116,97,98,108,101,
+  32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,
+  105,115,101,46,0,0,82,101,116,117,114,110,32,84,82,85,
+  69,32,105,102,32,99,104,97,114,97,99,116,101,114,32,105,
+  115,32,97,32,118,111,119,101,108,32,111,114,32,70,65,76,
+  83,69,32,111,116,104,101,114,119,105,115,101,46,0,0,82,
+  101,116,117,114,110,32,84,82,85,69,32,105,102,32,99,104,
+  97,114,97,99,116,101,114,32,105,115,32,119,104,105,116,101,
+  115,112,97,99,101,44,32,111,114,32,70,65,76,83,69,32,
+  111,116,104,101,114,119,105,115,101,46,0,0,67,97,108,108,
+  32,97,32,102,117,110,99,116,105,111,110,46,0,0,82,101,
+  116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,116,
+  111,32,116,104,101,32,99,97,114,32,111,102,32,99,111,110,
+  115,32,97,46,0,0,83,116,111,114,101,32,110,32,105,110,
+  116,111,32,116,104,101,32,99,97,114,32,111,102,32,99,111,
+  110,115,32,97,46,0,0,82,101,116,117,114,110,32,116,104,
+  101,32,99,111,110,116,101,110,116,115,32,111,102,32,116,104,
+  101,32,99,97,114,32,111,102,32,99,111,110,115,32,97,46,
+  0,0,73,102,32,96,110,96,32,105,115,32,101,113,117,97,
+  108,32,116,111,32,96,109,96,44,32,100,114,111,112,32,98,
+  111,116,104,32,97,110,100,32,101,120,101,99,117,116,101,32,
+  116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,
+  111,116,101,32,98,101,102,111,114,101,32,101,120,105,116,105,
+  110,103,32,116,104,101,32,99,97,108,108,105,110,103,32,119,
+  111,114,100,46,32,73,102,32,110,111,116,32,101,113,117,97,
+  108,44,32,108,101,97,118,101,32,96,110,96,32,111,110,32,
+  116,104,101,32,115,116,97,99,107,32,97,110,100,32,108,101,
+  116,32,101,120,101,99,117,116,105,111,110,32,99,111,110,116,
+  105,110,117,101,46,0,0,82,101,116,117,114,110,32,97,32,
+  112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,99,
+  100,114,32,111,102,32,99,111,110,115,32,97,46,0,0,83,
+  116,111,114,101,32,110,32,105,110,116,111,32,116,104,101,32,
+  99,100,114,32,111,102,32,99,111,110,115,32,97,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,99,111,110,116,101,
+  110,116,115,32,111,102,32,116,104,101,32,99,100,114,32,111,
+  102,32,99,111,110,115,32,97,46,0,0,69,120,101,99,117,
+  116,101,32,113,49,32,105,102,32,116,104,101,32,102,108,97,
+  103,32,105,115,32,116,114,117,101,32,40,45,49,41,32,111,
+  114,32,113,50,32,105,102,32,116,104,101,32,102,108,97,103,
+  32,105,115,32,102,97,108,115,101,32,40,48,41,46,32,79,
+  110,108,121,32,116,104,101,115,101,32,102,108,97,103,115,32,
+  97,114,101,32,118,97,108,105,100,32,119,104,101,110,32,117,
+  115,105,110,103,32,96,99,104,111,111,115,101,96,59,32,112,
+  97,115,115,105,110,103,32,111,116,104,101,114,32,118,97,108,
+  117,101,115,32,97,115,32,102,108,97,103,115,32,119,105,108,
+  108,32,114,101,115,117,108,116,32,105,110,32,109,101,109,111,
+  114,121,32,99,111,114,114,117,112,116,105,111,110,46,0,0,
+  67,108,97,115,115,32,104,97,110,100,108,101,114,32,102,111,
+  114,32,99,111,109,98,105,110,97,116,111,114,115,46,32,87,
+  104,101,110,32,99,111,109,112,105,108,105,110,103,44,32,97,
+  32,99,111,109,98,105,110,97,116,111,114,32,117,115,101,100,
+  32,114,105,103,104,116,32,97,102,116,101,114,32,97,32,113,
+  117,111,116,101,32,105,115,32,99,111,109,112,105,108,101,100,
+  32,105,110,32,112,108,97,99,101,59,32,111,116,104,101,114,
+  119,105,115,101,32,97,32,99,97,108,108,32,116,111,32,105,
+  116,32,105,115,32,99,111,109,112,105,108,101,100,46,0,0,
+  67,108,97,115,115,32,104,97,110,100,108,101,114,32,102,111,
+  114,32,100,97,116,97,32,115,116,114,117,99,116,117,114,101,
+  115,46,0,0,67,108,97,115,115,32,104,97,110,100,108,101,
+  114,32,102,111,114,32,105,110,108,105,110,101,32,119,111,114,
+  100,115,46,32,67,111,112,105,101,115,32,116,104,101,32,98,
+  111,100,121,32,111,102,32,116,104,101,32,119,111,114,100,32,
+  105,110,116,111,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,100,101,102,105,110,105,116,105,111,110,32,119,104,101,110,
+  32,99,111,109,112,105,108,105,110,103,44,32,111,114,32,99,
+  97,108,108,115,32,105,116,32,119,104,101,110,32,105,110,116,
+  101,114,112,114,101,116,105,110,103,46,0,0,67,108,97,115,
+  115,32,104,97,110,100,108,101,114,32,102,111,114,32,99,111,
+  109,112,105,108,101,114,32,109,97,99,114,111,115,32,40,105,
+  109,109,101,100,105,97,116,101,32,119,111,114,100,115,41,0,
+  0,67,108,97,115,115,32,104,97,110,100,108,101,114,32,102,
+  111,114,32,112,114,105,109,105,116,105,118,101,32,119,111,114,
+  100,115,32,40,119,111,114,100,115,32,119,104,105,99,104,32,
+  109,97,112,32,116,111,32,78,103,97,32,105,110,115,116,114,
+  117,99,116,105,111,110,115,41,0,0,67,108,97,115,115,32,
+  104,97,110,100,108,101,114,32,102,111,114,32,110,111,114,109,
+  97,108,32,119,111,114,100,115,46,0,0,82,101,116,117,114,
+  110,32,116,104,101,32,99,117,114,114,101,110,116,32,100,97,
+  121,46,0,0,82,101,116,117,114,110,32,116,104,101,32,99,
+  117,114,114,101,110,116,32,104,111,117,114,46,32,84,104,105,
+  115,32,119,105,108,108,32,98,101,32,105,110,32,116,104,101,
+  32,114,97,110,103,101,32,111,102,32,48,45,50,51,44,32,
+  105,110,99,108,117,115,105,118,101,46,0,0,82,101,116,117,
+  114,110,32,116,104,101,32,99,117,114,114,101,110,116,32,109,
+  105,110,117,116,101,46,32,84,104,105,115,32,119,105,108,108,
+  32,98,101,32,105,110,32,116,104,101,32,114,97,110,103,101,
+  32,111,102,32,48,45,53,57,44,32,105,110,99,108,117,115,
+  105,118,101,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,99,117,114,114,101,110,116,32,109,111,110,116,104,46,32,
+  84,104,105,115,32,119,105,108,108,32,98,101,32,105,110,32,
+  116,104,101,32,114,97,110,103,101,32,111,102,32,49,45,49,
+  50,44,32,105,110,99,108,117,115,105,118,101,46,0,0,84,
+  114,105,103,103,101,114,32,97,32,99,108,111,99,107,32,111,
+  112,101,114,97,116,105,111,110,46,32,84,104,105,115,32,105,
+  115,32,110,111,116,32,105,110,116,101,110,100,101,100,32,116,
+  111,32,98,101,32,117,115,101,100,32,100,105,114,101,99,116,
+  108,121,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  99,117,114,114,101,110,116,32,115,101,99,111,110,100,46,32,
+  84,104,105,115,32,119,105,108,108,32,98,101,32,105,110,32,
+  116,104,101,32,114,97,110,103,101,32,111,102,32,48,45,53,
+  57,44,32,105,110,99,108,117,115,105,118,101,46,0,0,82,
+  101,116,117,114,110,32,97,32,104,111,115,116,32,115,112,101,
+  99,105,102,105,99,32,116,105,109,101,115,116,97,109,112,46,
+  32,73,110,32,116,104,101,32,115,116,97,110,100,97,114,100,
+  32,115,121,115,116,101,109,44,32,116,104,105,115,32,105,115,
+  32,97,32,51,50,45,98,105,116,32,85,110,105,120,32,116,
+  105,109,101,115,116,97,109,112,44,32,98,117,116,32,116,104,
+  105,115,32,105,115,32,110,111,116,32,114,101,113,117,105,114,
+  101,100,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  99,117,114,114,101,110,116,32,100,97,121,32,105,110,32,85,
+  84,67,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  99,117,114,114,101,110,116,32,104,111,117,114,32,105,110,32,
+  85,84,67,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,99,117,114,114,101,110,116,32,109,105,110,117,116,101,32,
+  105,110,32,85,84,67,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,109,111,110,116,
+  104,32,105,110,32,85,84,67,46,0,0,82,101,116,117,114,
+  110,32,116,104,101,32,99,117,114,114,101,110,116,32,115,101,
+  99,111,110,100,32,105,110,32,85,84,67,46,0,0,82,101,
+  116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,121,101,97,114,32,105,110,32,85,84,67,46,0,0,82,
+  101,116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,
+  116,32,121,101,97,114,46,0,0,83,116,111,114,101,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,118,97,108,
+  117,101,32,105,110,116,111,32,116,104,101,32,109,101,109,111,
+  114,121,32,97,116,32,96,104,101,114,101,96,32,97,110,100,
+  32,105,110,99,114,101,109,101,110,116,32,96,72,101,97,112,
+  96,32,98,121,32,49,46,32,73,100,101,110,116,105,99,97,
+  108,32,116,111,32,96,44,96,44,32,116,104,105,115,32,105,
+  115,32,112,114,111,118,105,100,101,100,32,102,111,114,32,99,
+  111,109,112,97,116,105,98,105,108,105,116,121,32,119,105,116,
+  104,32,116,104,101,32,82,101,116,114,111,70,111,114,116,104,
+  32,111,110,32,105,108,111,32,97,110,100,32,110,97,112,105,
+  97,46,0,0,67,111,109,112,105,108,101,32,97,32,99,97,
+  108,108,32,116,111,32,116,104,101,32,115,112,101,99,105,102,
+  105,101,100,32,97,100,100,114,101,115,115,32,105,110,116,111,
+  32,116,104,101,32,99,117,114,114,101,110,116,32,100,101,102,
+  105,110,105,116,105,111,110,46,0,0,67,111,109,112,105,108,
+  101,32,97,32,106,117,109,112,32,116,111,32,116,104,101,32,
+  115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,
+  115,32,105,110,116,111,32,116,104,101,32,99,117,114,114,101,
+  110,116,32,100,101,102,105,110,105,116,105,111,110,46,0,0,
+  67,111,109,112,105,108,101,32,116,104,101,32,99,111,100,101,
+  32,116,111,32,112,117,115,104,32,97,32,110,117,109,98,101,
+  114,32,116,111,32,116,104,101,32,115,116,97,99,107,32,105,
+  110,116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,
+  100,101,102,105,110,105,116,105,111,110,46,0,0,67,111,109,
+  112,105,108,101,32,116,104,101,32,105,110,115,116,114,117,99,
+  116,105,111,110,115,32,105,110,32,96,110,96,44,32,112,97,
+  99,107,105,110,103,32,116,104,101,109,32,105,110,116,111,32,
+  116,104,101,32,99,101,108,108,32,98,101,105,110,103,32,102,
+  105,108,108,101,100,32,105,102,32,116,104,101,114,101,32,105,
+  115,32,114,111,111,109,46,32,69,97,99,104,32,96,108,105,
+  96,32,109,117,115,116,32,98,101,32,102,111,108,108,111,119,
+  101,100,32,98,121,32,105,116,115,32,118,97,108,117,101,44,
+  32,99,111,109,112,105,108,101,100,32,119,105,116,104,32,96,
+  44,96,46,0,0,67,111,109,112,105,108,101,32,97,32,114,
+  101,116,117,114,110,32,105,110,115,116,114,117,99,116,105,111,
+  110,32,105,110,116,111,32,116,104,101,32,99,117,114,114,101,
+  110,116,32,100,101,102,105,110,105,116,105,111,110,46,0,0,
+  82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,
+  32,99,111,109,112,105,108,101,114,32,105,115,32,111,110,32,
+  111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,
+  119,105,115,101,46,0,0,67,114,101,97,116,101,32,97,32,
+  110,101,119,32,99,111,110,115,32,99,101,108,108,32,119,105,
+  116,104,32,97,32,99,97,114,32,111,102,32,120,32,97,110,
+  100,32,97,32,99,100,114,32,111,102,32,121,46,0,0,67,
+  114,101,97,116,101,32,97,32,99,111,110,115,116,97,110,116,
+  32,114,101,116,117,114,110,105,110,103,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,118,97,108,117,101,46,0,
+  0,67,111,112,121,32,96,108,96,32,99,101,108,108,115,32,
+  102,114,111,109,32,109,101,109,111,114,121,32,97,116,32,96,
+  115,96,32,116,111,32,116,104,101,32,109,101,109,111,114,121,
+  32,97,116,32,96,100,96,46,32,84,104,101,115,101,32,115,
+  104,111,117,108,100,32,110,111,116,32,111,118,101,114,108,97,
+  112,46,0,0,82,101,116,117,114,110,32,116,104,101,32,110,
+  117,109,98,101,114,32,111,102,32,99,111,114,101,115,32,112,
+  114,111,118,105,100,101,100,32,98,121,32,116,104,101,32,86,
+  77,46,0,0,82,101,116,117,114,110,32,116,104,101,32,110,
+  117,109,98,101,114,32,111,102,32,116,104,101,32,99,117,114,
+  114,101,110,116,32,99,111,114,101,46,0,0,67,108,101,97,
+  114,32,116,104,101,32,105,110,116,101,114,110,97,108,32,115,
+  116,97,116,101,32,111,102,32,99,111,114,101,32,96,110,96,
+  46,32,84,104,105,115,32,115,104,111,117,108,100,32,98,101,
+  32,100,111,110,101,32,112,114,105,111,114,32,116,111,32,117,
+  115,101,32,111,102,32,96,99,111,114,101,58,115,116,97,114,
+  116,96,44,32,119,104,105,99,104,32,97,99,116,105,118,97,
+  116,101,115,32,112,114,111,99,101,115,115,105,110,103,32,111,
+  110,32,116,104,101,32,99,111,114,101,46,0,0,82,101,116,
+  117,114,110,32,116,104,101,32,99,104,97,110,110,101,108,32,
+  117,115,101,100,32,97,115,32,116,104,101,32,109,97,105,108,
+  98,111,120,32,102,111,114,32,99,111,114,101,32,110,46,0,
+  0,83,117,115,112,101,110,100,32,112,114,111,99,101,115,115,
+  105,110,103,32,111,110,32,99,111,114,101,32,96,110,96,46,
+  0,0,83,117,115,112,101,110,100,32,112,114,111,99,101,115,
+  115,105,110,103,32,111,110,32,116,104,101,32,99,117,114,114,
+  101,110,116,32,99,111,114,101,46,0,0,82,101,97,100,32,
+  97,32,118,97,108,117,101,32,102,114,111,109,32,114,101,103,
+  105,115,116,101,114,32,96,110,96,32,111,110,32,116,104,101,
+  32,99,117,114,114,101,110,116,32,99,111,114,101,46,0,0,
+  82,101,99,101,105,118,101,32,97,32,118,97,108,117,101,32,
+  102,114,111,109,32,116,104,101,32,109,97,105,108,98,111,120,
+  32,111,102,32,116,104,101,32,99,117,114,114,101,110,116,32,
+  99,111,114,101,46,0,0,82,101,115,117,109,101,32,112,114,
+  111,99,101,115,115,105,110,103,32,111,110,32,99,111,114,101,
+  32,96,110,96,32,97,102,116,101,114,32,97,32,96,99,111,
+  114,101,58,112,97,117,115,101,96,32,111,114,32,96,99,111,
+  114,101,58,112,97,117,115,101,45,99,117,114,114,101,110,116,
+  96,46,0,0,82,101,116,117,114,110,32,97,32,102,108,97,
+  103,32,105,110,100,105,99,97,116,105,110,103,32,119,104,101,
+  116,104,101,114,32,99,111,114,101,32,110,32,104,97,115,32,
+  98,101,101,110,32,115,116,97,114,116,101,100,32,97,110,100,
+  32,104,97,115,32,110,111,116,32,102,105,110,105,115,104,101,
+  100,46,0,0,83,101,110,100,32,97,32,118,97,108,117,101,
+  32,116,111,32,116,104,101,32,109,97,105,108,98,111,120,32,
+  111,102,32,99,111,114,101,32,110,46,0,0,83,101,116,32,
+  116,104,101,32,110,117,109,98,101,114,32,111,102,32,105,110,
+  115,116,114,117,99,116,105,111,110,32,98,117,110,100,108,101,
+  115,32,97,32,99,111,114,101,32,114,117,110,115,32,98,101,
+  102,111,114,101,32,115,119,105,116,99,104,105,110,103,32,116,
+  111,32,116,104,101,32,110,101,120,116,32,114,101,97,100,121,
+  32,99,111,114,101,46,0,0,83,101,116,32,116,104,101,32,
+  73,80,32,111,102,32,99,111,114,101,32,96,110,96,32,116,
+  111,32,97,100,100,114,101,115,115,32,96,97,96,32,97,110,
+  100,32,98,101,103,105,110,32,112,114,111,99,101,115,115,105,
+  110,103,32,111,110,32,99,111,114,101,32,96,110,96,46,0,
+  0,87,114,105,116,101,32,97,32,118,97,108,117,101,32,116,
+  111,32,114,101,103,105,115,116,101,114,32,110,117,109,98,101,
+  114,32,96,110,96,32,111,110,32,116,104,101,32,99,117,114,
+  114,101,110,116,32,99,111,114,101,46,0,0,71,105,118,101,
+  32,117,112,32,116,104,101,32,114,101,115,116,32,111,102,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,99,111,114,101,
+  39,115,32,116,105,109,101,32,115,108,105,99,101,44,32,97,
+  108,108,111,119,105,110,103,32,116,104,101,32,110,101,120,116,
+  32,114,101,97,100,121,32,99,111,114,101,32,116,111,32,114,
+  117,110,46,0,0,66,105,110,100,32,97,32,118,97,108,117,
+  101,32,116,111,32,97,32,102,117,110,99,116,105,111,110,32,
+  97,110,100,32,114,101,116,117,114,110,32,97,32,110,101,119,
+  32,113,117,111,116,101,32,116,104,97,116,32,99,97,108,108,
+  115,32,116,104,101,32,98,111,117,110,100,32,97,99,116,105,
+  111,110,46,0,0,73,110,108,105,110,101,32,97,32,110,117,
+  109,101,114,105,99,32,118,97,108,117,101,32,116,111,32,116,
+  104,101,32,99,117,114,114,101,110,116,32,97,115,115,101,109,
+  98,108,121,32,115,101,103,109,101,110,116,46,0,0,86,101,
+  99,116,111,114,101,100,46,32,67,114,101,97,116,101,32,97,
+  32,104,101,97,100,101,114,46,32,80,114,111,118,105,100,101,
+  32,97,32,115,116,114,105,110,103,32,40,115,41,32,102,111,
+  114,32,116,104,101,32,110,97,109,101,44,32,97,32,112,111,
+  105,110,116,101,114,32,116,111,32,116,104,101,32,99,108,97,
+  115,115,32,104,97,110,100,108,101,114,32,40,97,49,41,32,
+  97,110,100,32,97,32,112,111,105,110,116,101,114,32,116,111,
+  32,116,104,101,32,119,111,114,100,32,100,101,102,105,110,105,
+  116,105,111,110,32,40,97,50,41,32,71,101,110,101,114,97,
+  108,108,121,32,116,104,105,115,32,119,111,110,39,116,32,98,
+  101,32,117,115,101,100,32,100,105,114,101,99,116,108,121,46,
+  0,0,71,105,118,101,110,32,97,32,100,105,99,116,105,111,
+  110,97,114,121,32,104,101,97,100,101,114,44,32,114,101,116,
+  117,114,110,32,116,104,101,32,99,108,97,115,115,32,102,105,
+  101,108,100,46,0,0,72,111,111,107,46,32,67,114,101,97,
+  116,101,32,97,32,110,101,119,32,100,105,99,116,105,111,110,
+  97,114,121,32,104,101,97,100,101,114,32,110,97,109,101,100,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,115,
+  116,114,105,110,103,46,32,84,104,101,32,110,101,119,32,104,
+  101,97,100,101,114,32,119,105,108,108,32,112,111,105,110,116,
+  32,116,111,32,96,104,101,114,101,96,32,97,110,100,32,104,
+  97,118,101,32,97,32,99,108,97,115,115,32,111,102,32,96,
+  99,108,97,115,115,58,100,97,116,97,96,46,0,0,69,120,
+  101,99,117,116,101,32,116,104,101,32,115,112,101,99,105,102,
+  105,101,100,32,113,117,111,116,101,32,111,110,99,101,32,102,
+  111,114,32,101,97,99,104,32,104,101,97,100,101,114,32,105,
+  110,32,116,104,101,32,100,105,99,116,105,111,110,97,114,121,
+  46,32,66,101,102,111,114,101,32,114,117,110,110,105,110,103,
+  32,116,104,101,32,113,117,111,116,101,44,32,116,104,105,115,
+  32,97,108,115,111,32,112,117,115,104,101,115,32,97,32,112,
+  111,105,110,116,101,114,32,116,111,32,116,104,101,32,104,101,
+  97,100,101,114,32,111,110,116,111,32,116,104,101,32,115,116,
+  97,99,107,46,0,0,71,105,118,101,110,32,97,32,100,105,
+  99,116,105,111,110,97,114,121,32,104,101,97,100,101,114,44,
+  32,114,101,116,117,114,110,32,116,104,101,32,104,97,115,104,
+  32,102,105,101,108,100,46,0,0,86,97,114,105,97,98,108,
+  101,46,32,72,111,108,100,115,32,97,32,112,111,105,110,116,
+  101,114,32,116,111,32,116,104,101,32,102,117,110,99,116,105,
+  111,110,32,117,115,101,100,32,116,111,32,99,97,108,99,117,
+  108,97,116,101,32,100,105,99,116,105,111,110,97,114,121,32,
+  104,97,115,104,101,115,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,109,111,115,116,32,114,101,99,101,110,116,32,
+  100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,
+  114,46,0,0,82,101,116,117,114,110,32,97,32,112,111,105,
+  110,116,101,114,32,116,111,32,116,104,101,32,99,108,97,115,
+  115,32,102,105,101,108,100,32,111,102,32,116,104,101,32,109,
+  111,115,116,32,114,101,99,101,110,116,32,100,105,99,116,105,
+  111,110,97,114,121,32,104,101,97,100,101,114,46,0,0,82,
+  101,116,117,114,110,32,97,32,112,111,105,110,116,101,114,32,
+  116,111,32,116,104,101,32,110,97,109,101,32,102,105,101,108,
+  100,32,111,102,32,116,104,101,32,109,111,115,116,32,114,101,
+  99,101,110,116,32,100,105,99,116,105,111,110,97,114,121,32,
+  104,101,97,100,101,114,46,0,0,82,101,116,117,114,110,32,
+  97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,
+  32,120,116,32,102,105,101,108,100,32,111,102,32,116,104,101,
+  32,109,111,115,116,32,114,101,99,101,110,116,32,100,105,99,
+  116,105,111,110,97,114,121,32,104,101,97,100,101,114,46,0,
+  0,71,105,118,101,110,32,97,32,100,105,99,116,105,111,110,
+  97,114,121,32,104,101,97,100,101,114,44,32,114,101,116,117,
+  114,110,32,116,104,101,32,108,105,110,107,32,102,105,101,108,
+  100,46,0,0,76,111,111,107,117,112,32,116,104,101,32,115,
+  112,101,99,105,102,105,101,100,32,110,97,109,101,32,105,110,
+  32,116,104,101,32,100,105,99,116,105,111,110,97,114,121,32,
+  97,110,100,32,114,101,116,117,114,110,32,97,32,112,111,105,
+  110,116,101,114,32,116,111,32,105,116,115,32,100,105,99,116,
+  105,111,110,97,114,121,32,104,101,97,100,101,114,46,32,84,
+  104,105,115,32,114,101,116,117,114,110,115,32,122,101,114,111,
+  32,105,102,32,116,104,101,32,119,111,114,100,32,105,115,32,
+  110,111,116,32,102,111,117,110,100,46,32,84,104,105,115,32,
+  97,108,115,111,32,115,101,116,115,32,97,110,32,105,110,116,
+  101,114,110,97,108,32,118,97,114,105,97,98,108,101,32,40,
+  39,119,104,105,99,104,39,32,105,110,32,114,101,116,114,111,
+  46,109,117,114,105,41,32,116,111,32,116,104,101,32,104,101,
+  97,100,101,114,32,97,100,100,114,101,115,115,46,0,0,76,
+  111,111,107,117,112,32,116,104,101,32,115,112,101,99,105,102,
+  105,101,100,32,97,100,100,114,101,115,115,32,105,110,32,116,
+  104,101,32,100,105,99,116,105,111,110,97,114,121,32,97,110,
+  100,32,114,101,116,117,114,110,32,97,32,112,111,105,110,116,
+  101,114,32,116,111,32,105,116,115,32,100,105,99,116,105,111,
+  110,97,114,121,32,104,101,97,100,101,114,46,32,84,104,105,
+  115,32,114,101,116,117,114,110,115,32,122,101,114,111,32,105,
+  102,32,116,104,101,32,119,111,114,100,32,105,115,32,110,111,
+  116,32,102,111,117,110,100,46,0,0,82,101,116,117,114,110,
+  32,102,105,101,108,100,32,96,110,96,32,111,102,32,116,104,
+  101,32,103,108,111,115,115,97,114,121,32,101,110,116,114,121,
+  32,102,111,114,32,116,104,101,32,110,97,109,101,100,32,119,
+  111,114,100,44,32,111,114,32,97,110,32,101,109,112,116,121,
+  32,115,116,114,105,110,103,32,105,102,32,116,104,101,114,101,
+  32,105,115,32,110,111,110,101,46,32,84,104,101,32,102,105,
+  101,108,100,115,32,97,114,101,32,48,32,102,111,114,32,116,
+  104,101,32,115,116,97,99,107,32,99,111,109,109,101,110,116,
+  44,32,49,32,102,111,114,32,116,104,101,32,97,100,100,114,
+  101,115,115,32,115,116,97,99,107,44,32,50,32,102,111,114,
+  32,116,104,101,32,102,108,111,97,116,32,115,116,97,99,107,
+  44,32,97,110,100,32,51,32,102,111,114,32,116,104,101,32,
+  100,101,115,99,114,105,112,116,105,111,110,46,32,85,115,101,
+  100,32,98,121,32,96,100,58,100,101,115,99,114,105,98,101,
+  96,32,105,110,32,105,109,97,103,101,115,32,98,117,105,108,
+  116,32,119,105,116,104,111,117,116,32,119,111,114,100,32,109,
+  101,116,97,100,97,116,97,46,0,0,71,105,118,101,110,32,
+  97,32,100,105,99,116,105,111,110,97,114,121,32,104,101,97,
+  100,101,114,44,32,114,101,116,117,114,110,32,116,104,101,32,
+  110,97,109,101,32,102,105,101,108,100,46,0,0,85,112,100,
+  97,116,101,32,116,104,101,32,104,97,115,104,101,115,32,102,
+  111,114,32,97,108,108,32,118,105,115,105,98,108,101,32,119,
+  111,114,100,115,32,105,110,32,116,104,101,32,100,105,99,116,
+  105,111,110,97,114,121,46,0,0,86,97,114,105,97,98,108,
+  101,46,32,72,111,108,100,115,32,97,32,112,111,105,110,116,
+  101,114,32,116,111,32,116,104,101,32,102,117,110,99,116,105,
+  111,110,32,105,110,118,111,107,101,100,32,97,102,116,101,114,
+  32,97,32,100,105,99,116,105,111,110,97,114,121,32,104,101,
+  97,100,101,114,32,105,115,32,97,100,100,101,100,46,0,0,
+  83,101,116,32,116,104,101,32,96,100,58,115,111,117,114,99,
+  101,96,32,102,105,101,108,100,32,111,102,32,116,104,101,32,
+  104,101,97,100,101,114,32,102,111,114,32,116,104,101,32,110,
+  97,109,101,100,32,119,111,114,100,32,40,115,50,41,32,116,
+  111,32,115,116,114,105,110,103,32,40,115,49,41,46,32,84,
+  104,101,32,115,116,114,105,110,103,32,119,105,108,108,32,110,
+  111,116,32,98,101,32,100,117,112,108,105,99,97,116,101,100,
+  46,0,0,71,105,118,101,110,32,97,32,100,105,99,116,105,
+  111,110,97,114,121,32,104,101,97,100,101,114,44,32,114,101,
+  116,117,114,110,32,116,104,101,32,115,111,117,114,99,101,32,
+  102,105,101,108,100,46,0,0,67,104,97,110,103,101,32,100,
+  105,99,116,105,111,110,97,114,121,32,115,101,97,114,99,104,
+  32,116,111,32,117,115,101,32,104,97,115,104,101,100,32,110,
+  97,109,101,32,99,111,109,112,97,114,105,111,110,115,46,0,
+  0,67,104,97,110,103,101,32,100,105,99,116,105,111,110,97,
+  114,121,32,115,101,97,114,99,104,32,116,111,32,117,115,101,
+  32,102,117,108,108,32,110,97,109,101,32,99,111,109,112,97,
+  114,105,111,110,115,46,0,0,71,105,118,101,110,32,97,32,
+  100,105,99,116,105,111,110,97,114,121,32,104,101,97,100,101,
+  114,44,32,114,101,116,117,114,110,32,116,104,101,32,120,116,
+  32,102,105,101,108,100,46,0,0,67,104,97,110,103,101,32,
+  116,104,101,32,99,108,97,115,115,32,111,102,32,116,104,101,
+  32,109,111,115,116,32,114,101,99,101,110,116,108,121,32,100,
+  101,102,105,110,101,100,32,119,111,114,100,32,116,111,32,96,
+  99,108,97,115,115,58,100,97,116,97,96,46,0,0,83,101,
+  116,32,96,66,97,115,101,96,32,116,111,32,100,101,99,105,
+  109,97,108,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,110,117,109,98,101,114,32,111,102,32,105,116,101,109,115,
+  32,111,110,32,116,104,101,32,115,116,97,99,107,46,0,0,
+  84,101,109,112,111,114,97,114,105,108,121,32,114,101,109,111,
+  118,101,32,110,32,102,114,111,109,32,116,104,101,32,115,116,
+  97,99,107,44,32,101,120,101,99,117,116,101,32,116,104,101,
+  32,113,117,111,116,97,116,105,111,110,44,32,97,110,100,32,
+  116,104,101,110,32,114,101,115,116,111,114,101,32,110,32,116,
+  111,32,116,104,101,32,115,116,97,99,107,46,0,0,65,116,
+  116,97,99,104,32,97,110,32,97,99,116,105,111,110,32,116,
+  111,32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,
+  116,108,121,32,99,114,101,97,116,101,100,32,119,111,114,100,
+  46,32,84,104,105,115,32,105,115,32,117,115,101,100,32,105,
+  110,32,97,32,109,97,110,110,101,114,32,115,105,109,105,108,
+  97,114,32,116,111,32,67,82,69,65,84,69,47,68,79,69,
+  83,62,32,105,110,32,116,114,97,100,105,116,105,111,110,97,
+  108,32,70,111,114,116,104,46,0,0,68,105,115,99,97,114,
+  100,32,116,104,101,32,116,111,112,32,118,97,108,117,101,32,
+  111,110,32,116,104,101,32,115,116,97,99,107,46,0,0,82,
+  101,109,111,118,101,32,116,111,112,32,116,119,111,32,105,116,
+  101,109,115,32,111,110,32,116,104,101,32,115,116,97,99,107,
+  46,0,0,68,105,115,112,108,97,121,32,116,104,101,32,105,
+  116,101,109,115,32,111,110,32,116,104,101,32,100,97,116,97,
+  32,115,116,97,99,107,46,0,0,68,117,112,108,105,99,97,
+  116,101,32,116,104,101,32,116,111,112,32,105,116,101,109,32,
+  111,110,32,116,104,101,32,115,116,97,99,107,46,0,0,68,
+  117,112,108,105,99,97,116,101,32,116,104,101,32,116,111,112,
+  32,116,119,111,32,105,116,101,109,115,32,111,110,32,116,104,
+  101,32,115,116,97,99,107,46,0,0,67,111,110,115,116,97,
+  110,116,46,32,78,101,103,97,116,105,118,101,32,105,110,102,
+  105,110,105,116,121,46,32,32,70,111,114,32,101,110,99,111,
+  100,101,100,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,118,97,108,117,101,115,46,0,0,73,115,32,101,
+  110,99,111,100,101,100,32,118,97,108,117,101,32,110,101,103,
+  97,116,105,118,101,32,105,110,102,105,110,105,116,121,63,0,
+  0,67,111,110,115,116,97,110,116,46,32,73,110,102,105,110,
+  105,116,121,46,32,70,111,114,32,101,110,99,111,100,101,100,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  118,97,108,117,101,115,46,0,0,67,111,110,115,116,97,110,
+  116,46,32,77,97,120,105,109,117,109,32,118,97,108,117,101,
+  46,32,70,111,114,32,101,110,99,111,100,101,100,32,102,108,
+  111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,
+  117,101,115,46,0,0,67,111,110,115,116,97,110,116,46,32,
+  77,105,110,105,109,117,109,32,118,97,108,117,101,46,32,70,
+  111,114,32,101,110,99,111,100,101,100,32,102,108,111,97,116,
+  105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,115,
+  46,0,0,67,111,110,115,116,97,110,116,46,32,78,111,116,
+  32,97,32,78,117,109,98,101,114,46,32,70,111,114,32,101,
+  110,99,111,100,101,100,32,102,108,111,97,116,105,110,103,45,
+  112,111,105,110,116,32,118,97,108,117,101,115,46,0,0,67,
+  111,110,115,116,114,97,105,110,32,116,104,101,32,101,110,99,
+  111,100,101,100,32,118,97,108,117,101,32,116,111,32,116,104,
+  101,32,97,108,108,111,119,97,98,108,101,32,114,97,110,103,
+  101,46,0,0,73,115,32,101,110,99,111,100,101,100,32,118,
+  97,108,117,101,32,105,110,102,105,110,105,116,121,63,0,0,
+  73,115,32,101,110,99,111,100,101,100,32,118,97,108,117,101,
+  32,97,116,32,116,104,101,32,109,97,120,105,109,117,109,63,
+  0,0,73,115,32,101,110,99,111,100,101,100,32,118,97,108,
+  117,101,32,97,116,32,116,104,101,32,109,105,110,105,109,117,
+  109,63,0,0,82,101,116,117,114,110,32,96,84,82,85,69,
+  96,32,105,102,32,116,104,101,32,101,110,99,111,100,101,100,
+  32,118,97,108,117,101,32,105,115,32,97,32,118,97,108,105,
+  100,32,110,117,109,98,101,114,44,32,111,114,32,96,70,65,
+  76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,
+  0,73,115,32,101,110,99,111,100,101,100,32,118,97,108,117,
+  101,32,97,32,78,97,110,63,0,0,68,105,115,112,108,97,
+  121,32,97,110,32,101,110,99,111,100,101,100,32,110,117,109,
+  98,101,114,46,0,0,68,101,99,111,100,101,32,97,110,32,
+  101,110,99,111,100,101,100,32,102,108,111,97,116,105,110,103,
+  45,112,111,105,110,116,32,118,97,108,117,101,46,0,0,82,
+  101,116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,
+  116,104,101,32,118,97,108,117,101,32,105,115,32,122,101,114,
+  111,44,32,111,114,32,96,70,65,76,83,69,96,32,111,116,
+  104,101,114,119,105,115,101,46,0,0,67,111,109,112,97,114,
+  101,32,116,119,111,32,118,97,108,117,101,115,32,102,111,114,
+  32,101,113,117,97,108,105,116,121,46,32,82,101,116,117,114,
+  110,115,32,96,84,82,85,69,96,32,105,102,32,116,104,101,
+  121,32,97,114,101,32,101,113,117,97,108,32,111,114,32,96,
+  70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,
+  46,0,0,69,114,114,111,114,32,104,97,110,100,108,101,114,
+  32,102,111,114,32,100,97,116,97,32,115,116,97,99,107,32,
+  111,118,101,114,102,108,111,119,0,0,69,114,114,111,114,32,
+  104,97,110,100,108,101,114,32,102,111,114,32,100,97,116,97,
+  32,115,116,97,99,107,32,117,110,100,101,114,102,108,111,119,
+  46,0,0,86,101,99,116,111,114,101,100,46,32,69,114,114,
+  111,114,32,104,97,110,100,108,101,114,46,32,67,97,108,108,
+  101,100,32,119,104,101,110,32,97,32,119,111,114,100,32,105,
+  115,32,110,111,116,32,102,111,117,110,100,32,98,121,32,96,
+  105,110,116,101,114,112,114,101,116,96,46,0,0,83,101,116,
+  32,116,104,101,32,100,101,102,97,117,108,116,32,101,114,114,
+  111,114,32,104,97,110,100,108,101,114,115,32,102,111,114,32,
+  118,97,114,105,111,117,115,32,99,111,110,100,105,116,105,111,
+  110,115,46,0,0,83,101,116,32,101,114,114,111,114,32,104,
+  97,110,100,108,101,114,32,102,111,114,32,101,114,114,111,114,
+  32,99,111,100,101,32,78,46,32,0,0,77,117,108,116,105,
+  112,108,121,32,116,119,111,32,102,108,111,97,116,105,110,103,
+  45,112,111,105,110,116,32,110,117,109,98,101,114,115,44,32,
+  114,101,116,117,114,110,105,110,103,32,116,104,101,32,114,101,
+  115,117,108,116,46,0,0,65,100,100,32,116,119,111,32,102,
+  108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,
+  109,98,101,114,115,44,32,114,101,116,117,114,110,105,110,103,
+  32,116,104,101,32,114,101,115,117,108,116,46,0,0,83,117,
+  98,116,114,97,99,116,32,70,50,32,102,114,111,109,32,70,
+  49,32,114,101,116,117,114,110,105,110,103,32,116,104,101,32,
+  114,101,115,117,108,116,46,0,0,82,101,116,117,114,110,32,
+  97,32,118,97,108,117,101,32,99,111,114,114,101,115,112,111,
+  110,100,105,110,103,32,116,111,32,110,101,103,97,116,105,118,
+  101,32,105,110,102,105,110,105,116,121,0,0,67,111,109,112,
+  97,114,101,32,116,119,111,32,102,108,111,97,116,105,110,103,
+  45,112,111,105,110,116,32,118,97,108,117,101,115,32,102,111,
+  114,32,105,110,101,113,117,97,108,105,116,121,46,32,82,101,
+  116,117,114,110,115,32,96,84,82,85,69,96,32,105,102,32,
+  116,104,101,121,32,97,114,101,32,110,111,116,32,101,113,117,
+  97,108,32,111,114,32,96,70,65,76,83,69,96,32,111,116,
+  104,101,114,119,105,115,101,46,0,0,82,101,116,117,114,110,
+  32,96,84,82,85,69,96,32,105,102,32,102,108,111,97,116,
+  105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,
+  105,115,32,45,73,78,70,32,111,114,32,96,70,65,76,83,
+  69,96,32,111,116,104,101,114,119,105,115,101,46,0,0,68,
+  105,118,105,100,101,32,102,108,111,97,116,105,110,103,45,112,
+  111,105,110,116,32,118,97,108,117,101,32,70,49,32,98,121,
+  32,70,50,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  118,97,108,117,101,32,102,111,114,32,69,117,108,101,114,39,
+  115,32,110,117,109,98,101,114,46,0,0,72,111,111,107,46,
+  32,82,101,116,117,114,110,32,97,32,99,111,110,115,116,97,
+  110,116,32,117,115,101,100,32,97,115,32,116,104,101,32,115,
+  99,97,108,105,110,103,32,102,97,99,116,111,114,32,102,111,
+  114,32,116,104,101,32,101,58,32,119,111,114,100,115,46,0,
+  0,82,101,116,117,114,110,32,97,32,118,97,108,117,101,32,
+  99,111,114,114,101,115,112,111,110,100,105,110,103,32,116,111,
+  32,112,111,115,105,116,105,118,101,32,105,110,102,105,110,105,
+  116,121,0,0,82,101,116,117,114,110,32,97,32,118,97,108,
+  117,101,32,99,111,114,114,101,115,112,111,110,100,105,110,103,
+  32,116,111,32,78,97,78,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,118,97,108,117,101,32,102,111,114,32,80,73,46,
+  0,0,82,101,116,117,114,110,32,116,104,101,32,97,98,115,
+  111,108,117,116,101,32,118,97,108,117,101,32,102,111,114,32,
+  97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
+  32,118,97,108,117,101,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,97,114,99,32,99,111,115,105,110,101,32,111,
+  102,32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,110,117,109,98,101,114,46,0,0,82,101,116,117,
+  114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,
+  32,105,116,101,109,115,32,111,110,32,116,104,101,32,97,108,
+  116,101,114,110,97,116,101,32,102,108,111,97,116,105,110,103,
+  45,112,111,105,110,116,32,115,116,97,99,107,46,0,0,82,
+  101,116,117,114,110,32,116,104,101,32,97,114,99,32,115,105,
+  110,101,32,111,102,32,97,32,102,108,111,97,116,105,110,103,
+  45,112,111,105,110,116,32,110,117,109,98,101,114,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,97,114,99,32,116,
+  97,110,103,101,110,116,32,111,102,32,97,32,102,108,111,97,
+  116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,101,
+  114,46,0,0,82,101,116,117,114,110,32,84,82,85,69,32,
+  105,102,32,110,117,109,98,101,114,32,105,115,32,98,101,116,
+  119,101,101,110,32,116,104,101,32,108,111,119,101,114,32,40,
+  108,41,32,97,110,100,32,117,112,112,101,114,32,40,117,41,
+  32,98,111,117,110,100,115,46,32,73,102,32,110,111,116,44,
+  32,114,101,116,117,114,110,32,70,65,76,83,69,46,32,84,
+  104,105,115,32,105,115,32,105,110,99,108,117,115,105,118,101,
+  32,111,102,32,116,104,101,32,108,105,109,105,116,115,46,0,
+  0,73,102,32,96,110,96,32,105,115,32,101,113,117,97,108,
+  32,116,111,32,96,109,96,44,32,100,114,111,112,32,98,111,
+  116,104,32,97,110,100,32,101,120,101,99,117,116,101,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,113,117,111,
+  116,101,32,98,101,102,111,114,101,32,101,120,105,116,105,110,
+  103,32,116,104,101,32,99,97,108,108,105,110,103,32,119,111,
+  114,100,46,32,73,102,32,110,111,116,32,101,113,117,97,108,
+  44,32,108,101,97,118,101,32,96,110,96,32,111,110,32,116,
+  104,101,32,115,116,97,99,107,32,97,110,100,32,108,101,116,
+  32,101,120,101,99,117,116,105,111,110,32,99,111,110,116,105,
+  110,117,101,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,115,109,97,108,108,101,115,116,32,105,110,116,101,103,114,
+  97,108,32,118,97,108,117,101,32,103,114,101,97,116,101,114,
+  32,116,104,97,110,32,111,114,32,101,113,117,97,108,32,116,
+  111,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+  118,97,108,117,101,46,0,0,82,101,116,117,114,110,32,116,
+  104,101,32,99,111,115,105,110,101,32,111,102,32,97,32,102,
+  108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,117,
+  109,98,101,114,46,0,0,68,101,99,114,101,109,101,110,116,
+  32,110,32,98,121,32,111,110,101,46,0,0,82,101,116,117,
+  114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,
+  32,105,116,101,109,115,32,111,110,32,116,104,101,32,102,108,
+  111,97,116,105,110,103,45,112,111,105,110,116,32,115,116,97,
+  99,107,46,0,0,68,105,115,99,97,114,100,32,116,104,101,
+  32,116,111,112,32,105,116,101,109,32,111,110,32,116,104,101,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  115,116,97,99,107,46,0,0,82,101,109,111,118,101,32,116,
+  111,112,32,116,119,111,32,105,116,101,109,115,32,111,110,32,
+  116,104,101,32,115,116,97,99,107,46,0,0,68,105,115,112,
+  108,97,121,32,116,104,101,32,105,116,101,109,115,32,111,110,
+  32,116,104,101,32,97,108,116,101,114,110,97,116,101,32,102,
+  108,111,97,116,105,110,103,45,112,111,105,110,116,32,115,116,
+  97,99,107,46,0,0,68,105,115,112,108,97,121,32,116,104,
+  101,32,105,116,101,109,115,32,111,110,32,116,104,101,32,102,
+  108,111,97,116,105,110,103,45,112,111,105,110,116,32,115,116,
+  97,99,107,46,0,0,68,117,112,108,105,99,97,116,101,32,
+  116,104,101,32,116,111,112,32,105,116,101,109,32,111,110,32,
+  116,104,101,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,115,116,97,99,107,46,0,0,68,117,112,108,105,
+  99,97,116,101,32,116,104,101,32,116,111,112,32,116,119,111,
+  32,105,116,101,109,115,32,111,110,32,116,104,101,32,115,116,
+  97,99,107,46,0,0,67,111,109,112,97,114,101,32,116,119,
+  111,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
+  32,118,97,108,117,101,115,32,102,111,114,32,101,113,117,97,
+  108,105,116,121,46,32,82,101,116,117,114,110,115,32,96,84,
+  82,85,69,96,32,105,102,32,116,104,101,121,32,97,114,101,
+  32,101,113,117,97,108,32,111,114,32,96,70,65,76,83,69,
+  96,32,111,116,104,101,114,119,105,115,101,46,0,0,70,101,
+  116,99,104,32,97,32,115,116,111,114,101,100,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,46,0,0,80,101,114,102,111,114,109,32,97,32,109,97,
+  116,104,101,109,97,116,105,99,97,108,32,102,108,111,111,114,
+  32,111,112,101,114,97,116,105,111,110,32,111,110,32,116,104,
+  101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
+  32,118,97,108,117,101,46,0,0,67,111,109,112,97,114,101,
+  32,116,119,111,32,102,108,111,97,116,105,110,103,45,112,111,
+  105,110,116,32,118,97,108,117,101,115,32,102,111,114,32,103,
+  114,101,97,116,101,114,32,116,104,97,110,46,0,0,73,110,
+  99,114,101,109,101,110,116,32,110,32,98,121,32,111,110,101,
+  46,0,0,82,101,116,117,114,110,32,96,84,82,85,69,96,
+  32,105,102,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,118,97,108,117,101,32,105,115,32,73,78,70,32,
+  111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,
+  119,105,115,101,46,0,0,82,101,116,117,114,110,32,110,32,
+  105,102,32,105,116,32,105,115,32,119,105,116,104,105,110,32,
+  116,104,101,32,108,111,119,101,114,32,40,108,41,32,97,110,
+  100,32,117,112,112,101,114,32,40,117,41,32,98,111,117,110,
+  100,115,46,32,73,102,32,111,117,116,115,105,100,101,32,116,
+  104,101,32,98,111,117,110,100,115,44,32,114,101,116,117,114,
+  110,32,116,104,101,32,99,108,111,115,101,115,32,98,111,117,
+  110,100,97,114,121,32,118,97,108,117,101,46,0,0,82,101,
+  116,117,114,110,32,108,111,103,40,70,49,41,32,102,111,114,
+  32,98,97,115,101,32,70,50,32,102,111,114,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,115,46,0,0,67,111,109,112,97,114,101,32,116,119,111,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  118,97,108,117,101,115,32,102,111,114,32,108,101,115,115,32,
+  116,104,97,110,46,0,0,82,101,116,117,114,110,32,116,104,
+  101,32,103,114,101,97,116,101,114,32,111,102,32,116,119,111,
+  32,118,97,108,117,101,115,46,0,0,82,101,116,117,114,110,
+  32,116,104,101,32,108,101,115,115,101,114,32,111,102,32,116,
+  119,111,32,118,97,108,117,101,115,46,0,0,82,101,116,117,
+  114,110,32,96,84,82,85,69,96,32,105,102,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,32,105,115,32,78,97,78,32,111,114,32,96,70,65,76,
+  83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,0,
+  73,110,118,101,114,116,32,116,104,101,32,115,105,103,110,32,
+  111,102,32,116,104,101,32,102,108,111,97,116,105,110,103,45,
+  112,111,105,110,116,32,118,97,108,117,101,46,0,0,82,101,
+  116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,102,
+  108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,
+  108,117,101,32,105,115,32,110,101,103,97,116,105,118,101,32,
+  111,114,32,96,70,65,76,83,69,96,32,105,102,32,110,111,
+  116,46,0,0,82,101,109,111,118,101,32,116,104,101,32,115,
+  101,99,111,110,100,32,105,116,101,109,32,102,114,111,109,32,
+  116,104,101,32,115,116,97,99,107,46,0,0,80,117,116,32,
+  97,32,99,111,112,121,32,111,102,32,116,104,101,32,115,101,
+  99,111,110,100,32,102,108,111,97,116,105,110,103,45,112,111,
+  105,110,116,32,118,97,108,117,101,32,111,118,101,114,32,116,
+  104,101,32,116,111,112,32,111,110,101,46,0,0,80,111,112,
+  32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,
+  116,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,
+  32,97,108,116,101,114,110,97,116,101,32,115,116,97,99,107,
+  46,0,0,82,101,116,117,114,110,32,96,84,82,85,69,96,
+  32,105,102,32,102,108,111,97,116,105,110,103,45,112,111,105,
+  110,116,32,118,97,108,117,101,32,105,115,32,112,111,115,105,
+  116,105,118,101,32,111,114,32,96,70,65,76,83,69,96,32,
+  111,116,104,101,114,119,105,115,101,46,0,0,82,101,116,117,
+  114,110,32,70,49,94,70,50,32,102,111,114,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,115,46,0,0,80,117,115,104,32,97,32,102,108,111,97,
+  116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,101,
+  32,116,111,32,97,110,32,97,108,116,101,114,110,97,116,105,
+  118,101,32,115,116,97,99,107,46,0,0,68,105,115,112,108,
+  97,121,32,97,32,102,108,111,97,116,105,110,103,45,112,111,
+  105,110,116,32,110,117,109,98,101,114,46,0,0,82,111,116,
+  97,116,101,32,116,104,101,32,116,111,112,32,116,104,114,101,
+  101,32,118,97,108,117,101,115,46,0,0,82,111,117,110,100,
+  32,97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,
+  116,32,118,97,108,117,101,46,0,0,82,101,116,117,114,110,
+  32,49,32,105,102,32,116,104,101,32,102,108,111,97,116,105,
+  110,103,45,112,111,105,110,116,32,118,97,108,117,101,32,105,
+  115,32,112,111,115,105,116,105,118,101,32,111,114,32,45,49,
+  32,105,102,32,105,116,32,105,115,32,110,101,103,97,116,105,
+  118,101,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  110,117,109,98,101,114,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,115,113,117,97,114,101,32,111,102,32,97,32,
+  102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,
+  117,109,98,101,114,46,0,0,82,101,116,117,114,110,32,116,
+  104,101,32,115,105,110,101,32,111,102,32,97,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,110,117,109,98,
+  101,114,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  110,117,109,98,101,114,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,115,113,117,97,114,101,32,111,102,32,97,32,
+  102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,
+  117,109,98,101,114,46,0,0,83,116,111,114,101,32,97,32,
+  102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,118,
+  97,108,117,101,32,116,111,32,116,104,101,32,115,112,101,99,
+  105,102,105,101,100,32,109,101,109,111,114,121,32,108,111,99,
+  97,116,105,111,110,46,0,0,69,120,99,104,97,110,103,101,
+  32,116,104,101,32,116,111,112,32,97,110,100,32,115,101,99,
+  111,110,100,32,105,116,101,109,115,32,111,110,32,116,104,101,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  115,116,97,99,107,46,0,0,82,101,116,117,114,110,32,116,
+  104,101,32,116,97,110,103,101,110,116,32,111,102,32,97,32,
+  102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,110,
+  117,109,98,101,114,46,0,0,69,110,99,111,100,101,32,116,
+  104,101,32,102,108,111,97,116,105,110,103,45,112,111,105,110,
+  116,32,118,97,108,117,101,32,116,111,32,97,110,32,105,110,
+  116,101,103,101,114,46,0,0,67,111,110,118,101,114,116,32,
+  97,32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,
+  32,118,97,108,117,101,32,105,110,116,111,32,97,32,110,117,
+  109,98,101,114,46,0,0,67,111,110,118,101,114,116,32,97,
+  32,102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,
+  118,97,108,117,101,32,105,110,116,111,32,97,32,115,116,114,
+  105,110,103,46,0,0,84,117,99,107,32,97,32,99,111,112,
+  121,32,111,102,32,116,104,101,32,116,111,112,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,32,117,110,100,101,114,32,116,104,101,32,115,101,99,111,
+  110,100,32,111,110,101,46,0,0,70,101,116,99,104,32,116,
+  104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,32,
+  97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
+  32,97,100,100,114,101,115,115,46,0,0,70,101,116,99,104,
+  32,116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,
+  100,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,97,100,100,114,101,115,115,46,32,82,101,116,117,
+  114,110,115,32,116,104,101,32,110,101,120,116,32,97,100,100,
+  114,101,115,115,32,97,110,100,32,116,104,101,32,118,97,108,
+  117,101,46,0,0,73,110,118,111,107,101,32,97,110,32,70,
+  70,73,32,102,117,110,99,116,105,111,110,46,32,83,101,116,
+  32,116,104,101,32,115,116,97,99,107,32,97,115,32,110,101,
+  101,100,101,100,44,32,97,110,100,32,112,97,115,115,32,116,
+  104,101,32,70,70,73,32,104,97,110,100,108,101,32,116,111,
+  32,116,104,105,115,46,0,0,77,97,112,32,105,110,32,97,
+  32,115,121,109,98,111,108,32,102,114,111,109,32,97,32,115,
+  104,97,114,101,100,32,108,105,98,114,97,114,121,32,111,114,
+  32,111,98,106,101,99,116,32,102,105,108,101,46,32,82,101,
+  116,117,114,110,115,32,97,110,32,70,70,73,32,104,97,110,
+  100,108,101,46,0,0,79,112,101,110,32,97,32,115,104,97,
+  114,101,100,32,108,105,98,114,97,114,121,32,111,114,32,111,
+  98,106,101,99,116,32,102,105,108,101,46,0,0,84,114,105,
+  103,103,101,114,32,97,110,32,105,47,111,32,111,112,101,114,
+  97,116,105,111,110,32,117,115,105,110,103,32,116,104,101,32,
+  70,70,73,32,100,101,118,105,99,101,46,0,0,67,111,110,
+  115,116,97,110,116,32,102,111,114,32,111,112,101,110,105,110,
+  103,32,97,32,102,105,108,101,32,105,110,32,65,80,80,69,
+  78,68,32,109,111,100,101,46,0,0,67,111,110,115,116,97,
+  110,116,32,102,111,114,32,111,112,101,110,105,110,103,32,97,
+  32,102,105,108,101,32,105,110,32,82,69,65,68,32,109,111,
+  100,101,46,0,0,67,111,110,115,116,97,110,116,32,102,111,
+  114,32,111,112,101,110,105,110,103,32,97,32,102,105,108,101,
+  32,105,110,32,82,69,65,68,32,38,32,87,82,73,84,69,
+  32,109,111,100,101,46,0,0,67,111,110,115,116,97,110,116,
+  32,102,111,114,32,111,112,101,110,105,110,103,32,97,32,102,
+  105,108,101,32,105,110,32,87,82,73,84,69,32,109,111,100,
+  101,46,0,0,71,105,118,101,110,32,97,32,102,105,108,101,
+  32,104,97,110,100,108,101,44,32,99,108,111,115,101,32,116,
+  104,101,32,102,105,108,101,46,0,0,68,101,108,101,116,101,
+  32,116,104,101,32,110,97,109,101,100,32,102,105,108,101,46,
+  0,0,71,105,118,101,110,32,97,32,102,105,108,101,32,110,
+  97,109,101,44,32,114,101,116,117,114,110,32,96,84,82,85,
+  69,96,32,105,102,32,105,116,32,101,120,105,115,116,115,32,
+  111,114,32,96,70,65,76,83,69,96,32,105,102,32,105,116,
+  32,100,111,101,115,32,110,111,116,46,0,0,71,105,118,101,
+  110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,44,
+  32,102,108,117,115,104,32,97,110,121,32,112,101,110,100,105,
+  110,103,32,119,114,105,116,101,115,32,116,111,32,100,105,115,
+  107,46,0,0,71,105,118,101,110,32,97,32,102,105,108,101,
+  32,110,97,109,101,44,32,111,112,101,110,32,105,116,32,97,
+  110,100,32,114,117,110,32,116,104,101,32,113,117,111,116,101,
+  32,111,110,99,101,32,102,111,114,32,101,97,99,104,32,108,
+  105,110,101,32,105,110,32,116,104,101,32,102,105,108,101,46,
+  0,0,71,105,118,101,110,32,97,32,102,105,108,101,32,110,
+  97,109,101,44,32,111,112,101,110,32,105,116,32,97,110,100,
+  32,114,117,110,32,116,104,101,32,113,117,111,116,101,32,111,
+  110,99,101,32,102,111,114,32,101,97,99,104,32,98,121,116,
+  101,32,105,110,32,116,104,101,32,102,105,108,101,46,0,0,
+  79,112,101,110,32,97,32,110,97,109,101,100,32,102,105,108,
+  101,32,40,115,41,32,119,105,116,104,32,116,104,101,32,103,
+  105,118,101,110,32,109,111,100,101,32,40,109,41,46,32,82,
+  101,116,117,114,110,115,32,97,32,104,97,110,100,108,101,32,
+  105,100,101,110,116,105,102,121,105,110,103,32,116,104,101,32,
+  102,105,108,101,46,0,0,79,112,101,110,32,97,32,102,105,
+  108,101,32,102,111,114,32,114,101,97,100,105,110,103,32,38,
+  32,119,114,105,116,105,110,103,46,32,82,101,116,117,114,110,
+  115,32,116,104,101,32,115,105,122,101,32,40,78,79,83,41,
+  32,97,110,100,32,97,32,102,105,108,101,32,73,68,32,40,
+  84,79,83,41,0,0,79,112,101,110,32,97,32,102,105,108,
+  101,32,102,111,114,32,114,101,97,100,105,110,103,46,32,82,
+  101,116,117,114,110,115,32,116,104,101,32,115,105,122,101,32,
+  40,78,79,83,41,32,97,110,100,32,97,32,102,105,108,101,
+  32,73,68,32,40,84,79,83,41,0,0,79,112,101,110,32,
+  97,32,102,105,108,101,32,102,111,114,32,119,114,105,116,105,
+  110,103,46,32,82,101,116,117,114,110,115,32,116,104,101,32,
+  102,105,108,101,32,73,68,0,0,84,114,105,103,103,101,114,
+  32,97,32,102,105,108,101,32,73,47,79,32,111,112,101,114,
+  97,116,105,111,110,46,32,84,104,105,115,32,105,115,32,110,
+  111,116,32,105,110,116,101,110,100,101,100,32,116,111,32,98,
+  101,32,117,115,101,100,32,100,105,114,101,99,116,108,121,46,
+  0,0,71,105,118,101,110,32,97,32,102,105,108,101,32,104,
+  97,110,100,108,101,44,32,114,101,97,100,32,97,110,100,32,
+  114,101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,
+  98,121,116,101,32,105,110,32,105,116,46,0,0,71,105,118,
+  101,110,32,97,32,102,105,108,101,32,104,97,110,100,108,101,
+  44,32,114,101,97,100,32,97,32,108,105,110,101,32,97,110,
+  100,32,114,101,116,117,114,110,32,97,32,112,111,105,110,116,
+  101,114,32,116,111,32,105,116,46,0,0,71,105,118,101,110,
+  32,97,32,112,111,105,110,116,101,114,44,32,97,32,99,111,
+  117,110,116,44,32,97,110,100,32,97,32,102,105,108,101,32,
+  104,97,110,100,108,101,44,32,114,101,97,100,32,97,110,100,
+  32,115,116,111,114,101,32,116,104,101,32,114,101,113,117,101,
+  115,116,101,100,32,110,117,109,98,101,114,32,111,102,32,98,
+  121,116,101,115,32,105,110,116,111,32,109,101,109,111,114,121,
+  44,32,115,116,97,114,116,105,110,103,32,97,116,32,116,104,
+  101,32,115,112,101,99,105,102,105,101,100,32,97,100,100,114,
+  101,115,115,46,0,0,71,105,118,101,110,32,97,32,102,105,
+  108,101,32,104,97,110,100,108,101,44,32,114,101,97,100,32,
+  97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,110,
+  101,120,116,32,99,104,97,114,97,99,116,101,114,32,105,110,
+  32,105,116,46,32,73,102,32,99,111,109,112,105,108,101,100,
+  32,119,105,116,104,32,85,84,70,51,50,32,115,117,112,112,
+  111,114,116,32,116,104,105,115,32,119,105,108,108,32,114,101,
+  97,100,32,97,110,100,32,99,111,110,118,101,114,116,32,85,
+  84,70,56,46,0,0,77,111,118,101,32,116,104,101,32,99,
+  117,114,114,101,110,116,32,111,102,102,115,101,116,32,105,110,
+  116,111,32,97,32,102,105,108,101,32,116,111,32,116,104,101,
+  32,115,112,101,99,105,102,105,101,100,32,111,110,101,46,0,
+  0,71,105,118,101,110,32,97,32,102,105,108,101,32,104,97,
+  110,100,108,101,44,32,114,101,116,117,114,110,32,116,104,101,
+  32,115,105,122,101,32,111,102,32,116,104,101,32,102,105,108,
+  101,32,40,105,110,32,98,121,116,101,115,41,46,0,0,71,
+  105,118,101,110,32,97,110,32,97,100,100,114,101,115,115,32,
+  97,110,100,32,97,32,102,105,108,101,32,110,97,109,101,44,
+  32,114,101,97,100,32,116,104,101,32,102,105,108,101,32,99,
+  111,110,116,101,110,116,115,32,105,110,116,111,32,109,101,109,
+  111,114,121,32,115,116,97,114,116,105,110,103,32,97,116,32,
+  116,104,101,32,97,100,100,114,101,115,115,46,0,0,71,105,
+  118,101,110,32,97,32,115,116,114,105,110,103,32,40,115,49,
+  41,32,97,110,100,32,97,32,102,105,108,101,32,110,97,109,
+  101,32,40,115,50,41,44,32,119,114,105,116,101,32,116,104,
+  101,32,115,116,114,105,110,103,32,105,110,116,111,32,116,104,
+  101,32,102,105,108,101,44,32,114,101,112,108,97,99,105,110,
+  103,32,97,110,121,32,101,120,105,115,116,105,110,103,32,99,
+  111,110,116,101,110,116,46,0,0,71,105,118,101,110,32,97,
+  32,102,105,108,101,32,104,97,110,100,108,101,44,32,114,101,
+  116,117,114,110,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,111,102,102,115,101,116,32,105,110,32,116,104,101,32,102,
+  105,108,101,46,0,0,87,114,105,116,101,32,97,32,98,121,
+  116,101,32,116,111,32,116,104,101,32,102,105,108,101,32,114,
+  101,112,114,101,115,101,110,116,101,100,32,98,121,32,116,104,
+  101,32,104,97,110,100,108,101,46,0,0,87,114,105,116,101,
+  32,110,32,98,121,116,101,115,32,116,111,32,116,104,101,32,
+  102,105,108,101,32,114,101,112,114,101,115,101,110,116,101,100,
+  32,98,121,32,116,104,101,32,104,97,110,100,108,101,46,32,
+  66,121,116,101,115,32,97,114,101,32,116,97,107,101,110,32,
+  102,114,111,109,32,109,101,109,111,114,121,44,32,115,116,97,
+  114,116,105,110,103,32,97,116,32,116,104,101,32,112,114,111,
+  118,105,100,101,100,32,97,100,100,114,101,115,115,46,0,0,
+  87,114,105,116,101,32,97,32,99,104,97,114,97,99,116,101,
+  114,32,116,111,32,116,104,101,32,102,105,108,101,32,114,101,
+  112,114,101,115,101,110,116,101,100,32,98,121,32,116,104,101,
+  32,104,97,110,100,108,101,46,32,73,102,32,98,117,105,108,
+  116,32,119,105,116,104,32,85,84,70,51,50,32,115,117,112,
+  112,111,114,116,44,32,116,104,105,115,32,119,105,108,108,32,
+  116,114,97,110,115,108,97,116,101,32,116,104,101,32,99,104,
+  97,114,97,99,116,101,114,32,98,97,99,107,32,116,111,32,
+  97,32,85,84,70,56,32,115,101,113,117,101,110,99,101,32,
+  98,101,102,111,114,101,32,119,114,105,116,105,110,103,46,0,
+  0,70,105,108,108,32,109,101,109,111,114,121,32,115,116,97,
+  114,116,105,110,103,32,97,116,32,34,112,34,32,119,105,116,
+  104,32,118,97,108,117,101,32,34,118,34,46,32,70,105,108,
+  108,115,32,34,110,34,32,99,101,108,108,115,46,0,0,65,
+  112,112,101,110,100,32,97,32,99,111,110,115,32,99,101,108,
+  108,32,116,111,32,97,32,108,105,115,116,46,0,0,67,114,
+  101,97,116,101,32,97,32,110,101,119,32,108,105,115,116,32,
+  119,105,116,32,116,104,101,32,103,105,118,101,110,32,118,97,
+  108,117,101,32,97,115,32,116,104,101,32,99,97,114,32,111,
+  102,32,116,104,101,32,102,105,114,115,116,32,110,111,100,101,
+  46,0,0,82,101,109,111,118,101,32,116,104,101,32,115,112,
+  101,99,105,102,105,101,100,32,99,111,110,115,32,102,114,111,
+  109,32,97,32,108,105,115,116,46,0,0,82,101,109,111,118,
+  101,32,116,104,101,32,108,97,115,116,32,99,111,110,115,32,
+  102,114,111,109,32,97,32,108,105,115,116,46,0,0,82,117,
+  110,32,97,32,113,117,111,116,97,116,105,111,110,32,97,103,
+  97,105,110,115,116,32,101,97,99,104,32,118,97,108,117,101,
+  32,105,110,32,97,32,108,105,115,116,46,0,0,73,110,115,
+  101,114,116,32,97,32,110,101,119,32,99,111,110,115,32,40,
+  118,41,32,105,110,116,111,32,116,104,101,32,108,105,115,116,
+  32,40,112,41,44,32,97,116,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,105,110,100,101,120,32,40,110,41,
+  46,0,0,82,101,116,117,114,110,32,116,104,101,32,108,101,
+  110,103,116,104,32,111,102,32,97,32,108,105,115,116,46,0,
+  0,68,105,115,112,108,97,121,32,116,104,101,32,40,97,115,
+  32,110,117,109,98,101,114,115,41,32,118,97,108,117,101,115,
+  32,105,110,32,97,32,108,105,115,116,46,0,0,71,105,118,
+  101,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,
+  97,32,108,105,115,116,44,32,114,101,116,117,114,110,32,97,
+  32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
+  108,97,115,116,32,99,111,110,115,32,99,101,108,108,46,0,
+  0,71,105,118,101,110,32,97,32,110,111,100,101,32,110,117,
+  109,98,101,114,44,32,114,101,116,117,114,110,32,97,32,112,
+  111,105,110,116,101,114,32,116,111,32,116,104,101,32,99,111,
+  110,115,32,99,101,108,108,32,105,110,32,116,104,101,32,108,
+  105,115,116,46,0,0,84,114,105,103,103,101,114,32,97,32,
+  102,108,111,97,116,105,110,103,45,112,111,105,110,116,32,111,
+  112,101,114,97,116,105,111,110,46,32,84,104,105,115,32,105,
+  115,32,110,111,116,32,105,110,116,101,110,100,101,100,32,116,
+  111,32,98,101,32,117,115,101,100,32,100,105,114,101,99,116,
+  108,121,46,0,0,82,117,110,32,113,117,111,116,97,116,105,
+  111,110,32,105,110,32,97,110,32,101,110,100,108,101,115,115,
+  32,108,111,111,112,46,0,0,83,97,118,101,32,118,97,108,
+  117,101,32,111,102,32,96,72,101,97,112,96,44,32,114,117,
+  110,32,116,104,101,32,102,117,110,99,116,105,111,110,32,112,
+  114,111,118,105,100,101,100,44,32,116,104,101,110,32,114,101,
+  115,116,111,114,101,32,96,72,101,97,112,96,46,0,0,67,
+  111,109,112,97,114,101,32,110,49,32,97,110,100,32,110,50,
+  46,32,82,101,116,117,114,110,32,96,84,82,85,69,96,32,
+  105,102,32,110,49,32,105,115,32,103,114,101,97,116,101,114,
+  32,116,104,97,110,32,110,50,44,32,111,114,32,96,70,65,
+  76,83,69,96,32,111,116,104,101,114,119,105,115,101,46,0,
+  0,67,111,109,112,97,114,101,32,110,49,32,97,110,100,32,
+  110,50,46,32,82,101,116,117,114,110,32,96,84,82,85,69,
+  96,32,105,102,32,110,49,32,105,115,32,103,114,101,97,116,
+  101,114,32,116,104,97,110,32,111,114,32,101,113,117,97,108,
+  32,116,111,32,110,50,44,32,111,114,32,96,70,65,76,83,
+  69,96,32,111,116,104,101,114,119,105,115,101,46,0,0,70,
+  101,116,99,104,32,116,104,101,32,49,54,45,98,105,116,32,
+  118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,32,
+  116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,100,
+  100,114,101,115,115,46,32,65,100,100,114,101,115,115,105,110,
+  103,32,102,111,114,32,116,104,105,115,32,105,115,32,105,110,
+  32,56,45,98,105,116,32,117,110,105,116,115,46,0,0,70,
+  101,116,99,104,32,116,104,101,32,118,97,108,117,101,32,115,
+  116,111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,32,
+  82,101,116,117,114,110,115,32,116,104,101,32,110,101,120,116,
+  32,97,100,100,114,101,115,115,32,97,110,100,32,116,104,101,
+  32,118,97,108,117,101,46,0,0,83,116,111,114,101,32,97,
+  110,32,49,54,45,98,105,116,32,118,97,108,117,101,32,105,
+  110,116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,97,100,100,114,101,115,115,46,32,65,100,100,114,101,
+  115,115,105,110,103,32,102,111,114,32,116,104,105,115,32,105,
+  115,32,105,110,32,56,45,98,105,116,32,117,110,105,116,115,
+  46,0,0,83,116,111,114,101,32,97,32,118,97,108,117,101,
+  32,105,110,116,111,32,116,104,101,32,115,112,101,99,105,102,
+  105,101,100,32,97,100,100,114,101,115,115,32,97,110,100,32,
+  114,101,116,117,114,110,32,116,104,101,32,110,101,120,116,32,
+  97,100,100,114,101,115,115,46,0,0,82,101,116,117,114,110,
+  32,116,104,101,32,110,101,120,116,32,102,114,101,101,32,97,
+  100,100,114,101,115,115,32,105,110,32,109,101,109,111,114,121,
+  46,0,0,83,101,116,32,96,66,97,115,101,96,32,116,111,
+  32,104,101,120,97,100,101,99,105,109,97,108,46,0,0,65,
+  100,100,32,97,32,104,111,111,107,32,112,111,105,110,116,32,
+  105,110,116,111,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,119,111,114,100,46,32,84,104,105,115,32,115,104,111,117,
+  108,100,32,111,110,108,121,32,98,101,32,117,115,101,100,32,
+  97,115,32,116,104,101,32,102,105,114,115,116,32,119,111,114,
+  100,32,105,110,32,97,32,100,101,102,105,110,105,116,105,111,
+  110,46,0,0,65,115,115,101,109,98,108,101,32,116,104,101,
+  32,105,110,115,116,114,117,99,116,105,111,110,115,32,115,112,
+  101,99,105,102,105,101,100,32,98,121,32,116,104,101,32,115,
+  116,114,105,110,103,32,105,110,116,111,32,116,104,101,32,99,
+  117,114,114,101,110,116,32,97,115,115,101,109,98,108,121,32,
+  115,99,111,112,101,46,0,0,69,120,101,99,117,116,101,32,
+  116,104,101,32,113,117,111,116,101,32,105,102,32,116,104,101,
+  32,102,108,97,103,32,105,115,32,96,84,82,85,69,96,46,
+  0,0,69,120,101,99,117,116,101,32,116,104,101,32,113,117,
+  111,116,97,116,105,111,110,32,105,102,32,116,104,101,32,102,
+  108,97,103,32,105,115,32,96,84,82,85,69,96,46,32,73,
+  102,32,116,114,117,101,44,32,97,108,115,111,32,101,120,105,
+  116,32,116,104,101,32,119,111,114,100,46,0,0,67,104,97,
+  110,103,101,32,116,104,101,32,99,108,97,115,115,32,111,102,
+  32,116,104,101,32,109,111,115,116,32,114,101,99,101,110,116,
+  108,121,32,100,101,102,105,110,101,100,32,119,111,114,100,32,
+  116,111,32,96,99,108,97,115,115,58,109,97,99,114,111,96,
+  46,0,0,82,117,110,32,116,104,101,32,99,111,100,101,32,
+  105,110,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
+  32,102,105,108,101,46,32,0,0,82,117,110,32,97,32,113,
+  117,111,116,101,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,110,117,109,98,101,114,32,111,102,32,116,105,109,
+  101,115,44,32,116,114,97,99,107,105,110,103,32,116,104,101,
+  32,108,111,111,112,32,105,110,100,101,120,32,105,110,32,96,
+  73,96,46,32,84,104,105,115,32,105,115,32,108,101,115,115,
+  32,101,102,102,105,99,105,101,110,116,32,116,104,97,110,32,
+  96,116,105,109,101,115,96,44,32,115,111,32,105,102,32,116,
+  104,101,32,105,110,100,101,120,32,105,115,32,110,111,116,32,
+  110,101,101,100,101,100,44,32,116,104,105,115,32,115,104,111,
+  117,108,100,32,98,101,32,97,118,111,105,100,101,100,46,0,
+  0,86,101,99,116,111,114,101,100,46,32,73,110,116,101,114,
+  112,114,101,116,32,97,32,115,105,110,103,108,101,32,105,110,
+  112,117,116,32,116,111,107,101,110,46,0,0,84,114,105,103,
+  103,101,114,32,97,110,32,73,47,79,32,111,112,101,114,97,
+  116,105,111,110,32,105,110,118,111,108,118,105,110,103,32,109,
+  117,108,116,105,99,111,114,101,32,115,117,112,112,111,114,116,
+  46,32,85,110,105,120,32,115,121,115,116,101,109,32,99,97,
+  108,108,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  110,117,109,98,101,114,32,111,102,32,73,47,79,32,100,101,
+  118,105,99,101,115,46,0,0,84,114,105,103,103,101,114,32,
+  97,110,32,73,47,79,32,111,112,101,114,97,116,105,111,110,
+  32,105,110,118,111,108,118,105,110,103,32,116,104,101,32,101,
+  118,101,110,116,32,100,101,118,105,99,101,46,0,0,73,110,
+  118,111,107,101,32,97,110,32,105,110,116,101,114,97,99,116,
+  105,111,110,32,119,105,116,104,32,97,110,32,73,47,79,32,
+  100,101,118,105,99,101,46,0,0,65,115,107,32,97,110,32,
+  73,47,79,32,100,101,118,105,99,101,32,116,111,32,105,100,
+  101,110,116,105,102,121,32,105,116,115,101,108,102,46,32,82,
+  101,116,117,114,110,115,32,97,32,118,101,114,115,105,111,110,
+  32,40,109,41,32,97,110,100,32,100,101,118,105,99,101,32,
+  73,68,32,40,78,41,46,0,0,83,99,97,110,32,116,104,
+  101,32,73,47,79,32,100,101,118,105,99,101,115,32,102,111,
+  114,32,97,32,100,101,118,105,99,101,32,119,105,116,104,32,
+  97,32,115,112,101,99,105,102,105,101,100,32,73,68,46,32,
+  82,101,116,117,114,110,115,32,116,104,101,32,100,101,118,105,
+  99,101,32,110,117,109,98,101,114,44,32,111,114,32,45,49,
+  32,105,102,32,110,111,116,32,102,111,117,110,100,46,0,0,
+  84,114,105,103,103,101,114,32,97,32,85,110,105,120,32,115,
+  121,115,116,101,109,32,99,97,108,108,46,32,84,104,105,115,
+  32,105,115,32,110,111,116,32,105,110,116,101,110,100,101,100,
+  32,116,111,32,98,101,32,117,115,101,100,32,100,105,114,101,
+  99,116,108,121,46,0,0,68,97,116,97,46,32,82,101,116,
+  117,114,110,32,97,32,116,101,109,112,108,97,116,101,32,102,
+  111,114,32,97,32,108,105,98,114,97,114,121,32,102,105,108,
+  101,32,110,97,109,101,32,105,110,32,96,126,47,46,99,111,
+  110,102,105,103,47,114,101,116,114,111,102,111,114,116,104,47,
+  108,105,98,114,97,114,121,96,46,0,0,70,105,110,100,32,
+  116,104,101,32,117,115,101,114,115,32,104,111,109,101,32,100,
+  105,114,101,99,116,111,114,121,32,97,110,100,32,99,111,110,
+  115,116,114,117,99,116,32,97,32,102,105,108,101,110,97,109,
+  101,32,102,111,114,32,97,32,108,105,98,114,97,114,121,32,
+  105,110,32,116,104,101,32,96,126,47,46,99,111,110,102,105,
+  103,47,114,101,116,114,111,102,111,114,116,104,47,108,105,98,
+  114,97,114,121,96,32,100,105,114,101,99,116,111,114,121,46,
+  0,0,68,97,116,97,46,32,82,101,116,117,114,110,32,97,
+  32,116,101,109,112,108,97,116,101,32,102,111,114,32,97,32,
+  108,105,98,114,97,114,121,32,102,105,108,101,32,110,97,109,
+  101,32,105,110,32,96,46,47,108,105,98,114,97,114,121,96,
+  46,0,0,67,104,101,99,107,32,116,111,32,115,101,101,32,
+  105,102,32,97,32,108,105,98,114,97,114,121,32,101,120,105,
+  115,116,115,46,0,0,67,111,110,115,116,114,117,99,116,32,
+  97,32,102,105,108,101,110,97,109,101,32,102,111,114,32,97,
+  32,108,105,98,114,97,114,121,32,105,110,32,116,104,101,32,
+  96,126,47,108,105,98,114,97,114,121,96,32,100,105,114,101,
+  99,116,111,114,121,46,0,0,71,105,118,101,110,32,97,32,
+  108,105,98,114,97,114,121,32,110,97,109,101,44,32,99,111,
+  110,115,116,114,117,99,116,32,116,104,101,32,97,99,116,117,
+  97,108,32,102,105,108,101,110,97,109,101,32,116,111,32,108,
+  111,97,100,46,0,0,76,111,97,100,32,97,32,108,105,98,
+  114,97,114,121,46,32,84,104,105,115,32,119,105,108,108,32,
+  108,111,97,100,32,116,104,101,32,115,116,114,105,110,103,44,
+  32,119,105,116,104,32,34,46,114,101,116,114,111,34,46,0,
+  0,34,82,117,110,32,105,110,116,101,114,97,99,116,105,118,
+  101,32,34,34,108,105,115,116,101,110,101,114,34,34,32,40,
+  97,32,82,69,80,76,41,46,34,0,0,67,111,109,112,97,
+  114,101,32,110,49,32,97,110,100,32,110,50,46,32,82,101,
+  116,117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,
+  49,32,105,115,32,108,101,115,115,32,116,104,97,110,32,110,
+  50,44,32,111,114,32,96,70,65,76,83,69,96,32,111,116,
+  104,101,114,119,105,115,101,46,0,0,67,111,109,112,97,114,
+  101,32,110,49,32,97,110,100,32,110,50,46,32,82,101,116,
+  117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,49,
+  32,105,115,32,108,101,115,115,32,116,104,97,110,32,111,114,
+  32,101,113,117,97,108,32,116,111,32,110,50,44,32,111,114,
+  32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,
+  115,101,46,0,0,68,105,118,105,100,101,32,96,110,96,32,
+  98,121,32,96,109,96,32,97,110,100,32,114,101,116,117,114,
+  110,32,116,104,101,32,114,101,109,97,105,110,100,101,114,46,
+  0,0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,
+  105,102,32,110,117,109,98,101,114,32,105,115,32,110,111,116,
+  32,122,101,114,111,44,32,111,114,32,96,70,65,76,83,69,
+  96,32,111,116,104,101,114,119,105,115,101,46,0,0,82,101,
+  116,117,114,110,32,116,104,101,32,109,97,120,105,109,117,109,
+  32,118,97,108,117,101,32,116,104,97,116,32,119,105,108,108,
+  32,102,105,116,32,105,110,32,97,32,99,101,108,108,46,0,
+  0,82,101,116,117,114,110,32,116,104,101,32,109,105,110,105,
+  109,117,109,32,118,97,108,117,101,32,116,104,97,116,32,119,
+  105,108,108,32,102,105,116,32,105,110,32,97,32,99,101,108,
+  108,46,0,0,82,101,116,117,114,110,32,116,104,101,32,97,
+  98,115,111,108,117,116,101,32,118,97,108,117,101,32,111,102,
+  32,97,32,110,117,109,98,101,114,46,0,0,65,100,100,32,
+  96,110,49,96,32,116,111,32,96,110,50,96,32,97,110,100,
+  32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,117,
+  108,116,46,0,0,82,101,116,117,114,110,32,84,82,85,69,
+  32,105,102,32,110,117,109,98,101,114,32,105,115,32,98,101,
+  116,119,101,101,110,32,116,104,101,32,108,111,119,101,114,32,
+  40,108,41,32,97,110,100,32,117,112,112,101,114,32,40,117,
+  41,32,98,111,117,110,100,115,46,32,73,102,32,110,111,116,
+  44,32,114,101,116,117,114,110,32,70,65,76,83,69,46,32,
+  84,104,105,115,32,105,115,32,105,110,99,108,117,115,105,118,
+  101,32,111,102,32,116,104,101,32,108,105,109,105,116,115,46,
+  0,0,68,101,99,114,101,109,101,110,116,32,110,32,98,121,
+  32,111,110,101,46,0,0,68,105,118,105,100,101,32,96,110,
+  96,32,98,121,32,96,109,96,32,97,110,100,32,114,101,116,
+  117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,
+  112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,
+  105,101,110,116,46,0,0,68,105,118,105,100,101,32,96,110,
+  96,32,98,121,32,96,109,96,32,97,110,100,32,114,101,116,
+  117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,32,
+  112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,116,
+  105,101,110,116,32,97,110,100,32,114,101,109,97,105,110,100,
+  101,114,46,0,0,82,101,116,117,114,110,32,96,84,82,85,
+  69,96,32,105,102,32,110,117,109,98,101,114,32,105,115,32,
+  101,118,101,110,44,32,111,114,32,96,70,65,76,83,69,96,
+  32,105,102,32,110,111,116,46,0,0,73,110,99,114,101,109,
+  101,110,116,32,110,32,98,121,32,111,110,101,46,0,0,82,
+  101,116,117,114,110,32,110,32,105,102,32,105,116,32,105,115,
+  32,119,105,116,104,105,110,32,116,104,101,32,108,111,119,101,
+  114,32,40,108,41,32,97,110,100,32,117,112,112,101,114,32,
+  40,117,41,32,98,111,117,110,100,115,46,32,73,102,32,111,
+  117,116,115,105,100,101,32,116,104,101,32,98,111,117,110,100,
+  115,44,32,114,101,116,117,114,110,32,116,104,101,32,99,108,
+  111,115,101,115,32,98,111,117,110,100,97,114,121,32,118,97,
+  108,117,101,46,0,0,82,101,116,117,114,110,32,116,104,101,
+  32,103,114,101,97,116,101,114,32,111,102,32,116,119,111,32,
+  118,97,108,117,101,115,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,108,101,115,115,101,114,32,111,102,32,116,119,
+  111,32,118,97,108,117,101,115,46,0,0,68,105,118,105,100,
+  101,32,96,110,96,32,98,121,32,96,109,96,32,97,110,100,
+  32,114,101,116,117,114,110,32,116,104,101,32,114,101,109,97,
+  105,110,100,101,114,46,0,0,77,117,108,116,105,112,108,121,
+  32,96,110,49,96,32,98,121,32,96,110,50,96,32,97,110,
+  100,32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,
+  117,108,116,46,0,0,73,110,118,101,114,116,32,116,104,101,
+  32,115,105,103,110,32,111,102,32,97,32,110,117,109,98,101,
+  114,46,0,0,82,101,116,117,114,110,32,96,84,82,85,69,
+  96,32,105,102,32,110,117,109,98,101,114,32,105,115,32,110,
+  101,103,97,116,105,118,101,44,32,111,114,32,96,70,65,76,
+  83,69,96,32,105,102,32,110,111,116,46,0,0,82,101,116,
+  117,114,110,32,96,84,82,85,69,96,32,105,102,32,110,117,
+  109,98,101,114,32,105,115,32,111,100,100,44,32,111,114,32,
+  96,70,65,76,83,69,96,32,105,102,32,110,111,116,46,0,
+  0,82,101,116,117,114,110,32,96,84,82,85,69,96,32,105,
+  102,32,110,117,109,98,101,114,32,105,115,32,112,111,115,105,
+  116,105,118,101,44,32,111,114,32,96,70,65,76,83,69,96,
+  32,105,102,32,110,111,116,46,0,0,82,101,116,117,114,110,
+  32,98,97,115,101,32,40,98,41,32,116,111,32,112,111,119,
+  101,114,32,40,112,41,46,0,0,68,105,115,112,108,97,121,
+  32,97,32,110,117,109,98,101,114,46,0,0,82,101,116,117,
+  114,110,32,97,32,114,97,110,100,111,109,32,110,117,109,98,
+  101,114,46,0,0,82,101,116,117,114,110,32,116,104,101,32,
+  115,113,117,97,114,101,32,114,111,111,116,32,111,102,32,97,
+  32,110,117,109,98,101,114,46,0,0,82,101,116,117,114,110,
+  32,116,104,101,32,115,113,117,97,114,101,32,111,102,32,97,
+  32,110,117,109,98,101,114,46,0,0,82,101,116,117,114,110,
+  32,84,82,85,69,32,105,102,32,110,117,109,98,101,114,32,
+  105,115,32,103,114,101,97,116,101,114,32,116,104,97,110,32,
+  122,101,114,111,32,111,114,32,70,65,76,83,69,32,105,102,
+  32,105,116,32,105,115,32,122,101,114,111,32,111,114,32,108,
+  101,115,115,46,0,0,83,117,98,116,114,97,99,116,32,96,
+  110,50,96,32,102,114,111,109,32,96,110,49,96,32,97,110,
+  100,32,114,101,116,117,114,110,32,116,104,101,32,114,101,115,
+  117,108,116,46,0,0,67,111,110,118,101,114,116,32,97,32,
+  110,117,109,98,101,114,32,105,110,116,111,32,97,32,102,108,
+  111,97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,
+  117,101,46,0,0,67,111,110,118,101,114,116,32,97,32,110,
+  117,109,98,101,114,32,105,110,116,111,32,97,32,115,116,114,
+  105,110,103,46,0,0,82,101,116,117,114,110,32,96,84,82,
+  85,69,96,32,105,102,32,110,117,109,98,101,114,32,105,115,
+  32,122,101,114,111,44,32,111,114,32,96,70,65,76,83,69,
+  96,32,111,116,104,101,114,119,105,115,101,46,0,0,82,101,
+  109,111,118,101,32,116,104,101,32,115,101,99,111,110,100,32,
+  105,116,101,109,32,102,114,111,109,32,116,104,101,32,115,116,
+  97,99,107,46,0,0,68,105,115,112,108,97,121,32,97,32,
+  110,101,119,108,105,110,101,46,0,0,80,101,114,102,111,114,
+  109,32,97,32,108,111,103,105,99,97,108,32,78,79,84,32,
+  111,112,101,114,97,116,105,111,110,46,0,0,83,101,116,32,
+  96,66,97,115,101,96,32,116,111,32,111,99,116,97,108,46,
+  0,0,80,101,114,102,111,114,109,32,97,32,98,105,116,119,
+  105,115,101,32,79,82,32,98,101,116,119,101,101,110,32,116,
+  104,101,32,112,114,111,118,105,100,101,100,32,118,97,108,117,
+  101,115,46,0,0,80,117,116,32,97,32,99,111,112,121,32,
+  111,102,32,110,32,111,118,101,114,32,109,46,0,0,80,97,
+  99,107,32,102,111,117,114,32,56,45,98,105,116,32,118,97,
+  108,117,101,115,32,105,110,116,111,32,97,32,51,50,45,98,
+  105,116,32,118,97,108,117,101,46,0,0,77,111,118,101,32,
+  97,32,118,97,108,117,101,32,102,114,111,109,32,116,104,101,
+  32,114,101,116,117,114,110,32,115,116,97,99,107,32,116,111,
+  32,116,104,101,32,100,97,116,97,32,115,116,97,99,107,46,
+  0,0,67,104,97,110,103,101,32,116,104,101,32,99,108,97,
+  115,115,32,111,102,32,116,104,101,32,109,111,115,116,32,114,
+  101,99,101,110,116,108,121,32,100,101,102,105,110,101,100,32,
+  119,111,114,100,32,116,111,32,96,99,108,97,115,115,58,112,
+  114,105,109,105,116,105,118,101,96,46,0,0,77,111,118,101,
+  32,97,32,118,97,108,117,101,32,102,114,111,109,32,116,104,
+  101,32,100,97,116,97,32,115,116,97,99,107,32,116,111,32,
+  116,104,101,32,114,101,116,117,114,110,32,115,116,97,99,107,
+  46,0,0,76,111,111,107,117,112,32,97,32,114,101,102,101,
+  114,101,110,99,101,32,98,121,32,110,97,109,101,32,97,110,
+  100,32,105,110,108,105,110,101,32,105,116,115,32,112,111,105,
+  110,116,101,114,32,116,111,32,116,104,101,32,99,117,114,114,
+  101,110,116,32,97,115,115,101,109,98,108,121,32,115,101,103,
+  109,101,110,116,46,0,0,67,104,97,110,103,101,32,116,104,
+  101,32,99,108,97,115,115,32,104,97,110,100,108,101,114,32,
+  111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,101,
+  110,116,108,121,32,100,101,102,105,110,101,100,32,119,111,114,
+  100,32,116,111,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,111,110,101,46,0,0,82,101,115,116,114,117,99,
+  116,117,114,101,32,116,104,101,32,111,114,100,101,114,32,111,
+  102,32,105,116,101,109,115,32,111,110,32,116,104,101,32,115,
+  116,97,99,107,46,0,0,66,101,103,105,110,32,97,110,32,
+  117,110,99,111,110,100,105,116,105,111,110,97,108,32,108,111,
+  111,112,46,0,0,82,101,109,111,118,101,32,97,108,108,32,
+  105,116,101,109,115,32,102,114,111,109,32,116,104,101,32,115,
+  116,97,99,107,46,0,0,82,111,116,97,116,101,32,116,104,
+  101,32,116,111,112,32,116,104,114,101,101,32,118,97,108,117,
+  101,115,46,0,0,67,111,109,112,105,108,101,32,116,104,101,
+  32,99,111,100,101,32,110,101,101,100,101,100,32,116,111,32,
+  112,117,115,104,32,97,32,115,116,114,105,110,103,32,112,111,
+  105,110,116,101,114,32,116,111,32,116,104,101,32,115,116,97,
+  99,107,32,97,110,100,32,105,110,108,105,110,101,32,116,104,
+  101,32,115,116,114,105,110,103,32,100,97,116,97,32,105,110,
+  116,111,32,116,104,101,32,99,117,114,114,101,110,116,32,100,
+  101,102,105,110,105,116,105,111,110,46,0,0,67,111,110,115,
+  116,97,110,116,46,32,82,101,116,117,114,110,115,32,97,32,
+  115,116,114,105,110,103,32,111,102,32,116,104,101,32,65,83,
+  67,73,73,32,108,101,116,116,101,114,115,32,40,117,112,112,
+  101,114,32,97,110,100,32,108,111,119,101,114,32,99,97,115,
+  101,41,0,0,67,111,110,115,116,97,110,116,46,32,82,101,
+  116,117,114,110,115,32,97,32,115,116,114,105,110,103,32,111,
+  102,32,116,104,101,32,65,83,67,73,73,32,108,101,116,116,
+  101,114,115,32,105,110,32,108,111,119,101,114,99,97,115,101,
+  0,0,67,111,110,115,116,97,110,116,46,32,82,101,116,117,
+  114,110,115,32,97,32,115,116,114,105,110,103,32,111,102,32,
+  116,104,101,32,65,83,67,73,73,32,108,101,116,116,101,114,
+  115,32,105,110,32,117,112,112,101,114,99,97,115,101,0,0,
+  67,111,110,115,116,97,110,116,46,32,82,101,116,117,114,110,
+  32,97,32,115,116,114,105,110,103,32,111,102,32,99,104,97,
+  114,97,99,116,101,114,115,32,114,101,99,111,103,110,105,122,
+  101,100,32,97,115,32,110,117,109,101,114,105,99,32,100,105,
+  103,105,116,115,46,0,0,67,111,110,115,116,97,110,116,46,
+  32,82,101,116,117,114,110,32,97,32,115,116,114,105,110,103,
+  32,111,102,32,99,104,97,114,97,99,116,101,114,115,32,114,
+  101,99,111,103,110,105,122,101,100,32,97,115,32,112,117,110,
+  99,116,117,97,116,105,111,110,46,0,0,67,111,110,115,116,
+  97,110,116,46,32,82,101,116,117,114,110,115,32,97,32,115,
+  116,114,105,110,103,32,111,102,32,99,104,97,114,97,99,116,
+  101,114,115,32,114,101,99,111,103,110,105,122,101,100,32,97,
+  115,32,119,104,105,116,101,115,112,97,99,101,46,0,0,82,
+  101,116,117,114,110,32,97,32,110,101,119,32,115,116,114,105,
+  110,103,32,99,111,110,115,105,115,116,105,110,103,32,111,102,
+  32,115,49,32,102,111,108,108,111,119,101,100,32,98,121,32,
+  115,50,46,0,0,82,101,116,117,114,110,32,96,84,82,85,
+  69,96,32,105,102,32,115,49,32,98,101,103,105,110,115,32,
+  119,105,116,104,32,115,50,32,111,114,32,96,70,65,76,83,
+  69,96,32,111,116,104,101,114,119,105,115,101,46,0,0,73,
+  102,32,116,104,101,32,96,115,96,32,109,97,116,99,104,101,
+  115,32,96,83,96,44,32,100,105,115,99,97,114,100,32,96,
+  115,96,32,97,110,100,32,114,117,110,32,116,104,101,32,113,
+  117,111,116,101,32,98,101,102,111,114,101,32,101,120,105,116,
+  105,110,103,32,116,104,101,32,99,97,108,108,101,114,46,32,
+  73,102,32,116,104,101,121,32,100,111,32,110,111,116,32,109,
+  97,116,99,104,44,32,100,105,115,99,97,114,100,32,116,104,
+  101,32,113,117,111,116,101,32,97,110,100,32,108,101,97,118,
+  101,32,96,115,96,32,111,110,32,116,104,101,32,115,116,97,
+  99,107,46,0,0,82,101,109,111,118,101,32,116,104,101,32,
+  108,97,115,116,32,99,104,97,114,97,99,116,101,114,32,102,
+  114,111,109,32,97,32,115,116,114,105,110,103,46,32,82,101,
+  116,117,114,110,115,32,97,32,110,101,119,32,115,116,114,105,
+  110,103,46,0,0,67,114,101,97,116,101,32,97,32,99,111,
+  110,115,116,97,110,116,32,110,97,109,101,100,32,115,50,44,
+  32,114,101,116,117,114,110,105,110,103,32,97,32,112,111,105,
+  110,116,101,114,32,116,111,32,115,49,46,32,84,104,105,115,
+  32,119,105,108,108,32,117,115,101,32,96,115,58,107,101,101,
+  112,96,32,116,111,32,112,114,101,115,101,114,118,101,32,116,
+  104,101,32,111,114,105,103,105,110,97,108,32,115,116,114,105,
+  110,103,46,0,0,82,101,116,117,114,110,32,96,84,82,85,
+  69,96,32,105,102,32,116,104,101,32,99,104,97,114,97,99,
+  116,101,114,32,105,115,32,112,114,101,115,101,110,116,32,105,
+  110,32,116,104,101,32,115,116,114,105,110,103,32,111,114,32,
+  96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,
+  101,46,0,0,82,101,116,117,114,110,32,96,84,82,85,69,
+  96,32,105,102,32,116,104,101,32,115,101,99,111,110,100,32,
+  115,116,114,105,110,103,32,105,115,32,112,114,101,115,101,110,
+  116,32,105,110,32,116,104,101,32,102,105,114,115,116,32,115,
+  116,114,105,110,103,32,111,114,32,96,70,65,76,83,69,96,
+  32,111,116,104,101,114,119,105,115,101,46,0,0,67,111,112,
+  121,32,97,32,115,116,114,105,110,103,32,40,115,41,32,116,
+  111,32,97,32,100,101,115,116,105,110,97,116,105,111,110,32,
+  40,97,41,46,32,84,104,105,115,32,119,105,108,108,32,105,
+  110,99,108,117,100,101,32,116,104,101,32,116,101,114,109,105,
+  110,97,116,111,114,32,99,104,97,114,97,99,116,101,114,32,
+  119,104,101,110,32,99,111,112,121,105,110,103,46,0,0,82,
+  101,116,117,114,110,32,97,32,100,101,100,117,112,108,105,99,
+  97,116,101,100,32,118,101,114,115,105,111,110,32,111,102,32,
+  116,104,101,32,115,116,114,105,110,103,46,0,0,86,97,114,
+  105,97,98,108,101,46,32,72,111,108,100,115,32,97,32,112,
+  111,105,110,116,101,114,32,116,111,32,116,104,101,32,100,101,
+  100,117,112,108,105,99,97,116,105,111,110,32,108,105,115,116,
+  46,0,0,67,104,101,99,107,32,116,111,32,115,101,101,32,
+  105,102,32,97,32,115,116,114,105,110,103,32,105,115,32,105,
+  110,32,116,104,101,32,100,101,100,117,112,108,105,99,97,116,
+  105,111,110,32,108,105,115,116,46,0,0,82,101,116,117,114,
+  110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,97,
+  32,100,101,100,117,112,108,105,99,97,116,101,100,32,99,111,
+  112,121,32,111,102,32,97,32,115,116,114,105,110,103,46,32,
+  73,102,32,116,104,101,32,115,116,114,105,110,103,32,105,115,
+  32,110,111,116,32,105,110,32,116,104,101,32,100,101,100,117,
+  112,108,105,99,97,116,105,111,110,32,108,105,115,116,44,32,
+  116,104,105,115,32,119,105,108,108,32,99,97,117,115,101,32,
+  101,114,114,111,114,115,46,0,0,65,100,100,32,97,32,115,
+  116,114,105,110,103,32,116,111,32,116,104,101,32,100,101,100,
+  117,112,108,105,99,97,116,105,111,110,32,108,105,115,116,46,
+  0,0,82,101,116,117,114,110,32,97,110,32,101,109,112,116,
+  121,32,115,116,114,105,110,103,46,0,0,82,101,116,117,114,
+  110,32,96,84,82,85,69,96,32,105,102,32,115,49,32,101,
+  110,100,115,32,119,105,116,104,32,115,50,32,111,114,32,96,
+  70,65,76,83,69,96,32,111,116,104,101,114,119,105,115,101,
+  46,0,0,67,111,109,112,97,114,101,32,116,119,111,32,115,
+  116,114,105,110,103,115,32,102,111,114,32,101,113,117,97,108,
+  105,116,121,46,32,82,101,116,117,114,110,32,96,84,82,85,
+  69,96,32,105,102,32,105,100,101,110,116,105,99,97,108,32,
+  111,114,32,96,70,65,76,83,69,96,32,105,102,32,110,111,
+  116,46,0,0,69,118,97,108,117,97,116,101,32,115,116,114,
+  105,110,103,32,97,115,32,105,102,32,105,116,32,119,97,115,
+  32,116,121,112,101,100,32,105,110,116,111,32,116,104,101,32,
+  105,110,116,101,114,112,114,101,116,101,114,46,0,0,70,101,
+  116,99,104,32,116,104,101,32,99,104,97,114,97,99,116,101,
+  114,32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,
+  116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+  105,110,100,101,120,32,105,110,32,116,104,101,32,115,116,114,
+  105,110,103,46,0,0,69,120,101,99,117,116,101,32,116,104,
+  101,32,113,117,111,116,101,32,111,110,99,101,32,102,111,114,
+  32,101,97,99,104,32,118,97,108,117,101,32,105,110,32,116,
+  104,101,32,115,116,114,105,110,103,46,32,73,102,32,116,104,
+  101,32,113,117,111,116,101,32,114,101,116,117,114,110,115,32,
+  96,84,82,85,69,96,44,32,97,112,112,101,110,100,32,116,
+  104,101,32,118,97,108,117,101,32,105,110,116,111,32,97,32,
+  110,101,119,32,115,116,114,105,110,103,46,32,73,102,32,96,
+  70,65,76,83,69,96,32,116,104,101,32,118,97,108,117,101,
+  32,119,105,108,108,32,98,101,32,100,105,115,99,97,114,100,
+  101,100,46,0,0,69,120,101,99,117,116,101,32,116,104,101,
+  32,113,117,111,116,101,32,111,110,99,101,32,102,111,114,32,
+  101,97,99,104,32,118,97,108,117,101,32,105,110,32,116,104,
+  101,32,115,116,114,105,110,103,46,0,0,67,111,110,115,116,
+  114,117,99,116,32,97,32,110,101,119,32,115,116,114,105,110,
+  103,32,117,115,105,110,103,32,116,104,101,32,116,101,109,112,
+  108,97,116,101,32,112,97,115,115,101,100,32,97,110,100,32,
+  105,116,101,109,115,32,102,114,111,109,32,116,104,101,32,115,
+  116,97,99,107,46,0,0,82,101,97,100,32,105,110,112,117,
+  116,32,102,114,111,109,32,115,116,97,110,100,97,114,100,32,
+  105,110,32,40,118,105,97,32,96,99,58,103,101,116,96,41,
+  32,117,110,116,105,108,32,97,32,119,104,105,116,101,115,112,
+  97,99,101,32,105,115,32,101,110,99,111,117,110,116,101,114,
+  101,100,46,32,82,101,116,117,114,110,115,32,97,32,115,116,
+  114,105,110,103,46,0,0,67,97,108,99,117,108,97,116,101,
+  32,97,32,104,97,115,104,32,118,97,108,117,101,32,102,111,
+  114,32,97,32,115,116,114,105,110,103,46,32,84,104,105,115,
+  32,117,115,101,115,32,116,104,101,32,100,106,98,50,32,97,
+  108,103,111,114,105,116,104,109,46,0,0,82,101,116,117,114,
+  110,32,116,104,101,32,108,111,99,97,116,105,111,110,32,111,
+  102,32,116,104,101,32,102,105,114,115,116,32,105,110,115,116,
+  97,110,99,101,32,111,102,32,116,104,101,32,115,112,101,99,
+  105,102,105,101,100,32,99,104,97,114,97,99,116,101,114,32,
+  105,110,32,116,104,101,32,115,116,114,105,110,103,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,108,111,99,97,116,
+  105,111,110,32,111,102,32,116,104,101,32,102,105,114,115,116,
+  32,105,110,115,116,97,110,99,101,32,111,102,32,116,104,101,
+  32,115,112,101,99,105,102,105,101,100,32,115,117,98,115,116,
+  114,105,110,103,32,40,115,50,41,32,105,110,32,116,104,101,
+  32,115,116,114,105,110,103,32,40,115,49,41,46,32,82,101,
+  116,117,114,110,115,32,45,49,32,105,102,32,110,111,116,32,
+  102,111,117,110,100,46,0,0,83,116,111,114,101,32,97,32,
+  115,116,114,105,110,103,32,105,110,116,111,32,116,104,101,32,
+  104,101,97,112,32,97,110,100,32,114,101,116,117,114,110,32,
+  97,32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,
+  32,115,116,97,114,116,32,111,102,32,105,116,46,0,0,82,
+  101,116,117,114,110,32,97,32,110,101,119,32,115,116,114,105,
+  110,103,32,99,111,110,116,97,105,110,105,110,103,32,116,104,
+  101,32,102,105,114,115,116,32,96,110,96,32,99,104,97,114,
+  97,99,116,101,114,115,32,102,114,111,109,32,116,104,101,32,
+  115,111,117,114,99,101,32,115,116,114,105,110,103,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,110,117,109,98,101,
+  114,32,111,102,32,99,104,97,114,97,99,116,101,114,115,32,
+  105,110,32,97,32,115,116,114,105,110,103,44,32,101,120,99,
+  108,117,100,105,110,103,32,116,104,101,32,78,85,76,76,32,
+  116,101,114,109,105,110,97,116,111,114,46,0,0,69,120,101,
+  99,117,116,101,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,113,117,111,116,101,32,111,110,99,101,32,102,111,
+  114,32,101,97,99,104,32,99,104,97,114,97,99,116,101,114,
+  32,105,110,32,116,104,101,32,115,116,114,105,110,103,46,32,
+  66,117,105,108,100,115,32,97,32,110,101,119,32,115,116,114,
+  105,110,103,32,102,114,111,109,32,116,104,101,32,114,101,116,
+  117,114,110,32,118,97,108,117,101,32,111,102,32,116,104,101,
+  32,113,117,111,116,101,46,32,84,104,101,32,113,117,111,116,
+  101,32,115,104,111,117,108,100,32,114,101,116,117,114,110,32,
+  111,110,108,121,32,111,110,101,32,118,97,108,117,101,46,0,
+  0,82,101,116,117,114,110,32,97,32,110,101,119,32,115,116,
+  114,105,110,103,32,99,111,110,115,105,115,116,105,110,103,32,
+  111,102,32,115,50,32,102,111,108,108,111,119,101,100,32,98,
+  121,32,115,49,46,0,0,68,105,115,112,108,97,121,32,97,
+  32,115,116,114,105,110,103,46,0,0,82,101,112,108,97,99,
+  101,32,116,104,101,32,102,105,114,115,116,32,105,110,115,116,
+  97,110,99,101,32,111,102,32,115,50,32,105,110,32,115,49,
+  32,119,105,116,104,32,115,51,46,0,0,82,101,112,108,97,
+  99,101,32,97,108,108,32,105,110,115,116,97,110,99,101,115,
+  32,111,102,32,115,50,32,105,110,32,115,49,32,119,105,116,
+  104,32,115,51,46,0,0,82,101,118,101,114,115,101,32,116,
+  104,101,32,111,114,100,101,114,32,111,102,32,65,83,67,73,
+  73,32,99,104,97,114,97,99,116,101,114,115,32,105,110,32,
+  97,32,115,116,114,105,110,103,46,0,0,82,101,116,117,114,
+  110,32,97,32,110,101,119,32,115,116,114,105,110,103,32,99,
+  111,110,116,97,105,110,105,110,103,32,116,104,101,32,115,112,
+  101,99,105,102,105,101,100,32,110,117,109,98,101,114,32,111,
+  102,32,99,104,97,114,97,99,116,101,114,115,32,102,114,111,
+  109,32,116,104,101,32,114,105,103,104,116,32,115,105,100,101,
+  32,111,102,32,116,104,101,32,115,116,114,105,110,103,46,0,
+  0,73,110,116,101,114,110,97,108,32,104,101,108,112,101,114,
+  32,102,117,110,99,116,105,111,110,32,117,115,101,100,32,116,
+  111,32,115,107,105,112,32,111,118,101,114,32,97,32,115,116,
+  114,105,110,103,32,105,110,32,97,32,100,101,102,105,110,105,
+  116,105,111,110,46,0,0,83,112,108,105,116,32,97,32,115,
+  116,114,105,110,103,32,111,110,32,116,104,101,32,102,105,114,
+  115,116,32,111,99,99,117,114,114,101,110,99,101,32,111,102,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,99,
+  104,97,114,97,99,116,101,114,46,0,0,83,112,108,105,116,
+  32,97,32,115,116,114,105,110,103,32,111,110,32,116,104,101,
+  32,102,105,114,115,116,32,111,99,99,117,114,114,101,110,99,
+  101,32,111,102,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,115,116,114,105,110,103,46,32,65,102,116,101,114,
+  32,116,104,101,32,115,112,108,105,116,44,32,116,104,101,32,
+  116,111,112,32,115,116,97,99,107,32,105,116,101,109,32,119,
+  105,108,108,32,98,101,32,116,104,101,32,112,97,114,116,32,
+  111,102,32,116,104,101,32,115,116,114,105,110,103,32,98,101,
+  102,111,114,101,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,115,117,98,115,116,114,105,110,103,44,32,97,110,
+  100,32,116,104,101,32,115,101,99,111,110,100,32,105,116,101,
+  109,32,119,105,108,108,32,98,101,32,116,104,101,32,114,101,
+  115,116,32,111,102,32,116,104,101,32,111,114,105,103,105,110,
+  97,108,32,115,116,114,105,110,103,46,0,0,83,116,111,114,
+  101,32,97,32,99,104,97,114,97,99,116,101,114,32,118,97,
+  108,117,101,32,105,110,116,111,32,116,104,101,32,115,116,114,
+  105,110,103,32,97,116,32,116,104,101,32,115,112,101,99,105,
+  102,105,101,100,32,105,110,100,101,120,46,0,0,69,120,116,
+  114,97,99,116,32,97,32,115,117,98,115,116,114,105,110,103,
+  32,102,114,111,109,32,116,104,101,32,115,112,101,99,105,102,
+  105,101,100,32,115,116,114,105,110,103,46,32,84,104,105,115,
+  32,119,105,108,108,32,116,97,107,101,32,116,104,101,32,99,
+  104,97,114,97,99,116,101,114,115,32,115,116,97,114,116,105,
+  110,103,32,97,116,32,96,102,96,32,97,110,100,32,101,120,
+  116,101,110,100,32,96,108,96,32,99,104,97,114,97,99,116,
+  101,114,115,32,105,110,32,108,101,110,103,116,104,46,0,0,
+  77,111,118,101,32,97,32,115,116,114,105,110,103,32,105,110,
+  116,111,32,116,104,101,32,116,101,109,112,111,114,97,114,121,
+  32,115,116,114,105,110,103,32,98,117,102,102,101,114,115,46,
+  0,0,67,111,110,118,101,114,116,32,97,32,115,116,114,105,
+  110,103,32,114,101,112,114,101,115,101,110,116,97,116,105,111,
+  110,32,105,110,116,111,32,97,32,102,108,111,97,116,105,110,
+  103,45,112,111,105,110,116,32,118,97,108,117,101,46,0,0,
+  67,111,110,118,101,114,116,32,117,112,112,101,114,99,97,115,
+  101,32,65,83,67,73,73,32,99,104,97,114,97,99,116,101,
+  114,115,32,105,110,32,97,32,115,116,114,105,110,103,32,116,
+  111,32,108,111,119,101,114,99,97,115,101,46,0,0,67,111,
+  110,118,101,114,116,32,97,32,115,116,114,105,110,103,32,116,
+  111,32,97,32,110,117,109,98,101,114,46,0,0,67,111,110,
+  118,101,114,116,32,108,111,119,101,114,99,97,115,101,32,65,
+  83,67,73,73,32,99,104,97,114,97,99,116,101,114,115,32,
+  105,110,32,97,32,115,116,114,105,110,103,32,116,111,32,117,
+  112,112,101,114,99,97,115,101,46,0,0,84,97,107,101,115,
+  32,97,32,115,116,114,105,110,103,32,97,110,100,32,97,32,
+  99,104,97,114,97,99,116,101,114,32,116,111,32,117,115,101,
+  32,97,115,32,97,32,115,101,112,97,114,97,116,111,114,46,
+  32,73,116,32,115,112,108,105,116,115,32,116,104,101,32,115,
+  116,114,105,110,103,32,105,110,116,111,32,115,117,98,115,116,
+  114,105,110,103,115,32,97,110,100,32,114,101,116,117,114,110,
+  115,32,97,110,32,97,114,114,97,121,32,99,111,110,116,97,
+  105,110,105,110,103,32,112,111,105,110,116,101,114,115,32,116,
+  111,32,101,97,99,104,32,111,102,32,116,104,101,109,46,0,
+  0,84,97,107,101,115,32,97,32,115,116,114,105,110,103,32,
+  40,115,49,41,32,97,110,100,32,97,32,115,117,98,115,116,
+  114,105,110,103,32,40,115,50,41,32,32,117,115,101,32,97,
+  115,32,97,32,115,101,112,97,114,97,116,111,114,46,32,73,
+  116,32,115,112,108,105,116,115,32,116,104,101,32,115,116,114,
+  105,110,103,32,105,110,116,111,32,115,117,98,115,116,114,105,
+  110,103,115,32,97,110,100,32,114,101,116,117,114,110,115,32,
+  97,115,32,97,114,114,97,121,32,99,111,110,116,97,105,110,
+  105,110,103,32,112,111,105,110,116,101,114,115,32,116,111,32,
+  101,97,99,104,32,111,102,32,116,104,101,109,46,0,0,84,
+  114,105,109,32,108,101,97,100,105,110,103,32,97,110,100,32,
+  116,114,97,105,108,105,110,103,32,119,104,105,116,101,115,112,
+  97,99,101,32,102,114,111,109,32,97,32,115,116,114,105,110,
+  103,46,0,0,84,114,105,109,32,108,101,97,100,105,110,103,
+  32,119,104,105,116,101,115,112,97,99,101,32,102,114,111,109,
+  32,97,32,115,116,114,105,110,103,46,0,0,84,114,105,109,
+  32,116,114,97,105,108,105,110,103,32,119,104,105,116,101,115,
+  112,97,99,101,32,102,114,111,109,32,97,32,115,116,114,105,
+  110,103,46,0,0,65,108,105,97,115,32,102,111,114,32,96,
+  115,58,100,101,100,117,112,46,100,101,102,105,110,101,100,63,
+  96,46,0,0,68,105,115,99,97,114,100,32,114,101,109,97,
+  105,110,105,110,103,32,116,111,107,101,110,115,32,111,110,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,108,105,110,101,
+  32,98,101,105,110,103,32,101,118,97,108,117,97,116,101,100,
+  46,32,84,104,105,115,32,111,110,108,121,32,119,111,114,107,
+  115,32,119,104,101,110,32,105,110,99,108,117,100,105,110,103,
+  32,97,32,102,105,108,101,44,32,110,111,116,32,97,116,32,
+  116,104,101,32,105,110,116,101,114,112,114,101,116,101,114,46,
+  0,0,82,101,116,117,114,110,32,116,104,101,32,110,117,109,
+  98,101,114,32,111,102,32,97,114,103,117,109,101,110,116,115,
+  32,112,97,115,115,101,100,32,116,111,32,116,104,101,32,112,
+  114,111,103,114,97,109,46,0,0,76,111,111,107,32,117,112,
+  32,97,32,119,111,114,100,32,105,110,32,116,104,101,32,97,
+  117,116,111,108,111,97,100,32,105,110,100,101,120,101,115,46,
+  32,73,102,32,102,111,117,110,100,44,32,97,110,100,32,105,
+  116,115,32,102,105,108,101,32,104,97,115,32,110,111,116,32,
+  98,101,101,110,32,105,110,99,108,117,100,101,100,44,32,105,
+  110,99,108,117,100,101,32,105,116,32,97,110,100,32,114,101,
+  116,117,114,110,32,84,82,85,69,46,32,79,116,104,101,114,
+  119,105,115,101,32,114,101,116,117,114,110,32,70,65,76,83,
+  69,46,0,0,82,101,97,100,32,97,110,32,97,117,116,111,
+  108,111,97,100,32,105,110,100,101,120,44,32,97,100,100,105,
+  110,103,32,116,104,101,32,119,111,114,100,115,32,105,110,32,
+  105,116,32,116,111,32,116,104,111,115,101,32,116,104,97,116,
+  32,99,97,110,32,98,101,32,97,117,116,111,108,111,97,100,
+  101,100,46,32,82,101,116,117,114,110,115,32,70,65,76,83,
+  69,32,105,102,32,116,104,101,32,102,105,108,101,32,99,111,
+  117,108,100,32,110,111,116,32,98,101,32,114,101,97,100,46,
+  0,0,82,101,116,117,114,110,32,116,104,101,32,102,105,108,
+  101,110,97,109,101,32,111,102,32,116,104,101,32,102,105,108,
+  101,32,98,101,105,110,103,32,112,114,111,99,101,115,115,101,
+  100,32,98,121,32,116,104,101,32,99,117,114,114,101,110,116,
+  32,96,105,110,99,108,117,100,101,96,44,32,111,114,32,96,
+  47,100,101,118,47,115,116,100,105,110,96,32,105,102,32,116,
+  104,101,32,105,110,112,117,116,32,115,111,117,114,99,101,32,
+  105,115,32,116,104,101,32,116,101,114,109,105,110,97,108,46,
+  0,0,82,101,116,117,114,110,32,116,104,101,32,99,117,114,
+  114,101,110,116,32,108,105,110,101,32,110,117,109,98,101,114,
+  32,111,102,32,116,104,101,32,102,105,108,101,32,98,101,105,
+  110,103,32,112,114,111,99,101,115,115,101,100,32,98,121,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,96,105,110,99,
+  108,117,100,101,96,44,32,111,114,32,96,48,96,32,105,102,
+  32,116,104,101,32,105,110,112,117,116,32,115,111,117,114,99,
+  101,32,105,115,32,116,104,101,32,116,101,114,109,105,110,97,
+  108,46,32,76,105,110,101,32,110,117,109,98,101,114,105,110,
+  103,32,115,116,97,114,116,115,32,97,116,32,49,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,116,101,120,116,32,
+  111,102,32,116,104,101,32,99,117,114,114,101,110,116,32,108,
+  105,110,101,32,98,101,105,110,103,32,112,114,111,99,101,115,
+  115,101,100,32,98,121,32,116,104,101,32,99,117,114,114,101,
+  110,116,32,96,105,110,99,108,117,100,101,96,46,0,0,71,
+  105,118,101,110,32,97,110,32,97,114,103,117,109,101,110,116,
+  32,110,117,109,98,101,114,44,32,114,101,116,117,114,110,32,
+  116,104,101,32,97,114,103,117,109,101,110,116,32,97,115,32,
+  97,32,115,116,114,105,110,103,46,0,0,68,105,115,99,97,
+  114,100,32,114,101,109,97,105,110,105,110,103,32,116,111,107,
+  101,110,115,32,105,110,32,116,104,101,32,99,117,114,114,101,
+  110,116,32,108,105,110,101,46,32,84,104,105,115,32,111,110,
+  108,121,32,119,111,114,107,115,32,119,104,101,110,32,105,110,
+  99,108,117,100,105,110,103,32,97,32,102,105,108,101,44,32,
+  110,111,116,32,97,116,32,116,104,101,32,105,110,116,101,114,
+  112,114,101,116,101,114,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,102,105,108,101,110,97,109,101,32,111,102,32,
+  116,104,101,32,112,114,111,103,114,97,109,32,98,101,105,110,
+  103,32,114,117,110,46,0,0,80,97,116,99,104,32,116,104,
+  101,32,104,111,111,107,32,112,111,105,110,116,32,105,110,32,
+  97,50,32,116,111,32,112,111,105,110,116,32,116,111,32,97,
+  49,46,0,0,80,101,102,111,114,109,32,97,32,98,105,116,
+  119,105,115,101,32,115,104,105,102,116,32,111,102,32,109,32,
+  98,121,32,110,32,98,105,116,115,46,32,73,102,32,110,32,
+  105,115,32,112,111,115,105,116,105,118,101,44,32,115,104,105,
+  102,116,32,114,105,103,104,116,46,32,73,102,32,110,101,103,
+  97,116,105,118,101,44,32,116,104,101,32,115,104,105,102,116,
+  32,119,105,108,108,32,98,101,32,116,111,32,116,104,101,32,
+  108,101,102,116,46,0,0,83,104,105,102,116,32,109,32,108,
+  101,102,116,32,98,121,32,110,32,98,105,116,115,46,0,0,
+  83,104,105,102,116,32,109,32,114,105,103,104,116,32,98,121,
+  32,110,32,98,105,116,115,46,0,0,83,116,111,114,101,32,
+  97,32,118,97,108,117,101,32,105,110,116,111,32,97,32,118,
+  97,114,105,97,98,108,101,46,0,0,80,114,111,99,101,115,
+  115,32,116,111,107,101,110,32,97,115,32,97,32,110,117,109,
+  98,101,114,46,0,0,80,114,111,99,101,115,115,32,116,111,
+  107,101,110,32,97,115,32,97,110,32,65,83,67,73,73,32,
+  99,104,97,114,97,99,116,101,114,46,0,0,82,101,116,117,
+  114,110,32,97,32,112,111,105,110,116,101,114,32,116,111,32,
+  97,32,110,97,109,101,100,32,105,116,101,109,46,32,73,102,
+  32,110,97,109,101,32,105,115,32,110,111,116,32,102,111,117,
+  110,100,44,32,114,101,116,117,114,110,115,32,48,46,0,0,
+  80,114,111,99,101,115,115,32,116,111,107,101,110,32,97,115,
+  32,97,32,115,116,114,105,110,103,46,0,0,80,114,111,99,
+  101,115,115,32,116,111,107,101,110,32,97,115,32,97,32,99,
+  111,109,109,101,110,116,46,0,0,73,110,116,101,114,112,114,
+  101,116,32,116,105,109,101,58,32,99,111,110,118,101,114,116,
+  32,115,116,114,105,110,103,32,116,111,32,97,32,102,108,111,
+  97,116,105,110,103,45,112,111,105,110,116,32,118,97,108,117,
+  101,46,32,67,111,109,112,105,108,101,32,116,105,109,101,58,
+  32,99,111,110,118,101,114,116,32,115,116,114,105,110,103,32,
+  116,111,32,97,32,102,108,111,97,116,105,110,103,45,112,111,
+  105,110,116,32,118,97,108,117,101,32,97,110,100,32,99,111,
+  109,112,105,108,101,32,99,111,100,101,32,116,111,32,112,117,
+  115,104,32,116,104,105,115,32,118,97,108,117,101,32,116,111,
+  32,116,104,101,32,102,108,111,97,116,32,115,116,97,99,107,
+  46,0,0,72,111,111,107,46,32,80,114,111,99,101,115,115,
+  32,116,111,107,101,110,32,97,115,32,97,32,110,101,119,32,
+  100,101,102,105,110,105,116,105,111,110,46,0,0,70,101,116,
+  99,104,32,102,114,111,109,32,97,32,115,116,111,114,101,100,
+  32,118,97,114,105,97,98,108,101,46,0,0,80,114,111,99,
+  101,115,115,32,116,111,107,101,110,32,97,115,32,97,110,32,
+  105,110,115,116,114,117,99,116,105,111,110,32,98,117,110,100,
+  108,101,46,0,0,80,114,111,99,101,115,115,32,116,111,107,
+  101,110,32,97,115,32,97,32,102,117,110,99,116,105,111,110,
+  32,114,101,102,101,114,101,110,99,101,46,0,0,80,114,111,
+  99,101,115,115,32,116,111,107,101,110,32,97,115,32,97,32,
+  98,121,116,101,99,111,100,101,46,0,0,80,79,83,84,80,
+  79,78,69,32,101,113,117,105,118,97,108,101,110,116,46,0,
+  0,82,117,110,32,113,117,111,116,101,46,32,65,102,116,101,
+  114,32,101,120,101,99,117,116,105,111,110,32,99,111,109,112,
+  108,101,116,101,115,44,32,112,117,116,32,97,32,99,111,112,
+  121,32,111,102,32,110,32,98,97,99,107,32,111,110,32,116,
+  111,112,32,111,102,32,116,104,101,32,115,116,97,99,107,46,
+  0,0,66,101,103,105,110,32,97,99,99,101,112,116,105,110,
+  103,32,99,111,110,110,101,99,116,105,111,110,115,46,32,82,
+  101,116,117,114,110,115,32,97,32,110,101,119,32,115,111,99,
+  107,101,116,32,97,110,100,32,97,110,32,101,114,114,111,114,
+  32,99,111,100,101,46,0,0,66,105,110,100,32,97,32,115,
+  111,99,107,101,116,32,116,111,32,97,32,112,111,114,116,46,
+  32,84,104,101,32,112,111,114,116,32,115,104,111,117,108,100,
+  32,98,101,32,97,32,115,116,114,105,110,103,46,32,82,101,
+  116,117,114,110,115,32,48,32,105,102,32,115,117,99,99,101,
+  115,115,102,117,108,32,111,114,32,45,49,32,111,116,104,101,
+  114,119,105,115,101,32,97,110,100,32,97,110,32,101,114,114,
+  111,114,32,99,111,100,101,46,0,0,67,108,111,115,101,32,
+  97,32,115,111,99,107,101,116,46,0,0,67,111,110,102,105,
+  103,117,114,101,32,105,110,116,101,114,110,97,108,32,115,101,
+  116,116,105,110,103,115,32,102,111,114,32,97,32,104,111,115,
+  116,32,40,115,49,41,32,97,110,100,32,112,111,114,116,32,
+  40,115,50,41,46,32,85,115,101,32,98,101,102,111,114,101,
+  32,96,115,111,99,107,101,116,58,98,105,110,100,96,46,0,
+  0,67,111,110,110,101,99,116,32,116,111,32,97,32,115,101,
+  114,118,101,114,46,32,80,114,111,118,105,100,101,32,97,32,
+  115,111,99,107,101,116,44,32,116,104,105,115,32,119,105,108,
+  108,32,114,101,116,117,114,110,32,97,32,115,116,97,116,117,
+  115,32,102,108,97,103,32,97,110,100,32,97,110,32,101,114,
+  114,111,114,32,99,111,100,101,46,0,0,79,98,116,97,105,
+  110,32,97,32,110,101,119,32,115,111,99,107,101,116,46,0,
+  0,71,101,116,32,116,104,101,32,104,111,115,116,32,73,80,
+  32,105,110,32,100,111,116,116,101,100,32,110,111,116,97,116,
+  105,111,110,46,32,84,104,101,32,104,111,115,116,32,105,115,
+  32,115,112,101,99,105,102,105,101,100,32,98,121,32,116,104,
+  101,32,115,116,114,105,110,103,32,97,110,100,32,116,104,101,
+  32,97,100,100,114,101,115,115,32,105,115,32,116,104,101,32,
+  115,116,97,114,116,32,111,102,32,116,104,101,32,98,117,102,
+  102,101,114,32,102,111,114,32,116,104,101,32,100,111,116,116,
+  101,100,32,73,80,46,0,0,80,114,101,112,97,114,101,32,
+  97,32,115,111,99,107,101,116,32,102,111,114,32,97,99,99,
+  101,112,116,105,110,103,32,105,110,99,111,109,105,110,103,32,
+  99,111,110,110,101,99,116,105,111,110,115,46,32,84,97,107,
+  101,115,32,97,32,98,97,99,107,108,111,103,32,99,111,117,
+  110,116,32,40,110,49,41,32,97,110,100,32,97,32,115,111,
+  99,107,101,116,32,40,110,50,41,46,32,82,101,116,117,114,
+  110,115,32,97,32,102,108,97,103,32,40,48,32,115,117,99,
+  99,101,115,115,44,32,45,49,32,102,97,105,108,101,100,41,
+  32,97,110,100,32,97,110,32,101,114,114,111,114,32,99,111,
+  100,101,46,0,0,84,114,105,103,103,101,114,32,97,32,115,
+  111,99,107,101,116,32,111,112,101,114,97,116,105,111,110,46,
+  32,84,104,105,115,32,105,115,32,110,111,116,32,105,110,116,
+  101,110,100,101,100,32,116,111,32,98,101,32,117,115,101,100,
+  32,100,105,114,101,99,116,108,121,46,0,0,82,101,99,101,
+  105,118,101,32,100,97,116,97,32,102,114,111,109,32,97,32,
+  115,111,99,107,101,116,46,32,84,104,105,115,32,119,105,108,
+  108,32,114,101,97,100,32,105,110,116,111,32,109,101,109,111,
+  114,121,32,115,116,97,114,116,105,110,103,32,97,116,32,97,
+  100,100,114,101,115,115,32,42,97,42,44,32,117,112,32,116,
+  111,32,42,110,49,42,32,98,121,116,101,115,46,32,42,110,
+  50,42,32,105,115,32,116,104,101,32,115,111,99,107,101,116,
+  46,32,82,101,116,117,114,110,115,32,116,104,101,32,110,117,
+  109,98,101,114,32,111,102,32,98,121,116,101,115,32,114,101,
+  97,100,32,97,110,100,32,97,110,32,101,114,114,111,114,32,
+  99,111,100,101,46,0,0,83,101,110,100,32,97,32,115,116,
+  114,105,110,103,32,116,111,32,97,32,115,111,99,107,101,116,
+  46,32,84,104,105,115,32,119,105,108,108,32,114,101,116,117,
+  114,110,32,116,104,101,32,110,117,109,98,101,114,32,111,102,
+  32,99,104,97,114,97,99,116,101,114,115,32,115,101,110,116,
+  32,97,110,100,32,97,110,32,101,114,114,111,114,32,99,111,
+  100,101,46,0,0,68,105,115,112,108,97,121,32,97,32,115,
+  112,97,99,101,32,40,96,65,83,67,73,73,58,83,80,65,
+  67,69,96,41,0,0,83,116,111,114,101,32,97,32,118,97,
+  108,117,101,32,105,110,116,111,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,97,100,100,114,101,115,115,46,0,
+  0,83,116,111,114,101,32,97,32,118,97,108,117,101,32,105,
+  110,116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,97,100,100,114,101,115,115,32,97,110,100,32,114,101,
+  116,117,114,110,32,116,104,101,32,110,101,120,116,32,97,100,
+  100,114,101,115,115,46,0,0,69,120,99,104,97,110,103,101,
+  32,116,104,101,32,112,111,115,105,116,105,111,110,32,111,102,
+  32,116,104,101,32,116,111,112,32,116,119,111,32,105,116,101,
+  109,115,32,111,110,32,116,104,101,32,115,116,97,99,107,0,
+  0,68,105,115,112,108,97,121,32,97,32,116,97,98,32,40,
+  96,65,83,67,73,73,58,72,84,96,41,0,0,67,111,110,
+  118,101,114,116,32,97,32,99,97,108,108,32,98,101,102,111,
+  114,101,32,116,104,101,32,115,101,109,105,99,111,108,111,110,
+  32,116,111,32,97,32,106,117,109,112,46,0,0,82,117,110,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,113,
+  117,111,116,101,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,110,117,109,98,101,114,32,111,102,32,116,105,109,
+  101,115,46,0,0,65,112,112,108,121,32,113,49,32,97,103,
+  97,105,110,115,116,32,120,44,32,116,104,101,110,32,113,50,
+  32,97,103,97,105,110,115,116,32,97,32,99,111,112,121,32,
+  111,102,32,120,44,32,97,110,100,32,102,105,110,97,108,108,
+  121,32,113,51,32,97,103,97,105,110,115,116,32,97,110,111,
+  116,104,101,114,32,99,111,112,121,32,111,102,32,120,46,0,
+  0,65,112,112,108,121,32,113,49,32,97,103,97,105,110,115,
+  116,32,120,44,32,113,50,32,97,103,97,105,110,115,116,32,
+  121,44,32,97,110,100,32,113,51,32,97,103,97,105,110,115,
+  116,32,122,46,0,0,65,112,112,108,121,32,113,32,97,103,
+  97,105,110,115,116,32,120,44,32,116,104,101,110,32,97,103,
+  97,105,110,115,116,32,121,44,32,97,110,100,32,102,105,110,
+  97,108,108,121,32,97,103,97,105,110,115,116,32,122,46,0,
+  0,80,117,116,32,97,32,99,111,112,121,32,111,102,32,116,
+  104,101,32,116,111,112,32,105,116,101,109,32,111,110,32,116,
+  104,101,32,115,116,97,99,107,32,117,110,100,101,114,32,116,
+  104,101,32,115,101,99,111,110,100,32,111,110,101,46,0,0,
+  82,101,115,101,116,32,116,104,101,32,104,111,111,107,32,112,
+  111,105,110,116,32,105,110,32,97,49,32,116,111,32,116,104,
+  101,32,100,101,102,97,117,108,116,32,100,101,102,105,110,105,
+  116,105,111,110,46,0,0,67,104,97,110,103,101,32,116,104,
+  101,32,99,117,114,114,101,110,116,32,119,111,114,107,105,110,
+  103,32,100,105,114,101,99,116,111,114,121,32,116,111,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,111,110,101,
+  46,0,0,82,101,116,117,114,110,32,116,104,101,32,110,117,
+  109,98,101,114,32,111,102,32,102,105,108,101,115,32,40,97,
+  110,100,32,115,117,98,100,105,114,101,99,116,111,114,105,101,
+  115,41,32,105,110,32,116,104,101,32,99,117,114,114,101,110,
+  116,32,119,111,114,107,105,110,103,32,100,105,114,101,99,116,
+  111,114,121,0,0,69,120,101,99,117,116,101,32,97,32,112,
+  114,111,99,101,115,115,32,98,121,32,114,117,110,110,105,110,
+  103,32,116,104,101,32,97,112,112,108,105,99,97,116,105,111,
+  110,32,115,112,101,99,105,102,105,101,100,32,98,121,32,115,
+  46,0,0,69,120,101,99,117,116,101,32,97,32,112,114,111,
+  99,101,115,115,32,98,121,32,114,117,110,110,105,110,103,32,
+  116,104,101,32,97,112,112,108,105,99,97,116,105,111,110,32,
+  115,112,101,99,105,102,105,101,100,32,98,121,32,115,49,46,
+  32,80,97,115,115,32,115,50,32,97,115,32,97,110,32,97,
+  114,103,117,109,101,110,116,46,0,0,69,120,101,99,117,116,
+  101,32,97,32,112,114,111,99,101,115,115,32,98,121,32,114,
+  117,110,110,105,110,103,32,116,104,101,32,97,112,112,108,105,
+  99,97,116,105,111,110,32,115,112,101,99,105,102,105,101,100,
+  32,98,121,32,115,49,46,32,80,97,115,115,32,115,50,32,
+  97,110,100,32,115,51,32,97,115,32,97,114,103,117,109,101,
+  110,116,115,46,0,0,69,120,101,99,117,116,101,32,97,32,
+  112,114,111,99,101,115,115,32,98,121,32,114,117,110,110,105,
+  110,103,32,116,104,101,32,97,112,112,108,105,99,97,116,105,
+  111,110,32,115,112,101,99,105,102,105,101,100,32,98,121,32,
+  115,49,46,32,80,97,115,115,32,115,50,44,32,115,51,44,
+  32,97,110,100,32,115,52,32,97,115,32,97,114,103,117,109,
+  101,110,116,115,46,0,0,82,117,110,115,32,97,110,111,116,
+  104,101,114,32,97,112,112,108,105,99,97,116,105,111,110,32,
+  97,110,100,32,114,101,116,117,114,110,32,97,102,116,101,114,
+  32,101,120,101,99,117,116,105,111,110,32,105,115,32,99,111,
+  109,112,108,101,116,101,100,46,32,84,104,105,115,32,100,111,
+  101,115,32,110,111,116,32,105,110,118,111,107,101,32,116,104,
+  101,32,115,104,101,108,108,32,108,105,107,101,32,96,117,110,
+  105,120,58,115,121,115,116,101,109,96,32,97,110,100,32,100,
+  111,101,115,32,110,111,116,32,115,117,112,112,111,114,116,32,
+  103,108,111,98,98,105,110,103,46,0,0,69,120,105,116,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,112,114,111,99,
+  101,115,115,44,32,114,101,116,117,114,110,105,110,103,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,114,101,116,
+  117,114,110,32,99,111,100,101,46,0,0,82,117,110,32,97,
+  32,113,117,111,116,101,32,111,110,99,101,32,102,111,114,32,
+  101,97,99,104,32,102,105,108,101,32,111,114,32,115,117,98,
+  100,105,114,101,99,116,111,114,121,32,105,110,32,116,104,101,
+  32,99,117,114,114,101,110,116,32,100,105,114,101,99,116,111,
+  114,121,46,32,84,104,101,32,113,117,111,116,101,32,119,105,
+  108,108,32,114,101,99,101,105,118,101,32,116,104,101,32,102,
+  105,108,101,32,110,97,109,101,32,97,115,32,97,32,115,116,
+  114,105,110,103,32,97,110,100,32,115,104,111,117,108,100,32,
+  99,111,110,115,117,109,101,32,116,104,105,115,32,97,110,100,
+  32,114,101,116,117,114,110,32,110,111,116,104,105,110,103,32,
+  111,110,32,116,104,101,32,115,116,97,99,107,46,0,0,70,
+  111,114,107,32,116,104,101,32,99,117,114,114,101,110,116,32,
+  112,114,111,99,101,115,115,46,32,82,101,116,117,114,110,115,
+  32,97,32,80,73,68,46,0,0,82,101,116,117,114,110,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,119,111,114,107,
+  105,110,103,32,100,105,114,101,99,116,111,114,121,0,0,71,
+  101,116,32,97,110,32,101,110,118,105,114,111,110,109,101,110,
+  116,32,118,97,114,105,97,98,108,101,46,32,80,114,111,118,
+  105,100,101,32,116,104,101,32,110,97,109,101,32,97,110,100,
+  32,97,110,32,97,100,100,114,101,115,115,32,116,111,32,115,
+  116,111,114,101,32,105,116,32,105,110,46,0,0,82,101,116,
+  117,114,110,32,116,104,101,32,80,73,68,32,111,102,32,116,
+  104,101,32,99,117,114,114,101,110,116,32,112,114,111,99,101,
+  115,115,46,0,0,84,101,114,109,105,110,97,116,101,115,32,
+  97,32,112,114,111,99,101,115,115,46,32,84,97,107,101,115,
+  32,97,32,112,114,111,99,101,115,115,32,97,110,100,32,97,
+  32,115,105,103,110,97,108,32,116,111,32,115,101,110,100,46,
+  0,0,67,108,111,115,101,32,97,32,112,105,112,101,46,0,
+  0,84,97,107,101,115,32,97,32,115,116,114,105,110,103,32,
+  119,105,116,104,32,97,32,85,110,105,120,32,99,111,109,109,
+  97,110,100,32,108,105,110,101,32,97,110,100,32,114,117,110,
+  32,105,116,32,105,110,32,97,32,112,105,112,101,44,32,114,
+  101,116,117,114,110,105,110,103,32,97,32,110,101,119,32,115,
+  116,114,105,110,103,32,119,105,116,104,32,116,104,101,32,102,
+  105,114,115,116,32,108,105,110,101,32,111,102,32,116,104,101,
+  32,111,117,116,112,117,116,32,102,114,111,109,32,116,104,101,
+  32,112,105,112,101,46,0,0,79,112,101,110,32,97,32,112,
+  105,112,101,46,32,84,97,107,101,115,32,97,32,99,111,109,
+  109,97,110,100,32,116,111,32,114,117,110,44,32,97,110,100,
+  32,97,32,102,105,108,101,32,109,111,100,101,32,40,96,102,
+  105,108,101,58,82,96,32,111,114,32,96,102,105,108,101,58,
+  87,96,59,32,96,102,105,108,101,58,82,43,96,32,109,97,
+  121,32,119,111,114,107,32,111,110,32,115,111,109,101,32,115,
+  121,115,116,101,109,115,41,46,32,82,101,116,117,114,110,115,
+  32,97,32,102,105,108,101,32,73,68,32,117,115,97,98,108,
+  101,32,119,105,116,104,32,119,111,114,100,115,32,105,110,32,
+  116,104,101,32,96,102,105,108,101,58,96,32,110,97,109,101,
+  115,112,97,99,101,46,0,0,84,97,107,101,115,32,97,32,
+  115,116,114,105,110,103,32,105,110,32,116,104,101,32,102,111,
+  114,109,32,96,110,97,109,101,61,118,97,108,117,101,96,32,
+  97,110,100,32,115,101,116,115,32,97,110,32,101,110,118,105,
+  114,111,110,109,101,110,116,32,118,97,114,105,97,98,108,101,
+  32,110,97,109,101,100,32,96,110,97,109,101,96,32,116,111,
+  32,96,118,97,108,117,101,96,46,0,0,83,108,101,101,112,
+  32,102,111,114,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,110,117,109,98,101,114,32,111,102,32,115,101,99,
+  111,110,100,115,46,0,0,79,112,101,110,32,97,32,112,105,
+  112,101,46,32,82,101,97,100,32,97,108,108,32,111,117,116,
+  112,117,116,32,102,114,111,109,32,116,104,101,32,112,105,112,
+  101,32,40,117,110,116,105,108,32,65,83,67,73,73,58,78,
+  85,76,76,41,32,97,110,100,32,115,116,111,114,101,32,105,
+  110,32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,
+  98,117,102,102,101,114,46,32,82,101,116,117,114,110,32,116,
+  104,101,32,110,117,109,98,101,114,32,111,102,32,98,121,116,
+  101,115,32,114,101,97,100,46,0,0,82,117,110,115,32,97,
+  110,111,116,104,101,114,32,97,112,112,108,105,99,97,116,105,
+  111,110,32,117,115,105,110,103,32,116,104,101,32,115,121,115,
+  116,101,109,32,115,104,101,108,108,32,97,110,100,32,114,101,
+  116,117,114,110,115,32,97,102,116,101,114,32,101,120,101,99,
+  117,116,105,111,110,32,105,115,32,99,111,109,112,108,101,116,
+  101,100,46,0,0,87,97,105,116,115,32,102,111,114,32,97,
+  32,99,104,105,108,100,32,112,114,111,99,101,115,115,32,116,
+  111,32,99,111,109,112,108,101,116,101,46,32,84,104,105,115,
+  32,109,97,112,115,32,116,111,32,116,104,101,32,119,97,105,
+  116,40,41,32,115,121,115,116,101,109,32,99,97,108,108,46,
+  0,0,85,110,112,97,99,107,32,97,32,51,50,45,98,105,
+  116,32,118,97,108,117,101,32,105,110,116,111,32,102,111,117,
+  114,32,56,45,98,105,116,32,118,97,108,117,101,115,46,0,
+  0,77,117,108,116,105,112,108,121,32,96,110,49,96,32,98,
+  121,32,96,110,50,96,32,97,110,100,32,114,101,116,117,114,
+  110,32,116,104,101,32,114,101,115,117,108,116,46,0,0,77,
+  117,108,116,105,112,108,121,32,96,120,96,32,98,121,32,96,
+  121,96,32,97,110,100,32,116,104,101,110,32,100,105,118,105,
+  100,101,32,98,121,32,96,122,96,32,97,110,100,32,114,101,
+  116,117,114,110,32,116,104,101,32,105,110,116,101,103,101,114,
+  32,112,97,114,116,32,111,102,32,116,104,101,32,113,117,111,
+  116,105,101,110,116,32,97,110,100,32,114,101,109,97,105,110,
+  100,101,114,46,0,0,65,100,100,32,96,110,49,96,32,116,
+  111,32,96,110,50,96,32,97,110,100,32,114,101,116,117,114,
+  110,32,116,104,101,32,114,101,115,117,108,116,46,0,0,83,
+  117,98,116,114,97,99,116,32,96,110,50,96,32,102,114,111,
+  109,32,96,110,49,96,32,97,110,100,32,114,101,116,117,114,
+  110,32,116,104,101,32,114,101,115,117,108,116,46,0,0,67,
+  111,109,112,97,114,101,32,116,119,111,32,118,97,108,117,101,
+  115,32,102,111,114,32,105,110,101,113,117,97,108,105,116,121,
+  46,32,82,101,116,117,114,110,115,32,96,84,82,85,69,96,
+  32,105,102,32,116,104,101,121,32,97,114,101,32,110,111,116,
+  32,101,113,117,97,108,32,111,114,32,96,70,65,76,83,69,
+  96,32,111,116,104,101,114,119,105,115,101,46,0,0,68,105,
+  118,105,100,101,32,96,110,96,32,98,121,32,96,109,96,32,
+  97,110,100,32,114,101,116,117,114,110,32,116,104,101,32,105,
+  110,116,101,103,101,114,32,112,97,114,116,32,111,102,32,116,
+  104,101,32,113,117,111,116,105,101,110,116,32,97,110,100,32,
+  114,101,109,97,105,110,100,101,114,46,0,0,67,111,109,112,
+  97,114,101,32,116,119,111,32,118,97,108,117,101,115,32,102,
+  111,114,32,101,113,117,97,108,105,116,121,46,32,82,101,116,
+  117,114,110,115,32,96,84,82,85,69,96,32,105,102,32,116,
+  104,101,121,32,97,114,101,32,101,113,117,97,108,32,111,114,
+  32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,105,
+  115,101,46,0,0,67,111,109,112,97,114,101,32,110,49,32,
+  97,110,100,32,110,50,46,32,82,101,116,117,114,110,32,96,
+  84,82,85,69,96,32,105,102,32,110,49,32,105,115,32,103,
+  114,101,97,116,101,114,32,116,104,97,110,32,110,50,44,32,
+  111,114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,
+  119,105,115,101,46,0,0,67,111,109,112,97,114,101,32,110,
+  49,32,97,110,100,32,110,50,46,32,82,101,116,117,114,110,
+  32,96,84,82,85,69,96,32,105,102,32,110,49,32,105,115,
+  32,108,101,115,115,32,116,104,97,110,32,110,50,44,32,111,
+  114,32,96,70,65,76,83,69,96,32,111,116,104,101,114,119,
+  105,115,101,46,0,0,80,101,102,111,114,109,32,97,32,98,
+  105,116,119,105,115,101,32,115,104,105,102,116,32,111,102,32,
+  109,32,98,121,32,110,32,98,105,116,115,46,32,73,102,32,
+  110,32,105,115,32,112,111,115,105,116,105,118,101,44,32,115,
+  104,105,102,116,32,114,105,103,104,116,46,32,73,102,32,110,
+  101,103,97,116,105,118,101,44,32,116,104,101,32,115,104,105,
+  102,116,32,119,105,108,108,32,98,101,32,116,111,32,116,104,
+  101,32,108,101,102,116,46,0,0,69,120,101,99,117,116,101,
+  32,113,117,111,116,101,32,114,101,112,101,97,116,101,100,108,
+  121,32,119,104,105,108,101,32,116,104,101,32,113,117,111,116,
+  101,32,114,101,116,117,114,110,115,32,97,32,118,97,108,117,
+  101,32,111,102,32,96,70,65,76,83,69,96,46,32,84,104,
+  101,32,113,117,111,116,101,32,115,104,111,117,108,100,32,114,
+  101,116,117,114,110,32,97,32,102,108,97,103,32,111,102,32,
+  101,105,116,104,101,114,32,96,84,82,85,69,96,32,111,114,
+  32,96,70,65,76,83,69,96,44,32,116,104,111,117,103,104,
+  32,96,117,110,116,105,108,96,32,119,105,108,108,32,116,114,
+  101,97,116,32,97,110,121,32,110,111,110,45,122,101,114,111,
+  32,118,97,108,117,101,32,97,115,32,96,84,82,85,69,96,
+  46,0,0,68,101,99,114,101,109,101,110,116,32,116,104,101,
+  32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,
+  100,100,114,101,115,115,32,98,121,32,49,46,0,0,68,101,
+  99,114,101,109,101,110,116,32,116,104,101,32,118,97,108,117,
+  101,32,115,116,111,114,101,100,32,97,116,32,116,104,101,32,
+  115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,
+  115,32,98,121,32,116,104,101,32,115,112,101,99,105,102,105,
+  101,100,32,118,97,108,117,101,46,0,0,73,110,99,114,101,
+  109,101,110,116,32,116,104,101,32,118,97,108,117,101,32,115,
+  116,111,114,101,100,32,97,116,32,116,104,101,32,115,112,101,
+  99,105,102,105,101,100,32,97,100,100,114,101,115,115,32,98,
+  121,32,49,46,0,0,73,110,99,114,101,109,101,110,116,32,
+  116,104,101,32,118,97,108,117,101,32,115,116,111,114,101,100,
+  32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,97,100,100,114,101,115,115,32,98,121,32,116,104,101,
+  32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,101,
+  46,0,0,70,101,116,99,104,32,116,104,101,32,118,97,108,
+  117,101,32,115,116,111,114,101,100,32,97,116,32,116,104,101,
+  32,97,100,100,114,101,115,115,44,32,116,104,101,110,32,114,
+  117,110,32,96,110,58,108,105,109,105,116,96,32,97,103,97,
+  105,110,115,116,32,105,116,44,32,117,115,105,110,103,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,108,111,119,
+  101,114,32,97,110,100,32,117,112,112,101,114,32,98,111,117,
+  110,100,115,46,32,84,104,101,110,32,115,116,111,114,101,32,
+  116,104,101,32,114,101,115,117,108,116,105,110,103,32,118,97,
+  108,117,101,32,98,97,99,107,32,116,111,32,116,104,101,32,
+  111,114,105,103,105,110,97,108,32,97,100,100,114,101,115,115,
+  46,0,0,83,101,116,32,97,32,118,97,114,105,97,98,108,
+  101,32,116,111,32,48,46,0,0,83,101,116,32,97,32,118,
+  97,114,105,97,98,108,101,32,116,111,32,45,49,46,0,0,
+  77,97,107,101,32,97,32,99,111,112,121,32,111,102,32,116,
+  104,101,32,118,97,108,117,101,32,97,116,32,116,104,101,32,
+  97,100,100,114,101,115,115,44,32,116,104,101,110,32,114,117,
+  110,32,116,104,101,32,113,117,111,116,101,46,32,79,110,99,
+  101,32,116,104,101,32,113,117,111,116,101,32,99,111,109,112,
+  108,101,116,101,115,44,32,114,101,115,116,111,114,101,32,116,
+  104,101,32,97,100,100,114,101,115,115,32,116,111,32,116,104,
+  101,32,115,112,101,99,105,102,105,101,100,32,118,97,108,117,
+  101,46,0,0,70,101,116,99,104,32,97,32,118,97,108,117,
+  101,32,102,114,111,109,32,116,104,101,32,115,112,101,99,105,
+  102,105,101,100,32,97,100,100,114,101,115,115,44,32,116,104,
+  101,110,32,114,117,110,32,116,104,101,32,113,117,111,116,97,
+  116,105,111,110,32,119,105,116,104,32,116,104,105,115,32,118,
+  97,108,117,101,32,111,110,32,116,104,101,32,115,116,97,99,
+  107,46,32,65,102,116,101,114,119,97,114,100,115,44,32,115,
+  116,111,114,101,32,116,104,101,32,114,101,116,117,114,110,101,
+  100,32,118,97,108,117,101,32,97,116,32,116,104,101,32,111,
+  114,105,103,105,110,97,108,32,97,100,100,114,101,115,115,46,
+  0,0,67,114,101,97,116,101,32,97,32,118,97,114,105,97,
+  98,108,101,46,32,84,104,101,32,118,97,114,105,97,98,108,
+  101,32,105,115,32,105,110,105,116,105,97,108,105,122,101,100,
+  32,116,111,32,48,46,0,0,67,114,101,97,116,101,32,97,
+  32,118,97,114,105,97,98,108,101,32,119,105,116,104,32,116,
+  104,101,32,115,112,101,99,105,102,105,101,100,32,105,110,105,
+  116,105,97,108,32,118,97,108,117,101,46,0,0,67,114,101,
+  97,116,101,32,97,32,118,97,114,105,97,98,108,101,32,119,
+  105,116,104,32,116,104,101,32,115,112,101,99,105,102,105,101,
+  100,32,105,110,105,116,105,97,108,32,118,97,108,117,101,46,
+  0,0,70,101,116,99,104,32,116,104,101,32,51,50,45,98,
+  105,116,32,118,97,108,117,101,32,115,116,111,114,101,100,32,
+  97,116,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
+  32,97,100,100,114,101,115,115,46,32,65,100,100,114,101,115,
+  115,105,110,103,32,102,111,114,32,116,104,105,115,32,105,115,
+  32,105,110,32,56,45,98,105,116,32,117,110,105,116,115,46,
+  32,84,104,101,32,97,100,100,114,101,115,115,32,109,117,115,
+  116,32,98,101,32,97,108,105,103,110,101,100,32,111,110,32,
+  97,32,102,111,117,114,32,98,121,116,101,32,98,111,117,110,
+  100,97,114,121,46,0,0,70,101,116,99,104,32,116,104,101,
+  32,118,97,108,117,101,32,115,116,111,114,101,100,32,97,116,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,97,
+  100,100,114,101,115,115,46,32,82,101,116,117,114,110,115,32,
+  116,104,101,32,110,101,120,116,32,97,100,100,114,101,115,115,
+  32,97,110,100,32,116,104,101,32,118,97,108,117,101,46,0,
+  0,83,116,111,114,101,32,97,110,32,51,50,45,98,105,116,
+  32,118,97,108,117,101,32,105,110,116,111,32,116,104,101,32,
+  115,112,101,99,105,102,105,101,100,32,97,100,100,114,101,115,
+  115,46,32,65,100,100,114,101,115,115,105,110,103,32,102,111,
+  114,32,116,104,105,115,32,105,115,32,105,110,32,56,45,98,
+  105,116,32,117,110,105,116,115,46,32,84,104,101,32,97,100,
+  100,114,101,115,115,32,109,117,115,116,32,98,101,32,97,108,
+  105,103,110,101,100,32,111,110,32,97,32,102,111,117,114,32,
+  98,121,116,101,32,98,111,117,110,100,97,114,121,46,0,0,
+  83,116,111,114,101,32,97,32,118,97,108,117,101,32,105,110,
+  116,111,32,116,104,101,32,115,112,101,99,105,102,105,101,100,
+  32,97,100,100,114,101,115,115,32,97,110,100,32,114,101,116,
+  117,114,110,32,116,104,101,32,110,101,120,116,32,97,100,100,
+  114,101,115,115,46,0,0,69,120,101,99,117,116,101,32,113,
+  117,111,116,101,32,114,101,112,101,97,116,101,100,108,121,32,
+  119,104,105,108,101,32,116,104,101,32,113,117,111,116,101,32,
+  114,101,116,117,114,110,115,32,97,32,96,84,82,85,69,96,
+  32,118,97,108,117,101,46,32,84,104,101,32,113,117,111,116,
+  101,32,115,104,111,117,108,100,32,114,101,116,117,114,110,32,
+  97,32,102,108,97,103,32,111,102,32,101,105,116,104,101,114,
+  32,96,84,82,85,69,96,32,111,114,32,96,70,65,76,83,
+  69,96,44,32,116,104,111,117,103,104,32,96,119,104,105,108,
+  101,96,32,119,105,108,108,32,116,114,101,97,116,32,97,110,
+  121,32,110,111,110,45,122,101,114,111,32,118,97,108,117,101,
+  32,97,115,32,96,84,82,85,69,96,46,0,0,80,101,114,
+  102,111,114,109,32,97,32,98,105,116,119,105,115,101,32,88,
+  79,82,32,111,112,101,114,97,116,105,111,110,46,0,0,66,
+  101,103,105,110,32,97,110,32,97,114,114,97,121,46,32,84,
+  104,105,115,32,105,115,32,105,110,116,101,110,100,101,100,32,
+  116,111,32,109,97,107,101,32,99,114,101,97,116,105,110,103,
+  32,97,114,114,97,121,115,32,97,32,98,105,116,32,99,108,
+  101,97,110,101,114,32,116,104,97,110,32,117,115,105,110,103,
+  32,97,32,113,117,111,116,97,116,105,111,110,32,97,110,100,
+  32,96,97,58,99,111,117,110,116,101,100,45,114,101,115,117,
+  108,116,115,96,46,0,0,66,101,103,105,110,32,97,32,108,
+  101,120,105,99,97,108,108,121,32,115,99,111,112,101,100,32,
+  97,114,101,97,46,0,0,67,111,109,112,108,101,116,101,32,
+  97,110,32,97,114,114,97,121,32,98,101,103,117,110,32,98,
+  121,32,96,123,96,46,32,82,101,116,117,114,110,115,32,97,
+  32,112,111,105,110,116,101,114,32,116,111,32,116,104,101,32,
+  100,97,116,97,46,0,0,69,110,100,32,97,32,108,101,120,
+  105,99,97,108,108,121,32,115,99,111,112,101,100,32,97,114,
+  101,97,46,32,84,104,105,115,32,119,105,108,108,32,104,105,
+  100,101,32,97,110,121,32,104,101,97,100,101,114,115,32,98,
+  101,116,119,101,101,110,32,96,123,123,96,32,97,110,100,32,
+  96,45,45,45,114,101,118,101,97,108,45,45,45,96,44,32,
+  108,101,97,118,105,110,103,32,111,110,108,121,32,104,101,97,
+  100,101,114,115,32,98,101,116,119,101,101,110,32,96,45,45,
+  45,114,101,118,101,97,108,45,45,45,96,32,97,110,100,32,
+  116,104,101,32,96,125,125,96,32,118,105,115,105,98,108,101,
+  46,0,0,68,101,115,99,114,105,98,101,32,97,32,119,111,
+  114,100,32,98,121,32,110,97,109,101,46,0,0,83,101,116,
+  32,116,104,101,32,100,58,115,116,97,99,107,32,102,105,101,
+  108,100,32,102,111,114,32,97,32,119,111,114,100,46,0,0,
+  83,101,116,32,116,104,101,32,100,58,102,115,116,97,99,107,
+  32,102,105,101,108,100,32,102,111,114,32,97,32,119,111,114,
+  100,46,0,0,83,101,116,32,116,104,101,32,100,58,97,115,
+  116,97,99,107,32,102,105,101,108,100,32,102,111,114,32,97,
+  32,119,111,114,100,46,0,0,71,105,118,101,110,32,97,32,
+  100,105,99,116,105,111,110,97,114,121,32,112,111,105,110,116,
+  101,114,44,32,114,101,116,117,114,110,32,97,100,100,114,101,
+  115,115,32,111,102,32,116,104,101,32,100,97,116,97,32,115,
+  116,97,99,107,32,102,105,101,108,100,0,0,71,105,118,101,
+  110,32,97,32,100,105,99,116,105,111,110,97,114,121,32,112,
+  111,105,110,116,101,114,44,32,114,101,116,117,114,110,32,97,
+  100,100,114,101,115,115,32,111,102,32,116,104,101,32,97,100,
+  100,114,101,115,115,32,115,116,97,99,107,32,102,105,101,108,
+  100,0,0,71,105,118,101,110,32,97,32,100,105,99,116,105,
+  111,110,97,114,121,32,112,111,105,110,116,101,114,44,32,114,
+  101,116,117,114,110,32,97,100,100,114,101,115,115,32,111,102,
+  32,116,104,101,32,102,108,111,97,116,32,115,116,97,99,107,
+  32,102,105,101,108,100,0,0,71,105,118,101,110,32,97,32,
+  100,105,99,116,105,111,110,97,114,121,32,112,111,105,110,116,
+  101,114,44,32,114,101,116,117,114,110,32,97,100,100,114,101,
+  115,115,32,111,102,32,116,104,101,32,100,101,115,99,114,105,
+  112,116,105,111,110,32,102,105,101,108,100,0,0,82,101,116,
+  117,114,110,32,97,32,115,116,114,105,110,103,32,114,101,112,
+  114,101,115,101,110,116,97,116,105,111,110,32,102,111,114,32,
+  97,32,110,117,109,98,101,114,44,32,119,105,116,104,32,100,
+  105,103,105,116,115,32,105,110,32,114,101,118,101,114,115,101,
+  32,111,114,100,101,114,0,0,67,114,101,97,116,101,32,97,
+  32,99,104,97,110,110,101,108,32,104,111,108,100,105,110,103,
+  32,117,112,32,116,111,32,110,32,118,97,108,117,101,115,46,
+  32,82,101,116,117,114,110,115,32,116,104,101,32,99,104,97,
+  110,110,101,108,46,0,0,68,101,115,116,114,111,121,32,97,
+  32,99,104,97,110,110,101,108,44,32,102,114,101,101,105,110,
+  103,32,105,116,115,32,98,117,102,102,101,114,46,0,0,82,
+  101,99,101,105,118,101,32,97,32,118,97,108,117,101,32,102,
+  114,111,109,32,97,32,99,104,97,110,110,101,108,44,32,119,
+  97,105,116,105,110,103,32,117,110,116,105,108,32,111,110,101,
+  32,105,115,32,115,101,110,116,46,0,0,87,97,105,116,32,
+  117,110,116,105,108,32,111,110,101,32,111,102,32,116,104,101,
+  32,99,104,97,110,110,101,108,115,32,105,110,32,116,104,101,
+  32,97,114,114,97,121,32,104,97,115,32,97,32,118,97,108,
+  117,101,46,32,82,101,116,117,114,110,115,32,116,104,101,32,
+  105,110,100,101,120,32,111,102,32,116,104,101,32,99,104,97,
+  110,110,101,108,46,0,0,83,101,110,100,32,97,32,118,97,
+  108,117,101,32,111,110,32,97,32,99,104,97,110,110,101,108,
+  44,32,119,97,105,116,105,110,103,32,117,110,116,105,108,32,
+  116,104,101,32,99,104,97,110,110,101,108,32,104,97,115,32,
+  114,111,111,109,46,0,0,82,101,99,101,105,118,101,32,97,
+  32,118,97,108,117,101,32,102,114,111,109,32,97,32,99,104,
+  97,110,110,101,108,32,105,102,32,111,110,101,32,105,115,32,
+  119,97,105,116,105,110,103,46,32,82,101,116,117,114,110,115,
+  32,116,104,101,32,118,97,108,117,101,32,40,111,114,32,48,
+  41,32,97,110,100,32,97,32,102,108,97,103,32,105,110,100,
+  105,99,97,116,105,110,103,32,115,117,99,99,101,115,115,46,
+  0,0,83,101,110,100,32,97,32,118,97,108,117,101,32,111,
+  110,32,97,32,99,104,97,110,110,101,108,32,105,102,32,105,
+  116,32,104,97,115,32,114,111,111,109,46,32,82,101,116,117,
+  114,110,115,32,97,32,102,108,97,103,32,105,110,100,105,99,
+  97,116,105,110,103,32,115,117,99,99,101,115,115,46,0,0,
+  73,102,32,116,104,101,32,97,100,100,114,101,115,115,32,104,
+  111,108,100,115,32,116,104,101,32,111,108,100,32,118,97,108,
+  117,101,44,32,114,101,112,108,97,99,101,32,105,116,32,119,
+  105,116,104,32,116,104,101,32,110,101,119,32,111,110,101,46,
+  32,82,101,116,117,114,110,115,32,97,32,102,108,97,103,32,
+  105,110,100,105,99,97,116,105,110,103,32,115,117,99,99,101,
+  115,115,46,0,0,65,116,111,109,105,99,97,108,108,121,32,
+  115,116,111,114,101,32,97,32,118,97,108,117,101,32,105,110,
+  116,111,32,97,110,32,97,100,100,114,101,115,115,46,32,82,
+  101,116,117,114,110,115,32,116,104,101,32,112,114,101,118,105,
+  111,117,115,32,118,97,108,117,101,46,0,0,70,117,108,108,
+  32,109,101,109,111,114,121,32,102,101,110,99,101,46,32,77,
+  101,109,111,114,121,32,97,99,99,101,115,115,101,115,32,97,
+  114,101,32,110,111,116,32,114,101,111,114,100,101,114,101,100,
+  32,97,99,114,111,115,115,32,116,104,105,115,46,0,0,65,
+  99,113,117,105,114,101,32,102,101,110,99,101,46,32,76,97,
+  116,101,114,32,109,101,109,111,114,121,32,97,99,99,101,115,
+  115,101,115,32,97,114,101,32,110,111,116,32,109,111,118,101,
+  100,32,98,101,102,111,114,101,32,116,104,105,115,46,0,0,
+  82,101,108,101,97,115,101,32,102,101,110,99,101,46,32,69,
+  97,114,108,105,101,114,32,109,101,109,111,114,121,32,97,99,
+  99,101,115,115,101,115,32,97,114,101,32,110,111,116,32,109,
+  111,118,101,100,32,97,102,116,101,114,32,116,104,105,115,46,
+  0,0,65,116,111,109,105,99,97,108,108,121,32,102,101,116,
+  99,104,32,116,104,101,32,118,97,108,117,101,32,115,116,111,
+  114,101,100,32,97,116,32,97,110,32,97,100,100,114,101,115,
+  115,46,0,0,65,116,111,109,105,99,97,108,108,121,32,97,
+  100,100,32,110,32,116,111,32,116,104,101,32,118,97,108,117,
+  101,32,97,116,32,97,110,32,97,100,100,114,101,115,115,46,
+  32,82,101,116,117,114,110,115,32,116,104,101,32,112,114,101,
+  118,105,111,117,115,32,118,97,108,117,101,46,0,0,65,116,
+  111,109,105,99,97,108,108,121,32,79,82,32,110,32,105,110,
+  116,111,32,116,104,101,32,118,97,108,117,101,32,97,116,32,
+  97,110,32,97,100,100,114,101,115,115,46,32,82,101,116,117,
+  114,110,115,32,116,104,101,32,112,114,101,118,105,111,117,115,
+  32,118,97,108,117,101,46,0,0,65,116,111,109,105,99,97,
+  108,108,121,32,115,116,111,114,101,32,97,32,118,97,108,117,
+  101,32,105,110,116,111,32,97,110,32,97,100,100,114,101,115,
+  115,46,0,0,67,111,110,115,116,97,110,116,46,32,84,104,
+  101,32,108,97,114,103,101,115,116,32,110,117,109,98,101,114,
+  32,111,102,32,99,104,117,110,107,115,32,97,110,32,97,114,
+  114,97,121,32,105,115,32,115,112,108,105,116,32,105,110,116,
+  111,32,98,121,32,116,104,101,32,112,97,114,97,108,108,101,
+  108,32,99,111,109,98,105,110,97,116,111,114,115,46,0,0,
+  82,101,116,117,114,110,32,116,104,101,32,109,97,120,105,109,
+  117,109,32,110,117,109,98,101,114,32,111,102,32,118,97,108,
+  117,101,115,32,105,110,32,97,110,32,101,118,101,110,116,32,
+  112,97,121,108,111,97,100,46,0,0,82,101,116,117,114,110,
+  32,84,82,85,69,32,105,102,32,97,110,32,101,118,101,110,
+  116,32,105,115,32,119,97,105,116,105,110,103,44,32,111,114,
+  32,70,65,76,83,69,32,111,116,104,101,114,119,105,115,101,
+  46,0,0,67,111,112,121,32,116,104,101,32,111,108,100,101,
+  115,116,32,101,118,101,110,116,32,116,111,32,97,114,114,97,
+  121,32,97,46,32,82,101,116,117,114,110,115,32,116,104,101,
+  32,116,121,112,101,32,97,110,100,32,84,82,85,69,44,32,
+  111,114,32,48,32,97,110,100,32,70,65,76,83,69,32,105,
+  102,32,116,104,101,114,101,32,97,114,101,32,110,111,32,101,
+  118,101,110,116,115,46,0,0,80,111,115,116,32,97,110,32,
+  101,118,101,110,116,32,119,105,116,104,32,116,121,112,101,32,
+  116,32,97,110,100,32,116,104,101,32,118,97,108,117,101,115,
+  32,105,110,32,97,114,114,97,121,32,97,32,97,115,32,116,
+  104,101,32,112,97,121,108,111,97,100,46,32,82,101,116,117,
+  114,110,115,32,70,65,76,83,69,32,105,102,32,116,104,101,
+  32,113,117,101,117,101,32,105,115,32,102,117,108,108,32,111,
+  114,32,116,104,101,32,97,114,114,97,121,32,105,115,32,116,
+  111,111,32,108,97,114,103,101,46,0,0,83,101,116,32,97,
+  32,113,117,111,116,101,32,116,111,32,98,101,32,99,97,108,
+  108,101,100,32,119,104,101,110,32,101,118,101,110,116,115,32,
+  97,114,101,32,112,111,115,116,101,100,46,32,80,97,115,115,
+  32,48,32,116,111,32,114,101,109,111,118,101,32,105,116,46,
+  0,0,87,97,105,116,32,117,112,32,116,111,32,110,32,109,
+  105,108,108,105,115,101,99,111,110,100,115,32,40,111,114,32,
+  102,111,114,101,118,101,114,32,105,102,32,110,32,105,115,32,
+  45,49,41,32,102,111,114,32,97,110,32,101,118,101,110,116,
+  44,32,116,104,101,110,32,99,111,112,121,32,105,116,32,116,
+  111,32,97,114,114,97,121,32,97,46,32,82,101,116,117,114,
+  110,115,32,116,104,101,32,116,121,112,101,32,97,110,100,32,
+  84,82,85,69,44,32,111,114,32,48,32,97,110,100,32,70,
+  65,76,83,69,32,111,110,32,116,105,109,101,111,117,116,46,
+  0,0,86,97,114,105,97,98,108,101,46,32,87,104,101,110,
+  32,96,84,82,85,69,96,44,32,115,116,97,99,107,32,99,
+  111,109,109,101,110,116,115,32,97,110,100,32,100,101,115,99,
+  114,105,112,116,105,111,110,115,32,97,114,101,32,107,101,112,
+  116,32,105,110,32,116,104,101,32,100,105,99,116,105,111,110,
+  97,114,121,32,104,101,97,100,101,114,115,46,32,87,104,101,
+  110,32,96,70,65,76,83,69,96,44,32,116,104,101,121,32,
+  97,114,101,32,100,105,115,99,97,114,100,101,100,44,32,97,
+  110,100,32,96,100,58,100,101,115,99,114,105,98,101,96,32,
+  114,101,97,100,115,32,116,104,101,109,32,102,114,111,109,32,
+  116,104,101,32,103,108,111,115,115,97,114,121,46,0,0,67,
+  104,97,110,103,101,32,116,104,101,32,99,108,97,115,115,32,
+  111,102,32,116,104,101,32,109,111,115,116,32,114,101,99,101,
+  110,116,108,121,32,100,101,102,105,110,101,100,32,119,111,114,
+  100,32,116,111,32,99,108,97,115,115,58,105,110,108,105,110,
+  101,32,105,102,32,105,116,32,105,115,32,115,104,111,114,116,
+  32,97,110,100,32,115,97,102,101,32,116,111,32,99,111,112,
+  121,32,105,110,116,111,32,105,116,115,32,99,97,108,108,101,
+  114,115,46,32,83,101,101,32,116,104,101,32,73,110,108,105,
+  110,105,110,103,32,115,101,99,116,105,111,110,32,111,102,32,
+  114,101,116,114,111,46,102,111,114,116,104,32,102,111,114,32,
+  116,104,101,32,108,105,109,105,116,115,46,0,0,82,101,116,
+  117,114,110,32,84,82,85,69,32,105,102,32,116,104,101,32,
+  119,111,114,100,32,97,116,32,116,104,101,32,97,100,100,114,
+  101,115,115,32,109,97,121,32,112,111,112,32,109,111,114,101,
+  32,102,114,111,109,32,116,104,101,32,97,100,100,114,101,115,
+  115,32,115,116,97,99,107,32,116,104,97,110,32,105,116,32,
+  112,117,115,104,101,115,32,40,116,111,32,101,120,105,116,32,
+  105,116,115,32,99,97,108,108,101,114,44,32,108,105,107,101,
+  32,96,99,97,115,101,96,41,46,0,0,233,132,2,193,233,
+  4,193,1,184,237,4,0,157,197,232,182,3,195,233,4,225,
+  1,225,1,211,237,4,105,109,97,103,101,58,115,97,118,101,
+  0,0,129,16,172,54,115,45,0,0,129,134,4,195,233,4,
+  232,7,129,16,198,126,129,16,175,126,10,173,233,4,238,233,
+  4,193,1,184,237,4,0,219,175,167,173,12,240,233,4,225,
+  1,225,1,128,238,4,105,109,97,103,101,58,115,97,118,101,
+  47,105,110,99,114,101,109,101,110,116,97,108,0,0,129,16,
+  172,54,115,45,0,0,129,134,132,8,240,233,4,0,1,232,
+  7,129,16,198,126,129,16,175,126,10,206,233,4,155,234,4,
+  193,1,184,237,4,192,250,236,225,6,157,234,4,225,1,225,
+  1,223,238,4,105,109,97,103,101,58,115,97,118,101,47,98,
+  97,99,107,103,114,111,117,110,100,0,0,129,16,172,54,115,
+  45,0,0,129,134,132,8,157,234,4,0,3,232,7,129,16,
+  198,126,129,16,175,126,10,252,233,4,192,234,4,193,1,184,
+  237,4,0,237,191,181,156,1,194,234,4,225,1,225,1,193,
+  239,4,105,109,97,103,101,58,115,97,118,105,110,103,63,0,
+  0,129,16,172,54,45,102,0,0,129,134,132,8,194,234,4,
+  0,5,232,7,129,16,198,126,129,16,175,126,10,169,234,4,
+  226,234,4,193,1,184,237,4,0,209,133,215,182,3,228,234,
+  4,225,1,225,1,136,240,4,105,109,97,103,101,58,119,97,
+  105,116,0,0,129,16,172,54,45,102,0,0,129,134,132,8,
+  228,234,4,0,7,232,7,129,16,198,126,129,16,175,126,10,
+  206,234,4,139,235,4,193,1,184,237,4,0,175,182,210,255,
+  14,141,235,4,225,1,225,1,227,240,4,105,109,97,103,101,
+  58,115,97,118,101,47,112,97,99,107,101,100,0,0,129,16,
+  172,54,115,45,0,0,129,134,132,8,141,235,4,0,9,232,
+  7,129,16,198,126,129,16,175,126,10,240,234,4,168,235,4,
+  193,1,0,0,202,157,237,122,0,0,225,1,225,1,0,0,
+  101,100,105,116,63,0,0,2,129,14,174,235,4,129,22,8,
+  10,130,138,132,64,171,235,4,134,130,28,181,235,4,129,22,
+  127,10,129,16,178,235,4,22,10,153,235,4,201,235,4,193,
+  1,0,0,0,183,238,198,72,0,0,225,1,225,1,0,0,
+  101,110,100,101,100,63,0,0,129,16,166,50,129,30,182,52,
+  129,16,149,27,10,185,235,4,221,235,4,193,1,0,0,206,
+  185,161,92,0,0,225,1,225,1,0,0,97,100,100,0,0,
+  129,16,201,235,4,129,2,17,208,49,129,16,70,10,208,235,
+  4,245,235,4,193,1,0,0,0,255,214,135,12,0,0,225,
+  1,225,1,0,0,103,97,116,104,101,114,0,0,129,16,168,
+  235,4,129,2,17,221,235,4,129,16,70,10,229,235,4,140,
+  236,4,193,1,0,0,213,142,138,122,0,0,225,1,225,1,
+  0,0,99,121,99,108,101,0,0,129,16,232,128,1,133,132,
+  152,32,133,132,152,32,132,16,129,174,100,0,1,3,129,16,
+  245,235,4,129,14,140,236,4,10,240,234,4,174,236,4,193,
+  1,184,237,4,0,205,248,154,173,12,176,236,4,225,1,225,
+  1,171,241,4,112,97,114,115,101,45,117,110,116,105,108,0,
+  0,129,16,172,54,113,45,115,0,0,129,6,176,236,4,129,
+  14,194,236,4,129,16,147,54,129,16,191,50,129,16,140,236,
+  4,131,6,129,16,162,49,10,1,184,236,4,129,16,221,50,
+  10,153,236,4,214,236,4,193,1,184,237,4,178,167,134,130,
+  1,216,236,4,225,1,225,1,151,242,4,115,58,103,101,116,
+  0,0,129,16,172,54,45,115,0,0,129,6,216,236,4,129,
+  14,239,236,4,129,14,228,236,4,129,22,13,10,130,138,132,
+  64,225,236,4,134,130,28,235,236,4,129,22,10,10,129,16,
+  232,236,4,22,10,1,223,236,4,129,16,174,236,4,10,199,
+  236,4,131,237,4,193,1,184,237,4,140,219,237,121,133,237,
+  4,225,1,225,1,244,242,4,99,108,101,97,114,0,0,129,
+  16,172,54,45,0,0,129,6,133,237,4,129,16,172,54,92,
+  94,91,50,74,92,94,91,48,59,48,72,0,0,1,139,237,
+  4,129,16,238,93,129,16,188,127,10,244,236,4,171,237,4,
+  205,1,184,237,4,131,225,229,2,173,237,4,225,1,225,1,
+  135,243,4,47,47,0,0,129,16,172,54,45,0,0,129,6,
+  173,237,4,129,16,214,218,1,1,146,129,1,129,16,157,38,
+  10,105,110,116,101,114,102,97,99,101,47,114,101,116,114,111,
+  45,117,110,105,120,46,114,101,116,114,111,0,0,83,97,118,
+  101,32,116,104,101,32,99,117,114,114,101,110,116,32,115,121,
+  115,116,101,109,32,116,111,32,97,32,110,101,119,32,105,109,
+  97,103,101,32,102,105,108,101,46,0,0,83,97,118,101,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,115,121,115,116,
+  101,109,32,116,111,32,97,110,32,105,109,97,103,101,32,102,
+  105,108,101,44,32,119,114,105,116,105,110,103,32,111,110,108,
+  121,32,119,104,97,116,32,99,104,97,110,103,101,100,32,115,
+  105,110,99,101,32,116,104,101,32,108,97,115,116,32,115,97,
+  118,101,32,116,111,32,105,116,46,0,0,83,97,118,101,32,
+  116,104,101,32,99,117,114,114,101,110,116,32,115,121,115,116,
+  101,109,32,116,111,32,97,110,32,105,109,97,103,101,32,102,
+  105,108,101,32,105,110,32,97,32,115,101,112,97,114,97,116,
+  101,32,112,114,111,99,101,115,115,44,32,119,105,116,104,111,
+  117,116,32,119,97,105,116,105,110,103,32,102,111,114,32,105,
+  116,32,116,111,32,102,105,110,105,115,104,46,0,0,82,101,
+  116,117,114,110,32,84,82,85,69,32,105,102,32,97,32,98,
+  97,99,107,103,114,111,117,110,100,32,105,109,97,103,101,32,
+  115,97,118,101,32,105,115,32,114,117,110,110,105,110,103,44,
+  32,111,114,32,70,65,76,83,69,32,111,116,104,101,114,119,
+  105,115,101,46,0,0,87,97,105,116,32,102,111,114,32,97,
+  32,98,97,99,107,103,114,111,117,110,100,32,105,109,97,103,
+  101,32,115,97,118,101,32,116,111,32,102,105,110,105,115,104,
+  46,32,82,101,116,117,114,110,115,32,70,65,76,83,69,32,
+  105,102,32,105,116,32,102,97,105,108,101,100,44,32,111,114,
+  32,84,82,85,69,32,111,116,104,101,114,119,105,115,101,46,
+  0,0,83,97,118,101,32,116,104,101,32,99,117,114,114,101,
+  110,116,32,115,121,115,116,101,109,32,116,111,32,97,32,110,
+  101,119,32,105,109,97,103,101,32,102,105,108,101,44,32,112,
+  97,99,107,101,100,32,116,111,32,114,101,100,117,99,101,32,
+  105,116,115,32,115,105,122,101,46,0,0,82,101,97,100,32,
+  105,110,112,117,116,32,102,114,111,109,32,115,116,100,105,110,
+  32,40,118,105,97,32,96,99,58,103,101,116,96,41,32,117,
+  110,116,105,108,32,116,104,101,32,114,101,116,117,114,110,101,
+  100,32,99,104,97,114,97,99,116,101,114,32,105,115,32,109,
+  97,116,99,104,101,100,32,98,121,32,116,104,101,32,113,117,
+  111,116,101,46,32,82,101,116,117,114,110,115,32,97,32,115,
+  116,114,105,110,103,46,0,0,82,101,97,100,32,105,110,112,
+  117,116,32,102,114,111,109,32,115,116,97,110,100,97,114,100,
+  32,105,110,32,40,118,105,97,32,96,99,58,103,101,116,96,
+  41,32,117,110,116,105,108,32,97,32,67,82,32,111,114,32,
+  76,70,32,105,115,32,101,110,99,111,117,110,116,101,114,101,
+  100,46,32,82,101,116,117,114,110,115,32,97,32,115,116,114,
+  105,110,103,46,0,0,67,108,101,97,114,32,116,104,101,32,
+  100,105,115,112,108,97,121,46,0,0,73,103,110,111,114,101,
+  32,97,110,121,32,116,111,107,101,110,115,32,114,101,109,97,
+  105,110,105,110,103,32,111,110,32,116,104,101,32,99,117,114,
+  114,101,110,116,32,108,105,110,101,46,32,87,111,114,107,115,
+  32,119,105,116,104,32,102,105,108,101,115,32,97,110,100,32,
+  116,104,101,32,105,110,116,101,114,97,99,116,105,118,101,32,
+  96,108,105,115,116,101,110,101,114,96,46,0,0,159,237,4,
+  250,243,4,178,1,0,0,137,173,205,34,0,0,225,1,225,
+  1,0,0,83,111,117,114,99,101,115,0,0,4,243,245,4,
+  128,251,4,139,129,5,231,136,5,0,244,1,233,243,4,138,
+  245,4,193,1,0,0,177,220,241,75,0,0,225,1,225,1,
+  0,0,107,110,111,119,110,63,0,0,130,2,250,243,4,129,
+  16,133,101,10,250,244,4,158,245,4,193,1,0,0,157,171,
+  164,125,0,0,225,1,225,1,0,0,105,110,100,101,120,0,
+  0,129,8,250,243,4,129,16,247,106,129,8,250,243,4,129,
+  16,163,102,10,143,245,4,183,245,4,193,1,0,0,164,240,
+  155,201,1,0,0,225,1,225,1,0,0,114,101,99,111,114,
+  100,0,0,129,16,204,54,130,2,250,243,4,129,16,221,37,
+  129,158,132,136,1,250,243,4,250,243,4,16,10,129,14,224,
+  245,4,129,16,229,1,129,16,128,218,1,129,16,138,245,4,
+  129,2,158,245,4,183,245,4,129,16,70,129,16,244,16,129,
+  16,211,1,16,129,16,244,16,129,162,132,120,9,9,8,129,
+  16,244,16,129,16,213,1,16,10,1,196,245,4,159,237,4,
+  140,246,4,193,1,243,245,4,0,219,249,233,168,11,142,246,
+  4,225,1,225,1,211,250,4,100,58,119,111,114,100,115,0,
+  0,100,105,99,116,45,119,111,114,100,115,45,108,105,115,116,
+  105,110,103,46,102,111,114,116,104,0,0,129,16,172,54,45,
+  0,0,129,6,142,246,4,129,14,155,246,4,129,34,9,129,
+  16,188,127,129,16,150,127,10,1,148,246,4,129,16,253,95,
+  10,226,245,4,182,246,4,193,1,243,245,4,155,213,215,194,
+  6,184,246,4,225,1,225,1,155,250,4,100,58,119,111,114,
+  100,115,45,119,105,116,104,0,0,129,16,172,54,115,45,0,
+  0,129,6,184,246,4,129,16,217,20,129,16,153,69,129,14,
+  222,246,4,129,162,8,9,129,16,217,20,129,16,217,66,129,
+  14,214,246,4,129,16,188,127,129,16,150,127,10,1,203,246,
+  4,129,14,214,246,4,3,10,129,152,132,168,1,0,0,31,
+  129,46,212,246,4,129,16,245,119,10,1,195,246,4,129,16,
+  253,95,10,160,246,4,252,246,4,193,1,243,245,4,0,225,
+  142,164,159,11,0,0,225,1,225,1,0,0,100,105,115,112,
+  108,97,121,45,105,102,45,108,101,102,116,0,0,2,129,16,
+  217,20,129,16,219,68,129,14,142,247,4,129,16,188,127,129,
+  16,150,127,10,1,131,247,4,129,14,142,247,4,3,10,129,
+  152,132,168,1,0,0,15,129,46,140,247,4,129,16,245,119,
+  10,160,246,4,182,247,4,193,1,243,245,4,0,205,208,237,
+  209,8,184,247,4,225,1,225,1,224,249,4,100,58,119,111,
+  114,100,115,45,98,101,103,105,110,110,105,110,103,45,119,105,
+  116,104,0,0,129,16,172,54,115,45,0,0,129,6,184,247,
+  4,129,16,217,20,129,16,153,69,129,14,200,247,4,129,34,
+  9,129,16,252,246,4,10,1,195,247,4,129,16,253,95,10,
+  150,247,4,238,247,4,193,1,243,245,4,0,231,168,157,173,
+  7,240,247,4,225,1,225,1,170,249,4,100,58,119,111,114,
+  100,115,45,109,105,115,115,105,110,103,45,100,101,116,97,105,
+  108,115,0,0,129,16,172,54,45,0,0,129,6,240,247,4,
+  129,16,172,54,68,46,83,116,97,99,107,58,0,0,1,246,
+  247,4,129,16,188,127,129,16,133,127,129,14,156,248,4,2,
+  129,16,215,1,15,129,16,208,27,129,14,150,248,4,129,34,
+  9,129,16,188,127,129,16,150,127,10,129,2,143,248,4,17,
+  129,16,70,10,1,135,248,4,129,16,253,95,129,16,133,127,
+  129,16,172,54,65,46,83,116,97,99,107,58,0,0,1,164,
+  248,4,129,16,188,127,129,16,133,127,129,14,202,248,4,2,
+  129,16,217,1,15,129,16,208,27,129,14,196,248,4,129,34,
+  9,129,16,188,127,129,16,150,127,10,129,2,189,248,4,17,
+  129,16,70,10,1,181,248,4,129,16,253,95,129,16,133,127,
+  129,16,172,54,70,46,83,116,97,99,107,58,0,0,1,210,
+  248,4,129,16,188,127,129,16,133,127,129,14,248,248,4,2,
+  129,16,219,1,15,129,16,208,27,129,14,242,248,4,129,34,
+  9,129,16,188,127,129,16,150,127,10,129,2,235,248,4,17,
+  129,16,70,10,1,227,248,4,129,16,253,95,129,16,133,127,
+  129,16,172,54,68,101,115,99,58,0,0,1,128,249,4,129,
+  16,188,127,129,16,133,127,129,14,163,249,4,2,129,16,221,
+  1,15,129,16,208,27,129,14,157,249,4,129,34,9,129,16,
+  188,127,129,16,150,127,10,129,2,150,249,4,17,129,16,70,
+  10,1,142,249,4,129,16,253,95,129,16,133,127,10,68,105,
+  115,112,108,97,121,32,119,111,114,100,115,32,109,105,115,115,
+  105,110,103,32,111,110,101,32,111,114,32,109,111,114,101,32,
+  105,110,102,111,114,109,97,116,105,111,110,32,102,105,101,108,
+  100,115,46,0,0,68,105,115,112,108,97,121,32,119,111,114,
+  100,115,32,119,105,116,104,32,110,97,109,101,32,115,116,97,
+  114,116,105,110,103,32,119,105,116,104,32,116,104,101,32,112,
+  114,111,118,105,100,101,100,32,115,116,114,105,110,103,46,0,
+  0,68,105,115,112,108,97,121,32,119,111,114,100,115,32,119,
+  105,116,104,32,110,97,109,101,32,99,111,110,116,97,105,110,
+  105,110,103,32,116,104,101,32,112,114,111,118,105,100,101,100,
+  32,115,116,114,105,110,103,46,0,0,68,105,115,112,108,97,
+  121,32,97,108,108,32,110,97,109,101,100,32,119,111,114,100,
+  115,46,0,0,205,247,4,152,251,4,193,1,128,251,4,0,
+  249,143,194,242,7,154,251,4,225,1,225,1,184,128,5,100,
+  111,117,98,108,101,58,118,97,114,0,0,101,120,116,101,110,
+  115,105,111,110,115,47,100,111,117,98,108,101,46,114,101,116,
+  114,111,0,0,129,16,172,54,110,110,115,45,0,0,129,6,
+  154,251,4,129,16,201,21,4,129,16,134,1,129,16,134,1,
+  10,236,250,4,191,251,4,193,1,128,251,4,228,143,222,164,
+  5,193,251,4,225,1,225,1,175,254,4,100,111,117,98,108,
+  101,58,102,101,116,99,104,0,0,129,16,172,54,97,45,110,
+  110,0,0,129,134,136,8,193,251,4,1,145,136,188,32,15,
+  10,169,251,4,226,251,4,193,1,128,251,4,199,217,171,172,
+  5,228,251,4,225,1,225,1,203,255,4,100,111,117,98,108,
+  101,58,115,116,111,114,101,0,0,129,16,172,54,110,110,97,
+  45,0,0,129,134,4,228,251,4,19,129,16,139,23,130,130,
+  196,40,1,144,140,64,10,204,251,4,136,252,4,193,1,128,
+  251,4,193,197,154,163,5,138,252,4,225,1,225,1,137,253,
+  4,100,111,117,98,108,101,58,99,111,110,115,116,0,0,129,
+  16,172,54,110,110,115,45,0,0,129,6,138,252,4,129,16,
+  152,251,4,1,191,251,4,129,16,220,95,10,242,251,4,173,
+  252,4,193,1,128,251,4,0,213,179,144,195,4,175,252,4,
+  225,1,225,1,151,128,5,100,111,117,98,108,101,58,115,119,
+  97,112,0,0,129,16,172,54,110,110,109,109,45,109,109,110,
+  110,0,0,129,6,175,252,4,133,136,152,32,5,133,136,152,
+  32,6,10,152,252,4,212,252,4,193,1,128,251,4,0,145,
+  190,196,242,7,214,252,4,225,1,225,1,198,253,4,100,111,
+  117,98,108,101,58,100,105,112,0,0,129,16,172,54,109,110,
+  113,45,109,110,0,0,129,6,214,252,4,133,136,152,32,133,
+  136,152,32,133,138,32,134,12,10,192,252,4,248,252,4,193,
+  1,128,251,4,0,243,190,194,242,7,250,252,4,225,1,225,
+  1,245,254,4,100,111,117,98,108,101,58,115,105,112,0,0,
+  129,16,172,54,109,110,113,45,109,110,0,0,129,134,4,250,
+  252,4,251,22,129,16,139,23,129,16,212,252,4,10,67,114,
+  101,97,116,101,32,97,32,99,111,110,115,116,97,110,116,32,
+  114,101,116,117,114,110,105,110,103,32,116,104,101,32,115,112,
+  101,99,105,102,105,101,100,32,100,111,117,98,108,101,32,99,
+  101,108,108,32,118,97,108,117,101,46,0,0,84,101,109,112,
+  111,114,97,114,105,108,121,32,114,101,109,111,118,101,32,109,
+  32,97,110,100,32,110,32,102,114,111,109,32,116,104,101,32,
+  115,116,97,99,107,44,32,101,120,101,99,117,116,101,32,116,
+  104,101,32,113,117,111,116,97,116,105,111,110,44,32,97,110,
+  100,32,116,104,101,110,32,114,101,115,116,111,114,101,32,109,
+  32,97,110,100,32,110,32,116,111,32,116,104,101,32,115,116,
+  97,99,107,46,0,0,70,101,116,99,104,32,116,104,101,32,
+  100,111,117,98,108,101,32,99,101,108,108,32,118,97,108,117,
+  101,115,32,115,116,111,114,101,100,32,105,110,32,116,104,101,
+  32,100,111,117,98,108,101,32,99,101,108,108,32,118,97,114,
+  105,97,98,108,101,32,97,116,32,97,46,0,0,82,117,110,
+  32,113,117,111,116,101,46,32,65,102,116,101,114,32,101,120,
+  101,99,117,116,105,111,110,32,99,111,109,112,108,101,116,101,
+  115,44,32,112,117,116,32,97,32,99,111,112,121,32,111,102,
+  32,109,32,97,110,100,32,110,32,98,97,99,107,32,111,110,
+  32,116,111,112,32,111,102,32,116,104,101,32,115,116,97,99,
+  107,46,0,0,83,116,111,114,101,32,116,104,101,32,100,111,
+  117,98,108,101,32,99,101,108,108,32,118,97,108,117,101,115,
+  32,111,110,32,116,104,101,32,115,116,97,99,107,32,105,110,
+  32,116,104,101,32,100,111,117,98,108,101,32,99,101,108,108,
+  32,118,97,114,105,97,98,108,101,32,97,116,32,97,46,0,
+  0,83,119,97,112,32,100,111,117,98,108,101,32,99,101,108,
+  108,32,118,97,108,117,101,32,111,110,32,115,116,97,99,107,
+  46,0,0,67,114,101,97,116,101,32,97,32,118,97,114,105,
+  97,98,108,101,32,102,111,114,32,104,111,108,100,105,110,103,
+  32,116,104,101,32,115,112,101,99,105,102,105,101,100,32,100,
+  111,117,98,108,101,32,99,101,108,108,32,118,97,108,117,101,
+  46,0,0,228,252,4,163,129,5,193,1,139,129,5,0,235,
+  176,204,240,2,0,0,225,1,225,1,0,0,109,101,109,58,
+  105,110,118,111,107,101,0,0,101,120,116,101,110,115,105,111,
+  110,115,47,109,97,108,108,111,99,46,114,101,116,114,111,0,
+  0,1,15,129,16,198,126,129,16,175,126,10,247,128,5,0,
+  0,178,1,139,129,5,240,230,136,102,0,0,225,1,225,1,
+  0,0,65,76,76,79,67,0,0,170,129,5,1,178,1,139,
+  129,5,135,176,147,228,7,0,0,225,1,225,1,0,0,70,
+  82,69,69,0,0,185,129,5,2,178,1,139,129,5,178,185,
+  177,112,0,0,225,1,225,1,0,0,83,84,79,82,69,0,
+  0,199,129,5,3,178,1,139,129,5,207,239,227,104,0,0,
+  225,1,225,1,0,0,70,69,84,67,72,0,0,214,129,5,
+  4,178,1,139,129,5,0,145,220,212,188,6,0,0,225,1,
+  225,1,0,0,82,69,83,73,90,69,0,0,228,252,4,136,
+  130,5,193,1,139,129,5,233,166,132,176,1,138,130,5,225,
+  1,225,1,144,132,5,109,101,109,58,97,108,108,111,99,0,
+  0,129,16,172,54,110,45,45,97,0,0,129,134,4,138,130,
+  5,0,0,129,16,163,129,5,10,245,129,5,168,130,5,193,
+  1,139,129,5,171,249,172,186,1,170,130,5,225,1,225,1,
+  149,135,5,109,101,109,58,115,116,111,114,101,0,0,129,16,
+  172,54,97,110,45,45,0,0,129,134,4,170,130,5,2,129,
+  16,163,129,5,10,149,130,5,200,130,5,193,1,139,129,5,
+  200,175,223,178,1,202,130,5,225,1,225,1,163,133,5,109,
+  101,109,58,102,101,116,99,104,0,0,129,16,172,54,97,45,
+  45,110,0,0,129,134,4,202,130,5,3,129,16,163,129,5,
+  10,181,130,5,231,130,5,193,1,139,129,5,192,193,170,168,
+  7,233,130,5,225,1,225,1,163,134,5,109,101,109,58,102,
+  114,101,101,0,0,129,16,172,54,97,45,45,0,0,129,134,
+  4,233,130,5,1,129,16,163,129,5,10,213,130,5,135,131,
+  5,193,1,139,129,5,0,159,223,253,42,137,131,5,225,1,
+  225,1,246,134,5,109,101,109,58,114,101,115,105,122,101,0,
+  0,129,16,172,54,97,110,45,45,0,0,129,134,4,137,131,
+  5,4,129,16,163,129,5,10,243,130,5,167,131,5,193,1,
+  139,129,5,169,218,133,177,1,169,131,5,225,1,225,1,221,
+  132,5,109,101,109,58,99,101,108,108,43,0,0,129,16,172,
+  54,110,110,45,110,0,0,129,134,132,152,1,169,131,5,8,
+  17,10,148,131,5,205,131,5,193,1,139,129,5,144,150,165,
+  40,207,131,5,225,1,225,1,236,133,5,109,101,109,58,102,
+  101,116,99,104,45,100,111,117,98,108,101,0,0,129,16,172,
+  54,110,45,110,110,0,0,129,134,136,8,207,131,5,1,129,
+  16,167,131,5,143,10,129,16,200,130,5,6,10,179,131,5,
+  248,131,5,193,1,139,129,5,147,229,143,225,4,250,131,5,
+  225,1,225,1,238,135,5,109,101,109,58,115,116,111,114,101,
+  45,100,111,117,98,108,101,0,0,129,16,172,54,97,110,110,
+  45,110,110,0,0,129,134,148,40,250,131,5,133,132,152,32,
+  133,132,152,32,1,1,129,16,167,131,5,6,129,16,168,130,
+  5,6,129,16,168,130,5,10,85,115,101,32,109,97,108,108,
+  111,99,32,116,111,32,97,108,108,111,99,97,116,101,32,109,
+  101,109,111,114,121,46,32,82,101,116,117,114,110,115,32,97,
+  32,100,111,117,98,108,101,32,99,101,108,108,32,112,111,105,
+  110,116,101,114,32,116,111,32,116,104,105,115,32,109,101,109,
+  111,114,121,46,0,0,82,101,116,117,114,110,32,97,100,100,
+  114,101,115,115,32,111,102,32,110,101,120,116,32,99,101,108,
+  108,46,32,85,115,101,115,32,97,32,100,111,117,98,108,101,
+  32,99,101,108,108,32,112,111,105,110,116,101,114,32,111,110,
+  32,116,104,101,32,115,116,97,99,107,46,0,0,70,101,116,
+  99,104,32,118,97,108,117,101,32,102,114,111,109,32,109,97,
+  108,108,111,99,39,100,32,109,101,109,111,114,121,32,114,101,
+  103,105,111,110,46,32,65,100,100,114,101,115,115,32,105,115,
+  32,97,32,100,111,117,98,108,101,32,99,101,108,108,32,118,
+  97,108,117,101,46,0,0,70,101,116,99,104,32,97,32,100,
+  111,117,98,108,101,32,99,101,108,108,32,118,97,108,117,101,
+  32,102,114,111,109,32,97,32,109,97,108,108,111,99,32,109,
+  101,109,111,114,121,32,114,101,103,105,111,110,46,0,0,70,
+  114,101,32,97,32,109,97,108,108,111,99,39,100,32,114,101,
+  103,105,111,110,32,111,102,32,109,101,109,111,114,121,46,32,
+  80,97,115,115,32,97,32,100,111,117,98,108,101,32,99,101,
+  108,108,32,112,111,105,110,116,101,114,32,116,111,32,116,104,
+  101,32,109,101,109,111,114,121,32,116,111,32,102,114,101,101,
+  46,0,0,82,101,115,105,122,101,32,97,32,109,97,108,108,
+  111,99,39,100,32,109,101,109,111,114,121,32,97,114,101,97,
+  46,0,0,83,116,111,114,101,32,97,32,118,97,108,117,101,
+  32,105,110,116,111,32,97,32,109,97,108,108,111,99,39,100,
+  32,109,101,109,111,114,121,32,114,101,103,105,111,110,46,32,
+  85,115,101,115,32,97,32,100,111,117,98,108,101,32,99,101,
+  108,108,32,112,111,105,110,116,101,114,32,102,111,114,32,116,
+  104,101,32,97,100,100,114,101,115,115,46,0,0,83,116,111,
+  114,101,32,97,32,100,111,117,98,108,101,32,118,97,108,117,
+  101,32,105,110,116,111,32,97,32,109,97,108,108,111,99,39,
+  100,32,109,101,109,111,114,121,32,114,101,103,105,111,110,46,
+  32,85,115,101,115,32,97,32,100,111,117,98,108,101,32,99,
+  101,108,108,32,112,111,105,110,116,101,114,32,102,111,114,32,
+  116,104,101,32,97,100,100,114,101,115,115,46,0,0,222,131,
+  5,254,136,5,193,1,231,136,5,0,233,203,196,154,12,128,
+  137,5,225,1,225,1,244,138,5,105,111,99,116,108,58,111,
+  112,101,114,97,116,105,111,110,0,0,101,120,116,101,110,115,
+  105,111,110,115,47,105,111,99,116,108,46,114,101,116,114,111,
+  0,0,129,16,172,54,110,45,0,0,129,134,4,128,137,5,
+  14,129,16,198,126,2,129,16,255,27,129,14,181,137,5,3,
+  129,16,172,54,69,114,114,111,114,58,32,105,111,99,116,108,
+  32,100,101,118,105,99,101,32,110,111,116,32,102,111,117,110,
+  100,0,0,1,144,137,5,129,16,188,127,129,16,133,127,10,
+  1,141,137,5,129,16,248,28,129,16,175,126,10,206,136,5,
+  213,137,5,193,1,231,136,5,0,203,248,133,139,13,215,137,
+  5,225,1,225,1,150,139,5,105,111,99,116,108,58,116,101,
+  114,109,45,115,105,122,101,0,0,129,16,172,54,45,110,110,
+  0,0,129,134,4,215,137,5,0,0,129,16,254,136,5,10,
+  188,137,5,251,137,5,193,1,231,136,5,0,201,204,184,193,
+  13,253,137,5,225,1,225,1,187,139,5,105,111,99,116,108,
+  58,115,101,116,45,99,98,114,101,97,107,0,0,129,16,172,
+  54,45,0,0,129,134,4,253,137,5,1,129,16,254,136,5,
+  10,225,137,5,159,138,5,193,1,231,136,5,0,247,149,197,
+  241,10,161,138,5,225,1,225,1,206,139,5,105,111,99,116,
+  108,58,115,101,116,45,108,98,114,101,97,107,0,0,129,16,
+  172,54,45,0,0,129,134,4,161,138,5,2,129,16,254,136,
+  5,10,133,138,5,195,138,5,193,1,231,136,5,0,209,169,
+  206,184,1,197,138,5,225,1,225,1,225,139,5,105,111,99,
+  116,108,58,115,97,118,101,45,115,116,97,116,101,0,0,129,
+  16,172,54,45,0,0,129,134,4,197,138,5,3,129,16,254,
+  136,5,10,169,138,5,234,138,5,193,1,231,136,5,0,167,
+  152,216,145,15,236,138,5,225,1,225,1,131,140,5,105,111,
+  99,116,108,58,114,101,115,116,111,114,101,45,115,116,97,116,
+  101,0,0,129,16,172,54,45,0,0,129,134,4,236,138,5,
+  4,129,16,254,136,5,10,80,101,114,102,111,114,109,32,97,
+  110,32,105,111,99,116,108,32,100,101,118,105,99,101,32,111,
+  112,101,114,97,116,105,111,110,0,0,82,101,116,117,114,110,
+  32,104,101,105,103,104,116,44,32,119,105,100,116,104,32,111,
+  102,32,116,104,101,32,116,101,114,109,105,110,97,108,0,0,
+  83,101,116,32,39,99,98,114,101,97,107,39,32,115,116,97,
+  116,101,0,0,83,101,116,32,39,108,98,114,101,97,107,39,
+  32,115,116,97,116,101,0,0,83,97,118,101,32,99,117,114,
+  114,101,110,116,32,105,111,99,116,108,32,115,101,116,116,105,
+  110,103,115,47,115,116,97,116,101,0,0,82,101,115,116,111,
+  114,101,32,115,97,118,101,100,32,105,111,99,116,108,101,32,
+  115,101,116,116,105,110,103,115,47,115,116,97,116,101,0,2 };
@@ -3,8 +3,18 @@
 #include "retro.h"
 #include "image.c"
 
+/* The embedded image is packed (see image_format.h). Memory has been
+   cleared by `prepare_vm()`. */
 V load_embedded_image(NgaState *vm) {
-  int i;
-  for (i = 0; i < ngaImageCells; i++)
-    vm->memory[i] = ngaImage[i];
+  if (ngaImageCells > MEMORY_SIZE) {
+    vm_printf(vm, "\nERROR (nga/load_embedded_image): Image is larger than alloted space!\n");
+    halt_vm(vm, 1);
+    return;
+  }
+  if (unpack_image(ngaImagePacked, ngaImagePackedBytes, vm->memory, MEMORY_SIZE) < 0) {
+    vm_printf(vm, "\nERROR (nga/load_embedded_image): Unable to unpack the image!\n");
+    halt_vm(vm, 1);
+    return;
+  }
+  mark_dirty(vm, 0, ngaImageCells);
 }
@@ -0,0 +1,184 @@
+/*---------------------------------------------------------------------
+  Packed Images
+
+  A packed image is a small header followed by one or more sections.
+  All fields are bytes or unsigned LEB128 varints, so the format does
+  not depend on the byte order of the host.
+
+    magic          "NGAz"
+    version        1 byte (PACKED_IMAGE_VERSION)
+    cell width     1 byte (4 or 8; the cell size of the VM that saved it)
+    layout         1 byte (PACKED_IMAGE_LAYOUT)
+    sections       1 byte
+
+  Each section is:
+
+    type           1 byte (PACKED_SECTION_*)
+    encoding       1 byte (PACKED_ENCODING_*)
+    origin         varint (first cell)
+    cells          varint
+    bytes          varint (length of the data that follows)
+
+  Loaders skip sections of types they do not know. The only type at
+  present holds memory. Its data is a varint per cell, holding the
+  value of the cell if it is above zero. A 0 is an escape, followed by
+  a varint `n`: if `n` is even, there is a run of `n / 2 + 1` zeros;
+  if odd, a negative value, `-(n >> 1) - 1`. Most cells are text or
+  small numbers, so this takes a little over a byte per cell.
+
+  Values are decoded as 64 bit numbers, so an image can be loaded by
+  a VM with a different cell size as long as every value fits.
+
+  The tools include this as well as the VM, so it only needs CELL to
+  be defined first.
+  ---------------------------------------------------------------------*/
+
+#ifndef RETRO_NGA_C_IMAGE_FORMAT_H
+#define RETRO_NGA_C_IMAGE_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PACKED_IMAGE_MAGIC      "NGAz"
+#define PACKED_IMAGE_VERSION    1
+#define PACKED_IMAGE_LAYOUT     1     /* tools/layout/image.tsv */
+#define PACKED_IMAGE_HEADER     8
+#define PACKED_SECTION_MEMORY   1
+#define PACKED_ENCODING_RUNS    1
+
+/* The largest possible section header, and the worst case for a cell */
+#define PACKED_SECTION_HEADER   32
+#define PACKED_CELL_BOUND       (sizeof(CELL) == 8 ? 11 : 6)
+
+static inline size_t packed_put(unsigned char *out, uint64_t value) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (unsigned char)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (unsigned char)value;
+  return n;
+}
+
+static inline int packed_get(const unsigned char **at, const unsigned char *end,
+                             uint64_t *value) {
+  uint64_t v = 0;
+  int shift = 0;
+  while (*at < end && shift < 64) {
+    unsigned char byte = *(*at)++;
+    v |= (uint64_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      *value = v;
+      return 1;
+    }
+    shift += 7;
+  }
+  return 0;
+}
+
+/* Returns nonzero if the data starts with a packed image header. */
+static inline int packed_image(const unsigned char *data, size_t bytes) {
+  return bytes >= PACKED_IMAGE_HEADER && memcmp(data, PACKED_IMAGE_MAGIC, 4) == 0;
+}
+
+/* The most space that packing `cells` cells can take. */
+static inline size_t packed_image_bound(CELL cells) {
+  return PACKED_IMAGE_HEADER + PACKED_SECTION_HEADER + (size_t)cells * PACKED_CELL_BOUND;
+}
+
+/* Pack `cells` cells of memory into `out`, which must have room for
+   packed_image_bound(cells) bytes. Returns the number of bytes used. */
+static inline size_t pack_image(const CELL *memory, CELL cells, unsigned char *out) {
+  unsigned char *body = out + PACKED_IMAGE_HEADER + PACKED_SECTION_HEADER;
+  size_t used = 0, at;
+  CELL i = 0, run;
+  int64_t value;
+  while (i < cells) {
+    value = memory[i++];
+    if (value > 0) {
+      used += packed_put(body + used, value);
+      continue;
+    }
+    body[used++] = 0;
+    if (value < 0) {
+      used += packed_put(body + used, ((uint64_t)(-(value + 1)) << 1) | 1);
+      continue;
+    }
+    for (run = 0; i < cells && memory[i] == 0; i++) run++;
+    used += packed_put(body + used, (uint64_t)run << 1);
+  }
+  memcpy(out, PACKED_IMAGE_MAGIC, 4);
+  out[4] = PACKED_IMAGE_VERSION;
+  out[5] = sizeof(CELL);
+  out[6] = PACKED_IMAGE_LAYOUT;
+  out[7] = 1;
+  at = PACKED_IMAGE_HEADER;
+  out[at++] = PACKED_SECTION_MEMORY;
+  out[at++] = PACKED_ENCODING_RUNS;
+  at += packed_put(out + at, 0);
+  at += packed_put(out + at, cells);
+  at += packed_put(out + at, used);
+  memmove(out + at, body, used);
+  return at + used;
+}
+
+static inline int unpack_section(const unsigned char *at, const unsigned char *end,
+                                 CELL *memory, CELL origin, CELL cells) {
+  CELL i = origin, last = origin + cells;
+  uint64_t code;
+  int64_t value;
+  while (i < last) {
+    if (!packed_get(&at, end, &code)) return 0;
+    if (code != 0) {
+      if (code > INT64_MAX) return 0;
+      value = (int64_t)code;
+    } else {
+      if (!packed_get(&at, end, &code)) return 0;
+      if (!(code & 1)) {
+        if ((code >> 1) >= (uint64_t)(last - i)) return 0;
+        i += (code >> 1) + 1;
+        continue;
+      }
+      value = -(int64_t)(code >> 1) - 1;
+    }
+    if ((CELL)value != value) return 0;
+    memory[i++] = (CELL)value;
+  }
+  return at == end;
+}
+
+/* Unpack an image into `memory`, which holds `limit` cells and must
+   already be zeroed (runs of zeros are skipped over, so the pages they
+   cover are never touched). Returns the size of the image in cells, or
+   -1 if the data is not a valid packed image or does not fit. */
+static inline CELL unpack_image(const unsigned char *data, size_t bytes,
+                                CELL *memory, CELL limit) {
+  const unsigned char *at = data + PACKED_IMAGE_HEADER, *end = data + bytes;
+  uint64_t origin, cells, length;
+  CELL size = 0;
+  int sections, type, encoding;
+  if (!packed_image(data, bytes) || data[4] != PACKED_IMAGE_VERSION ||
+      (data[5] != 4 && data[5] != 8) || data[6] != PACKED_IMAGE_LAYOUT)
+    return -1;
+  for (sections = data[7]; sections > 0; sections--) {
+    if (end - at < 2) return -1;
+    type = *at++;
+    encoding = *at++;
+    if (!packed_get(&at, end, &origin) || !packed_get(&at, end, &cells) ||
+        !packed_get(&at, end, &length) || length > (uint64_t)(end - at))
+      return -1;
+    if (type == PACKED_SECTION_MEMORY) {
+      if (encoding != PACKED_ENCODING_RUNS || origin > (uint64_t)limit ||
+          cells > (uint64_t)limit - origin ||
+          !unpack_section(at, at + length, memory, (CELL)origin, (CELL)cells))
+        return -1;
+      if ((CELL)(origin + cells) > size)
+        size = (CELL)(origin + cells);
+    }
+    at += length;
+  }
+  return size;
+}
+
+#endif
@@ -0,0 +1,619 @@
+/**************************************************************
+                _              __            _   _
+       _ __ ___| |_ _ __ ___  / _| ___  _ __| |_| |__
+      | '__/ _ \ __| '__/ _ \| |_ / _ \| '__| __| '_ \
+      | | |  __/ |_| | | (_) |  _| (_) | |  | |_| | | |
+      |_|  \___|\__|_|  \___/|_|  \___/|_|   \__|_| |_|
+                                                for nga
+
+      (c) Charles Childers, Luke Parrish, Marc Simpsonn,
+          Jay Skeer, Kenneth Keating
+
+**************************************************************/
+
+/*---------------------------------------------------------------------
+  libretro
+
+  This wraps the runtime in the API described in libretro.h. It is
+  built with the rest of the runtime and RETRO_LIBRARY defined, which
+  leaves out the command line host in retro.c.
+
+  The per-VM state the library needs (the output function, any host
+  devices, and the baseline for resets) is kept in a `RetroHost`, hung
+  off of `vm->host`.
+  ---------------------------------------------------------------------*/
+
+#include "retro.h"
+#include "libretro.h"
+
+#ifdef ENABLE_FFI
+#include <dlfcn.h>
+#endif
+
+struct RetroDevice {
+  retro_device handler;
+  void *context;
+  retro_cell id, version;
+};
+
+/* A baseline is shared by a VM and its clones, and freed with the
+   last of them. Its state has its own memory and stacks. */
+struct RetroBaseline {
+  NgaState state;
+  int references;
+};
+
+struct RetroHost {
+  retro_output output;
+  void *output_context;
+  struct RetroDevice devices[MAX_DEVICES];
+  struct RetroBaseline *baseline;
+  int ffi_borrowed;              /* Handles owned by the parent VM */
+};
+
+#define HOST ((struct RetroHost *)vm->host)
+
+int retro_api_version(void) {
+  return RETRO_API_VERSION;
+}
+
+int retro_cell_size(void) {
+  return sizeof(CELL);
+}
+
+
+/*---------------------------------------------------------------------
+  Output from the VM goes to the function the host provides, or is
+  dropped if there is none.
+  ---------------------------------------------------------------------*/
+
+static V host_output(NgaState *vm, const char *text, size_t length) {
+  if (HOST->output != NULL)
+    HOST->output(text, length, HOST->output_context);
+}
+
+void retro_set_output(RetroVM *vm, retro_output output, void *context) {
+  HOST->output = output;
+  HOST->output_context = context;
+}
+
+
+/*---------------------------------------------------------------------
+  Creating & Destroying VMs
+  ---------------------------------------------------------------------*/
+
+static NgaState *create_vm(retro_cell memory, retro_cell data, retro_cell address) {
+  NgaState *vm = calloc(1, sizeof(NgaState));
+  struct RetroHost *host = calloc(1, sizeof(struct RetroHost));
+  if (vm == NULL || host == NULL || memory > CELL_MAX ||
+      !allocate_vm(vm, (CELL)memory, (CELL)data, (CELL)address)) {
+    if (vm != NULL) free_vm(vm);
+    free(vm);
+    free(host);
+    return NULL;
+  }
+  vm->host = host;
+  vm->output = host_output;
+  initialize(vm);
+  register_devices(vm);
+  name_source(vm, "<none>");
+  if (vm->halted) {
+    retro_destroy(vm);
+    return NULL;
+  }
+  return vm;
+}
+
+RetroVM *retro_create(void) {
+  return retro_create_sized(IMAGE_SIZE, STACK_DEPTH, ADDRESSES);
+}
+
+RetroVM *retro_create_sized(retro_cell memory, retro_cell stack, retro_cell rstack) {
+  NgaState *vm = create_vm(memory, stack, rstack);
+  if (vm == NULL) return NULL;
+  update_rx(vm);
+  return vm;
+}
+
+RetroVM *retro_create_from_image(const void *image, size_t bytes) {
+  NgaState *vm;
+  CELL cells;
+  int packed = image != NULL && packed_image(image, bytes);
+  if (image == NULL || (!packed && bytes % sizeof(CELL) != 0))
+    return NULL;
+  vm = create_vm(IMAGE_SIZE, STACK_DEPTH, ADDRESSES);
+  if (vm == NULL) return NULL;
+  clear_memory(vm);
+  if (packed) {
+    cells = unpack_image(image, bytes, vm->memory, MEMORY_SIZE);
+  } else {
+    cells = bytes / sizeof(CELL) > (size_t)MEMORY_SIZE ? -1 : (CELL)(bytes / sizeof(CELL));
+    if (cells > 0) memcpy(vm->memory, image, bytes);
+  }
+  if (cells < 0) {
+    retro_destroy(vm);
+    return NULL;
+  }
+  mark_dirty(vm, 0, cells);
+  update_rx(vm);
+  return vm;
+}
+
+static V release_baseline(NgaState *vm) {
+  struct RetroBaseline *baseline = HOST->baseline;
+  HOST->baseline = NULL;
+  if (baseline != NULL &&
+      __atomic_sub_fetch(&baseline->references, 1, __ATOMIC_ACQ_REL) == 0) {
+    free_vm(&baseline->state);
+    free(baseline);
+  }
+}
+
+/* With ENABLE_THREADS, any cores that were started must have finished
+   before the VM is destroyed. */
+void retro_destroy(RetroVM *vm) {
+  int i;
+  if (vm == NULL) return;
+  image_wait(vm);
+  for (i = 1; i < MAX_OPEN_FILES; i++)
+    if (vm->OpenFileHandles[i] != NULL)
+      fclose(vm->OpenFileHandles[i]);
+#ifdef ENABLE_MULTICORE
+  for (i = 0; i < MAX_CHANNELS; i++) {
+    if (vm->channels[i].in_use) {
+      free(vm->channels[i].values);
+      free(vm->channels[i].sequence);
+    }
+  }
+#endif
+#ifdef ENABLE_SOCKETS
+  for (i = 0; i < SOCKET_SLOTS; i++)
+    if (vm->SocketUsed[i])
+      close(vm->SocketID[i]);
+  if (vm->socket_address != NULL)
+    freeaddrinfo(vm->socket_address);
+#endif
+#ifdef ENABLE_FFI
+  for (i = HOST->ffi_borrowed; i < vm->ffi_libraries; i++)
+    dlclose(vm->ffi_handles[i]);
+#endif
+#ifdef ENABLE_THREADS
+  pthread_mutex_destroy(&vm->core_lock);
+  pthread_cond_destroy(&vm->core_wake);
+  pthread_mutex_destroy(&vm->device_lock);
+#endif
+#ifdef ENABLE_EVENTS
+  pthread_mutex_destroy(&vm->event_lock);
+  pthread_cond_destroy(&vm->event_wake);
+#endif
+  release_baseline(vm);
+  free_vm(vm);
+  free(vm->host);
+  free(vm);
+}
+
+
+/*---------------------------------------------------------------------
+  Evaluation
+  ---------------------------------------------------------------------*/
+
+int retro_evaluate(RetroVM *vm, const char *source, size_t length) {
+  if (!vm->halted)
+    evaluate_source(vm, source, length);
+  return vm->halted ? vm->status : 0;
+}
+
+/* Returns the xt of the named word, or -1 if it is not defined. The
+   result stays valid until the word is redefined, so hosts can look a
+   word up once and call it many times. */
+retro_cell retro_find(RetroVM *vm, const char *name) {
+  CELL header = vm->memory[RETRO_IMAGE_DICTIONARY];
+  while (header > 0 && header < MEMORY_SIZE) {
+    if (strcmp(string_extract(vm, header + RETRO_DICT_OFFSET_NAME), name) == 0)
+      return vm->memory[header + RETRO_DICT_OFFSET_XT];
+    header = vm->memory[header + RETRO_DICT_OFFSET_LINK];
+  }
+  return -1;
+}
+
+int retro_call(RetroVM *vm, retro_cell xt) {
+  if (!vm->halted && xt >= 0 && xt < MEMORY_SIZE) {
+    execute(vm, (CELL)xt);
+    if (vm->perform_abort == -1)
+      carry_out_abort(vm);
+  }
+  return vm->halted ? vm->status : 0;
+}
+
+int retro_status(RetroVM *vm) {
+  return vm->halted ? vm->status : 0;
+}
+
+void retro_reset_status(RetroVM *vm) {
+  vm->halted = vm->status = 0;
+  vm->perform_abort = 0;
+  vm->ignoreToEOL = vm->ignoreToEOF = 0;
+}
+
+
+/*---------------------------------------------------------------------
+  The Data Stack
+  ---------------------------------------------------------------------*/
+
+void retro_push(RetroVM *vm, retro_cell value) {
+  if (ACTIVE.sp < DATA_DEPTH - 1)
+    stack_push(vm, (CELL)value);
+}
+
+retro_cell retro_pop(RetroVM *vm) {
+  if (ACTIVE.sp <= 0) return 0;
+  return stack_pop(vm);
+}
+
+int retro_depth(RetroVM *vm) {
+  return ACTIVE.sp;
+}
+
+
+/*---------------------------------------------------------------------
+  Memory
+  ---------------------------------------------------------------------*/
+
+static int valid_range(NgaState *vm, retro_cell address, size_t count) {
+  return address >= 0 && address <= MEMORY_SIZE &&
+         count <= (size_t)(MEMORY_SIZE - address);
+}
+
+retro_cell retro_fetch(RetroVM *vm, retro_cell address) {
+  return valid_range(vm, address, 1) ? vm->memory[address] : 0;
+}
+
+void retro_store(RetroVM *vm, retro_cell address, retro_cell value) {
+  if (valid_range(vm, address, 1)) {
+    vm->memory[address] = (CELL)value;
+    MARK_DIRTY(vm, address);
+  }
+}
+
+long retro_read(RetroVM *vm, retro_cell address, retro_cell *cells, size_t count) {
+  size_t i;
+  if (!valid_range(vm, address, count)) return -1;
+  for (i = 0; i < count; i++)
+    cells[i] = vm->memory[address + i];
+  return count;
+}
+
+long retro_write(RetroVM *vm, retro_cell address, const retro_cell *cells, size_t count) {
+  size_t i;
+  if (!valid_range(vm, address, count)) return -1;
+  for (i = 0; i < count; i++)
+    vm->memory[address + i] = (CELL)cells[i];
+  mark_dirty(vm, address, count);
+  return count;
+}
+
+retro_cell retro_memory_size(RetroVM *vm) {
+  return MEMORY_SIZE;
+}
+
+
+/*---------------------------------------------------------------------
+  Host Devices
+
+  Every host device is registered with the same pair of handlers. The
+  core records the device number in `vm->io_device` before calling
+  them, which is used to find the host's handler and context.
+  ---------------------------------------------------------------------*/
+
+static V io_host(NgaState *vm) {
+  struct RetroDevice *device = &HOST->devices[vm->io_device];
+  device->handler(vm, device->context);
+}
+
+static V query_host(NgaState *vm) {
+  struct RetroDevice *device = &HOST->devices[vm->io_device];
+  stack_push(vm, (CELL)device->version);
+  stack_push(vm, (CELL)device->id);
+}
+
+int retro_register_device(RetroVM *vm, retro_cell id, retro_cell version,
+                          retro_device handler, void *context) {
+  struct RetroDevice *device;
+  if (vm->devices >= MAX_DEVICES || handler == NULL) return -1;
+  device = &HOST->devices[vm->devices];
+  device->handler = handler;
+  device->context = context;
+  device->id = id;
+  device->version = version;
+  register_device(vm, io_host, query_host);
+  return vm->devices - 1;
+}
+
+
+/*---------------------------------------------------------------------
+  Events
+  ---------------------------------------------------------------------*/
+
+int retro_post_event(RetroVM *vm, retro_cell type, const retro_cell *payload,
+                     size_t count) {
+#ifdef ENABLE_EVENTS
+  CELL cells[EVENT_PAYLOAD_SIZE];
+  size_t i;
+  if (count > EVENT_PAYLOAD_SIZE) return -1;
+  for (i = 0; i < count; i++)
+    cells[i] = (CELL)payload[i];
+  return post_event(vm, (CELL)type, (CELL)count, cells) ? 0 : -1;
+#else
+  return -1;
+#endif
+}
+
+
+/*---------------------------------------------------------------------
+  Pools
+
+  For serving many short requests, a host can keep a pool of VMs and
+  return each one to a known state after use.
+
+  `retro_snapshot()` copies the VM into a baseline. Every write to
+  memory flags its page (see `MARK_DIRTY()`), so `retro_reset()` only
+  copies back the pages written since, then restores the rest of the
+  state from the baseline. The cost of a reset follows the number of
+  pages touched, not the size of the image.
+
+  `retro_clone()` makes a new VM from the current state of another.
+  The baseline is shared (and reference counted), but memory is not
+  copy-on-write: each page the parent has written is copied into the
+  clone up front. A clone therefore costs a copy of the touched pages,
+  about the size of the image in use, plus the stacks. Copy-on-write
+  would need memory to be a table of shared pages rather than one
+  array, adding an indirection to every fetch and store.
+
+  Files, sockets, and FFI libraries opened since the baseline are
+  closed on reset. Channels are kept, but emptied. A clone does not
+  get the files or sockets of its parent.
+  ---------------------------------------------------------------------*/
+
+static V copy_page(NgaState *to, NgaState *from, CELL page) {
+  CELL start = page << DIRTY_PAGE_SHIFT;
+  CELL count = from->memory_size + 1 - start;
+  if (count > (1 << DIRTY_PAGE_SHIFT)) count = 1 << DIRTY_PAGE_SHIFT;
+  memcpy(&to->memory[start], &from->memory[start], count * sizeof(CELL));
+}
+
+/* Pages that were never written are zero, so only the others need to
+   be copied to memory that is also unused. */
+static V copy_memory(NgaState *to, NgaState *from) {
+  CELL page;
+  for (page = 0; page < (from->memory_size >> DIRTY_PAGE_SHIFT) + 1; page++)
+    if (from->dirty[page] & DIRTY_TOUCHED)
+      copy_page(to, from, page);
+  memcpy(to->dirty, from->dirty, (from->memory_size >> DIRTY_PAGE_SHIFT) + 1);
+}
+
+/* The stacks are copied, but each VM keeps its own buffers */
+static V copy_core(struct NgaCore *to, struct NgaCore *from) {
+  CELL *data = to->data, *address = to->address;
+#ifdef ENABLE_FLOATS
+  double *floats = to->Floats, *alternate = to->AFloats;
+#endif
+  *to = *from;
+  to->data = data;
+  to->address = address;
+  memcpy(data, from->data, (from->sp + 1) * sizeof(CELL));
+  memcpy(address, from->address, (from->rp + 1) * sizeof(CELL));
+#ifdef ENABLE_FLOATS
+  to->Floats = floats;
+  to->AFloats = alternate;
+  if (from->Floats != NULL && floats != NULL) {
+    memcpy(floats, from->Floats, (from->fsp + 1) * sizeof(double));
+    memcpy(alternate, from->AFloats, (from->afsp + 1) * sizeof(double));
+  }
+#endif
+}
+
+static int copy_cores(NgaState *vm, NgaState *from) {
+  int i;
+#ifdef ENABLE_FLOATS
+  if (from->floats != NULL && !allocate_floats(vm)) return -1;
+#endif
+  for (i = 0; i < CORES; i++)
+    copy_core(&vm->cpu[i], &from->cpu[i]);
+  return 0;
+}
+
+static int restore_channels(NgaState *vm, NgaState *from) {
+#ifdef ENABLE_MULTICORE
+  struct NgaChannel *c, *f;
+  size_t i, j;
+  for (i = 0; i < MAX_CHANNELS; i++) {
+    c = &vm->channels[i];
+    f = &from->channels[i];
+    if (c->in_use && (!f->in_use || c->mask != f->mask)) {
+      free(c->values);
+      free(c->sequence);
+      c->in_use = 0;
+    }
+    if (f->in_use && !c->in_use) {
+      c->values = malloc((f->mask + 1) * sizeof(CELL));
+      c->sequence = malloc((f->mask + 1) * sizeof(size_t));
+      if (c->values == NULL || c->sequence == NULL) {
+        free(c->values);
+        free(c->sequence);
+        return -1;
+      }
+      c->mask = f->mask;
+      c->in_use = 1;
+    }
+    if (c->in_use) {
+      for (j = 0; j <= c->mask; j++) c->sequence[j] = j;
+      c->head = c->tail = 0;
+    }
+  }
+  memcpy(vm->mailboxes, from->mailboxes, sizeof(vm->mailboxes));
+  vm->channel_waiters = 0;
+#endif
+  return 0;
+}
+
+static V release_resources(NgaState *vm, NgaState *from) {
+  int i;
+  for (i = 1; i < MAX_OPEN_FILES; i++) {
+    if (vm->OpenFileHandles[i] != NULL &&
+        vm->OpenFileHandles[i] != from->OpenFileHandles[i]) {
+      fclose(vm->OpenFileHandles[i]);
+      vm->OpenFileHandles[i] = NULL;
+    }
+  }
+#ifdef ENABLE_SOCKETS
+  for (i = 0; i < SOCKET_SLOTS; i++) {
+    if (vm->SocketUsed[i] &&
+        !(from->SocketUsed[i] && from->SocketID[i] == vm->SocketID[i])) {
+      close(vm->SocketID[i]);
+      vm->SocketUsed[i] = 0;
+    }
+  }
+  if (vm->socket_address != from->socket_address) {
+    if (vm->socket_address != NULL)
+      freeaddrinfo(vm->socket_address);
+    vm->socket_address = NULL;
+  }
+#endif
+#ifdef ENABLE_FFI
+  for (i = from->ffi_libraries; i < vm->ffi_libraries; i++)
+    if (i >= HOST->ffi_borrowed)
+      dlclose(vm->ffi_handles[i]);
+  if (vm->ffi_libraries > from->ffi_libraries)
+    vm->ffi_libraries = from->ffi_libraries;
+  if (HOST->ffi_borrowed > vm->ffi_libraries)
+    HOST->ffi_borrowed = vm->ffi_libraries;
+  if (vm->ffi_mapped > from->ffi_mapped)
+    vm->ffi_mapped = from->ffi_mapped;
+#endif
+}
+
+/* Everything but memory, files, sockets, FFI libraries, and the state
+   that belongs to the host. */
+static int restore_state(NgaState *vm, NgaState *from) {
+  release_resources(vm, from);
+  if (restore_channels(vm, from) != 0 || copy_cores(vm, from) != 0 ||
+      copy_sources(vm, from) != 0)
+    return -1;
+  reset_autoload(vm);
+  vm->active = from->active;
+#ifdef ENABLE_MULTICORE
+  memcpy(vm->run_queue, from->run_queue, sizeof(vm->run_queue));
+  vm->queued = from->queued;
+  vm->queue_at = from->queue_at;
+  vm->slice = from->slice;
+  vm->ticks = from->ticks;
+  vm->parked = from->parked;
+  memcpy(vm->work_top, from->work_top, sizeof(vm->work_top));
+  memcpy(vm->work_bottom, from->work_bottom, sizeof(vm->work_bottom));
+#endif
+  vm->devices = from->devices;
+  memcpy(vm->IO_deviceHandlers, from->IO_deviceHandlers, sizeof(vm->IO_deviceHandlers));
+  memcpy(vm->IO_queryHandlers, from->IO_queryHandlers, sizeof(vm->IO_queryHandlers));
+#ifdef ENABLE_EVENTS
+  drain_events(vm);
+  vm->event_handler = from->event_handler;
+  vm->event_handler_rp = 0;
+#endif
+  vm->Dictionary = from->Dictionary;
+  vm->interpret = from->interpret;
+#ifdef ENABLE_BLOCKS
+  strlcpy(vm->text->BlockFile, from->text->BlockFile, sizeof(vm->text->BlockFile));
+#endif
+#ifdef ENABLE_ERROR
+  memcpy(vm->ErrorHandlers, from->ErrorHandlers, sizeof(vm->ErrorHandlers));
+#endif
+#ifdef ENABLE_CLOCK
+  vm->current_time = from->current_time;
+#endif
+  vm->halted = from->halted;
+  vm->status = from->status;
+  vm->verbose = from->verbose;
+  vm->sys_argv = from->sys_argv;
+  vm->sys_argc = from->sys_argc;
+  vm->perform_abort = from->perform_abort;
+  vm->interactive = from->interactive;
+  vm->currentLine = from->currentLine;
+  vm->ignoreToEOL = from->ignoreToEOL;
+  vm->ignoreToEOF = from->ignoreToEOF;
+  strlcpy(vm->text->code_start, from->text->code_start, sizeof(vm->text->code_start));
+  strlcpy(vm->text->code_end, from->text->code_end, sizeof(vm->text->code_end));
+  strlcpy(vm->text->test_start, from->text->test_start, sizeof(vm->text->test_start));
+  strlcpy(vm->text->test_end, from->text->test_end, sizeof(vm->text->test_end));
+  vm->codeBlocks = from->codeBlocks;
+  return 0;
+}
+
+int retro_snapshot(RetroVM *vm) {
+  struct RetroBaseline *baseline = malloc(sizeof(struct RetroBaseline));
+  CELL i;
+  if (baseline == NULL) return -1;
+  memcpy(&baseline->state, vm, sizeof(NgaState));
+  if (!allocate_vm(&baseline->state, MEMORY_SIZE, DATA_DEPTH, ADDRESS_DEPTH)) {
+    free(baseline);
+    return -1;
+  }
+  copy_memory(&baseline->state, vm);
+  memcpy(baseline->state.text, vm->text, sizeof(struct NgaText));
+  if (copy_cores(&baseline->state, vm) != 0 ||
+      copy_sources(&baseline->state, vm) != 0) {
+    free_vm(&baseline->state);
+    free(baseline);
+    return -1;
+  }
+  baseline->references = 1;
+  release_baseline(vm);
+  HOST->baseline = baseline;
+  for (i = 0; i < DIRTY_PAGES; i++)
+    vm->dirty[i] &= ~DIRTY_BASELINE;
+  return 0;
+}
+
+int retro_reset(RetroVM *vm) {
+  NgaState *from;
+  CELL page;
+  if (HOST->baseline == NULL) return -1;
+  from = &HOST->baseline->state;
+  for (page = 0; page < DIRTY_PAGES; page++) {
+    if (!(vm->dirty[page] & DIRTY_BASELINE)) continue;
+    copy_page(vm, from, page);
+    vm->dirty[page] = 0xff & ~DIRTY_BASELINE;
+  }
+  return restore_state(vm, from);
+}
+
+RetroVM *retro_clone(RetroVM *parent) {
+  NgaState *vm = create_vm(parent->memory_size, parent->data_depth,
+                           parent->address_depth);
+  if (vm == NULL) return NULL;
+  clear_memory(vm);
+  copy_memory(vm, parent);
+  memcpy(HOST->devices, ((struct RetroHost *)parent->host)->devices,
+         sizeof(HOST->devices));
+  HOST->output = ((struct RetroHost *)parent->host)->output;
+  HOST->output_context = ((struct RetroHost *)parent->host)->output_context;
+  HOST->baseline = ((struct RetroHost *)parent->host)->baseline;
+  if (HOST->baseline != NULL)
+    __atomic_add_fetch(&HOST->baseline->references, 1, __ATOMIC_ACQ_REL);
+#ifdef ENABLE_FFI
+  if (!ffi_reserve(vm, parent->ffi_mapped)) {
+    retro_destroy(vm);
+    return NULL;
+  }
+  memcpy(vm->ffi_handles, parent->ffi_handles, sizeof(vm->ffi_handles));
+  if (parent->ffi_mapped > 0)
+    memcpy(vm->ffi_functions, parent->ffi_functions,
+           parent->ffi_mapped * sizeof(vm->ffi_functions[0]));
+  vm->ffi_libraries = HOST->ffi_borrowed = parent->ffi_libraries;
+  vm->ffi_mapped = parent->ffi_mapped;
+#endif
+  if (restore_state(vm, parent) != 0) {
+    retro_destroy(vm);
+    return NULL;
+  }
+  return vm;
+}
@@ -0,0 +1,132 @@
+/**************************************************************
+                _              __            _   _
+       _ __ ___| |_ _ __ ___  / _| ___  _ __| |_| |__
+      | '__/ _ \ __| '__/ _ \| |_ / _ \| '__| __| '_ \
+      | | |  __/ |_| | | (_) |  _| (_) | |  | |_| | | |
+      |_|  \___|\__|_|  \___/|_|  \___/|_|   \__|_| |_|
+                                                for nga
+
+      (c) Charles Childers, Luke Parrish, Marc Simpsonn,
+          Jay Skeer, Kenneth Keating
+
+**************************************************************/
+
+/*---------------------------------------------------------------------
+  libretro: the RETRO runtime as a library.
+
+  Build with `make library`, which produces bin/libretro.a and
+  bin/libretro.so. Include this header and link with -lretro (plus
+  -lm, -ldl, and -lpthread as your platform requires).
+
+  Each RetroVM is independent, so several can be used at once, from
+  different host threads if desired. Nothing in the library exits the
+  process or writes to stdout; output is passed to the function set
+  with `retro_set_output()` and is discarded until one is set.
+
+  Values cross the API as `retro_cell`, which is wide enough for both
+  the 32 and 64 bit builds of the VM.
+
+  The API is versioned. Incompatible changes increase
+  RETRO_API_VERSION; `retro_api_version()` reports the version the
+  library was built with.
+
+  The library is built with -fvisibility=hidden; only the functions
+  marked RETRO_API below are exported.
+  ---------------------------------------------------------------------*/
+
+#ifndef RETRO_LIBRETRO_H
+#define RETRO_LIBRETRO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETRO_API_VERSION 1
+
+#if defined(__GNUC__) && __GNUC__ >= 4
+#define RETRO_API __attribute__((visibility("default")))
+#else
+#define RETRO_API
+#endif
+
+typedef struct NgaState RetroVM;
+typedef int64_t retro_cell;
+
+typedef void (*retro_output)(const char *text, size_t length, void *context);
+typedef void (*retro_device)(RetroVM *vm, void *context);
+
+RETRO_API int retro_api_version(void);
+RETRO_API int retro_cell_size(void);
+
+/* Creating & Destroying VMs. `retro_create_sized()` takes the number
+   of cells of memory and the depths of the data and address stacks;
+   the others use the defaults the library was built with. Memory is
+   only committed as it is used. `retro_create_from_image()` takes the
+   contents of an image file (such as ngaImage), either packed or raw
+   cells in the VM's own cell size. All return NULL on failure. */
+RETRO_API RetroVM *retro_create(void);
+RETRO_API RetroVM *retro_create_sized(retro_cell memory, retro_cell stack, retro_cell rstack);
+RETRO_API RetroVM *retro_create_from_image(const void *image, size_t bytes);
+RETRO_API void retro_destroy(RetroVM *vm);
+
+RETRO_API void retro_set_output(RetroVM *vm, retro_output output, void *context);
+
+/* Evaluation. These return 0, or the status passed to `bye` or
+   `unix:exit` (or 1 for a fatal error) once the VM has halted. A
+   halted VM does no further work until `retro_reset_status()`. */
+RETRO_API int retro_evaluate(RetroVM *vm, const char *source, size_t length);
+RETRO_API retro_cell retro_find(RetroVM *vm, const char *name);
+RETRO_API int retro_call(RetroVM *vm, retro_cell xt);
+RETRO_API int retro_status(RetroVM *vm);
+RETRO_API void retro_reset_status(RetroVM *vm);
+
+/* The data stack */
+RETRO_API void retro_push(RetroVM *vm, retro_cell value);
+RETRO_API retro_cell retro_pop(RetroVM *vm);
+RETRO_API int retro_depth(RetroVM *vm);
+
+/* Memory. The bulk forms return the number of cells copied, or -1 if
+   the range is outside of the image. */
+RETRO_API retro_cell retro_fetch(RetroVM *vm, retro_cell address);
+RETRO_API void retro_store(RetroVM *vm, retro_cell address, retro_cell value);
+RETRO_API long retro_read(RetroVM *vm, retro_cell address, retro_cell *cells, size_t count);
+RETRO_API long retro_write(RetroVM *vm, retro_cell address, const retro_cell *cells, size_t count);
+RETRO_API retro_cell retro_memory_size(RetroVM *vm);
+
+/* Devices. A registered device is visible to `io:scan-for` under the
+   given identifier and version. The handler is run for each `ii`
+   sent to it and uses `retro_push()` / `retro_pop()` to exchange
+   values. Returns the device number, or -1 if no slots remain. */
+RETRO_API int retro_register_device(RetroVM *vm, retro_cell id, retro_cell version,
+                                    retro_device handler, void *context);
+
+/* Pools. `retro_snapshot()` records the current state of the VM as
+   its baseline, and `retro_reset()` returns the VM to it. Only the
+   memory written since the snapshot is copied back. Files, sockets,
+   and FFI libraries opened since are closed, and channels and the
+   event queue are emptied. `retro_clone()` creates a new VM with the
+   current state of another. Both use the same baseline for resets,
+   but the clone's memory is not shared with its parent: every page
+   the parent has written is copied when the clone is made. None of
+   these may be used while cores other than the first are running.
+   The first two return 0, or -1 on failure (or if there is no baseline). */
+RETRO_API int retro_snapshot(RetroVM *vm);
+RETRO_API int retro_reset(RetroVM *vm);
+RETRO_API RetroVM *retro_clone(RetroVM *parent);
+
+/* Events. Queue an event (a type and up to `event:max-payload` cells)
+   for the VM. Unlike the rest of the API, this can be called from any
+   thread, including while the VM is running. Returns 0, or -1 if the
+   queue is full, the payload is too large, or the library was built
+   without the events device. */
+RETRO_API int retro_post_event(RetroVM *vm, retro_cell type, const retro_cell *payload,
+                               size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -25,18 +25,18 @@ V guard(NgaState *vm, int n, int m, int diff) {
       handle_error(vm, 1);
     }
 #else
-    printf("E: Data Stack Underflow");
+    vm_printf(vm, "E: Data Stack Underflow");
     ACTIVE.sp = 0;
     return;
 #endif
   }
-  if (((ACTIVE.sp + m) - n) > (STACK_DEPTH - 1)) {
+  if (((ACTIVE.sp + m) - n) > (DATA_DEPTH - 1)) {
 #ifdef ENABLE_ERROR
     if (vm->ErrorHandlers[2] != 0) {
       handle_error(vm, 2);
     }
 #else
-    printf("E: Data Stack Overflow");
+    vm_printf(vm, "E: Data Stack Overflow");
     ACTIVE.sp = 0;
     return;
 #endif
@@ -51,7 +51,7 @@ V guard(NgaState *vm, int n, int m, int diff) {
       return;
 #endif
     }
-    if (ACTIVE.rp + diff > (ADDRESSES - 1)) {
+    if (ACTIVE.rp + diff > (ADDRESS_DEPTH - 1)) {
 #ifdef ENABLE_ERROR
     if (vm->ErrorHandlers[1] != 4) {
       handle_error(vm, 4);
@@ -70,18 +70,18 @@ V guard(NgaState *vm, int n, int m, int diff) {
       handle_error(vm, 1);
     }
 #else
-    printf("E: Data Stack Underflow");
+    vm_printf(vm, "E: Data Stack Underflow");
     ACTIVE.sp = 0;
     return;
 #endif
   }
-  if (unlikely(((ACTIVE.sp + m) - n) > (STACK_DEPTH - 1))) {
+  if (unlikely(((ACTIVE.sp + m) - n) > (DATA_DEPTH - 1))) {
 #ifdef ENABLE_ERROR
     if (vm->ErrorHandlers[2] != 0) {
       handle_error(vm, 2);
     }
 #else
-    printf("E: Data Stack Overflow");
+    vm_printf(vm, "E: Data Stack Overflow");
     ACTIVE.sp = 0;
     return;
 #endif
@@ -95,7 +95,7 @@ V guard(NgaState *vm, int n, int m, int diff) {
       return;
 #endif
   }
-  if (unlikely(ACTIVE.rp + diff > (ADDRESSES - 1))) {
+  if (unlikely(ACTIVE.rp + diff > (ADDRESS_DEPTH - 1))) {
 #ifdef ENABLE_ERROR
     if (vm->ErrorHandlers[1] != 4) {
       handle_error(vm, 4);
@@ -118,52 +118,160 @@ V guard(NgaState *vm, int n, int m, int diff) {
 
 V invalid_opcode(NgaState *vm, CELL opcode) {
   CELL a, i;
-  printf("\nERROR (nga/execute): Invalid instruction!\n");
-  printf("At %lld, opcode %lld\n", (long long)ACTIVE.ip, (long long)opcode);
-  printf("Instructions: ");
+  vm_printf(vm, "\nERROR (nga/execute): Invalid instruction!\n");
+  vm_printf(vm, "At %lld, opcode %lld\n", (long long)ACTIVE.ip, (long long)opcode);
+  vm_printf(vm, "Instructions: ");
   a = opcode;
   for (i = 0; i < 4; i++) {
-    printf("%lldd ", (long long)a & 0xFF);
+    vm_printf(vm, "%lldd ", (long long)a & 0xFF);
     a = a >> 8;
   }
-  printf("\n");
-  exit(1);
+  vm_printf(vm, "\n");
+  halt_vm(vm, 1);
 }
 
+/*---------------------------------------------------------------------
+  Errors that used to end the process now halt the VM instead. This
+  flags the VM as halted, records the status for the host, and uses
+  the abort machinery to unwind any nested `include`s. The host checks
+  `vm->halted` and returns `vm->status` when it sees it.
+  ---------------------------------------------------------------------*/
+
+V halt_vm(NgaState *vm, int status) {
+  vm->halted = -1;
+  vm->status = status;
+  vm->ignoreToEOL = -1;
+  vm->ignoreToEOF = -1;
+  vm->perform_abort = -1;
+}
+
+/* Flag the pages holding `count` cells from `start` as written. Code
+   that writes to memory other than with `i_st` should call this. */
+V mark_dirty(NgaState *vm, CELL start, CELL count) {
+  CELL page;
+  if (count <= 0) return;
+  for (page = start >> DIRTY_PAGE_SHIFT;
+       page <= (start + count - 1) >> DIRTY_PAGE_SHIFT; page++)
+    vm->dirty[page] = 0xff;
+}
+
+/*---------------------------------------------------------------------
+  All output from the VM and its devices goes through `vm_write()`, so
+  an embedding host can capture it instead of having it go to stdout.
+  ---------------------------------------------------------------------*/
+
+V vm_write(NgaState *vm, const char *text, size_t length) {
+  if (vm->output != NULL)
+    vm->output(vm, text, length);
+  else
+    display_utf8((const unsigned char *)text, length);
+}
+
+V vm_printf(NgaState *vm, const char *format, ...) {
+  char buffer[1024];
+  va_list args;
+  int length;
+  va_start(args, format);
+  length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) return;
+  if (length >= (int)sizeof(buffer)) length = sizeof(buffer) - 1;
+  vm_write(vm, buffer, length);
+}
+
+/*---------------------------------------------------------------------
+  After each bundle, `execute` checks the stacks, moves to the next
+  cell, and gives the other cores a turn. The code that `retro-aot`
+  generates does the same through `aot_next()`.
+  ---------------------------------------------------------------------*/
+
+/* The limits are checked even with ENABLE_ERROR, where `guard` only
+   reports an overflow if a handler is set. A bundle that went past
+   the slack would write over the next core's stacks. */
+static inline int finish_bundle(NgaState *vm, CELL opcode, CELL core) {
+  if (ACTIVE.sp < 0 || ACTIVE.sp > DATA_DEPTH) {
+    vm_printf(vm, "\nERROR (nga/execute): Stack Limits Exceeded!\n");
+    vm_printf(vm, "At %lld, opcode %lld. sp = %lld, core = %lld\n", (long long)ACTIVE.ip, (long long)opcode, (long long)ACTIVE.sp, (long long)CURRENT_CORE);
+    halt_vm(vm, 1);
+    return 0;
+  }
+  if (ACTIVE.rp < 0 || ACTIVE.rp > ADDRESS_DEPTH) {
+    vm_printf(vm, "\nERROR (nga/execute): Address Stack Limits Exceeded!\n");
+    vm_printf(vm, "At %lld, opcode %lld. rp = %lld\n", (long long)ACTIVE.ip, (long long)opcode, (long long)ACTIVE.rp);
+    halt_vm(vm, 1);
+    return 0;
+  }
+  ACTIVE.ip++;
+#ifdef ENABLE_THREADS
+  (void)core;
+  if (!ACTIVE.active)
+    park_core(vm);
+#elif defined(ENABLE_MULTICORE)
+  if (ACTIVE.rp == 0 && vm->active != core)
+    finish_core(vm, core);
+  if (--vm->ticks <= 0)
+    switch_core(vm);
+#else
+  (void)core;
+#endif
+  if (ACTIVE.rp == 0)
+    ACTIVE.ip = MEMORY_SIZE;
+  return 1;
+}
+
+#ifdef AOT
+/* Returns nonzero if the compiled code can go straight on to the
+   bundle at the new `ip`, or zero if `execute` needs to look at it
+   first. */
+int aot_next(NgaState *vm, CELL opcode, CELL core) {
+  if (!finish_bundle(vm, opcode, core))
+    return 0;
+#ifdef ENABLE_EVENTS
+  if (CURRENT_CORE == 0 && vm->event_handler != 0)
+    return 0;
+#endif
+  return ACTIVE.ip >= 0 && ACTIVE.ip < MEMORY_SIZE && vm->perform_abort == 0;
+}
+#endif
+
 V execute(NgaState *vm, CELL cell) {
   CELL opcode;
+  CELL core = CURRENT_CORE;
+#ifdef ENABLE_THREADS
+  int held = device_lock_release(vm);
+#endif
   if (ACTIVE.rp == 0)
     ACTIVE.rp = 1;
   ACTIVE.ip = cell;
-  while (ACTIVE.ip >= 0 && ACTIVE.ip < IMAGE_SIZE) {
+  while (ACTIVE.ip >= 0 && ACTIVE.ip < MEMORY_SIZE) {
     if (vm->perform_abort == 0) {
+#ifdef ENABLE_EVENTS
+      if (CURRENT_CORE == 0 && vm->event_handler != 0) {
+        if (vm->event_handler_rp != 0 && ACTIVE.rp < vm->event_handler_rp)
+          vm->event_handler_rp = 0;
+        if (vm->event_handler_rp == 0 &&
+            __atomic_load_n(&vm->event_signal, __ATOMIC_RELAXED))
+          dispatch_events(vm);
+      }
+#endif
+#ifdef AOT
+      if (aot_run(vm, core))
+        continue;
+#endif
       opcode = vm->memory[ACTIVE.ip];
 #ifndef BRANCH_PREDICTION
-      validate_opcode_bundle(vm, opcode);
+      if (!validate_opcode_bundle(vm, opcode))
+        continue;
 #endif
       process_opcode_bundle(vm, opcode);
-#ifndef ENABLE_ERROR
-      if (ACTIVE.sp < 0 || ACTIVE.sp > STACK_DEPTH) {
-        printf("\nERROR (nga/execute): Stack Limits Exceeded!\n");
-        printf("At %lld, opcode %lld. sp = %lld, core = %lld\n", (long long)ACTIVE.ip, (long long)opcode, (long long)ACTIVE.sp, (long long)vm->active);
-        exit(1);
-      }
-      if (ACTIVE.rp < 0 || ACTIVE.rp > ADDRESSES) {
-        printf("\nERROR (nga/execute): Address Stack Limits Exceeded!\n");
-        printf("At %lld, opcode %lld. rp = %lld\n", (long long)ACTIVE.ip, (long long)opcode, (long long)ACTIVE.rp);
-        exit(1);
-      }
-#endif
-      ACTIVE.ip++;
-#ifdef ENABLE_MULTICORE
-      switch_core(vm);
-#endif
-      if (ACTIVE.rp == 0)
-        ACTIVE.ip = IMAGE_SIZE;
+      finish_bundle(vm, opcode, core);
     } else {
       carry_out_abort(vm);
     }
   }
+#ifdef ENABLE_THREADS
+  device_lock_restore(vm, held);
+#endif
 }
 
 /*---------------------------------------------------------------------
@@ -214,45 +322,244 @@ V register_device(NgaState *vm, Handler handler, Handler query) {
   vm->devices++;
 }
 
+/*---------------------------------------------------------------------
+  Memory is reserved with `mmap()`. The system only commits pages as
+  they are first touched, so a VM can be given far more memory than it
+  will use without paying for it up front. On Windows it is allocated
+  with `calloc()` instead, and clearing it falls back to `memset()`.
+  ---------------------------------------------------------------------*/
+
+#define MEMORY_BYTES(cells) (((size_t)(cells) + 1) * sizeof(CELL))
+
+#ifndef _WIN32
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+
+static CELL *map_memory(CELL *at, CELL cells) {
+  void *memory = mmap(at, MEMORY_BYTES(cells), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE |
+                      (at != NULL ? MAP_FIXED : 0), -1, 0);
+  return memory == MAP_FAILED ? NULL : memory;
+}
+
+static V unmap_memory(CELL *memory, CELL cells) {
+  munmap(memory, MEMORY_BYTES(cells));
+}
+#else
+/* Existing memory can't be replaced, so this fails when `at` is set */
+static CELL *map_memory(CELL *at, CELL cells) {
+  if (at != NULL) return NULL;
+  return calloc((size_t)cells + 1, sizeof(CELL));
+}
+
+static V unmap_memory(CELL *memory, CELL cells) {
+  free(memory);
+}
+#endif
+
+/* The stack limits are checked after each bundle, which can push or
+   drop up to four values. A stack pointer may be at the limit itself
+   when checked, so each stack has room for one more than that at
+   either end. */
+#define STACK_SLACK 5
+
+/* Any buffers the state refers to are forgotten, not freed, so a copy
+   of another VM's state can be given buffers of its own. */
+static V forget_buffers(NgaState *vm) {
+  int i;
+  vm->memory = NULL;
+  vm->dirty = NULL;
+  vm->stacks = NULL;
+  vm->text = NULL;
+  vm->sources = NULL;
+  vm->current_source = vm->source_slots = 0;
+  vm->autoload = NULL;
+  vm->metadata = NULL;
+  vm->file_bytes = NULL;
+#ifdef COUNT_CALLS
+  vm->calls = NULL;
+#endif
+  for (i = 0; i < CORES; i++)
+    vm->cpu[i].data = vm->cpu[i].address = NULL;
+#ifdef ENABLE_FLOATS
+  vm->floats = NULL;
+  for (i = 0; i < CORES; i++)
+    vm->cpu[i].Floats = vm->cpu[i].AFloats = NULL;
+#endif
+#ifdef ENABLE_MULTICORE
+  vm->work = NULL;
+#endif
+#ifdef ENABLE_EVENTS
+  vm->events = NULL;
+#endif
+#ifdef ENABLE_FFI
+  vm->ffi_functions = NULL;
+  vm->ffi_slots = 0;
+#endif
+}
+
+/* Returns 0 if the sizes are invalid or there is not enough memory */
+int allocate_vm(NgaState *vm, CELL memory, CELL data, CELL address) {
+  size_t stride = (size_t)data + (size_t)address + 4 * STACK_SLACK;
+  int i, ok;
+  forget_buffers(vm);
+  if (memory < 1 || data < 2 || address < 2 ||
+      (size_t)memory > SIZE_MAX / sizeof(CELL) - 1 ||
+      (size_t)data > SIZE_MAX / 4 || (size_t)address > SIZE_MAX / 4 ||
+      stride > SIZE_MAX / sizeof(CELL) / CORES)
+    return 0;
+  vm->memory = map_memory(NULL, memory);
+  vm->memory_size = memory;
+  vm->dirty = calloc((memory >> DIRTY_PAGE_SHIFT) + 1, 1);
+  vm->stacks = calloc(CORES * stride, sizeof(CELL));
+  vm->text = calloc(1, sizeof(struct NgaText));
+  ok = vm->memory != NULL && vm->dirty != NULL && vm->stacks != NULL &&
+       vm->text != NULL;
+#ifdef ENABLE_MULTICORE
+  vm->work = calloc(CORES, sizeof(vm->work[0]));
+  ok = ok && vm->work != NULL;
+#endif
+#ifdef ENABLE_EVENTS
+  vm->events = calloc(EVENT_QUEUE_SIZE, sizeof(struct NgaEvent));
+  ok = ok && vm->events != NULL;
+#endif
+#ifdef COUNT_CALLS
+  vm->calls = map_memory(NULL, memory);
+  ok = ok && vm->calls != NULL;
+#endif
+  if (!ok) {
+    free_vm(vm);
+    return 0;
+  }
+  vm->data_depth = data;
+  vm->address_depth = address;
+  for (i = 0; i < CORES; i++) {
+    vm->cpu[i].data = vm->stacks + i * stride + STACK_SLACK;
+    vm->cpu[i].address = vm->cpu[i].data + data + 2 * STACK_SLACK;
+  }
+  return 1;
+}
+
+V free_vm(NgaState *vm) {
+  int i;
+  if (vm->memory != NULL)
+    unmap_memory(vm->memory, vm->memory_size);
+  free(vm->dirty);
+  free(vm->stacks);
+  free(vm->text);
+  for (i = 0; i < vm->source_slots; i++)
+    free(vm->sources[i]);
+  free(vm->sources);
+  free_autoload(vm);
+  free_metadata(vm);
+  free(vm->file_bytes);
+#ifdef ENABLE_FLOATS
+  free(vm->floats);
+#endif
+#ifdef ENABLE_MULTICORE
+  free(vm->work);
+#endif
+#ifdef ENABLE_EVENTS
+  free(vm->events);
+#endif
+#ifdef ENABLE_FFI
+  free(vm->ffi_functions);
+#endif
+#ifdef COUNT_CALLS
+  if (vm->calls != NULL)
+    unmap_memory(vm->calls, vm->memory_size);
+#endif
+  forget_buffers(vm);
+}
+
+/* Zero all of memory. The pages that have been used are replaced with
+   fresh ones rather than written to, so they are no longer committed. */
+V clear_memory(NgaState *vm) {
+  CELL page;
+  if (map_memory(vm->memory, MEMORY_SIZE) == NULL)
+    memset(vm->memory, 0, MEMORY_BYTES(MEMORY_SIZE));
+  for (page = 0; page < DIRTY_PAGES; page++)
+    if (vm->dirty[page])
+      vm->dirty[page] = 0xff;
+}
+
+static CELL load_packed_image(NgaState *vm, FILE *fp, long bytes) {
+  unsigned char *data = malloc(bytes);
+  CELL cells = -1;
+  if (data != NULL && fread(data, 1, bytes, fp) == (size_t)bytes) {
+    clear_memory(vm);
+    cells = unpack_image(data, bytes, vm->memory, MEMORY_SIZE);
+  }
+  free(data);
+  if (cells < 0) {
+    vm_printf(vm, "\nERROR (nga/ngaLoadImage): Unable to unpack the image!\n");
+    halt_vm(vm, 1);
+    return 0;
+  }
+  mark_dirty(vm, 0, cells);
+  return cells;
+}
+
+/* Images are either packed (see image_format.h) or raw cells. */
 CELL load_image(NgaState *vm, char *imageFile) {
   FILE *fp;
   CELL imageSize = 0;
   long fileLen;
+  unsigned char header[PACKED_IMAGE_HEADER];
   if ((fp = fopen(imageFile, "rb")) != NULL) {
-    /* Determine length (in cells) */
     fseek(fp, 0, SEEK_END);
-    fileLen = ftell(fp) / sizeof(CELL);
-    if (fileLen > IMAGE_SIZE) {
+    fileLen = ftell(fp);
+    rewind(fp);
+    if (fread(header, 1, sizeof(header), fp) == sizeof(header) &&
+        packed_image(header, sizeof(header))) {
+      rewind(fp);
+      imageSize = load_packed_image(vm, fp, fileLen);
       fclose(fp);
-      printf("\nERROR (nga/ngaLoadImage): Image is larger than alloted space!\n");
-      exit(1);
+      return imageSize;
     }
     rewind(fp);
 
+    /* Determine length (in cells) */
+    fileLen /= sizeof(CELL);
+    if (fileLen > MEMORY_SIZE) {
+      fclose(fp);
+      vm_printf(vm, "\nERROR (nga/ngaLoadImage): Image is larger than alloted space!\n");
+      halt_vm(vm, 1);
+      return 0;
+    }
+
     /* Erase old image in memory: 0 = nop instruction */
-    for (int i = 0; i < IMAGE_SIZE; i++) { vm->memory[i] = 0; }
+    clear_memory(vm);
 
     /* Read the file into memory */
     imageSize = fread(vm->memory, sizeof(CELL), fileLen, fp);
     fclose(fp);
+    mark_dirty(vm, 0, imageSize);
   }
   return imageSize;
 }
 
 V prepare_vm(NgaState *vm) {
   vm->active = 0;
+  vm->halted = vm->status = 0;
   ACTIVE.ip = ACTIVE.sp = ACTIVE.rp = ACTIVE.u = 0;
   ACTIVE.active = -1;
-  for (ACTIVE.ip = 0; ACTIVE.ip < IMAGE_SIZE; ACTIVE.ip++)
-    vm->memory[ACTIVE.ip] = 0; /* NO - nop instruction */
-  for (ACTIVE.ip = 0; ACTIVE.ip < STACK_DEPTH; ACTIVE.ip++)
+  clear_memory(vm);             /* 0 = NO, the nop instruction */
+  for (ACTIVE.ip = 0; ACTIVE.ip < DATA_DEPTH; ACTIVE.ip++)
     ACTIVE.data[ACTIVE.ip] = 0;
-  for (ACTIVE.ip = 0; ACTIVE.ip < ADDRESSES; ACTIVE.ip++)
+  for (ACTIVE.ip = 0; ACTIVE.ip < ADDRESS_DEPTH; ACTIVE.ip++)
     ACTIVE.address[ACTIVE.ip] = 0;
+#ifdef ENABLE_MULTICORE
+  initialize_channels(vm);
+#endif
+#if defined(ENABLE_MULTICORE) && !defined(ENABLE_THREADS)
+  initialize_scheduler(vm);
+#endif
 }
 
-int valid_memory_address(CELL address) {
-  return address >= 0 && address < IMAGE_SIZE;
+int valid_memory_address(NgaState *vm, CELL address) {
+  return address >= 0 && address < MEMORY_SIZE;
 }
 
 V invalid_memory_access(NgaState *vm) {
@@ -262,8 +569,8 @@ V invalid_memory_access(NgaState *vm) {
     return;
   }
 #endif
-  printf("\nERROR (nga/memory): Invalid memory access\n");
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/memory): Invalid memory access\n");
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
@@ -275,7 +582,7 @@ V i_no(NgaState *vm) {
 
 V i_li(NgaState *vm) {
   guard(vm, 0, 1, 0);
-  if (ACTIVE.ip + 1 < IMAGE_SIZE) {
+  if (ACTIVE.ip + 1 < MEMORY_SIZE) {
     ACTIVE.sp++;
     ACTIVE.ip++;
     TOS = vm->memory[ACTIVE.ip];
@@ -318,9 +625,19 @@ V i_po(NgaState *vm) {
   ACTIVE.rp--;
 }
 
+/* With COUNT_CALLS, each call or jump adds one to the count for
+   its target. retro writes the counts for each word on exit when
+   given `--count-calls`, for use by retro-relink. */
+#ifdef COUNT_CALLS
+#define COUNT_CALL(vm, a) (vm)->calls[a]++
+#else
+#define COUNT_CALL(vm, a)
+#endif
+
 V i_ju(NgaState *vm) {
   guard(vm, 1, 0, 0);
-  if (valid_memory_address(TOS)) {
+  if (valid_memory_address(vm, TOS)) {
+    COUNT_CALL(vm, TOS);
     ACTIVE.ip = TOS - 1;
   } else {
     invalid_memory_access(vm);
@@ -330,7 +647,8 @@ V i_ju(NgaState *vm) {
 
 V i_ca(NgaState *vm) {
   guard(vm, 1, 0, 1);
-  if (valid_memory_address(TOS)) {
+  if (valid_memory_address(vm, TOS)) {
+    COUNT_CALL(vm, TOS);
     ACTIVE.rp++;
     TORS = ACTIVE.ip;
     ACTIVE.ip = TOS - 1;
@@ -346,7 +664,8 @@ V i_cc(NgaState *vm) {
   a = TOS; i_dr(vm);  /* Target */
   b = TOS; i_dr(vm);  /* Flag   */
   if (b != 0) {
-    if (valid_memory_address(a)) {
+    if (valid_memory_address(vm, a)) {
+      COUNT_CALL(vm, a);
       ACTIVE.rp++;
       TORS = ACTIVE.ip;
       ACTIVE.ip = a - 1;
@@ -361,7 +680,7 @@ V i_re(NgaState *vm) {
   guard(vm, 0, 0, -1);
   target = TORS;
   ACTIVE.rp--;
-  if (valid_memory_address(target)) {
+  if (valid_memory_address(vm, target)) {
     ACTIVE.ip = target;
   } else {
     invalid_memory_access(vm);
@@ -417,11 +736,11 @@ V i_fe(NgaState *vm) {
   switch (TOS) {
     case -1: TOS = ACTIVE.sp - 1; break;
     case -2: TOS = ACTIVE.rp; break;
-    case -3: TOS = IMAGE_SIZE; break;
+    case -3: TOS = MEMORY_SIZE; break;
     case -4: TOS = CELL_MIN; break;
     case -5: TOS = CELL_MAX; break;
     default:
-      if (valid_memory_address(TOS)) {
+      if (valid_memory_address(vm, TOS)) {
         TOS = vm->memory[TOS];
       } else {
         invalid_memory_access(vm);
@@ -432,8 +751,9 @@ V i_fe(NgaState *vm) {
 
 V i_st(NgaState *vm) {
   guard(vm, 2, 0, 0);
-  if (valid_memory_address(TOS)) {
+  if (valid_memory_address(vm, TOS)) {
     vm->memory[TOS] = NOS;
+    MARK_DIRTY(vm, TOS);
   } else {
     invalid_memory_access(vm);
   }
@@ -539,7 +859,7 @@ V i_zr(NgaState *vm) {
     CELL target = TORS;
     i_dr(vm);
     ACTIVE.rp--;
-    if (valid_memory_address(target)) {
+    if (valid_memory_address(vm, target)) {
       ACTIVE.ip = target;
     } else {
       invalid_memory_access(vm);
@@ -549,9 +869,9 @@ V i_zr(NgaState *vm) {
 
 V i_ha(NgaState *vm) {
   guard(vm, 0, 0, 0);
-  ACTIVE.ip = IMAGE_SIZE;
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
-  exit(0);
+  halt_vm(vm, 0);
 }
 
 V i_ie(NgaState *vm) {
@@ -570,16 +890,27 @@ V invalid_device(NgaState *vm, CELL device) {
     return;
   }
 #endif
-  printf("\nERROR (nga/device): Invalid device id %lld\n", (long long)device);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/device): Invalid device id %lld\n", (long long)device);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
 V i_iq(NgaState *vm) {
   guard(vm, 1, 1, 0);
+#ifdef ENABLE_POLLER
+  ACTIVE.io_sp = ACTIVE.sp;
+#endif
   CELL device = stack_pop(vm);
   if (valid_device(vm, device)) {
+#ifdef ENABLE_THREADS
+    device_lock(vm);
+    vm->io_device = device;
+    vm->IO_queryHandlers[device](vm);
+    device_unlock(vm);
+#else
+    vm->io_device = device;
     vm->IO_queryHandlers[device](vm);
+#endif
   } else {
     invalid_device(vm, device);
   }
@@ -587,9 +918,24 @@ V i_iq(NgaState *vm) {
 
 V i_ii(NgaState *vm) {
   guard(vm, 1, 0, 0);
+#ifdef ENABLE_POLLER
+  ACTIVE.io_sp = ACTIVE.sp;
+#endif
   CELL device = stack_pop(vm);
   if (valid_device(vm, device)) {
+#ifdef ENABLE_THREADS
+    if (multicore_lock_free(vm, device)) {
+      vm->IO_deviceHandlers[device](vm);
+      return;
+    }
+    device_lock(vm);
+    vm->io_device = device;
+    vm->IO_deviceHandlers[device](vm);
+    device_unlock(vm);
+#else
+    vm->io_device = device;
     vm->IO_deviceHandlers[device](vm);
+#endif
   } else {
     invalid_device(vm, device);
   }
@@ -604,15 +950,17 @@ Handler instructions[] = {
 };
 
 #ifndef BRANCH_PREDICTION
-V validate_opcode_bundle(NgaState *vm, CELL opcode) {
+int validate_opcode_bundle(NgaState *vm, CELL opcode) {
   CELL remainingOpcode = opcode;
   for (int i = 0; i < 4; i++) {
     CELL current = remainingOpcode & 0xFF;
     if (current < 0 || current > 29) {
       invalid_opcode(vm, opcode);
+      return 0;
     }
     remainingOpcode >>= 8;
   }
+  return 1;
 }
 #endif
 
@@ -628,6 +976,7 @@ V process_opcode_bundle(NgaState *vm, CELL opcode) {
     CELL current = (opcode >> (i * 8)) & 0xFF;
     if (unlikely(current > 29)) {
       invalid_opcode(vm, opcode);
+      return;
     }
     instructions[current](vm);
   }
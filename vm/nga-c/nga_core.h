@@ -16,16 +16,50 @@
 
 #include "layout.h"
 
-#define ACTIVE vm->cpu[vm->active]
+/*---------------------------------------------------------------------
+  CURRENT_CORE is the index of the core being run. Cores normally take
+  turns on the host thread and this is tracked in the VM. When built
+  with ENABLE_THREADS, each started core runs on its own thread, so the
+  index is kept in a thread local variable instead.
+  ---------------------------------------------------------------------*/
+
+#ifdef ENABLE_THREADS
+extern _Thread_local int nga_thread_core;
+#define CURRENT_CORE nga_thread_core
+#else
+#define CURRENT_CORE vm->active
+#endif
+
+#define ACTIVE vm->cpu[CURRENT_CORE]
 #define TIB vm->memory[RETRO_IMAGE_TIB]
 #define TIB_END vm->memory[RETRO_IMAGE_TIB_END]
 #define TOS  ACTIVE.data[ACTIVE.sp]
 #define NOS  ACTIVE.data[ACTIVE.sp-1]
 #define TORS ACTIVE.address[ACTIVE.rp]
 
+/* The sizes of memory and the stacks are set when a VM is allocated.
+   IMAGE_SIZE, STACK_DEPTH, and ADDRESSES in config.h are the defaults. */
+#define MEMORY_SIZE   vm->memory_size
+#define DATA_DEPTH    vm->data_depth
+#define ADDRESS_DEPTH vm->address_depth
+
+/* Memory is divided into pages, each with a byte of flags that are
+   set when the page is written. Each user of the flags clears its own
+   bit once it has dealt with the page. A page that has never been
+   written has no flags set. */
+#define DIRTY_PAGES ((MEMORY_SIZE >> DIRTY_PAGE_SHIFT) + 1)
+#define DIRTY_BASELINE 1      /* Written since the baseline snapshot */
+#define DIRTY_SAVED    2      /* Written since the image was saved */
+#define DIRTY_TOUCHED  0x80   /* Written at some point */
+#define MARK_DIRTY(vm, a) ((vm)->dirty[(a) >> DIRTY_PAGE_SHIFT] = 0xff)
+
 #define MAX_DEVICES      32
 #define MAX_OPEN_FILES   32
-#define MAX_SCRIPTING_SOURCES 64
+#define MAX_SCRIPTING_SOURCES 64  /* Deepest nesting of includes */
+#define MAX_CHANNELS     64
+#define MAX_FFI_LIBRARIES 32
+#define MAX_FFI_FUNCTIONS 32000
+#define SOCKET_SLOTS     16
 
 typedef struct NgaState NgaState;
 
@@ -36,66 +70,225 @@ struct NgaCore {
   CELL active;                /* Is core active?              */
   CELL u;                     /* Should next operation be     */
                               /* unsigned?                    */
-  CELL data[STACK_DEPTH];     /* The data stack               */
-  CELL address[ADDRESSES];    /* The address stack            */
+  CELL *data;                 /* The data stack               */
+  CELL *address;              /* The address stack            */
+
+#ifdef ENABLE_FLOATS
+  double *Floats, *AFloats;   /* Floating Point (see below)   */
+  CELL fsp, afsp;
+#endif
 
 #ifdef ENABLE_MULTICORE
   CELL registers[24];         /* Internal Registers           */
+  CELL waiting;               /* Parked on a channel?         */
+#endif
+
+#ifdef ENABLE_EVENTS
+  long long event_deadline;   /* Waiting for an event until   */
+#endif
+
+#ifdef ENABLE_POLLER
+  CELL io_sp;                 /* Stack depth at last `ii`     */
+  int wait_fd, wait_events;   /* Parked on a descriptor       */
+  long long wake_at;          /* Parked until (ms), or 0      */
+#endif
+};
+
+#define FLOAT_DEPTH 256
+
+#ifdef ENABLE_MULTICORE
+struct NgaChannel {
+  CELL *values;
+  size_t *sequence;
+  size_t mask;
+  size_t head, tail;
+  int in_use;
+};
+#endif
+
+#ifdef ENABLE_EVENTS
+struct NgaEvent {
+  size_t sequence;
+  CELL type, length;
+  CELL payload[EVENT_PAYLOAD_SIZE];
+};
 #endif
+
+#ifdef ENABLE_THREADS
+struct NgaThread {
+  NgaState *vm;
+  pthread_t thread;
+  int core;
+  int running;
+};
+#endif
+
+/*---------------------------------------------------------------------
+  The text buffers used by the scripting and file devices are kept out
+  of NgaState, as are the larger tables that most programs never touch.
+  `text` and `events` are allocated with the VM; the float stacks, the
+  include stack, the file transfer buffer, and the FFI function table
+  are allocated when first used.
+  ---------------------------------------------------------------------*/
+
+struct NgaText {
+  char string_data[8192];
+  char line[4096];
+
+  /* Configuration of code & test fences for Unu */
+  char code_start[256], code_end[256];
+  char test_start[256], test_end[256];
+
+#ifdef ENABLE_BLOCKS
+  char BlockFile[1025];
+#endif
+
+  /* The file the image was last saved to */
+  char image_file[1025];
 };
 
+#define FILE_BYTES 32768
+
 struct NgaState {
-  /* System Memory */
-  CELL memory[IMAGE_SIZE + 1];
+  /* System Memory. This and the fields up to `cpu` are what the
+     dispatch loop uses; keep them together. */
+  CELL *memory;
+  CELL memory_size;
+  unsigned char *dirty;          /* Flags for each page of memory  */
 
-  /* CPU Cores */
-  struct NgaCore cpu[CORES];
   int active;
 
+  /* Set by `bye`, `unix:exit`, and fatal errors. The host checks this
+     and returns `status` instead of exiting the process. */
+  int halted, status;
+  int perform_abort;
+
+#ifdef ENABLE_MULTICORE
+  CELL slice, ticks;             /* Time slice & remaining bundles */
+  int queued, queue_at;
+  int parked;                    /* Cores waiting on I/O or timers */
+#endif
+
+#ifdef ENABLE_EVENTS
+  int event_signal;              /* Set when an event is posted    */
+  CELL event_handler, event_handler_rp;
+#endif
+
   /* I/O Devices */
   int devices;
+  CELL io_device;
   Handler IO_deviceHandlers[MAX_DEVICES];
   Handler IO_queryHandlers[MAX_DEVICES];
 
-  CELL Dictionary, interpret;    /* Interfacing     */
-  char string_data[8192];
+  /* CPU Cores */
+  struct NgaCore cpu[CORES];
 
+  /* Space for the stacks of all cores */
+  CELL *stacks;
+  CELL data_depth, address_depth;
 #ifdef ENABLE_FLOATS
-  double Floats[256], AFloats[256];        /* Floating Point */
-  CELL fsp, afsp;
+  double *floats;
 #endif
 
-#ifdef ENABLE_BLOCKS
-  char BlockFile[1025];
+#ifdef ENABLE_MULTICORE
+  int run_queue[CORES];          /* Cores ready to run            */
+  struct NgaChannel channels[MAX_CHANNELS];
+  CELL mailboxes[CORES];         /* Channel + 1, or 0 if none      */
+  int channel_waiters;
+  CELL (*work)[WORK_DEQUE_SIZE]; /* Work stealing deques, per core */
+  CELL work_top[CORES], work_bottom[CORES];
+#endif
+
+#ifdef ENABLE_THREADS
+  struct NgaThread threads[CORES];
+  pthread_mutex_t core_lock;     /* Guards pause & resume of cores */
+  pthread_cond_t core_wake;
+  pthread_mutex_t device_lock;   /* Serializes device access       */
+  int device_lock_depth[CORES];  /* Times each core holds the lock */
 #endif
 
+#ifdef ENABLE_EVENTS
+  struct NgaEvent *events;       /* Inbound events                 */
+  size_t event_head, event_tail;
+  int event_waiters;
+  pthread_mutex_t event_lock;
+  pthread_cond_t event_wake;
+#endif
+
+  CELL Dictionary, interpret;    /* Interfacing     */
+  struct NgaText *text;
+
 #ifdef ENABLE_ERROR
   CELL ErrorHandlers[64];
 #endif
 
-  /* Scripting */
+#ifdef ENABLE_CLOCK
+  time_t current_time;
+#endif
+
+#ifdef ENABLE_FFI
+  void *ffi_handles[MAX_FFI_LIBRARIES];
+  void (**ffi_functions)(void *);
+  int ffi_libraries, ffi_mapped, ffi_slots;
+#endif
+
+#ifdef ENABLE_SOCKETS
+  int SocketID[SOCKET_SLOTS];
+  int SocketUsed[SOCKET_SLOTS];
+  struct addrinfo *socket_address; /* From the last getaddrinfo   */
+#endif
+
+#ifdef ENABLE_IOCTL
+  struct termios saved_term_state;
+  int saved_term_state_valid;
+#endif
+
+  int verbose;
+#ifdef COUNT_CALLS
+  CELL *calls;                   /* Calls to each address          */
+#endif
+
+  /* Embedding. `output` receives everything the VM writes; when it
+     is NULL, output goes to stdout. `host` belongs to the embedder and
+     `io_device` is the device being invoked by `ii` or `iq`. */
+  void (*output)(NgaState *, const char *, size_t);
+  void *host;
+
+  /* Scripting. `sources` holds the names of the files being included,
+     with `current_source` the innermost. It grows as needed. */
   char **sys_argv;
   int sys_argc;
-  char scripting_sources[MAX_SCRIPTING_SOURCES][8192];
-  char line[4096];
-  int current_source;
-  int perform_abort;
+  char **sources;
+  int current_source, source_slots;
   int interactive;
 
+  /* Autoloading (see scripting.c). Allocated on first use. */
+  struct NgaAutoloader *autoload;
+
+  /* The glossary, for images built without word metadata (see
+     scripting.c). Read on first use. */
+  struct NgaMetadata *metadata;
+
   CELL currentLine;
   CELL ignoreToEOL, ignoreToEOF;
-
-  /* Configuration of code & test fences for Unu */
-  char code_start[256], code_end[256];
-  char test_start[256], test_end[256];
   int codeBlocks;
 
   FILE *OpenFileHandles[MAX_OPEN_FILES];
+  char *file_bytes;
+
+  /* Image saves. `text->image_file` was last saved to, with
+     `image_saved` cells. `image_saver` is the process doing a
+     background save. */
+  CELL image_saved;
+  pid_t image_saver;
 };
 
 #define V void
 
 /* VM core */
+int allocate_vm(NgaState *, CELL, CELL, CELL);
+V free_vm(NgaState *);
+V clear_memory(NgaState *);
 CELL stack_pop(NgaState *);
 V stack_push(NgaState *, CELL);
 V update_rx(NgaState *);
@@ -106,12 +299,47 @@ V load_embedded_image(NgaState *);
 CELL load_image(NgaState *, char *);
 V prepare_vm(NgaState *);
 V execute(NgaState *, CELL);
+V halt_vm(NgaState *, int);
+V mark_dirty(NgaState *, CELL, CELL);
+V vm_write(NgaState *, const char *, size_t);
+V vm_printf(NgaState *, const char *, ...);
 V process_opcode_bundle(NgaState *, CELL);
 #ifndef BRANCH_PREDICTION
-V validate_opcode_bundle(NgaState *, CELL);
+int validate_opcode_bundle(NgaState *, CELL);
+#endif
+#ifdef AOT
+/* Defined by the C that retro-aot generates (see aot.h) */
+int aot_run(NgaState *, CELL);
+int aot_next(NgaState *, CELL, CELL);
 #endif
 #ifdef ENABLE_MULTICORE
+V initialize_channels(NgaState *);
+#endif
+#if defined(ENABLE_MULTICORE) && !defined(ENABLE_THREADS)
+V initialize_scheduler(NgaState *);
 V switch_core(NgaState *);
+V finish_core(NgaState *, CELL);
+#endif
+#ifdef ENABLE_POLLER
+int park_for_io(NgaState *, int, int);
+int park_for_timer(NgaState *, CELL);
+#else
+#define park_for_io(vm, fd, events) 0
+#define park_for_timer(vm, ms) 0
+#endif
+#ifdef ENABLE_EVENTS
+int post_event(NgaState *, CELL, CELL, const CELL *);
+V dispatch_events(NgaState *);
+V drain_events(NgaState *);
+#endif
+#ifdef ENABLE_THREADS
+V initialize_threads(NgaState *);
+V park_core(NgaState *);
+V device_lock(NgaState *);
+V device_unlock(NgaState *);
+int device_lock_release(NgaState *);
+V device_lock_restore(NgaState *, int);
+int multicore_lock_free(NgaState *, CELL);
 #endif
 
 /* Runtime hooks used by the VM core */
@@ -127,7 +355,14 @@ CELL string_inject(NgaState *, char *, CELL);
 char *string_extract(NgaState *, CELL);
 V include_file(NgaState *, char *, int);
 V include_plain_file(NgaState *, char *, int);
+V evaluate(NgaState *, char *);
+V evaluate_source(NgaState *, const char *, size_t);
 V initialize_scripting(NgaState *);
+V name_source(NgaState *, const char *);
+int copy_sources(NgaState *, NgaState *);
+V reset_autoload(NgaState *);
+V free_autoload(NgaState *);
+V free_metadata(NgaState *);
 
 #ifdef NEEDS_STRL
 size_t strlcat(char *dst, const char *src, size_t dsize);
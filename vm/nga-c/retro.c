@@ -13,17 +13,11 @@
 
 #include "retro.h"
 
-/* Global Variables -------------------------------------------------- */
-
-int verbose;
-
-
 V io_output(NgaState *vm) {
   unsigned char utf8_bytes[4];
   int num_bytes;
   utf32_to_utf8(stack_pop(vm), utf8_bytes, &num_bytes);
-  display_utf8(utf8_bytes, num_bytes);
-  fflush(stdout);
+  vm_write(vm, (char *)utf8_bytes, num_bytes);
 }
 
 V query_output(NgaState *vm) {
@@ -80,19 +74,222 @@ V query_unsigned(NgaState *vm) {
 
 /*=====================================================================*/
 
+/*---------------------------------------------------------------------
+  Saving Images
+
+  `image:save` writes the whole image. Large images that are saved
+  often can use one of the other forms instead:
+
+  - An incremental save rewrites only the pages changed since the last
+    save, in place. The first save to a file is a full one.
+  - A background save forks. The child writes its copy of memory to a
+    temporary file, then renames it over the old image, while the VM
+    keeps running in the parent. Windows has no `fork()`, so there it
+    is the same as a full save.
+
+  Only one background save runs at a time. Any other save waits for it
+  to finish first.
+
+  For compatibility with older images, a plain save passes just the
+  file name. The others pass the name and a negative action.
+  ---------------------------------------------------------------------*/
+
+static CELL image_cells(NgaState *vm) {
+  CELL cells = vm->memory[RETRO_IMAGE_HEAP] + 1;
+  return cells > 0 && cells <= MEMORY_SIZE ? cells : MEMORY_SIZE;
+}
+
+static int image_write_bytes(int fd, const char *from, size_t left, off_t at) {
+  ssize_t written;
+  while (left > 0) {
+    written = pwrite(fd, from, left, at);
+    if (written < 0 && errno == EINTR) continue;
+    if (written <= 0) return 0;
+    from += written;
+    at += written;
+    left -= written;
+  }
+  return 1;
+}
+
+static int image_write(int fd, CELL *cells, CELL start, CELL count) {
+  return image_write_bytes(fd, (char *)&cells[start], count * sizeof(CELL),
+                           start * sizeof(CELL));
+}
+
+static V image_error(NgaState *vm, char *file) {
+  vm_printf(vm, "\nERROR (nga/io_image): Unable to save the image: %s!\n", file);
+  halt_vm(vm, 2);
+}
+
+static V image_mark_saved(NgaState *vm, char *file, CELL cells) {
+  CELL page;
+  strlcpy(vm->text->image_file, file, sizeof(vm->text->image_file));
+  vm->image_saved = cells;
+  for (page = 0; page < DIRTY_PAGES; page++)
+    vm->dirty[page] &= ~DIRTY_SAVED;
+}
+
+#ifndef _WIN32
+/* A background save that failed leaves the old image. Forgetting the
+   file makes the next incremental save a full one. */
+static int image_reap(NgaState *vm, int options) {
+  int status;
+  pid_t pid = waitpid(vm->image_saver, &status, options);
+  if (pid == 0) return -1;
+  vm->image_saver = 0;
+  if (pid < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    vm->text->image_file[0] = '\0';
+    return 0;
+  }
+  return 1;
+}
+#else
+#ifndef WNOHANG
+#define WNOHANG 0
+#endif
+
+/* Saves are never made in the background, so there is nothing to wait
+   for. */
+static int image_reap(NgaState *vm, int options) {
+  vm->image_saver = 0;
+  return 1;
+}
+#endif
+
+/* Returns 0 if the last background save failed. */
+int image_wait(NgaState *vm) {
+  if (vm->image_saver == 0) return 1;
+  return image_reap(vm, 0);
+}
+
+V image_save(NgaState *vm, char *file) {
+  CELL cells = image_cells(vm);
+  int fd;
+  image_wait(vm);
+  fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0 || !image_write(fd, vm->memory, 0, cells)) {
+    if (fd >= 0) close(fd);
+    image_error(vm, file);
+    return;
+  }
+  close(fd);
+  image_mark_saved(vm, file, cells);
+}
+
+V image_save_incremental(NgaState *vm, char *file) {
+  CELL cells = image_cells(vm);
+  CELL page, start, count;
+  int fd;
+  image_wait(vm);
+  if (strcmp(file, vm->text->image_file) != 0 || (fd = open(file, O_WRONLY)) < 0) {
+    image_save(vm, file);
+    return;
+  }
+  for (page = 0; page <= (cells - 1) >> DIRTY_PAGE_SHIFT; page++) {
+    start = page << DIRTY_PAGE_SHIFT;
+    count = cells - start;
+    if (count > (1 << DIRTY_PAGE_SHIFT)) count = 1 << DIRTY_PAGE_SHIFT;
+    if (!(vm->dirty[page] & DIRTY_SAVED) && start + count <= vm->image_saved)
+      continue;
+    if (!image_write(fd, vm->memory, start, count)) {
+      close(fd);
+      vm->text->image_file[0] = '\0';
+      image_error(vm, file);
+      return;
+    }
+  }
+  if (cells < vm->image_saved && ftruncate(fd, cells * sizeof(CELL)) != 0) {
+    close(fd);
+    vm->text->image_file[0] = '\0';
+    image_error(vm, file);
+    return;
+  }
+  close(fd);
+  image_mark_saved(vm, file, cells);
+}
+
+/* A packed image can't be updated in place, so the file is forgotten
+   and the next incremental save is a full one. */
+V image_save_packed(NgaState *vm, char *file) {
+  CELL cells = image_cells(vm);
+  unsigned char *data;
+  size_t bytes;
+  int fd, saved = 0;
+  image_wait(vm);
+  data = malloc(packed_image_bound(cells));
+  if (data != NULL) {
+    bytes = pack_image(vm->memory, cells, data);
+    fd = open(file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+      saved = image_write_bytes(fd, (char *)data, bytes, 0);
+      close(fd);
+    }
+    free(data);
+  }
+  if (!saved) {
+    image_error(vm, file);
+    return;
+  }
+  image_mark_saved(vm, file, cells);
+  vm->text->image_file[0] = '\0';
+}
+
+#ifndef _WIN32
+/* The child only makes system calls, as other threads may have held
+   locks (e.g., in malloc or stdio) when it was forked. */
+V image_save_background(NgaState *vm, char *file) {
+  char temporary[1100];
+  CELL cells = image_cells(vm);
+  pid_t pid;
+  int fd;
+  image_wait(vm);
+  snprintf(temporary, sizeof(temporary), "%s.saving", file);
+  pid = fork();
+  if (pid < 0) {
+    image_save(vm, file);
+    return;
+  }
+  if (pid == 0) {
+    fd = open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || !image_write(fd, vm->memory, 0, cells) ||
+        fsync(fd) != 0 || close(fd) != 0 || rename(temporary, file) != 0) {
+      unlink(temporary);
+      _exit(1);
+    }
+    _exit(0);
+  }
+  vm->image_saver = pid;
+  image_mark_saved(vm, file, cells);
+}
+#else
+V image_save_background(NgaState *vm, char *file) {
+  image_save(vm, file);
+}
+#endif
+
 V io_image(NgaState *vm) {
-  FILE *fp;
-  char *f = string_extract(vm, stack_pop(vm));
-  if ((fp = fopen(f, "wb")) == NULL) {
-    printf("\nERROR (nga/io_image): Unable to save the image: %s!\n", f);
-    exit(2);
+  CELL action = stack_pop(vm);
+  if (action >= 0) {
+    image_save(vm, string_extract(vm, action));
+    return;
+  }
+  switch (action) {
+    case -1: image_save_incremental(vm, string_extract(vm, stack_pop(vm)));
+             break;
+    case -2: image_save_background(vm, string_extract(vm, stack_pop(vm)));
+             break;
+    case -3: stack_push(vm, vm->image_saver != 0 && image_reap(vm, WNOHANG) < 0 ? -1 : 0);
+             break;
+    case -4: stack_push(vm, image_wait(vm) ? -1 : 0);
+             break;
+    case -5: image_save_packed(vm, string_extract(vm, stack_pop(vm)));
+             break;
   }
-  fwrite(vm->memory, sizeof(CELL), vm->memory[RETRO_IMAGE_HEAP] + 1, fp);
-  fclose(fp);
 }
 
 V query_image(NgaState *vm) {
-  stack_push(vm, 0);
+  stack_push(vm, 1);
   stack_push(vm, DEVICE_IMAGE);
 }
 
@@ -100,6 +297,7 @@ V query_image(NgaState *vm) {
 /*=====================================================================*/
 
 
+#ifndef RETRO_LIBRARY
 /*---------------------------------------------------------------------
   Display the Stack Contents
   ---------------------------------------------------------------------*/
@@ -127,6 +325,7 @@ V dump_astack(NgaState *vm) {
   }
   printf("\n");
 }
+#endif
 
 /*---------------------------------------------------------------------
   `initialize()` sets up Nga and loads the image (from the array in
@@ -139,12 +338,40 @@ V initialize(NgaState *vm) {
   load_embedded_image(vm);
 #endif
   initialize_scripting(vm);
+#ifdef ENABLE_THREADS
+  initialize_threads(vm);
+#endif
 }
 
+V register_devices(NgaState *vm) {
+#define DEVICE(name) register_device(vm, io_ ## name, query_ ## name);
+#define DEVICE_WITH_INIT(name, init) DEVICE(name) init(vm);
+#include "devices.def"
+#undef DEVICE_WITH_INIT
+#undef DEVICE
+}
+
+
+/*---------------------------------------------------------------------
+  Everything below is the command line host. It is left out when the
+  runtime is built as a library (`RETRO_LIBRARY`); see libretro.c.
+  ---------------------------------------------------------------------*/
 
+#ifndef RETRO_LIBRARY
 V help(char *exename) {
-  printf("Scripting Usage: %s filename\n\n", exename);
-  printf("Interactive Usage: %s [-h] [-i] [-f filename] [-t filename]\n\n", exename);
+  printf("Scripting Usage: %s [sizes] filename\n\n", exename);
+  printf("Interactive Usage: %s [sizes] [-h] [-i] [-f filename] [-t filename]\n\n", exename);
+  printf("Sizes (these must come first; k, m, or g can be appended):\n\n");
+  printf("  --memory cells\n");
+  printf("    Set the amount of memory (default: %lld)\n", (long long)IMAGE_SIZE);
+  printf("  --stack cells\n");
+  printf("    Set the depth of the data stack (default: %lld)\n", (long long)STACK_DEPTH);
+  printf("  --rstack cells\n");
+  printf("    Set the depth of the address stack (default: %lld)\n\n", (long long)ADDRESSES);
+#ifdef COUNT_CALLS
+  printf("  --count-calls filename\n");
+  printf("    On exit, write the number of calls to each word to the specified file\n\n");
+#endif
   printf("Valid Arguments:\n\n");
   printf("  -h\n");
   printf("    Display this help text\n");
@@ -179,14 +406,6 @@ enum flags {
   FLAG_HELP, FLAG_INTERACTIVE,
 };
 
-V register_devices(NgaState *vm) {
-#define DEVICE(name) register_device(vm, io_ ## name, query_ ## name);
-#define DEVICE_WITH_INIT(name, init) DEVICE(name) init(vm);
-#include "devices.def"
-#undef DEVICE_WITH_INIT
-#undef DEVICE
-}
-
 V register_signal_handlers() {
 #ifdef ENABLE_SIGNALS
   signal(SIGHUP, sig_handler);
@@ -207,46 +426,124 @@ char *option_argument(int argc, char **argv, int *index) {
   return argv[++*index];
 }
 
+CELL size_argument(int argc, char **argv, int *index) {
+  char *text = option_argument(argc, argv, index);
+  char *end;
+  long long size, multiplier = 1;
+  errno = 0;
+  size = strtoll(text, &end, 10);
+  switch (*end) {
+    case 'k': case 'K': multiplier = 1024LL; end++; break;
+    case 'm': case 'M': multiplier = 1024LL * 1024; end++; break;
+    case 'g': case 'G': multiplier = 1024LL * 1024 * 1024; end++; break;
+  }
+  if (*end != '\0' || errno != 0 || size <= 0 ||
+      size > (CELL_MAX) / multiplier) {
+    fprintf(stderr, "ERROR: invalid size for %s: %s\n", argv[*index - 1], text);
+    exit(1);
+  }
+  return size * multiplier;
+}
+
+#ifdef COUNT_CALLS
+char *calls_file;
+
+/* Write a line for each word that was called, with the count and the
+   name. This is the profile that retro-relink reads. */
+V write_call_counts(NgaState *vm, char *filename) {
+  FILE *fp = fopen(filename, "w");
+  CELL dt, xt;
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: unable to write %s\n", filename);
+    return;
+  }
+  for (dt = vm->memory[RETRO_IMAGE_DICTIONARY]; dt != 0; dt = vm->memory[dt]) {
+    xt = vm->memory[dt + RETRO_DICT_OFFSET_XT];
+    if (xt >= 0 && xt < vm->memory_size && vm->calls[xt] != 0)
+      fprintf(fp, "%lld %s\n", (long long)vm->calls[xt],
+              string_extract(vm, dt + RETRO_DICT_OFFSET_NAME));
+  }
+  fclose(fp);
+}
+#endif
+
+/* The VM never exits the process; `bye`, `unix:exit`, and fatal errors
+   halt it and leave a status for the host to return. */
+int finish(NgaState *vm) {
+  int status = vm->status;
+  image_wait(vm);
+#ifdef COUNT_CALLS
+  if (calls_file != NULL)
+    write_call_counts(vm, calls_file);
+#endif
+  free_vm(vm);
+  free(vm);
+  return status;
+}
+
 int main(int argc, char **argv) {
-  int i;
+  int i, first;
   int modes[16];
+  CELL memory = IMAGE_SIZE, data = STACK_DEPTH, address = ADDRESSES;
   NgaState *vm = calloc(sizeof(NgaState), sizeof(char));
-  verbose = 0;
+
+  /* The sizes are needed to create the VM, so they come first */
+  for (i = 1; i < argc; i++) {
+    if ARG("--memory") {
+      memory = size_argument(argc, argv, &i);
+    } else if ARG("--stack") {
+      data = size_argument(argc, argv, &i);
+    } else if ARG("--rstack") {
+      address = size_argument(argc, argv, &i);
+#ifdef COUNT_CALLS
+    } else if ARG("--count-calls") {
+      calls_file = option_argument(argc, argv, &i);
+#endif
+    } else {
+      break;
+    }
+  }
+  first = i;
+
+  if (vm == NULL || !allocate_vm(vm, memory, data, address)) {
+    fprintf(stderr, "ERROR: unable to allocate the VM\n");
+    return 1;
+  }
 
   register_signal_handlers();
 
   initialize(vm);               /* Initialize Nga & image    */
   register_devices(vm);
-  vm->sys_argc = argc;           /* Point the global argc and */
-  vm->sys_argv = argv;           /* argv to the actual ones   */
+  vm->sys_argc = argc - first + 1;  /* Point the global argc and */
+  vm->sys_argv = argv + first - 1;  /* argv to the actual ones   */
 
-  strlcpy(vm->scripting_sources[0], "<none>", 8192);
+  name_source(vm, "<none>");
 
 
   /* Check arguments. If no flags were passed, load & run the
      file specified and exit. */
-  if (argc >= 2 && argv[1][0] != '-') {
+  if (first < argc && argv[first][0] != '-') {
     update_rx(vm);
-    include_file(vm, argv[1], 0);
-    if (ACTIVE.sp >= 1)  dump_stack(vm);
-    exit(0);
+    include_file(vm, argv[first], 0);
+    if (!vm->halted && ACTIVE.sp >= 1)  dump_stack(vm);
+    return finish(vm);
   }
 
   /* Clear startup modes       */
   for (i = 0; i < 16; i++)
     modes[i] = 0;
 
-  if (argc <= 1) modes[FLAG_INTERACTIVE] = 1;
+  if (first >= argc) modes[FLAG_INTERACTIVE] = 1;
 
   update_rx(vm);
 
   /* Process Arguments */
-  for (i = 1; i < argc; i++) {
+  for (i = first; i < argc && !vm->halted; i++) {
     if ARG("-h") {
       help(argv[0]);
       exit(0);
     } else if ARG("-v") {
-      verbose = 1;
+      vm->verbose = 1;
     } else if ARG("-i") {
       modes[FLAG_INTERACTIVE] = 1;
       vm->interactive = -1;
@@ -260,30 +557,38 @@ int main(int argc, char **argv) {
     } else if ARG("-r") {
       load_image(vm, option_argument(argc, argv, &i));
       modes[FLAG_INTERACTIVE] = 1;
-      update_rx(vm);
+      /* The image starts from cell 0 and does its own setup, so
+         don't run the rehash hook: cell 10 may hold anything in an
+         image that isn't Retro. */
+      vm->Dictionary = vm->memory[RETRO_IMAGE_DICTIONARY];
+      vm->interpret = vm->memory[RETRO_IMAGE_INTERPRET];
     } else if ARG("-t") {
       include_file(vm, option_argument(argc, argv, &i), 1);
     } else if (ARG("--code-start") || ARG("-cs")) {
-      strlcpy(vm->code_start, option_argument(argc, argv, &i), 256);
+      strlcpy(vm->text->code_start, option_argument(argc, argv, &i), 256);
     } else if (ARG("--code-end") || ARG("-ce")) {
-      strlcpy(vm->code_end, option_argument(argc, argv, &i), 256);
+      strlcpy(vm->text->code_end, option_argument(argc, argv, &i), 256);
     } else if (ARG("--test-start") || ARG("-ts")) {
-      strlcpy(vm->test_start, option_argument(argc, argv, &i), 256);
+      strlcpy(vm->text->test_start, option_argument(argc, argv, &i), 256);
     } else if (ARG("--test-end") || ARG("-te")) {
-      strlcpy(vm->test_end, option_argument(argc, argv, &i), 256);
+      strlcpy(vm->text->test_end, option_argument(argc, argv, &i), 256);
+    } else if (ARG("--memory") || ARG("--stack") || ARG("--rstack")) {
+      fprintf(stderr, "ERROR: %s must come before the other arguments\n", argv[i]);
+      exit(1);
     }
   }
 
   /* Run the Listener (if interactive mode was set) */
-  if (modes[FLAG_INTERACTIVE] == 1) {
+  if (modes[FLAG_INTERACTIVE] == 1 && !vm->halted) {
     execute(vm, 0);
   }
 
   /* Dump Stack */
-  if (ACTIVE.sp >= 1)  dump_stack(vm);
+  if (!vm->halted && ACTIVE.sp >= 1)  dump_stack(vm);
 
-  free(vm);
+  return finish(vm);
 }
+#endif
 
 
 /*=====================================================================*/
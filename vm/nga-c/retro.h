@@ -13,23 +13,55 @@
 #include <fcntl.h>
 #include <limits.h>
 #include <signal.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
 #include <time.h>
 #include <unistd.h>
 
 #include "config.h"
+
+#ifdef ENABLE_THREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(ENABLE_EVENTS) && !defined(ENABLE_THREADS)
+#include <pthread.h>
+#endif
+
+#ifdef ENABLE_POLLER
+#include <poll.h>
+#endif
+
+#ifdef ENABLE_SOCKETS
+#include <netdb.h>
+#endif
+
+#ifdef ENABLE_IOCTL
+#include <termios.h>
+#endif
+
 #include "devices.h"
 #include "nga_core.h"
+#include "image_format.h"
+#include "token_format.h"
 
 #ifndef NO_EMBEDDED_IMAGE
 extern CELL ngaImageCells;
-extern CELL ngaImage[];
+extern const unsigned char ngaImagePacked[];
+extern size_t ngaImagePackedBytes;
 #endif
 
 /* Device entry points are generated from the shared device manifest. */
@@ -39,11 +71,21 @@ extern CELL ngaImage[];
 #undef DEVICE_WITH_INIT
 #undef DEVICE
 
+/* Setup shared by the command line host and the library */
+V initialize(NgaState *);
+V register_devices(NgaState *);
+int image_wait(NgaState *);
+
 #ifdef ENABLE_FLOATS
+int allocate_floats(NgaState *);
 V float_push(NgaState *, double);
 double float_pop(NgaState *);
 #endif
 
+#ifdef ENABLE_FFI
+int ffi_reserve(NgaState *, int);
+#endif
+
 #ifdef ENABLE_FILES
 CELL files_get_handle(NgaState *);
 FILE *files_get_open_handle(NgaState *, CELL, const char *);
@@ -51,7 +51,8 @@ V scripting_name(NgaState *vm) {
 
 /* addeded in scripting i/o device, revision 1 */
 V scripting_source(NgaState *vm) {
-  stack_push(vm, string_inject(vm, vm->scripting_sources[vm->current_source], stack_pop(vm)));
+  char *name = vm->sources != NULL ? vm->sources[vm->current_source] : NULL;
+  stack_push(vm, string_inject(vm, name, stack_pop(vm)));
 }
 
 V scripting_line(NgaState *vm) {
@@ -73,12 +74,12 @@ V scripting_abort(NgaState *vm) {
 }
 
 V carry_out_abort(NgaState *vm) {
-  ACTIVE.ip = IMAGE_SIZE + 1;
+  ACTIVE.ip = MEMORY_SIZE + 1;
   ACTIVE.rp = 0;
   ACTIVE.sp = 0;
 #ifdef ENABLE_FLOATS
-  vm->fsp = 0;
-  vm->afsp = 0;
+  ACTIVE.fsp = 0;
+  ACTIVE.afsp = 0;
 #endif
 
   if (vm->current_source > 0) {
@@ -92,7 +93,290 @@ V carry_out_abort(NgaState *vm) {
 
 V scripting_line_text(NgaState *vm) {
   CELL target = stack_pop(vm);
-  string_inject(vm, vm->line, target);
+  string_inject(vm, vm->text->line, target);
+}
+
+/*---------------------------------------------------------------------
+  Autoloading
+
+  An autoload index maps words to the files that define them, with a
+  line for each word: the name, a tab, and the file (relative to the
+  index). `make update-autoload` generates `library/autoload.index`.
+
+  When a word is not found, the handler set in scripting.retro asks
+  for it here. If an index has it, and its file has not yet been
+  included, the file is included and the handler retries the token.
+  A file is only included once, so a word the index gets wrong is
+  still reported as not found.
+
+  The indexes in `library/` and `~/.config/retroforth/library/` (the
+  places `library:load` looks) are read on first use. Others can be
+  added with `script:autoload-index`.
+  ---------------------------------------------------------------------*/
+
+struct NgaAutoloadEntry {
+  char *name;
+  int file;
+};
+
+struct NgaAutoloader {
+  struct NgaAutoloadEntry *entries;
+  int count, slots, sorted;
+  char **files;
+  char *included;
+  int file_count, file_slots;
+};
+
+static int compare_autoloads(const void *a, const void *b) {
+  const struct NgaAutoloadEntry *x = a, *y = b;
+  int order = strcmp(x->name, y->name);
+  return order != 0 ? order : x->file - y->file;
+}
+
+static int add_autoload_file(struct NgaAutoloader *al, const char *name) {
+  char **files, *included;
+  int slots = al->file_slots ? al->file_slots * 2 : 8;
+  if (al->file_count == al->file_slots) {
+    files = realloc(al->files, slots * sizeof(char *));
+    if (files == NULL) return -1;
+    al->files = files;
+    included = realloc(al->included, slots);
+    if (included == NULL) return -1;
+    al->included = included;
+    al->file_slots = slots;
+  }
+  if ((al->files[al->file_count] = strdup(name)) == NULL) return -1;
+  al->included[al->file_count] = 0;
+  return al->file_count++;
+}
+
+static int add_autoload(struct NgaAutoloader *al, const char *name, int file) {
+  struct NgaAutoloadEntry *entries;
+  int slots = al->slots ? al->slots * 2 : 64;
+  if (al->count == al->slots) {
+    entries = realloc(al->entries, slots * sizeof(struct NgaAutoloadEntry));
+    if (entries == NULL) return 0;
+    al->entries = entries;
+    al->slots = slots;
+  }
+  if ((al->entries[al->count].name = strdup(name)) == NULL) return 0;
+  al->entries[al->count++].file = file;
+  al->sorted = 0;
+  return 1;
+}
+
+/* Returns 0 if the index can not be read */
+static int read_autoload_index(struct NgaAutoloader *al, const char *index) {
+  FILE *fp = fopen(index, "r");
+  char line[1024], path[1025], last[1025] = "", *tab, *end;
+  const char *slash = strrchr(index, '/');
+  int directory = slash != NULL ? (int)(slash - index) + 1 : 0;
+  int file = -1;
+  if (fp == NULL) return 0;
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (line[0] == '#' || (tab = strchr(line, '\t')) == NULL) continue;
+    *tab++ = '\0';
+    for (end = tab + strlen(tab); end > tab && isspace((unsigned char)end[-1]); end--);
+    *end = '\0';
+    if (line[0] == '\0' || *tab == '\0') continue;
+    if (file < 0 || strcmp(tab, last) != 0) {
+      strlcpy(last, tab, sizeof(last));
+      snprintf(path, sizeof(path), "%.*s%s", directory, index, tab);
+      if ((file = add_autoload_file(al, path)) < 0) break;
+    }
+    if (!add_autoload(al, line, file)) break;
+  }
+  fclose(fp);
+  return 1;
+}
+
+static struct NgaAutoloader *autoloader(NgaState *vm) {
+  char index[1025];
+  const char *home = getenv("HOME");
+  if (vm->autoload != NULL) return vm->autoload;
+  if ((vm->autoload = calloc(1, sizeof(struct NgaAutoloader))) == NULL)
+    return NULL;
+  read_autoload_index(vm->autoload, "library/autoload.index");
+  if (home != NULL) {
+    snprintf(index, sizeof(index), "%s/.config/retroforth/library/autoload.index", home);
+    read_autoload_index(vm->autoload, index);
+  }
+  return vm->autoload;
+}
+
+/* Returns the first entry for the name, which is from the index that
+   was read first. */
+static struct NgaAutoloadEntry *find_autoload(struct NgaAutoloader *al, const char *name) {
+  int low = 0, high = al->count, middle;
+  if (!al->sorted) {
+    qsort(al->entries, al->count, sizeof(struct NgaAutoloadEntry), compare_autoloads);
+    al->sorted = 1;
+  }
+  while (low < high) {
+    middle = low + (high - low) / 2;
+    if (strcmp(al->entries[middle].name, name) < 0)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  if (low < al->count && strcmp(al->entries[low].name, name) == 0)
+    return &al->entries[low];
+  return NULL;
+}
+
+/* Files included since a snapshot are gone after a reset, so allow
+   them to be included again. */
+V reset_autoload(NgaState *vm) {
+  if (vm->autoload != NULL && vm->autoload->file_count > 0)
+    memset(vm->autoload->included, 0, vm->autoload->file_count);
+}
+
+V free_autoload(NgaState *vm) {
+  struct NgaAutoloader *al = vm->autoload;
+  int i;
+  if (al == NULL) return;
+  for (i = 0; i < al->count; i++)
+    free(al->entries[i].name);
+  for (i = 0; i < al->file_count; i++)
+    free(al->files[i]);
+  free(al->entries);
+  free(al->files);
+  free(al->included);
+  free(al);
+  vm->autoload = NULL;
+}
+
+V scripting_autoload_index(NgaState *vm) {
+  struct NgaAutoloader *al = autoloader(vm);
+  char *index = string_extract(vm, stack_pop(vm));
+  stack_push(vm, al != NULL && read_autoload_index(al, index) ? -1 : 0);
+}
+
+/* Takes a token. If its file is included, the token is written back
+   (the file will have overwritten the TIB) and TRUE is returned. */
+V scripting_autoload(NgaState *vm) {
+  struct NgaAutoloader *al = autoloader(vm);
+  struct NgaAutoloadEntry *entry;
+  CELL at = stack_pop(vm);
+  char token[1025];
+  strlcpy(token, string_extract(vm, at), sizeof(token));
+  entry = al != NULL ? find_autoload(al, token) : NULL;
+  if (entry == NULL || al->included[entry->file]) {
+    stack_push(vm, 0);
+    return;
+  }
+  al->included[entry->file] = 1;
+  include_file(vm, al->files[entry->file], 0);
+  string_inject(vm, token, at);
+  stack_push(vm, -1);
+}
+
+/*---------------------------------------------------------------------
+  Metadata
+
+  Images built with `METADATA=external` leave the stack comments and
+  descriptions of words out of the dictionary headers. `d:metadata`
+  asks for them here instead. They are read from the glossary (in
+  the format of doc/words.tsv) on first use, and the entries are kept
+  sorted by name.
+
+  The glossary is looked for in `doc/` and then in the directory it
+  is installed to.
+  ---------------------------------------------------------------------*/
+
+#ifndef RETRO_DATADIR
+#define RETRO_DATADIR "/usr/local/share/RETRO12"
+#endif
+
+struct NgaMetadata {
+  char *text;                      /* The glossary, split in place   */
+  char **entries;                  /* Name, then the other fields    */
+  int count;
+};
+
+static int compare_metadata(const void *a, const void *b) {
+  return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+static char *read_glossary(const char *name) {
+  FILE *fp = fopen(name, "rb");
+  char *text = NULL;
+  long size;
+  if (fp == NULL) return NULL;
+  if (fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) > 0 &&
+      fseek(fp, 0, SEEK_SET) == 0 && (text = malloc(size + 1)) != NULL) {
+    if (fread(text, 1, size, fp) == (size_t)size) {
+      text[size] = '\0';
+    } else {
+      free(text);
+      text = NULL;
+    }
+  }
+  fclose(fp);
+  return text;
+}
+
+static struct NgaMetadata *metadata(NgaState *vm) {
+  struct NgaMetadata *md;
+  char *line, *end, *tab;
+  int lines = 0;
+  if (vm->metadata != NULL) return vm->metadata;
+  if ((md = calloc(1, sizeof(struct NgaMetadata))) == NULL) return NULL;
+  vm->metadata = md;
+  if ((md->text = read_glossary("doc/words.tsv")) == NULL &&
+      (md->text = read_glossary(RETRO_DATADIR "/words.tsv")) == NULL)
+    return md;
+  for (line = md->text; *line; line++)
+    if (*line == '\n') lines++;
+  if ((md->entries = malloc((lines + 1) * sizeof(char *))) == NULL)
+    return md;
+  for (line = md->text; *line; line = end) {
+    end = line + strcspn(line, "\n");
+    if (*end) *end++ = '\0';
+    if ((tab = strchr(line, '\t')) == NULL) continue;
+    *tab = '\0';
+    md->entries[md->count++] = line;
+  }
+  qsort(md->entries, md->count, sizeof(char *), compare_metadata);
+  return md;
+}
+
+V free_metadata(NgaState *vm) {
+  if (vm->metadata == NULL) return;
+  free(vm->metadata->text);
+  free(vm->metadata->entries);
+  free(vm->metadata);
+  vm->metadata = NULL;
+}
+
+/* Takes a name and a field (0: stack, 1: address stack, 2: float
+   stack, 3: description), and copies the field to a buffer. This is
+   empty if there is none; the glossary uses `-` for no address or
+   float stack effect. */
+V scripting_metadata(NgaState *vm) {
+  struct NgaMetadata *md = metadata(vm);
+  CELL target = stack_pop(vm);
+  CELL field = stack_pop(vm);
+  char *name = string_extract(vm, stack_pop(vm));
+  char value[4096] = "", **entry = NULL, *at;
+  size_t length;
+  CELL i;
+  if (md != NULL && md->count > 0)
+    entry = bsearch(&name, md->entries, md->count, sizeof(char *), compare_metadata);
+  if (entry != NULL && field >= 0 && field <= 3) {
+    at = *entry + strlen(*entry) + 1;
+    for (i = 0; i < field && at != NULL; i++)
+      if ((at = strchr(at, '\t')) != NULL) at++;
+    if (at != NULL) {
+      length = strcspn(at, "\t\r");
+      if (length >= sizeof(value)) length = sizeof(value) - 1;
+      memcpy(value, at, length);
+      value[length] = '\0';
+      if ((field == 1 || field == 2) && strcmp(value, "-") == 0)
+        value[0] = '\0';
+    }
+  }
+  string_inject(vm, value, target);
 }
 
 Handler ScriptingActions[] = {
@@ -101,17 +385,18 @@ Handler ScriptingActions[] = {
   scripting_source,        scripting_line,
   scripting_ignore_to_eol, scripting_ignore_to_eof,
   scripting_abort,         scripting_line_text,
-  scripting_include_plain
+  scripting_include_plain, scripting_autoload_index,
+  scripting_autoload,      scripting_metadata
 };
 
 V query_scripting(NgaState *vm) {
-  stack_push(vm, 3);
+  stack_push(vm, 5);
   stack_push(vm, DEVICE_SCRIPTING);
 }
 
 V invalid_scripting_action(NgaState *vm, CELL action) {
-  printf("\nERROR (nga/scripting): Invalid scripting action %lld\n", (long long)action);
-  ACTIVE.ip = IMAGE_SIZE;
+  vm_printf(vm, "\nERROR (nga/scripting): Invalid scripting action %lld\n", (long long)action);
+  ACTIVE.ip = MEMORY_SIZE;
   ACTIVE.rp = 0;
 }
 
@@ -145,50 +430,6 @@ V evaluate(NgaState *vm, char *s) {
 }
 
 
-/*---------------------------------------------------------------------
-  `read_token` reads a token from the specified file.  It will stop on
-   a whitespace or newline. It also tries to handle backspaces, though
-   the success of this depends on how your terminal is configured.
-  ---------------------------------------------------------------------*/
-
-int not_eol(int c) {
-  return (c != 9) && (c != 10) && (c != 13) && (c != 32) && (c != EOF) && (c != 0);
-}
-
-V read_token(FILE *file, char *token_buffer) {
-  int ch = fread_character(file);
-  int count = 0;
-  unsigned char utf8_bytes[4];
-  int num_bytes;
-
-  while (not_eol(ch)) {
-    if ((ch == 8 || ch == 127) && count > 0) {
-      // Handle backspace - need to find start of previous UTF-8 character
-      count--;
-      while (count > 0 && (token_buffer[count] & 0xC0) == 0x80) {
-        count--; // Skip continuation bytes
-      }
-    } else {
-      // Convert UTF-32 character to UTF-8 bytes and store
-      utf32_to_utf8((uint32_t)ch, utf8_bytes, &num_bytes);
-      for (int i = 0; i < num_bytes && count < 65535; i++) {
-        token_buffer[count++] = utf8_bytes[i];
-      }
-    }
-    ch = fread_character(file);
-  }
-  token_buffer[count] = '\0';
-}
-
-
-V skip_indent(FILE *fp) {
-  int ch = getc(fp);
-  while (ch == ' ') {
-    ch = getc(fp);
-  }
-  ungetc(ch, fp);
-}
-
 /*---------------------------------------------------------------------
   RRE is primarily intended to be used in a batch or scripting model.
   The `include_file()` function will be used to read the code in the
@@ -215,66 +456,283 @@ V skip_indent(FILE *fp) {
 
 int fence_boundary(NgaState *vm, char *buffer, int tests_enabled) {
   int flag = 1;
-  if (strcmp(buffer, vm->code_start) == 0) { flag = -1; }
-  if (strcmp(buffer, vm->code_end) == 0)   { flag = -1; }
-  if (strcmp(buffer, vm->test_start) == 0) {
+  if (strcmp(buffer, vm->text->code_start) == 0) { flag = -1; }
+  if (strcmp(buffer, vm->text->code_end) == 0)   { flag = -1; }
+  if (strcmp(buffer, vm->text->test_start) == 0) {
     if (vm->codeBlocks == 0) { vm->codeBlocks++; }
   }
   if (tests_enabled == 0) { return flag; }
-  if (strcmp(buffer, vm->test_start) == 0) { flag = -1; }
-  if (strcmp(buffer, vm->test_end) == 0)   { flag = -1; }
+  if (strcmp(buffer, vm->text->test_start) == 0) { flag = -1; }
+  if (strcmp(buffer, vm->text->test_end) == 0)   { flag = -1; }
   return flag;
 }
 
 
 /*---------------------------------------------------------------------
-  And now for the actual `include_file()` function.
+  Sources are read a line at a time. `read_line` decodes the UTF-8 in
+  a line, stopping at the end of it, and `next_token` then finds each
+  token (these are separated by spaces or tabs) in the line.
   ---------------------------------------------------------------------*/
 
-int read_line(NgaState *vm, FILE *file, char *token_buffer) {
+size_t read_line(FILE *file, char *buffer, size_t size) {
   int ch = fread_character(file);
-  int count = 0;
-  int tokens = 1;
+  size_t count = 0;
   int i;
   int num_bytes;
   unsigned char utf8_bytes[4];
-  token_buffer[0] = '\0';
   while ((ch != 10) && (ch != 13) && (ch != EOF) && (ch != 0)) {
     utf32_to_utf8((uint32_t)ch, utf8_bytes, &num_bytes);
-    for (i = 0; i < num_bytes && count < (int)sizeof(vm->line) - 1; i++) {
-      token_buffer[count++] = utf8_bytes[i];
+    for (i = 0; i < num_bytes && count < size - 1; i++) {
+      buffer[count++] = utf8_bytes[i];
     }
     ch = fread_character(file);
-    if (ch != 10 && ch != 13 && ch != EOF && ch != 0 && isspace((unsigned char)ch)) {
-      tokens++;
+  }
+  buffer[count] = '\0';
+  return count;
+}
+
+/* Returns the length of the next token, leaving `at` at its start */
+static size_t next_token(const char *line, size_t *at) {
+  size_t end;
+  while (line[*at] == ' ' || line[*at] == '\t') (*at)++;
+  for (end = *at; line[end] && line[end] != ' ' && line[end] != '\t'; end++);
+  return end - *at;
+}
+/*---------------------------------------------------------------------
+  The include stack holds the name of each source being run, starting
+  with the one set by the host. It grows as includes are nested.
+  ---------------------------------------------------------------------*/
+
+static int reserve_sources(NgaState *vm, int depth) {
+  char **sources;
+  int slots = vm->source_slots ? vm->source_slots : 8;
+  if (depth < vm->source_slots) return 1;
+  while (slots <= depth) slots *= 2;
+  sources = realloc(vm->sources, slots * sizeof(char *));
+  if (sources == NULL) return 0;
+  memset(sources + vm->source_slots, 0,
+         (slots - vm->source_slots) * sizeof(char *));
+  vm->sources = sources;
+  vm->source_slots = slots;
+  return 1;
+}
+
+static int set_source(NgaState *vm, int depth, const char *name) {
+  char *copy;
+  if (!reserve_sources(vm, depth) || (copy = strdup(name)) == NULL)
+    return 0;
+  free(vm->sources[depth]);
+  vm->sources[depth] = copy;
+  return 1;
+}
+
+/* Names the current source. Hosts use this for the outermost one. */
+V name_source(NgaState *vm, const char *name) {
+  set_source(vm, vm->current_source, name);
+}
+
+static int enter_source(NgaState *vm, const char *name) {
+  if (!set_source(vm, vm->current_source + 1, name)) return 0;
+  vm->current_source++;
+  return 1;
+}
+
+static V leave_source(NgaState *vm) {
+  free(vm->sources[vm->current_source]);
+  vm->sources[vm->current_source] = NULL;
+  vm->current_source--;
+}
+
+/* Used when restoring a VM to a saved state */
+int copy_sources(NgaState *to, NgaState *from) {
+  char *name;
+  int i;
+  while (to->current_source > from->current_source)
+    leave_source(to);
+  for (i = 0; i <= from->current_source; i++) {
+    name = from->sources != NULL ? from->sources[i] : NULL;
+    if (name != NULL) {
+      if (!set_source(to, i, name)) return -1;
+    } else if (i < to->source_slots) {
+      free(to->sources[i]);
+      to->sources[i] = NULL;
     }
   }
-  token_buffer[count] = '\0';
-  return tokens;
+  to->current_source = from->current_source;
+  return 0;
 }
 
-static V include_source(NgaState *vm, char *fname, int run_tests, int fenced) {
+/*---------------------------------------------------------------------
+  And now for the actual `include_file()` function.
+  ---------------------------------------------------------------------*/
+
+static V run_source(NgaState *vm, FILE *fp, int run_tests, int fenced) {
+  char line[TOKENIZED_LINE];
+  char fence[33];                  /* Used with `fence_boundary()`     */
+  char *token;
+  size_t at, length;
+  CELL number = 0;
   int inBlock = 0;                 /* Tracks status of in/out of block */
+
+  while (!feof(fp) && (vm->ignoreToEOF == 0)) { /* Loop through the file   */
+    vm->ignoreToEOL = 0;
+    read_line(fp, line, sizeof(line));
+    strlcpy(vm->text->line, line, sizeof(vm->text->line));
+    number++;
+    at = 0;
+
+    while (vm->ignoreToEOL == 0 && (length = next_token(line, &at)) > 0) {
+      token = line + at;
+      at += length;
+      if (line[at] != '\0') line[at++] = '\0';
+      if (fenced) {
+        strlcpy(fence, token, 32); /* Copy the first three characters */
+        if (fence_boundary(vm, fence, run_tests) == -1) {
+          if (inBlock == 0) {
+            inBlock = 1;
+            vm->codeBlocks++;
+          } else {
+            inBlock = 0;
+          }
+          continue;
+        }
+        if (inBlock == 0) continue;
+      }
+      vm->currentLine = number;
+      evaluate(vm, token);
+      vm->currentLine = number;
+    }
+  }
+}
+
+/*---------------------------------------------------------------------
+  Tokenized sources (see token_format.h) are checked in full when they
+  are loaded, so a damaged one is never partly run. `run_tokenized`
+  does the check (when `run` is zero) as well as the evaluation.
+  ---------------------------------------------------------------------*/
+
+struct Tokenized {
+  unsigned char *data;
+  const unsigned char *records, *end;
+  CELL blocks;
+};
+
+static int tokenized_text(const unsigned char **at, const unsigned char *end,
+                          const unsigned char **text, uint64_t *length) {
+  if (!packed_get(at, end, length) || *length > (uint64_t)(end - *at))
+    return 0;
+  *text = *at;
+  *at += *length;
+  return 1;
+}
+
+static int tokenized_fence(const unsigned char **at, const unsigned char *end,
+                           const char *fence) {
+  const unsigned char *text;
+  uint64_t length;
+  return tokenized_text(at, end, &text, &length) &&
+         length == strlen(fence) && memcmp(text, fence, length) == 0;
+}
+
+static int run_tokenized(NgaState *vm, const unsigned char *at,
+                         const unsigned char *end, int run) {
+  char token[TOKENIZED_LINE];
+  const unsigned char *text;
+  uint64_t line, length, count, skip, size, offset;
+
+  while (at < end && (run == 0 || vm->ignoreToEOF == 0)) {
+    if (!packed_get(&at, end, &line) || !tokenized_text(&at, end, &text, &length) ||
+        length >= TOKENIZED_LINE || !packed_get(&at, end, &count))
+      return 0;
+    if (run) {
+      vm->ignoreToEOL = 0;
+      size = length < sizeof(vm->text->line) ? length : sizeof(vm->text->line) - 1;
+      memcpy(vm->text->line, text, size);
+      vm->text->line[size] = '\0';
+    }
+    for (offset = 0; count > 0; count--) {
+      if (!packed_get(&at, end, &skip) || !packed_get(&at, end, &size) ||
+          skip > length - offset || size == 0 || size > length - offset - skip)
+        return 0;
+      offset += skip;
+      if (run && vm->ignoreToEOL == 0) {
+        memcpy(token, text + offset, size);
+        token[size] = '\0';
+        vm->currentLine = line;
+        evaluate(vm, token);
+        vm->currentLine = line;
+      }
+      offset += size;
+    }
+  }
+  return 1;
+}
+
+/* Load the tokenized copy of `fname`, if there is one that is fresh
+   and was made with the fences in use. */
+static int load_tokenized(NgaState *vm, const char *fname, struct Tokenized *t) {
+  char name[PATH_MAX];
+  struct stat source, copy;
+  const unsigned char *at;
+  uint64_t bytes, mtime, blocks;
+  FILE *fp;
+
+  t->data = NULL;
+  if (stat(fname, &source) != 0 ||
+      snprintf(name, sizeof(name), "%s%s", fname, TOKENIZED_SUFFIX) >= (int)sizeof(name) ||
+      (fp = fopen(name, "rb")) == NULL)
+    return 0;
+  if (fstat(fileno(fp), &copy) == 0 && copy.st_size > 5 &&
+      (t->data = malloc(copy.st_size)) != NULL &&
+      fread(t->data, 1, copy.st_size, fp) != (size_t)copy.st_size) {
+    free(t->data);
+    t->data = NULL;
+  }
+  fclose(fp);
+  if (t->data == NULL) return 0;
+
+  at = t->data + 5;
+  t->end = t->data + copy.st_size;
+  if (memcmp(t->data, TOKENIZED_MAGIC, 4) != 0 || t->data[4] != TOKENIZED_VERSION ||
+      !packed_get(&at, t->end, &bytes) || bytes != (uint64_t)source.st_size ||
+      !packed_get(&at, t->end, &mtime) || mtime != (uint64_t)source.st_mtime ||
+      !packed_get(&at, t->end, &blocks) ||
+      !tokenized_fence(&at, t->end, vm->text->code_start) ||
+      !tokenized_fence(&at, t->end, vm->text->code_end) ||
+      !tokenized_fence(&at, t->end, vm->text->test_start) ||
+      !run_tokenized(vm, at, t->end, 0)) {
+    free(t->data);
+    t->data = NULL;
+    return 0;
+  }
+  t->records = at;
+  t->blocks = (CELL)blocks;
+  return 1;
+}
+
+static V include_source(NgaState *vm, char *fname, int run_tests, int fenced) {
+  struct Tokenized tokenized;
   int priorBlocks = 0;
-  char source[64 * 1024];          /* Token buffer [about 64K]         */
-  char fence[33];                  /* Used with `fence_boundary()`     */
 
-  CELL ReturnStack[ADDRESSES];
+  CELL *ReturnStack;
   CELL arp, aip;
 
-  long offset = 0;
-  CELL at = 0;
-  int tokens = 0;
-  FILE *fp;                        /* Open the file. If not found,     */
+  FILE *fp = NULL;                 /* Open the file. If not found,     */
   if (vm->current_source >= MAX_SCRIPTING_SOURCES - 1) {
-    printf("Maximum source include depth exceeded. Exiting.\n");
-    exit(1);
+    vm_printf(vm, "Maximum source include depth exceeded. Exiting.\n");
+    halt_vm(vm, 1);
+    return;
   }
 
-  fp = fopen(fname, "r");          /* exit.                            */
-  if (fp == NULL) {
-    printf("File `%s` not found. Exiting.\n", fname);
-    exit(1);
+  /* Use a tokenized copy in place of a literate source if possible */
+  tokenized.data = NULL;
+  if (fenced && !run_tests)
+    load_tokenized(vm, fname, &tokenized);
+
+  if (tokenized.data == NULL && (fp = fopen(fname, "r")) == NULL) {
+    vm_printf(vm, "File `%s` not found. Exiting.\n", fname);
+    halt_vm(vm, 1);                /* exit.                            */
+    return;
   }
 
   if (fenced) {
@@ -284,58 +742,32 @@ static V include_source(NgaState *vm, char *fname, int run_tests, int fenced) {
 
   arp = ACTIVE.rp;
   aip = ACTIVE.ip;
+  ReturnStack = malloc((arp + 1) * sizeof(CELL));
+  if (ReturnStack == NULL || !enter_source(vm, fname)) {
+    free(ReturnStack);
+    free(tokenized.data);
+    if (fp != NULL) fclose(fp);
+    vm_printf(vm, "Unable to allocate memory to include `%s`. Exiting.\n", fname);
+    halt_vm(vm, 1);
+    return;
+  }
   for(ACTIVE.rp = 0; ACTIVE.rp <= arp; ACTIVE.rp++)
     ReturnStack[ACTIVE.rp] = ACTIVE.address[ACTIVE.rp];
   ACTIVE.rp = 0;
 
-  vm->current_source++;
-  strlcpy(vm->scripting_sources[vm->current_source], fname, 8192);
-
   vm->ignoreToEOF = 0;
 
-  while (!feof(fp) && (vm->ignoreToEOF == 0)) { /* Loop through the file   */
-
-    vm->ignoreToEOL = 0;
-
-    offset = ftell(fp);
-    tokens = read_line(vm, fp, vm->line);
-    at++;
-    fseek(fp, offset, SEEK_SET);
-    skip_indent(fp);
-
-    while (tokens > 0 && vm->ignoreToEOL == 0) {
-      tokens--;
-      read_token(fp, source);
-      if (fenced) {
-        strlcpy(fence, source, 32); /* Copy the first three characters */
-        if (fence_boundary(vm, fence, run_tests) == -1) {
-          if (inBlock == 0) {
-            inBlock = 1;
-            vm->codeBlocks++;
-          } else {
-            inBlock = 0;
-          }
-        } else {
-          if (inBlock == 1) {
-            vm->currentLine = at;
-            evaluate(vm, source);
-            vm->currentLine = at;
-          }
-        }
-      } else {
-        vm->currentLine = at;
-        evaluate(vm, source);
-        vm->currentLine = at;
-      }
-    }
-    if (vm->ignoreToEOL == -1) {
-      read_line(vm, fp, vm->line);
-    }
+  if (tokenized.data != NULL) {
+    vm->codeBlocks = tokenized.blocks;
+    run_tokenized(vm, tokenized.records, tokenized.end, 1);
+  } else {
+    run_source(vm, fp, run_tests, fenced);
   }
 
-  vm->current_source--;
+  leave_source(vm);
   vm->ignoreToEOF = 0;
-  fclose(fp);
+  if (fp != NULL) fclose(fp);
+  free(tokenized.data);
   if (vm->perform_abort == -1) {
     carry_out_abort(vm);
   }
@@ -343,13 +775,14 @@ static V include_source(NgaState *vm, char *fname, int run_tests, int fenced) {
     ACTIVE.address[ACTIVE.rp] = ReturnStack[ACTIVE.rp];
   ACTIVE.rp = arp;
   ACTIVE.ip = aip;
+  free(ReturnStack);
 
   if (fenced) {
     if (vm->codeBlocks == 0) {
-      printf("warning: no code or test blocks found!\n");
-      printf("         filename: %s\n", fname);
-      printf("         see http://unu.retroforth.org for a brief summary of\n");
-      printf("         the unu code format used by retro\n");
+      vm_printf(vm, "warning: no code or test blocks found!\n");
+      vm_printf(vm, "         filename: %s\n", fname);
+      vm_printf(vm, "         see http://unu.retroforth.org for a brief summary of\n");
+      vm_printf(vm, "         the unu code format used by retro\n");
     }
     vm->codeBlocks = priorBlocks;
   }
@@ -363,19 +796,71 @@ V include_plain_file(NgaState *vm, char *fname, int run_tests) {
   include_source(vm, fname, run_tests, 0);
 }
 
+/*---------------------------------------------------------------------
+  `evaluate_source()` runs code from a buffer rather than a file. The
+  buffer is treated like a plain (unfenced) source: each line is split
+  on whitespace and the tokens are evaluated in order. This is used by
+  hosts that embed the VM.
+  ---------------------------------------------------------------------*/
+
+V evaluate_source(NgaState *vm, const char *source, size_t length) {
+  char token[sizeof(vm->text->line)];
+  size_t at = 0, end, next, start, count;
+
+  if (vm->current_source >= MAX_SCRIPTING_SOURCES - 1) {
+    vm_printf(vm, "Maximum source include depth exceeded.\n");
+    halt_vm(vm, 1);
+    return;
+  }
+  if (!enter_source(vm, "<buffer>")) {
+    vm_printf(vm, "Unable to allocate memory for the source.\n");
+    halt_vm(vm, 1);
+    return;
+  }
+  vm->currentLine = 0;
+  vm->ignoreToEOF = 0;
+
+  while (at < length && vm->ignoreToEOF == 0) {
+    for (end = at; end < length && source[end] != 10 && source[end] != 13; end++);
+    next = end + 1;
+    vm->currentLine++;
+    vm->ignoreToEOL = 0;
+    count = end - at < sizeof(vm->text->line) - 1 ? end - at : sizeof(vm->text->line) - 1;
+    memcpy(vm->text->line, source + at, count);
+    vm->text->line[count] = '\0';
+
+    while (at < end && vm->ignoreToEOL == 0) {
+      while (at < end && isspace((unsigned char)source[at])) at++;
+      start = at;
+      while (at < end && !isspace((unsigned char)source[at])) at++;
+      count = at - start < sizeof(token) - 1 ? at - start : sizeof(token) - 1;
+      memcpy(token, source + start, count);
+      token[count] = '\0';
+      evaluate(vm, token);
+    }
+    at = next;
+  }
+
+  leave_source(vm);
+  vm->ignoreToEOF = 0;
+  if (vm->perform_abort == -1) {
+    carry_out_abort(vm);
+  }
+}
+
 V initialize_scripting(NgaState *vm) {
   vm->interactive = 0;
 
-  strlcpy(vm->code_start, "~~~", 256);
-  strlcpy(vm->code_end,   "~~~", 256);
-  strlcpy(vm->test_start, "```", 256);
-  strlcpy(vm->test_end,   "```", 256);
+  strlcpy(vm->text->code_start, "~~~", 256);
+  strlcpy(vm->text->code_end,   "~~~", 256);
+  strlcpy(vm->text->test_start, "```", 256);
+  strlcpy(vm->text->test_end,   "```", 256);
 
   /* Setup variables related to the scripting device */
   vm->currentLine = 0;           /* Current Line # for script */
   vm->current_source = 0;        /* Current file being run    */
   vm->perform_abort = 0;         /* Carry out abort procedure */
-  strlcpy(vm->scripting_sources[0], "/dev/stdin", 8192);
+  name_source(vm, "/dev/stdin");
   vm->ignoreToEOL = 0;
   vm->ignoreToEOF = 0;
   vm->codeBlocks = 0;
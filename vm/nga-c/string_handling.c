@@ -81,12 +81,14 @@ static size_t decode_utf8_character(const unsigned char *input,
 
 typedef int (*Utf8ByteReader)(void *, unsigned char *);
 
-static int read_utf8_character(void *source, Utf8ByteReader read_byte) {
+/* Returns `end` if there is nothing left to read */
+static int read_utf8_character(void *source, Utf8ByteReader read_byte,
+                               int end) {
   unsigned char bytes[4];
   uint32_t character;
   size_t length, i;
 
-  if (!read_byte(source, &bytes[0])) return 0;
+  if (!read_byte(source, &bytes[0])) return end;
   length = utf8_character_length(bytes[0]);
   if (length == 0) return 0;
   for (i = 1; i < length; i++) {
@@ -104,12 +106,13 @@ static int read_file_byte(void *source, unsigned char *byte) {
   return fread(byte, 1, 1, source) == 1;
 }
 
+/* The listener treats -1 as the end of input */
 int read_character(int from) {
-  return read_utf8_character(&from, read_descriptor_byte);
+  return read_utf8_character(&from, read_descriptor_byte, -1);
 }
 
 int fread_character(FILE *from) {
-  return read_utf8_character(from, read_file_byte);
+  return read_utf8_character(from, read_file_byte, 0);
 }
 
 V string_memory_error(const char *operation) {
@@ -120,12 +123,13 @@ CELL string_inject(NgaState *vm, char *str, CELL buffer) {
   const unsigned char *input;
   size_t input_length, offset, cells;
 
-  if (buffer < 0 || buffer >= IMAGE_SIZE) {
+  if (buffer < 0 || buffer >= MEMORY_SIZE) {
     string_memory_error("string_inject");
     return 0;
   }
   if (!str) {
     vm->memory[buffer] = 0;
+    MARK_DIRTY(vm, buffer);
     return 0;
   }
 
@@ -136,7 +140,7 @@ CELL string_inject(NgaState *vm, char *str, CELL buffer) {
     offset += decode_utf8_character(input + offset, input_length - offset,
                                     &character);
   }
-  if (cells >= (size_t)(IMAGE_SIZE - buffer)) {
+  if (cells >= (size_t)(MEMORY_SIZE - buffer)) {
     string_memory_error("string_inject");
     return 0;
   }
@@ -148,22 +152,23 @@ CELL string_inject(NgaState *vm, char *str, CELL buffer) {
     vm->memory[buffer + cells] = (CELL)character;
   }
   vm->memory[buffer + cells] = 0;
+  mark_dirty(vm, buffer, cells + 1);
   return buffer;
 }
 
 char *string_extract(NgaState *vm, CELL at) {
   CELL i = 0;
-  if (at < 0 || at >= IMAGE_SIZE) {
+  if (at < 0 || at >= MEMORY_SIZE) {
     string_memory_error("string_extract");
-    vm->string_data[0] = 0;
-    return vm->string_data;
+    vm->text->string_data[0] = 0;
+    return vm->text->string_data;
   }
-  while (at < IMAGE_SIZE && vm->memory[at] &&
-         i < (CELL)sizeof(vm->string_data) - 1) {
-    vm->string_data[i++] = (char)vm->memory[at++];
+  while (at < MEMORY_SIZE && vm->memory[at] &&
+         i < (CELL)sizeof(vm->text->string_data) - 1) {
+    vm->text->string_data[i++] = (char)vm->memory[at++];
   }
-  vm->string_data[i] = 0;
-  return vm->string_data;
+  vm->text->string_data[i] = 0;
+  return vm->text->string_data;
 }
 
 #define RETRO_STRING_HANDLING_IMPLEMENTED 1
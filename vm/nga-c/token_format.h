@@ -0,0 +1,46 @@
+/*---------------------------------------------------------------------
+  Tokenized Sources
+
+  `retro-tokenize` compiles a literate source (foo.retro) into a
+  tokenized one (foo.retro.rtok). When a file is included, a tokenized
+  copy next to it is used in place of the source, if it is still
+  fresh. It holds only the lines with code to run, split into tokens,
+  so the include does no UTF-8 decoding or fence matching.
+
+  As with packed images, all fields are bytes or varints (see
+  image_format.h).
+
+    magic          "RTOK"
+    version        1 byte (TOKENIZED_VERSION)
+    source bytes   varint  \ the size and modification time of the
+    source mtime   varint  / source; if either differs, it is stale
+    blocks         varint (code blocks, as counted by the include)
+    code start     varint length, then the text of each fence
+    code end
+    test start
+
+  Then, for each line with tokens to evaluate:
+
+    line           varint (line number, counting from 1)
+    length         varint, then the text of the line
+    tokens         varint (count), then each as two varints: the
+                   distance from the end of the prior token (or the
+                   start of the line) and the length
+
+  The include honours `script:ignore-to-eol` and `script:ignore-to-eof`
+  as it would with the source. Since a closing fence after other code
+  on a line could be skipped at run time, and the prose after it then
+  run, the tool does not tokenize files that have one.
+  ---------------------------------------------------------------------*/
+
+#ifndef RETRO_NGA_C_TOKEN_FORMAT_H
+#define RETRO_NGA_C_TOKEN_FORMAT_H
+
+#define TOKENIZED_MAGIC      "RTOK"
+#define TOKENIZED_VERSION    1
+#define TOKENIZED_SUFFIX     ".rtok"
+
+/* The longest line either side will handle */
+#define TOKENIZED_LINE       (64 * 1024)
+
+#endif